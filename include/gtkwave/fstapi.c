@@ -3054,6 +3054,73 @@ void fstWriterEmitValueChangeVec64(fstWriterContext *xc,
     }
 }
 
+/*
+ * Record a fixed length value change, and return where the caller must write
+ * the value, in the same form as for fstWriterEmitValueChange, before making
+ * any other call on the context.  This saves copying the value from a caller
+ * buffer.  Returns NULL if fstWriterEmitValueChange must be used instead.
+ */
+unsigned char *fstWriterEmitValueChangeInPlace(fstWriterContext *xc, fstHandle handle)
+{
+#ifdef FST_REMOVE_DUPLICATE_VC
+    (void)xc;
+    (void)handle;
+    return NULL; /* needs the value to compare against the current one */
+#else
+    uint32_t *vm4ip;
+    uint32_t len;
+    uint32_t fpos;
+    uint32_t v;
+    uint32_t nxt;
+    unsigned char *pnt;
+
+    if (FST_UNLIKELY(!xc || handle > xc->maxhandle)) {
+        return NULL;
+    }
+    if (FST_UNLIKELY(!xc->valpos_mem)) {
+        xc->vc_emitted = 1;
+        fstWriterCreateMmaps(xc);
+    }
+
+    vm4ip = &(xc->valpos_mem[4 * (handle - 1)]);
+    len = vm4ip[1];
+    if (FST_UNLIKELY(!len)) { /* variable length */
+        return NULL;
+    }
+    if (FST_UNLIKELY(xc->is_initial_time)) {
+        return xc->curval_mem + vm4ip[0];
+    }
+
+    fpos = xc->vchg_siz;
+    if (FST_UNLIKELY((fpos + len + 10) > xc->vchg_alloc_siz)) {
+        xc->vchg_alloc_siz += (xc->fst_break_add_size + len);
+        xc->vchg_mem = (unsigned char *)realloc(xc->vchg_mem, xc->vchg_alloc_siz);
+        if (FST_UNLIKELY(!xc->vchg_mem)) {
+            fprintf(stderr,
+                    FST_APIMESS
+                    "Could not realloc() in fstWriterEmitValueChangeInPlace, exiting.\n");
+            exit(255);
+        }
+    }
+
+    /* same layout as fstWriterUint32WithVarint32, less the value */
+    pnt = xc->vchg_mem + fpos;
+    memcpy(pnt, &vm4ip[2], sizeof(uint32_t));
+    pnt += 4;
+    v = xc->tchn_idx - vm4ip[3];
+    while ((nxt = v >> 7)) {
+        *(pnt++) = ((unsigned char)v) | 0x80;
+        v = nxt;
+    }
+    *(pnt++) = (unsigned char)v;
+
+    xc->vchg_siz = (pnt - xc->vchg_mem) + len;
+    vm4ip[3] = xc->tchn_idx;
+    vm4ip[2] = fpos;
+    return pnt;
+#endif
+}
+
 void fstWriterEmitVariableLengthValueChange(fstWriterContext *xc,
                                             fstHandle handle,
                                             const void *val,
@@ -419,6 +419,7 @@ void fstWriterEmitValueChangeVec64(fstWriterContext *ctx,
                                     fstHandle handle,
                                     uint32_t bits,
                                     const uint64_t *val);
+unsigned char *fstWriterEmitValueChangeInPlace(fstWriterContext *ctx, fstHandle handle);
 void fstWriterEmitVariableLengthValueChange(fstWriterContext *ctx,
                                             fstHandle handle,
                                             const void *val,
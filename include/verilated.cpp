@@ -55,7 +55,9 @@
 #include <algorithm>
 #include <cctype>
 #include <cerrno>
+#include <chrono>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
 #include <limits>
 #include <list>
@@ -77,10 +79,16 @@
 # include <sys/resource.h>
 # define _VL_HAVE_GETRLIMIT
 #endif
+#ifndef _WIN32
+# include <fcntl.h>
+# include <unistd.h>
+# define _VL_HAVE_FORK
+#endif
 
 #include "verilated_threads.h"
 // clang-format on
 
+#include "verilated_intrinsics.h"
 #include "verilated_trace.h"
 
 #ifdef VM_SOLVER_DEFAULT
@@ -384,13 +392,13 @@ VlRNG& VlRNG::vl_thread_rng() VL_MT_SAFE {
 }
 
 WDataOutP VL_RANDOM_W(int obits, WDataOutP outwp) VL_MT_SAFE {
-    for (int i = 0; i < VL_WORDS_I(obits); ++i) outwp[i] = vl_rand64();
+    VlRNG::vl_thread_rng().fill(outwp, VL_WORDS_I(obits));
     // Last word is unclean
     return outwp;
 }
 
 WDataOutP VL_RANDOM_RNG_W(VlRNG& rngr, int obits, WDataOutP outwp) VL_MT_UNSAFE {
-    for (int i = 0; i < VL_WORDS_I(obits); ++i) outwp[i] = rngr.rand64();
+    rngr.fill(outwp, VL_WORDS_I(obits));
     // Last word is unclean
     return outwp;
 }
@@ -433,8 +441,8 @@ WDataOutP VL_SCOPED_RAND_RESET_W(int obits, WDataOutP outwp, uint64_t scopeHash,
                                  uint64_t salt) VL_MT_UNSAFE {
     if (Verilated::threadContextp()->randReset() != 2) { return VL_RAND_RESET_W(obits, outwp); }
     VlRNG rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
-    for (int i = 0; i < VL_WORDS_I(obits) - 1; ++i) outwp[i] = rng.rand64();
-    outwp[VL_WORDS_I(obits) - 1] = rng.rand64() & VL_MASK_E(obits);
+    rng.fill(outwp, VL_WORDS_I(obits));
+    outwp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     return outwp;
 }
 
@@ -453,8 +461,8 @@ QData VL_SCOPED_RAND_RESET_ASSIGN_Q(int obits, uint64_t scopeHash, uint64_t salt
 WDataOutP VL_SCOPED_RAND_RESET_ASSIGN_W(int obits, WDataOutP outwp, uint64_t scopeHash,
                                         uint64_t salt) VL_MT_UNSAFE {
     VlRNG rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
-    for (int i = 0; i < VL_WORDS_I(obits) - 1; ++i) outwp[i] = rng.rand64();
-    outwp[VL_WORDS_I(obits) - 1] = rng.rand64() & VL_MASK_E(obits);
+    rng.fill(outwp, VL_WORDS_I(obits));
+    outwp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     return outwp;
 }
 
@@ -479,8 +487,13 @@ QData VL_RAND_RESET_Q(int obits) VL_MT_SAFE {
 }
 
 WDataOutP VL_RAND_RESET_W(int obits, WDataOutP outwp) VL_MT_SAFE {
-    for (int i = 0; i < VL_WORDS_I(obits) - 1; ++i) outwp[i] = VL_RAND_RESET_I(32);
-    outwp[VL_WORDS_I(obits) - 1] = VL_RAND_RESET_I(32) & VL_MASK_E(obits);
+    const int randReset = Verilated::threadContextp()->randReset();
+    if (randReset == 2) {  // Randomize
+        VlRNG::vl_thread_rng().fill(outwp, VL_WORDS_I(obits));
+    } else {
+        std::fill(outwp, outwp + VL_WORDS_I(obits), randReset ? ~VL_EUL(0) : VL_EUL(0));
+    }
+    outwp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     return outwp;
 }
 WDataOutP VL_ZERO_RESET_W(int obits, WDataOutP outwp) VL_MT_SAFE {
@@ -497,6 +510,226 @@ void _vl_debug_print_w(int lbits, const WDataInP iwp) VL_MT_SAFE {
     VL_PRINTF_MT("\n");
 }
 
+//===========================================================================
+// Wide operator SIMD loops
+
+IData _vl_redor_w_simd(int words, const WDataInP lwp) VL_PURE {
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    if (words >= 8) {
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= words; i += 8) {
+            acc = _mm256_or_si256(acc,
+                                  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i)));
+        }
+        if (!_mm256_testz_si256(acc, acc)) return 1;
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    if (words - i >= 4) {
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= words; i += 4) {
+            acc = _mm_or_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp + i)));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(acc, _mm_setzero_si128())) != 0xffff) return 1;
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    if (words - i >= 4) {
+        uint32x4_t acc = vdupq_n_u32(0);
+        for (; i + 4 <= words; i += 4) acc = vorrq_u32(acc, vld1q_u32(lwp + i));
+        const uint32x2_t half = vorr_u32(vget_low_u32(acc), vget_high_u32(acc));
+        if (vget_lane_u32(half, 0) | vget_lane_u32(half, 1)) return 1;
+    }
+#endif
+    EData equal = 0;
+    for (; i < words; ++i) equal |= lwp[i];
+    return (equal != 0);
+}
+
+IData _vl_countones_w_simd(int words, const WDataInP lwp) VL_PURE {
+    EData r = 0;
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    if (words >= 8) {
+        // Count each nibble with a table lookup, then sum the bytes of each 64-bit lane
+        const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,  //
+                                             0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i nibble = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= words; i += 8) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i));
+            const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, nibble));
+            const __m256i hi
+                = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+            const __m256i sum = _mm256_add_epi8(lo, hi);
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(sum, _mm256_setzero_si256()));
+        }
+        r += _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+             + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    if (words - i >= 4) {
+        uint64x2_t acc = vdupq_n_u64(0);
+        for (; i + 4 <= words; i += 4) {
+            const uint8x16_t counts = vcntq_u8(vreinterpretq_u8_u32(vld1q_u32(lwp + i)));
+            acc = vaddq_u64(acc, vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(counts))));
+        }
+        r += vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+    }
+#endif
+    for (; i < words; ++i) r += VL_COUNTONES_E(lwp[i]);
+    return r;
+}
+
+EData _vl_xor_or_w_simd(int words, const WDataInP lwp, const WDataInP rwp) VL_PURE {
+    EData od = 0;
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    if (words >= 8) {
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= words; i += 8) {
+            const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i));
+            const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp + i));
+            acc = _mm256_or_si256(acc, _mm256_xor_si256(l, r));
+        }
+        // Fold to 32 bits, so the result is the same as the scalar loop's
+        __m128i fold
+            = _mm_or_si128(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        fold = _mm_or_si128(fold, _mm_shuffle_epi32(fold, 0x4e));
+        fold = _mm_or_si128(fold, _mm_shuffle_epi32(fold, 0xb1));
+        od |= static_cast<EData>(_mm_cvtsi128_si32(fold));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    if (words - i >= 4) {
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= words; i += 4) {
+            const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp + i));
+            const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp + i));
+            acc = _mm_or_si128(acc, _mm_xor_si128(l, r));
+        }
+        acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0x4e));
+        acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0xb1));
+        od |= static_cast<EData>(_mm_cvtsi128_si32(acc));
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    if (words - i >= 4) {
+        uint32x4_t acc = vdupq_n_u32(0);
+        for (; i + 4 <= words; i += 4) {
+            acc = vorrq_u32(acc, veorq_u32(vld1q_u32(lwp + i), vld1q_u32(rwp + i)));
+        }
+        const uint32x2_t half = vorr_u32(vget_low_u32(acc), vget_high_u32(acc));
+        od |= vget_lane_u32(half, 0) | vget_lane_u32(half, 1);
+    }
+#endif
+    for (; i < words; ++i) od |= (lwp[i] ^ rwp[i]);
+    return od;
+}
+
+WDataOutP _vl_and_w_simd(int words, WDataOutP owp, const WDataInP lwp,
+                         const WDataInP rwp) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    for (; i + 8 <= words; i += 8) {
+        const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i));
+        const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(owp + i), _mm256_and_si256(l, r));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    for (; i + 4 <= words; i += 4) {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp + i));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(owp + i), _mm_and_si128(l, r));
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    for (; i + 4 <= words; i += 4) {
+        vst1q_u32(owp + i, vandq_u32(vld1q_u32(lwp + i), vld1q_u32(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    return owp;
+}
+
+WDataOutP _vl_or_w_simd(int words, WDataOutP owp, const WDataInP lwp,
+                        const WDataInP rwp) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    for (; i + 8 <= words; i += 8) {
+        const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i));
+        const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(owp + i), _mm256_or_si256(l, r));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    for (; i + 4 <= words; i += 4) {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp + i));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(owp + i), _mm_or_si128(l, r));
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    for (; i + 4 <= words; i += 4) {
+        vst1q_u32(owp + i, vorrq_u32(vld1q_u32(lwp + i), vld1q_u32(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    return owp;
+}
+
+WDataOutP _vl_xor_w_simd(int words, WDataOutP owp, const WDataInP lwp,
+                         const WDataInP rwp) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    for (; i + 8 <= words; i += 8) {
+        const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i));
+        const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rwp + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(owp + i), _mm256_xor_si256(l, r));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    for (; i + 4 <= words; i += 4) {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp + i));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rwp + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(owp + i), _mm_xor_si128(l, r));
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    for (; i + 4 <= words; i += 4) {
+        vst1q_u32(owp + i, veorq_u32(vld1q_u32(lwp + i), vld1q_u32(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    return owp;
+}
+
+WDataOutP _vl_not_w_simd(int words, WDataOutP owp, const WDataInP lwp) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_HAVE_AVX2
+    const __m256i ones256 = _mm256_set1_epi32(-1);
+    for (; i + 8 <= words; i += 8) {
+        const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lwp + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(owp + i), _mm256_xor_si256(l, ones256));
+    }
+#endif
+#ifdef VL_HAVE_SSE2
+    const __m128i ones128 = _mm_set1_epi32(-1);
+    for (; i + 4 <= words; i += 4) {
+        const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lwp + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(owp + i), _mm_xor_si128(l, ones128));
+    }
+#endif
+#ifdef VL_HAVE_NEON
+    for (; i + 4 <= words; i += 4) vst1q_u32(owp + i, vmvnq_u32(vld1q_u32(lwp + i)));
+#endif
+    for (; i < words; ++i) owp[i] = ~(lwp[i]);
+    return owp;
+}
+
 //===========================================================================
 // Slow expressions
 
@@ -744,51 +977,69 @@ double VL_ISTOR_D_W(int lbits, const WDataInP lwp) VL_MT_SAFE {
 
 // Output a string representation of a wide number
 std::string VL_DECIMAL_NW(int width, const WDataInP lwp) VL_MT_SAFE {
-    const int maxdecwidth = (width + 3) * 4 / 3;
-    // Or (maxdecwidth+7)/8], but can't have more than 4 BCD bits per word
-    VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> bcd;
-    VL_ZERO_W(maxdecwidth, bcd);
-    VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> tmp;
-    VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> tmp2;
-    int from_bit = width - 1;
-    // Skip all leading zeros
-    for (; from_bit >= 0 && !(VL_BITRSHIFT_W(lwp, from_bit) & 1); --from_bit) {}
-    // Double-dabble algorithm
-    for (; from_bit >= 0; --from_bit) {
-        // Any digits >= 5 need an add 3 (via tmp)
-        for (int nibble_bit = 0; nibble_bit < maxdecwidth; nibble_bit += 4) {
-            if ((VL_BITRSHIFT_W(bcd, nibble_bit) & 0xf) >= 5) {
-                VL_ZERO_W(maxdecwidth, tmp2);
-                tmp2[VL_BITWORD_E(nibble_bit)] |= VL_EUL(0x3) << VL_BITBIT_E(nibble_bit);
-                VL_ASSIGN_W(maxdecwidth, tmp, bcd);
-                VL_ADD_W(VL_WORDS_I(maxdecwidth), bcd, tmp, tmp2);
-            }
+    // Repeatedly divide by 10^9, the largest power of 10 that fits in a word, so each
+    // division produces the next nine digits as its remainder
+    constexpr EData chunkDivisor = 1000000000;
+    constexpr int chunkDigits = 9;
+    VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> quot;
+    int words = VL_WORDS_I(width);
+    VL_ASSIGN_W(width, quot, lwp);
+    quot[words - 1] &= VL_MASK_E(width);
+    while (words > 0 && !quot[words - 1]) --words;
+    // log10(2) < 1/3, so this is always enough digits
+    std::string output(width / 3 + chunkDigits + 1, '0');
+    size_t pos = output.size();
+    do {
+        uint64_t rem = 0;
+        for (int i = words - 1; i >= 0; --i) {
+            const uint64_t cur = (rem << VL_EDATASIZE) | quot[i];
+            quot[i] = static_cast<EData>(cur / chunkDivisor);
+            rem = cur % chunkDivisor;
         }
-        // Shift; bcd = bcd << 1
-        VL_ASSIGN_W(maxdecwidth, tmp, bcd);
-        VL_SHIFTL_WWI(maxdecwidth, maxdecwidth, 32, bcd, tmp, 1);
-        // bcd[0] = lwp[from_bit]
-        if (VL_BITISSET_W(lwp, from_bit)) bcd[0] |= 1;
-    }
-    std::string output;
-    int lsb = (maxdecwidth - 1) & ~3;
-    for (; lsb > 0; lsb -= 4) {  // Skip leading zeros
-        if (VL_BITRSHIFT_W(bcd, lsb) & 0xf) break;
-    }
-    for (; lsb >= 0; lsb -= 4) {
-        output += ('0' + (VL_BITRSHIFT_W(bcd, lsb) & 0xf));  // 0..9
-    }
+        while (words > 0 && !quot[words - 1]) --words;
+        // All but the most significant chunk are zero padded to nine digits
+        for (int digit = 0; digit < chunkDigits; ++digit) {
+            output[--pos] = static_cast<char>('0' + rem % 10);
+            rem /= 10;
+            if (!words && !rem) break;
+        }
+    } while (words > 0);
+    output.erase(0, pos);
     return output;
 }
 
+// Pad the field appended to output since position start out to the given width
+static void _vl_vsformat_pad(std::string& output, size_t start, size_t width, bool left,
+                             char padChar) VL_MT_SAFE {
+    const size_t digits = output.size() - start;
+    if (width <= digits) return;
+    if (left) {
+        output.append(width - digits, ' ');
+    } else {
+        output.insert(start, width - digits, padChar);
+    }
+}
+
+// Append an unsigned decimal number, without going through snprintf
+static void _vl_vsformat_udec(std::string& output, uint64_t value) VL_MT_SAFE {
+    char buf[20];  // Enough for 2^64
+    char* const endp = buf + sizeof(buf);
+    char* ptr = endp;
+    do {
+        *--ptr = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+    output.append(ptr, endp - ptr);
+}
+
 template <typename T>
-std::string _vl_vsformat_time(char* tmp, T ld, int timeunit, bool left, size_t width) VL_MT_SAFE {
+void _vl_vsformat_time(std::string& output, char* tmp, T ld, int timeunit, bool left,
+                       size_t width) VL_MT_SAFE {
     const VerilatedContextImp* const ctxImpp = Verilated::threadContextp()->impp();
     const std::string suffix = ctxImpp->timeFormatSuffix();
     const int userUnits = ctxImpp->timeFormatUnits();  // 0..-15
     const int fracDigits = ctxImpp->timeFormatPrecision();  // 0..N
     const int shift = -userUnits + fracDigits + timeunit;  // 0..-15
-    int digits = 0;
     if (std::numeric_limits<T>::is_integer) {
         constexpr int b = 128;
         constexpr int w = VL_WORDS_I(b);
@@ -829,18 +1080,18 @@ std::string _vl_vsformat_time(char* tmp, T ld, int timeunit, bool left, size_t w
                 VL_ASSIGN_W(b, v, divided);
             }
             if (!fracDigits) {
-                digits = VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%s%s", ptr, suffix.c_str());
+                VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%s%s", ptr, suffix.c_str());
             } else {
-                digits = VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%s.%0*" PRIu64 "%s", ptr,
+                VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%s.%0*" PRIu64 "%s", ptr,
                                      fracDigits, VL_SET_QW(frac), suffix.c_str());
             }
         } else {
             const uint64_t integer64 = VL_SET_QW(integer);
             if (!fracDigits) {
-                digits = VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRIu64 "%s", integer64,
+                VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRIu64 "%s", integer64,
                                      suffix.c_str());
             } else {
-                digits = VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRIu64 ".%0*" PRIu64 "%s",
+                VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRIu64 ".%0*" PRIu64 "%s",
                                      integer64, fracDigits, VL_SET_QW(frac), suffix.c_str());
             }
         }
@@ -850,23 +1101,22 @@ std::string _vl_vsformat_time(char* tmp, T ld, int timeunit, bool left, size_t w
         const double fracDiv = vl_time_multiplier(fracDigits);
         const double whole = scaled / fracDiv;
         if (!fracDigits) {
-            digits = VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%.0f%s", whole, suffix.c_str());
+            VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%.0f%s", whole, suffix.c_str());
         } else {
-            digits = VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%.*f%s", fracDigits, whole,
+            VL_SNPRINTF(tmp, VL_VALUE_STRING_MAX_WIDTH, "%.*f%s", fracDigits, whole,
                                  suffix.c_str());
         }
     }
 
-    const int needmore = static_cast<int>(width) - digits;
-    std::string padding;
-    if (needmore > 0) padding.append(needmore, ' ');  // Pad with spaces
-    return left ? (tmp + padding) : (padding + tmp);
+    const size_t start = output.size();
+    output += tmp;
+    _vl_vsformat_pad(output, start, width, left, ' ');  // Pad with spaces
 }
 
 // Do a va_arg returning a quad, assuming input argument is anything less than wide
 #define VL_VA_ARG_Q_(ap, bits) (((bits) <= VL_IDATASIZE) ? va_arg(ap, IData) : va_arg(ap, QData))
 
-void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL_MT_SAFE {
+void _vl_vsformat(std::string& output, const char* format, va_list ap) VL_MT_SAFE {
     // Format a Verilog $write style format into the output list
     // The format must be pre-processed (and lower cased) by Verilator
     // Arguments are in "width, arg-value (or WDataIn* if wide)" form
@@ -875,12 +1125,12 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
     // Note also assumes variables < 64 are not wide, this assumption is
     // sometimes not true in low-level routines written here in verilated.cpp
     static thread_local char t_tmp[VL_VALUE_STRING_MAX_WIDTH];
-    std::string::const_iterator pctit = format.end();  // Most recent %##.##g format
+    const char* pctit = nullptr;  // Most recent %##.##g format
     bool inPct = false;
     bool widthSet = false;
     bool left = false;
     size_t width = 0;
-    for (std::string::const_iterator pos = format.cbegin(); pos != format.cend(); ++pos) {
+    for (const char* pos = format; *pos; ++pos) {
         if (!inPct && pos[0] == '%') {
             pctit = pos;
             inPct = true;
@@ -888,8 +1138,8 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
             width = 0;
         } else if (!inPct) {  // Normal text
             // Fast-forward to next escape and add to output
-            std::string::const_iterator ep = pos;
-            while (ep != format.end() && ep[0] != '%') ++ep;
+            const char* ep = pos;
+            while (ep[0] && ep[0] != '%') ++ep;
             if (ep != pos) {
                 output.append(pos, ep);
                 pos = ep - 1;
@@ -938,9 +1188,9 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
             case '@': {  // Verilog/C++ string
                 va_arg(ap, int);  // # bits is ignored
                 const std::string* const cstrp = va_arg(ap, const std::string*);
-                std::string padding;
-                if (width > cstrp->size()) padding.append(width - cstrp->size(), ' ');
-                output += left ? (*cstrp + padding) : (padding + *cstrp);
+                const size_t start = output.size();
+                output += *cstrp;
+                _vl_vsformat_pad(output, start, width, left, ' ');
                 break;
             }
             case 'e':
@@ -953,10 +1203,11 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
                 if (fmt == '^') {  // Realtime
                     if (!widthSet) width = Verilated::threadContextp()->impp()->timeFormatWidth();
                     const int timeunit = va_arg(ap, int);
-                    output += _vl_vsformat_time(t_tmp, d, timeunit, left, width);
+                    _vl_vsformat_time(output, t_tmp, d, timeunit, left, width);
                 } else {
-                    const std::string fmts{pctit, pos + 1};
-                    VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, fmts.c_str(), d);
+                    static thread_local std::string t_fmts;  // static only for speed
+                    t_fmts.assign(pctit, pos + 1);
+                    VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, t_fmts.c_str(), d);
                     output += t_tmp;
                 }
                 break;
@@ -1001,87 +1252,45 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
                     break;
                 }
                 case 's': {
-                    std::string field;
+                    const size_t start = output.size();
                     for (; lsb >= 0; --lsb) {
                         lsb = (lsb / 8) * 8;  // Next digit
                         const IData charval = VL_BITRSHIFT_W(lwp, lsb) & 0xff;
-                        field += (charval == 0) ? ' ' : charval;
-                    }
-                    std::string padding;
-                    if (width > field.size()) padding.append(width - field.size(), ' ');
-                    output += left ? (field + padding) : (padding + field);
-                    break;
-                }
-                case 'd': {  // Signed decimal
-                    int digits = 0;
-                    std::string append;
-                    if (lbits <= VL_QUADSIZE) {
-                        digits
-                            = VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRId64,
-                                          static_cast<int64_t>(VL_EXTENDS_QQ(lbits, lbits, ld)));
-                        append = t_tmp;
-                    } else {
-                        if (VL_SIGN_E(lbits, lwp[VL_WORDS_I(lbits) - 1])) {
-                            VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> neg;
-                            VL_NEGATE_W(VL_WORDS_I(lbits), neg, lwp);
-                            append = "-"s + VL_DECIMAL_NW(lbits, neg);
-                        } else {
-                            append = VL_DECIMAL_NW(lbits, lwp);
-                        }
-                        digits = static_cast<int>(append.length());
-                    }
-                    const int needmore = static_cast<int>(width) - digits;
-                    if (needmore > 0) {
-                        std::string padding;
-                        if (left) {
-                            padding.append(needmore, ' ');  // Pre-pad spaces
-                            output += append + padding;
-                        } else {
-                            if (pctit != format.end() && pctit[0] && pctit[1] == '0') {  // %0
-                                padding.append(needmore, '0');  // Pre-pad zero
-                            } else {
-                                padding.append(needmore, ' ');  // Pre-pad spaces
-                            }
-                            output += padding + append;
-                        }
-                    } else {
-                        output += append;
+                        output += (charval == 0) ? ' ' : static_cast<char>(charval);
                     }
+                    _vl_vsformat_pad(output, start, width, left, ' ');
                     break;
                 }
+                case 'd':  // Signed decimal
                 case '#': {  // Unsigned decimal
-                    int digits = 0;
-                    std::string append;
+                    const size_t start = output.size();
                     if (lbits <= VL_QUADSIZE) {
-                        digits = VL_SNPRINTF(t_tmp, VL_VALUE_STRING_MAX_WIDTH, "%" PRIu64, ld);
-                        append = t_tmp;
-                    } else {
-                        append = VL_DECIMAL_NW(lbits, lwp);
-                        digits = static_cast<int>(append.length());
-                    }
-                    const int needmore = static_cast<int>(width) - digits;
-                    if (needmore > 0) {
-                        std::string padding;
-                        if (left) {
-                            padding.append(needmore, ' ');  // Pre-pad spaces
-                            output += append + padding;
+                        if (fmt == 'd') {
+                            const int64_t value
+                                = static_cast<int64_t>(VL_EXTENDS_QQ(lbits, lbits, ld));
+                            if (value < 0) output += '-';
+                            _vl_vsformat_udec(output, value < 0 ? 0 - static_cast<uint64_t>(value)
+                                                                : static_cast<uint64_t>(value));
                         } else {
-                            if (pctit != format.end() && pctit[0] && pctit[1] == '0') {  // %0
-                                padding.append(needmore, '0');  // Pre-pad zero
-                            } else {
-                                padding.append(needmore, ' ');  // Pre-pad spaces
-                            }
-                            output += padding + append;
+                            _vl_vsformat_udec(output, ld);
                         }
+                    } else if (fmt == 'd' && VL_SIGN_E(lbits, lwp[VL_WORDS_I(lbits) - 1])) {
+                        VlWide<VL_VALUE_STRING_MAX_WIDTH / 4 + 2> neg;
+                        VL_NEGATE_W(VL_WORDS_I(lbits), neg, lwp);
+                        output += '-';
+                        output += VL_DECIMAL_NW(lbits, neg);
                     } else {
-                        output += append;
+                        output += VL_DECIMAL_NW(lbits, lwp);
                     }
+                    // %0 pre-pads with zeros, otherwise pad with spaces
+                    const bool zeroPad = pctit && pctit[1] == '0';
+                    _vl_vsformat_pad(output, start, width, left, zeroPad ? '0' : ' ');
                     break;
                 }
                 case 't': {  // Time
                     if (!widthSet) width = Verilated::threadContextp()->impp()->timeFormatWidth();
                     const int timeunit = va_arg(ap, int);
-                    output += _vl_vsformat_time(t_tmp, ld, timeunit, left, width);
+                    _vl_vsformat_time(output, t_tmp, ld, timeunit, left, width);
                     break;
                 }
                 case 'b':  // FALLTHRU
@@ -1092,22 +1301,21 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
                         lsb = (lsb < 1) ? 0 : (lsb - 1);
                     }
 
-                    std::string append;
-                    int digits;
+                    const size_t start = output.size();
                     switch (fmt) {
                     case 'b': {
-                        digits = lsb + 1;
-                        for (; lsb >= 0; --lsb) append += (VL_BITRSHIFT_W(lwp, lsb) & 1) + '0';
+                        for (; lsb >= 0; --lsb) {
+                            output += static_cast<char>((VL_BITRSHIFT_W(lwp, lsb) & 1) + '0');
+                        }
                         break;
                     }
                     case 'o': {
-                        digits = (lsb + 1 + 2) / 3;
                         for (; lsb >= 0; --lsb) {
                             lsb = (lsb / 3) * 3;  // Next digit
                             // Octal numbers may span more than one wide word,
                             // so we need to grab each bit separately and check for overrun
                             // Octal is rare, so we'll do it a slow simple way
-                            append += static_cast<char>(
+                            output += static_cast<char>(
                                 '0' + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 0)) ? 1 : 0)
                                 + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 1)) ? 2 : 0)
                                 + ((VL_BITISSETLIMIT_W(lwp, lbits, lsb + 2)) ? 4 : 0));
@@ -1115,29 +1323,16 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
                         break;
                     }
                     default: {  // 'x'
-                        digits = (lsb + 1 + 3) / 4;
                         for (; lsb >= 0; --lsb) {
                             lsb = (lsb / 4) * 4;  // Next digit
                             const IData charval = VL_BITRSHIFT_W(lwp, lsb) & 0xf;
-                            append += "0123456789abcdef"[charval];
+                            output += "0123456789abcdef"[charval];
                         }
                         break;
                     }
                     }  // switch
-
-                    const int needmore = static_cast<int>(width) - digits;
-                    if (needmore > 0) {
-                        std::string padding;
-                        if (left) {
-                            padding.append(needmore, ' ');  // Pre-pad spaces
-                            output += append + padding;
-                        } else {
-                            padding.append(needmore, '0');  // Pre-pad zero
-                            output += padding + append;
-                        }
-                    } else {
-                        output += append;
-                    }
+                    // Left justified pads with spaces, otherwise pre-pad zeros
+                    _vl_vsformat_pad(output, start, width, left, '0');
                     break;
                 }  // b / o / x
                 case 'u':
@@ -1593,9 +1788,9 @@ void VL_FCLOSE_I(IData fdi) VL_MT_SAFE {
     Verilated::threadContextp()->impp()->fdClose(fdi);
 }
 
-void VL_SFORMAT_NX(int obits, CData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, CData& destr, const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
@@ -1604,9 +1799,9 @@ void VL_SFORMAT_NX(int obits, CData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, SData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, SData& destr, const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
@@ -1615,9 +1810,9 @@ void VL_SFORMAT_NX(int obits, SData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, IData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, IData& destr, const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
@@ -1626,9 +1821,9 @@ void VL_SFORMAT_NX(int obits, IData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, QData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, QData& destr, const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
@@ -1637,9 +1832,9 @@ void VL_SFORMAT_NX(int obits, QData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, void* destp, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, void* destp, const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
@@ -1648,20 +1843,22 @@ void VL_SFORMAT_NX(int obits, void* destp, const std::string& format, int argc,
     _vl_string_to_vint(obits, destp, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits_ignored, std::string& output, const std::string& format, int argc,
+void VL_SFORMAT_NX(int obits_ignored, std::string& output, const char* format, int argc,
                    ...) VL_MT_SAFE {
     (void)obits_ignored;  // So VL_SFORMAT_NNX function signatures all match
-    std::string temp_output;
+    // Format into a temporary, as output may also be an argument
+    static thread_local std::string t_output;  // static only for speed
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
-    _vl_vsformat(temp_output, format, ap);
+    _vl_vsformat(t_output, format, ap);
     va_end(ap);
-    output = temp_output;
+    output = t_output;
 }
 
-std::string VL_SFORMATF_N_NX(const std::string& format, int argc, ...) VL_MT_SAFE {
+std::string VL_SFORMATF_N_NX(const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
@@ -1670,21 +1867,29 @@ std::string VL_SFORMATF_N_NX(const std::string& format, int argc, ...) VL_MT_SAF
     return t_output;
 }
 
-void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_WRITEF_NX(const char* format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
     va_list ap;
     va_start(ap, argc);
     _vl_vsformat(t_output, format, ap);
     va_end(ap);
 
-    VL_PRINTF_MT("%s", t_output.c_str());
+    if (Verilated::mtaskId() == 0) {
+        // Not in an mtask, so print directly rather than copying into a message
+        VL_PRINTF("%s", t_output.c_str());
+    } else {
+        const std::string result = t_output;
+        VerilatedThreadMsgQueue::post(VerilatedMsg{[=]() {  //
+            VL_PRINTF("%s", result.c_str());
+        }});
+    }
 }
 
-void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_FWRITEF_NX(IData fpi, const char* format, int argc, ...) VL_MT_SAFE {
     // While threadsafe, each thread can only access different file handles
     static thread_local std::string t_output;  // static only for speed
-    t_output = "";
+    t_output.clear();
 
     va_list ap;
     va_start(ap, argc);
@@ -2156,9 +2361,17 @@ VlReadMem::~VlReadMem() {
         m_fp = nullptr;
     }
 }
+bool VlReadMem::fill() {
+    // Reading blocks avoids the per-character locking of fgetc, which dominates for large files
+    constexpr size_t BLOCK_SIZE = 64 * 1024;
+    if (m_buf.empty()) m_buf.resize(BLOCK_SIZE);
+    m_bufPos = 0;
+    m_bufEnd = std::fread(m_buf.data(), 1, m_buf.size(), m_fp);
+    return m_bufEnd != 0;
+}
 bool VlReadMem::get(QData& addrr, std::string& valuer) {
     if (VL_UNLIKELY(!m_fp)) return false;
-    valuer = "";
+    valuer.clear();
     // Prep for reading
     bool inData = false;
     bool ignoreToEol = false;
@@ -2169,7 +2382,7 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
     // We process a character at a time, as then we don't need to deal
     // with changing buffer sizes dynamically, etc.
     while (true) {
-        int c = std::fgetc(m_fp);
+        int c = nextc();
         if (VL_UNLIKELY(c == EOF)) break;
         const bool chIs4StateBin
             = c == '0' || c == '1' || c == 'x' || c == 'X' || c == 'z' || c == 'Z';
@@ -2181,7 +2394,7 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
         if (c == '_') continue;  // Ignore _ e.g. inside a number
         if (inData && !chIs4StateHex) {
             // printf("Got data @%lx = %s\n", m_addr, valuer.c_str());
-            ungetc(c, m_fp);
+            unnextc();
             addrr = m_addr;
             ++m_addr;
             return true;
@@ -2224,6 +2437,14 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
                     VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
                                 "$readmemb (binary) file contains hex characters");
                 }
+                // Take the rest of the value's digits that are already buffered at once
+                while (m_bufPos != m_bufEnd) {
+                    const char d = m_buf[m_bufPos];
+                    if (m_hex ? !std::isxdigit(d) : (d != '0' && d != '1')) break;
+                    valuer += d;
+                    c = d;
+                    ++m_bufPos;
+                }
             } else {
                 VL_FATAL_MT(m_filename.c_str(), m_linenum, "", "$readmem file syntax error");
             }
@@ -2240,38 +2461,39 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
     return inData;  // EOF
 }
 void VlReadMem::setData(void* valuep, const std::string& rhs) {
-    const QData shift = m_hex ? 4ULL : 1ULL;
-    bool innum = false;
-    // Shift value in
-    for (const auto& i : rhs) {
-        const char c = std::tolower(i);
-        const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
-                          : (c >= 'a')           ? (c - 'a' + 10)
-                                                 : (c - '0');
+    if (VL_UNLIKELY(rhs.empty())) return;
+    const int shift = m_hex ? 4 : 1;
+    const auto digitValue = [this](char ch) -> IData {
+        const char c = std::tolower(ch);
+        return (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
+               : (c >= 'a')           ? (c - 'a' + 10)
+                                      : (c - '0');
+    };
+    if (m_bits <= VL_QUADSIZE) {
+        // Shift value in, then store once
+        QData data = 0;
+        for (const char c : rhs) data = (data << shift) + digitValue(c);
+        data &= VL_MASK_Q(m_bits);
         if (m_bits <= 8) {
-            CData* const datap = reinterpret_cast<CData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
+            *reinterpret_cast<CData*>(valuep) = static_cast<CData>(data);
         } else if (m_bits <= 16) {
-            SData* const datap = reinterpret_cast<SData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
+            *reinterpret_cast<SData*>(valuep) = static_cast<SData>(data);
         } else if (m_bits <= VL_IDATASIZE) {
-            IData* const datap = reinterpret_cast<IData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
-        } else if (m_bits <= VL_QUADSIZE) {
-            QData* const datap = reinterpret_cast<QData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << static_cast<QData>(shift)) + static_cast<QData>(value))
-                     & VL_MASK_Q(m_bits);
+            *reinterpret_cast<IData*>(valuep) = static_cast<IData>(data);
         } else {
-            WDataOutP datap = reinterpret_cast<WDataOutP>(valuep);
-            if (!innum) VL_ZERO_W(m_bits, datap);
-            _vl_shiftl_inplace_w(m_bits, datap, static_cast<IData>(shift));
-            datap[0] |= value;
+            *reinterpret_cast<QData*>(valuep) = data;
+        }
+    } else {
+        // Digits never straddle words, so each is placed directly at its bit position
+        WDataOutP datap = reinterpret_cast<WDataOutP>(valuep);
+        VL_ZERO_W(m_bits, datap);
+        int lsb = static_cast<int>(rhs.size() - 1) * shift;
+        for (const char c : rhs) {
+            const IData value = digitValue(c);
+            if (lsb < m_bits) datap[VL_BITWORD_E(lsb)] |= value << VL_BITBIT_E(lsb);
+            lsb -= shift;
         }
-        innum = true;
+        datap[VL_WORDS_I(m_bits) - 1] &= VL_MASK_E(m_bits);
     }
 }
 
@@ -2383,9 +2605,9 @@ void VL_READMEM_N(bool hex,  // Hex format, else binary
 
     VlReadMem rmem{hex, bits, filename, start, end};
     if (VL_UNLIKELY(!rmem.isOpen())) return;
+    std::string value;  // Reused, to keep its allocation
     while (true) {
         QData addr = 0;
-        std::string value;
         if (rmem.get(addr /*ref*/, value /*ref*/)) {
             // printf("readmem.get [%" PRIu64 "]=%s\n", addr, value.c_str());
             if (VL_UNLIKELY(addr < static_cast<QData>(array_lsb)
@@ -2760,7 +2982,7 @@ const char* VerilatedContext::timeprecisionString() const VL_MT_SAFE {
 void VerilatedContext::threads(unsigned n) {
     if (n == 0) VL_FATAL_MT(__FILE__, __LINE__, "", "Simulation threads must be >= 1");
 
-    if (m_threadPool) {
+    if (m_threadPool || m_sharedThreadPool) {
         VL_FATAL_MT(
             __FILE__, __LINE__, "",
             "%Error: Cannot set simulation threads after the thread pool has been created.");
@@ -2776,6 +2998,47 @@ void VerilatedContext::threads(unsigned n) {
     }
 }
 
+void VerilatedContext::threadsStealing(bool flag) {
+    if (m_threadPool || m_sharedThreadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set thread work stealing after the thread pool has been "
+                    "created.");
+    }
+    m_threadsStealing = flag;
+}
+
+void VerilatedContext::threadsWaitAdaptive(bool flag) {
+    if (m_threadPool || m_sharedThreadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set thread wait policy after the thread pool has been "
+                    "created.");
+    }
+    m_threadsWaitAdaptive = flag;
+}
+
+void VerilatedContext::threadsShared(bool flag) {
+    if (m_threadPool || m_sharedThreadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set thread pool sharing after the thread pool has been "
+                    "created.");
+    }
+    m_threadsShared = flag;
+}
+
+void VerilatedContext::threadsCpus(const std::string& cpus) {
+    if (m_threadPool || m_sharedThreadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set thread CPU list after the thread pool has been "
+                    "created.");
+    }
+    std::vector<int> parsed;
+    if (!cpus.empty() && !VlThreadPool::parseCpuList(cpus, parsed)) {
+        const std::string msg = "Malformed thread CPU list: '" + cpus + "'";
+        VL_FATAL_MT("COMMAND_LINE", 0, "", msg.c_str());
+    }
+    m_threadsCpus = cpus;
+}
+
 void VerilatedContext::commandArgs(int argc, const char** argv) VL_MT_SAFE_EXCLUDES(m_argMutex) {
     // Not locking m_argMutex here, it is done in impp()->commandArgsAddGuts
     // m_argMutex here is the same as in impp()->commandArgsAddGuts;
@@ -2840,18 +3103,74 @@ void VerilatedContext::addModel(VerilatedModel* modelp) {
 
 VerilatedVirtualBase* VerilatedContext::threadPoolp() {
     if (m_threads == 1) return nullptr;
+    if (m_threadsShared) {
+        if (!m_sharedThreadPool) m_sharedThreadPool = VlThreadPool::shared(this, m_threads - 1);
+        return m_sharedThreadPool.get();
+    }
     if (!m_threadPool) m_threadPool.reset(new VlThreadPool{this, m_threads - 1});
     return m_threadPool.get();
 }
 
-void VerilatedContext::prepareClone() { delete m_threadPool.release(); }
+void VerilatedContext::prepareClone() {
+    delete m_threadPool.release();
+    m_sharedThreadPool.reset();
+}
 
 VerilatedVirtualBase* VerilatedContext::threadPoolpOnClone() {
+    if (m_threadsShared) return threadPoolp();
     if (VL_UNLIKELY(m_threadPool)) m_threadPool.release();
     m_threadPool = std::unique_ptr<VlThreadPool>(new VlThreadPool{this, m_threads - 1});
     return m_threadPool.get();
 }
 
+static void runForkCallbacks(bool prepare) VL_MT_SAFE;
+
+int VerilatedContext::forkSnapshot() VL_MT_UNSAFE {
+#ifdef _VL_HAVE_FORK
+    // Write out everything buffered, otherwise both processes would write it
+    Verilated::runFlushCallbacks();
+    runForkCallbacks(true);
+    std::fflush(nullptr);
+    // Stop our threads, so the process is single threaded when forked, and no
+    // mutex or condition variable is left in use by a thread the child lacks
+    VlThreadPool* const poolp = static_cast<VlThreadPool*>(
+        m_threadsShared ? m_sharedThreadPool.get() : m_threadPool.get());
+    if (poolp) poolp->stopWorkers();
+    // File descriptions are shared with the child, so it would move the parent's
+    // read offsets. Record the offsets, so the child can reopen them.
+    std::vector<std::pair<int, off_t>> readFds;
+    {
+        const VerilatedLockGuard lock{m_fdMutex};
+        for (FILE* const fp : m_fdps) {
+            if (!fp || fp == stdin || fp == stdout || fp == stderr) continue;
+            const int fd = ::fileno(fp);
+            const int flags = ::fcntl(fd, F_GETFL);
+            if (flags < 0 || (flags & O_ACCMODE) != O_RDONLY) continue;
+            const off_t offset = ::lseek(fd, 0, SEEK_CUR);
+            if (offset >= 0) readFds.emplace_back(fd, offset);
+        }
+    }
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        // Replace each read descriptor with a new description of the same file,
+        // at the same offset, so the FILE's buffered data remains consistent
+        for (const auto& it : readFds) {
+            const std::string path = "/proc/self/fd/" + std::to_string(it.first);
+            const int newFd = ::open(path.c_str(), O_RDONLY);
+            if (newFd < 0) continue;  // E.g. not Linux, or a pipe; stays shared
+            if (::lseek(newFd, it.second, SEEK_SET) == it.second) ::dup2(newFd, it.first);
+            ::close(newFd);
+        }
+    }
+    if (poolp) poolp->startWorkers(this);
+    runForkCallbacks(false);
+    return pid;
+#else
+    VL_FATAL_MT(__FILE__, __LINE__, "", "forkSnapshot is not supported on this platform");
+    return -1;
+#endif
+}
+
 VerilatedVirtualBase*
 VerilatedContext::enableExecutionProfiler(VerilatedVirtualBase* (*construct)(VerilatedContext&)) {
     if (!m_executionProfiler) m_executionProfiler.reset(construct(*this));
@@ -2932,7 +3251,9 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
     if (0 == std::strncmp(arg.c_str(), "+verilator+", std::strlen("+verilator+"))) {
         std::string str;
         uint64_t u64;
-        if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
+        if (arg == "+verilator+coverage+binary") {
+            coverageBinary(true);
+        } else if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
             coverageFilename(str);
         } else if (arg == "+verilator+debug") {
             Verilated::debug(4);
@@ -2942,6 +3263,8 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+error+limit+", u64, 0,
                                       std::numeric_limits<int>::max())) {
             errorLimit(static_cast<int>(u64));
+        } else if (arg == "+verilator+fwrite+unbuffered") {
+            fwriteBuffered(false);
         } else if (arg == "+verilator+help") {
             VerilatedImp::versionDump();
             VL_PRINTF_MT("For help, please see 'verilator --help'\n");
@@ -2964,6 +3287,21 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 1,
                                       std::numeric_limits<int>::max())) {
             randSeed(static_cast<int>(u64));
+        } else if (commandArgVlString(arg, "+verilator+threads+cpus+", str)) {
+            threadsCpus(str);
+        } else if (arg == "+verilator+threads+shared") {
+            threadsShared(true);
+        } else if (arg == "+verilator+threads+steal") {
+            threadsStealing(true);
+        } else if (commandArgVlString(arg, "+verilator+threads+wait+", str)) {
+            if (str == "adaptive") {
+                threadsWaitAdaptive(true);
+            } else if (str == "spin") {
+                threadsWaitAdaptive(false);
+            } else {
+                const std::string msg = "Unknown +verilator+threads+wait+ policy: " + str;
+                VL_FATAL_MT("COMMAND_LINE", 0, "", msg.c_str());
+            }
         } else if (arg == "+verilator+V") {
             VerilatedImp::versionDump();  // Someday more info too
             VL_FATAL_MT("COMMAND_LINE", 0, "",
@@ -3052,7 +3390,7 @@ void VerilatedContext::statsPrintSummary() VL_MT_UNSAFE {
     VL_PRINTF("- S i m u l a t i o n   R e p o r t: %s %s\n", Verilated::productName(),
               Verilated::productVersion());
     const std::string endwhy = gotError() ? "$stop" : gotFinish() ? "$finish" : "end";
-    const double simtimeInUnits = VL_TIME_Q() * vl_time_multiplier(timeunit())
+    const double simtimeInUnits = time() * vl_time_multiplier(timeunit())
                                   * vl_time_multiplier(timeprecision() - timeunit());
     const std::string simtime = vl_timescaled_double(simtimeInUnits);
     const double walltime = statWallTimeSinceStart();
@@ -3064,6 +3402,109 @@ void VerilatedContext::statsPrintSummary() VL_MT_UNSAFE {
     const double modelMB = VlOs::memUsageBytes() / 1024.0 / 1024.0;
     VL_PRINTF("- Verilator: cpu %0.3f s on %u threads; alloced %0.0f MB\n", cputime,
               threadsInModels(), modelMB);
+    const uint64_t coroFrames = statCoroutineFramesNew() + statCoroutineFramesReused();
+    if (coroFrames) {
+        VL_PRINTF("- Verilator: %" PRIu64 " coroutine frames; %" PRIu64 " reused from pool\n",
+                  coroFrames, statCoroutineFramesReused());
+    }
+}
+
+//======================================================================
+// VerilatedContext:: Methods - metrics
+
+uint64_t VerilatedContext::metricsNowNs() VL_MT_SAFE {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void VerilatedContext::metricsEvalRecord(uint64_t startNs) VL_MT_SAFE {
+    const uint64_t nowNs = metricsNowNs();
+    const uint64_t ns = nowNs - startNs;
+    int bits = 0;
+    while (bits < 63 && (ns >> bits)) ++bits;
+    m_ns.m_evalNsLog2[bits].fetch_add(1, std::memory_order_relaxed);
+    // The callback is only called from the thread that registered it, so no lock
+    if (m_ns.m_metricsCb && nowNs >= m_ns.m_metricsCbNextNs) {
+        m_ns.m_metricsCbNextNs = nowNs + m_ns.m_metricsCbIntervalNs;
+        m_ns.m_metricsCb(this, m_ns.m_metricsCbUserp);
+    }
+}
+
+void VerilatedContext::metricsCallback(metricsCb_t cb, void* userp,
+                                       double intervalSec) VL_MT_UNSAFE {
+    m_ns.m_metricsCb = cb;
+    m_ns.m_metricsCbUserp = userp;
+    m_ns.m_metricsCbIntervalNs = static_cast<uint64_t>(intervalSec * 1e9);
+    m_ns.m_metricsCbNextNs = metricsNowNs() + m_ns.m_metricsCbIntervalNs;
+}
+
+VerilatedMetrics VerilatedContext::metrics() const VL_MT_SAFE {
+    VerilatedMetrics result;
+    result.m_evals = m_ns.m_evals.load(std::memory_order_relaxed);
+    result.m_simTime = time();
+    result.m_wallTime = statWallTimeSinceStart();
+    result.m_cpuTime = statCpuTimeSinceStart();
+    if (result.m_wallTime > 0) result.m_evalsPerSec = result.m_evals / result.m_wallTime;
+    // Percentiles from the latency histogram, as the upper bound of the bucket
+    uint64_t counts[64];
+    uint64_t total = 0;
+    for (int bits = 0; bits < 64; ++bits) {
+        counts[bits] = m_ns.m_evalNsLog2[bits].load(std::memory_order_relaxed);
+        total += counts[bits];
+    }
+    double* const percentilesp[] = {&result.m_evalNsP50, &result.m_evalNsP90, &result.m_evalNsP99};
+    const double fractions[] = {0.50, 0.90, 0.99};
+    for (int p = 0; p < 3 && total; ++p) {
+        const double target = fractions[p] * total;
+        uint64_t sum = 0;
+        for (int bits = 0; bits < 64; ++bits) {
+            sum += counts[bits];
+            if (sum >= target) {
+                *percentilesp[p] = static_cast<double>(1ULL << bits);
+                break;
+            }
+        }
+    }
+    result.m_traceBytes = m_ns.m_traceBytes.load(std::memory_order_relaxed);
+    result.m_memBytes = VlOs::memUsageBytes();
+    const VerilatedVirtualBase* const poolp
+        = m_threadsShared ? m_sharedThreadPool.get() : m_threadPool.get();
+    if (const VlThreadPool* const threadPoolp = static_cast<const VlThreadPool*>(poolp)) {
+        result.m_threadPoolParks = threadPoolp->statParks();
+        result.m_threadPoolSpinHits = threadPoolp->statSpinHits();
+    }
+    return result;
+}
+
+std::string VerilatedContext::metricsPrometheus() const VL_MT_SAFE {
+    const VerilatedMetrics m = metrics();
+    std::ostringstream os;
+    const auto metric = [&](const char* name, const char* type, const char* help, double value,
+                            const char* labels = "") {
+        if (!*labels) {
+            os << "# HELP verilator_" << name << " " << help << "\n";
+            os << "# TYPE verilator_" << name << " " << type << "\n";
+        }
+        os << "verilator_" << name << labels << " " << std::setprecision(15) << value << "\n";
+    };
+    metric("evals_total", "counter", "Model evaluations", m.m_evals);
+    metric("sim_time", "gauge", "Simulation time in time precision units", m.m_simTime);
+    metric("wall_seconds", "counter", "Wall time since first model created", m.m_wallTime);
+    metric("cpu_seconds", "counter", "CPU time since first model created", m.m_cpuTime);
+    metric("evals_per_second", "gauge", "Average evaluations per wall second", m.m_evalsPerSec);
+    os << "# HELP verilator_eval_latency_ns Eval latency, power of two upper bound\n";
+    os << "# TYPE verilator_eval_latency_ns summary\n";
+    metric("eval_latency_ns", "", "", m.m_evalNsP50, "{quantile=\"0.5\"}");
+    metric("eval_latency_ns", "", "", m.m_evalNsP90, "{quantile=\"0.9\"}");
+    metric("eval_latency_ns", "", "", m.m_evalNsP99, "{quantile=\"0.99\"}");
+    metric("trace_bytes_total", "counter", "Bytes written to trace files", m.m_traceBytes);
+    metric("memory_bytes", "gauge", "Process memory in use", m.m_memBytes);
+    metric("thread_pool_parks_total", "counter", "Thread pool worker sleeps",
+           m.m_threadPoolParks);
+    metric("thread_pool_spin_hits_total", "counter", "Thread pool tasks received while spinning",
+           m.m_threadPoolSpinHits);
+    return os.str();
 }
 
 //======================================================================
@@ -3084,6 +3525,7 @@ void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    ++m_impdatap->m_nameGeneration;
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
@@ -3091,6 +3533,7 @@ void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    ++m_impdatap->m_nameGeneration;
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
@@ -3103,6 +3546,10 @@ const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT
 const VerilatedScopeNameMap* VerilatedContext::scopeNameMap() VL_MT_SAFE {
     return &(impp()->m_impdatap->m_nameMap);
 }
+uint64_t VerilatedContext::scopeNameGeneration() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
+    return m_impdatap->m_nameGeneration;
+}
 
 //======================================================================
 // VerilatedContext:: Methods - trace
@@ -3196,6 +3643,9 @@ static struct {
     VoidPCbList s_flushCbs VL_GUARDED_BY(s_flushMutex);
     VerilatedMutex s_exitMutex;
     VoidPCbList s_exitCbs VL_GUARDED_BY(s_exitMutex);
+    VerilatedMutex s_forkMutex;
+    VoidPCbList s_forkPrepareCbs VL_GUARDED_BY(s_forkMutex);
+    VoidPCbList s_forkResumeCbs VL_GUARDED_BY(s_forkMutex);
 } VlCbStatic;
 
 static void addCbFlush(Verilated::VoidPCb cb, void* datap)
@@ -3257,6 +3707,29 @@ void Verilated::runExitCallbacks() VL_MT_SAFE {
     --s_recursing;
 }
 
+void Verilated::addForkCb(VoidPCb prepareCb, VoidPCb resumeCb, void* datap) VL_MT_SAFE {
+    const VerilatedLockGuard lock{VlCbStatic.s_forkMutex};
+    // Just in case it's a duplicate
+    VlCbStatic.s_forkPrepareCbs.remove(std::make_pair(prepareCb, datap));
+    VlCbStatic.s_forkResumeCbs.remove(std::make_pair(resumeCb, datap));
+    VlCbStatic.s_forkPrepareCbs.emplace_back(prepareCb, datap);
+    VlCbStatic.s_forkResumeCbs.emplace_front(resumeCb, datap);
+}
+void Verilated::removeForkCb(VoidPCb prepareCb, VoidPCb resumeCb, void* datap) VL_MT_SAFE {
+    const VerilatedLockGuard lock{VlCbStatic.s_forkMutex};
+    VlCbStatic.s_forkPrepareCbs.remove(std::make_pair(prepareCb, datap));
+    VlCbStatic.s_forkResumeCbs.remove(std::make_pair(resumeCb, datap));
+}
+static void runForkCallbacks(bool prepare) VL_MT_SAFE {
+    // Copy, as the mutex must not be held over the fork
+    VoidPCbList cbs;
+    {
+        const VerilatedLockGuard lock{VlCbStatic.s_forkMutex};
+        cbs = prepare ? VlCbStatic.s_forkPrepareCbs : VlCbStatic.s_forkResumeCbs;
+    }
+    runCallbacks(cbs);
+}
+
 const char* Verilated::productName() VL_PURE { return VERILATOR_PRODUCT; }
 const char* Verilated::productVersion() VL_PURE { return VERILATOR_VERSION; }
 
@@ -3345,6 +3818,7 @@ int Verilated::exportFuncNum(const char* namep) VL_MT_SAFE {
 
 void Verilated::endOfThreadMTaskGuts(VerilatedEvalMsgQueue* evalMsgQp) VL_MT_SAFE {
     VL_DEBUG_IF(VL_DBG_MSGF("End of thread mtask\n"););
+    VerilatedContextImp::fdWriteFlushThread();
     VerilatedThreadMsgQueue::flush(evalMsgQp);
 }
 
@@ -3507,8 +3981,19 @@ void VerilatedScope::varInsert(int finalize, const char* namep, void* datap, boo
     m_varsp->emplace(namep, var);
 }
 
+void VerilatedScope::varDirty(int finalize, const char* namep, CData* dirtyp,
+                              CData* anyDirtyp) VL_MT_UNSAFE {
+    // Attach the --vpi-dirty flags of a variable inserted by varInsert
+    if (!finalize || !m_varsp) return;
+    const auto it = m_varsp->find(namep);
+    if (VL_UNLIKELY(it == m_varsp->end())) return;
+    it->second.m_dirtyp = dirtyp;
+    it->second.m_anyDirtyp = anyDirtyp;
+}
+
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
+    if (m_symsp) m_symsp->__Vm_varsInit();
     if (VL_LIKELY(m_varsp)) {
         const auto it = m_varsp->find(namep);
         if (VL_LIKELY(it != m_varsp->end())) return &(it->second);
@@ -3570,18 +4055,113 @@ void VerilatedAssertOneThread::fatal_different() VL_MT_SAFE {
 //===========================================================================
 // VlDeleter:: Methods
 
-void VlDeleter::deleteAll() VL_EXCLUDES(m_mutex) VL_EXCLUDES(m_deleteMutex) VL_MT_SAFE {
-    while (true) {
-        {
-            VerilatedLockGuard lock{m_mutex};
-            if (m_newGarbage.empty()) break;
-            m_deleteMutex.lock();
-            std::swap(m_newGarbage, m_deleteNow);
-            // m_mutex is unlocked here, so destructors can enqueue new objects
+void VlDeleter::deleteAll() VL_MT_SAFE {
+    // Objects' destructors may put new garbage, so repeat until nothing is left
+    while (VlDeletable* objp = m_newGarbagep.exchange(nullptr, std::memory_order_acquire)) {
+        while (objp) {
+            VlDeletable* const nextp = objp->m_nextGarbagep;
+            delete objp;
+            objp = nextp;
+        }
+    }
+}
+
+//===========================================================================
+// VlBlockPool:: Methods
+
+// The free lists of one thread. Object sizes are fixed, so in practice each list recycles the
+// objects of only one or a few types.
+class VlBlockPoolLists final {
+    // CONSTANTS
+    static constexpr size_t GRANULE = 16;  // Allocation sizes are rounded up to this
+    static constexpr size_t MAX_SIZE = 2048;  // Larger blocks use the heap directly
+    static constexpr size_t MAX_FREE = 4096;  // Most free blocks kept per size
+    static constexpr size_t NUM_LISTS = MAX_SIZE / GRANULE;
+
+    // TYPES
+    struct FreeBlock final {
+        FreeBlock* m_nextp;  // Next free block of the same size
+    };
+
+    // MEMBERS
+    std::array<FreeBlock*, NUM_LISTS> m_freeps{};  // Free list heads, by size
+    std::array<size_t, NUM_LISTS> m_counts{};  // Blocks in each free list
+
+    static thread_local bool t_destroyed;  // The thread's lists were destroyed, at thread exit
+
+    static size_t listIndex(size_t size) { return (size - 1) / GRANULE; }
+
+public:
+    // CONSTRUCTORS
+    VlBlockPoolLists() = default;
+    ~VlBlockPoolLists() {
+        t_destroyed = true;
+        for (FreeBlock* blockp : m_freeps) {
+            while (blockp) {
+                FreeBlock* const nextp = blockp->m_nextp;
+                ::operator delete(blockp);
+                blockp = nextp;
+            }
+        }
+    }
+    VL_UNCOPYABLE(VlBlockPoolLists);
+
+    // METHODS
+    static VlBlockPoolLists* threadListsp() VL_MT_SAFE;
+    // Any block may later be recycled by another thread's lists, so all are full size
+    static void* heapAllocate(size_t size) VL_MT_SAFE {
+        return ::operator new(size > MAX_SIZE ? size : (listIndex(size) + 1) * GRANULE);
+    }
+    void* allocate(size_t size, bool& reused) {
+        reused = false;
+        if (VL_UNLIKELY(size > MAX_SIZE)) return ::operator new(size);
+        const size_t index = listIndex(size);
+        if (FreeBlock* const blockp = m_freeps[index]) {
+            m_freeps[index] = blockp->m_nextp;
+            --m_counts[index];
+            reused = true;
+            return blockp;
         }
-        for (VlDeletable* const objp : m_deleteNow) delete objp;
-        m_deleteNow.clear();
-        m_deleteMutex.unlock();
+        return heapAllocate(size);
+    }
+    void deallocate(void* blockp, size_t size) {
+        if (VL_UNLIKELY(size > MAX_SIZE)) {
+            ::operator delete(blockp);
+            return;
+        }
+        const size_t index = listIndex(size);
+        if (VL_UNLIKELY(m_counts[index] >= MAX_FREE)) {
+            ::operator delete(blockp);
+            return;
+        }
+        FreeBlock* const freep = static_cast<FreeBlock*>(blockp);
+        freep->m_nextp = m_freeps[index];
+        m_freeps[index] = freep;
+        ++m_counts[index];
+    }
+};
+
+thread_local bool VlBlockPoolLists::t_destroyed = false;
+
+VlBlockPoolLists* VlBlockPoolLists::threadListsp() VL_MT_SAFE {
+    static thread_local VlBlockPoolLists t_lists;
+    // Blocks freed during thread exit, after the lists, go to the heap
+    return VL_UNLIKELY(t_destroyed) ? nullptr : &t_lists;
+}
+
+void* VlBlockPool::allocate(size_t size, bool& reused) VL_MT_SAFE {
+    VlBlockPoolLists* const listsp = VlBlockPoolLists::threadListsp();
+    if (listsp) return listsp->allocate(size, reused);
+    reused = false;
+    return VlBlockPoolLists::heapAllocate(size);
+}
+
+void VlBlockPool::deallocate(void* blockp, size_t size) VL_MT_SAFE {
+    VlBlockPoolLists* const listsp = VlBlockPoolLists::threadListsp();
+    if (listsp) {
+        listsp->deallocate(blockp, size);
+    } else {
+        ::operator delete(blockp);
     }
 }
 
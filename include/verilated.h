@@ -109,6 +109,7 @@ class VerilatedVarNameMap;
 class VerilatedVcd;
 class VerilatedVcdC;
 class VerilatedVcdSc;
+class VlRegionProfiler;
 
 //=========================================================================
 // Basic types
@@ -353,6 +354,26 @@ public:
     virtual ~VerilatedVirtualBase() = default;
 };
 
+//===========================================================================
+/// Run-time metrics snapshot, from VerilatedContext::metrics()
+
+struct VerilatedMetrics final {
+    uint64_t m_evals = 0;  ///< Model evaluations, all models in the context
+    uint64_t m_simTime = 0;  ///< Simulation time, in units of timeprecision()
+    double m_wallTime = 0;  ///< Wall time since the first model was created (sec)
+    double m_cpuTime = 0;  ///< CPU time since the first model was created (sec)
+    double m_evalsPerSec = 0;  ///< Average evaluations per wall second
+    /// Eval latency percentiles, upper bounds to a power of two (ns), zero
+    /// unless metricsEnable() was set during the evaluations
+    double m_evalNsP50 = 0;
+    double m_evalNsP90 = 0;
+    double m_evalNsP99 = 0;
+    uint64_t m_traceBytes = 0;  ///< Bytes written to VCD trace files
+    uint64_t m_memBytes = 0;  ///< Process memory in use (bytes)
+    uint64_t m_threadPoolParks = 0;  ///< Times thread pool workers went to sleep
+    uint64_t m_threadPoolSpinHits = 0;  ///< Tasks thread pool workers got while spinning
+};
+
 //===========================================================================
 /// Verilator simulation context
 ///
@@ -367,6 +388,11 @@ public:
 class VerilatedContext VL_NOT_FINAL {
     friend class VerilatedContextImp;
 
+public:
+    // TYPES
+    /// Callback from metricsCallback()
+    using metricsCb_t = void (*)(VerilatedContext* contextp, void* userp);
+
 private:
     // MEMBERS
     // Numer of assertion directive type members. Then each of them will represented as 1-bit in a
@@ -429,6 +455,8 @@ protected:
         // Fast path
         uint64_t m_profExecStart = 1;  // +prof+exec+start time
         uint32_t m_profExecWindow = 2;  // +prof+exec+window size
+        bool m_coverageBinary = false;  // +coverage+binary
+        bool m_fwriteBuffered = true;  // Buffer $fwrite inside mtasks, not +fwrite+unbuffered
         // Slow path
         std::string m_coverageFilename;  // +coverage+file filename
         std::string m_profExecFilename;  // +prof+exec+file filename
@@ -437,6 +465,16 @@ protected:
         VlOs::DeltaCpuTime m_cpuTimeStart{false};  // CPU time, starts when create first model
         VlOs::DeltaWallTime m_wallTimeStart{false};  // Wall time, starts when create first model
         std::vector<traceBaseModelCb_t> m_traceBaseModelCbs;  // Callbacks to traceRegisterModel
+        std::atomic<uint64_t> m_coroFramesNew{0};  // Coroutine frames allocated with new
+        std::atomic<uint64_t> m_coroFramesReused{0};  // Coroutine frames from the frame pool
+        std::atomic<uint64_t> m_evals{0};  // Model evaluations, see metrics()
+        std::atomic<uint64_t> m_traceBytes{0};  // Trace file bytes written
+        bool m_metrics = false;  // metricsEnable() set, time each eval
+        std::atomic<uint64_t> m_evalNsLog2[64]{};  // Evals by bit length of latency in ns
+        metricsCb_t m_metricsCb = nullptr;  // metricsCallback() function
+        void* m_metricsCbUserp = nullptr;  // metricsCallback() user data
+        uint64_t m_metricsCbIntervalNs = 0;  // metricsCallback() interval
+        uint64_t m_metricsCbNextNs = 0;  // Time of next metricsCallback() call
     } m_ns;
 
     mutable VerilatedMutex m_argMutex;  // Protect m_argVec, m_argVecLoaded
@@ -454,10 +492,22 @@ protected:
     unsigned m_threads = std::thread::hardware_concurrency();
     // Number of threads in added models
     unsigned m_threadsInModels = 0;
+    // Thread pool workers steal tasks from each other
+    bool m_threadsStealing = false;
+    // Thread pool workers tune spinning from observed idle time
+    bool m_threadsWaitAdaptive = false;
+    // CPUs to pin thread pool workers to, empty for automatic assignment
+    std::string m_threadsCpus;
+    // Use the process-wide thread pool shared with other contexts
+    bool m_threadsShared = false;
     // The thread pool shared by all models added to this context
     std::unique_ptr<VerilatedVirtualBase> m_threadPool;
+    // The process-wide thread pool, if m_threadsShared
+    std::shared_ptr<VerilatedVirtualBase> m_sharedThreadPool;
     // The execution profiler shared by all models added to this context
     std::unique_ptr<VerilatedVirtualBase> m_executionProfiler;
+    // The eval region profiler of the last model built with --prof-regions, owned by the model
+    VlRegionProfiler* m_regionProfilerp = nullptr;
     // Coverage access
     std::unique_ptr<VerilatedVirtualBase> m_coveragep;  // Pointer for coveragep()
 
@@ -538,6 +588,11 @@ public:
     bool fatalOnVpiError() const VL_MT_SAFE { return m_s.m_fatalOnVpiError; }
     /// Set to throw fatal error on VPI errors
     void fatalOnVpiError(bool flag) VL_MT_SAFE;
+    /// Return if $fwrite output inside thread pool tasks is buffered
+    bool fwriteBuffered() const VL_MT_SAFE { return m_ns.m_fwriteBuffered; }
+    /// Set if $fwrite output inside thread pool tasks is buffered per thread, and
+    /// written at the end of each task or before any other operation on a file
+    void fwriteBuffered(bool flag) VL_MT_SAFE { m_ns.m_fwriteBuffered = flag; }
     /// Return if got a $stop or non-fatal error
     bool gotError() const VL_MT_SAFE { return m_s.m_gotError; }
     /// Set if got a $stop or non-fatal error
@@ -566,9 +621,52 @@ public:
     double statCpuTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mutex);
     /// Return statistic: Wall time delta from model created until now
     double statWallTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mutex);
+    /// Return statistic: --timing coroutine frames allocated with operator new
+    uint64_t statCoroutineFramesNew() const VL_MT_SAFE { return m_ns.m_coroFramesNew; }
+    /// Return statistic: --timing coroutine frames recycled from the frame pool
+    uint64_t statCoroutineFramesReused() const VL_MT_SAFE { return m_ns.m_coroFramesReused; }
+    /// Internal: Record creation of a coroutine frame, for the statistics
+    void statCoroutineFrame(bool reused) VL_MT_SAFE {
+        (reused ? m_ns.m_coroFramesReused : m_ns.m_coroFramesNew)
+            .fetch_add(1, std::memory_order_relaxed);
+    }
     /// Print statistics summary (if not quiet)
     void statsPrintSummary() VL_MT_UNSAFE;
 
+    // METRICS
+    // Cheap run-time counters, for monitoring long runs while they execute
+    /// Enable timing each eval for the latency percentiles (small per-eval cost)
+    void metricsEnable(bool flag) VL_MT_SAFE { m_ns.m_metrics = flag; }
+    /// Return if metricsEnable() is set
+    bool metricsEnabled() const VL_MT_SAFE { return m_ns.m_metrics; }
+    /// Return snapshot of the run-time metrics
+    VerilatedMetrics metrics() const VL_MT_SAFE;
+    /// Return metrics() in Prometheus text exposition format
+    std::string metricsPrometheus() const VL_MT_SAFE;
+    /// Call cb from the end of an eval, at most every intervalSec of wall time,
+    /// while metricsEnable() is set.  nullptr cb removes the callback.
+    void metricsCallback(metricsCb_t cb, void* userp, double intervalSec) VL_MT_UNSAFE;
+    /// Internal: Called by model eval_step() before evaluating
+    uint64_t metricsEvalBegin() const VL_MT_SAFE {
+        return VL_UNLIKELY(m_ns.m_metrics) ? metricsNowNs() : 0;
+    }
+    /// Internal: Called by model eval_step() after evaluating
+    void metricsEvalEnd(uint64_t startNs) VL_MT_SAFE {
+        m_ns.m_evals.store(m_ns.m_evals.load(std::memory_order_relaxed) + 1,
+                           std::memory_order_relaxed);
+        if (VL_UNLIKELY(startNs)) metricsEvalRecord(startNs);
+    }
+    /// Internal: Record bytes written to a trace file
+    void metricsTraceBytes(uint64_t bytes) VL_MT_SAFE {
+        m_ns.m_traceBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    static uint64_t metricsNowNs() VL_MT_SAFE;
+    void metricsEvalRecord(uint64_t startNs) VL_MT_SAFE;
+
+public:
+
     // Time handling
     /// Returns current simulation time in units of timeprecision().
     ///
@@ -617,6 +715,38 @@ public:
     /// Set number of threads used for simulation (including the main thread)
     /// Can only be called before the thread pool is created (before first model is added).
     void threads(unsigned n);
+    /// Get if thread pool workers may steal tasks from busy workers
+    bool threadsStealing() const { return m_threadsStealing; }
+    /// Set if thread pool workers may steal tasks from busy workers.
+    /// Can only be called before the thread pool is created (before first model is added).
+    void threadsStealing(bool flag);
+    /// Get if idle thread pool workers use the adaptive wait policy
+    bool threadsWaitAdaptive() const { return m_threadsWaitAdaptive; }
+    /// Set if idle thread pool workers use the adaptive wait policy, tuning how long
+    /// to spin from observed idle times, then parking on a futex, rather than spinning
+    /// for a fixed time. Can only be called before the thread pool is created.
+    void threadsWaitAdaptive(bool flag);
+    /// Get list of CPUs thread pool workers are pinned to, empty if automatic
+    std::string threadsCpus() const { return m_threadsCpus; }
+    /// Set list of CPUs to pin thread pool workers to, e.g. "0-3,8", one CPU per
+    /// worker in order. Can only be called before the thread pool is created.
+    void threadsCpus(const std::string& cpus);
+    /// Get if this context uses the process-wide thread pool shared with other contexts
+    bool threadsShared() const { return m_threadsShared; }
+    /// Set if this context uses the process-wide thread pool shared with other contexts,
+    /// rather than creating its own. Exec graphs of the sharing contexts are
+    /// admitted to the pool's workers first-come first-served. Can only be called
+    /// before the thread pool is created.
+    void threadsShared(bool flag);
+
+    /// Fork the process, so the child continues from the current model state,
+    /// sharing memory pages copy-on-write. Must be called between evaluations,
+    /// with no other context evaluating. Thread pool workers and trace offload
+    /// threads are stopped before, and restarted after in both processes; output
+    /// files are flushed first, and files opened for reading get independent
+    /// offsets in the child. Returns as fork() does: the child's pid in the
+    /// parent, 0 in the child, or -1 on error.
+    int forkSnapshot() VL_MT_UNSAFE;
 
     /// Trace signals in models within the context; called by application code
     void trace(VerilatedTraceBaseC* tfp, int levels, int options = 0);
@@ -650,10 +780,15 @@ public:
     VerilatedVirtualBase* threadPoolpOnClone();
     VerilatedVirtualBase*
     enableExecutionProfiler(VerilatedVirtualBase* (*construct)(VerilatedContext&));
+    // Eval region timing of the last model built with --prof-regions, or nullptr
+    VlRegionProfiler* regionProfilerp() const VL_MT_SAFE { return m_regionProfilerp; }
+    void regionProfilerp(VlRegionProfiler* profilerp) VL_MT_SAFE { m_regionProfilerp = profilerp; }
 
     // Internal: coverage
     std::string coverageFilename() const VL_MT_SAFE;
     void coverageFilename(const std::string& flag) VL_MT_SAFE;
+    bool coverageBinary() const VL_MT_SAFE { return m_ns.m_coverageBinary; }
+    void coverageBinary(bool flag) VL_MT_SAFE { m_ns.m_coverageBinary = flag; }
 
     // Internal: $dumpfile
     std::string dumpfile() const VL_MT_SAFE_EXCLUDES(m_timeDumpMutex);
@@ -677,6 +812,8 @@ public:
     // Internal: Find scope
     const VerilatedScope* scopeFind(const char* namep) const VL_MT_SAFE;
     const VerilatedScopeNameMap* scopeNameMap() VL_MT_SAFE;
+    // Internal: Changes whenever a scope is added or removed, for caches of scopeNameMap
+    uint64_t scopeNameGeneration() const VL_MT_SAFE;
 
     // Internal: Serialization setup
     static constexpr size_t serialized1Size() VL_PURE { return sizeof(m_s); }
@@ -700,8 +837,14 @@ public:  // But for internal use only
     // Keep first so is at zero offset for fastest code
     VerilatedContext* const _vm_contextp__;  // Context for current model
     VerilatedEvalMsgQueue* __Vm_evalMsgQp;
+    // Registers public variables, deferred until the first variable lookup
+    void (*__Vm_varsInitp)(VerilatedSyms* symsp) = nullptr;
+    std::once_flag __Vm_varsOnce;
     explicit VerilatedSyms(VerilatedContext* contextp);  // Pass null for default context
     ~VerilatedSyms();
+    void __Vm_varsInit() VL_MT_SAFE {
+        if (VL_UNLIKELY(__Vm_varsInitp)) std::call_once(__Vm_varsOnce, __Vm_varsInitp, this);
+    }
     VL_UNCOPYABLE(VerilatedSyms);
 };
 
@@ -738,6 +881,8 @@ public:  // But internals only - called from VerilatedModule's
     void exportInsert(int finalize, const char* namep, void* cb) VL_MT_UNSAFE;
     void varInsert(int finalize, const char* namep, void* datap, bool isParam,
                    VerilatedVarType vltype, int vlflags, int udims, int pdims, ...) VL_MT_UNSAFE;
+    void varDirty(int finalize, const char* namep, CData* dirtyp,
+                  CData* anyDirtyp) VL_MT_UNSAFE;
     // ACCESSORS
     const char* name() const VL_MT_SAFE_POSTINIT { return m_namep; }
     const char* identifier() const VL_MT_SAFE_POSTINIT { return m_identifierp; }
@@ -745,7 +890,10 @@ public:  // But internals only - called from VerilatedModule's
     int8_t timeunit() const VL_MT_SAFE_POSTINIT { return m_timeunit; }
     VerilatedSyms* symsp() const VL_MT_SAFE_POSTINIT { return m_symsp; }
     VerilatedVar* varFind(const char* namep) const VL_MT_SAFE_POSTINIT;
-    VerilatedVarNameMap* varsp() const VL_MT_SAFE_POSTINIT { return m_varsp; }
+    VerilatedVarNameMap* varsp() const VL_MT_SAFE_POSTINIT {
+        if (m_symsp) m_symsp->__Vm_varsInit();
+        return m_varsp;
+    }
     void scopeDump() const;
     void* exportFindError(int funcnum) const VL_MT_SAFE;
     static void* exportFindNullError(int funcnum) VL_MT_SAFE;
@@ -792,6 +940,7 @@ class Verilated final {
         // Fast path
         VerilatedContext* t_contextp = nullptr;  // Thread's context
         uint32_t t_mtaskId = 0;  // mtask# executing on this thread
+        uint32_t t_workerId = 0;  // Thread pool worker index + 1, or 0 if not a worker
         // Messages maybe pending on thread, needs end-of-eval calls
         uint32_t t_endOfEvalReqd = 0;
         const VerilatedScope* t_dpiScopep = nullptr;  // DPI context scope
@@ -945,6 +1094,11 @@ public:
     static void removeExitCb(VoidPCb cb, void* datap) VL_MT_SAFE;
     /// Run exit callbacks registered with addExitCb
     static void runExitCallbacks() VL_MT_SAFE;
+    /// Add callbacks to run before VerilatedContext::forkSnapshot forks,
+    /// and after the fork in both the parent and the child
+    static void addForkCb(VoidPCb prepareCb, VoidPCb resumeCb, void* datap) VL_MT_SAFE;
+    /// Remove callbacks added with addForkCb
+    static void removeForkCb(VoidPCb prepareCb, VoidPCb resumeCb, void* datap) VL_MT_SAFE;
 
     /// Return product name for (at least) VPI
     static const char* productName() VL_PURE;
@@ -1008,6 +1162,9 @@ public:
     // Per thread, so no need to be in VerilatedContext
     static uint32_t mtaskId() VL_MT_SAFE { return t_s.t_mtaskId; }
     static void mtaskId(uint32_t id) VL_MT_SAFE { t_s.t_mtaskId = id; }
+    // Internal: Thread pool worker index + 1 of this thread, or 0 if not a worker
+    static uint32_t threadWorkerId() VL_MT_SAFE { return t_s.t_workerId; }
+    static void threadWorkerId(uint32_t id) VL_MT_SAFE { t_s.t_workerId = id; }
     static void endOfEvalReqdInc() VL_MT_SAFE { ++t_s.t_endOfEvalReqd; }
     static void endOfEvalReqdDec() VL_MT_SAFE { --t_s.t_endOfEvalReqd; }
 
@@ -28,10 +28,14 @@
 #include "verilated.h"
 #include "verilated_cov_key.h"
 
+#include <algorithm>
+#include <cstring>
 #include <deque>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=============================================================================
 // VerilatedCovConst
@@ -90,6 +94,48 @@ public:
     ~VerilatedCoverItemSpec() override = default;
 };
 
+//=============================================================================
+// VerilatedCoverItemBit
+// Coverage item recorded as a single bit of a word
+
+class VerilatedCoverItemBit final : public VerilatedCovImpItem {
+private:
+    // MEMBERS
+    const VerilatedCovBit m_bit;  // Flag
+
+public:
+    // METHODS
+    uint64_t count() const override { return (*m_bit.m_wordp & m_bit.m_mask) ? 1 : 0; }
+    void zero() const override { *m_bit.m_wordp &= ~m_bit.m_mask; }
+    // CONSTRUCTORS
+    explicit VerilatedCoverItemBit(const VerilatedCovBit& bit)
+        : m_bit{bit} {
+        zero();
+    }
+    ~VerilatedCoverItemBit() override = default;
+};
+
+//=============================================================================
+// VerilatedCoverItemShards
+// Coverage item whose count is summed across the shards of a VerilatedCovShards
+
+class VerilatedCoverItemShards final : public VerilatedCovImpItem {
+private:
+    // MEMBERS
+    const VerilatedCovShards::Bin m_bin;  // Counters
+
+public:
+    // METHODS
+    uint64_t count() const override { return m_bin.m_shardsp->count(m_bin.m_bin); }
+    void zero() const override { m_bin.m_shardsp->zero(m_bin.m_bin); }
+    // CONSTRUCTORS
+    explicit VerilatedCoverItemShards(const VerilatedCovShards::Bin& bin)
+        : m_bin{bin} {
+        zero();
+    }
+    ~VerilatedCoverItemShards() override = default;
+};
+
 //=============================================================================
 // VerilatedCovImp
 //
@@ -286,6 +332,16 @@ public:
         const VerilatedLockGuard lock{m_mutex};
         for (const auto& itemp : m_items) itemp->zero();
     }
+    void hitMap(uint8_t* mapp, size_t size) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (!size) return;
+        Verilated::quiesce();
+        const VerilatedLockGuard lock{m_mutex};
+        size_t index = 0;
+        for (const auto& itemp : m_items) {
+            uint8_t& hitr = mapp[index++ % size];
+            hitr = static_cast<uint8_t>(std::min<uint64_t>(255, hitr + itemp->count()));
+        }
+    }
 
     // We assume there's always call to i/f/p in that order
     void inserti(VerilatedCovImpItem* itemp) VL_MT_SAFE_EXCLUDES(m_mutex) {
@@ -361,6 +417,10 @@ public:
         Verilated::quiesce();
         const VerilatedLockGuard lock{m_mutex};
         selftest();
+        if (m_contextp->coverageBinary()) {
+            writeBinary(filename);
+            return;
+        }
 
         std::ofstream os{filename};
         if (os.fail()) {
@@ -370,6 +430,14 @@ public:
         }
         os << "# SystemC::Coverage-3\n";
 
+        // Formatted key/value pairs, as most pairs are shared by many items
+        struct Fragment final {
+            std::string m_text;  // Formatted pair, if not hier
+            const std::string* m_hierp = nullptr;  // Value, if the hier key
+            bool m_perInstance = false;  // Is per_instance key with non-zero value
+        };
+        std::unordered_map<uint64_t, Fragment> fragments;
+
         // Build list of events; totalize if collapsing hierarchy
         std::map<const std::string, std::pair<std::string, uint64_t>> eventCounts;
         for (const auto& itemp : m_items) {
@@ -380,21 +448,31 @@ public:
 
             for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
                 if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
-                    const std::string key
-                        = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
-                    const std::string val = m_indexValues[itemp->m_vals[i]];
-                    if (key == VL_CIK_PER_INSTANCE) {
-                        if (val != "0") per_instance = true;
+                    const uint64_t fragKey = (static_cast<uint64_t>(itemp->m_keys[i]) << 32)
+                                             | static_cast<uint32_t>(itemp->m_vals[i]);
+                    const auto pair = fragments.emplace(fragKey, Fragment{});
+                    Fragment& frag = pair.first->second;
+                    if (pair.second) {
+                        const std::string key
+                            = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
+                        const std::string& val = m_indexValues[itemp->m_vals[i]];
+                        frag.m_perInstance = key == VL_CIK_PER_INSTANCE && val != "0";
+                        if (key == VL_CIK_HIER) {
+                            frag.m_hierp = &val;
+                        } else {
+                            // Print it
+                            if (key == "page") {
+                                const std::string type = val.substr(2, val.find('/') - 2);
+                                frag.m_text += keyValueFormatter(VL_CIK_TYPE, type);
+                            }
+                            frag.m_text += keyValueFormatter(key, val);
+                        }
                     }
-                    if (key == VL_CIK_HIER) {
-                        hier = val;
+                    if (frag.m_perInstance) per_instance = true;
+                    if (frag.m_hierp) {
+                        hier = *frag.m_hierp;
                     } else {
-                        // Print it
-                        if (key == "page") {
-                            const std::string type = val.substr(2, val.find('/') - 2);
-                            name += keyValueFormatter(VL_CIK_TYPE, type);
-                        }
-                        name += keyValueFormatter(key, val);
+                        name += frag.m_text;
                     }
                 }
             }
@@ -428,6 +506,176 @@ public:
             os << '\n';
         }
     }
+
+private:
+    // Binary format, see VerilatedCovBinary. Builds the same points as the text
+    // format, but names are lists of interned fragments, not strings.
+    class BinaryWriter final {
+        struct Fragment final {
+            uint32_t m_id = 0;  // String index, if not hier
+            bool m_hier = false;  // Is the hier key
+            bool m_perInstance = false;  // Is per_instance key with non-zero value
+        };
+        struct Point final {
+            std::string m_hier;  // Combined hierarchy, if not per_instance
+            uint64_t m_count = 0;
+        };
+        struct RefsHash final {
+            size_t operator()(const std::vector<uint32_t>& refs) const {
+                uint64_t hash = 0xcbf29ce484222325ULL;
+                for (const uint32_t ref : refs) hash = (hash ^ ref) * 0x100000001b3ULL;
+                return static_cast<size_t>(hash);
+            }
+        };
+        std::vector<std::string> m_strings;  // Interned fragments
+        std::unordered_map<std::string, uint32_t> m_stringIds;
+        std::unordered_map<uint64_t, Fragment> m_fragments;  // By key and value index
+        std::unordered_map<std::vector<uint32_t>, size_t, RefsHash> m_pointIds;
+        std::vector<const std::vector<uint32_t>*> m_pointRefs;  // Key of each point
+        std::vector<Point> m_points;
+
+    public:
+        uint32_t stringId(const std::string& str) {
+            const auto pair = m_stringIds.emplace(str, static_cast<uint32_t>(m_strings.size()));
+            if (pair.second) m_strings.push_back(str);
+            return pair.first->second;
+        }
+        const Fragment& fragment(int keyIndex, int valIndex, IndexValueMap& indexValues) {
+            const uint64_t mapKey
+                = (static_cast<uint64_t>(keyIndex) << 32) | static_cast<uint32_t>(valIndex);
+            const auto it = m_fragments.find(mapKey);
+            if (it != m_fragments.end()) return it->second;
+            // Same as in text write()
+            const std::string key = VerilatedCovKey::shortKey(indexValues[keyIndex]);
+            const std::string& val = indexValues[valIndex];
+            Fragment& frag = m_fragments[mapKey];
+            if (key == VL_CIK_HIER) {
+                frag.m_hier = true;
+                return frag;
+            }
+            frag.m_perInstance = key == VL_CIK_PER_INSTANCE && val != "0";
+            std::string name;
+            if (key == "page") {
+                const std::string type = val.substr(2, val.find('/') - 2);
+                name += keyValueFormatter(VL_CIK_TYPE, type);
+            }
+            name += keyValueFormatter(key, val);
+            frag.m_id = stringId(name);
+            return frag;
+        }
+        void addPoint(std::vector<uint32_t>& refs, const std::string& hier, uint64_t count) {
+            const auto pair = m_pointIds.emplace(std::move(refs), m_points.size());
+            if (pair.second) {
+                m_pointRefs.push_back(&pair.first->first);
+                m_points.push_back(Point{hier, count});
+            } else {
+                Point& point = m_points[pair.first->second];
+                point.m_count += count;
+                point.m_hier = combineHier(point.m_hier, hier);
+            }
+        }
+        bool write(const std::string& filename) {
+            // Append combined hierarchies, as text write() does
+            std::vector<uint32_t> hierIds(m_points.size(), 0);
+            for (size_t i = 0; i < m_points.size(); ++i) {
+                if (m_points[i].m_hier.empty()) continue;
+                hierIds[i] = stringId(keyValueFormatter(VL_CIK_HIER, m_points[i].m_hier)) + 1;
+            }
+            uint64_t maxCount = 0;
+            uint64_t numRefs = 0;
+            for (size_t i = 0; i < m_points.size(); ++i) {
+                maxCount = std::max(maxCount, m_points[i].m_count);
+                numRefs += m_pointRefs[i]->size() + (hierIds[i] ? 1 : 0);
+            }
+            const uint32_t countBytes = maxCount >> 32 ? 8 : 4;
+            uint64_t stringBytes = 0;
+            std::vector<uint64_t> stringEnds;
+            stringEnds.reserve(m_strings.size());
+            for (const std::string& str : m_strings) {
+                stringBytes += str.size();
+                stringEnds.push_back(stringBytes);
+            }
+
+            std::ofstream os{filename, std::ios::binary};
+            if (os.fail()) return false;
+            const auto column = [&os](const void* datap, size_t size) {
+                static const char zeros[8] = {};
+                os.write(static_cast<const char*>(datap), size);
+                os.write(zeros, VerilatedCovBinary::padded(size) - size);
+            };
+            os.write(VerilatedCovBinary::MAGIC, VerilatedCovBinary::MAGIC_SIZE);
+            const uint32_t header32[2] = {VerilatedCovBinary::VERSION,
+                                          VerilatedCovBinary::ENDIAN_MARK};
+            const uint64_t header64[4] = {m_strings.size(), stringBytes, m_points.size(), numRefs};
+            const uint32_t header32b[2] = {countBytes, 0};
+            os.write(reinterpret_cast<const char*>(header32), sizeof(header32));
+            os.write(reinterpret_cast<const char*>(header64), sizeof(header64));
+            os.write(reinterpret_cast<const char*>(header32b), sizeof(header32b));
+            column(stringEnds.data(), stringEnds.size() * sizeof(uint64_t));
+            std::string blob;
+            blob.reserve(stringBytes);
+            for (const std::string& str : m_strings) blob += str;
+            column(blob.data(), blob.size());
+            std::vector<uint8_t> pointRefs;
+            std::vector<uint32_t> refs;
+            pointRefs.reserve(m_points.size());
+            refs.reserve(numRefs);
+            for (size_t i = 0; i < m_points.size(); ++i) {
+                const std::vector<uint32_t>& keyRefs = *m_pointRefs[i];
+                refs.insert(refs.end(), keyRefs.begin(), keyRefs.end());
+                if (hierIds[i]) refs.push_back(hierIds[i] - 1);
+                pointRefs.push_back(static_cast<uint8_t>(keyRefs.size() + (hierIds[i] ? 1 : 0)));
+            }
+            column(pointRefs.data(), pointRefs.size());
+            column(refs.data(), refs.size() * sizeof(uint32_t));
+            if (countBytes == 8) {
+                std::vector<uint64_t> counts;
+                counts.reserve(m_points.size());
+                for (const Point& point : m_points) counts.push_back(point.m_count);
+                column(counts.data(), counts.size() * sizeof(uint64_t));
+            } else {
+                std::vector<uint32_t> counts;
+                counts.reserve(m_points.size());
+                for (const Point& point : m_points) {
+                    counts.push_back(static_cast<uint32_t>(point.m_count));
+                }
+                column(counts.data(), counts.size() * sizeof(uint32_t));
+            }
+            return !os.fail();
+        }
+    };
+
+    void writeBinary(const std::string& filename) VL_REQUIRES(m_mutex) {
+        BinaryWriter writer;
+        std::vector<uint32_t> refs;
+        for (const auto& itemp : m_items) {
+            refs.clear();
+            const std::string* hierp = nullptr;
+            bool perInstance = m_forcePerInstance;
+            for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
+                if (itemp->m_keys[i] == VerilatedCovConst::KEY_UNDEF) continue;
+                const auto& frag = writer.fragment(itemp->m_keys[i], itemp->m_vals[i],
+                                                   m_indexValues);
+                if (frag.m_hier) {
+                    hierp = &m_indexValues[itemp->m_vals[i]];
+                } else {
+                    refs.push_back(frag.m_id);
+                    if (frag.m_perInstance) perInstance = true;
+                }
+            }
+            const std::string hier = hierp ? *hierp : "";
+            if (perInstance) {  // Not collapsing hierarchies
+                refs.push_back(writer.stringId(keyValueFormatter(VL_CIK_HIER, hier)));
+                writer.addPoint(refs, "", itemp->count());
+            } else {
+                writer.addPoint(refs, hier, itemp->count());
+            }
+        }
+        if (VL_UNLIKELY(!writer.write(filename))) {
+            const std::string msg = "%Error: Can't write '"s + filename + "'";
+            VL_FATAL_MT("", 0, "", msg.c_str());
+        }
+    }
 };
 
 //=============================================================================
@@ -442,6 +690,9 @@ void VerilatedCovContext::clearNonMatch(const char* matchp) VL_MT_SAFE {
     impp()->clearNonMatch(matchp);
 }
 void VerilatedCovContext::zero() VL_MT_SAFE { impp()->zero(); }
+void VerilatedCovContext::hitMap(uint8_t* mapp, size_t size) VL_MT_SAFE {
+    impp()->hitMap(mapp, size);
+}
 void VerilatedCovContext::write(const std::string& filename) VL_MT_SAFE {
     impp()->write(filename);
 }
@@ -451,6 +702,24 @@ void VerilatedCovContext::_inserti(uint32_t* itemp) VL_MT_SAFE {
 void VerilatedCovContext::_inserti(uint64_t* itemp) VL_MT_SAFE {
     impp()->inserti(new VerilatedCoverItemSpec<uint64_t>{itemp});
 }
+void VerilatedCovContext::_inserti(const VerilatedCovShards::Bin& bin) VL_MT_SAFE {
+    if (bin.m_shardsp) {
+        impp()->inserti(new VerilatedCoverItemShards{bin});
+    } else {
+        // Second and later instances of a module count in the first instance
+        static uint32_t s_zero = 0;
+        impp()->inserti(new VerilatedCoverItemSpec<uint32_t>{&s_zero});
+    }
+}
+void VerilatedCovContext::_inserti(const VerilatedCovBit& bit) VL_MT_SAFE {
+    if (bit.m_wordp) {
+        impp()->inserti(new VerilatedCoverItemBit{bit});
+    } else {
+        // Second and later instances of a module count in the first instance
+        static uint32_t s_zero = 0;
+        impp()->inserti(new VerilatedCoverItemSpec<uint32_t>{&s_zero});
+    }
+}
 void VerilatedCovContext::_insertf(const char* filename, int lineno) VL_MT_SAFE {
     impp()->insertf(filename, lineno);
 }
@@ -32,6 +32,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 class VerilatedCovImp;
 
@@ -75,6 +76,83 @@ class VerilatedCovImp;
         ccontextp->_insertp("hier", name, __VA_ARGS__); \
     } while (false)
 
+//=============================================================================
+//  VerilatedCovBit
+/// A coverage point recorded as a single bit, for models Verilated with
+/// --coverage-hit-once.  Inserted with VL_COVER_INSERT, and reported with a
+/// count of 0 or 1.
+
+struct VerilatedCovBit final {
+    uint32_t* m_wordp;  ///< Word holding the bit, or nullptr to insert a zero count
+    uint32_t m_mask;  ///< Mask of the bit in the word
+};
+
+//=============================================================================
+//  VerilatedCovShards
+/// Per-thread coverage counters, for models Verilated with
+/// --coverage-per-thread.
+///
+/// Each thread pool worker, and the thread calling eval(), increments its
+/// own shard of the counters, so no atomic operations are needed.  The bins
+/// are inserted with VL_COVER_INSERT as a VerilatedCovShards::Bin, and the
+/// shards are summed only when the coverage is read by write().
+
+class VerilatedCovShards final {
+    VL_UNCOPYABLE(VerilatedCovShards);
+
+public:
+    // TYPES
+    /// A counter in each shard, passed to VL_COVER_INSERT
+    struct Bin final {
+        VerilatedCovShards* m_shardsp;  ///< Counters, or nullptr to insert a zero count
+        size_t m_bin;  ///< Index of the counter in each shard
+    };
+
+private:
+    // CONSTANTS
+    static constexpr size_t LINE_COUNTERS = VL_CACHE_LINE_BYTES / sizeof(uint32_t);
+    // MEMBERS
+    std::vector<uint32_t> m_storage;  // Counters, with slack for cache line alignment
+    uint32_t* m_countsp;  // First shard, cache line aligned
+    size_t m_stride;  // Counters per shard, padded so shards share no cache line
+    size_t m_numShards;  // Number of shards
+
+public:
+    // CONSTRUCTORS
+    /// Create counters for 'bins' bins, for 'numShards' threads; numShards
+    /// is the thread pool's number of workers plus one for the eval() thread.
+    VerilatedCovShards(size_t bins, size_t numShards)
+        : m_storage((bins + LINE_COUNTERS - 1) / LINE_COUNTERS * LINE_COUNTERS * numShards
+                    + LINE_COUNTERS)
+        , m_stride{(bins + LINE_COUNTERS - 1) / LINE_COUNTERS * LINE_COUNTERS}
+        , m_numShards{numShards} {
+        const uintptr_t addr = reinterpret_cast<uintptr_t>(m_storage.data());
+        const uintptr_t aligned = (addr + VL_CACHE_LINE_BYTES - 1) & ~(VL_CACHE_LINE_BYTES - 1);
+        m_countsp = m_storage.data() + (aligned - addr) / sizeof(uint32_t);
+    }
+    ~VerilatedCovShards() = default;
+
+    // METHODS
+    /// Counters of the calling thread
+    uint32_t* threadCountsp() VL_MT_SAFE {
+        const size_t shard = Verilated::threadWorkerId();
+        // A worker of another pool cannot run this model, but be safe
+        return m_countsp + (VL_LIKELY(shard < m_numShards) ? shard : 0) * m_stride;
+    }
+    /// Total of a bin across all shards
+    uint64_t count(size_t bin) const VL_MT_UNSAFE {
+        uint64_t total = 0;
+        for (size_t shard = 0; shard < m_numShards; ++shard) {
+            total += m_countsp[shard * m_stride + bin];
+        }
+        return total;
+    }
+    /// Zero a bin in all shards
+    void zero(size_t bin) VL_MT_UNSAFE {
+        for (size_t shard = 0; shard < m_numShards; ++shard) m_countsp[shard * m_stride + bin] = 0;
+    }
+};
+
 //=============================================================================
 //  VerilatedCov
 /// Per-VerilatedContext coverage data class.
@@ -101,6 +179,9 @@ public:
     void clearNonMatch(const char* matchp) VL_MT_SAFE;
     /// Zero coverage points
     void zero() VL_MT_SAFE;
+    /// Add each point's count, saturating at 255, into a fuzzer's hit count
+    /// map of size bytes, at the point's index modulo the size
+    void hitMap(uint8_t* mapp, size_t size) VL_MT_SAFE;
 
     // METHODS - public but Internal use only
 
@@ -111,6 +192,8 @@ public:
     // _insert1: Remember item pointer with count.  (Not const, as may add zeroing function)
     void _inserti(uint32_t* itemp) VL_MT_SAFE;
     void _inserti(uint64_t* itemp) VL_MT_SAFE;
+    void _inserti(const VerilatedCovShards::Bin& bin) VL_MT_SAFE;
+    void _inserti(const VerilatedCovBit& bit) VL_MT_SAFE;
     // _insert2: Set default filename and line number
     void _insertf(const char* filename, int lineno) VL_MT_SAFE;
     // _insert3: Set parameters
@@ -82,4 +82,34 @@ public:
     }
 };
 
+//=============================================================================
+// VerilatedCovBinary
+// Layout of binary coverage data files, written by VerilatedCovContext::write
+// when +verilator+coverage+binary, and read by verilator_coverage.
+// All values are in the writer's byte order, see ENDIAN_MARK.
+//
+//   char[8]  MAGIC
+//   uint32_t VERSION, ENDIAN_MARK
+//   uint64_t numStrings, stringBytes, numPoints, numRefs
+//   uint32_t countBytes (4 or 8), 0
+//   uint64_t stringEnds[numStrings]   Offset after each string in the blob
+//   char     blob[stringBytes]        Interned "\001key\002value" fragments
+//   uint8_t  pointRefs[numPoints]     Number of fragments in each point name
+//   uint32_t refs[numRefs]            String index of each fragment, by point
+//   uint32_t/uint64_t counts[numPoints]
+//
+// Each column is padded with zeros to a multiple of 8 bytes. A point's name,
+// as in text coverage files, is the concatenation of its fragments.
+
+class VerilatedCovBinary final {
+public:
+    static constexpr const char* MAGIC = "VLCOVBIN";
+    static constexpr size_t MAGIC_SIZE = 8;
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t ENDIAN_MARK = 0x01020304;
+    static constexpr size_t HEADER_SIZE = 56;
+    // Round up to a column boundary
+    static constexpr uint64_t padded(uint64_t size) { return (size + 7) & ~uint64_t{7}; }
+};
+
 #endif  // guard
@@ -42,6 +42,11 @@
 
 #include "vltstd/svdpi.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 //======================================================================
 // Internal macros
 
@@ -810,3 +815,69 @@ int svIsDisabledState() {
 void svAckDisabledState() {
     // Disables not implemented
 }
+
+//======================================================================
+// Deferred calls
+
+std::atomic<uint64_t> VerilatedDpiDeferred::s_pending{0};
+
+// Worker thread state, created on first use and stopped at exit
+class VerilatedDpiDeferredImp final {
+    std::mutex m_mutex;
+    std::condition_variable m_cv;  // Signals new work, or completion, or exit
+    std::deque<std::function<void()>> m_queue;  // Calls not yet started
+    bool m_exit = false;  // Stop the worker
+    std::thread m_thread;
+
+    void main() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (true) {
+            m_cv.wait(lock, [this] { return m_exit || !m_queue.empty(); });
+            if (m_queue.empty()) return;
+            std::function<void()> func = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+            func();
+            lock.lock();
+            if (VerilatedDpiDeferred::s_pending.fetch_sub(1, std::memory_order_release) == 1) {
+                m_cv.notify_all();
+            }
+        }
+    }
+
+public:
+    VerilatedDpiDeferredImp()
+        : m_thread{[this] { main(); }} {}
+    ~VerilatedDpiDeferredImp() {
+        {
+            const std::lock_guard<std::mutex> lock{m_mutex};
+            m_exit = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+    static VerilatedDpiDeferredImp& s() {
+        static VerilatedDpiDeferredImp s_worker;
+        return s_worker;
+    }
+    void push(std::function<void()>&& func) {
+        {
+            const std::lock_guard<std::mutex> lock{m_mutex};
+            m_queue.push_back(std::move(func));
+        }
+        m_cv.notify_all();
+    }
+    void join() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_cv.wait(lock, [] {
+            return VerilatedDpiDeferred::s_pending.load(std::memory_order_acquire) == 0;
+        });
+    }
+};
+
+void VerilatedDpiDeferred::push(std::function<void()>&& func) VL_MT_SAFE {
+    s_pending.fetch_add(1, std::memory_order_relaxed);
+    VerilatedDpiDeferredImp::s().push(std::move(func));
+}
+
+void VerilatedDpiDeferred::joinSlow() VL_MT_SAFE { VerilatedDpiDeferredImp::s().join(); }
@@ -33,6 +33,9 @@
 
 #include "svdpi.h"
 
+#include <atomic>
+#include <functional>
+
 //===================================================================
 // SETTING OPERATORS
 
@@ -91,6 +94,26 @@ static inline void VL_SET_SVLV_Q(int, svLogicVecVal* owp, const QData ld) VL_MT_
     owp[1].bval = 0;
 }
 
+//======================================================================
+// DEFERRED CALLS
+
+// Runs --dpi-deferred import calls in order on a background thread. Generated code
+// joins before calling any other DPI import, and at the end of each eval.
+class VerilatedDpiDeferred final {
+    friend class VerilatedDpiDeferredImp;
+    static std::atomic<uint64_t> s_pending;  // Calls pushed but not yet completed
+    static void joinSlow() VL_MT_SAFE;
+
+public:
+    // Queue a call
+    static void push(std::function<void()>&& func) VL_MT_SAFE;
+    // Wait for all queued calls to complete
+    static void join() VL_MT_SAFE {
+        if (VL_LIKELY(s_pending.load(std::memory_order_acquire) == 0)) return;
+        joinSlow();
+    }
+};
+
 //======================================================================
 
 #endif  // Guard
@@ -78,7 +78,13 @@ VerilatedFst::~VerilatedFst() {
 
 void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
-    m_fst = fstWriterCreate(filename, 1);
+    m_filename = filename;
+    m_sliceNum = 0;
+    openImp(m_filename);
+}
+
+void VerilatedFst::openImp(const std::string& filename) {
+    m_fst = fstWriterCreate(filename.c_str(), 1);
     fstWriterSetPackType(m_fst, FST_WR_PT_LZ4);
     fstWriterSetTimescaleFromString(m_fst, timeResStr().c_str());  // lintok-begin-on-ref
     if (m_useFstWriterThread) fstWriterSetParallelMode(m_fst, 1);
@@ -100,12 +106,27 @@ void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
 
 void VerilatedFst::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
+    closeImp();
+}
+
+void VerilatedFst::closeImp() {
     Super::closeBase();
     emitTimeChangeMaybe();
     fstWriterClose(m_fst);
     m_fst = nullptr;
 }
 
+bool VerilatedFst::preChangeDump() {
+    if (VL_UNLIKELY(m_sliceTime && isOpen()
+                    && timeLastDump() - m_sliceStartTime >= m_sliceTime)) {
+        // Each slice is a complete file, starting with its own header and full dump
+        closeImp();
+        openImp(sliceFilename(m_filename, ++m_sliceNum));
+        m_sliceStartTime = timeLastDump();
+    }
+    return isOpen();
+}
+
 void VerilatedFst::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     Super::flushBase();
@@ -376,8 +397,13 @@ void VerilatedFstBuffer::emitQData(uint32_t code, QData newval, int bits) {
 
 VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitWData(uint32_t code, const WData* newvalp, int bits) {
+    VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    m_owner.emitTimeChangeMaybe();
+    // Convert straight into the FST writer's value change buffer, if it allows
+    char* const vcp
+        = reinterpret_cast<char*>(fstWriterEmitValueChangeInPlace(m_fst, m_symbolp[code]));
     int words = VL_WORDS_I(bits);
-    char* wp = m_strbufp;
+    char* wp = VL_LIKELY(vcp) ? vcp : m_strbufp;
     // Convert the most significant word
     const int bitsInMSW = VL_BITBIT_E(bits) ? VL_BITBIT_E(bits) : VL_EDATASIZE;
     cvtEDataToStr(wp, newvalp[--words] << (VL_EDATASIZE - bitsInMSW));
@@ -387,8 +413,8 @@ void VerilatedFstBuffer::emitWData(uint32_t code, const WData* newvalp, int bits
         cvtEDataToStr(wp, newvalp[--words]);
         wp += VL_EDATASIZE;
     }
-    m_owner.emitTimeChangeMaybe();
-    fstWriterEmitValueChange(m_fst, m_symbolp[code], m_strbufp);
+    // Exactly 'bits' characters were written, as emitWData is only used for wide signals
+    if (VL_UNLIKELY(!vcp)) fstWriterEmitValueChange(m_fst, m_symbolp[code], m_strbufp);
 }
 
 VL_ATTR_ALWINLINE
@@ -57,6 +57,10 @@ private:
     vlFstHandle* m_symbolp = nullptr;  // same as m_code2symbol, but as an array
     char* m_strbufp = nullptr;  // String buffer long enough to hold maxBits() chars
     uint64_t m_timeui = 0;  // Time to emit, 0 = not needed
+    std::string m_filename;  // Filename given to open, slice names derive from it
+    uint64_t m_sliceTime = 0;  // Time after which to start a new slice file, or 0
+    uint64_t m_sliceStartTime = 0;  // Time of the first dump in this slice
+    uint32_t m_sliceNum = 0;  // Number of the slice being written
 
     bool m_useFstWriterThread = false;  // Whether to use the separate FST writer thread
 
@@ -66,6 +70,8 @@ private:
 
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedFst);
+    void openImp(const std::string& filename);
+    void closeImp();
     void declare(uint32_t code, const char* name, int dtypenum, VerilatedTraceSigDirection,
                  VerilatedTraceSigKind, VerilatedTraceSigType, bool array, int arraynum,
                  bool bussed, int msb, int lsb);
@@ -79,8 +85,11 @@ protected:
     void emitTimeChangeMaybe();
 
     // Hooks called from VerilatedTrace
-    bool preFullDump() override { return isOpen(); }
-    bool preChangeDump() override { return isOpen(); }
+    bool preFullDump() override {
+        m_sliceStartTime = timeLastDump();
+        return isOpen();
+    }
+    bool preChangeDump() override;
 
     // Trace buffer management
     Buffer* getTraceBuffer(uint32_t fidx) override;
@@ -97,6 +106,10 @@ public:
     explicit VerilatedFst(void* fst = nullptr);
     ~VerilatedFst();
 
+    // ACCESSORS
+    // Set time after which a new self-contained file should be created.
+    void sliceTime(uint64_t time) VL_MT_SAFE { m_sliceTime = time; }
+
     // METHODS - All must be thread safe
     // Open the file; call isOpen() to see if errors
     void open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex);
@@ -150,6 +163,14 @@ template <>
 void VerilatedFst::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedFst::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedFst::Super::profile(bool flag);
+template <>
+std::string VerilatedFst::Super::profileReport();
+template <>
+void VerilatedFst::Super::recordWindow(uint32_t dumps);
+template <>
+void VerilatedFst::Super::dumpWindow();
 #endif
 
 //=============================================================================
@@ -215,6 +236,11 @@ public:
     bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
     /// Open a new FST file
     virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    /// Set time after which a new slice file should be created
+    /// Each slice is a complete FST file, with a full dump at its first
+    /// time, so it can be viewed on its own.  The first slice has the name
+    /// passed to open(), later slices append _slice0001 etc. to the base name.
+    void sliceTime(uint64_t time) VL_MT_SAFE { m_sptrace.sliceTime(time); }
     /// Close dump
     void close() VL_MT_SAFE {
         m_sptrace.close();
@@ -254,6 +280,15 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Record where dump time goes and which scopes change most; call before open
+    void profile(bool flag) VL_MT_SAFE { m_sptrace.profile(flag); }
+    // Return a report of the profile so far
+    std::string profileReport() VL_MT_SAFE { return m_sptrace.profileReport(); }
+    // Keep only the last 'dumps' dumps in memory, written by dumpWindow() or
+    // when $stop/$fatal is hit. Requires --trace-threads; call before open.
+    void recordWindow(uint32_t dumps) VL_MT_SAFE { m_sptrace.recordWindow(dumps); }
+    // Write the dumps kept by recordWindow
+    void dumpWindow() VL_MT_SAFE { m_sptrace.dumpWindow(); }
 
     // Internal class access
     VerilatedFst* spTrace() { return &m_sptrace; }
@@ -135,6 +135,20 @@ extern void VL_PRINTTIMESCALE(const char* namep, const char* timeunitp,
 extern WDataOutP _vl_moddiv_w(int lbits, WDataOutP owp, WDataInP const lwp, WDataInP const rwp,
                               bool is_modulus) VL_MT_SAFE;
 
+// SIMD loops of the wide operators, used from VL_SIMD_MIN_WORDS words.  These are out of line
+// so every model file does not have to parse the target's intrinsics headers.
+#define VL_SIMD_MIN_WORDS 4
+extern IData _vl_redor_w_simd(int words, WDataInP const lwp) VL_PURE;
+extern IData _vl_countones_w_simd(int words, WDataInP const lwp) VL_PURE;
+extern EData _vl_xor_or_w_simd(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE;
+extern WDataOutP _vl_and_w_simd(int words, WDataOutP owp, WDataInP const lwp,
+                                WDataInP const rwp) VL_MT_SAFE;
+extern WDataOutP _vl_or_w_simd(int words, WDataOutP owp, WDataInP const lwp,
+                               WDataInP const rwp) VL_MT_SAFE;
+extern WDataOutP _vl_xor_w_simd(int words, WDataOutP owp, WDataInP const lwp,
+                                WDataInP const rwp) VL_MT_SAFE;
+extern WDataOutP _vl_not_w_simd(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE;
+
 extern void _vl_vsss_based(WDataOutP owp, int obits, int baseLog2, const char* strp,
                            size_t posstart, size_t posend) VL_MT_SAFE;
 
@@ -148,8 +162,8 @@ extern void VL_FCLOSE_I(IData fdi) VL_MT_SAFE;
 extern IData VL_FREAD_I(int width, int array_lsb, int array_size, void* memp, IData fpi,
                         IData start, IData count) VL_MT_SAFE;
 
-extern void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE;
-extern void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE;
+extern void VL_WRITEF_NX(const char* format, int argc, ...) VL_MT_SAFE;
+extern void VL_FWRITEF_NX(IData fpi, const char* format, int argc, ...) VL_MT_SAFE;
 
 extern IData VL_FSCANF_INX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE;
 extern IData VL_SSCANF_IINX(int lbits, IData ld, const std::string& format, int argc,
@@ -159,15 +173,15 @@ extern IData VL_SSCANF_IQNX(int lbits, QData ld, const std::string& format, int
 extern IData VL_SSCANF_IWNX(int lbits, WDataInP const lwp, const std::string& format, int argc,
                             ...) VL_MT_SAFE;
 
-extern void VL_SFORMAT_NX(int obits, CData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, CData& destr, const char* format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, SData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, SData& destr, const char* format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, IData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, IData& destr, const char* format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, QData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, QData& destr, const char* format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, void* destp, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, void* destp, const char* format, int argc,
                           ...) VL_MT_SAFE;
 
 extern void VL_STACKTRACE() VL_MT_SAFE;
@@ -208,6 +222,28 @@ extern const char* vl_mc_scan_plusargs(const char* prefixp) VL_MT_SAFE;  // PLIi
      | (static_cast<QData>((lwp)[1]) << (static_cast<QData>(VL_EDATASIZE))))
 #define VL_SET_QII(ld, rd) ((static_cast<QData>(ld) << 32ULL) | static_cast<QData>(rd))
 
+#ifdef VL_HAVE_INT128
+// Native integer for 65-128 bit values, which are 3 or 4 words
+__extension__ typedef unsigned __int128 VlU128;
+#define VL_IS_U128_WORDS(words) ((words) == 3 || (words) == 4)
+// Return VlU128 from 3 or 4 words
+static inline VlU128 VL_SET_U128W(int words, WDataInP const lwp) VL_PURE {
+    const QData hi = (words == 4) ? VL_SET_QW(lwp + 2) : static_cast<QData>(lwp[2]);
+    return (static_cast<VlU128>(hi) << 64) | VL_SET_QW(lwp);
+}
+// Set 3 or 4 words from VlU128; does not clean upper bits
+static inline void VL_SET_WU128(int words, WDataOutP owp, VlU128 data) VL_MT_SAFE {
+    const QData lo = static_cast<QData>(data);
+    const QData hi = static_cast<QData>(data >> 64);
+    VL_SET_WQ(owp, lo);
+    if (words == 4) {
+        VL_SET_WQ(owp + 2, hi);
+    } else {
+        owp[2] = static_cast<IData>(hi);
+    }
+}
+#endif
+
 // Return FILE* from IData
 extern FILE* VL_CVT_I_FP(IData lhs) VL_MT_SAFE;
 
@@ -352,6 +388,12 @@ uint64_t VerilatedContext::time() const VL_MT_SAFE {
 #define VL_TIME_ROUND(t, p) (((t) + ((p) / 2)) / (p))
 #define VL_TIME_UNITED_Q(scale) VL_TIME_ROUND(VL_TIME_Q(), static_cast<QData>(scale))
 #define VL_TIME_UNITED_D(scale) (VL_TIME_D() / static_cast<double>(scale))
+// As above, but from the given context, as used by generated code, avoiding the thread-local
+// lookup of Verilated::threadContextp()
+#define VL_TIME_UNITED_Q_CTX(scale, contextp) \
+    VL_TIME_ROUND((contextp)->time(), static_cast<QData>(scale))
+#define VL_TIME_UNITED_D_CTX(scale, contextp) \
+    (static_cast<double>((contextp)->time()) / static_cast<double>(scale))
 
 // Return time precision as multiplier of time units
 double vl_time_multiplier(int scale) VL_PURE;
@@ -656,6 +698,7 @@ static inline IData VL_REDAND_IW(int lbits, WDataInP const lwp) VL_PURE {
 #define VL_REDOR_I(lhs) ((lhs) != 0)
 #define VL_REDOR_Q(lhs) ((lhs) != 0)
 static inline IData VL_REDOR_W(int words, WDataInP const lwp) VL_PURE {
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_redor_w_simd(words, lwp);
     EData equal = 0;
     for (int i = 0; i < words; ++i) equal |= lwp[i];
     return (equal != 0);
@@ -742,6 +785,7 @@ static inline IData VL_COUNTONES_Q(QData lhs) VL_PURE {
 }
 #define VL_COUNTONES_E VL_COUNTONES_I
 static inline IData VL_COUNTONES_W(int words, WDataInP const lwp) VL_PURE {
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_countones_w_simd(words, lwp);
     EData r = 0;
     for (int i = 0; i < words; ++i) r += VL_COUNTONES_E(lwp[i]);
     return r;
@@ -809,6 +853,25 @@ static inline IData VL_ONEHOT0_W(int words, WDataInP const lwp) VL_PURE {
     return 1;
 }
 
+// Index of least significant set bit; lhs must be non-zero
+static inline IData VL_CTZ_I(IData lhs) VL_PURE {
+#ifdef __GNUC__
+    return __builtin_ctz(lhs);
+#else
+    IData r = 0;
+    for (; !(lhs & 1); lhs >>= 1) ++r;
+    return r;
+#endif
+}
+static inline IData VL_CTZ_Q(QData lhs) VL_PURE {
+#ifdef __GNUC__
+    return __builtin_ctzll(lhs);
+#else
+    const IData lo = static_cast<IData>(lhs);
+    return lo ? VL_CTZ_I(lo) : 32 + VL_CTZ_I(static_cast<IData>(lhs >> 32));
+#endif
+}
+
 static inline IData VL_CLOG2_I(IData lhs) VL_PURE {
     // There are faster algorithms, or fls GCC4 builtins, but rarely used
     // In C++20 there will be std::bit_width(lhs) - 1
@@ -856,36 +919,79 @@ static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
 //===================================================================
 // SIMPLE LOGICAL OPERATORS
 
+// Internal usage: OR of lwp[i] ^ rwp[i] over all words, so zero when equal
+static inline EData _vl_xor_or_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_xor_or_w_simd(words, lwp, rwp);
+    EData od = 0;
+    for (int i = 0; i < words; ++i) od |= (lwp[i] ^ rwp[i]);
+    return od;
+}
+
 // EMIT_RULE: VL_AND:  oclean=lclean||rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_AND_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_and_w_simd(words, owp, lwp, rwp);
+    for (int i = 0; i < words; ++i) owp[i] = (lwp[i] & rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_OR:   oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_OR_W(int words, WDataOutP owp, WDataInP const lwp,
                                 WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_or_w_simd(words, owp, lwp, rwp);
+    for (int i = 0; i < words; ++i) owp[i] = (lwp[i] | rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_CHANGEXOR:  oclean=1; obits=32; lbits==rbits;
 static inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
-    IData od = 0;
-    for (int i = 0; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
-    return od;
+    return _vl_xor_or_w(words, lwp, rwp);
 }
 // EMIT_RULE: VL_XOR:  oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_XOR_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_xor_w_simd(words, owp, lwp, rwp);
+    for (int i = 0; i < words; ++i) owp[i] = (lwp[i] ^ rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_NOT:  oclean=dirty; obits=lbits;
 static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    if (words >= VL_SIMD_MIN_WORDS) return _vl_not_w_simd(words, owp, lwp);
     for (int i = 0; i < words; ++i) owp[i] = ~(lwp[i]);
     return owp;
 }
 
+// Compile-time width versions of the above, as emitted for wide operators.  Vectors of up to
+// VL_UNROLL_MAX_WORDS fully unroll with constant indices, wider ones use the SIMD loops.
+#ifndef VL_UNROLL_MAX_WORDS
+# define VL_UNROLL_MAX_WORDS 8  ///< Widest vector in words to unroll rather than loop over
+#endif
+template <int N_Words>
+static inline WDataOutP VL_AND_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    if (N_Words > VL_UNROLL_MAX_WORDS) return VL_AND_W(N_Words, owp, lwp, rwp);
+    for (int i = 0; i < N_Words; ++i) owp[i] = (lwp[i] & rwp[i]);
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_OR_W(WDataOutP owp, WDataInP const lwp,
+                                WDataInP const rwp) VL_MT_SAFE {
+    if (N_Words > VL_UNROLL_MAX_WORDS) return VL_OR_W(N_Words, owp, lwp, rwp);
+    for (int i = 0; i < N_Words; ++i) owp[i] = (lwp[i] | rwp[i]);
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_XOR_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    if (N_Words > VL_UNROLL_MAX_WORDS) return VL_XOR_W(N_Words, owp, lwp, rwp);
+    for (int i = 0; i < N_Words; ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_NOT_W(WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    if (N_Words > VL_UNROLL_MAX_WORDS) return VL_NOT_W(N_Words, owp, lwp);
+    for (int i = 0; i < N_Words; ++i) owp[i] = ~lwp[i];
+    return owp;
+}
+
 //=========================================================================
 // Logical comparisons
 
@@ -903,9 +1009,7 @@ static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) V
 
 // Output clean, <lhs> AND <rhs> MUST BE CLEAN
 static inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
-    EData nequal = 0;
-    for (int i = 0; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
-    return (nequal == 0);
+    return (_vl_xor_or_w(words, lwp, rwp) == 0);
 }
 
 // Internal usage
@@ -1013,19 +1117,62 @@ static inline IData VL_DIV_III(int lbits, IData lhs, IData rhs) {
 static inline QData VL_DIV_QQQ(int lbits, QData lhs, QData rhs) {
     return (rhs == 0) ? 0 : lhs / rhs;
 }
-#define VL_DIV_WWW(lbits, owp, lwp, rwp) (_vl_moddiv_w(lbits, owp, lwp, rwp, 0))
+static inline WDataOutP VL_DIV_WWW(int lbits, WDataOutP owp, WDataInP const lwp,
+                                   WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    const int words = VL_WORDS_I(lbits);
+    if (VL_IS_U128_WORDS(words)) {
+        const VlU128 rhs = VL_SET_U128W(words, rwp);
+        VL_SET_WU128(words, owp, (rhs == 0) ? 0 : VL_SET_U128W(words, lwp) / rhs);
+        return owp;
+    }
+#endif
+    return _vl_moddiv_w(lbits, owp, lwp, rwp, 0);
+}
 static inline IData VL_MODDIV_III(int lbits, IData lhs, IData rhs) {
     return (rhs == 0) ? 0 : lhs % rhs;
 }
 static inline QData VL_MODDIV_QQQ(int lbits, QData lhs, QData rhs) {
     return (rhs == 0) ? 0 : lhs % rhs;
 }
-#define VL_MODDIV_WWW(lbits, owp, lwp, rwp) (_vl_moddiv_w(lbits, owp, lwp, rwp, 1))
+static inline WDataOutP VL_MODDIV_WWW(int lbits, WDataOutP owp, WDataInP const lwp,
+                                      WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    const int words = VL_WORDS_I(lbits);
+    if (VL_IS_U128_WORDS(words)) {
+        const VlU128 rhs = VL_SET_U128W(words, rwp);
+        VL_SET_WU128(words, owp, (rhs == 0) ? 0 : VL_SET_U128W(words, lwp) % rhs);
+        return owp;
+    }
+#endif
+    return _vl_moddiv_w(lbits, owp, lwp, rwp, 1);
+}
+
+// Wide add and subtract propagate the carry 64 bits at a time when two
+// words can be loaded as one little endian 64-bit limb
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS) && defined(__BYTE_ORDER__) \
+    && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define VL_HAVE_LIMB64_CARRY 1
+#endif
 
 static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
     QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+    int i = 0;
+#ifdef VL_HAVE_LIMB64_CARRY
+    for (; i + 2 <= words; i += 2) {
+        QData lhs;
+        QData rhs;
+        std::memcpy(&lhs, lwp + i, sizeof(lhs));
+        std::memcpy(&rhs, rwp + i, sizeof(rhs));
+        QData sum;
+        const bool carryA = __builtin_add_overflow(lhs, rhs, &sum);
+        const bool carryB = __builtin_add_overflow(sum, carry, &sum);
+        carry = carryA | carryB;
+        std::memcpy(owp + i, &sum, sizeof(sum));
+    }
+#endif
+    for (; i < words; ++i) {
         carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
@@ -1036,11 +1183,25 @@ static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
 
 static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+    int i = 0;
+    bool borrow = false;
+#ifdef VL_HAVE_LIMB64_CARRY
+    for (; i + 2 <= words; i += 2) {
+        QData lhs;
+        QData rhs;
+        std::memcpy(&lhs, lwp + i, sizeof(lhs));
+        std::memcpy(&rhs, rwp + i, sizeof(rhs));
+        QData diff;
+        const bool borrowA = __builtin_sub_overflow(lhs, rhs, &diff);
+        const bool borrowB = __builtin_sub_overflow(diff, static_cast<QData>(borrow), &diff);
+        borrow = borrowA | borrowB;
+        std::memcpy(owp + i, &diff, sizeof(diff));
+    }
+#endif
+    QData carry = borrow ? 0 : 1;  // Negation of rwp, unless borrowing from the limbs
+    for (; i < words; ++i) {
         carry = (carry + static_cast<QData>(lwp[i])
                  + static_cast<QData>(static_cast<IData>(~rwp[i])));
-        if (i == 0) ++carry;  // Negation of rwp
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
     }
@@ -1050,6 +1211,12 @@ static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
 
 static inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    if (VL_IS_U128_WORDS(words)) {
+        VL_SET_WU128(words, owp, VL_SET_U128W(words, lwp) * VL_SET_U128W(words, rwp));
+        return owp;
+    }
+#endif
     for (int i = 0; i < words; ++i) owp[i] = 0;
     for (int lword = 0; lword < words; ++lword) {
         for (int rword = 0; rword < words; ++rword) {
@@ -2771,6 +2938,11 @@ inline std::string VL_CVT_PACK_STR_NI(IData lhs) VL_PURE {
 inline std::string VL_CONCATN_NNN(const std::string& lhs, const std::string& rhs) VL_PURE {
     return lhs + rhs;
 }
+inline std::string VL_CONCATN_NNN(std::string&& lhs, const std::string& rhs) VL_PURE {
+    // Chained concatenation, so append into the temporary rather than copying it
+    lhs += rhs;
+    return std::move(lhs);
+}
 inline std::string VL_REPLICATEN_NNQ(const std::string& lhs, IData rep) VL_PURE {
     std::string result;
     result.reserve(lhs.length() * rep);
@@ -2795,11 +2967,48 @@ extern void VL_READMEM_N(bool hex, int bits, QData depth, int array_lsb,
 extern void VL_WRITEMEM_N(bool hex, int bits, QData depth, int array_lsb,
                           const std::string& filename, const void* memp, QData start,
                           QData end) VL_MT_SAFE;
+// Sparse arrays only allocate the pages that the file writes
+template <typename T_Value, std::size_t N_Depth>
+void VL_READMEM_N(bool hex, int bits, QData depth, int array_lsb, const std::string& filename,
+                  VlSparseArray<T_Value, N_Depth>& obj, QData start, QData end) VL_MT_SAFE {
+    if (start < static_cast<QData>(array_lsb)) start = array_lsb;
+    VlReadMem rmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!rmem.isOpen())) return;
+    std::string data;
+    while (true) {
+        QData addr = 0;
+        if (rmem.get(addr /*ref*/, data /*ref*/)) {
+            if (VL_UNLIKELY(addr < static_cast<QData>(array_lsb)
+                            || addr >= static_cast<QData>(array_lsb + depth))) {
+                VL_FATAL_MT(filename.c_str(), rmem.linenum(), "",
+                            "$readmem file address beyond bounds of array");
+            } else {
+                rmem.setData(&(obj[addr - array_lsb]), data);
+            }
+        } else {
+            break;
+        }
+    }
+}
+
+template <typename T_Value, std::size_t N_Depth>
+void VL_WRITEMEM_N(bool hex, int bits, QData depth, int array_lsb, const std::string& filename,
+                   const VlSparseArray<T_Value, N_Depth>& obj, QData start,
+                   QData end) VL_MT_SAFE {
+    const QData addr_max = array_lsb + depth - 1;
+    if (start < static_cast<QData>(array_lsb)) start = array_lsb;
+    if (end > addr_max) end = addr_max;
+    VlWriteMem wmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!wmem.isOpen())) return;
+    for (QData addr = start; addr <= end; ++addr) {
+        wmem.print(addr, false, &(obj[addr - array_lsb]));
+    }
+}
 extern IData VL_SSCANF_INNX(int lbits, const std::string& ld, const std::string& format, int argc,
                             ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits_ignored, std::string& output, const std::string& format,
-                          int argc, ...) VL_MT_SAFE;
-extern std::string VL_SFORMATF_N_NX(const std::string& format, int argc, ...) VL_MT_SAFE;
+extern void VL_SFORMAT_NX(int obits_ignored, std::string& output, const char* format, int argc,
+                          ...) VL_MT_SAFE;
+extern std::string VL_SFORMATF_N_NX(const char* format, int argc, ...) VL_MT_SAFE;
 extern void VL_TIMEFORMAT_IINI(bool hasUnits, int units, bool hasPrecision, int precision,
                                bool hasSuffix, const std::string& suffix, bool hasWidth, int width,
                                VerilatedContext* contextp) VL_MT_SAFE;
@@ -0,0 +1,88 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated coverage-guided fuzzer fork server implementation code
+///
+/// This file must be compiled and linked against all Verilated objects
+/// that use --fuzz-server.
+///
+//=============================================================================
+
+#define VERILATOR_VERILATED_FUZZ_CPP_
+
+#include "verilatedos.h"
+
+#include "verilated_fuzz.h"
+
+#include "verilated.h"
+
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <sys/shm.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// File descriptors of the fuzzer's control and status pipes, per the AFL protocol
+constexpr int FUZZ_CTL_FD = 198;
+constexpr int FUZZ_ST_FD = FUZZ_CTL_FD + 1;
+// Coverage map size unless the fuzzer sets AFL_MAP_SIZE
+constexpr size_t FUZZ_MAP_SIZE = 1 << 16;
+
+bool VerilatedFuzzServer::s_child = false;
+
+void VerilatedFuzzServer::serve(VerilatedContext* contextp) VL_MT_UNSAFE {
+#ifndef _WIN32
+    // Tell the fuzzer we are ready; if this fails, no fuzzer is listening
+    uint32_t word = 0;
+    if (::write(FUZZ_ST_FD, &word, sizeof(word)) != sizeof(word)) return;
+    while (true) {
+        // Wait for the fuzzer to request a run
+        if (::read(FUZZ_CTL_FD, &word, sizeof(word)) != sizeof(word)) std::_Exit(0);
+        const int pid = contextp->forkSnapshot();
+        if (pid < 0) std::_Exit(1);
+        if (pid == 0) {
+            ::close(FUZZ_CTL_FD);
+            ::close(FUZZ_ST_FD);
+            s_child = true;
+            return;
+        }
+        word = static_cast<uint32_t>(pid);
+        if (::write(FUZZ_ST_FD, &word, sizeof(word)) != sizeof(word)) std::_Exit(1);
+        int status = 0;
+        if (::waitpid(pid, &status, 0) < 0) std::_Exit(1);
+        word = static_cast<uint32_t>(status);
+        if (::write(FUZZ_ST_FD, &word, sizeof(word)) != sizeof(word)) std::_Exit(1);
+    }
+#endif
+}
+
+uint8_t* VerilatedFuzzServer::mapp(size_t& size) VL_MT_SAFE {
+#ifndef _WIN32
+    // Attach once; the mapping is inherited by children
+    static uint8_t* const s_mapp = []() -> uint8_t* {
+        const char* const idp = std::getenv("__AFL_SHM_ID");
+        if (!idp) return nullptr;
+        void* const mapp = ::shmat(std::atoi(idp), nullptr, 0);
+        return mapp == reinterpret_cast<void*>(-1) ? nullptr : static_cast<uint8_t*>(mapp);
+    }();
+    const char* const sizep = std::getenv("AFL_MAP_SIZE");
+    size = sizep && std::atol(sizep) > 0 ? static_cast<size_t>(std::atol(sizep)) : FUZZ_MAP_SIZE;
+    return s_mapp;
+#else
+    size = 0;
+    return nullptr;
+#endif
+}
@@ -0,0 +1,53 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated coverage-guided fuzzer fork server
+///
+/// Implements the AFL fork server protocol, so a fuzzer can run each test
+/// input in a forked copy of a model that has already been constructed and
+/// reset, and receive coverage feedback in the fuzzer's shared-memory map.
+///
+/// This file is included automatically by Verilator when using
+/// --fuzz-server, and may also be used by a user-written main().
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_FUZZ_H_
+#define VERILATOR_VERILATED_FUZZ_H_
+
+#include "verilatedos.h"
+
+class VerilatedContext;
+
+//=============================================================================
+// VerilatedFuzzServer
+/// Fork server for AFL-style fuzzers.  All methods are static.
+
+class VerilatedFuzzServer final {
+    static bool s_child;  // In a child forked by serve()
+
+public:
+    /// If running under a fork server aware fuzzer, fork a child for each
+    /// test input the fuzzer requests, and return in each child.  The
+    /// parent exits when the fuzzer closes the control pipe.  If not
+    /// running under a fuzzer, returns immediately.
+    static void serve(VerilatedContext* contextp) VL_MT_UNSAFE;
+    /// Return true in a child forked by serve()
+    static bool child() VL_MT_SAFE { return s_child; }
+    /// Return the fuzzer's shared-memory coverage map and set its size in
+    /// bytes, or return nullptr if not running under a fuzzer
+    static uint8_t* mapp(size_t& size) VL_MT_SAFE;
+};
+
+#endif  // Guard
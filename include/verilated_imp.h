@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -80,53 +81,72 @@ public:
     void run() const { m_cb(); }
 };
 
-// Each thread has a queue it pushes to
+// Each thread builds up its messages until the end of each mtask, then posts them
+// here as one batch.  Posting is a lock-free push, so workers do not serialize.
 // This assumes no thread starts pushing the next tick until the previous has drained.
-// If more aggressiveness is needed, a double-buffered scheme might work well.
 class VerilatedEvalMsgQueue final {
-    using VerilatedThreadQueue = std::multiset<VerilatedMsg, VerilatedMsg::Cmp>;
+    // Messages posted together by one thread
+    struct Batch final {
+        Batch* m_nextp = nullptr;  // Batch posted before this one
+        std::vector<VerilatedMsg> m_msgs;  // Messages in the order posted
+    };
 
-    std::atomic<uint64_t> m_depth;  // Current depth of queue (see comments below)
+    std::atomic<Batch*> m_batchesp{nullptr};  // Posted batches, most recent first
 
-    mutable VerilatedMutex m_mutex;  // Mutex protecting queue
-    VerilatedThreadQueue m_queue VL_GUARDED_BY(m_mutex);  // Message queue
 public:
     // CONSTRUCTORS
-    VerilatedEvalMsgQueue()
-        : m_depth{0} {
-        assert(atomic_is_lock_free(&m_depth));
+    VerilatedEvalMsgQueue() { assert(m_batchesp.is_lock_free()); }
+    ~VerilatedEvalMsgQueue() {
+        Batch* batchp = m_batchesp.exchange(nullptr);
+        while (batchp) {
+            Batch* const nextp = batchp->m_nextp;
+            delete batchp;
+            batchp = nextp;
+        }
     }
-    ~VerilatedEvalMsgQueue() = default;
 
 private:
     VL_UNCOPYABLE(VerilatedEvalMsgQueue);
 
 public:
     // METHODS
-    // Add message to queue (called by producer)
-    void post(const VerilatedMsg& msg) VL_MT_SAFE_EXCLUDES(m_mutex) {
-        const VerilatedLockGuard lock{m_mutex};
-        m_queue.insert(msg);  // Pass by value to copy the message into queue
-        ++m_depth;
+    // Add messages to queue (called by producer); takes the messages, leaving msgs empty
+    void post(std::vector<VerilatedMsg>& msgs) VL_MT_SAFE {
+        Batch* const batchp = new Batch;
+        batchp->m_msgs.swap(msgs);
+        batchp->m_nextp = m_batchesp.load(std::memory_order_relaxed);
+        while (!m_batchesp.compare_exchange_weak(batchp->m_nextp, batchp,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed)) {}
     }
     // Service queue until completion (called by consumer)
-    void process() VL_MT_SAFE_EXCLUDES(m_mutex) {
-        // Tracking m_depth is redundant to e.g. getting the mutex and looking at queue size,
-        // but on the reader side it's 4x faster to test an atomic then getting a mutex
-        while (m_depth) {
-            // Wait for a message to be added to the queue
-            // We don't use unique_lock as want to unlock with the message copy still in scope
-            m_mutex.lock();
-            assert(!m_queue.empty());  // Otherwise m_depth is wrong
-            // Unfortunately to release the lock we need to copy the message
-            // (Or have the message be a pointer, but then new/delete cost on each message)
-            // We assume messages are small, so copy
-            const auto it = m_queue.begin();
-            const VerilatedMsg msg = *(it);
-            m_queue.erase(it);
-            m_mutex.unlock();
-            --m_depth;  // Ok if outside critical section as only this code checks the value
-            {
+    void process() VL_MT_SAFE {
+        // Testing with a load first is much faster in the common case of no messages
+        while (m_batchesp.load(std::memory_order_relaxed)) {
+            // Take all batches, then reverse them into the order they were posted
+            Batch* batchp = m_batchesp.exchange(nullptr, std::memory_order_acquire);
+            Batch* postedp = nullptr;
+            while (batchp) {
+                Batch* const nextp = batchp->m_nextp;
+                batchp->m_nextp = postedp;
+                postedp = batchp;
+                batchp = nextp;
+            }
+            std::vector<VerilatedMsg> msgs;
+            while (postedp) {
+                Batch* const nextp = postedp->m_nextp;
+                if (msgs.empty()) {
+                    msgs.swap(postedp->m_msgs);
+                } else {
+                    std::move(postedp->m_msgs.begin(), postedp->m_msgs.end(),
+                              std::back_inserter(msgs));
+                }
+                delete postedp;
+                postedp = nextp;
+            }
+            // Deliver in mtask order, and within an mtask in the order posted
+            std::stable_sort(msgs.begin(), msgs.end(), VerilatedMsg::Cmp{});
+            for (const VerilatedMsg& msg : msgs) {
                 VL_DEBUG_IF(VL_DBG_MSGF("Executing callback from mtaskId=%d\n", msg.mtaskId()););
                 msg.run();
             }
@@ -136,7 +156,7 @@ public:
 
 // Each thread has a local queue to build up messages until the end of the eval() call
 class VerilatedThreadMsgQueue final {
-    std::queue<VerilatedMsg> m_queue;
+    std::vector<VerilatedMsg> m_queue;
 
 public:
     // CONSTRUCTORS
@@ -162,17 +182,17 @@ public:
             // No queueing, just do the action immediately
             msg.run();
         } else {
-            Verilated::endOfEvalReqdInc();
-            threadton().m_queue.push(msg);  // Pass by value to copy the message into queue
+            std::vector<VerilatedMsg>& queue = threadton().m_queue;
+            if (queue.empty()) Verilated::endOfEvalReqdInc();
+            queue.push_back(msg);  // Pass by value to copy the message into queue
         }
     }
     // Push all messages to the eval's queue
     static void flush(VerilatedEvalMsgQueue* evalMsgQp) VL_MT_SAFE {
-        while (!threadton().m_queue.empty()) {
-            evalMsgQp->post(threadton().m_queue.front());
-            threadton().m_queue.pop();
-            Verilated::endOfEvalReqdDec();
-        }
+        std::vector<VerilatedMsg>& queue = threadton().m_queue;
+        if (queue.empty()) return;
+        evalMsgQp->post(queue);
+        Verilated::endOfEvalReqdDec();
     }
 };
 
@@ -207,6 +227,7 @@ protected:
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
     mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    uint64_t m_nameGeneration VL_GUARDED_BY(m_nameMutex) = 0;  // Bumped on m_nameMap change
 };
 
 //======================================================================
@@ -303,11 +324,13 @@ public:  // But only for verilated*.cpp
         return (idx | (1UL << 31));  // bit 31 indicates not MCD
     }
     void fdFlush(IData fdi) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
+        fdWriteFlushThread();
         const VerilatedLockGuard lock{m_fdMutex};
         const VerilatedFpList fdlist = fdToFpList(fdi);
         for (const auto& i : fdlist) std::fflush(i);
     }
     IData fdSeek(IData fdi, IData offset, IData origin) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
+        fdWriteFlushThread();
         const VerilatedLockGuard lock{m_fdMutex};
         const VerilatedFpList fdlist = fdToFpList(fdi);
         if (VL_UNLIKELY(fdlist.size() != 1)) return ~0U;  // -1
@@ -315,20 +338,57 @@ public:  // But only for verilated*.cpp
             std::fseek(*fdlist.begin(), static_cast<long>(offset), static_cast<int>(origin)));
     }
     IData fdTell(IData fdi) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
+        fdWriteFlushThread();
         const VerilatedLockGuard lock{m_fdMutex};
         const VerilatedFpList fdlist = fdToFpList(fdi);
         if (VL_UNLIKELY(fdlist.size() != 1)) return ~0U;  // -1
         return static_cast<IData>(std::ftell(*fdlist.begin()));
     }
     void fdWrite(IData fdi, const std::string& output) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
+        if (Verilated::mtaskId() && m_ns.m_fwriteBuffered) {
+            // Inside an mtask buffer per thread, so the descriptor lock and stdio
+            // locks are taken once per mtask, rather than for every write
+            FdWriteBuffer& buf = fdWriteBuffer();
+            if (VL_UNLIKELY(buf.m_ctxp != this)) {
+                fdWriteFlushThread();  // Writes for another context
+                buf.m_ctxp = this;
+            }
+            if (!buf.m_used) Verilated::endOfEvalReqdInc();  // Flush at end of mtask
+            if (buf.m_used && buf.m_writes[buf.m_used - 1].first == fdi) {
+                buf.m_writes[buf.m_used - 1].second += output;
+            } else {
+                if (buf.m_used == buf.m_writes.size()) buf.m_writes.emplace_back();
+                buf.m_writes[buf.m_used].first = fdi;
+                buf.m_writes[buf.m_used].second = output;
+                ++buf.m_used;
+            }
+            buf.m_bytes += output.size();
+            if (VL_UNLIKELY(buf.m_bytes >= FdWriteBuffer::MAX_BYTES)) fdWriteFlushThread();
+            return;
+        }
         const VerilatedLockGuard lock{m_fdMutex};
-        const VerilatedFpList fdlist = fdToFpList(fdi);
-        for (const auto& i : fdlist) {
-            if (VL_UNLIKELY(!i)) continue;
-            (void)fwrite(output.c_str(), 1, output.size(), i);
+        fdWriteLocked(fdi, output);
+    }
+    // Write out the calling thread's buffered $fwrite output, called at the end of
+    // each mtask and before other operations on files
+    static void fdWriteFlushThread() VL_MT_SAFE {
+        FdWriteBuffer& buf = fdWriteBuffer();
+        if (VL_LIKELY(!buf.m_used)) return;
+        VerilatedContextImp* const ctxp = buf.m_ctxp;
+        {
+            const VerilatedLockGuard lock{ctxp->m_fdMutex};
+            for (size_t i = 0; i < buf.m_used; ++i) {
+                ctxp->fdWriteLocked(buf.m_writes[i].first, buf.m_writes[i].second);
+            }
         }
+        // Keep the strings' capacity for the next mtask
+        for (size_t i = 0; i < buf.m_used; ++i) buf.m_writes[i].second.clear();
+        buf.m_used = 0;
+        buf.m_bytes = 0;
+        Verilated::endOfEvalReqdDec();
     }
     void fdClose(IData fdi) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
+        fdWriteFlushThread();
         const VerilatedLockGuard lock{m_fdMutex};
         if (VL_BITISSET_I(fdi, 31)) {
             // Non-MCD case
@@ -353,6 +413,7 @@ public:  // But only for verilated*.cpp
         }
     }
     FILE* fdToFp(IData fdi) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
+        fdWriteFlushThread();
         const VerilatedLockGuard lock{m_fdMutex};
         const VerilatedFpList fdlist = fdToFpList(fdi);
         if (VL_UNLIKELY(fdlist.size() != 1)) return nullptr;
@@ -360,6 +421,25 @@ public:  // But only for verilated*.cpp
     }
 
 private:
+    // $fwrite output buffered by the current thread while inside an mtask
+    struct FdWriteBuffer final {
+        static constexpr size_t MAX_BYTES = 64 * 1024;  // Write out early beyond this size
+        VerilatedContextImp* m_ctxp = nullptr;  // Context the writes are for
+        std::vector<std::pair<IData, std::string>> m_writes;  // Descriptor and output, in order
+        size_t m_used = 0;  // Entries of m_writes in use, the rest are kept for reuse
+        size_t m_bytes = 0;  // Total buffered output size
+    };
+    static FdWriteBuffer& fdWriteBuffer() VL_MT_SAFE {
+        static thread_local FdWriteBuffer t_s;
+        return t_s;
+    }
+    void fdWriteLocked(IData fdi, const std::string& output) VL_REQUIRES(m_fdMutex) {
+        const VerilatedFpList fdlist = fdToFpList(fdi);
+        for (const auto& i : fdlist) {
+            if (VL_UNLIKELY(!i)) continue;
+            (void)fwrite(output.c_str(), 1, output.size(), i);
+        }
+    }
     VerilatedFpList fdToFpList(IData fdi) VL_REQUIRES(m_fdMutex) {
         VerilatedFpList fp;
         // cppverilator-suppress integerOverflow shiftTooManyBitsSigned
@@ -38,6 +38,10 @@
 #  define VL_HAVE_AVX2 1
 #  include <immintrin.h>
 # endif
+# if defined(__ARM_NEON) && !defined(VL_DISABLE_NEON)
+#  define VL_HAVE_NEON 1
+#  include <arm_neon.h>
+# endif
 #endif
 
 // clang-format on
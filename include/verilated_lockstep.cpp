@@ -0,0 +1,218 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated multi-model lockstep scheduler implementation code
+///
+/// This file must be compiled and linked into the executable when it uses
+/// VerilatedLockstep.
+///
+//=============================================================================
+
+#define VERILATOR_VERILATED_LOCKSTEP_CPP_
+
+#include "verilatedos.h"
+
+#include "verilated_lockstep.h"
+
+#include "verilated.h"
+#include "verilated_syms.h"
+#include "verilated_threads.h"
+
+#include <algorithm>
+#include <cstring>
+
+//=============================================================================
+// VerilatedLockstep
+
+size_t VerilatedLockstep::bytesOf(uint32_t bits) {
+    if (bits <= 8) return sizeof(CData);
+    if (bits <= 16) return sizeof(SData);
+    if (bits <= VL_IDATASIZE) return sizeof(IData);
+    if (bits <= VL_QUADSIZE) return sizeof(QData);
+    return VL_WORDS_I(bits) * sizeof(EData);
+}
+
+void VerilatedLockstep::evalTask(void* modelp, bool) { static_cast<Model*>(modelp)->eval(); }
+
+uint32_t VerilatedLockstep::checkModel(uint32_t model, const char* funcp) const {
+    if (VL_UNLIKELY(model >= m_models.size())) {
+        const std::string msg = std::string{"VerilatedLockstep::"} + funcp
+                                + " called with unknown model index " + std::to_string(model);
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    return model;
+}
+
+uint32_t VerilatedLockstep::addModel(VerilatedModel* modelp, std::function<void()> eval) {
+    m_models.emplace_back();
+    m_models.back().modelp = modelp;
+    m_models.back().eval = std::move(eval);
+    m_levelsValid = false;
+    return static_cast<uint32_t>(m_models.size() - 1);
+}
+
+void VerilatedLockstep::addInput(uint32_t model, const void* datap, uint32_t bits) {
+    checkModel(model, "addInput");
+    const size_t bytes = bytesOf(bits);
+    std::vector<char> last(bytes);
+    std::memcpy(last.data(), datap, bytes);
+    m_inputs.push_back({model, datap, bytes, std::move(last)});
+}
+
+void VerilatedLockstep::connect(uint32_t from, const void* fromp, uint32_t to, void* top,
+                                uint32_t bits) {
+    checkModel(from, "connect");
+    checkModel(to, "connect");
+    m_models[from].conns.push_back(static_cast<uint32_t>(m_conns.size()));
+    m_conns.push_back({to, fromp, top, bytesOf(bits)});
+    m_levelsValid = false;
+}
+
+const VerilatedVar* VerilatedLockstep::scopeVar(uint32_t model, const std::string& scopeName,
+                                                const std::string& varName) const {
+    VerilatedContext* const contextp = m_models[checkModel(model, "connect")].modelp->contextp();
+    const VerilatedScope* const scopep = contextp->scopeFind(scopeName.c_str());
+    const VerilatedVar* const varp = scopep ? scopep->varFind(varName.c_str()) : nullptr;
+    if (!varp || varp->udims() != 0 || varp->vltype() < VLVT_UINT8
+        || varp->vltype() > VLVT_WDATA) {
+        const std::string msg = "VerilatedLockstep cannot find public packed variable '"
+                                + scopeName + "." + varName + "'";
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    return varp;
+}
+
+void VerilatedLockstep::connect(uint32_t from, const std::string& fromScope,
+                                const std::string& fromVar, uint32_t to,
+                                const std::string& toScope, const std::string& toVar) {
+    const VerilatedVar* const fromVarp = scopeVar(from, fromScope, fromVar);
+    const VerilatedVar* const toVarp = scopeVar(to, toScope, toVar);
+    if (fromVarp->entBits() != toVarp->entBits()) {
+        const std::string msg = "VerilatedLockstep cannot connect '" + fromScope + "."
+                                + fromVar + "' of width " + std::to_string(fromVarp->entBits())
+                                + " to '" + toScope + "." + toVar + "' of width "
+                                + std::to_string(toVarp->entBits());
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    connect(from, fromVarp->datap(), to, toVarp->datap(), fromVarp->entBits());
+}
+
+void VerilatedLockstep::computeLevels() {
+    // Longest path from the models only the harness drives.  A model in a
+    // loop would rise forever, so levels are capped at the model count;
+    // the loop then settles by repeated passes in eval().
+    const uint32_t maxLevel = static_cast<uint32_t>(m_models.size()) - 1;
+    for (Model& model : m_models) model.level = 0;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (const Model& model : m_models) {
+            if (model.level == maxLevel) continue;
+            for (const uint32_t conn : model.conns) {
+                Model& toModel = m_models[m_conns[conn].to];
+                if (toModel.level > model.level) continue;
+                toModel.level = model.level + 1;
+                changed = true;
+            }
+        }
+    }
+    m_levels.clear();
+    for (uint32_t i = 0; i < m_models.size(); ++i) {
+        const uint32_t level = m_models[i].level;
+        if (level >= m_levels.size()) m_levels.resize(level + 1);
+        m_levels[level].push_back(i);
+    }
+    m_levelsValid = true;
+}
+
+void VerilatedLockstep::evalBatch() {
+    for (const uint32_t model : m_batch) {
+        m_models[model].dirty = false;
+        ++m_models[model].evals;
+    }
+    // A model Verilated with threads needs the pool for its own evaluation,
+    // and would wait forever on tasks queued behind it if run on a worker
+    VlThreadPool* const poolp
+        = m_batch.size() > 1 ? static_cast<VlThreadPool*>(m_contextp->threadPoolp()) : nullptr;
+    const bool parallel
+        = poolp && std::all_of(m_batch.begin(), m_batch.end(), [this](uint32_t model) {
+              return m_models[model].modelp->threads() == 1;
+          });
+    if (!parallel) {
+        for (const uint32_t model : m_batch) m_models[model].eval();
+        return;
+    }
+    // The calling thread evaluates the first model while the workers evaluate the rest
+    const size_t workers
+        = std::min(m_batch.size() - 1, static_cast<size_t>(poolp->numThreads()));
+    m_workers.resize(workers);
+    poolp->assignWorkerIndexes(workers, m_workers.data());
+    for (size_t i = 1; i < m_batch.size(); ++i) {
+        poolp->workerp(static_cast<int>(m_workers[(i - 1) % workers]))
+            ->addTask(evalTask, &m_models[m_batch[i]]);
+    }
+    m_models[m_batch[0]].eval();
+    for (const size_t worker : m_workers) poolp->workerp(static_cast<int>(worker))->wait();
+    poolp->freeWorkerIndexes(workers, m_workers.data());
+}
+
+void VerilatedLockstep::propagate() {
+    for (const uint32_t model : m_batch) {
+        for (const uint32_t conn : m_models[model].conns) {
+            const Connection& c = m_conns[conn];
+            if (std::memcmp(c.top, c.fromp, c.bytes) == 0) continue;
+            std::memcpy(c.top, c.fromp, c.bytes);
+            m_models[c.to].dirty = true;
+        }
+    }
+}
+
+void VerilatedLockstep::eval() {
+    if (!m_levelsValid) computeLevels();
+    for (Input& input : m_inputs) {
+        if (std::memcmp(input.last.data(), input.datap, input.bytes) == 0) continue;
+        std::memcpy(input.last.data(), input.datap, input.bytes);
+        m_models[input.model].dirty = true;
+    }
+    // Evaluate all models the harness changed before moving any connection,
+    // so e.g. flops clocked in several models all sample the same values
+    m_batch.clear();
+    for (uint32_t i = 0; i < m_models.size(); ++i) {
+        if (m_models[i].dirty) m_batch.push_back(i);
+    }
+    evalBatch();
+    propagate();
+    // Then settle the connections in dependency order, each loop through
+    // the models costing another pass
+    for (uint32_t pass = 0;; ++pass) {
+        bool evaluated = false;
+        for (const std::vector<uint32_t>& level : m_levels) {
+            m_batch.clear();
+            for (const uint32_t model : level) {
+                if (m_models[model].dirty) m_batch.push_back(model);
+            }
+            if (m_batch.empty()) continue;
+            if (VL_UNLIKELY(pass == m_convergeLimit)) {
+                const std::string msg = "VerilatedLockstep connections did not converge after "
+                                        + std::to_string(pass) + " passes, model '"
+                                        + m_models[m_batch[0]].modelp->hierName()
+                                        + "' is in a combinational loop";
+                VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+            }
+            evaluated = true;
+            evalBatch();
+            propagate();
+        }
+        if (!evaluated) return;
+    }
+}
@@ -0,0 +1,140 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated multi-model lockstep scheduler
+///
+/// Evaluates several separately Verilated models whose ports are wired
+/// together, replacing harness glue code that calls every model's eval()
+/// until the connected signals stop changing.
+///
+/// Each eval() first evaluates together every model whose harness driven
+/// inputs changed, so all see their inputs as they were before any other
+/// model reacted, as nonblocking assignments would.  Connections out of
+/// those models are then copied, and models whose connected inputs
+/// changed are evaluated again in dependency order until all settle.
+/// Models that are not affected are not evaluated.
+///
+/// Models at the same dependency level are evaluated in parallel on the
+/// context's thread pool, when every one of them was Verilated with
+/// --threads 1, so their own evaluation does not need the pool.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_LOCKSTEP_H_
+#define VERILATOR_VERILATED_LOCKSTEP_H_
+
+#include "verilatedos.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+class VerilatedContext;
+class VerilatedModel;
+class VerilatedVar;
+
+//=============================================================================
+// VerilatedLockstep
+
+/// Evaluates connected Verilated models in dependency order.
+///
+/// Register the models with addModel(), the signals the harness drives
+/// with addInput(), and the signals between models with connect(), then
+/// call eval() wherever the harness would have evaluated the models.
+///
+/// This class is not thread safe, it must be called by a single thread.
+
+class VerilatedLockstep final {
+    // TYPES
+    struct Model final {
+        VerilatedModel* modelp;
+        std::function<void()> eval;  // Evaluate model
+        std::vector<uint32_t> conns;  // Connections driven by this model
+        uint32_t level = 0;  // Dependency level, 0 if driven only by the harness
+        bool dirty = true;  // Needs evaluation, initially set so all evaluate once
+        uint64_t evals = 0;  // Number of evaluations, for statistics
+    };
+    struct Input final {
+        uint32_t model;
+        const void* datap;
+        size_t bytes;
+        std::vector<char> last;  // Value when last evaluated
+    };
+    struct Connection final {
+        uint32_t to;
+        const void* fromp;
+        void* top;
+        size_t bytes;
+    };
+
+    // MEMBERS
+    VerilatedContext* const m_contextp;  // Context providing the thread pool
+    std::vector<Model> m_models;  // Registered models, by index
+    std::vector<Input> m_inputs;  // Harness driven inputs
+    std::vector<Connection> m_conns;  // Connections between models
+    std::vector<std::vector<uint32_t>> m_levels;  // Models at each dependency level
+    std::vector<uint32_t> m_batch;  // Models being evaluated, reused to avoid allocation
+    std::vector<size_t> m_workers;  // Thread pool workers assigned to m_batch
+    uint32_t m_convergeLimit = 100;  // Maximum passes for connections to settle
+    bool m_levelsValid = false;  // m_levels is up to date with m_conns
+
+    VL_UNCOPYABLE(VerilatedLockstep);
+
+    static size_t bytesOf(uint32_t bits);
+    static void evalTask(void* modelp, bool);
+    uint32_t checkModel(uint32_t model, const char* funcp) const;
+    const VerilatedVar* scopeVar(uint32_t model, const std::string& scopeName,
+                                 const std::string& varName) const;
+    void computeLevels();
+    void evalBatch();
+    void propagate();
+
+public:
+    /// Construct, using the thread pool of 'contextp' to evaluate
+    /// independent models in parallel
+    explicit VerilatedLockstep(VerilatedContext* contextp)
+        : m_contextp{contextp} {}
+    ~VerilatedLockstep() = default;
+
+    /// Register a model, calling 'eval' to evaluate it.  Returns its index.
+    uint32_t addModel(VerilatedModel* modelp, std::function<void()> eval);
+    /// Register a model evaluated with its eval() method.  Returns its index.
+    template <typename T_Model>
+    uint32_t addModel(T_Model* modelp) {
+        return addModel(modelp, [modelp] { modelp->eval(); });
+    }
+    /// Register an input of 'model' of 'bits' width stored at 'datap',
+    /// that the harness writes, so the model is evaluated when it changes.
+    /// The data is in the Verilated representation for that width (CData,
+    /// SData, IData, QData or VlWide).
+    void addInput(uint32_t model, const void* datap, uint32_t bits);
+    /// Connect the output of model 'from' at 'fromp' to the input of
+    /// model 'to' at 'top', both of 'bits' width
+    void connect(uint32_t from, const void* fromp, uint32_t to, void* top, uint32_t bits);
+    /// Connect public variables found by scope and name, as VPI would
+    void connect(uint32_t from, const std::string& fromScope, const std::string& fromVar,
+                 uint32_t to, const std::string& toScope, const std::string& toVar);
+    /// Evaluate 'model' on the next eval() even if its inputs are
+    /// unchanged, e.g. as it has timed events pending
+    void markDirty(uint32_t model) { m_models.at(model).dirty = true; }
+    /// Set the maximum passes for combinational loops through the models
+    /// to settle before eval() fails
+    void convergeLimit(uint32_t limit) { m_convergeLimit = limit; }
+    /// Evaluate the models affected by changed inputs, until connections settle
+    void eval();
+    /// Return the number of times 'model' was evaluated
+    uint64_t evalCount(uint32_t model) const { return m_models.at(model).evals; }
+};
+
+#endif  // Guard
@@ -22,6 +22,7 @@
 
 #include "verilated_threads.h"
 
+#include <algorithm>
 #include <fstream>
 #include <string>
 
@@ -70,7 +71,7 @@ void VlExecutionProfiler::configure() {
 
     const uint64_t startReq = m_context.profExecStart() + 1;  // + 1, so we can start at time 0
 
-    if (VL_UNLIKELY(m_lastStartReq < startReq && VL_TIME_Q() >= m_context.profExecStart())) {
+    if (VL_UNLIKELY(m_lastStartReq < startReq && m_context.time() >= m_context.profExecStart())) {
         VL_DEBUG_IF(VL_DBG_MSGF("+ profile start warmup\n"););
         VL_DEBUG_IF(assert(m_windowCount == 0););
         m_enabled = true;
@@ -106,13 +107,16 @@ VerilatedVirtualBase* VlExecutionProfiler::construct(VerilatedContext& context)
 
 void VlExecutionProfiler::setupThread(uint32_t threadId) {
     // Reserve some space in the thread-local profiling buffer, in order to try to avoid malloc
-    // while profiling.
+    // while profiling. Workers are already pinned at this point, so with first-touch page
+    // placement the buffer lands on the worker's NUMA node.
     t_trace.reserve(RESERVED_TRACE_CAPACITY);
+    const std::string placement = VlThreadPool::currentPlacement();
     // Register thread-local buffer in list of all buffers
     bool exists;
     {
         const VerilatedLockGuard lock{m_mutex};
         exists = !m_traceps.emplace(threadId, &t_trace).second;
+        m_placements.emplace(threadId, placement);
     }
     if (VL_UNLIKELY(exists)) {
         VL_FATAL_MT(__FILE__, __LINE__, "", "multiple initialization of profiler on some thread");
@@ -145,11 +149,21 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     fprintf(fp, "VLPROF arg +verilator+prof+exec+window+%u\n",
             Verilated::threadContextp()->profExecWindow());
     std::string numa = "no threads";
+    uint64_t spinHits = 0;
+    uint64_t parks = 0;
     if (VlThreadPool* const threadPoolp
         = static_cast<VlThreadPool*>(Verilated::threadContextp()->threadPoolp())) {
         numa = threadPoolp->numaStatus();
+        spinHits = threadPoolp->statSpinHits();
+        parks = threadPoolp->statParks();
     }
     fprintf(fp, "VLPROF info numa %s\n", numa.c_str());
+    std::string placements;
+    for (const auto& pair : m_placements) {
+        if (!placements.empty()) placements += ' ';
+        placements += std::to_string(pair.first) + ":" + pair.second;
+    }
+    if (!placements.empty()) fprintf(fp, "VLPROF info placement %s\n", placements.c_str());
     // Note that VerilatedContext will by default create as many threads as there are hardware
     // processors, but not all of them might be utilized. Report the actual number that has trace
     // entries to avoid over-counting.
@@ -159,6 +173,8 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     }
     fprintf(fp, "VLPROF stat threads %u\n", threads);
     fprintf(fp, "VLPROF stat yields %" PRIu64 "\n", VlMTaskVertex::yields());
+    fprintf(fp, "VLPROF stat spinhits %" PRIu64 "\n", spinHits);
+    fprintf(fp, "VLPROF stat parks %" PRIu64 "\n", parks);
 
     // Copy /proc/cpuinfo into this output so verilator_gantt can be run on
     // a different machine
@@ -204,7 +220,16 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
                 fprintf(fp, " predictCost %u\n", payload.m_predictCost);
                 break;
             }
-            case VlExecutionRecord::Type::THREAD_SCHEDULE_WAIT_BEGIN:
+            case VlExecutionRecord::Type::THREAD_SCHEDULE_WAIT_BEGIN: {
+                const auto& payload = er.m_payload.threadScheduleWait;
+                if (payload.m_upstream[0] != '\0') {
+                    fprintf(fp, " cpu %u id %u upstream %s\n", payload.m_cpu, payload.m_id,
+                            payload.m_upstream);
+                } else {
+                    fprintf(fp, " cpu %u\n", payload.m_cpu);
+                }
+                break;
+            }
             case VlExecutionRecord::Type::THREAD_SCHEDULE_WAIT_END: {
                 const auto& payload = er.m_payload.threadScheduleWait;
                 fprintf(fp, " cpu %u\n", payload.m_cpu);
@@ -223,3 +248,86 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
 
     std::fclose(fp);
 }
+
+//=============================================================================
+// VlStartupProfiler implementation
+
+void VlStartupProfiler::write(const char* modelp, const std::string& execFilename) VL_MT_SAFE {
+    static VerilatedMutex s_mutex;
+    const VerilatedLockGuard lock{s_mutex};
+
+    // Written next to profile_exec.dat.  The first model creates the file, later
+    // models in the same executable append, as with VlPgoProfiler.
+    static bool s_firstCall = true;
+    const std::string::size_type slash = execFilename.rfind('/');
+    const std::string filename
+        = (slash == std::string::npos ? "" : execFilename.substr(0, slash + 1))
+          + "profile_startup.dat";
+
+    VL_DEBUG_IF(VL_DBG_MSGF("+prof+startup writing to '%s'\n", filename.c_str()););
+
+    FILE* const fp = std::fopen(filename.c_str(), s_firstCall ? "w" : "a");
+    if (VL_UNLIKELY(!fp)) VL_FATAL_MT(filename.c_str(), 0, "", "--prof-startup file not writable");
+    if (s_firstCall) {
+        fprintf(fp, "// Verilated model startup profile, written by --prof-startup\n");
+        fprintf(fp, "// Phases nest, so a phase's time includes the phases run within it\n");
+    }
+    s_firstCall = false;
+
+    // Slowest phases first
+    std::vector<std::pair<std::string, Record>> records{m_records.begin(), m_records.end()};
+    std::stable_sort(records.begin(), records.end(), [](const auto& a, const auto& b) {
+        return a.second.m_ns != b.second.m_ns ? a.second.m_ns > b.second.m_ns
+                                              : a.first < b.first;
+    });
+    fprintf(fp, "model %s\n", modelp);
+    fprintf(fp, "  %12s %8s  %s\n", "usec", "count", "phase");
+    for (const auto& it : records) {
+        fprintf(fp, "  %12.3f %8" PRIu64 "  %s\n", it.second.m_ns / 1000.0, it.second.m_count,
+                it.first.c_str());
+    }
+
+    std::fclose(fp);
+}
+
+//=============================================================================
+// VlRegionProfiler implementation
+
+void VlRegionProfiler::write(const char* modelp, const std::string& execFilename) const
+    VL_MT_SAFE {
+    static VerilatedMutex s_mutex;
+    const VerilatedLockGuard lock{s_mutex};
+
+    // Written next to profile_exec.dat, as with VlStartupProfiler
+    static bool s_firstCall = true;
+    const std::string::size_type slash = execFilename.rfind('/');
+    const std::string filename
+        = (slash == std::string::npos ? "" : execFilename.substr(0, slash + 1))
+          + "profile_regions.dat";
+
+    VL_DEBUG_IF(VL_DBG_MSGF("+prof+regions writing to '%s'\n", filename.c_str()););
+
+    FILE* const fp = std::fopen(filename.c_str(), s_firstCall ? "w" : "a");
+    if (VL_UNLIKELY(!fp)) VL_FATAL_MT(filename.c_str(), 0, "", "--prof-regions file not writable");
+    if (s_firstCall) {
+        fprintf(fp, "// Verilated model eval region profile, written by --prof-regions\n");
+        fprintf(fp, "// A region's time excludes the regions nested within it\n");
+    }
+    s_firstCall = false;
+
+    // Largest regions first
+    std::vector<std::pair<std::string, uint64_t>> records = ticks();
+    uint64_t total = 0;
+    for (const auto& it : records) total += it.second;
+    std::stable_sort(records.begin(), records.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    fprintf(fp, "model %s\n", modelp);
+    fprintf(fp, "  %16s %7s  %s\n", "ticks", "%", "region");
+    for (const auto& it : records) {
+        fprintf(fp, "  %16" PRIu64 " %7.2f  %s\n", it.second,
+                total ? 100.0 * it.second / total : 0.0, it.first.c_str());
+    }
+
+    std::fclose(fp);
+}
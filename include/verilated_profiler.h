@@ -29,8 +29,11 @@
 #include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstring>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 class VlExecutionProfiler;
@@ -99,6 +102,8 @@ class VlExecutionRecord final {
         } mtaskEnd;
         struct {
             uint32_t m_cpu;  // Executing CPU id
+            uint32_t m_id;  // MTask id waiting, if m_upstream is not empty
+            const char* m_upstream;  // Comma separated cross-thread upstream MTask ids
         } threadScheduleWait;
     };
 
@@ -131,8 +136,10 @@ public:
         m_payload.mtaskEnd.m_predictCost = predictCost;
         m_type = Type::MTASK_END;
     }
-    void threadScheduleWaitBegin() {
+    void threadScheduleWaitBegin(uint32_t id = 0, const char* upstream = "") {
         m_payload.threadScheduleWait.m_cpu = VlOs::getcpu();
+        m_payload.threadScheduleWait.m_id = id;
+        m_payload.threadScheduleWait.m_upstream = upstream;
         m_type = Type::THREAD_SCHEDULE_WAIT_BEGIN;
     }
     void threadScheduleWaitEnd() {
@@ -172,6 +179,8 @@ class VlExecutionProfiler final : public VerilatedVirtualBase {
     mutable VerilatedMutex m_mutex;
     // Map from thread id to &t_trace of given thread
     std::map<uint32_t, ExecutionTrace*> m_traceps VL_GUARDED_BY(m_mutex);
+    // Map from thread id to CPU and NUMA node the thread was set up on
+    std::map<uint32_t, std::string> m_placements VL_GUARDED_BY(m_mutex);
 
     bool m_enabled = false;  // Is profiling currently enabled
 
@@ -209,38 +218,57 @@ public:
 //=============================================================================
 // VlPgoProfiler is for collecting profiling data for PGO
 
-template <std::size_t N_Entries>
+template <std::size_t N_Entries, std::size_t N_Counts = 0>
 class VlPgoProfiler final {
     // TYPES
     struct Record final {
         const std::string m_name;  // Hashed name of mtask/etc
         const size_t m_counterNumber = 0;  // Which counter has data
     };
+    struct ShareRecord final {
+        const std::string m_name;  // Hashed name of statement
+        const size_t m_counterNumber = 0;  // Which counter has data
+        const double m_share = 0.0;  // Fraction of the counter's time attributed to this
+    };
 
     // Counters are stored packed, all together to reduce cache effects
     std::array<uint64_t, N_Entries> m_counters;  // Time spent on this record
+    std::array<uint64_t, N_Counts> m_counts;  // Executions of this count record
     std::vector<Record> m_records;  // Record information
+    std::vector<Record> m_countRecords;  // Count record information
+    std::vector<ShareRecord> m_shareRecords;  // Share of counter record information
 
 public:
     // METHODS
-    VlPgoProfiler() = default;
+    VlPgoProfiler() { m_counts.fill(0); }
     ~VlPgoProfiler() = default;
     void write(const char* modelp, const std::string& filename, bool firstHierCall) VL_MT_SAFE;
     void addCounter(size_t counter, const std::string& name) {
         VL_DEBUG_IF(assert(counter < N_Entries););
         m_records.emplace_back(Record{name, counter});
     }
+    // Also report a share of a counter's time, for matching to changed mtasks
+    void addCounterShare(size_t counter, const std::string& name, double share) {
+        VL_DEBUG_IF(assert(counter < N_Entries););
+        m_shareRecords.emplace_back(ShareRecord{name, counter, share});
+    }
     void startCounter(size_t counter) {
         // -= so when we add end time in stopCounter, the net effect is adding the difference,
         // without needing to hold onto a temporary
         m_counters[counter] -= VL_CPU_TICK();
     }
     void stopCounter(size_t counter) { m_counters[counter] += VL_CPU_TICK(); }
+    void addCount(size_t count, const std::string& name) {
+        VL_DEBUG_IF(assert(count < N_Counts););
+        m_countRecords.emplace_back(Record{name, count});
+    }
+    // Each count is only incremented from one place in the model, so needs no lock
+    void incCount(size_t count) { ++m_counts[count]; }
 };
 
-template <std::size_t N_Entries>
-void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& filename,
-                                     bool firstHierCall) VL_MT_SAFE {
+template <std::size_t N_Entries, std::size_t N_Counts>
+void VlPgoProfiler<N_Entries, N_Counts>::write(const char* modelp, const std::string& filename,
+                                               bool firstHierCall) VL_MT_SAFE {
     static VerilatedMutex s_mutex;
     const VerilatedLockGuard lock{s_mutex};
 
@@ -271,8 +299,126 @@ void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& file
         fprintf(fp, "profile_data -model \"%s\" -mtask \"%s\" -cost 64'd%" PRIu64 "\n", modelp,
                 rec.m_name.c_str(), m_counters[rec.m_counterNumber]);
     }
+    for (const ShareRecord& rec : m_shareRecords) {
+        const uint64_t cost
+            = static_cast<uint64_t>(static_cast<double>(m_counters[rec.m_counterNumber])
+                                    * rec.m_share);
+        fprintf(fp, "profile_data -model \"%s\" -mtask \"%s\" -cost 64'd%" PRIu64 "\n", modelp,
+                rec.m_name.c_str(), cost);
+    }
+    for (const Record& rec : m_countRecords) {
+        fprintf(fp, "profile_data -model \"%s\" -mtask \"%s\" -cost 64'd%" PRIu64 "\n", modelp,
+                rec.m_name.c_str(), m_counts[rec.m_counterNumber]);
+    }
 
     std::fclose(fp);
 }
 
+//=============================================================================
+// VlStartupProfiler is for timing model construction and the initial evaluation
+
+class VlStartupProfiler final {
+    // TYPES
+    struct Record final {
+        uint64_t m_ns = 0;  // Total time spent, including nested phases
+        uint64_t m_count = 0;  // Number of times the phase ran
+    };
+
+    // MEMBERS
+    std::vector<uint64_t> m_starts;  // Start times of the phases being timed
+    std::unordered_map<std::string, Record> m_records;  // Time spent in each phase
+
+public:
+    // METHODS
+    // Construction of the profiler starts the "construct" phase, see Syms
+    VlStartupProfiler() { push(); }
+    ~VlStartupProfiler() = default;
+    static uint64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+    void push() { m_starts.push_back(nowNs()); }
+    void pop(const char* namep) {
+        VL_DEBUG_IF(assert(!m_starts.empty()););
+        Record& rec = m_records[namep];
+        rec.m_ns += nowNs() - m_starts.back();
+        ++rec.m_count;
+        m_starts.pop_back();
+    }
+    void write(const char* modelp, const std::string& execFilename) VL_MT_SAFE;
+};
+
+//=============================================================================
+// VlRegionProfiler is for timing the scheduling regions of the eval loop, with --prof-regions
+//
+// Regions are pushed and popped from the thread calling eval, and time is accounted to the
+// innermost region, so each region's time excludes the regions nested within it.
+
+class VlRegionProfiler final {
+    // MEMBERS
+    VerilatedContext* const m_contextp;  // Context this profiler is registered with
+    std::vector<std::pair<const char*, uint64_t>> m_ticks;  // Self time of each region
+    std::vector<size_t> m_stack;  // Indices into m_ticks of the regions being timed
+    uint64_t m_lastTick = 0;  // Tick at the last push or pop
+
+    // METHODS
+    size_t index(const char* namep) {
+        // Names are literals, but the same name may have different addresses in each object
+        for (size_t i = 0; i < m_ticks.size(); ++i) {
+            if (m_ticks[i].first == namep) return i;
+        }
+        for (size_t i = 0; i < m_ticks.size(); ++i) {
+            if (!std::strcmp(m_ticks[i].first, namep)) return i;
+        }
+        m_ticks.emplace_back(namep, 0);
+        return m_ticks.size() - 1;
+    }
+    void account(uint64_t now) {
+        if (!m_stack.empty()) m_ticks[m_stack.back()].second += now - m_lastTick;
+        m_lastTick = now;
+    }
+
+public:
+    // Times the enclosing block as a region, if the context has a region profiler
+    class Guard final {
+        VlRegionProfiler* const m_profilerp;
+
+    public:
+        Guard(const VerilatedContext* contextp, const char* namep)
+            : m_profilerp{contextp ? contextp->regionProfilerp() : nullptr} {
+            if (VL_UNLIKELY(m_profilerp)) m_profilerp->push(namep);
+        }
+        ~Guard() {
+            if (VL_UNLIKELY(m_profilerp)) m_profilerp->pop();
+        }
+        VL_UNCOPYABLE(Guard);
+    };
+
+    // CONSTRUCTORS
+    explicit VlRegionProfiler(VerilatedContext* contextp)
+        : m_contextp{contextp} {
+        m_contextp->regionProfilerp(this);
+    }
+    ~VlRegionProfiler() {
+        if (m_contextp->regionProfilerp() == this) m_contextp->regionProfilerp(nullptr);
+    }
+
+    // METHODS
+    void push(const char* namep) {
+        account(VL_CPU_TICK());
+        m_stack.push_back(index(namep));
+    }
+    void pop() {
+        VL_DEBUG_IF(assert(!m_stack.empty()););
+        account(VL_CPU_TICK());
+        m_stack.pop_back();
+    }
+    // Ticks spent in each region so far, excluding the regions nested within it
+    std::vector<std::pair<std::string, uint64_t>> ticks() const {
+        return {m_ticks.begin(), m_ticks.end()};
+    }
+    void write(const char* modelp, const std::string& execFilename) const VL_MT_SAFE;
+};
+
 #endif
@@ -43,6 +43,10 @@
 #if defined(_WIN32) || defined(__MINGW32__)
 # include <io.h>  // open, read, write, close
 #endif
+
+#ifdef VL_SOLVER_Z3  // Define, and link with -lz3, to solve in-process with the Z3 library
+# include <z3.h>
+#endif
 // clang-format on
 
 class Process final : private std::streambuf, public std::iostream {
@@ -212,7 +216,79 @@ public:
     }
 };
 
-static Process& getSolver() {
+#ifdef VL_SOLVER_Z3
+class Z3Solver final : private std::streambuf, public std::iostream {
+    // In-process solver with the same SMT-LIB text interface as a Process running a solver.
+    // Commands written are evaluated by the Z3 library when the response is read.
+    static constexpr int BUFFER_SIZE = 4096;
+    Z3_context m_ctx;  // Z3 context, keeps declarations and assertions between commands
+    std::string m_commands;  // Commands written and not yet evaluated
+    std::string m_response;  // Response of last evaluated commands
+    char m_writeBuf[BUFFER_SIZE];
+
+public:
+    typedef std::streambuf::traits_type traits_type;
+
+private:
+    static void errorHandler(Z3_context, Z3_error_code) {
+        // Errors are also reported in the response text, which the caller checks
+    }
+
+protected:
+    int overflow(int c = traits_type::eof()) override {
+        m_commands.append(pbase(), pptr() - pbase());
+        setp(std::begin(m_writeBuf), std::end(m_writeBuf));
+        if (c != traits_type::eof()) m_commands += static_cast<char>(c);
+        return 0;
+    }
+    int underflow() override {
+        sync();
+        if (m_commands.empty()) return traits_type::eof();
+        m_response = Z3_eval_smtlib2_string(m_ctx, m_commands.c_str());
+        m_commands.clear();
+        if (m_response.empty()) return traits_type::eof();
+        setg(&m_response[0], &m_response[0], &m_response[0] + m_response.size());
+        return traits_type::to_int_type(m_response[0]);
+    }
+    int sync() override {
+        overflow();
+        return 0;
+    }
+
+public:
+    Z3Solver()
+        : std::streambuf{}
+        , std::iostream{this} {
+        const Z3_config cfg = Z3_mk_config();
+        m_ctx = Z3_mk_context(cfg);
+        Z3_del_config(cfg);
+        Z3_set_error_handler(m_ctx, errorHandler);
+        setp(std::begin(m_writeBuf), std::end(m_writeBuf));
+        setg(m_writeBuf, m_writeBuf, m_writeBuf);
+    }
+    ~Z3Solver() override { Z3_del_context(m_ctx); }
+};
+
+static std::iostream& getSolver() {
+    static Z3Solver s_solver;
+    static bool s_done = false;
+    if (s_done) return s_solver;
+    s_done = true;
+
+    s_solver << "(set-logic QF_ABV)\n";
+    s_solver << "(check-sat)\n";
+    s_solver << "(reset)\n";
+    std::string s;
+    getline(s_solver, s);
+    if (s != "sat") {
+        const std::string str = "Unable to solve with the linked Z3 library: " + s + "\n";
+        VL_WARN_MT("", 0, "randomize", str.c_str());
+        s_solver.setstate(std::ios::failbit);
+    }
+    return s_solver;
+}
+#else
+static std::iostream& getSolver() {
     static Process s_solver;
     static bool s_done = false;
     if (s_done) return s_solver;
@@ -250,6 +326,18 @@ static Process& getSolver() {
     while (getline(s_solver, s)) {}
     return s_solver;
 }
+#endif
+
+// Problem loaded in the solver, as a stack of (push) levels: one for the variable declarations,
+// then one per constraint. Like the solver this is shared by all randomizers, and a call only
+// replaces the levels from the first constraint that differs from the previous call.
+struct VlSolverLoaded final {
+    bool m_valid = false;  // Solver options set, and levels below match the solver
+    size_t m_depth = 0;  // Number of levels pushed
+    std::string m_declarations;  // Declarations in the first level
+    std::vector<std::string> m_constraints;  // Constraint in each following level
+};
+static VlSolverLoaded s_solverLoaded;
 
 std::string readUntilBalanced(std::istream& stream) {
     std::string result;
@@ -370,29 +458,59 @@ bool VlRandomizer::next(VlRNG& rngr) {
     std::iostream& f = getSolver();
     if (!f) return false;
 
-    f << "(set-option :produce-models true)\n";
-    f << "(set-logic QF_ABV)\n";
-    f << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
-    f << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+    VlSolverLoaded& loaded = s_solverLoaded;
+    if (!loaded.m_valid) {
+        f << "(reset)\n";
+        f << "(set-option :produce-models true)\n";
+        f << "(set-logic QF_ABV)\n";
+        f << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
+        f << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+        loaded.m_valid = true;
+        loaded.m_depth = 0;
+    }
+    std::ostringstream declss;
     for (const auto& var : m_vars) {
         if (var.second->dimension() > 0) {
             auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
             var.second->setArrayInfo(arrVarsp);
         }
-        f << "(declare-fun " << var.first << " () ";
-        var.second->emitType(f);
-        f << ")\n";
+        declss << "(declare-fun " << var.first << " () ";
+        var.second->emitType(declss);
+        declss << ")\n";
+    }
+    std::string declarations = declss.str();
+
+    // Keep the levels that are unchanged since the previous call
+    size_t keep = 0;
+    if (loaded.m_depth && loaded.m_declarations == declarations) {
+        keep = 1;
+        while (keep < loaded.m_depth && keep <= m_constraints.size()
+               && loaded.m_constraints[keep - 1] == m_constraints[keep - 1]) {
+            ++keep;
+        }
     }
-    for (const std::string& constraint : m_constraints) {
-        f << "(assert (= #b1 " << constraint << "))\n";
+    if (loaded.m_depth > keep) f << "(pop " << (loaded.m_depth - keep) << ")\n";
+    if (!keep) {
+        f << "(push 1)\n" << declarations;
+        loaded.m_declarations = std::move(declarations);
+        keep = 1;
     }
+    loaded.m_constraints.resize(keep - 1);
+    for (size_t i = keep - 1; i < m_constraints.size(); ++i) {
+        f << "(push 1)\n";
+        f << "(assert (= #b1 " << m_constraints[i] << "))\n";
+        loaded.m_constraints.push_back(m_constraints[i]);
+    }
+    loaded.m_depth = 1 + loaded.m_constraints.size();
     f << "(check-sat)\n";
 
     bool sat = parseSolution(f);
     if (!sat) {
-        f << "(reset)\n";
+        // Unsatisfiable is rare, so just restart from scratch, as also needed after an error
+        loaded.m_valid = false;
         return false;
     }
+    f << "(push 1)\n";
     for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL && sat; ++i) {
         f << "(assert ";
         randomConstraint(f, rngr, _VL_SOLVER_HASH_LEN);
@@ -400,8 +518,7 @@ bool VlRandomizer::next(VlRNG& rngr) {
         f << "\n(check-sat)\n";
         sat = parseSolution(f);
     }
-
-    f << "(reset)\n";
+    f << "(pop 1)\n";
     return true;
 }
 
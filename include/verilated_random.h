@@ -381,14 +381,15 @@ public:
     }
 
     // Register associative array of non-struct types
-    template <typename T_Key, typename T_Value>
+    template <typename T_Key, typename T_Value, bool T_Hashed>
     typename std::enable_if<!VlContainsCustomStruct<T_Value>::value, void>::type
-    write_var(VlAssocArray<T_Key, T_Value>& var, int width, const char* name, int dimension,
+    write_var(VlAssocArray<T_Key, T_Value, T_Hashed>& var, int width, const char* name,
+              int dimension,
               std::uint32_t randmodeIdx = std::numeric_limits<std::uint32_t>::max()) {
         if (m_vars.find(name) != m_vars.end()) return;
-        m_vars[name]
-            = std::make_shared<const VlRandomArrayVarTemplate<VlAssocArray<T_Key, T_Value>>>(
-                name, width, &var, dimension, randmodeIdx);
+        m_vars[name] = std::make_shared<
+            const VlRandomArrayVarTemplate<VlAssocArray<T_Key, T_Value, T_Hashed>>>(
+            name, width, &var, dimension, randmodeIdx);
         if (dimension > 0) {
             m_index = 0;
             record_arr_table(var, name, dimension, {}, {});
@@ -396,9 +397,10 @@ public:
     }
 
     // Register associative array of structs
-    template <typename T_Key, typename T_Value>
+    template <typename T_Key, typename T_Value, bool T_Hashed>
     typename std::enable_if<VlContainsCustomStruct<T_Value>::value, void>::type
-    write_var(VlAssocArray<T_Key, T_Value>& var, int width, const char* name, int dimension,
+    write_var(VlAssocArray<T_Key, T_Value, T_Hashed>& var, int width, const char* name,
+              int dimension,
               std::uint32_t randmodeIdx = std::numeric_limits<std::uint32_t>::max()) {
         if (dimension > 0) record_struct_arr(var, name, dimension, {}, {});
     }
@@ -448,8 +450,8 @@ public:
     }
 
     // Recursively record all elements in an associative array
-    template <typename T_Key, typename T_Value>
-    void record_arr_table(VlAssocArray<T_Key, T_Value>& var, const std::string& name,
+    template <typename T_Key, typename T_Value, bool T_Hashed>
+    void record_arr_table(VlAssocArray<T_Key, T_Value, T_Hashed>& var, const std::string& name,
                           int dimension, std::vector<IData> indices,
                           std::vector<size_t> idxWidths) {
         if ((dimension > 0) && (var.size() != 0)) {
@@ -521,8 +523,8 @@ public:
     }
 
     // Recursively process associative arrays of structs
-    template <typename T_Key, typename T_Value>
-    void record_struct_arr(VlAssocArray<T_Key, T_Value>& var, const std::string& name,
+    template <typename T_Key, typename T_Value, bool T_Hashed>
+    void record_struct_arr(VlAssocArray<T_Key, T_Value, T_Hashed>& var, const std::string& name,
                            int dimension, const std::vector<IData>& indices,
                            const std::vector<size_t>& idxWidths) {
         if ((dimension > 0) && (!var.empty())) {
@@ -0,0 +1,442 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2001-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated C++ tracing in raw binary format implementation code
+///
+/// This file must be compiled and linked against all Verilated objects
+/// that use --trace-raw.
+///
+/// Use "verilator --trace-raw" to add this to the Makefile for the linker.
+///
+//=============================================================================
+
+// clang-format off
+
+#include "verilatedos.h"
+#include "verilated.h"
+#include "verilated_raw_c.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+
+#if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
+# include <io.h>
+#else
+# include <unistd.h>
+#endif
+
+#ifndef O_LARGEFILE  // WIN32 headers omit this
+# define O_LARGEFILE 0
+#endif
+#ifndef O_NONBLOCK  // WIN32 headers omit this
+# define O_NONBLOCK 0
+#endif
+#ifndef O_CLOEXEC  // WIN32 headers omit this
+# define O_CLOEXEC 0
+#endif
+
+// clang-format on
+
+//=============================================================================
+// Specialization of the generics for this trace format
+
+#define VL_SUB_T VerilatedRaw
+#define VL_BUF_T VerilatedRawBuffer
+#include "verilated_trace_imp.h"
+#undef VL_SUB_T
+#undef VL_BUF_T
+
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// Opening/Closing
+
+VerilatedRaw::VerilatedRaw(void* filep) {}
+
+VerilatedRaw::~VerilatedRaw() {
+    close();
+    if (m_bufp) VL_DO_CLEAR(delete[] m_bufp, m_bufp = nullptr);
+}
+
+void VerilatedRaw::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (isOpen()) return;
+
+    // Set member variables
+    m_filename = filename;  // "" is ok, as someone may overload open
+    m_fd = ::open(m_filename.c_str(),
+                  O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_NONBLOCK | O_CLOEXEC, 0666);
+    if (m_fd < 0) return;  // User code can check isOpen()
+    m_isOpen = true;
+    m_fileOffset = 0;
+    m_index.clear();
+
+    // Scope and signal definitions
+    m_decls.clear();
+    m_decls.push_back(VerilatedRawFormat::DECL_TIMESCALE);
+    declString(timeResStr());
+    Super::traceInit();
+    m_decls.push_back(VerilatedRawFormat::DECL_END);
+    if (m_decls.size() & 1) m_decls.push_back(0);  // Pad to 8 bytes
+
+    VerilatedRawFormat::FileHeader header;
+    std::memcpy(header.magic, "VLRAWTRC", sizeof(header.magic));
+    header.endian = VerilatedRawFormat::ENDIAN_MARK;
+    header.version = VerilatedRawFormat::VERSION;
+    header.declBytes = m_decls.size() * sizeof(uint32_t);
+    writeBytes(&header, sizeof(header));
+    writeBytes(m_decls.data(), header.declBytes);
+    m_decls.clear();
+    m_decls.shrink_to_fit();
+
+    // Chunk buffer, with room for two chunks before it needs to grow
+    const size_t chunkWords = m_chunkBytes / sizeof(uint32_t);
+    const size_t minWords = std::max<size_t>(chunkWords * 2, 8 * m_maxSignalWords + 1024);
+    if (m_bufWords < minWords) {
+        if (m_bufp) VL_DO_CLEAR(delete[] m_bufp, m_bufp = nullptr);
+        m_bufWords = minWords;
+        m_bufp = new uint32_t[m_bufWords];
+    }
+    m_writep = m_bufp;
+    m_growp = m_bufp + m_bufWords - m_maxSignalWords;
+    m_lastTimeOffset = ~static_cast<size_t>(0);
+
+    constDump(true);  // First dump must contain the const signals
+    fullDump(true);  // First dump must be full
+}
+
+void VerilatedRaw::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    // This function is on the flush() call path
+    const VerilatedLockGuard lock{m_mutex};
+    if (!isOpen()) return;
+    Super::flushBase();
+    chunkFlush();
+
+    // Index footer
+    VerilatedRawFormat::Trailer trailer;
+    trailer.indexOffset = m_fileOffset;
+    trailer.numChunks = m_index.size();
+    std::memcpy(trailer.magic, "VLRAWEND", sizeof(trailer.magic));
+    writeBytes(m_index.data(), m_index.size() * sizeof(VerilatedRawFormat::IndexEntry));
+    writeBytes(&trailer, sizeof(trailer));
+
+    m_isOpen = false;
+    ::close(m_fd);
+    m_fd = -1;
+    // flushBase() above flushed, so we just need to shut down the tracing thread here.
+    Super::closeBase();
+}
+
+void VerilatedRaw::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    Super::flushBase();
+    chunkFlush();
+}
+
+void VerilatedRaw::emitTimeChange(uint64_t timeui) {
+    // If nothing changed since the last time record, overwrite it
+    if (m_lastTimeOffset != ~static_cast<size_t>(0)) m_writep = m_bufp + m_lastTimeOffset;
+    // Chunks always start at a time change
+    if (static_cast<size_t>(m_writep - m_bufp) * sizeof(uint32_t) >= m_chunkBytes) chunkFlush();
+    if (m_writep == m_bufp) m_chunkFirstTime = timeui;
+    m_chunkLastTime = timeui;
+    m_lastTimeOffset = m_writep - m_bufp;
+    m_writep[0] = VerilatedRawFormat::TIME;
+    m_writep[1] = static_cast<uint32_t>(timeui);
+    m_writep[2] = static_cast<uint32_t>(timeui >> 32);
+    m_writep += 3;
+    if (VL_UNLIKELY(m_writep > m_growp)) bufferGrow();
+}
+
+//=============================================================================
+// Buffered output
+
+void VerilatedRaw::bufferGrow() {
+    const size_t usedWords = m_writep - m_bufp;
+    m_bufWords *= 2;
+    uint32_t* const newBufp = new uint32_t[m_bufWords];
+    std::memcpy(newBufp, m_bufp, usedWords * sizeof(uint32_t));
+    VL_DO_CLEAR(delete[] m_bufp, m_bufp = newBufp);
+    m_writep = m_bufp + usedWords;
+    m_growp = m_bufp + m_bufWords - m_maxSignalWords;
+}
+
+void VerilatedRaw::chunkFlush() {
+    // This function is on the flush() call path
+    if (VL_UNLIKELY(!m_isOpen)) return;
+    const size_t words = m_writep - m_bufp;
+    if (!words) return;
+    VerilatedRawFormat::ChunkHeader header;
+    header.magic = VerilatedRawFormat::CHUNK_MAGIC;
+    header.words = static_cast<uint32_t>(words);
+    header.firstTime = m_chunkFirstTime;
+    header.lastTime = m_chunkLastTime;
+    m_index.push_back({m_fileOffset, m_chunkFirstTime, m_chunkLastTime});
+    // Pad to 8 bytes, there is always room as m_growp is before the end of the buffer
+    if (words & 1) *m_writep++ = 0;
+    writeBytes(&header, sizeof(header));
+    writeBytes(m_bufp, (m_writep - m_bufp) * sizeof(uint32_t));
+    m_writep = m_bufp;
+    m_lastTimeOffset = ~static_cast<size_t>(0);
+}
+
+void VerilatedRaw::writeBytes(const void* datap, size_t len) {
+    const char* wp = static_cast<const char*>(datap);
+    while (len) {
+        errno = 0;
+        const ssize_t got = ::write(m_fd, wp, len);
+        if (got > 0) {
+            wp += got;
+            len -= got;
+            m_fileOffset += got;
+        } else if (VL_UNCOVERABLE(got < 0)) {
+            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+                // LCOV_EXCL_START
+                // write failed, presume error (perhaps out of disk space)
+                const std::string msg = "VerilatedRaw::writeBytes: "s + std::strerror(errno);
+                VL_FATAL_MT("", 0, "", msg.c_str());
+                break;
+                // LCOV_EXCL_STOP
+            }
+        }
+    }
+}
+
+//=============================================================================
+// Definitions
+
+void VerilatedRaw::declString(const std::string& str) {
+    const size_t words = (str.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    const size_t pos = m_decls.size();
+    m_decls.push_back(static_cast<uint32_t>(str.size()));
+    m_decls.resize(pos + 1 + words, 0);
+    std::memcpy(&m_decls[pos + 1], str.data(), str.size());
+}
+
+void VerilatedRaw::pushPrefix(const std::string& name, VerilatedTracePrefixType type) {
+    assert(!m_prefixStack.empty());  // Constructor makes an empty entry
+    // An empty name means this is the root of a model created with
+    // name()=="".  As for VCD, we put the signals under a new $rootio scope,
+    // but the signals further down will be peers, not children.
+    const std::string prevPrefix = m_prefixStack.back().first;
+    if (name == "$rootio" && !prevPrefix.empty()) {
+        // Upper has name, we can suppress inserting $rootio, but still push so popPrefix works
+        m_prefixStack.emplace_back(prevPrefix, VerilatedTracePrefixType::ROOTIO_WRAPPER);
+        return;
+    } else if (name.empty()) {
+        m_prefixStack.emplace_back(prevPrefix, VerilatedTracePrefixType::ROOTIO_WRAPPER);
+        return;
+    }
+
+    const std::string newPrefix = prevPrefix + name;
+    bool properScope = false;
+    switch (type) {
+    case VerilatedTracePrefixType::SCOPE_MODULE:
+    case VerilatedTracePrefixType::SCOPE_INTERFACE:
+    case VerilatedTracePrefixType::STRUCT_PACKED:
+    case VerilatedTracePrefixType::STRUCT_UNPACKED:
+    case VerilatedTracePrefixType::UNION_PACKED: {
+        properScope = true;
+        break;
+    }
+    default: break;
+    }
+    if (properScope) {
+        m_decls.push_back(VerilatedRawFormat::DECL_SCOPE);
+        declString(lastWord(newPrefix));
+    }
+    m_prefixStack.emplace_back(newPrefix + (properScope ? " " : ""), type);
+}
+
+void VerilatedRaw::popPrefix() {
+    assert(!m_prefixStack.empty());
+    switch (m_prefixStack.back().second) {
+    case VerilatedTracePrefixType::SCOPE_MODULE:
+    case VerilatedTracePrefixType::SCOPE_INTERFACE:
+    case VerilatedTracePrefixType::STRUCT_PACKED:
+    case VerilatedTracePrefixType::STRUCT_UNPACKED:
+    case VerilatedTracePrefixType::UNION_PACKED:
+        m_decls.push_back(VerilatedRawFormat::DECL_UPSCOPE);
+        break;
+    default: break;
+    }
+    m_prefixStack.pop_back();
+    assert(!m_prefixStack.empty());  // Always one left, the constructor's initial one
+}
+
+void VerilatedRaw::declare(uint32_t code, const char* name, const char* wirep, bool array,
+                           int arraynum, bool bussed, int msb, int lsb) {
+    const int bits = ((msb > lsb) ? (msb - lsb) : (lsb - msb)) + 1;
+
+    const std::string hierarchicalName = m_prefixStack.back().first + name;
+
+    const bool enabled = Super::declCode(code, hierarchicalName, bits);
+
+    // Keep upper bound on words a single signal can emit into the buffer
+    m_maxSignalWords = std::max<size_t>(m_maxSignalWords, VL_WORDS_I(bits) + 2);
+
+    if (!enabled) return;
+
+    const uint32_t flags = (array ? VerilatedRawFormat::VAR_ARRAY : 0)
+                           | (bussed ? VerilatedRawFormat::VAR_BUSSED : 0);
+    m_decls.push_back(VerilatedRawFormat::DECL_VAR);
+    m_decls.push_back(code);
+    m_decls.push_back(static_cast<uint32_t>(bits));
+    m_decls.push_back(flags);
+    m_decls.push_back(static_cast<uint32_t>(arraynum));
+    m_decls.push_back(static_cast<uint32_t>(msb));
+    m_decls.push_back(static_cast<uint32_t>(lsb));
+    declString(wirep);
+    declString(lastWord(hierarchicalName));
+}
+
+void VerilatedRaw::declEvent(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                             VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                             VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "event", array, arraynum, false, 0, 0);
+}
+void VerilatedRaw::declBit(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                           VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                           VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "wire", array, arraynum, false, 0, 0);
+}
+void VerilatedRaw::declBus(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                           VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                           VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", array, arraynum, true, msb, lsb);
+}
+void VerilatedRaw::declQuad(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                            VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                            VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", array, arraynum, true, msb, lsb);
+}
+void VerilatedRaw::declArray(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                             VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                             VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", array, arraynum, true, msb, lsb);
+}
+void VerilatedRaw::declDouble(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                              VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                              VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "real", array, arraynum, false, 63, 0);
+}
+
+//=============================================================================
+// Get/commit trace buffer
+
+VerilatedRaw::Buffer* VerilatedRaw::getTraceBuffer(uint32_t fidx) { return new Buffer{*this}; }
+
+void VerilatedRaw::commitTraceBuffer(VerilatedRaw::Buffer* bufp) {
+    if (bufp->m_writep != m_writep) m_lastTimeOffset = ~static_cast<size_t>(0);
+    m_writep = bufp->m_writep;
+    delete bufp;
+}
+
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// VerilatedRawBuffer implementation
+
+void VerilatedRawBuffer::finishRecord(uint32_t* writep) {
+    m_writep = writep;
+    if (VL_UNLIKELY(m_writep > m_growp)) {
+        m_owner.m_writep = m_writep;
+        m_owner.m_lastTimeOffset = ~static_cast<size_t>(0);
+        m_owner.bufferGrow();
+        m_writep = m_owner.m_writep;
+        m_growp = m_owner.m_growp;
+    }
+}
+
+//=============================================================================
+// emit* trace routines
+
+// Note: emit* are only ever called from one place (full* in
+// verilated_trace_imp.h, which is included in this file at the top),
+// so always inline them.
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitEvent(uint32_t code) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (1 << 4) | VerilatedRawFormat::EVENT;
+    wp[1] = code;
+    finishRecord(wp + 2);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitBit(uint32_t code, CData newval) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (1 << 4) | (VerilatedRawFormat::BIT0 + newval);
+    wp[1] = code;
+    finishRecord(wp + 2);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitCData(uint32_t code, CData newval, int bits) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (bits << 4) | VerilatedRawFormat::CDATA;
+    wp[1] = code;
+    wp[2] = newval;
+    finishRecord(wp + 3);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitSData(uint32_t code, SData newval, int bits) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (bits << 4) | VerilatedRawFormat::SDATA;
+    wp[1] = code;
+    wp[2] = newval;
+    finishRecord(wp + 3);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitIData(uint32_t code, IData newval, int bits) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (bits << 4) | VerilatedRawFormat::IDATA;
+    wp[1] = code;
+    wp[2] = newval;
+    finishRecord(wp + 3);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitQData(uint32_t code, QData newval, int bits) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (bits << 4) | VerilatedRawFormat::QDATA;
+    wp[1] = code;
+    wp[2] = static_cast<uint32_t>(newval);
+    wp[3] = static_cast<uint32_t>(newval >> 32);
+    finishRecord(wp + 4);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitWData(uint32_t code, const WData* newvalp, int bits) {
+    const int words = VL_WORDS_I(bits);
+    uint32_t* const wp = m_writep;
+    wp[0] = (bits << 4) | VerilatedRawFormat::WDATA;
+    wp[1] = code;
+    std::memcpy(wp + 2, newvalp, words * sizeof(EData));
+    finishRecord(wp + 2 + words);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedRawBuffer::emitDouble(uint32_t code, double newval) {
+    uint32_t* const wp = m_writep;
+    wp[0] = (64 << 4) | VerilatedRawFormat::DOUBLE;
+    wp[1] = code;
+    std::memcpy(wp + 2, &newval, sizeof(newval));
+    finishRecord(wp + 4);
+}
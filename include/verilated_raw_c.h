@@ -0,0 +1,347 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2001-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated tracing in raw binary format header
+///
+/// User wrapper code should use this header when creating raw binary traces.
+///
+/// The raw format stores value changes as the simulation produced them,
+/// without text formatting or compression, and is intended to be converted
+/// offline with verilator_raw2vcd.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_RAW_C_H_
+#define VERILATOR_VERILATED_RAW_C_H_
+
+#include "verilated.h"
+#include "verilated_trace.h"
+
+#include <string>
+#include <vector>
+
+class VerilatedRawBuffer;
+
+//=============================================================================
+// VerilatedRawFormat
+// Layout of a raw trace file. All fields are in host byte order, which is
+// recorded in the file header so readers can detect it.
+//
+// A file consists of:
+//   FileHeader
+//   Declaration records, padded to 8 bytes (FileHeader::declBytes long)
+//   Any number of chunks, each a ChunkHeader followed by ChunkHeader::words
+//     32-bit words of change records, padded to 8 bytes
+//   Index of IndexEntry, one per chunk
+//   Trailer
+// A file without the index and Trailer (e.g. still being written) can be
+// read by walking the chunks from the end of the declarations.
+
+class VerilatedRawFormat final {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t ENDIAN_MARK = 0x01020304;
+    static constexpr uint32_t CHUNK_MAGIC = 0x4b4e4843;  // "CHNK"
+
+    // Declaration record tags; strings are a length word then padded bytes
+    enum DeclTag : uint32_t {
+        DECL_END = 0,  // End of declarations
+        DECL_TIMESCALE = 1,  // string
+        DECL_SCOPE = 2,  // string name
+        DECL_UPSCOPE = 3,  //
+        DECL_VAR = 4  // code, bits, flags, arraynum, msb, lsb, string kind, string name
+    };
+    static constexpr uint32_t VAR_ARRAY = 1;  // DECL_VAR flags
+    static constexpr uint32_t VAR_BUSSED = 2;
+
+    // Change record commands. The first word of each record is (bits << 4) | cmd,
+    // followed by the signal code (except TIME), followed by the value words.
+    enum Cmd : uint32_t {
+        TIME = 0,  // 2 words: time, low word first
+        EVENT = 1,  // No value
+        BIT0 = 2,  // No value
+        BIT1 = 3,  // No value
+        CDATA = 4,  // 1 word
+        SDATA = 5,  // 1 word
+        IDATA = 6,  // 1 word
+        QDATA = 7,  // 2 words, low word first
+        WDATA = 8,  // VL_WORDS_I(bits) words
+        DOUBLE = 9  // 2 words, memory image of the double
+    };
+
+    struct FileHeader final {
+        char magic[8];  // "VLRAWTRC"
+        uint32_t endian;  // ENDIAN_MARK
+        uint32_t version;  // VERSION
+        uint64_t declBytes;  // Size of declaration records, including padding
+    };
+    struct ChunkHeader final {
+        uint32_t magic;  // CHUNK_MAGIC
+        uint32_t words;  // Number of record words, excluding padding
+        uint64_t firstTime;  // Time of first TIME record in chunk
+        uint64_t lastTime;  // Time of last TIME record in chunk
+    };
+    struct IndexEntry final {
+        uint64_t offset;  // File offset of ChunkHeader
+        uint64_t firstTime;  // As ChunkHeader
+        uint64_t lastTime;  // As ChunkHeader
+    };
+    struct Trailer final {
+        uint64_t indexOffset;  // File offset of first IndexEntry
+        uint64_t numChunks;  // Number of IndexEntry
+        char magic[8];  // "VLRAWEND"
+    };
+};
+
+//=============================================================================
+// VerilatedRaw
+// Base class to create a Verilator raw binary dump
+// This is an internally used class - see VerilatedRawC for what to call from applications
+
+class VerilatedRaw VL_NOT_FINAL : public VerilatedTrace<VerilatedRaw, VerilatedRawBuffer> {
+public:
+    using Super = VerilatedTrace<VerilatedRaw, VerilatedRawBuffer>;
+
+private:
+    friend VerilatedRawBuffer;  // Give the buffer access to the private bits
+
+    //=========================================================================
+    // Raw-specific internals
+
+    int m_fd = -1;  // File descriptor we're writing to
+    bool m_isOpen = false;  // True indicates open file
+    std::string m_filename;  // Filename we're writing to (if open)
+    uint64_t m_fileOffset = 0;  // Number of bytes written to this file
+
+    uint32_t* m_bufp = nullptr;  // Chunk buffer
+    uint32_t* m_writep = nullptr;  // Write pointer into chunk buffer
+    uint32_t* m_growp = nullptr;  // Chunk buffer resize trigger location
+    size_t m_bufWords = 0;  // Size of chunk buffer
+    size_t m_chunkBytes = 1024 * 1024;  // Chunk size to write at next time change
+    size_t m_maxSignalWords = 4;  // Upper bound on words in a record (at least a TIME + pad)
+    // Offset of last TIME record in chunk buffer if nothing followed it, otherwise ~0
+    size_t m_lastTimeOffset = ~static_cast<size_t>(0);
+    uint64_t m_chunkFirstTime = 0;  // First time in the current chunk
+    uint64_t m_chunkLastTime = 0;  // Last time in the current chunk
+
+    std::vector<uint32_t> m_decls;  // Declaration records
+    std::vector<VerilatedRawFormat::IndexEntry> m_index;  // Chunks written so far
+
+    // Prefixes to add to signal names/scope types
+    std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
+        {"", VerilatedTracePrefixType::SCOPE_MODULE}};
+
+    void bufferGrow();
+    void chunkFlush();
+    void writeBytes(const void* datap, size_t len);
+    void declString(const std::string& str);
+    void declare(uint32_t code, const char* name, const char* wirep, bool array, int arraynum,
+                 bool bussed, int msb, int lsb);
+
+    // CONSTRUCTORS
+    VL_UNCOPYABLE(VerilatedRaw);
+
+protected:
+    //=========================================================================
+    // Implementation of VerilatedTrace interface
+
+    // Called when the trace moves forward to a new time point
+    void emitTimeChange(uint64_t timeui) override;
+
+    // Hooks called from VerilatedTrace
+    bool preFullDump() override { return isOpen(); }
+    bool preChangeDump() override { return isOpen(); }
+
+    // Trace buffer management
+    Buffer* getTraceBuffer(uint32_t fidx) override;
+    void commitTraceBuffer(Buffer*) override;
+
+    // Configure sub-class
+    void configure(const VerilatedTraceConfig&) override {}
+
+public:
+    //=========================================================================
+    // External interface to client code
+
+    // CONSTRUCTOR
+    explicit VerilatedRaw(void* filep = nullptr);
+    ~VerilatedRaw();
+
+    // ACCESSORS
+    // Set approximate number of bytes of changes to collect before writing a chunk
+    void chunkSize(size_t size) VL_MT_SAFE { m_chunkBytes = size; }
+
+    // METHODS - All must be thread safe
+    // Open the file; call isOpen() to see if errors
+    void open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Close the file
+    void close() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Flush any remaining data to this file
+    void flush() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Return if file is open
+    bool isOpen() const VL_MT_SAFE { return m_isOpen; }
+
+    //=========================================================================
+    // Internal interface to Verilator generated code
+
+    void pushPrefix(const std::string&, VerilatedTracePrefixType);
+    void popPrefix();
+
+    void declEvent(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                   VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                   bool array, int arraynum);
+    void declBit(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                 VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                 bool array, int arraynum);
+    void declBus(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                 VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                 bool array, int arraynum, int msb, int lsb);
+    void declQuad(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                  VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                  bool array, int arraynum, int msb, int lsb);
+    void declArray(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                   VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                   bool array, int arraynum, int msb, int lsb);
+    void declDouble(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                    VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                    bool array, int arraynum);
+};
+
+#ifndef DOXYGEN
+// Declare specialization here as it's used in VerilatedRawC just below
+template <>
+void VerilatedRaw::Super::dump(uint64_t time);
+template <>
+void VerilatedRaw::Super::set_time_unit(const char* unitp);
+template <>
+void VerilatedRaw::Super::set_time_unit(const std::string& unit);
+template <>
+void VerilatedRaw::Super::set_time_resolution(const char* unitp);
+template <>
+void VerilatedRaw::Super::set_time_resolution(const std::string& unit);
+template <>
+void VerilatedRaw::Super::dumpvars(int level, const std::string& hier);
+#endif  // DOXYGEN
+
+//=============================================================================
+// VerilatedRawBuffer
+
+class VerilatedRawBuffer VL_NOT_FINAL {
+    // Give the trace file and sub-classes access to the private bits
+    friend VerilatedRaw;
+    friend VerilatedRaw::Super;
+    friend VerilatedRaw::Buffer;
+    friend VerilatedRaw::OffloadBuffer;
+
+    VerilatedRaw& m_owner;  // Trace file owning this buffer. Required by subclasses.
+
+    uint32_t* m_writep = m_owner.m_writep;  // Write pointer into chunk buffer
+    uint32_t* m_growp = m_owner.m_growp;  // Chunk buffer resize trigger location
+
+    void finishRecord(uint32_t* writep);
+
+    // CONSTRUCTOR
+    explicit VerilatedRawBuffer(VerilatedRaw& owner)
+        : m_owner{owner} {}
+    virtual ~VerilatedRawBuffer() = default;
+
+    //=========================================================================
+    // Implementation of VerilatedTraceBuffer interface
+    // Implementations of duck-typed methods for VerilatedTraceBuffer. These are
+    // called from only one place (the full* methods), so always inline them.
+    VL_ATTR_ALWINLINE void emitEvent(uint32_t code);
+    VL_ATTR_ALWINLINE void emitBit(uint32_t code, CData newval);
+    VL_ATTR_ALWINLINE void emitCData(uint32_t code, CData newval, int bits);
+    VL_ATTR_ALWINLINE void emitSData(uint32_t code, SData newval, int bits);
+    VL_ATTR_ALWINLINE void emitIData(uint32_t code, IData newval, int bits);
+    VL_ATTR_ALWINLINE void emitQData(uint32_t code, QData newval, int bits);
+    VL_ATTR_ALWINLINE void emitWData(uint32_t code, const WData* newvalp, int bits);
+    VL_ATTR_ALWINLINE void emitDouble(uint32_t code, double newval);
+};
+
+//=============================================================================
+// VerilatedRawC
+/// Class representing a raw binary dump file in C standalone (no SystemC)
+/// simulations.  Also derived for use in SystemC simulations.
+
+class VerilatedRawC VL_NOT_FINAL : public VerilatedTraceBaseC {
+    VerilatedRaw m_sptrace;  // Trace file being created
+
+    // CONSTRUCTORS
+    VL_UNCOPYABLE(VerilatedRawC);
+
+public:
+    /// Construct the dump. Optional argument is ignored.
+    explicit VerilatedRawC(void* filep = nullptr)
+        : m_sptrace{filep} {}
+    /// Destruct, flush, and close the dump
+    virtual ~VerilatedRawC() { close(); }
+
+    // METHODS - User called
+
+    /// Return if file is open
+    bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
+    /// Open a new raw trace file
+    /// This includes a complete header dump each time it is called,
+    /// just as if this object was deleted and reconstructed.
+    virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    /// Set approximate number of bytes of changes collected per chunk
+    /// Larger chunks make fewer write calls, smaller chunks make a finer index.
+    void chunkSize(size_t size) VL_MT_SAFE { m_sptrace.chunkSize(size); }
+
+    void rolloverSize(size_t size) VL_MT_SAFE {}  // NOP
+
+    /// Close dump
+    void close() VL_MT_SAFE {
+        m_sptrace.close();
+        modelConnected(false);
+    }
+    /// Flush dump
+    void flush() VL_MT_SAFE { m_sptrace.flush(); }
+    /// Write one cycle of dump data
+    /// Call with the current context's time just after eval'ed,
+    /// e.g. ->dump(contextp->time())
+    void dump(uint64_t timeui) VL_MT_SAFE { m_sptrace.dump(timeui); }
+    /// Write one cycle of dump data - backward compatible and to reduce
+    /// conversion warnings.  It's better to use a uint64_t time instead.
+    void dump(double timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    void dump(uint32_t timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    void dump(int timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+
+    // METHODS - Internal/backward compatible
+    // \protectedsection
+
+    // Set time units (s/ms, defaults to ns)
+    // Users should not need to call this, as for Verilated models, these
+    // propagate from the Verilated default timeunit
+    void set_time_unit(const char* unit) VL_MT_SAFE { m_sptrace.set_time_unit(unit); }
+    void set_time_unit(const std::string& unit) VL_MT_SAFE { m_sptrace.set_time_unit(unit); }
+    // Set time resolution (s/ms, defaults to ns)
+    // Users should not need to call this, as for Verilated models, these
+    // propagate from the Verilated default timeprecision
+    void set_time_resolution(const char* unit) VL_MT_SAFE { m_sptrace.set_time_resolution(unit); }
+    void set_time_resolution(const std::string& unit) VL_MT_SAFE {
+        m_sptrace.set_time_resolution(unit);
+    }
+    // Set variables to dump, using $dumpvars format
+    // If level = 0, dump everything and hier is then ignored
+    void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
+        m_sptrace.dumpvars(level, hier);
+    }
+
+    // Internal class access
+    VerilatedRaw* spTrace() { return &m_sptrace; }
+};
+
+#endif  // guard
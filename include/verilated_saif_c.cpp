@@ -59,27 +59,47 @@
 #undef VL_SUB_T
 #undef VL_BUF_T
 
+//=============================================================================
+// Utility functions
+
+static int countTrailingZeroes(EData val) {
+    // Argument must be non-zero
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+    return __builtin_ctz(val);
+#else
+    int bit = 0;
+    while (!(val & 1)) {
+        ++bit;
+        val >>= 1;
+    }
+    return bit;
+#endif
+}
+
 //=============================================================================
 // VerilatedSaifActivityBit
 
 class VerilatedSaifActivityBit final {
     // MEMBERS
-    bool m_lastVal = false;  // Last emitted activity bit value
-    uint64_t m_highTime = 0;  // Total time when bit was high
-    size_t m_transitions = 0;  // Total number of bit transitions
+    // Total time when bit was high, less the time of the last rising edge while the bit is high
+    uint64_t m_highTime = 0;
+    uint64_t m_transitions = 0;  // Total number of bit transitions
 
 public:
     // METHODS
+    // Record a transition to 'newVal' at 'time'. The bit's current value is held packed in
+    // VerilatedSaifActivityVar, so this is only called for bits that changed.
     VL_ATTR_ALWINLINE
-    void aggregateVal(uint64_t dt, bool newVal) {
-        m_transitions += newVal != m_lastVal ? 1 : 0;
-        m_highTime += m_lastVal ? dt : 0;
-        m_lastVal = newVal;
+    void toggle(uint64_t time, bool newVal) {
+        ++m_transitions;
+        // Wraps modulo 2^64 while the bit is high, and is corrected at the falling edge
+        m_highTime += newVal ? -time : time;
     }
 
     // ACCESSORS
-    VL_ATTR_ALWINLINE bool bitValue() const { return m_lastVal; }
-    VL_ATTR_ALWINLINE uint64_t highTime() const { return m_highTime; }
+    VL_ATTR_ALWINLINE uint64_t highTime(uint64_t time, bool bitValue) const {
+        return m_highTime + (bitValue ? time : 0);
+    }
     VL_ATTR_ALWINLINE uint64_t toggleCount() const { return m_transitions; }
 };
 
@@ -88,14 +108,15 @@ public:
 
 class VerilatedSaifActivityVar final {
     // MEMBERS
-    uint64_t m_lastTime = 0;  // Last time when variable value was updated
     VerilatedSaifActivityBit* m_bits;  // Pointer to variable bits objects
+    EData* m_lastValp;  // Pointer to last emitted value, packed as in WData
     uint32_t m_width;  // Width of variable (in bits)
 
 public:
     // CONSTRUCTORS
-    VerilatedSaifActivityVar(uint32_t width, VerilatedSaifActivityBit* bits)
+    VerilatedSaifActivityVar(uint32_t width, VerilatedSaifActivityBit* bits, EData* lastValp)
         : m_bits{bits}
+        , m_lastValp{lastValp}
         , m_width{width} {}
 
     VerilatedSaifActivityVar(VerilatedSaifActivityVar&&) = default;
@@ -109,22 +130,39 @@ public:
         static_assert(std::is_integral<DataType>::value,
                       "The emitted value must be of integral type");
 
-        const uint64_t dt = time - m_lastTime;
-        for (size_t i = 0; i < std::min(m_width, bits); ++i) {
-            m_bits[i].aggregateVal(dt, (newval >> i) & 1);
+        const uint32_t nbits = std::min(m_width, bits);
+        if (sizeof(DataType) <= sizeof(EData) || nbits <= VL_EDATASIZE) {
+            emitWord(time, 0, static_cast<EData>(newval), VL_MASK_E(nbits));
+        } else {
+            emitWord(time, 0, static_cast<EData>(newval), ~EData{0});
+            emitWord(time, 1, static_cast<EData>(static_cast<QData>(newval) >> VL_EDATASIZE),
+                     VL_MASK_E(nbits - VL_EDATASIZE));
         }
-        updateLastTime(time);
     }
 
     VL_ATTR_ALWINLINE void emitWData(uint64_t time, const WData* newvalp, uint32_t bits);
-    VL_ATTR_ALWINLINE void updateLastTime(uint64_t val) { m_lastTime = val; }
 
     // ACCESSORS
     VL_ATTR_ALWINLINE uint32_t width() const { return m_width; }
     VL_ATTR_ALWINLINE VerilatedSaifActivityBit& bit(std::size_t index);
-    VL_ATTR_ALWINLINE uint64_t lastUpdateTime() const { return m_lastTime; }
+    VL_ATTR_ALWINLINE bool bitValue(std::size_t index) const {
+        return VL_BITISSET_E(m_lastValp[VL_BITWORD_E(index)], index);
+    }
 
 private:
+    // Update one word of the packed value, and the activity of the bits in 'mask' that changed
+    VL_ATTR_ALWINLINE void emitWord(uint64_t time, uint32_t word, EData newval, EData mask) {
+        EData changed = (m_lastValp[word] ^ newval) & mask;
+        if (VL_LIKELY(!changed)) return;
+        m_lastValp[word] ^= changed;
+        VerilatedSaifActivityBit* const bitsp = m_bits + word * VL_EDATASIZE;
+        do {
+            const int lsb = countTrailingZeroes(changed);
+            bitsp[lsb].toggle(time, (newval >> lsb) & 1);
+            changed &= changed - 1;
+        } while (changed);
+    }
+
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedSaifActivityVar);
 };
@@ -199,6 +237,8 @@ class VerilatedSaifActivityAccumulator final {
     std::unordered_map<uint32_t, VerilatedSaifActivityVar> m_activity;
     // Memory pool for signals bits objects
     std::vector<std::vector<VerilatedSaifActivityBit>> m_activityArena;
+    // Memory pool for signals last values, packed 32 bits per word
+    std::vector<std::vector<EData>> m_valueArena;
 
 public:
     // METHODS
@@ -222,22 +262,22 @@ private:
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifActivityVar::emitBit(const uint64_t time, const CData newval) {
-    assert(m_lastTime <= time);
-    m_bits[0].aggregateVal(time - m_lastTime, newval);
-    updateLastTime(time);
+    emitWord(time, 0, newval, 1);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifActivityVar::emitWData(const uint64_t time, const WData* newvalp,
                                          const uint32_t bits) {
-    assert(m_lastTime <= time);
-    const uint64_t dt = time - m_lastTime;
-    for (std::size_t i = 0; i < std::min(m_width, bits); ++i) {
-        const size_t wordIndex = i / VL_EDATASIZE;
-        m_bits[i].aggregateVal(dt, (newvalp[wordIndex] >> VL_BITBIT_E(i)) & 1);
+    const uint32_t nbits = std::min(m_width, bits);
+    const uint32_t words = VL_WORDS_I(nbits);
+    uint32_t word = 0;
+    // Skip unchanged parts of wide values a vector at a time
+    for (; word + 8 < words; word += 8) {
+        if (!VerilatedSaif::Buffer::differsWData(m_lastValp + word, newvalp + word, 8)) continue;
+        for (uint32_t i = word; i < word + 8; ++i) emitWord(time, i, newvalp[i], ~EData{0});
     }
-
-    updateLastTime(time);
+    for (; word + 1 < words; ++word) emitWord(time, word, newvalp[word], ~EData{0});
+    emitWord(time, word, newvalp[word], VL_MASK_E(nbits));
 }
 
 VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index) {
@@ -262,6 +302,15 @@ void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string&
     const size_t bitsIdx = m_activityArena.back().size();
     m_activityArena.back().resize(m_activityArena.back().size() + bits);
 
+    const size_t words = VL_WORDS_I(bits);
+    if (m_valueArena.empty()
+        || m_valueArena.back().size() + words > m_valueArena.back().capacity()) {
+        m_valueArena.emplace_back();
+        m_valueArena.back().reserve(block_size / VL_EDATASIZE);
+    }
+    const size_t wordsIdx = m_valueArena.back().size();
+    m_valueArena.back().resize(m_valueArena.back().size() + words);
+
     if (array) {
         variableName += '[';
         variableName += std::to_string(arraynum);
@@ -269,7 +318,8 @@ void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string&
     }
     m_scopeToActivities[absoluteScopePath].emplace_back(code, variableName);
     m_activity.emplace(code, VerilatedSaifActivityVar{static_cast<uint32_t>(bits),
-                                                      m_activityArena.back().data() + bitsIdx});
+                                                      m_activityArena.back().data() + bitsIdx,
+                                                      m_valueArena.back().data() + wordsIdx});
 }
 
 //=============================================================================
@@ -399,9 +449,8 @@ void VerilatedSaif::closeNetScope() {
 bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
                                        const std::string& activityName, bool anyNetWritten) {
     for (size_t i = 0; i < activity.width(); ++i) {
-        VerilatedSaifActivityBit& bit = activity.bit(i);
-
-        bit.aggregateVal(currentTime() - activity.lastUpdateTime(), bit.bitValue());
+        const VerilatedSaifActivityBit& bit = activity.bit(i);
+        const uint64_t highTime = bit.highTime(currentTime(), activity.bitValue(i));
 
         if (!anyNetWritten) {
             openNetScope();
@@ -419,16 +468,14 @@ bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
 
         // We only have two-value logic so TZ, TX and TB will always be 0
         printStr(" (T0 ");
-        printStr(std::to_string(currentTime() - bit.highTime()));
+        printStr(std::to_string(currentTime() - highTime));
         printStr(") (T1 ");
-        printStr(std::to_string(bit.highTime()));
+        printStr(std::to_string(highTime));
         printStr(") (TZ 0) (TX 0) (TB 0) (TC ");
         printStr(std::to_string(bit.toggleCount()));
         printStr("))\n");
     }
 
-    activity.updateLastTime(currentTime());
-
     return anyNetWritten;
 }
 
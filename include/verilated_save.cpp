@@ -30,8 +30,11 @@
 #include "verilated.h"
 #include "verilated_imp.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <fcntl.h>
+#include <thread>
+#include <zlib.h>
 
 // clang-format off
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
@@ -39,6 +42,11 @@
 #else
 # include <unistd.h>
 #endif
+#ifndef _WIN32
+# include <sys/mman.h>
+# include <sys/stat.h>
+# define VL_SAVE_MMAP 1  // Restore maps save files
+#endif
 
 #ifndef O_LARGEFILE  // WIN32 headers omit this
 # define O_LARGEFILE 0
@@ -56,12 +64,140 @@
 static const char* const VLTSAVE_HEADER_STR = "verilatorsave02\n";
 // Value of last bytes of each file (must be multiple of 8 bytes)
 static const char* const VLTSAVE_TRAILER_STR = "vltsaved";
+// Value of first bytes of each delta file (must be multiple of 8 bytes)
+static const char* const VLTSAVE_DELTA_HEADER_STR = "verilatordelta1\n";
+// Value of last bytes of files with a block index, after the index offset
+static const char* const VLTSAVE_INDEX_STR = "vltblkix";
+// Bytes in each hashed block of the stream
+static constexpr uint64_t VLTSAVE_BLOCK_SIZE = 4096;
+// Value of first bytes of each compressed file (must be multiple of 8 bytes)
+static const char* const VLTSAVE_COMPRESSED_HEADER_STR = "verilatorsavez1\n";
+// Uncompressed bytes in each compressed frame
+static constexpr size_t VLTSAVE_FRAME_SIZE = 1024 * 1024;
+
+// Save files end with an index of the stream's blocks, after the trailer:
+//   uint64_t blockSize, streamSize, numChanged
+//   uint64_t changed[numChanged]   -- Block numbers stored in a delta file, in order
+//   uint64_t hashes[numBlocks]     -- Hash of every block in the stream
+//   uint64_t indexOffset           -- File offset of the index
+//   VLTSAVE_INDEX_STR
+// A delta file is VLTSAVE_DELTA_HEADER_STR, the previous file's name as a
+// serialized std::string, and then the changed blocks, each padded to
+// blockSize, followed by the trailer and the index.
+// A compressed file is VLTSAVE_COMPRESSED_HEADER_STR, a uint32_t codec, a
+// uint32_t zero, and then frames of uint32_t uncompressed size, uint32_t
+// compressed size and the compressed data, ending with a frame of size 0.
+// The uncompressed frames are the same as a full file, without the index.
+
+//=============================================================================
+// Block index utilities
+
+static uint64_t vlSaveBlockHash(const uint8_t* datap, size_t size) VL_PURE {
+    // 64-bit hash in the style of MurmurHash3 finalization, mixed 8 bytes at a time
+    constexpr uint64_t mulA = 0x87c37b91114253d5ULL;
+    constexpr uint64_t mulB = 0x4cf5ad432745937fULL;
+    uint64_t hash = size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, datap + i, 8);
+        word *= mulA;
+        word = (word << 31) | (word >> 33);
+        hash ^= word * mulB;
+        hash = ((hash << 27) | (hash >> 37)) * 5 + 0x52dce729;
+    }
+    uint64_t tail = 0;
+    for (; i < size; ++i) tail = (tail << 8) | datap[i];
+    hash ^= tail * mulA;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static bool vlSaveReadFully(int fd, void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    uint8_t* dp = static_cast<uint8_t*>(datap);
+    while (size) {
+        errno = 0;
+        const ssize_t got = ::read(fd, dp, size);
+        if (got > 0) {
+            dp += got;
+            size -= got;
+        } else if (got == 0 || (errno != EAGAIN && errno != EINTR)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool vlSaveReadAt(int fd, uint64_t offset, void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    if (::lseek(fd, static_cast<off_t>(offset), SEEK_SET) < 0) return false;
+    return vlSaveReadFully(fd, datap, size);
+}
+
+struct VlSaveBlockIndex final {
+    uint64_t m_streamSize = 0;  // Bytes in stream
+    std::vector<uint64_t> m_changed;  // Block numbers stored in delta file
+    std::vector<uint64_t> m_hashes;  // Hash of each block
+};
+
+static bool vlSaveReadIndex(int fd, VlSaveBlockIndex& index) VL_MT_UNSAFE_ONE {
+    const off_t fileSize = ::lseek(fd, 0, SEEK_END);
+    if (fileSize < 16) return false;
+    uint64_t tail[2];
+    if (!vlSaveReadAt(fd, fileSize - 16, tail, sizeof(tail))) return false;
+    if (std::memcmp(&tail[1], VLTSAVE_INDEX_STR, 8)) return false;
+    uint64_t head[3];  // blockSize, streamSize, numChanged
+    if (!vlSaveReadAt(fd, tail[0], head, sizeof(head))) return false;
+    const uint64_t numBlocks = (head[1] + VLTSAVE_BLOCK_SIZE - 1) / VLTSAVE_BLOCK_SIZE;
+    if (head[0] != VLTSAVE_BLOCK_SIZE
+        || tail[0] + sizeof(head) + 8 * (head[2] + numBlocks) + sizeof(tail)
+               != static_cast<uint64_t>(fileSize)) {
+        return false;
+    }
+    index.m_streamSize = head[1];
+    index.m_changed.resize(head[2]);
+    index.m_hashes.resize(numBlocks);
+    return vlSaveReadAt(fd, tail[0] + sizeof(head), index.m_changed.data(), 8 * head[2])
+           && vlSaveReadAt(fd, tail[0] + sizeof(head) + 8 * head[2], index.m_hashes.data(),
+                           8 * numBlocks);
+}
 
 //=============================================================================
 //=============================================================================
 //=============================================================================
 // Serialization
 
+VerilatedSerialize& VerilatedSerialize::writeBulk(const void* __restrict datap,
+                                                  size_t size) VL_MT_UNSAFE_ONE {
+    const uint8_t* __restrict dp = static_cast<const uint8_t* __restrict>(datap);
+    while (size) {
+        bufferCheck();
+        const size_t blk = std::min(size, bufferInsertSize());
+        std::memcpy(m_cp, dp, blk);
+        m_cp += blk;
+        dp += blk;
+        size -= blk;
+    }
+    return *this;  // For function chaining
+}
+
+VerilatedDeserialize& VerilatedDeserialize::readBulk(void* __restrict datap,
+                                                     size_t size) VL_MT_UNSAFE_ONE {
+    uint8_t* __restrict dp = static_cast<uint8_t* __restrict>(datap);
+    while (size) {
+        bufferCheck();
+        const size_t blk = std::min(size, bufferInsertSize());
+        std::memcpy(dp, m_cp, blk);
+        m_cp += blk;
+        dp += blk;
+        size -= blk;
+    }
+    return *this;  // For function chaining
+}
+
 bool VerilatedDeserialize::readDiffers(const void* __restrict datap,
                                        size_t size) VL_MT_UNSAFE_ONE {
     bufferCheck();
@@ -124,9 +260,7 @@ void VerilatedDeserialize::trailer() VL_MT_UNSAFE_ONE {
 //=============================================================================
 // Opening/Closing
 
-void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
-    m_assertOne.check();
-    if (isOpen()) return;
+void VerilatedSave::openImp(const char* filenamep) VL_MT_UNSAFE_ONE {
     VL_DEBUG_IF(VL_DBG_MSGF("- save: opening save file %s\n", filenamep););
 
     if (VL_UNCOVERABLE(filenamep[0] == '|')) {
@@ -144,7 +278,64 @@ void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_isOpen = true;
     m_filename = filenamep;
     m_cp = m_bufp;
+    m_fileSize = 0;
+    m_streaming = false;
+    m_blockUsed = 0;
+    m_block.resize(VLTSAVE_BLOCK_SIZE);
+    m_hashes.clear();
+    m_changed.clear();
+    m_compressing = !m_delta && m_codec != VerilatedSaveCodec::NONE;
+    m_frames.clear();
+    if (m_compressing) {
+        const uint32_t codecHeader[2] = {static_cast<uint32_t>(m_codec), 0};
+        writeFdImp(reinterpret_cast<const uint8_t*>(VLTSAVE_COMPRESSED_HEADER_STR),
+                   std::strlen(VLTSAVE_COMPRESSED_HEADER_STR));
+        writeFdImp(reinterpret_cast<const uint8_t*>(codecHeader), sizeof(codecHeader));
+    }
+}
+
+void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    m_delta = false;
+    m_prevHashes.clear();
+    openImp(filenamep);
+    if (!isOpen()) return;
     header();
+    flushImp();
+    m_streaming = true;
+}
+
+void VerilatedSave::openDelta(const char* filenamep, const char* prevFilenamep) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    // cppcheck-suppress duplicateExpression
+    const int prevFd = ::open(prevFilenamep, O_RDONLY | O_LARGEFILE | O_CLOEXEC);
+    if (VL_UNLIKELY(prevFd < 0)) {
+        // User code can check isOpen()
+        m_isOpen = false;
+        return;
+    }
+    VlSaveBlockIndex index;
+    const bool indexed = vlSaveReadIndex(prevFd, index);
+    ::close(prevFd);
+    if (VL_UNLIKELY(!indexed)) {
+        const std::string msg
+            = "Can't save delta; previous save-restore file has no block index"
+              " (is compressed, or from an older version): "s
+              + prevFilenamep;
+        VL_FATAL_MT(prevFilenamep, 0, "", msg.c_str());
+        return;
+    }
+    m_delta = true;
+    m_prevHashes = std::move(index.m_hashes);
+    openImp(filenamep);
+    if (!isOpen()) return;
+    VerilatedSerialize& os = *this;
+    os.write(VLTSAVE_DELTA_HEADER_STR, std::strlen(VLTSAVE_DELTA_HEADER_STR));
+    os << std::string{prevFilenamep};
+    flushImp();
+    m_streaming = true;
 }
 
 void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
@@ -167,13 +358,154 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_filename = filenamep;
     m_cp = m_bufp;
     m_endp = m_bufp;
+    char magic[16];
+    m_codec = VerilatedSaveCodec::NONE;
+    m_frame.clear();
+    m_framePos = 0;
+    uint32_t codecHeader[2];
+    if (!vlSaveReadAt(m_fd, 0, magic, sizeof(magic))) {
+        ::lseek(m_fd, 0, SEEK_SET);  // header() will report
+    } else if (!std::memcmp(magic, VLTSAVE_DELTA_HEADER_STR, sizeof(magic))) {
+        openChainImp(filenamep);
+    } else if (!std::memcmp(magic, VLTSAVE_COMPRESSED_HEADER_STR, sizeof(magic))
+               && vlSaveReadAt(m_fd, sizeof(magic), codecHeader, sizeof(codecHeader))) {
+        m_codec = static_cast<VerilatedSaveCodec>(codecHeader[0]);
+        if (VL_UNLIKELY(m_codec != VerilatedSaveCodec::ZLIB)) {
+            const std::string msg
+                = "Can't deserialize; save-restore file has unknown compression codec "
+                  + std::to_string(codecHeader[0]) + ": " + filenamep;
+            VL_FATAL_MT(filenamep, 0, "", msg.c_str());
+            return;
+        }
+    } else {
+        ::lseek(m_fd, 0, SEEK_SET);
+        mapImp();
+    }
     header();
 }
 
+void VerilatedRestore::mapImp() VL_MT_UNSAFE_ONE {
+#ifdef VL_SAVE_MMAP
+    // Map the file, so reads are copies from the page cache; if this fails
+    // the file is read normally
+    struct stat st;
+    if (::fstat(m_fd, &st) != 0 || st.st_size <= 0) return;
+    void* const mapp = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    if (mapp == MAP_FAILED) return;  // LCOV_EXCL_LINE
+    ::madvise(mapp, st.st_size, MADV_SEQUENTIAL);
+    ::madvise(mapp, st.st_size, MADV_WILLNEED);
+    m_mapp = static_cast<const uint8_t*>(mapp);
+    m_mapSize = st.st_size;
+    m_mapPos = 0;
+#endif
+}
+
+void VerilatedRestore::openChainImp(const char* filenamep) VL_MT_UNSAFE_ONE {
+    // Follow the previous file names back to the full checkpoint
+    std::vector<std::string> filenames{filenamep};
+    std::vector<uint64_t> dataOffsets;  // Offset of first block in each file
+    int fd = m_fd;
+    m_fd = -1;
+    while (true) {
+        m_chainFds.push_back(fd);
+        char magic[16];
+        if (!vlSaveReadAt(fd, 0, magic, sizeof(magic))
+            || !std::memcmp(magic, VLTSAVE_HEADER_STR, sizeof(magic))) {
+            // Full checkpoint, or a bad header that header() will report
+            dataOffsets.push_back(std::strlen(VLTSAVE_HEADER_STR));
+            break;
+        }
+        uint32_t len = 0;
+        std::string prevFilename;
+        if (vlSaveReadAt(fd, sizeof(magic), &len, sizeof(len))) {
+            prevFilename.resize(len);
+            // NOLINTNEXTLINE(google-readability-casting)
+            if (!vlSaveReadAt(fd, sizeof(magic) + sizeof(len), (void*)(prevFilename.data()),
+                              len)) {
+                prevFilename.clear();
+            }
+        }
+        dataOffsets.push_back(sizeof(magic) + sizeof(len) + len);
+        if (VL_UNLIKELY(std::find(filenames.begin(), filenames.end(), prevFilename)
+                        != filenames.end())) {
+            const std::string msg
+                = "Can't deserialize; delta save-restore file refers to itself: " + prevFilename;
+            VL_FATAL_MT(filenames.back().c_str(), 0, "", msg.c_str());
+            return;
+        }
+        // cppcheck-suppress duplicateExpression
+        fd = ::open(prevFilename.c_str(), O_RDONLY | O_LARGEFILE | O_CLOEXEC);
+        if (VL_UNLIKELY(fd < 0)) {
+            const std::string msg
+                = "Can't deserialize; previous file of delta save-restore file not found: "
+                  + prevFilename;
+            VL_FATAL_MT(filenames.back().c_str(), 0, "", msg.c_str());
+            return;
+        }
+        filenames.push_back(prevFilename);
+    }
+    std::reverse(m_chainFds.begin(), m_chainFds.end());
+    std::reverse(filenames.begin(), filenames.end());
+    std::reverse(dataOffsets.begin(), dataOffsets.end());
+
+    // Find the newest copy of each block
+    for (uint32_t fileNum = 0; fileNum < m_chainFds.size(); ++fileNum) {
+        VlSaveBlockIndex index;
+        if (VL_UNLIKELY(!vlSaveReadIndex(m_chainFds[fileNum], index))) {
+            const std::string msg
+                = "Can't deserialize; save-restore file has no block index: " + filenames[fileNum];
+            VL_FATAL_MT(filenames[fileNum].c_str(), 0, "", msg.c_str());
+            return;
+        }
+        m_chainStreamSize = index.m_streamSize;
+        m_chainBlocks.resize(index.m_hashes.size(), {UINT32_MAX, 0});
+        if (fileNum == 0) {
+            for (uint64_t blockNum = 0; blockNum < m_chainBlocks.size(); ++blockNum) {
+                m_chainBlocks[blockNum]
+                    = {fileNum, dataOffsets[fileNum] + blockNum * VLTSAVE_BLOCK_SIZE};
+            }
+        } else {
+            for (uint64_t i = 0; i < index.m_changed.size(); ++i) {
+                const uint64_t blockNum = index.m_changed[i];
+                if (blockNum >= m_chainBlocks.size()) break;  // Corrupt, reported below
+                m_chainBlocks[blockNum] = {fileNum, dataOffsets[fileNum] + i * VLTSAVE_BLOCK_SIZE};
+            }
+        }
+    }
+    for (const auto& block : m_chainBlocks) {
+        if (VL_UNLIKELY(block.first == UINT32_MAX)) {
+            const std::string msg
+                = "Can't deserialize; delta save-restore file is missing blocks: "s + filenamep;
+            VL_FATAL_MT(filenamep, 0, "", msg.c_str());
+            return;
+        }
+    }
+    m_chainPos = 0;
+}
+
 void VerilatedSave::closeImp() VL_MT_UNSAFE_ONE {
     if (!isOpen()) return;
+    flushImp();
+    const uint64_t streamSize = m_hashes.size() * VLTSAVE_BLOCK_SIZE + m_blockUsed;
+    if (m_blockUsed) blockImp(m_block.data(), m_blockUsed);
+    m_streaming = false;
     trailer();
+    if (!m_compressing) {
+        // Block index, see the file format description at the top of this file
+        const uint64_t indexOffset = m_fileSize + (m_cp - m_bufp);
+        VerilatedSerialize& os = *this;  // So can cut and paste standard << code below
+        os << VLTSAVE_BLOCK_SIZE << streamSize << static_cast<uint64_t>(m_changed.size());
+        for (const uint64_t blockNum : m_changed) os << blockNum;
+        for (const uint64_t hash : m_hashes) os << hash;
+        os << indexOffset;
+        os.write(VLTSAVE_INDEX_STR, std::strlen(VLTSAVE_INDEX_STR));
+    }
     flushImp();
+    if (m_compressing) {
+        compressImp();
+        const uint32_t endFrame[2] = {0, 0};
+        writeFdImp(reinterpret_cast<const uint8_t*>(endFrame), sizeof(endFrame));
+    }
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
 }
@@ -183,7 +515,15 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
     trailer();
     flushImp();
     m_isOpen = false;
-    ::close(m_fd);  // May get error, just ignore it
+    if (m_fd >= 0) ::close(m_fd);  // May get error, just ignore it
+#ifdef VL_SAVE_MMAP
+    // cppcheck-suppress cstyleCast
+    if (m_mapp) ::munmap(const_cast<uint8_t*>(m_mapp), m_mapSize);
+#endif
+    m_mapp = nullptr;
+    for (const int fd : m_chainFds) ::close(fd);
+    m_chainFds.clear();
+    m_chainBlocks.clear();
 }
 
 //=============================================================================
@@ -192,9 +532,87 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
 void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
-    const uint8_t* wp = m_bufp;
+    if (m_streaming) {
+        streamImp(m_bufp, m_cp - m_bufp);
+    } else {
+        writeImp(m_bufp, m_cp - m_bufp);
+    }
+    m_cp = m_bufp;  // Reset buffer
+}
+
+void VerilatedSave::writeImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    m_fileSize += size;
+    if (!m_compressing) {
+        writeFdImp(datap, size);
+        return;
+    }
+    while (size) {
+        if (m_frames.empty() || m_frames.back().size() == VLTSAVE_FRAME_SIZE) {
+            if (m_frames.size() >= m_threads) compressImp();
+            m_frames.emplace_back();
+            m_frames.back().reserve(VLTSAVE_FRAME_SIZE);
+        }
+        std::vector<uint8_t>& frame = m_frames.back();
+        const size_t blk = std::min(size, VLTSAVE_FRAME_SIZE - frame.size());
+        frame.insert(frame.end(), datap, datap + blk);
+        datap += blk;
+        size -= blk;
+    }
+}
+
+void VerilatedSave::compressImp() VL_MT_UNSAFE_ONE {
+    // Compress the pending frames, in parallel, then write them in order
+    std::vector<std::vector<uint8_t>> outs(m_frames.size());
+    std::vector<int> results(m_frames.size(), Z_OK);
+    const auto compressFrame = [&](size_t i) {
+        const std::vector<uint8_t>& frame = m_frames[i];
+        std::vector<uint8_t>& out = outs[i];
+        uLongf outSize = compressBound(frame.size());
+        out.resize(2 * sizeof(uint32_t) + outSize);
+        results[i] = compress2(out.data() + 2 * sizeof(uint32_t), &outSize, frame.data(),
+                               frame.size(), m_level ? m_level : Z_DEFAULT_COMPRESSION);
+        const uint32_t frameHeader[2]
+            = {static_cast<uint32_t>(frame.size()), static_cast<uint32_t>(outSize)};
+        std::memcpy(out.data(), frameHeader, sizeof(frameHeader));
+        out.resize(sizeof(frameHeader) + outSize);
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < m_frames.size(); ++i) threads.emplace_back(compressFrame, i);
+    if (!m_frames.empty()) compressFrame(0);
+    for (std::thread& thread : threads) thread.join();
+    m_frames.clear();
+    for (size_t i = 0; i < outs.size(); ++i) {
+        if (VL_UNCOVERABLE(results[i] != Z_OK)) {
+            // LCOV_EXCL_START
+            const std::string msg = std::string{__FUNCTION__} + ": zlib error "
+                                    + std::to_string(results[i]);
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            close();
+            return;
+            // LCOV_EXCL_STOP
+        }
+        writeFdImp(outs[i].data(), outs[i].size());
+    }
+}
+
+VerilatedSerialize& VerilatedSave::writeBulk(const void* __restrict datap,
+                                             size_t size) VL_MT_UNSAFE_ONE {
+    // Write what is buffered, then the data directly
+    flushImp();
+    if (VL_UNLIKELY(!isOpen())) return *this;
+    const uint8_t* const dp = static_cast<const uint8_t*>(datap);
+    if (m_streaming) {
+        streamImp(dp, size);
+    } else {
+        writeImp(dp, size);
+    }
+    return *this;  // For function chaining
+}
+
+void VerilatedSave::writeFdImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    const uint8_t* wp = datap;
     while (true) {
-        const ssize_t remaining = (m_cp - wp);
+        const ssize_t remaining = (datap + size - wp);
         if (remaining == 0) break;
         errno = 0;
         const ssize_t got = ::write(m_fd, wp, remaining);
@@ -212,7 +630,43 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
             }
         }
     }
-    m_cp = m_bufp;  // Reset buffer
+}
+
+void VerilatedSave::streamImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    // Full files contain the stream as is; blocks are only hashed for the index
+    if (!m_delta) writeImp(datap, size);
+    if (m_compressing) return;  // No index
+    if (m_blockUsed) {
+        const size_t blk = std::min<size_t>(size, VLTSAVE_BLOCK_SIZE - m_blockUsed);
+        std::memcpy(m_block.data() + m_blockUsed, datap, blk);
+        m_blockUsed += blk;
+        datap += blk;
+        size -= blk;
+        if (m_blockUsed < VLTSAVE_BLOCK_SIZE) return;
+        blockImp(m_block.data(), VLTSAVE_BLOCK_SIZE);
+        m_blockUsed = 0;
+    }
+    for (; size >= VLTSAVE_BLOCK_SIZE; datap += VLTSAVE_BLOCK_SIZE, size -= VLTSAVE_BLOCK_SIZE) {
+        blockImp(datap, VLTSAVE_BLOCK_SIZE);
+    }
+    if (size) {
+        std::memcpy(m_block.data(), datap, size);
+        m_blockUsed = size;
+    }
+}
+
+void VerilatedSave::blockImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    const uint64_t hash = vlSaveBlockHash(datap, size);
+    const uint64_t blockNum = m_hashes.size();
+    m_hashes.push_back(hash);
+    if (!m_delta) return;
+    if (blockNum < m_prevHashes.size() && m_prevHashes[blockNum] == hash) return;
+    m_changed.push_back(blockNum);
+    writeImp(datap, size);
+    if (size < VLTSAVE_BLOCK_SIZE) {  // Last block, pad so blocks are at fixed offsets
+        const std::vector<uint8_t> padding(VLTSAVE_BLOCK_SIZE - size);
+        writeImp(padding.data(), padding.size());
+    }
 }
 
 void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
@@ -223,12 +677,16 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     for (uint8_t* sp = m_cp; sp < m_endp; *rp++ = *sp++) {}  // Overlaps
     m_endp = m_bufp + (m_endp - m_cp);
     m_cp = m_bufp;  // Reset buffer
+    if (!m_chainFds.empty()) {
+        fillChainImp();
+        return;
+    }
     // Read into buffer starting at m_endp
     while (true) {
         const ssize_t remaining = (m_bufp + bufferSize() - m_endp);
         if (remaining == 0) break;
         errno = 0;
-        const ssize_t got = ::read(m_fd, m_endp, remaining);
+        const ssize_t got = readImp(m_endp, remaining);
         if (got > 0) {
             m_endp += got;
         } else if (VL_UNCOVERABLE(got < 0)) {
@@ -250,6 +708,125 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     }
 }
 
+ssize_t VerilatedRestore::readImp(uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    if (m_mapp) {
+        const size_t blk = std::min(size, m_mapSize - m_mapPos);
+        std::memcpy(datap, m_mapp + m_mapPos, blk);
+        m_mapPos += blk;
+        return blk;
+    }
+    if (m_codec == VerilatedSaveCodec::NONE) return ::read(m_fd, datap, size);
+    if (m_framePos == m_frame.size()) {
+        // Decompress next frame
+        uint32_t frameHeader[2];  // Uncompressed size, compressed size
+        std::vector<uint8_t> in;
+        bool ok = vlSaveReadFully(m_fd, frameHeader, sizeof(frameHeader));
+        if (ok && frameHeader[0] == 0) return 0;  // EOF
+        if (ok) {
+            in.resize(frameHeader[1]);
+            ok = vlSaveReadFully(m_fd, in.data(), in.size());
+        }
+        uLongf outSize = ok ? frameHeader[0] : 0;
+        m_frame.resize(outSize);
+        m_framePos = 0;
+        if (VL_UNLIKELY(!ok
+                        || uncompress(m_frame.data(), &outSize, in.data(), in.size()) != Z_OK
+                        || outSize != frameHeader[0])) {
+            const std::string fn = filename();
+            const std::string msg
+                = "Can't deserialize; compressed save-restore file is corrupt: " + filename();
+            VL_FATAL_MT(fn.c_str(), 0, "", msg.c_str());
+            m_frame.clear();
+            return 0;
+        }
+    }
+    const size_t blk = std::min(size, m_frame.size() - m_framePos);
+    std::memcpy(datap, m_frame.data() + m_framePos, blk);
+    m_framePos += blk;
+    return blk;
+}
+
+VerilatedDeserialize& VerilatedRestore::readBulk(void* __restrict datap,
+                                                 size_t size) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (!m_chainFds.empty()) return VerilatedDeserialize::readBulk(datap, size);
+    // Take what is already buffered, then read the rest directly into place
+    uint8_t* dp = static_cast<uint8_t*>(datap);
+    const size_t buffered = std::min<size_t>(size, m_endp - m_cp);
+    std::memcpy(dp, m_cp, buffered);
+    m_cp += buffered;
+    dp += buffered;
+    size -= buffered;
+    while (size) {
+        errno = 0;
+        const ssize_t got = readImp(dp, size);
+        if (got > 0) {
+            dp += got;
+            size -= got;
+        } else if (VL_UNCOVERABLE(got < 0)) {
+            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+                // LCOV_EXCL_START
+                const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+                VL_FATAL_MT("", 0, "", msg.c_str());
+                close();
+                break;
+                // LCOV_EXCL_STOP
+            }
+        } else {  // got==0, EOF
+            // As fill() does, read NULLs after the end of file
+            std::memset(dp, 0, size);
+            break;
+        }
+    }
+    return *this;  // For function chaining
+}
+
+void VerilatedRestore::fillChainImp() VL_MT_UNSAFE_ONE {
+    // Provide the header, the stream from the chain's blocks, the trailer,
+    // and then NULLs, as fill() would read from a full file
+    const uint64_t headerSize = std::strlen(VLTSAVE_HEADER_STR);
+    const uint64_t streamEnd = headerSize + m_chainStreamSize;
+    const uint64_t trailerEnd = streamEnd + std::strlen(VLTSAVE_TRAILER_STR);
+    uint8_t* const bufEndp = m_bufp + bufferSize();
+    while (m_endp < bufEndp) {
+        uint64_t blk = bufEndp - m_endp;
+        if (m_chainPos < headerSize) {
+            blk = std::min(blk, headerSize - m_chainPos);
+            std::memcpy(m_endp, VLTSAVE_HEADER_STR + m_chainPos, blk);
+        } else if (m_chainPos < streamEnd) {
+            const uint64_t streamPos = m_chainPos - headerSize;
+            const uint64_t blockNum = streamPos / VLTSAVE_BLOCK_SIZE;
+            const std::pair<uint32_t, uint64_t>& block = m_chainBlocks[blockNum];
+            // Read following blocks too when they are contiguous in the same file
+            uint64_t size = VLTSAVE_BLOCK_SIZE - streamPos % VLTSAVE_BLOCK_SIZE;
+            for (uint64_t next = blockNum + 1; size < blk && next < m_chainBlocks.size(); ++next) {
+                if (m_chainBlocks[next].first != block.first) break;
+                const uint64_t offset = block.second + (next - blockNum) * VLTSAVE_BLOCK_SIZE;
+                if (m_chainBlocks[next].second != offset) break;
+                size += VLTSAVE_BLOCK_SIZE;
+            }
+            blk = std::min({blk, size, streamEnd - m_chainPos});
+            if (VL_UNCOVERABLE(!vlSaveReadAt(m_chainFds[block.first],
+                                             block.second + streamPos % VLTSAVE_BLOCK_SIZE,
+                                             m_endp, blk))) {
+                // LCOV_EXCL_START
+                const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+                VL_FATAL_MT("", 0, "", msg.c_str());
+                close();
+                break;
+                // LCOV_EXCL_STOP
+            }
+        } else if (m_chainPos < trailerEnd) {
+            blk = std::min(blk, trailerEnd - m_chainPos);
+            std::memcpy(m_endp, VLTSAVE_TRAILER_STR + (m_chainPos - streamEnd), blk);
+        } else {
+            std::memset(m_endp, 0, blk);
+        }
+        m_endp += blk;
+        m_chainPos += blk;
+    }
+}
+
 //=============================================================================
 // Serialization of types
 
@@ -27,6 +27,7 @@
 #include "verilated.h"
 
 #include <string>
+#include <vector>
 
 //=============================================================================
 // VerilatedSerialize
@@ -78,6 +79,8 @@ public:
     virtual void flush() VL_MT_UNSAFE_ONE {}
     /// Write data to stream
     VerilatedSerialize& write(const void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE {
+        // Large arrays bypass the buffer
+        if (VL_UNLIKELY(size >= bufferInsertSize())) return writeBulk(datap, size);
         const uint8_t* __restrict dp = static_cast<const uint8_t* __restrict>(datap);
         while (size) {
             bufferCheck();
@@ -90,6 +93,11 @@ public:
         return *this;  // For function chaining
     }
 
+protected:
+    // Write a large block of data; default copies through the buffer
+    virtual VerilatedSerialize& writeBulk(const void* __restrict datap,
+                                          size_t size) VL_MT_UNSAFE_ONE;
+
 private:
     VerilatedSerialize& bufferCheck() VL_MT_UNSAFE_ONE {
         // Flush the write buffer if there's not enough space left for new information
@@ -151,6 +159,8 @@ public:
     virtual void flush() VL_MT_UNSAFE_ONE {}
     /// Read data from stream
     VerilatedDeserialize& read(void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE {
+        // Large arrays bypass the buffer
+        if (VL_UNLIKELY(size >= bufferInsertSize())) return readBulk(datap, size);
         uint8_t* __restrict dp = static_cast<uint8_t* __restrict>(datap);
         while (size) {
             bufferCheck();
@@ -170,6 +180,10 @@ public:
         return readAssert(&data, sizeof(data));
     }
 
+protected:
+    // Read a large block of data; default copies through the buffer
+    virtual VerilatedDeserialize& readBulk(void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE;
+
 private:
     bool readDiffers(const void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE;
     VerilatedDeserialize& bufferCheck() VL_MT_UNSAFE_ONE {
@@ -180,6 +194,16 @@ private:
     }
 };
 
+//=============================================================================
+// VerilatedSaveCodec
+/// Compression of save-restore files, see VerilatedSave::compression.
+/// The codec is recorded in the file, so VerilatedRestore detects it.
+
+enum class VerilatedSaveCodec : uint32_t {
+    NONE = 0,  // Uncompressed
+    ZLIB = 1  // Deflate compressed, using zlib
+};
+
 //=============================================================================
 // VerilatedSave
 /// Stream-like object that serializes Verilated model to a file.
@@ -189,9 +213,36 @@ private:
 class VerilatedSave final : public VerilatedSerialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
-
+    uint64_t m_fileSize = 0;  // Bytes written to file
+    // Delta checkpoints: the stream after the header is tracked in fixed size
+    // blocks, and the hash of each block is written in an index at the end of
+    // the file. A delta file only contains the blocks whose hash differs from
+    // the previous checkpoint's.
+    bool m_delta = false;  // Writing a delta file, only changed blocks are written
+    bool m_streaming = false;  // Flushed data is the stream (not header or index)
+    size_t m_blockUsed = 0;  // Bytes used in m_block
+    std::vector<uint8_t> m_block;  // Partial block being hashed
+    std::vector<uint64_t> m_prevHashes;  // Block hashes of previous checkpoint
+    std::vector<uint64_t> m_hashes;  // Block hashes of this checkpoint
+    std::vector<uint64_t> m_changed;  // Block numbers written to delta file
+    // Compression: the file after the codec header is a sequence of
+    // independently compressed frames, so frames may be compressed in parallel
+    VerilatedSaveCodec m_codec = VerilatedSaveCodec::NONE;  // Codec for next open()
+    int m_level = 0;  // Compression level, 0 for codec's default
+    unsigned m_threads = 1;  // Frames to compress in parallel
+    bool m_compressing = false;  // File being written is compressed
+    std::vector<std::vector<uint8_t>> m_frames;  // Frames pending compression, last partial
+
+    void openImp(const char* filenamep) VL_MT_UNSAFE_ONE;
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE;
+    void writeImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void writeFdImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void compressImp() VL_MT_UNSAFE_ONE;
+    VerilatedSerialize& writeBulk(const void* __restrict datap,
+                                  size_t size) override VL_MT_UNSAFE_ONE;
+    void streamImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void blockImp(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
@@ -204,6 +255,22 @@ public:
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
+    /// Open a delta file, which only stores the state that differs from the
+    /// checkpoint in prevFilenamep, itself a full or delta checkpoint file.
+    /// All files of the chain must still exist when restoring.
+    void openDelta(const char* filenamep, const char* prevFilenamep) VL_MT_UNSAFE_ONE;
+    /// Open a delta file; see above
+    void openDelta(const std::string& filename, const std::string& prevFilename) VL_MT_UNSAFE_ONE {
+        openDelta(filename.c_str(), prevFilename.c_str());
+    }
+    /// Compress files opened with open() after this call. Level 0 uses the
+    /// codec's default level. With threads > 1, that many frames of the file
+    /// are compressed in parallel. Delta files are not compressed.
+    void compression(VerilatedSaveCodec codec, int level = 0, unsigned threads = 1) {
+        m_codec = codec;
+        m_level = level;
+        m_threads = threads ? threads : 1;
+    }
     /// Flush and close the file
     void close() override VL_MT_UNSAFE_ONE { closeImp(); }
     /// Flush data to file
@@ -219,9 +286,28 @@ public:
 class VerilatedRestore final : public VerilatedDeserialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
-
+    // Delta checkpoints: when restoring a delta file, the stream is read
+    // block by block from the newest file of the chain that contains the block
+    std::vector<int> m_chainFds;  // Chain files, oldest (the full checkpoint) first
+    std::vector<std::pair<uint32_t, uint64_t>> m_chainBlocks;  // Block's m_chainFds, offset
+    uint64_t m_chainStreamSize = 0;  // Bytes in stream
+    uint64_t m_chainPos = 0;  // Position in stream, including header
+    // Compression, see VerilatedSave
+    VerilatedSaveCodec m_codec = VerilatedSaveCodec::NONE;  // File's codec
+    std::vector<uint8_t> m_frame;  // Decompressed frame
+    size_t m_framePos = 0;  // Bytes of m_frame already read
+    // Uncompressed full files are read through a read-only mapping when possible
+    const uint8_t* m_mapp = nullptr;  // Mapped file, or nullptr if not mapped
+    size_t m_mapSize = 0;  // Bytes in m_mapp
+    size_t m_mapPos = 0;  // Bytes of m_mapp already read
+
+    void openChainImp(const char* filenamep) VL_MT_UNSAFE_ONE;
+    void mapImp() VL_MT_UNSAFE_ONE;
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE {}
+    void fillChainImp() VL_MT_UNSAFE_ONE;
+    ssize_t readImp(uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
+    VerilatedDeserialize& readBulk(void* __restrict datap, size_t size) override VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
@@ -231,7 +317,8 @@ public:
     ~VerilatedRestore() override { closeImp(); }
 
     // METHODS
-    /// Open the file; call isOpen() to see if errors
+    /// Open the file; call isOpen() to see if errors.
+    /// A delta file is restored together with the files it was based on.
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
@@ -300,8 +387,9 @@ inline VerilatedDeserialize& operator>>(VerilatedDeserialize& os, std::string& r
 VerilatedSerialize& operator<<(VerilatedSerialize& os, VerilatedContext* rhsp);
 VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VerilatedContext* rhsp);
 
-template <typename T_Key, typename T_Value>
-VerilatedSerialize& operator<<(VerilatedSerialize& os, VlAssocArray<T_Key, T_Value>& rhs) {
+template <typename T_Key, typename T_Value, bool T_Hashed>
+VerilatedSerialize& operator<<(VerilatedSerialize& os,
+                               VlAssocArray<T_Key, T_Value, T_Hashed>& rhs) {
     os << rhs.atDefault();
     const uint32_t len = rhs.size();
     os << len;
@@ -312,8 +400,9 @@ VerilatedSerialize& operator<<(VerilatedSerialize& os, VlAssocArray<T_Key, T_Val
     }
     return os;
 }
-template <typename T_Key, typename T_Value>
-VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VlAssocArray<T_Key, T_Value>& rhs) {
+template <typename T_Key, typename T_Value, bool T_Hashed>
+VerilatedDeserialize& operator>>(VerilatedDeserialize& os,
+                                 VlAssocArray<T_Key, T_Value, T_Hashed>& rhs) {
     os >> rhs.atDefault();
     uint32_t len = 0;
     os >> len;
@@ -327,5 +416,32 @@ VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VlAssocArray<T_Key, T
     }
     return os;
 }
+// Sparse arrays save only the pages that were accessed
+template <typename T_Value, std::size_t N_Depth>
+VerilatedSerialize& operator<<(VerilatedSerialize& os, VlSparseArray<T_Value, N_Depth>& rhs) {
+    using Array = VlSparseArray<T_Value, N_Depth>;
+    const uint32_t len = rhs.allocatedPages();
+    os << len;
+    for (uint32_t page = 0; page < Array::Pages; ++page) {
+        if (const T_Value* const datap = rhs.findPagep(page)) {
+            os << page;
+            os.write(datap, sizeof(T_Value) * Array::PageSize);
+        }
+    }
+    return os;
+}
+template <typename T_Value, std::size_t N_Depth>
+VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VlSparseArray<T_Value, N_Depth>& rhs) {
+    using Array = VlSparseArray<T_Value, N_Depth>;
+    uint32_t len = 0;
+    os >> len;
+    rhs.clear();
+    for (uint32_t i = 0; i < len; ++i) {
+        uint32_t page = 0;
+        os >> page;
+        os.read(rhs.pagep(page), sizeof(T_Value) * Array::PageSize);
+    }
+    return os;
+}
 
 #endif  // Guard
@@ -0,0 +1,205 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated shared-memory co-simulation server implementation code
+///
+/// This file must be compiled and linked into the model's executable when
+/// it uses VerilatedShmServer.  VerilatedShmClient needs only the header.
+///
+//=============================================================================
+
+#define VERILATOR_VERILATED_SHM_CPP_
+
+#include "verilatedos.h"
+
+#include "verilated_shm.h"
+
+#include "verilated.h"
+#include "verilated_syms.h"
+
+#include <cerrno>
+#include <new>
+
+//=============================================================================
+// VerilatedShmServer
+
+VerilatedShmServer::VerilatedShmServer(VerilatedContext* contextp, const std::string& name,
+                                       std::function<void()> eval, uint32_t frames)
+    : m_contextp{contextp}
+    , m_name{name}
+    , m_frames{[frames] {
+        uint32_t pow2 = 1;
+        while (pow2 < frames) pow2 <<= 1;
+        return pow2;
+    }()}
+    , m_eval{std::move(eval)} {}
+
+uint32_t VerilatedShmServer::addSignal(const std::string& name, void* datap, uint32_t bits) {
+    if (m_headerp) {
+        VL_FATAL_MT(__FILE__, __LINE__, "", "VerilatedShmServer::addSignal called after run()");
+    }
+    if (name.size() >= VerilatedShm::MAX_NAME) {
+        const std::string msg = "VerilatedShmServer signal name longer than "
+                                + std::to_string(VerilatedShm::MAX_NAME - 1)
+                                + " characters: " + name;
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    if (bits == 0 || bits > VerilatedShm::MAX_WORDS * VL_EDATASIZE) {
+        const std::string msg = "VerilatedShmServer signal '" + name + "' width "
+                                + std::to_string(bits) + " not between 1 and "
+                                + std::to_string(VerilatedShm::MAX_WORDS * VL_EDATASIZE);
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    m_signals.push_back({name, datap, bits});
+    return static_cast<uint32_t>(m_signals.size() - 1);
+}
+
+uint32_t VerilatedShmServer::addScopeVar(const std::string& scopeName,
+                                         const std::string& varName) {
+    const VerilatedScope* const scopep = m_contextp->scopeFind(scopeName.c_str());
+    const VerilatedVar* const varp = scopep ? scopep->varFind(varName.c_str()) : nullptr;
+    if (!varp || varp->udims() != 0 || varp->vltype() < VLVT_UINT8
+        || varp->vltype() > VLVT_WDATA) {
+        const std::string msg = "VerilatedShmServer cannot find public packed variable '"
+                                + scopeName + "." + varName + "'";
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    return addSignal(scopeName + "." + varName, varp->datap(), varp->entBits());
+}
+
+void VerilatedShmServer::create() {
+    const uint32_t ports = static_cast<uint32_t>(m_signals.size());
+    const size_t size = VerilatedShm::mapSize(ports, m_frames);
+    // Remove any object left by a killed earlier run
+    shm_unlink(m_name.c_str());
+    const int fd = shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0 || ftruncate(fd, static_cast<off_t>(size)) < 0) {
+        const std::string msg = "VerilatedShmServer cannot create shared memory " + m_name
+                                + ": " + std::strerror(errno);
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    void* const mapp = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapp == MAP_FAILED) {
+        const std::string msg = "VerilatedShmServer cannot map shared memory " + m_name + ": "
+                                + std::strerror(errno);
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    // ftruncate zero filled the object, so only non-zero fields need writing
+    m_headerp = new (mapp) VerilatedShm::Header;
+    m_headerp->magic = VerilatedShm::MAGIC;
+    m_headerp->frames = m_frames;
+    m_headerp->size = size;
+    m_headerp->ports = ports;
+    VerilatedShm::Port* const portsp = reinterpret_cast<VerilatedShm::Port*>(
+        static_cast<char*>(mapp) + VerilatedShm::portsOffset());
+    for (uint32_t i = 0; i < ports; ++i) {
+        std::strcpy(portsp[i].name, m_signals[i].name.c_str());
+        portsp[i].bits = m_signals[i].bits;
+    }
+    m_headerp->ready.store(1, std::memory_order_release);
+}
+
+void VerilatedShmServer::destroy() {
+    if (!m_headerp) return;
+    munmap(m_headerp, m_headerp->size);
+    shm_unlink(m_name.c_str());
+    m_headerp = nullptr;
+}
+
+const VerilatedShmServer::Signal& VerilatedShmServer::signal(uint32_t index) const {
+    if (VL_UNLIKELY(index >= m_signals.size())) {
+        const std::string msg = "VerilatedShmServer client accessed signal index "
+                                + std::to_string(index) + " but only "
+                                + std::to_string(m_signals.size()) + " are registered";
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    return m_signals[index];
+}
+
+void VerilatedShmServer::poke(const VerilatedShm::Frame& frame) {
+    const Signal& sig = signal(frame.index);
+    if (sig.bits <= 8) {
+        *static_cast<CData*>(sig.datap) = static_cast<CData>(frame.words[0] & VL_MASK_I(sig.bits));
+    } else if (sig.bits <= 16) {
+        *static_cast<SData*>(sig.datap) = static_cast<SData>(frame.words[0] & VL_MASK_I(sig.bits));
+    } else if (sig.bits <= VL_IDATASIZE) {
+        *static_cast<IData*>(sig.datap) = frame.words[0] & VL_MASK_I(sig.bits);
+    } else if (sig.bits <= VL_QUADSIZE) {
+        *static_cast<QData*>(sig.datap)
+            = VL_SET_QII(frame.words[1], frame.words[0]) & VL_MASK_Q(sig.bits);
+    } else {
+        EData* const owp = static_cast<EData*>(sig.datap);
+        const int words = VL_WORDS_I(sig.bits);
+        for (int i = 0; i < words; ++i) owp[i] = frame.words[i];
+        owp[words - 1] &= VL_MASK_E(sig.bits);
+    }
+}
+
+void VerilatedShmServer::peek(const VerilatedShm::Frame& frame,
+                              VerilatedShm::Frame& reply) const {
+    const Signal& sig = signal(frame.index);
+    if (sig.bits <= 8) {
+        reply.words[0] = *static_cast<const CData*>(sig.datap);
+    } else if (sig.bits <= 16) {
+        reply.words[0] = *static_cast<const SData*>(sig.datap);
+    } else if (sig.bits <= VL_IDATASIZE) {
+        reply.words[0] = *static_cast<const IData*>(sig.datap);
+    } else if (sig.bits <= VL_QUADSIZE) {
+        const QData value = *static_cast<const QData*>(sig.datap);
+        reply.words[0] = static_cast<uint32_t>(value);
+        reply.words[1] = static_cast<uint32_t>(value >> 32);
+    } else {
+        const EData* const iwp = static_cast<const EData*>(sig.datap);
+        const int words = VL_WORDS_I(sig.bits);
+        for (int i = 0; i < words; ++i) reply.words[i] = iwp[i];
+    }
+}
+
+void VerilatedShmServer::run() {
+    create();
+    char* const framesp
+        = reinterpret_cast<char*>(m_headerp) + VerilatedShm::framesOffset(m_headerp->ports);
+    VerilatedShm::Frame* const toServerp = reinterpret_cast<VerilatedShm::Frame*>(framesp);
+    VerilatedShm::Endpoint commands{&m_headerp->toServer, toServerp, m_frames};
+    VerilatedShm::Endpoint replies{&m_headerp->toClient, toServerp + m_frames, m_frames};
+    while (true) {
+        const VerilatedShm::Frame& frame = commands.front();
+        const uint32_t cmd = frame.cmd;
+        if (cmd == VerilatedShm::CMD_POKE) {
+            poke(frame);
+        } else if (cmd == VerilatedShm::CMD_TIME) {
+            m_contextp->time(frame.value);
+        } else if (cmd == VerilatedShm::CMD_TIME_INC) {
+            m_contextp->timeInc(frame.value);
+        } else {
+            VerilatedShm::Frame& reply = replies.alloc();
+            reply.cmd = VerilatedShm::CMD_REPLY;
+            reply.index = frame.index;
+            reply.value = 0;
+            if (cmd == VerilatedShm::CMD_PEEK) {
+                peek(frame, reply);
+            } else if (cmd == VerilatedShm::CMD_EVAL) {
+                m_eval();
+                reply.value = m_contextp->time()
+                              | (m_contextp->gotFinish() ? (1ULL << 63) : 0ULL);
+            }
+            replies.push();
+        }
+        commands.pop();
+        if (cmd == VerilatedShm::CMD_FINISH) break;
+    }
+    // Leave the reply to finish readable; the client has its own mapping
+    destroy();
+}
@@ -0,0 +1,353 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated shared-memory co-simulation transport
+///
+/// Lets a testbench in another process drive a Verilated model through two
+/// lock-free single-producer single-consumer rings in POSIX shared memory,
+/// one carrying commands to the model, the other replies back.
+///
+/// The model process creates a VerilatedShmServer, registers the signals the
+/// testbench may access, then calls run().  The testbench process creates a
+/// VerilatedShmClient with the same name; the client only needs this header
+/// and verilatedos.h, not the rest of the Verilator runtime.
+///
+/// Pokes and time changes are not acknowledged, so a client can queue a
+/// cycle's worth of commands and only wait on the peeks and evals it needs.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_SHM_H_
+#define VERILATOR_VERILATED_SHM_H_
+
+#include "verilatedos.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+class VerilatedContext;
+
+//=============================================================================
+// Shared memory layout, common to server and client
+
+namespace VerilatedShm {
+
+constexpr uint32_t MAGIC = 0x56534d31UL;  // "VSM1"
+constexpr int MAX_WORDS = 12;  // Maximum 32-bit words in a frame, so widest signal
+constexpr int MAX_NAME = 48;  // Maximum signal name length, including terminator
+
+enum Cmd : uint32_t {
+    CMD_POKE,  // Set signal index to words
+    CMD_PEEK,  // Reply with signal index's value
+    CMD_EVAL,  // Evaluate model, reply with time and finish flag
+    CMD_TIME,  // Set simulation time to value
+    CMD_TIME_INC,  // Advance simulation time by value
+    CMD_FINISH,  // Stop serving, reply when done
+    CMD_REPLY  // Reply to the above
+};
+
+// One command or reply, a cache line
+struct Frame final {
+    uint32_t cmd;  // Cmd
+    uint32_t index;  // Signal index for POKE/PEEK
+    uint64_t value;  // Time for TIME/TIME_INC/EVAL reply; finish flag in bit 63 of EVAL reply
+    uint32_t words[MAX_WORDS];  // Signal value for POKE/PEEK reply, LSB first
+};
+static_assert(sizeof(Frame) == 64, "Frame should be one cache line");
+
+// Signal directory entry, written once by the server before it is ready
+struct Port final {
+    char name[MAX_NAME];
+    uint32_t bits;
+    uint32_t reserved[3];
+};
+static_assert(sizeof(Port) == 64, "Port should be one cache line");
+
+// Index of producer and consumer on separate cache lines to avoid false sharing
+struct Ring final {
+    alignas(64) std::atomic<uint64_t> head{0};  // Written by producer
+    alignas(64) std::atomic<uint64_t> tail{0};  // Written by consumer
+};
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory rings need lock free 64-bit atomics");
+
+struct Header final {
+    uint32_t magic;
+    uint32_t frames;  // Frames in each ring, a power of two
+    uint64_t size;  // Total mapped size, in bytes
+    uint32_t ports;  // Entries in Port directory
+    std::atomic<uint32_t> ready;  // Set by server when directory is complete
+    alignas(64) Ring toServer;
+    Ring toClient;
+};
+
+// Byte offsets of each part of the mapping
+inline size_t portsOffset() { return sizeof(Header); }
+inline size_t framesOffset(uint32_t ports) { return sizeof(Header) + ports * sizeof(Port); }
+inline size_t mapSize(uint32_t ports, uint32_t frames) {
+    return framesOffset(ports) + 2 * static_cast<size_t>(frames) * sizeof(Frame);
+}
+
+// Wait for another process, spinning first as latency matters more than CPU,
+// unless there is a single CPU, when spinning just delays the other process
+template <typename T_Cond>
+inline void spinUntil(T_Cond cond) {
+    static const unsigned s_maxSpins = std::thread::hardware_concurrency() > 1 ? 4096 : 0;
+    for (unsigned spins = 0; !cond(); ++spins) {
+        if (spins < s_maxSpins) {
+            VL_CPU_RELAX();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Producer or consumer end of a ring
+class Endpoint final {
+    Ring* m_ringp = nullptr;
+    Frame* m_framesp = nullptr;
+    uint64_t m_mask = 0;
+
+public:
+    Endpoint() = default;
+    Endpoint(Ring* ringp, Frame* framesp, uint32_t frames)
+        : m_ringp{ringp}
+        , m_framesp{framesp}
+        , m_mask{frames - 1U} {}
+    // Producer: return next free frame, waiting if full; then push() it
+    Frame& alloc() {
+        const uint64_t head = m_ringp->head.load(std::memory_order_relaxed);
+        spinUntil([&] {
+            return head - m_ringp->tail.load(std::memory_order_acquire) <= m_mask;
+        });
+        return m_framesp[head & m_mask];
+    }
+    void push() {
+        m_ringp->head.store(m_ringp->head.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_release);
+    }
+    // Consumer: return next frame, waiting if empty; then pop() it
+    const Frame& front() {
+        const uint64_t tail = m_ringp->tail.load(std::memory_order_relaxed);
+        spinUntil([&] { return m_ringp->head.load(std::memory_order_acquire) != tail; });
+        return m_framesp[tail & m_mask];
+    }
+    void pop() {
+        m_ringp->tail.store(m_ringp->tail.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_release);
+    }
+};
+
+}  // namespace VerilatedShm
+
+//=============================================================================
+// VerilatedShmServer
+/// Serves a Verilated model to a VerilatedShmClient in another process.
+///
+/// Register the accessible signals with addSignal() or addScopeVar(), then
+/// call run(), which returns when the client calls finish().
+///
+/// This class is not thread safe, it must be called by a single thread.
+
+class VerilatedShmServer final {
+    // TYPES
+    struct Signal final {
+        std::string name;
+        void* datap;
+        uint32_t bits;
+    };
+
+    // MEMBERS
+    VerilatedContext* const m_contextp;  // Context for time and finish
+    const std::string m_name;  // Shared memory object name
+    const uint32_t m_frames;  // Frames in each ring
+    const std::function<void()> m_eval;  // Evaluate model
+    std::vector<Signal> m_signals;  // Registered signals, by index
+    VerilatedShm::Header* m_headerp = nullptr;  // Mapping, or nullptr before run()
+
+    VL_UNCOPYABLE(VerilatedShmServer);
+
+    void create();
+    void destroy();
+    const Signal& signal(uint32_t index) const;
+    void poke(const VerilatedShm::Frame& frame);
+    void peek(const VerilatedShm::Frame& frame, VerilatedShm::Frame& reply) const;
+
+public:
+    /// Construct, to serve through the shared memory object 'name' (which
+    /// must start with '/'), calling 'eval' to evaluate the model.
+    /// 'frames' is the capacity of each ring, rounded up to a power of two.
+    VerilatedShmServer(VerilatedContext* contextp, const std::string& name,
+                       std::function<void()> eval, uint32_t frames = 1024);
+    ~VerilatedShmServer() { destroy(); }
+
+    /// Register a signal of 'bits' width stored at 'datap', in the
+    /// Verilated representation for that width (CData, SData, IData,
+    /// QData or VlWide).  Returns its index.
+    uint32_t addSignal(const std::string& name, void* datap, uint32_t bits);
+    /// Register a public variable found by scope and name, as VPI would.
+    /// Returns its index.
+    uint32_t addScopeVar(const std::string& scopeName, const std::string& varName);
+    /// Serve commands until the client finishes
+    void run();
+};
+
+//=============================================================================
+// VerilatedShmClient
+/// Drives a model served by VerilatedShmServer in another process.
+///
+/// Only depends on this header, so may be built into a testbench without
+/// the Verilator runtime.  Errors throw std::runtime_error.
+///
+/// This class is not thread safe, it must be called by a single thread.
+
+class VerilatedShmClient final {
+    // MEMBERS
+    VerilatedShm::Header* m_headerp = nullptr;  // Mapping
+    VerilatedShm::Endpoint m_toServer;  // Commands
+    VerilatedShm::Endpoint m_toClient;  // Replies
+    bool m_gotFinish = false;  // Model called $finish on last eval
+
+    VL_UNCOPYABLE(VerilatedShmClient);
+
+    const VerilatedShm::Port* portsp() const {
+        return reinterpret_cast<const VerilatedShm::Port*>(reinterpret_cast<char*>(m_headerp)
+                                                           + VerilatedShm::portsOffset());
+    }
+    void send(uint32_t cmd, uint32_t index, uint64_t value) {
+        VerilatedShm::Frame& frame = m_toServer.alloc();
+        frame.cmd = cmd;
+        frame.index = index;
+        frame.value = value;
+        m_toServer.push();
+    }
+    uint64_t wait(uint32_t* wordsp = nullptr, int words = 0) {
+        const VerilatedShm::Frame& frame = m_toClient.front();
+        const uint64_t value = frame.value;
+        if (wordsp) std::memcpy(wordsp, frame.words, words * sizeof(uint32_t));
+        m_toClient.pop();
+        return value;
+    }
+
+public:
+    /// Connect to the server's shared memory object 'name', waiting for
+    /// the server to have created it, up to 'timeoutMs' milliseconds
+    explicit VerilatedShmClient(const std::string& name, unsigned timeoutMs = 10000) {
+        int fd = -1;
+        for (unsigned ms = 0; (fd = shm_open(name.c_str(), O_RDWR, 0)) < 0; ++ms) {
+            if (ms >= timeoutMs) throw std::runtime_error{"Cannot open shared memory " + name};
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        // Map the header to find the size, then the whole object
+        struct stat st;
+        while (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) < sizeof(*m_headerp)) {
+            std::this_thread::yield();
+        }
+        void* const mapp
+            = mmap(nullptr, sizeof(*m_headerp), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapp == MAP_FAILED) throw std::runtime_error{"Cannot map shared memory " + name};
+        m_headerp = static_cast<VerilatedShm::Header*>(mapp);
+        VerilatedShm::spinUntil(
+            [this] { return m_headerp->ready.load(std::memory_order_acquire) != 0; });
+        if (m_headerp->magic != VerilatedShm::MAGIC) {
+            throw std::runtime_error{"Shared memory " + name + " is not a Verilated model"};
+        }
+        const size_t size = m_headerp->size;
+        munmap(m_headerp, sizeof(*m_headerp));
+        void* const fullp = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (fullp == MAP_FAILED) throw std::runtime_error{"Cannot map shared memory " + name};
+        m_headerp = static_cast<VerilatedShm::Header*>(fullp);
+        char* const framesp
+            = reinterpret_cast<char*>(m_headerp) + VerilatedShm::framesOffset(m_headerp->ports);
+        VerilatedShm::Frame* const toServerp = reinterpret_cast<VerilatedShm::Frame*>(framesp);
+        m_toServer = {&m_headerp->toServer, toServerp, m_headerp->frames};
+        m_toClient = {&m_headerp->toClient, toServerp + m_headerp->frames, m_headerp->frames};
+    }
+    ~VerilatedShmClient() {
+        if (m_headerp) munmap(m_headerp, m_headerp->size);
+    }
+
+    /// Return index of signal, or throw if not registered by the server
+    uint32_t index(const std::string& name) const {
+        for (uint32_t i = 0; i < m_headerp->ports; ++i) {
+            if (name == portsp()[i].name) return i;
+        }
+        throw std::runtime_error{"No signal '" + name + "' served"};
+    }
+    /// Return width of signal index in bits, or throw if not registered by the server
+    uint32_t bits(uint32_t index) const {
+        if (index >= m_headerp->ports) {
+            throw std::runtime_error{"No signal index " + std::to_string(index) + " served"};
+        }
+        return portsp()[index].bits;
+    }
+
+    /// Set a signal of up to 64 bits
+    void poke(uint32_t index, uint64_t value) {
+        uint32_t words[VerilatedShm::MAX_WORDS] = {};
+        words[0] = static_cast<uint32_t>(value);
+        words[1] = static_cast<uint32_t>(value >> 32);
+        pokeWide(index, words);
+    }
+    /// Set a signal from (bits + 31) / 32 words, LSB first
+    void pokeWide(uint32_t index, const uint32_t* wordsp) {
+        VerilatedShm::Frame& frame = m_toServer.alloc();
+        frame.cmd = VerilatedShm::CMD_POKE;
+        frame.index = index;
+        std::memcpy(frame.words, wordsp, ((bits(index) + 31) / 32) * sizeof(uint32_t));
+        m_toServer.push();
+    }
+    /// Return a signal of up to 64 bits
+    uint64_t peek(uint32_t index) {
+        uint32_t words[VerilatedShm::MAX_WORDS] = {};
+        peekWide(index, words);
+        return words[0] | (static_cast<uint64_t>(words[1]) << 32);
+    }
+    /// Read a signal into (bits + 31) / 32 words, LSB first
+    void peekWide(uint32_t index, uint32_t* wordsp) {
+        send(VerilatedShm::CMD_PEEK, index, 0);
+        wait(wordsp, (bits(index) + 31) / 32);
+    }
+    /// Evaluate the model, return simulation time
+    uint64_t eval() {
+        send(VerilatedShm::CMD_EVAL, 0, 0);
+        const uint64_t value = wait();
+        m_gotFinish = value >> 63;
+        return value & ~(1ULL << 63);
+    }
+    /// Set simulation time
+    void time(uint64_t value) { send(VerilatedShm::CMD_TIME, 0, value); }
+    /// Advance simulation time
+    void timeInc(uint64_t value) { send(VerilatedShm::CMD_TIME_INC, 0, value); }
+    /// Return true if the model called $finish, as of the last eval()
+    bool gotFinish() const { return m_gotFinish; }
+    /// Stop the server, which returns from run()
+    void finish() {
+        send(VerilatedShm::CMD_FINISH, 0, 0);
+        wait();
+    }
+};
+
+#endif  // Guard
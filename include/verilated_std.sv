@@ -29,6 +29,8 @@
 // verilator lint_off TIMESCALEMOD
 // verilator lint_off UNUSEDSIGNAL
 package std;
+   // The mailbox and semaphore only suspend when blocked; available messages and keys are
+   // taken directly, without involving the scheduler.
    class mailbox #(type T);
       protected int m_bound;
       protected T m_queue[$];
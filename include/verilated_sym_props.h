@@ -252,6 +252,8 @@ class VerilatedVar final : public VerilatedVarProps {
     // MEMBERS
     void* const m_datap;  // Location of data
     const char* const m_namep;  // Name - slowpath
+    CData* m_dirtyp = nullptr;  // Set by model on write, if --vpi-dirty
+    CData* m_anyDirtyp = nullptr;  // Set by model on any m_dirtyp write, if --vpi-dirty
 protected:
     const bool m_isParam;
     friend class VerilatedScope;
@@ -269,6 +271,15 @@ public:
     void* datap() const { return m_datap; }
     const char* name() const { return m_namep; }
     bool isParam() const { return m_isParam; }
+    // Dirty flag, or nullptr if writes are not tracked
+    CData* dirtyp() const { return m_dirtyp; }
+    CData* anyDirtyp() const { return m_anyDirtyp; }
+    void markDirty() const {
+        if (m_dirtyp) {
+            *m_dirtyp = 1;
+            *m_anyDirtyp = 1;
+        }
+    }
 };
 
 #endif  // Guard
@@ -34,6 +34,7 @@
 #include "verilated.h"
 #include "verilated_sym_props.h"
 
+#include <algorithm>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -57,10 +58,60 @@ public:
 
 // Map of sorted variable names to find associated variable class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
-class VerilatedVarNameMap final : public std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
+// Kept as a sorted vector rather than a std::map, so a scope's variables are one
+// allocation instead of a heap node each.  Verilator inserts variables in sorted
+// order, so insertion normally appends.
+class VerilatedVarNameMap final {
+public:
+    using value_type = std::pair<const char*, VerilatedVar>;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+private:
+    std::vector<value_type> m_vars;  // Sorted by name
+
+    template <typename T_Vector>
+    static auto lowerBound(T_Vector& vars, const char* namep) -> decltype(vars.begin()) {
+        return std::lower_bound(vars.begin(), vars.end(), namep,
+                                [](const value_type& a, const char* b) {
+                                    return VerilatedCStrCmp{}(a.first, b);
+                                });
+    }
+    template <typename T_Vector>
+    static auto findIn(T_Vector& vars, const char* namep) -> decltype(vars.begin()) {
+        const auto it = lowerBound(vars, namep);
+        if (it != vars.end() && !VerilatedCStrCmp{}(namep, it->first)) return it;
+        return vars.end();
+    }
+
 public:
     VerilatedVarNameMap() = default;
     ~VerilatedVarNameMap() = default;
+    iterator begin() { return m_vars.begin(); }
+    iterator end() { return m_vars.end(); }
+    const_iterator begin() const { return m_vars.begin(); }
+    const_iterator end() const { return m_vars.end(); }
+    size_t size() const { return m_vars.size(); }
+    bool empty() const { return m_vars.empty(); }
+    iterator find(const char* namep) { return findIn(m_vars, namep); }
+    const_iterator find(const char* namep) const { return findIn(m_vars, namep); }
+    // Insert unless already present, as with std::map::emplace
+    void emplace(const char* namep, const VerilatedVar& var) {
+        if (m_vars.empty() || VerilatedCStrCmp{}(m_vars.back().first, namep)) {
+            m_vars.emplace_back(namep, var);
+            return;
+        }
+        const auto it = lowerBound(m_vars, namep);
+        if (!VerilatedCStrCmp{}(namep, it->first)) return;  // Duplicate
+        // Out of order, rebuild as VerilatedVar is not assignable
+        std::vector<value_type> vars;
+        vars.reserve(m_vars.size() + 1);
+        for (auto vit = m_vars.begin(); vit != m_vars.end(); ++vit) {
+            if (vit == it) vars.emplace_back(namep, var);
+            vars.emplace_back(*vit);
+        }
+        m_vars.swap(vars);
+    }
 };
 
 // Map of parent scope to vector of children scopes
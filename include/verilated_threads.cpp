@@ -25,6 +25,7 @@
 
 #include "verilated_threads.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
 #include <iostream>
@@ -35,6 +36,13 @@
 #include <pthread_np.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define VL_THREADS_FUTEX
+#endif
+
 //=============================================================================
 // Globals
 
@@ -54,11 +62,15 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
 //=============================================================================
 // VlWorkerThread
 
-VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
-    : m_ready_size{0}
-    , m_cthread{startWorker, this, contextp} {}
+VlWorkerThread::VlWorkerThread(VerilatedContext* contextp, bool shared, unsigned workerId)
+    : m_adaptiveWait{contextp->threadsWaitAdaptive()}
+    , m_shared{shared}
+    , m_workerId{workerId}
+    // Workers of a shared pool take the context from each task instead
+    , m_cthread{startWorker, this, shared ? nullptr : contextp} {}
 
 VlWorkerThread::~VlWorkerThread() {
+    if (!m_cthread.joinable()) return;  // Already shut down by VlThreadPool
     shutdown();
     // The thread should exit; join it.
     m_cthread.join();
@@ -70,17 +82,133 @@ static void shutdownTask(void*, bool) {  // LCOV_EXCL_LINE
 
 void VlWorkerThread::shutdown() { addTask(shutdownTask, nullptr); }
 
+void VlWorkerThread::restart(VerilatedContext* contextp) {
+    m_cthread = std::thread{startWorker, this, m_shared ? nullptr : contextp};
+}
+
 void VlWorkerThread::wait() {
-    // Enqueue a task that sets this flag. Execution is in-order so this ensures completion.
+    // Enqueue a task that sets this flag. Execution is in-order so this ensures completion,
+    // except for tasks stolen by other workers, which are counted in m_stolenRunning.
     std::atomic<bool> flag{false};
     addTask([](void* flagp, bool) { static_cast<std::atomic<bool>*>(flagp)->store(true); }, &flag);
+    const auto done = [&]() { return flag.load() && !m_stolenRunning.load(); };
     // Spin wait
     for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-        if (flag.load()) return;
+        if (done()) return;
         VL_CPU_RELAX();
     }
     // Yield wait
-    while (!flag.load()) std::this_thread::yield();
+    while (!done()) std::this_thread::yield();
+}
+
+void VlWorkerThread::addStealableTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle) VL_MT_SAFE {
+    VlThreadPool* const poolp = m_poolp.load(std::memory_order_acquire);
+    const bool stealing = poolp && poolp->stealing();
+    m_ready.push(ExecRec{fnp, selfp, evenCycle, taskContextp()}, stealing);
+    // If we are busy, or have other tasks pending, make sure some other worker wakes up
+    // to take the task. This is also required for progress: the task might be a
+    // dependency of the one we are running, which we might have stolen.
+    const bool notified = notifyIfWaiting();
+    if (stealing && (!notified || m_ready.size() > 1)) poolp->notifyIdle(this);
+}
+
+bool VlWorkerThread::tryDequeWork(ExecRec* workp) {
+    m_stolenFromp = nullptr;
+    VlThreadPool* const poolp = m_poolp.load(std::memory_order_acquire);
+    if (m_ready.pop(workp, false)) {
+        // We will be busy, so wake a thief if the next task could be stolen
+        if (poolp && poolp->stealing() && m_ready.headStealable()) poolp->notifyIdle(this);
+        return true;
+    }
+    if (VL_UNLIKELY(!poolp)) return false;
+    if (poolp->m_dynamicReady.pop(workp, false)) return true;
+    return poolp->stealing() && trySteal(poolp, workp);
+}
+
+bool VlWorkerThread::trySteal(VlThreadPool* poolp, ExecRec* workp) {
+    const unsigned nWorkers = poolp->numThreads();
+    for (unsigned n = 0; n < nWorkers; ++n) {
+        if (++m_stealNext >= nWorkers) m_stealNext = 0;
+        VlWorkerThread* const victimp = poolp->workerp(m_stealNext);
+        if (victimp == this || !victimp->m_ready.headStealable()) continue;
+        // Count before popping, so victim's wait() cannot miss this task
+        victimp->m_stolenRunning.fetch_add(1);
+        if (victimp->m_ready.pop(workp, true)) {
+            m_stolenFromp = victimp;
+            // Wake another thief if the victim has more that could be stolen
+            if (victimp->m_ready.headStealable()) poolp->notifyIdle(victimp);
+            return true;
+        }
+        victimp->m_stolenRunning.fetch_sub(1);
+    }
+    return false;
+}
+
+bool VlWorkerThread::hasWork() const {
+    if (!m_ready.empty()) return true;
+    const VlThreadPool* const poolp = m_poolp.load(std::memory_order_acquire);
+    if (VL_UNLIKELY(!poolp)) return false;
+    if (!poolp->m_dynamicReady.empty()) return true;
+    if (!poolp->stealing()) return false;
+    for (const VlWorkerThread* const workerp : poolp->m_workers) {
+        if (workerp->m_ready.headStealable()) return true;
+    }
+    return false;
+}
+
+void VlWorkerThread::park(ExecRec* workp, bool spun,
+                          std::chrono::steady_clock::time_point spinStart)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    if (tryDequeWork(workp)) return;
+    m_statParks.store(m_statParks.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    if (!m_adaptiveWait) {
+        do { parkCv(); } while (!tryDequeWork(workp));
+        return;
+    }
+    const auto parkStart = std::chrono::steady_clock::now();
+    do { parkFutex(); } while (!tryDequeWork(workp));
+    if (!spun) return;
+    // If we were parked for less time than we spun, work arrived just after we gave up,
+    // so spin longer next time. Otherwise spinning was wasted, so spin less.
+    const auto parkEnd = std::chrono::steady_clock::now();
+    if (parkEnd - parkStart < parkStart - spinStart) {
+        spinLonger();
+    } else {
+        spinShorter();
+    }
+}
+
+void VlWorkerThread::parkCv() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    VerilatedLockGuard lock{m_mutex};
+    m_parked.store(PARKED_CV, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with notifyIfWaiting
+    m_cv.wait(m_mutex, [this]() VL_REQUIRES(m_mutex) { return hasWork(); });
+    m_parked.store(RUNNING, std::memory_order_relaxed);
+}
+
+void VlWorkerThread::parkFutex() {
+#ifdef VL_THREADS_FUTEX
+    // Read sequence number before the final check, so a wakeup after it is not lost
+    const uint32_t seq = m_parkSeq.load(std::memory_order_seq_cst);
+    m_parked.store(PARKED_FUTEX, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with notifyIfWaiting
+    if (!hasWork()) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_parkSeq), FUTEX_WAIT_PRIVATE, seq,
+                nullptr, nullptr, 0);
+    }
+    m_parked.store(RUNNING, std::memory_order_relaxed);
+#else
+    parkCv();
+#endif
+}
+
+void VlWorkerThread::wakeFutex() {
+    m_parkSeq.fetch_add(1, std::memory_order_seq_cst);
+#ifdef VL_THREADS_FUTEX
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_parkSeq), FUTEX_WAKE_PRIVATE, 1, nullptr,
+            nullptr, 0);
+#endif
 }
 
 void VlWorkerThread::workerLoop() {
@@ -91,31 +219,213 @@ void VlWorkerThread::workerLoop() {
 
     while (true) {
         if (VL_UNLIKELY(work.m_fnp == shutdownTask)) break;
-        work.m_fnp(work.m_selfp, work.m_evenCycle);
+        work.execute();
+        if (VL_UNLIKELY(m_stolenFromp)) m_stolenFromp->m_stolenRunning.fetch_sub(1);
         // Wait for next task with spinning.
         dequeWork</* SpinWait: */ true>(&work);
     }
 }
 
 void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp) {
-    Verilated::threadContextp(contextp);
+    if (contextp) Verilated::threadContextp(contextp);
+    Verilated::threadWorkerId(workerp->m_workerId);
     workerp->workerLoop();
 }
 
 //=============================================================================
 // VlThreadPool
 
-VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
+VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads, bool shared)
+    : m_shared{shared}
+    , m_stealing{contextp->threadsStealing() && nThreads > 1} {
     for (unsigned i = 0; i < nThreads; ++i) {
-        m_workers.push_back(new VlWorkerThread{contextp});
+        m_workers.push_back(new VlWorkerThread{contextp, shared, i + 1});
         m_unassignedWorkers.push(i);
     }
-    m_numaStatus = numaAssign();
+    // Workers may only look at each other once all are constructed
+    for (VlWorkerThread* const workerp : m_workers) workerp->m_poolp.store(this);
+    const std::string cpus = contextp->threadsCpus();
+    m_numaStatus = cpus.empty() ? numaAssign() : cpuListAssign(cpus);
 }
 
 VlThreadPool::~VlThreadPool() {
-    // Each ~WorkerThread will wait for its thread to exit.
-    for (auto& i : m_workers) delete i;
+    // Stop all workers before deleting any, as they might be stealing from each other
+    stopWorkers();
+    for (VlWorkerThread* const workerp : m_workers) delete workerp;
+}
+
+void VlThreadPool::stopWorkers() {
+    for (VlWorkerThread* const workerp : m_workers) {
+        if (workerp->m_cthread.joinable()) workerp->shutdown();
+    }
+    for (VlWorkerThread* const workerp : m_workers) {
+        if (workerp->m_cthread.joinable()) workerp->m_cthread.join();
+    }
+}
+
+void VlThreadPool::startWorkers(VerilatedContext* contextp) {
+    for (VlWorkerThread* const workerp : m_workers) workerp->restart(contextp);
+    // New threads have the affinity of the calling thread, so assign again
+    const std::string cpus = contextp->threadsCpus();
+    m_numaStatus = cpus.empty() ? numaAssign() : cpuListAssign(cpus);
+}
+
+std::shared_ptr<VlThreadPool> VlThreadPool::shared(VerilatedContext* contextp,
+                                                    unsigned nThreads) {
+    static VerilatedMutex s_mutex;
+    static std::weak_ptr<VlThreadPool> s_poolw VL_GUARDED_BY(s_mutex);
+    const VerilatedLockGuard lock{s_mutex};
+    std::shared_ptr<VlThreadPool> poolp = s_poolw.lock();
+    if (poolp) {
+        if (VL_UNLIKELY(static_cast<unsigned>(poolp->numThreads()) < nThreads)) {
+            const std::string msg = "Shared thread pool has "
+                                    + std::to_string(poolp->numThreads() + 1)
+                                    + " threads, but VerilatedContext requested "
+                                    + std::to_string(nThreads + 1);
+            VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+        }
+        return poolp;
+    }
+    // The first context's settings (stealing, wait policy, CPU list) apply to the pool
+    const unsigned hardwareThreads = std::thread::hardware_concurrency();
+    const unsigned sharedThreads = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    poolp.reset(new VlThreadPool{contextp, std::max(nThreads, sharedThreads), true});
+    s_poolw = poolp;
+    return poolp;
+}
+
+void VlThreadPool::assignSharedWorkerIndexes(size_t n, size_t* indexesp)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        const uint64_t ticket = m_assignTicketNext++;
+        m_assignCv.wait(m_mutex, [&]() VL_REQUIRES(m_mutex) {
+            return ticket == m_assignTicketServing && m_unassignedWorkers.size() >= n;
+        });
+        for (size_t i = 0; i < n; ++i) {
+            indexesp[i] = m_unassignedWorkers.top();
+            m_unassignedWorkers.pop();
+        }
+        ++m_assignTicketServing;
+    }
+    // The next graph in line might fit in the remaining workers
+    m_assignCv.notify_all();
+}
+
+void VlThreadPool::freeSharedWorkerIndexes(size_t n, const size_t* indexesp)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        for (size_t i = 0; i < n; ++i) m_unassignedWorkers.push(indexesp[i]);
+    }
+    m_assignCv.notify_all();
+}
+
+void VlThreadPool::fatalShared() {
+    VL_FATAL_MT(__FILE__, __LINE__, "",
+                "Models Verilated with --hierarchical cannot use a shared thread pool");
+}
+
+uint64_t VlThreadPool::statSpinHits() const {
+    uint64_t sum = 0;
+    for (const VlWorkerThread* const workerp : m_workers) sum += workerp->statSpinHits();
+    return sum;
+}
+
+uint64_t VlThreadPool::statParks() const {
+    uint64_t sum = 0;
+    for (const VlWorkerThread* const workerp : m_workers) sum += workerp->statParks();
+    return sum;
+}
+
+void VlThreadPool::notifyIdle(const VlWorkerThread* busyp) {
+    for (VlWorkerThread* const workerp : m_workers) {
+        if (workerp != busyp && workerp->notifyIfWaiting()) return;
+    }
+}
+
+void VlThreadPool::addDynamicTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle) VL_MT_SAFE {
+    VerilatedContext* const contextp = m_shared ? Verilated::threadContextp() : nullptr;
+    m_dynamicReady.push(VlWorkerThread::ExecRec{fnp, selfp, evenCycle, contextp}, false);
+    notifyIdle(nullptr);
+}
+
+void VlThreadPool::executeDynamicUntilDone(const VlMTaskVertex& vertex,
+                                           bool evenCycle) VL_MT_SAFE {
+    // In a shared pool we might run tasks of other contexts, so restore ours after
+    VerilatedContext* const contextp = m_shared ? Verilated::threadContextp() : nullptr;
+    VlWorkerThread::ExecRec work;
+    unsigned ct = 0;
+    while (VL_UNLIKELY(!vertex.areUpstreamDepsDone(evenCycle))) {
+        if (m_dynamicReady.pop(&work, false)) {
+            work.execute();
+            ct = 0;
+            continue;
+        }
+        VL_CPU_RELAX();
+        if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+            ct = 0;
+            VlMTaskVertex::yieldThread();
+        }
+    }
+    if (contextp && contextp != Verilated::threadContextp()) Verilated::threadContextp(contextp);
+}
+
+bool VlThreadPool::parseCpuList(const std::string& spec, std::vector<int>& cpus) {
+    cpus.clear();
+    std::string::size_type pos = 0;
+    while (pos < spec.size()) {
+        std::string::size_type end = spec.find(',', pos);
+        if (end == std::string::npos) end = spec.size();
+        const std::string item = spec.substr(pos, end - pos);
+        pos = end + 1;
+        const std::string::size_type dash = item.find('-');
+        const std::string lo = item.substr(0, dash);
+        const std::string hi = dash == std::string::npos ? lo : item.substr(dash + 1);
+        if (lo.empty() || hi.empty()) return false;
+        if (lo.find_first_not_of("0123456789") != std::string::npos) return false;
+        if (hi.find_first_not_of("0123456789") != std::string::npos) return false;
+        const int first = std::atoi(lo.c_str());
+        const int last = std::atoi(hi.c_str());
+        if (last < first) return false;
+        for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    }
+    return !cpus.empty();
+}
+
+std::string VlThreadPool::currentPlacement() {
+#ifdef VL_THREADS_FUTEX
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return "cpu" + std::to_string(cpu) + "/node" + std::to_string(node);
+    }
+#endif
+    return "unknown";
+}
+
+std::string VlThreadPool::cpuListAssign(const std::string& spec) {
+#if defined(__linux) || defined(CPU_ZERO) || defined(VL_CPPCHECK)  // Linux-like pthreads
+    // Pin each worker to a single CPU from the user's list, wrapping around if
+    // there are more workers than CPUs. The list is applied even under numactl.
+    std::vector<int> cpus;
+    if (!parseCpuList(spec, cpus)) return "%Warning: malformed CPU list";
+    std::string status = "assigned ";
+    for (size_t thread = 0; thread < m_workers.size(); ++thread) {
+        const int cpu = cpus[thread % cpus.size()];
+        if (cpu >= CPU_SETSIZE) return "%Warning: CPU " + std::to_string(cpu) + " out of range";
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu, &cpuset);
+        status += std::to_string(cpu) + ";";
+        const int rc = pthread_setaffinity_np(m_workers[thread]->m_cthread.native_handle(),
+                                              sizeof(cpu_set_t), &cpuset);
+        if (rc != 0) return "%Warning: pthread_setaffinity_np failed";
+    }
+    return status;
+#else
+    return "non-supported host OS";
+#endif
 }
 
 bool VlThreadPool::isNumactlRunning() {
@@ -28,7 +28,9 @@
 #include "verilated.h"  // for VerilatedMutex and clang annotations
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <memory>
 #include <set>
 #include <stack>
 #include <thread>
@@ -45,7 +47,7 @@ using VlSelfP = void*;
 using VlExecFnp = void (*)(VlSelfP, bool);
 
 // Track dependencies for a single MTask.
-class VlMTaskVertex final {
+class VlMTaskVertex VL_NOT_FINAL {
     // MEMBERS
     static std::atomic<uint64_t> s_yields;  // Statistics
 
@@ -64,7 +66,9 @@ class VlMTaskVertex final {
     // small number of cache lines to reduce the cost of pointer chasing
     // during done-notification. Nobody's quantified that cost though.
     // If we were really serious about shrinking this class, we could
-    // use 16-bit types here...)
+    // use 16-bit types here... The flip side is false sharing between
+    // threads signalling neighbouring vertices, which VlPaddedMTaskVertex
+    // avoids, see --threads-state-layout.)
     std::atomic<uint32_t> m_upstreamDepsDone;
     const uint32_t m_upstreamDepCount;
 
@@ -85,16 +89,17 @@ public:
 
     // Upstream mtasks must call this when they complete.
     // Returns true when the current MTaskVertex becomes ready to execute,
-    // false while it's still waiting on more dependencies.
+    // false while it's still waiting on more dependencies. Acquires, so the
+    // caller may start the MTask (--threads-dynamic) having seen all upstream results.
     bool signalUpstreamDone(bool evenCycle) {
         if (evenCycle) {
             const uint32_t upstreamDepsDone
-                = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_release);
+                = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_acq_rel);
             assert(upstreamDepsDone <= m_upstreamDepCount);
             return (upstreamDepsDone == m_upstreamDepCount);
         } else {
             const uint32_t upstreamDepsDone_prev
-                = m_upstreamDepsDone.fetch_sub(1, std::memory_order_release);
+                = m_upstreamDepsDone.fetch_sub(1, std::memory_order_acq_rel);
             assert(upstreamDepsDone_prev > 0);
             return (upstreamDepsDone_prev == 1);
         }
@@ -116,6 +121,14 @@ public:
     }
 };
 
+// VlMTaskVertex alone on a cache line, so that threads signalling neighbouring
+// vertices do not false-share (see verilator --threads-state-layout)
+class alignas(VL_CACHE_LINE_BYTES) VlPaddedMTaskVertex final : public VlMTaskVertex {
+public:
+    explicit VlPaddedMTaskVertex(uint32_t upstreamDepCount)
+        : VlMTaskVertex{upstreamDepCount} {}
+};
+
 class VlWorkerThread final {
 private:
     // TYPES
@@ -123,25 +136,135 @@ private:
         VlExecFnp m_fnp = nullptr;  // Function to execute
         VlSelfP m_selfp = nullptr;  // Symbol table to execute
         bool m_evenCycle = false;  // Even/odd for flag alternation
+        // Context of the thread that added the task, only set in shared thread pools
+        VerilatedContext* m_contextp = nullptr;
         ExecRec() = default;
-        ExecRec(VlExecFnp fnp, VlSelfP selfp, bool evenCycle)
+        ExecRec(VlExecFnp fnp, VlSelfP selfp, bool evenCycle, VerilatedContext* contextp)
             : m_fnp{fnp}
             , m_selfp{selfp}
-            , m_evenCycle{evenCycle} {}
+            , m_evenCycle{evenCycle}
+            , m_contextp{contextp} {}
+        void execute() const {
+            if (VL_UNLIKELY(m_contextp && m_contextp != Verilated::threadContextp())) {
+                Verilated::threadContextp(m_contextp);
+            }
+            m_fnp(m_selfp, m_evenCycle);
+        }
+    };
+
+    // Bounded lock-free multi-producer multi-consumer FIFO of pending tasks,
+    // using a sequence number per cell (after Dmitry Vyukov's bounded MPMC
+    // queue). The owning worker pops from the head. When work stealing is
+    // enabled, other workers also pop from the head, but only if the head
+    // task was enqueued as stealable, so ordering of the others is kept.
+    class ReadyQueue final {
+        struct Cell final {
+            std::atomic<size_t> m_seq{0};  // Sequence number, see push/pop
+            std::atomic<bool> m_stealable{false};  // Other workers may pop this task
+            ExecRec m_rec;  // The task
+        };
+        // We expect the pending list to be very short, typically 0 or 1 or 2,
+        // more only with parallel tracing. Producers yield when full.
+        static constexpr size_t CAPACITY = 1024;  // Must be power of 2
+        std::unique_ptr<Cell[]> m_cellps{new Cell[CAPACITY]};
+        alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_head{0};  // Next cell to pop
+        alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_tail{0};  // Next cell to push
+
+    public:
+        // CONSTRUCTORS
+        ReadyQueue() {
+            for (size_t i = 0; i < CAPACITY; ++i) m_cellps[i].m_seq.store(i);
+        }
+        // METHODS
+        bool empty() const { return size() == 0; }
+        // Number of pending tasks (approximate, as may be concurrently modified)
+        size_t size() const {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+        void push(const ExecRec& rec, bool stealable) {
+            size_t pos = m_tail.load(std::memory_order_relaxed);
+            while (true) {
+                Cell& cell = m_cellps[pos & (CAPACITY - 1)];
+                const size_t seq = cell.m_seq.load(std::memory_order_acquire);
+                const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (dif == 0) {
+                    if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.m_rec = rec;
+                        cell.m_stealable.store(stealable, std::memory_order_relaxed);
+                        cell.m_seq.store(pos + 1, std::memory_order_release);
+                        return;
+                    }
+                } else {
+                    if (dif < 0) std::this_thread::yield();  // Full, wait for consumers
+                    pos = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        // Pop the head task into 'recp'. If 'stealing', only pop stealable tasks.
+        // Returns false if nothing was popped.
+        bool pop(ExecRec* recp, bool stealing) {
+            size_t pos = m_head.load(std::memory_order_relaxed);
+            while (true) {
+                Cell& cell = m_cellps[pos & (CAPACITY - 1)];
+                const size_t seq = cell.m_seq.load(std::memory_order_acquire);
+                const intptr_t dif
+                    = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (dif == 0) {
+                    if (stealing && !cell.m_stealable.load(std::memory_order_relaxed)) {
+                        return false;
+                    }
+                    if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        *recp = cell.m_rec;
+                        cell.m_seq.store(pos + CAPACITY, std::memory_order_release);
+                        return true;
+                    }
+                } else if (dif < 0) {
+                    return false;  // Empty (or head push not yet published)
+                } else {
+                    pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        // Return true if the head task is stealable (approximate, for wakeup checks)
+        bool headStealable() const {
+            const size_t pos = m_head.load(std::memory_order_relaxed);
+            const Cell& cell = m_cellps[pos & (CAPACITY - 1)];
+            return cell.m_seq.load(std::memory_order_acquire) == pos + 1
+                   && cell.m_stealable.load(std::memory_order_relaxed);
+        }
     };
 
+    // Parking state of the worker, see park()
+    enum ParkState : uint8_t { RUNNING, PARKED_CV, PARKED_FUTEX };
+
+    // CONSTANTS
+    static constexpr unsigned ADAPTIVE_SPINS_MIN = 64;  // Adaptive spin limit bounds
+    static constexpr unsigned ADAPTIVE_SPINS_MAX = 16 * VL_LOCK_SPINS;
+
     // MEMBERS
-    mutable VerilatedMutex m_mutex;
+    mutable VerilatedMutex m_mutex;  // Only used for parking, the queue is lock-free
     std::condition_variable_any m_cv;
-    // Only notify the condition_variable if the worker is waiting
-    bool m_waiting VL_GUARDED_BY(m_mutex) = false;
+    // Only wake the worker if it is parked
+    std::atomic<uint8_t> m_parked{RUNNING};
+    std::atomic<uint32_t> m_parkSeq{0};  // Futex word, incremented on futex wakeups
+    // Adaptive wait: tune m_spinLimit from observed idle time, park on futex
+    const bool m_adaptiveWait;
+    const bool m_shared;  // Owned by a thread pool shared by several contexts
+    const unsigned m_workerId;  // Index in the thread pool + 1, see Verilated::threadWorkerId
+    unsigned m_spinLimit = VL_LOCK_SPINS;  // Iterations to spin before parking
+    // Statistics, read by other threads so atomic, but only written by this worker
+    std::atomic<uint64_t> m_statSpinHits{0};  // Found work without parking
+    std::atomic<uint64_t> m_statParks{0};  // Had to park to wait for work
 
-    // Why a vector? We expect the pending list to be very short, typically
-    // 0 or 1 or 2, so popping from the front shouldn't be
-    // expensive. Revisit if we ever have longer queues...
-    std::vector<ExecRec> m_ready VL_GUARDED_BY(m_mutex);
-    // Store the size atomically, so we can spin wait
-    std::atomic<size_t> m_ready_size;
+    ReadyQueue m_ready;  // Pending tasks
+    // Thread pool owning this worker, set by VlThreadPool once all workers are constructed
+    std::atomic<VlThreadPool*> m_poolp{nullptr};
+    // Number of tasks stolen from this worker that are still executing
+    std::atomic<unsigned> m_stolenRunning{0};
+    VlWorkerThread* m_stolenFromp = nullptr;  // Worker the current task was stolen from
+    unsigned m_stealNext = 0;  // Next worker index to try stealing from
 
     std::thread m_cthread;  // Underlying C++ thread record
 
@@ -153,48 +276,85 @@ protected:
 
 public:
     // CONSTRUCTORS
-    explicit VlWorkerThread(VerilatedContext* contextp);
+    VlWorkerThread(VerilatedContext* contextp, bool shared, unsigned workerId);
     ~VlWorkerThread();
 
     // METHODS
     template <bool N_SpinWait>
     void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
         // Spin for a while, waiting for new data
+        std::chrono::steady_clock::time_point spinStart;
         if VL_CONSTEXPR_CXX17 (N_SpinWait) {
-            for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-                if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
+            if (m_adaptiveWait) spinStart = std::chrono::steady_clock::now();
+            const unsigned spinLimit = m_spinLimit;
+            for (unsigned i = 0; i < spinLimit; ++i) {
+                if (VL_LIKELY(tryDequeWork(workp))) {
+                    m_statSpinHits.store(m_statSpinHits.load(std::memory_order_relaxed) + 1,
+                                         std::memory_order_relaxed);
+                    // Work arrived late in the spin, so spinning longer might avoid parking
+                    if (m_adaptiveWait && i > spinLimit / 4 * 3) spinLonger();
+                    return;
+                }
                 VL_CPU_RELAX();
             }
         }
-        VerilatedLockGuard lock{m_mutex};
-        while (m_ready.empty()) {
-            m_waiting = true;
-            m_cv.wait(m_mutex);
-        }
-        m_waiting = false;
-        // As noted above this is inefficient if our ready list is ever
-        // long (but it shouldn't be)
-        *workp = m_ready.front();
-        m_ready.erase(m_ready.begin());
-        m_ready_size.fetch_sub(1, std::memory_order_relaxed);
+        park(workp, N_SpinWait, spinStart);
     }
-    void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
-        VL_MT_SAFE_EXCLUDES(m_mutex) {
-        bool notify;
-        {
-            const VerilatedLockGuard lock{m_mutex};
-            m_ready.emplace_back(fnp, selfp, evenCycle);
-            m_ready_size.fetch_add(1, std::memory_order_relaxed);
-            notify = m_waiting;
-        }
-        if (notify) m_cv.notify_one();
+    // Add task for this worker. Tasks are executed in order by this worker.
+    void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false) VL_MT_SAFE {
+        m_ready.push(ExecRec{fnp, selfp, evenCycle, taskContextp()}, false);
+        notifyIfWaiting();
     }
+    // Add task that other workers may also execute, if work stealing is
+    // enabled and this worker is busy.
+    void addStealableTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false) VL_MT_SAFE;
 
     void shutdown();  // Finish current tasks, then terminate thread
+    void restart(VerilatedContext* contextp);  // Start new thread after shutdown and join
     void wait();  // Blocks calling thread until all tasks complete in this thread
 
     void workerLoop();
     static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp);
+
+private:
+    // Context tasks run under on workers of a shared pool
+    VerilatedContext* taskContextp() const {
+        return VL_UNLIKELY(m_shared) ? Verilated::threadContextp() : nullptr;
+    }
+    bool tryDequeWork(ExecRec* workp);
+    bool trySteal(VlThreadPool* poolp, ExecRec* workp);
+    bool hasWork() const;
+    void spinLonger() {
+        m_spinLimit = m_spinLimit < ADAPTIVE_SPINS_MAX / 2 ? m_spinLimit * 2 : ADAPTIVE_SPINS_MAX;
+    }
+    void spinShorter() {
+        m_spinLimit = m_spinLimit > ADAPTIVE_SPINS_MIN * 2 ? m_spinLimit / 2 : ADAPTIVE_SPINS_MIN;
+    }
+    void park(ExecRec* workp, bool spun, std::chrono::steady_clock::time_point spinStart)
+        VL_MT_SAFE_EXCLUDES(m_mutex);
+    void parkCv() VL_MT_SAFE_EXCLUDES(m_mutex);
+    void parkFutex();
+    bool notifyIfWaiting() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        // Pairs with fence in parkCv/parkFutex, so either the worker sees the new task,
+        // or we see it is parked
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint8_t parked = m_parked.load(std::memory_order_relaxed);
+        if (VL_LIKELY(parked == RUNNING)) return false;
+        if (parked == PARKED_FUTEX) {
+            wakeFutex();
+        } else {
+            const VerilatedLockGuard lock{m_mutex};
+            m_cv.notify_one();
+        }
+        return true;
+    }
+    void wakeFutex();
+
+public:
+    // STATISTICS
+    uint64_t statSpinHits() const { return m_statSpinHits.load(std::memory_order_relaxed); }
+    uint64_t statParks() const { return m_statParks.load(std::memory_order_relaxed); }
+    unsigned spinLimit() const { return m_spinLimit; }
 };
 
 class VlThreadPool final : public VerilatedVirtualBase {
@@ -204,20 +364,34 @@ class VlThreadPool final : public VerilatedVirtualBase {
     mutable VerilatedMutex m_mutex;  // Guards indexes of unassigned workers
     // Indexes of unassigned workers
     std::stack<size_t> m_unassignedWorkers VL_GUARDED_BY(m_mutex);
+    // Exec graphs of contexts sharing the pool wait here for workers, in ticket order
+    std::condition_variable_any m_assignCv;
+    uint64_t m_assignTicketNext VL_GUARDED_BY(m_mutex) = 0;  // Next ticket to hand out
+    uint64_t m_assignTicketServing VL_GUARDED_BY(m_mutex) = 0;  // Ticket being served
     // For sequentially generating task IDs to avoid shadowing
     std::atomic<unsigned> m_assignedTasks{0};
     std::string m_numaStatus;  // Status of NUMA assignment
+    const bool m_shared;  // Shared by several contexts, see VlThreadPool::shared
+    const bool m_stealing;  // Idle workers steal stealable tasks from busy workers
+    VlWorkerThread::ReadyQueue m_dynamicReady;  // Ready tasks not bound to a worker
 
 public:
     // CONSTRUCTORS
     // Construct a thread pool with 'nThreads' dedicated threads. The thread
     // pool will create these threads and make them available to execute tasks
     // via this->workerp(index)->addTask(...)
-    VlThreadPool(VerilatedContext* contextp, unsigned nThreads);
+    VlThreadPool(VerilatedContext* contextp, unsigned nThreads, bool shared = false);
     ~VlThreadPool() override;
 
+    // Return the process-wide thread pool shared by contexts using
+    // VerilatedContext::threadsShared, creating it on first use sized to the
+    // hardware, but with at least 'nThreads' workers. It is deleted when the
+    // last context using it releases it.
+    static std::shared_ptr<VlThreadPool> shared(VerilatedContext* contextp, unsigned nThreads);
+
     // METHODS
     size_t assignWorkerIndex() {
+        if (VL_UNLIKELY(m_shared)) fatalShared();
         const VerilatedLockGuard lock{m_mutex};
         assert(!m_unassignedWorkers.empty());
         const size_t index = m_unassignedWorkers.top();
@@ -229,21 +403,66 @@ public:
         for (size_t index : indexes) m_unassignedWorkers.push(index);
         indexes.clear();
     }
+    // Assign 'n' workers to an exec graph, written to 'indexesp'. In a shared pool
+    // this blocks until that many workers are free, and graphs are served in
+    // first-come first-served order, so contexts get a fair share of the pool,
+    // and the graph's tasks cannot wait on tasks queued behind another graph.
+    void assignWorkerIndexes(size_t n, size_t* indexesp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (VL_LIKELY(!m_shared)) {
+            for (size_t i = 0; i < n; ++i) indexesp[i] = i;
+            return;
+        }
+        assignSharedWorkerIndexes(n, indexesp);
+    }
+    void freeWorkerIndexes(size_t n, const size_t* indexesp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (VL_UNLIKELY(m_shared)) freeSharedWorkerIndexes(n, indexesp);
+    }
     unsigned assignTaskIndex() { return m_assignedTasks++; }
     int numThreads() const { return static_cast<int>(m_workers.size()); }
     std::string numaStatus() const { return m_numaStatus; }
+    bool stealing() const { return m_stealing; }
+    bool isShared() const { return m_shared; }
+    // Statistics summed over all workers
+    uint64_t statSpinHits() const;
+    uint64_t statParks() const;
     VlWorkerThread* workerp(int index) {
         assert(index >= 0);
         assert(index < static_cast<int>(m_workers.size()));
         return m_workers[index];
     }
 
+    // Stop all workers, finishing their current tasks, so the process may be
+    // forked with no other threads running, see VerilatedContext::forkSnapshot
+    void stopWorkers();
+    // Start the workers stopped by stopWorkers again, with new threads
+    void startWorkers(VerilatedContext* contextp);
+
+    // Add task to the shared queue used by --threads-dynamic, to be executed by
+    // any idle worker, or by a thread in executeDynamicUntilDone
+    void addDynamicTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle) VL_MT_SAFE;
+    // Execute tasks from the shared queue on the calling thread, until 'vertex' is ready
+    void executeDynamicUntilDone(const VlMTaskVertex& vertex, bool evenCycle) VL_MT_SAFE;
+
+    // Parse a CPU list such as "0-3,8" into 'cpus', return false if malformed
+    static bool parseCpuList(const std::string& spec, std::vector<int>& cpus);
+    // Describe the CPU and NUMA node the calling thread is running on
+    static std::string currentPlacement();
+
 private:
     VL_UNCOPYABLE(VlThreadPool);
+    friend class VlWorkerThread;
+
+    // Wake a parked worker other than 'busyp', e.g. so it may steal from 'busyp'
+    void notifyIdle(const VlWorkerThread* busyp);
+
+    void assignSharedWorkerIndexes(size_t n, size_t* indexesp) VL_MT_SAFE_EXCLUDES(m_mutex);
+    void freeSharedWorkerIndexes(size_t n, const size_t* indexesp) VL_MT_SAFE_EXCLUDES(m_mutex);
+    static void fatalShared();
 
     // cppcheck-suppress unusedPrivateFunction
     static bool isNumactlRunning();
     std::string numaAssign();
+    std::string cpuListAssign(const std::string& spec);
 };
 
 #endif
@@ -44,6 +44,13 @@ void VlCoroutineHandle::resume() {
     }
 }
 
+void VlCoroutineHandle::resumeAll(std::vector<VlCoroutineHandle>& coros) {
+    // Callers first move the batch out of the vector coroutines suspend to, so resumed
+    // coroutines never append to 'coros' mid-iteration
+    for (VlCoroutineHandle& coro : coros) coro.resume();
+    coros.clear();
+}
+
 #ifdef VL_DEBUG
 void VlCoroutineHandle::dump() const {
     VL_PRINTF("Process waiting at %s:%d\n", m_fileline.filename(), m_fileline.lineno());
@@ -53,16 +60,66 @@ void VlCoroutineHandle::dump() const {
 //======================================================================
 // VlDelayScheduler:: Methods
 
+void VlDelayScheduler::push(uint64_t time, VlCoroutineHandle&& handle) {
+    const uint64_t now = m_context.time();
+    // Move any due m_far entries first, so they stay ahead of later suspensions at their time
+    if (VL_UNLIKELY(!m_far.empty())) farToWheel(now);
+    if (VL_LIKELY(time - now < WHEEL_SIZE)) {
+        VlDelayedCoroutines& slot = m_wheel[time & WHEEL_MASK];
+        // Slot might hold a time slot already missed; if so leave this to m_far
+        if (VL_LIKELY(slot.empty() || slot.front().m_time == time)) {
+            if (slot.empty()) m_wheelOccupied[(time & WHEEL_MASK) / 64] |= 1ULL << (time % 64);
+            slot.push_back(DelayedCoroutine{time, 0, std::move(handle)});
+            ++m_wheelCount;
+            return;
+        }
+    }
+    m_far.push_back(DelayedCoroutine{time, m_farSeq++, std::move(handle)});
+    std::push_heap(m_far.begin(), m_far.end(), later);
+}
+
+void VlDelayScheduler::farToWheel(uint64_t now) {
+    while (!m_far.empty() && (m_far.front().m_time - now < WHEEL_SIZE)) {
+        const uint64_t time = m_far.front().m_time;
+        VlDelayedCoroutines& slot = m_wheel[time & WHEEL_MASK];
+        if (VL_UNLIKELY(!slot.empty() && slot.front().m_time != time)) break;
+        if (slot.empty()) m_wheelOccupied[(time & WHEEL_MASK) / 64] |= 1ULL << (time % 64);
+        std::pop_heap(m_far.begin(), m_far.end(), later);
+        slot.push_back(std::move(m_far.back()));
+        m_far.pop_back();
+        ++m_wheelCount;
+    }
+}
+
+size_t VlDelayScheduler::wheelNextOccupied(size_t from) const {
+    size_t word = from / 64;
+    uint64_t bits = m_wheelOccupied[word] & (~0ULL << (from % 64));
+    // Check the starting word again at the end, for the slots before 'from'
+    for (size_t n = 0; n <= WHEEL_WORDS; ++n) {
+        if (bits) return word * 64 + VL_CTZ_Q(bits);
+        word = (word + 1) % WHEEL_WORDS;
+        bits = m_wheelOccupied[word];
+    }
+    return from;  // Only called when m_wheelCount is non-zero, so not reached
+}
+
 void VlDelayScheduler::resume() {
 #ifdef VL_DEBUG
     VL_DEBUG_IF(dump(); VL_DBG_MSGF("         Resuming delayed processes\n"););
 #endif
     bool resumed = false;
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
-        handle.resume();
+    const uint64_t now = m_context.time();
+    if (!m_far.empty()) farToWheel(now);
+    VlDelayedCoroutines& slot = m_wheel[now & WHEEL_MASK];
+    if (!slot.empty() && (slot.front().m_time == now)) {
+        // Resumed coroutines only suspend until later times, so no more are added to this slot.
+        // We swap with the m_delayedResumed field to keep the allocated buffer.
+        m_delayedResumed.swap(slot);
+        m_wheelOccupied[(now & WHEEL_MASK) / 64] &= ~(1ULL << (now % 64));
+        m_wheelCount -= m_delayedResumed.size();
+        for (DelayedCoroutine& delayed : m_delayedResumed) delayed.m_handle.resume();
+        m_delayedResumed.clear();
         resumed = true;
     }
 
@@ -72,8 +129,7 @@ void VlDelayScheduler::resume() {
         // queue mid-iteration.
         // We swap with the m_zeroDlyResumed field to keep the allocated buffer.
         m_zeroDlyResumed.swap(m_zeroDelayed);
-        for (auto&& handle : m_zeroDlyResumed) handle.resume();
-        m_zeroDlyResumed.clear();
+        VlCoroutineHandle::resumeAll(m_zeroDlyResumed);
         resumed = true;
         // We are now in the Active region, so any coroutines added to m_zeroDelayed in the
         // meantime will have to wait until the next Inactive region.
@@ -87,15 +143,21 @@ void VlDelayScheduler::resume() {
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    const uint64_t now = m_context.time();
+    if (m_wheelCount) {
+        const uint64_t time = m_wheel[wheelNextOccupied(now & WHEEL_MASK)].front().m_time;
+        if (!m_far.empty()) return std::min(time, m_far.front().m_time);
+        return time;
+    }
+    if (!m_far.empty()) return m_far.front().m_time;
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "There is no next time slot scheduled");
-    return m_context.time();
+    return now;
 }
 
 #ifdef VL_DEBUG
 void VlDelayScheduler::dump() const {
-    if (m_queue.empty()) {
+    if (empty()) {
         VL_DBG_MSGF("         No delayed processes:\n");
     } else {
         VL_DBG_MSGF("         Delayed processes:\n");
@@ -105,9 +167,17 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
+        // Wheel slots from the current time on are in time order
+        const uint64_t now = m_context.time();
+        for (uint64_t i = 0; i < WHEEL_SIZE; ++i) {
+            for (const auto& susp : m_wheel[(now + i) & WHEEL_MASK]) {
+                VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.m_time);
+                susp.m_handle.dump();
+            }
+        }
+        for (const auto& susp : m_far) {  // Heap, so not in time order
+            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.m_time);
+            susp.m_handle.dump();
         }
     }
 }
@@ -122,8 +192,7 @@ void VlTriggerScheduler::resume(const char* eventDescription) {
                 VL_DBG_MSGF("         Resuming processes waiting for %s\n", eventDescription););
 #endif
     std::swap(m_ready, m_resumeQueue);
-    for (VlCoroutineHandle& coro : m_resumeQueue) coro.resume();
-    m_resumeQueue.clear();
+    VlCoroutineHandle::resumeAll(m_resumeQueue);
     commit(eventDescription);
 }
 
@@ -139,6 +208,11 @@ void VlTriggerScheduler::commit(const char* eventDescription) {
             });
     }
 #endif
+    if (m_ready.empty()) {
+        // Usual case after resume(): take the whole batch without moving each coroutine
+        std::swap(m_ready, m_uncommitted);
+        return;
+    }
     m_ready.reserve(m_ready.size() + m_uncommitted.size());
     m_ready.insert(m_ready.end(), std::make_move_iterator(m_uncommitted.begin()),
                    std::make_move_iterator(m_uncommitted.end()));
@@ -172,9 +246,10 @@ void VlTriggerScheduler::dump(const char* eventDescription) const {
 bool VlDynamicTriggerScheduler::evaluate() {
     m_anyTriggered = false;
     VL_DEBUG_IF(dump(););
+    // Usually nothing waits, e.g. mailbox and semaphore users all have what they need
+    if (m_suspended.empty()) return false;
     std::swap(m_suspended, m_evaluated);
-    for (auto& coro : m_evaluated) coro.resume();
-    m_evaluated.clear();
+    VlCoroutineHandle::resumeAll(m_evaluated);
     return m_anyTriggered;
 }
 
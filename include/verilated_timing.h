@@ -149,6 +149,8 @@ public:
     }
     // Resume the coroutine if the handle isn't null and the process isn't killed
     void resume();
+    // Resume a batch of coroutines in order, then clear the vector, keeping its buffer
+    static void resumeAll(std::vector<VlCoroutineHandle>& coros);
 #ifdef VL_DEBUG
     void dump() const;
 #endif
@@ -159,15 +161,34 @@ enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
+// Coroutines resuming within WHEEL_SIZE of the current time are kept on a timing wheel, so
+// suspending on and resuming from the usual small delays is constant time. Longer delays wait
+// in a heap, and move to the wheel once their time comes within range. In both, coroutines
+// resuming at the same time are resumed in the order they were suspended.
 
 class VlDelayScheduler final {
     // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
+    struct DelayedCoroutine final {
+        uint64_t m_time;  // Simulation time to resume at
+        uint64_t m_seq;  // Suspension order, to keep same time m_far entries in order
+        VlCoroutineHandle m_handle;
+    };
+    using VlDelayedCoroutines = std::vector<DelayedCoroutine>;
+    static constexpr uint64_t WHEEL_SIZE = 256;  // Must be a power of 2, multiple of 64
+    static constexpr uint64_t WHEEL_MASK = WHEEL_SIZE - 1;
+    static constexpr size_t WHEEL_WORDS = WHEEL_SIZE / 64;
 
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    // Timing wheel; slot [time % WHEEL_SIZE] holds coroutines to be resumed at that time, for
+    // times less than WHEEL_SIZE after the current time. Cleared slots keep their buffer.
+    std::array<VlDelayedCoroutines, WHEEL_SIZE> m_wheel;
+    std::array<uint64_t, WHEEL_WORDS> m_wheelOccupied{};  // Bit per non-empty m_wheel slot
+    size_t m_wheelCount = 0;  // Number of coroutines in m_wheel
+    VlDelayedCoroutines m_far;  // Min-heap by time then m_seq, of coroutines beyond m_wheel
+    uint64_t m_farSeq = 0;  // Next DelayedCoroutine::m_seq
+    VlDelayedCoroutines m_delayedResumed;  // Wheel slot being resumed. Kept as a field to
+                                           // avoid reallocation.
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     std::vector<VlCoroutineHandle> m_zeroDlyResumed;  // Coroutines that waited for #0 and are
                                                       // to be resumed. Kept as a field to avoid
@@ -184,32 +205,49 @@ public:
     // coroutines)
     uint64_t nextTimeSlot() const;
     // Are there no delayed coroutines awaiting?
-    bool empty() const { return m_queue.empty() && m_zeroDelayed.empty(); }
+    bool empty() const { return !m_wheelCount && m_far.empty() && m_zeroDelayed.empty(); }
     // Are there coroutines to resume at the current simulation time?
     bool awaitingCurrentTime() const {
-        return (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()))
-               || !m_zeroDelayed.empty();
+        const uint64_t now = m_context.time();
+        const VlDelayedCoroutines& slot = m_wheel[now & WHEEL_MASK];
+        return (!slot.empty() && slot.front().m_time <= now)
+               || (!m_far.empty() && m_far.front().m_time <= now) || !m_zeroDelayed.empty();
     }
 #ifdef VL_DEBUG
     void dump() const;
 #endif
+
+private:
+    // Heap ordering, so earliest time, then earliest suspended, is at m_far front
+    static bool later(const DelayedCoroutine& a, const DelayedCoroutine& b) {
+        if (a.m_time != b.m_time) return a.m_time > b.m_time;
+        return a.m_seq > b.m_seq;
+    }
+    // Add a coroutine to be resumed at the given time
+    void push(uint64_t time, VlCoroutineHandle&& handle);
+    // Move m_far coroutines which are now in m_wheel's range to m_wheel
+    void farToWheel(uint64_t now);
+    // Index of first non-empty m_wheel slot at or cyclically after the given slot
+    size_t wheelNextOccupied(size_t from) const;
+
+public:
     // Used by coroutines for co_awaiting a certain simulation time
     auto delay(uint64_t delay, VlProcessRef process, const char* filename = VL_UNKNOWN,
                int lineno = 0) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
-            std::vector<VlCoroutineHandle>& queueZeroDelay;
-            const uint64_t delay;
+            VlDelayScheduler& scheduler;
+            const uint64_t time;
             const VlDelayPhase phase;
             const VlFileLineDebug fileline;
 
             bool await_ready() const { return false; }  // Always suspend
             void await_suspend(std::coroutine_handle<> coro) {
                 if (phase == VlDelayPhase::ACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    scheduler.push(time, VlCoroutineHandle{coro, process, fileline});
                 } else {
-                    queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
+                    scheduler.m_zeroDelayed.emplace_back(
+                        VlCoroutineHandle{coro, process, fileline});
                 }
             }
             void await_resume() const {}
@@ -224,9 +262,8 @@ public:
         }
 #endif
 
-        return Awaitable{process,       m_queue,
-                         m_zeroDelayed, m_context.time() + delay,
-                         phase,         VlFileLineDebug{filename, lineno}};
+        return Awaitable{process, *this, m_context.time() + delay, phase,
+                         VlFileLineDebug{filename, lineno}};
     }
 };
 
@@ -428,6 +465,22 @@ private:
 
         ~VlPromise();
 
+        // Coroutine frames come from VlBlockPool, so the frames of short-lived processes (forks,
+        // task calls, waits) are recycled without going to the heap
+        static void* operator new(size_t size) {
+            bool reused;
+            void* const framep = VlBlockPool::allocate(size, reused);
+            Verilated::threadContextp()->statCoroutineFrame(reused);
+            return framep;
+        }
+        static void operator delete(void* framep, size_t size) {
+#ifdef VL_COROUTINE_IMMEDIATE_FREE  // Define to aid in finding frame lifetime issues
+            ::operator delete(framep);
+#else
+            VlBlockPool::deallocate(framep, size);
+#endif
+        }
+
         VlCoroutine get_return_object() { return {this}; }
 
         // Never suspend at the start of the coroutine
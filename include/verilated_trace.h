@@ -25,6 +25,7 @@
 // clang-format off
 
 #include "verilated.h"
+#include "verilated_intrinsics.h"
 
 #include <bitset>
 #include <condition_variable>
@@ -163,6 +164,24 @@ public:
         END = 0xe,  // End of buffer
         SHUTDOWN = 0xf  // Shutdown worker thread, also marks end of buffer
     };
+
+    // Number of words taken by the command at 'cmdp', or 0 at the end of the buffer
+    static size_t words(const uint32_t* cmdp) {
+        switch (cmdp[0] & 0xF) {
+        case CHG_BIT_0:
+        case CHG_BIT_1:
+        case CHG_EVENT: return 2;
+        case CHG_CDATA:
+        case CHG_SDATA:
+        case CHG_IDATA:
+        case TIME_CHANGE:
+        case TRACE_BUFFER: return 3;
+        case CHG_QDATA:
+        case CHG_DOUBLE: return 4;
+        case CHG_WDATA: return 2 + VL_WORDS_I(cmdp[0] >> 4);
+        default: return 0;
+        }
+    }
 };
 
 //=============================================================================
@@ -255,6 +274,7 @@ private:
         const dumpCb_t m_cb;  // The callback
         void* const m_userp;  // The use pointer to pass to the callback
         Buffer* const m_bufp;  // The buffer pointer to pass to the callback
+        uint64_t* const m_profNsp;  // Time accumulator of the callback, if profiling
         std::atomic<bool> m_ready{false};  // The ready flag
         mutable VerilatedMutex m_mutex;  // Mutex for suspension until ready
         std::condition_variable_any m_cv;  // Condition variable for suspension
@@ -262,10 +282,11 @@ private:
 
         void wait();
 
-        ParallelWorkerData(dumpCb_t cb, void* userp, Buffer* bufp)
+        ParallelWorkerData(dumpCb_t cb, void* userp, Buffer* bufp, uint64_t* profNsp)
             : m_cb{cb}
             , m_userp{userp}
-            , m_bufp{bufp} {}
+            , m_bufp{bufp}
+            , m_profNsp{profNsp} {}
     };
 
     // Passed a ParallelWorkerData*, second argument is ignored
@@ -305,16 +326,46 @@ private:
     // to access duck-typed functions to avoid a virtual function call.
     T_Trace* self() { return static_cast<T_Trace*>(this); }
 
-    void runCallbacks(const std::vector<CallbackRecord>& cbVec);
-    void runOffloadedCallbacks(const std::vector<CallbackRecord>& cbVec);
+protected:
+    VerilatedContext* traceContextp() const { return m_contextp; }
+
+private:
+    // Trace profiling (see profile). Phases of dump, in report order
+    enum ProfPhase : uint8_t {
+        PROF_SETUP,  // Time change and format hooks
+        PROF_FULL,  // Full dump callbacks
+        PROF_CHG,  // Change dump callbacks
+        PROF_CONST,  // Constant dump callbacks
+        PROF_CLEANUP,  // Cleanup callbacks
+        PROF_OFFLOAD,  // Change detection and formatting on the offload thread
+        PROF_WRITE,  // Writing the file, included in the above
+        PROF_PHASES
+    };
+    bool m_prof = false;  // Profiling enabled
+    uint64_t m_profDumps = 0;  // Number of dumps profiled
+    uint64_t m_profFirstDump = 0;  // Time of first dump profiled
+    std::atomic<uint64_t> m_profPhaseNs[PROF_PHASES]{};  // Time per phase
+    std::vector<uint64_t> m_profCbNs[3];  // Time per callback, by PROF_FULL.. phase and fidx
+    std::vector<uint32_t> m_profCodeScope;  // Index into m_profScopes by first code of signal
+    std::vector<std::string> m_profScopes;  // Scope names
+    std::map<std::string, uint32_t> m_profScopeIdx;  // Scope name to index in m_profScopes
+    uint64_t* m_profChgBitsp = nullptr;  // Changed bits by code, if profiling
+
+    void runCallbacks(const std::vector<CallbackRecord>& cbVec, ProfPhase phase);
+    void runOffloadedCallbacks(const std::vector<CallbackRecord>& cbVec, ProfPhase phase);
 
     // Flush any remaining data for this file
     static void onFlush(void* selfp) VL_MT_UNSAFE_ONE;
     // Close the file on termination
     static void onExit(void* selfp) VL_MT_UNSAFE_ONE;
+    // Stop the offload worker before VerilatedContext::forkSnapshot, restart it after
+    static void onPrepareFork(void* selfp) VL_MT_UNSAFE_ONE;
+    static void onResumeFork(void* selfp) VL_MT_UNSAFE_ONE;
 
     // Number of total offload buffers that have been allocated
     uint32_t m_numOffloadBuffers = 0;
+    // Number of offload buffers that may be in flight, see offloadBuffers
+    uint32_t m_maxOffloadBuffers = 8;
     // Size of offload buffers
     size_t m_offloadBufferSize = 0;
     // Buffers handed to worker for processing
@@ -343,6 +394,24 @@ private:
 
     // Shut down and join worker, if it's running, otherwise do nothing
     void shutdownOffloadWorker();
+    // Start the offload worker thread
+    void startOffloadWorker();
+    // Worker was shut down by onPrepareFork, so restart it in onResumeFork
+    bool m_restartOffloadWorker = false;
+
+    // Windowed tracing (see recordWindow). Filled offload buffers are held here
+    // instead of being handed to the worker. Each segment starts with a full
+    // dump, and the oldest segment is dropped once the rest hold enough dumps.
+    uint32_t m_windowDumps = 0;  // Number of dumps to keep, or 0 when not windowed
+    uint32_t m_windowNumBuffers = 0;  // Number of buffers held in m_windowSegments
+    std::deque<std::vector<uint32_t*>> m_windowSegments;
+
+    // Hold a filled offload buffer, 'full' if it contains a full dump
+    void windowHold(uint32_t* bufferp, bool full);
+    // Return the buffers of a segment to the free list, without writing them
+    void windowRelease(const std::vector<uint32_t*>& segment);
+    // Hand all held buffers to the worker to be written
+    void windowWrite();
 
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedTrace);
@@ -362,6 +431,7 @@ protected:
     double timeRes() const { return m_timeRes; }
     double timeUnit() const { return m_timeUnit; }
     std::string timeResStr() const;
+    uint64_t timeLastDump() const { return m_timeLastDump; }
 
     void traceInit() VL_MT_UNSAFE;
 
@@ -374,6 +444,26 @@ protected:
     bool offload() const { return m_offload; }
     bool parallel() const { return m_parallel; }
 
+    // Trace profiling, for format-specific implementations to time file writes
+    bool profiling() const { return m_prof; }
+    static uint64_t profNowNs();
+    void profWriteNs(uint64_t ns) { m_profPhaseNs[PROF_WRITE] += ns; }
+
+    // Return filename of the given slice of a sliced trace. Slice 0 uses the
+    // filename as given, and later slices have _slice0001 etc. before the extension.
+    static std::string sliceFilename(const std::string& filename, uint32_t slice) {
+        if (!slice) return filename;
+        char numstr[16];
+        VL_SNPRINTF(numstr, sizeof(numstr), "_slice%04u", slice);
+        std::string name = filename;
+        const size_t dotPos = name.rfind('.');
+        const size_t dirPos = name.rfind('/');
+        if (dotPos == std::string::npos || (dirPos != std::string::npos && dotPos < dirPos)) {
+            return name + numstr;
+        }
+        return name.insert(dotPos, numstr);
+    }
+
     // Return last ' ' separated word. Assumes string does not end in ' '.
     static std::string lastWord(const std::string& str) {
         const size_t idx = str.rfind(' ');
@@ -395,6 +485,11 @@ protected:
     // Trace buffer management
     virtual Buffer* getTraceBuffer(uint32_t fidx) = 0;
     virtual void commitTraceBuffer(Buffer*) = 0;
+    // Commit the 'n' buffers filled by a parallel dump, in order. Sub-classes may
+    // override this to merge them in parallel.
+    virtual void commitTraceBuffers(Buffer* const* bufpp, size_t n) {
+        for (size_t i = 0; i < n; ++i) commitTraceBuffer(bufpp[i]);
+    }
 
     // Configure sub-class
     virtual void configure(const VerilatedTraceConfig&) = 0;
@@ -416,6 +511,25 @@ public:
     // If level = 0, dump everything and hier is then ignored
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE;
 
+    // Keep only the last 'dumps' dumps in memory (plus up to as many again, back to
+    // the last full dump), and write them only on dumpWindow(), or on a flush after
+    // a $stop or $fatal. Requires offloaded tracing, and must be called before open.
+    void recordWindow(uint32_t dumps) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Write the dumps kept by recordWindow, then start a new window
+    void dumpWindow() VL_MT_SAFE_EXCLUDES(m_mutex);
+
+    // Allow up to 'buffers' dumps (default 8) to be queued for the offload thread
+    // before dump blocks, to absorb bursts of activity. Only has an effect with
+    // offloaded tracing, and must be called before open.
+    void offloadBuffers(uint32_t buffers) VL_MT_SAFE_EXCLUDES(m_mutex);
+
+    // Record the time spent in each phase of dump and in each trace callback,
+    // and the number of bits that change in each scope, for profileReport.
+    // Must be called before open.
+    void profile(bool flag) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Return a report of the trace profile so far
+    std::string profileReport() VL_MT_SAFE_EXCLUDES(m_mutex);
+
     // Call
     void dump(uint64_t timeui) VL_MT_SAFE_EXCLUDES(m_mutex);
 
@@ -456,6 +570,7 @@ protected:
 
     uint32_t* const m_sigs_oldvalp;  // Previous value store
     EData* const m_sigs_enabledp;  // Bit vector of enabled codes (nullptr = all on)
+    uint64_t* const m_profChgBitsp;  // Changed bits by code (nullptr = not profiling)
 
     explicit VerilatedTraceBuffer(Trace& owner);
     ~VerilatedTraceBuffer() override = default;
@@ -480,6 +595,48 @@ public:
 
     VL_ATTR_ALWINLINE uint32_t* oldp(uint32_t code) { return m_sigs_oldvalp + code; }
 
+    // Returns true if any signal with a code in 'code' to 'code + n - 1' is
+    // enabled. Used with --trace-scope-groups to skip excluded scopes.
+    bool anyEnabled(uint32_t code, uint32_t n) const {
+        if (VL_LIKELY(!m_sigs_enabledp) || !n) return true;
+        const uint32_t last = code + n - 1;
+        uint32_t word = VL_BITWORD_I(code);
+        const uint32_t lastWord = VL_BITWORD_I(last);
+        EData bits = m_sigs_enabledp[word] & (~0U << VL_BITBIT_I(code));
+        while (word < lastWord) {
+            if (bits) return true;
+            bits = m_sigs_enabledp[++word];
+        }
+        return (bits & (~0U >> (VL_IDATASIZE - 1 - VL_BITBIT_I(last)))) != 0;
+    }
+
+    // Returns true if the 'words' words at 'oldp' and 'newvalp' differ. Wide
+    // signals are compared a vector at a time, and the scalar loop handles the
+    // remainder (and everything when built with VL_PORTABLE_ONLY).
+    static VL_ATTR_ALWINLINE bool differsWData(const uint32_t* oldp, const WData* newvalp,
+                                               int words) {
+        int i = 0;
+#ifdef VL_HAVE_AVX2
+        for (; i + 8 <= words; i += 8) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldp + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(newvalp + i));
+            const __m256i diff = _mm256_xor_si256(a, b);
+            if (VL_UNLIKELY(!_mm256_testz_si256(diff, diff))) return true;
+        }
+#endif
+#ifdef VL_HAVE_SSE2
+        for (; i + 4 <= words; i += 4) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(newvalp + i));
+            if (VL_UNLIKELY(_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) != 0xffff)) return true;
+        }
+#endif
+        for (; i < words; ++i) {
+            if (VL_UNLIKELY(oldp[i] ^ newvalp[i])) return true;
+        }
+        return false;
+    }
+
     // Write to previous value buffer value and emit trace entry.
     void fullBit(uint32_t* oldp, CData newval);
     void fullCData(uint32_t* oldp, CData newval, int bits);
@@ -519,11 +676,8 @@ public:
         if (VL_UNLIKELY(diff)) fullQData(oldp, newval, bits);
     }
     VL_ATTR_ALWINLINE void chgWData(uint32_t* oldp, const WData* newvalp, int bits) {
-        for (int i = 0; i < (bits + 31) / 32; ++i) {
-            if (VL_UNLIKELY(oldp[i] ^ newvalp[i])) {
-                fullWData(oldp, newvalp, bits);
-                return;
-            }
+        if (VL_UNLIKELY(differsWData(oldp, newvalp, VL_WORDS_I(bits)))) {
+            fullWData(oldp, newvalp, bits);
         }
     }
     VL_ATTR_ALWINLINE void chgEvent(uint32_t* oldp, const VlEventBase* newvalp) {
@@ -544,7 +698,8 @@ public:
 // The format-specific hot-path methods use duck-typing via T_Buffer for performance.
 template <typename T_Buffer>
 class VerilatedTraceOffloadBuffer final : public VerilatedTraceBuffer<T_Buffer> {
-    using typename VerilatedTraceBuffer<T_Buffer>::Trace;
+    using Base = VerilatedTraceBuffer<T_Buffer>;
+    using typename Base::Trace;
 
     friend Trace;  // Give the trace file access to the private bits
 
@@ -597,7 +752,9 @@ public:
         m_offloadBufferWritep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_WDATA;
         m_offloadBufferWritep[1] = code;
         m_offloadBufferWritep += 2;
-        for (int i = 0; i < (bits + 31) / 32; ++i) *m_offloadBufferWritep++ = newvalp[i];
+        const int words = VL_WORDS_I(bits);
+        std::memcpy(m_offloadBufferWritep, newvalp, words * sizeof(uint32_t));
+        m_offloadBufferWritep += words;
         VL_DEBUG_IF(assert(m_offloadBufferWritep <= m_offloadBufferEndp););
     }
     void chgDouble(uint32_t code, double newval) {
@@ -617,6 +774,45 @@ public:
         m_offloadBufferWritep += 2;
         VL_DEBUG_IF(assert(m_offloadBufferWritep <= m_offloadBufferEndp););
     }
+
+    // Full dumps are written directly, unless recording a window, in which case
+    // they are offloaded like changes (and are forced to differ when written)
+    void fullBit(uint32_t* oldp, CData newval) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullBit(oldp, newval);
+        chgBit(oldp - this->m_sigs_oldvalp, newval);
+    }
+    void fullCData(uint32_t* oldp, CData newval, int bits) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullCData(oldp, newval, bits);
+        chgCData(oldp - this->m_sigs_oldvalp, newval, bits);
+    }
+    void fullSData(uint32_t* oldp, SData newval, int bits) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullSData(oldp, newval, bits);
+        chgSData(oldp - this->m_sigs_oldvalp, newval, bits);
+    }
+    void fullIData(uint32_t* oldp, IData newval, int bits) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullIData(oldp, newval, bits);
+        chgIData(oldp - this->m_sigs_oldvalp, newval, bits);
+    }
+    void fullQData(uint32_t* oldp, QData newval, int bits) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullQData(oldp, newval, bits);
+        chgQData(oldp - this->m_sigs_oldvalp, newval, bits);
+    }
+    void fullWData(uint32_t* oldp, const WData* newvalp, int bits) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullWData(oldp, newvalp, bits);
+        chgWData(oldp - this->m_sigs_oldvalp, newvalp, bits);
+    }
+    void fullDouble(uint32_t* oldp, double newval) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullDouble(oldp, newval);
+        chgDouble(oldp - this->m_sigs_oldvalp, newval);
+    }
+    void fullEvent(uint32_t* oldp, const VlEventBase* newvalp) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullEvent(oldp, newvalp);
+        chgEvent(oldp - this->m_sigs_oldvalp, newvalp);
+    }
+    void fullEventTriggered(uint32_t* oldp) {
+        if (VL_LIKELY(!m_offloadBufferWritep)) return Base::fullEventTriggered(oldp);
+        chgEventTriggered(oldp - this->m_sigs_oldvalp);
+    }
 };
 
 #endif  // guard
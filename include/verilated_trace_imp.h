@@ -25,8 +25,12 @@
 #endif
 
 #include "verilated_intrinsics.h"
+#include "verilated_profiler.h"
 #include "verilated_trace.h"
 #include "verilated_threads.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <list>
 
 #if 0
@@ -67,8 +71,9 @@ template <>
 uint32_t* VerilatedTrace<VL_SUB_T, VL_BUF_T>::getOffloadBuffer() {
     uint32_t* bufferp;
     // Some jitter is expected, so some number of alternative offload buffers are
-    // required, but don't allocate more than 8 buffers.
-    if (m_numOffloadBuffers < 8) {
+    // required, but don't allocate more than m_maxOffloadBuffers buffers, plus those
+    // held by windowing.
+    if (m_numOffloadBuffers < m_maxOffloadBuffers + m_windowNumBuffers) {
         // Allocate a new buffer if none is available
         if (!m_offloadBuffersFromWorker.tryGet(bufferp)) {
             ++m_numOffloadBuffers;
@@ -96,6 +101,16 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::waitForOffloadBuffer(const uint32_t* bu
     }
 }
 
+//=========================================================================
+// Trace profiling clock
+
+template <>
+uint64_t VerilatedTrace<VL_SUB_T, VL_BUF_T>::profNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
 //=========================================================================
 // Worker thread
 
@@ -110,6 +125,7 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
         VL_TRACE_OFFLOAD_DEBUG("Got buffer: " << bufferp);
 
         const uint32_t* readp = bufferp;
+        const uint64_t profStartNs = m_prof ? profNowNs() : 0;
 
         std::unique_ptr<Buffer> traceBufp;  // We own the passed tracebuffer
 
@@ -215,6 +231,8 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
             break;
         }
 
+        if (m_prof) m_profPhaseNs[PROF_OFFLOAD] += profNowNs() - profStartNs;
+
         VL_TRACE_OFFLOAD_DEBUG("Returning buffer");
 
         // Return buffer
@@ -222,6 +240,12 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
     } while (VL_LIKELY(!shutdown));
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::startOffloadWorker() {
+    m_workerThread.reset(
+        new std::thread{&VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain, this});
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::shutdownOffloadWorker() {
     // If the worker thread is not running, done..
@@ -238,12 +262,76 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::shutdownOffloadWorker() {
     m_workerThread.reset(nullptr);
 }
 
+//=========================================================================
+// Windowed tracing
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::windowRelease(const std::vector<uint32_t*>& segment) {
+    for (uint32_t* const bufferp : segment) {
+        // The trace buffers are normally owned (and deleted) by the worker
+        const uint32_t* readp = bufferp;
+        while (const size_t words = VerilatedTraceOffloadCommand::words(readp)) {
+            if ((readp[0] & 0xF) == VerilatedTraceOffloadCommand::TRACE_BUFFER) {
+                std::default_delete<Buffer>{}(*reinterpret_cast<Buffer* const*>(readp + 1));
+            }
+            readp += words;
+        }
+        m_offloadBuffersFromWorker.put(bufferp);
+    }
+    m_windowNumBuffers -= segment.size();
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::windowHold(uint32_t* bufferp, bool full) {
+    if (full || m_windowSegments.empty()) m_windowSegments.emplace_back();
+    m_windowSegments.back().push_back(bufferp);
+    ++m_windowNumBuffers;
+    // Drop the oldest segment if the newer ones alone hold enough dumps
+    while (m_windowSegments.size() > 1
+           && m_windowNumBuffers - m_windowSegments.front().size() >= m_windowDumps) {
+        windowRelease(m_windowSegments.front());
+        m_windowSegments.pop_front();
+    }
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::windowWrite() {
+    // Note: The worker is idle, as it is not given any buffers while windowing
+    if (m_windowSegments.empty()) return;
+    // The window starts with a full dump. Set the previous values to the complement
+    // of the ones in that dump, so the worker finds every signal changed.
+    const uint32_t* readp = m_windowSegments.front().front();
+    while (const size_t words = VerilatedTraceOffloadCommand::words(readp)) {
+        const uint32_t cmd = readp[0] & 0xF;
+        if (cmd == VerilatedTraceOffloadCommand::CHG_BIT_0
+            || cmd == VerilatedTraceOffloadCommand::CHG_BIT_1) {
+            m_sigs_oldvalp[readp[1]] = ~(cmd & 1);
+        } else if (cmd <= VerilatedTraceOffloadCommand::CHG_DOUBLE) {
+            // All other CHG_* commands, except CHG_EVENT which has no value
+            for (size_t i = 2; i < words; ++i) m_sigs_oldvalp[readp[1] + i - 2] = ~readp[i];
+        }
+        readp += words;
+    }
+    // Write all held dumps, in order
+    for (const std::vector<uint32_t*>& segment : m_windowSegments) {
+        for (uint32_t* const bufferp : segment) m_offloadBuffersToWorker.put(bufferp);
+    }
+    m_windowSegments.clear();
+    m_windowNumBuffers = 0;
+    // The next window again starts with a full dump
+    m_fullDump = true;
+    m_constDump = true;
+}
+
 //=============================================================================
 // Life cycle
 
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::closeBase() {
     if (offload()) {
+        // Dumps not yet written by dumpWindow are discarded
+        for (const std::vector<uint32_t*>& segment : m_windowSegments) windowRelease(segment);
+        m_windowSegments.clear();
         shutdownOffloadWorker();
         while (m_numOffloadBuffers) {
             delete[] m_offloadBuffersFromWorker.get();
@@ -255,6 +343,8 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::closeBase() {
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::flushBase() {
     if (offload()) {
+        // Flushing after a $stop or $fatal writes the window
+        if (m_windowDumps && m_contextp && m_contextp->gotError()) windowWrite();
         // Hand an empty buffer to the worker thread
         uint32_t* const bufferp = getOffloadBuffer();
         *bufferp = VerilatedTraceOffloadCommand::END;
@@ -265,6 +355,121 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::flushBase() {
     }
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::recordWindow(uint32_t dumps)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (VL_UNLIKELY(nextCode())) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "recordWindow must be called before opening the trace file");
+    }
+    m_windowDumps = dumps;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpWindow() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    windowWrite();
+    flushBase();
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadBuffers(uint32_t buffers)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (VL_UNLIKELY(nextCode())) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "offloadBuffers must be called before opening the trace file");
+    }
+    m_maxOffloadBuffers = std::max(buffers, 1U);
+}
+
+//=============================================================================
+// Trace profiling
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::profile(bool flag) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (VL_UNLIKELY(nextCode())) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "profile must be called before opening the trace file");
+    }
+    m_prof = flag;
+}
+
+template <>
+std::string VerilatedTrace<VL_SUB_T, VL_BUF_T>::profileReport() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (!m_prof || !m_profChgBitsp) return "Trace profile: not enabled\n";
+    // Let the offload thread finish, so its time and changes are counted
+    flushBase();
+
+    std::string out;
+    char buf[200];
+    const auto msOf = [](uint64_t ns) { return static_cast<double>(ns) / 1e6; };
+
+    static const char* const phaseNames[PROF_PHASES]
+        = {"setup", "full dump", "change dump", "const dump", "cleanup", "offload thread",
+           "file write (in above)"};
+    uint64_t totalNs = 0;
+    for (int i = 0; i < PROF_WRITE; ++i) totalNs += m_profPhaseNs[i];
+    VL_SNPRINTF(buf, sizeof(buf), "Trace profile: %" PRIu64 " dumps, %.3f ms\n", m_profDumps,
+                msOf(totalNs));
+    out += buf;
+    out += "  Phase                   Time ms   Percent\n";
+    for (int i = 0; i < PROF_PHASES; ++i) {
+        const uint64_t ns = m_profPhaseNs[i];
+        VL_SNPRINTF(buf, sizeof(buf), "  %-22s %8.3f  %7.2f%%\n", phaseNames[i], msOf(ns),
+                    totalNs ? 100.0 * ns / totalNs : 0.0);
+        out += buf;
+    }
+
+    // Most expensive callbacks
+    std::vector<std::pair<uint64_t, std::pair<int, uint32_t>>> cbs;
+    for (int phase = 0; phase < 3; ++phase) {
+        for (uint32_t fidx = 0; fidx < m_profCbNs[phase].size(); ++fidx) {
+            const uint64_t ns = m_profCbNs[phase][fidx];
+            if (ns) cbs.emplace_back(ns, std::make_pair(phase, fidx));
+        }
+    }
+    std::sort(cbs.begin(), cbs.end(), [](const decltype(cbs)::value_type& a,
+                                         const decltype(cbs)::value_type& b) {
+        return a.first > b.first;
+    });
+    if (!cbs.empty()) out += "  Callback                Time ms\n";
+    for (size_t i = 0; i < cbs.size() && i < 20; ++i) {
+        VL_SNPRINTF(buf, sizeof(buf), "  %-12s fidx %-5u %8.3f\n",
+                    phaseNames[PROF_FULL + cbs[i].second.first], cbs[i].second.second,
+                    msOf(cbs[i].first));
+        out += buf;
+    }
+
+    // Scopes with most changed bits
+    std::vector<uint64_t> scopeBits(m_profScopes.size(), 0);
+    for (uint32_t code = 0; code < m_profCodeScope.size(); ++code) {
+        const uint32_t scope = m_profCodeScope[code];
+        if (scope < scopeBits.size()) scopeBits[scope] += m_profChgBitsp[code];
+    }
+    std::vector<uint32_t> scopes(scopeBits.size());
+    for (uint32_t i = 0; i < scopes.size(); ++i) scopes[i] = i;
+    std::sort(scopes.begin(), scopes.end(), [&](uint32_t a, uint32_t b) {
+        return scopeBits[a] != scopeBits[b] ? scopeBits[a] > scopeBits[b]
+                                            : m_profScopes[a] < m_profScopes[b];
+    });
+    // Rate per simulated second
+    const double simSeconds = static_cast<double>(m_timeLastDump - m_profFirstDump) * m_timeRes;
+    if (!scopes.empty()) out += "  Scope                   Changed bits      Bits/sim-s\n";
+    for (size_t i = 0; i < scopes.size() && i < 20; ++i) {
+        const uint32_t scope = scopes[i];
+        if (!scopeBits[scope]) break;
+        VL_SNPRINTF(buf, sizeof(buf), "  %-22s %13" PRIu64 "  %14.4g\n",
+                    m_profScopes[scope].c_str(), scopeBits[scope],
+                    simSeconds > 0 ? scopeBits[scope] / simSeconds : 0.0);
+        out += buf;
+    }
+    return out;
+}
+
 //=============================================================================
 // Callbacks to run on global events
 
@@ -280,6 +485,24 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::onExit(void* selfp) {
     reinterpret_cast<VL_SUB_T*>(selfp)->close();
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::onPrepareFork(void* selfp) {
+    VerilatedTrace<VL_SUB_T, VL_BUF_T>* const tracep
+        = reinterpret_cast<VerilatedTrace<VL_SUB_T, VL_BUF_T>*>(selfp);
+    // Already flushed, so the worker has nothing pending
+    tracep->m_restartOffloadWorker = tracep->m_workerThread != nullptr;
+    tracep->shutdownOffloadWorker();
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::onResumeFork(void* selfp) {
+    VerilatedTrace<VL_SUB_T, VL_BUF_T>* const tracep
+        = reinterpret_cast<VerilatedTrace<VL_SUB_T, VL_BUF_T>*>(selfp);
+    if (!tracep->m_restartOffloadWorker) return;
+    tracep->m_restartOffloadWorker = false;
+    tracep->startOffloadWorker();
+}
+
 //=============================================================================
 // VerilatedTrace
 
@@ -293,8 +516,11 @@ template <>
 VerilatedTrace<VL_SUB_T, VL_BUF_T>::~VerilatedTrace() {
     if (m_sigs_oldvalp) VL_DO_CLEAR(delete[] m_sigs_oldvalp, m_sigs_oldvalp = nullptr);
     if (m_sigs_enabledp) VL_DO_CLEAR(delete[] m_sigs_enabledp, m_sigs_enabledp = nullptr);
+    if (m_profChgBitsp) VL_DO_CLEAR(delete[] m_profChgBitsp, m_profChgBitsp = nullptr);
     Verilated::removeFlushCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onFlush, this);
     Verilated::removeExitCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onExit, this);
+    Verilated::removeForkCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onPrepareFork,
+                            VerilatedTrace<VL_SUB_T, VL_BUF_T>::onResumeFork, this);
     if (offload()) closeBase();
 }
 
@@ -311,6 +537,7 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     m_numSignals = 0;
     m_maxBits = 0;
     m_sigs_enabledVec.clear();
+    m_profCodeScope.clear();
 
     // Call all initialize callbacks, which will:
     // - Call decl* for each signal (these eventually call ::declCode)
@@ -322,9 +549,28 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
                     "Reopening trace file with different number of signals");
     }
 
+    if (VL_UNCOVERABLE(m_windowDumps && !offload())) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "recordWindow requires offloaded tracing, see --trace-threads");
+    }
+
     // Now that we know the number of codes, allocate space for the buffer
     // holding previous signal values.
-    if (!m_sigs_oldvalp) m_sigs_oldvalp = new uint32_t[nextCode()];
+    // When profiling start from zero, so the first dump counts bits set as changed.
+    if (!m_sigs_oldvalp) {
+        m_sigs_oldvalp = m_prof ? new uint32_t[nextCode()]() : new uint32_t[nextCode()];
+    }
+
+    if (m_prof) {
+        if (!m_profChgBitsp) m_profChgBitsp = new uint64_t[nextCode()]();
+        uint32_t maxFidx = 0;
+        for (const std::vector<CallbackRecord>* const cbVecp :
+             {&m_fullCbs, &m_fullOffloadCbs, &m_chgCbs, &m_chgOffloadCbs, &m_constCbs,
+              &m_constOffloadCbs}) {
+            for (const CallbackRecord& cbr : *cbVecp) maxFidx = std::max(maxFidx, cbr.m_fidx);
+        }
+        for (std::vector<uint64_t>& cbNs : m_profCbNs) cbNs.resize(maxFidx + 1, 0);
+    }
 
     // Apply enables
     if (m_sigs_enabledp) VL_DO_CLEAR(delete[] m_sigs_enabledp, m_sigs_enabledp = nullptr);
@@ -352,12 +598,16 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
         // each signal, which is 'nextCode()' entries after the init callbacks
         // above have been run, plus up to 2 more words of metadata per signal,
         // plus fixed overhead of 1 for a termination flag and 3 for a time stamp
-        // update.
-        m_offloadBufferSize = nextCode() + numSignals() * 2 + 4;
+        // update, and 3 for each trace buffer (a windowed full dump has both the
+        // full and the const dump callbacks).
+        const size_t numCbs = std::max(m_chgOffloadCbs.size(),
+                                       m_fullOffloadCbs.size() + m_constOffloadCbs.size());
+        m_offloadBufferSize = nextCode() + numSignals() * 2 + 4 + 3 * numCbs;
 
         // Start the worker thread
-        m_workerThread.reset(
-            new std::thread{&VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain, this});
+        startOffloadWorker();
+        Verilated::addForkCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onPrepareFork,
+                             VerilatedTrace<VL_SUB_T, VL_BUF_T>::onResumeFork, this);
     }
 }
 
@@ -393,6 +643,17 @@ bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::declCode(uint32_t code, const std::stri
         break;
     }
 
+    if (VL_UNLIKELY(m_prof)) {
+        // Changes are attributed to the scope, the name up to the signal's own name
+        const size_t pos = declName.rfind(' ');
+        std::string scope = pos == std::string::npos ? "" : declName.substr(0, pos);
+        std::replace(scope.begin(), scope.end(), ' ', '.');
+        const auto it = m_profScopeIdx.emplace(scope, m_profScopes.size());
+        if (it.second) m_profScopes.push_back(scope);
+        if (m_profCodeScope.size() <= code) m_profCodeScope.resize(code + 1, UINT32_MAX);
+        m_profCodeScope[code] = it.first->second;
+    }
+
     int codesNeeded = VL_WORDS_I(bits);
     m_nextCode = std::max(m_nextCode, code + codesNeeded);
     ++m_numSignals;
@@ -445,7 +706,9 @@ template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::parallelWorkerTask(void* datap, bool) {
     ParallelWorkerData* const wdp = reinterpret_cast<ParallelWorkerData*>(datap);
     // Run the task
+    const uint64_t profStartNs = wdp->m_profNsp ? profNowNs() : 0;
     wdp->m_cb(wdp->m_userp, wdp->m_bufp);
+    if (wdp->m_profNsp) *wdp->m_profNsp += profNowNs() - profStartNs;
     // Mark buffer as ready
     const VerilatedLockGuard lock{wdp->m_mutex};
     wdp->m_ready.store(true);
@@ -467,7 +730,10 @@ VL_ATTR_NOINLINE void VerilatedTrace<VL_SUB_T, VL_BUF_T>::ParallelWorkerData::wa
 }
 
 template <>
-void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<CallbackRecord>& cbVec) {
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<CallbackRecord>& cbVec,
+                                                      ProfPhase phase) {
+    // Time of each callback, by fidx, if profiling
+    uint64_t* const profNsp = m_prof ? m_profCbNs[phase - PROF_FULL].data() : nullptr;
     if (parallel()) {
         // If tracing in parallel, dispatch to the thread pool
         VlThreadPool* threadPoolp = static_cast<VlThreadPool*>(m_contextp->threadPoolp());
@@ -482,12 +748,13 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
             // Always get the trace buffer on the main thread
             Buffer* const bufp = getTraceBuffer(cbr.m_fidx);
             // Create new work item
-            workerData.emplace_back(cbr.m_dumpCb, cbr.m_userp, bufp);
+            workerData.emplace_back(cbr.m_dumpCb, cbr.m_userp, bufp,
+                                    profNsp ? profNsp + cbr.m_fidx : nullptr);
             // Grab the new work item
             ParallelWorkerData* const itemp = &workerData.back();
             // Enqueue task to thread pool, or main thread
             if (unsigned rem = cbr.m_fidx % threads) {
-                threadPoolp->workerp(rem - 1)->addTask(parallelWorkerTask, itemp);
+                threadPoolp->workerp(rem - 1)->addStealableTask(parallelWorkerTask, itemp);
             } else {
                 mainThreadWorkerData.push_back(itemp);
             }
@@ -496,33 +763,40 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
         for (ParallelWorkerData* const itemp : mainThreadWorkerData) {
             parallelWorkerTask(itemp, false);
         }
-        // Commit all trace buffers in order
+        // Wait until all buffers are ready, then commit them, in order
+        std::vector<Buffer*> bufps;
+        bufps.reserve(workerData.size());
         for (ParallelWorkerData& item : workerData) {
-            // Wait until ready
             item.wait();
-            // Commit the buffer
-            commitTraceBuffer(item.m_bufp);
+            bufps.push_back(item.m_bufp);
         }
+        commitTraceBuffers(bufps.data(), bufps.size());
 
         // Done
         return;
     }
     // Fall back on sequential execution
     for (const CallbackRecord& cbr : cbVec) {
+        const uint64_t profStartNs = profNsp ? profNowNs() : 0;
         Buffer* const traceBufferp = getTraceBuffer(cbr.m_fidx);
         cbr.m_dumpCb(cbr.m_userp, traceBufferp);
         commitTraceBuffer(traceBufferp);
+        if (profNsp) profNsp[cbr.m_fidx] += profNowNs() - profStartNs;
     }
 }
 
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runOffloadedCallbacks(
-    const std::vector<CallbackRecord>& cbVec) {
+    const std::vector<CallbackRecord>& cbVec, ProfPhase phase) {
+    // Time of each callback, by fidx, if profiling
+    uint64_t* const profNsp = m_prof ? m_profCbNs[phase - PROF_FULL].data() : nullptr;
     // Fall back on sequential execution
     for (const CallbackRecord& cbr : cbVec) {
+        const uint64_t profStartNs = profNsp ? profNowNs() : 0;
         Buffer* traceBufferp = getTraceBuffer(cbr.m_fidx);
         cbr.m_dumpOffloadCb(cbr.m_userp, static_cast<OffloadBuffer*>(traceBufferp));
         commitTraceBuffer(traceBufferp);
+        if (profNsp) profNsp[cbr.m_fidx] += profNowNs() - profStartNs;
     }
 }
 
@@ -532,17 +806,34 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
     // This does get the mutex, but if multiple threads are trying to dump
     // chances are the data being dumped will have other problems
     const VerilatedLockGuard lock{m_mutex};
+    const VlRegionProfiler::Guard regionGuard{m_contextp, "trace dump"};
     if (VL_UNCOVERABLE(m_didSomeDump && timeui <= m_timeLastDump)) {  // LCOV_EXCL_START
         VL_PRINTF_MT("%%Warning: previous dump at t=%" PRIu64 ", requesting t=%" PRIu64
                      ", dump call ignored\n",
                      m_timeLastDump, timeui);
         return;
     }  // LCOV_EXCL_STOP
+    uint64_t profNs = m_prof ? profNowNs() : 0;
+    // Add time since profNs to 'phase', and restart
+    const auto profPhase = [&](ProfPhase phase) {
+        const uint64_t nowNs = profNowNs();
+        m_profPhaseNs[phase] += nowNs - profNs;
+        profNs = nowNs;
+    };
+    if (m_prof && !m_profDumps++) m_profFirstDump = timeui;
     m_timeLastDump = timeui;
     m_didSomeDump = true;
 
     Verilated::quiesce();
 
+    // When windowing, start a new segment with a full dump once the last is long enough
+    if (VL_UNLIKELY(m_windowDumps) && !m_windowSegments.empty()
+        && m_windowSegments.back().size() >= m_windowDumps) {
+        m_fullDump = true;
+        m_constDump = true;
+    }
+    const bool fullDump = m_fullDump;
+
     // Call hook for format-specific behaviour
     if (VL_UNLIKELY(m_fullDump)) {
         if (!preFullDump()) return;
@@ -552,8 +843,8 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
 
     uint32_t* bufferp = nullptr;
     if (offload()) {
-        // Currently only incremental dumps run on the worker thread
-        if (VL_LIKELY(!m_fullDump)) {
+        // Currently only incremental dumps run on the worker thread, unless windowing
+        if (VL_LIKELY(!m_fullDump) || m_windowDumps) {
             // Get the offload buffer we are about to fill
             bufferp = getOffloadBuffer();
             m_offloadBufferWritep = bufferp;
@@ -576,32 +867,38 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
         emitTimeChange(timeui);
     }
 
+    if (VL_UNLIKELY(m_prof)) profPhase(PROF_SETUP);
+
     // Run the callbacks
     if (VL_UNLIKELY(m_fullDump)) {
         m_fullDump = false;  // No more need for next dump to be full
         if (offload()) {
-            runOffloadedCallbacks(m_fullOffloadCbs);
+            runOffloadedCallbacks(m_fullOffloadCbs, PROF_FULL);
         } else {
-            runCallbacks(m_fullCbs);
+            runCallbacks(m_fullCbs, PROF_FULL);
         }
+        if (VL_UNLIKELY(m_prof)) profPhase(PROF_FULL);
     } else {
         if (offload()) {
-            runOffloadedCallbacks(m_chgOffloadCbs);
+            runOffloadedCallbacks(m_chgOffloadCbs, PROF_CHG);
         } else {
-            runCallbacks(m_chgCbs);
+            runCallbacks(m_chgCbs, PROF_CHG);
         }
+        if (VL_UNLIKELY(m_prof)) profPhase(PROF_CHG);
     }
 
     if (VL_UNLIKELY(m_constDump)) {
         m_constDump = false;
         if (offload()) {
-            runOffloadedCallbacks(m_constOffloadCbs);
+            runOffloadedCallbacks(m_constOffloadCbs, PROF_CONST);
         } else {
-            runCallbacks(m_constCbs);
+            runCallbacks(m_constCbs, PROF_CONST);
         }
+        if (VL_UNLIKELY(m_prof)) profPhase(PROF_CONST);
     }
 
     for (const CallbackRecord& cbr : m_cleanupCbs) cbr.m_cleanupCb(cbr.m_userp, self());
+    if (VL_UNLIKELY(m_prof)) profPhase(PROF_CLEANUP);
 
     if (offload() && VL_LIKELY(bufferp)) {
         // Mark end of the offload buffer we just filled
@@ -614,8 +911,12 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
         m_offloadBufferWritep = nullptr;
         m_offloadBufferEndp = nullptr;
 
-        // Pass it to the worker thread
-        m_offloadBuffersToWorker.put(bufferp);
+        // Pass it to the worker thread, or hold it until the window is written
+        if (VL_UNLIKELY(m_windowDumps)) {
+            windowHold(bufferp, fullDump);
+        } else {
+            m_offloadBuffersToWorker.put(bufferp);
+        }
     }
 }
 
@@ -815,7 +1116,8 @@ template <>
 VerilatedTraceBuffer<VL_BUF_T>::VerilatedTraceBuffer(Trace& owner)
     : VL_BUF_T{owner}
     , m_sigs_oldvalp{owner.m_sigs_oldvalp}
-    , m_sigs_enabledp{owner.m_sigs_enabledp} {}
+    , m_sigs_enabledp{owner.m_sigs_enabledp}
+    , m_profChgBitsp{owner.m_profChgBitsp} {}
 
 // These functions must write the new value back into the old value store,
 // and subsequently call the format-specific emit* implementations. Note
@@ -825,6 +1127,7 @@ VerilatedTraceBuffer<VL_BUF_T>::VerilatedTraceBuffer(Trace& owner)
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullBit(uint32_t* oldp, CData newval) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) m_profChgBitsp[code] += (*oldp ^ newval) & 1;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     emitBit(code, newval);
@@ -833,6 +1136,7 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullBit(uint32_t* oldp, CData newval) {
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullEvent(uint32_t* oldp, const VlEventBase* newvalp) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) m_profChgBitsp[code] += newvalp->isTriggered();
     // No need to update *oldp
     if (newvalp->isTriggered()) emitEvent(code);
 }
@@ -840,6 +1144,7 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullEvent(uint32_t* oldp, const VlEventBase
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullEventTriggered(uint32_t* oldp) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) ++m_profChgBitsp[code];
     // No need to update *oldp
     emitEvent(code);
 }
@@ -847,6 +1152,7 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullEventTriggered(uint32_t* oldp) {
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullCData(uint32_t* oldp, CData newval, int bits) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) m_profChgBitsp[code] += VL_COUNTONES_I(*oldp ^ newval);
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     emitCData(code, newval, bits);
@@ -855,6 +1161,7 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullCData(uint32_t* oldp, CData newval, int
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullSData(uint32_t* oldp, SData newval, int bits) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) m_profChgBitsp[code] += VL_COUNTONES_I(*oldp ^ newval);
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     emitSData(code, newval, bits);
@@ -863,6 +1170,7 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullSData(uint32_t* oldp, SData newval, int
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullIData(uint32_t* oldp, IData newval, int bits) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) m_profChgBitsp[code] += VL_COUNTONES_I(*oldp ^ newval);
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     emitIData(code, newval, bits);
@@ -871,6 +1179,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullIData(uint32_t* oldp, IData newval, int
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullQData(uint32_t* oldp, QData newval, int bits) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) {
+        QData old;
+        std::memcpy(&old, oldp, sizeof(old));
+        m_profChgBitsp[code] += VL_COUNTONES_Q(old ^ newval);
+    }
     std::memcpy(oldp, &newval, sizeof(newval));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     emitQData(code, newval, bits);
@@ -879,7 +1192,12 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullQData(uint32_t* oldp, QData newval, int
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullWData(uint32_t* oldp, const WData* newvalp, int bits) {
     const uint32_t code = oldp - m_sigs_oldvalp;
-    for (int i = 0; i < VL_WORDS_I(bits); ++i) oldp[i] = newvalp[i];
+    if (VL_UNLIKELY(m_profChgBitsp)) {
+        for (int i = 0; i < VL_WORDS_I(bits); ++i) {
+            m_profChgBitsp[code] += VL_COUNTONES_I(oldp[i] ^ newvalp[i]);
+        }
+    }
+    std::memcpy(oldp, newvalp, VL_WORDS_I(bits) * sizeof(uint32_t));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     emitWData(code, newvalp, bits);
 }
@@ -887,6 +1205,13 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullWData(uint32_t* oldp, const WData* newv
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullDouble(uint32_t* oldp, double newval) {
     const uint32_t code = oldp - m_sigs_oldvalp;
+    if (VL_UNLIKELY(m_profChgBitsp)) {
+        QData old;
+        QData now;
+        std::memcpy(&old, oldp, sizeof(old));
+        std::memcpy(&now, &newval, sizeof(now));
+        m_profChgBitsp[code] += VL_COUNTONES_Q(old ^ now);
+    }
     std::memcpy(oldp, &newval, sizeof(newval));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
     // cppcheck-suppress invalidPointerCast
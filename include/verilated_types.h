@@ -32,11 +32,15 @@
 #include <array>
 #include <atomic>
 #include <deque>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <new>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=========================================================================
 // Debug functions
@@ -103,16 +107,73 @@ constexpr IData VL_CLOG2_CE_Q(QData lhs) VL_PURE {
     return lhs <= 1 ? 0 : VL_CLOG2_CE_Q((lhs + 1) >> 1ULL) + 1;
 }
 
+//===================================================================
+// Per-thread free lists of small memory blocks, one per allocation size, for objects created and
+// deleted at a high rate.  Each list keeps a bounded number of blocks, and a thread's blocks are
+// returned to the heap when it exits.  A block may be freed by a thread other than its allocator.
+
+class VlBlockPool final {
+public:
+    // Return a block of at least 'size' bytes, setting 'reused' if it was recycled
+    static void* allocate(size_t size, bool& reused) VL_MT_SAFE;
+    static void* allocate(size_t size) VL_MT_SAFE {
+        bool reused;
+        return allocate(size, reused);
+    }
+    // Free a block from allocate(), which must be passed the same 'size'
+    static void deallocate(void* blockp, size_t size) VL_MT_SAFE;
+};
+
 // Metadata of processes
 class VlProcess;
 
-using VlProcessRef = std::shared_ptr<VlProcess>;
+// Reference counted handle to a VlProcess. A process is only used by the thread evaluating its
+// model, so unlike std::shared_ptr the count is not atomic.
+class VlProcessRef final {
+    // MEMBERS
+    VlProcess* m_processp = nullptr;  // Referenced process, null if none
+
+public:
+    // CONSTRUCTORS
+    VlProcessRef() = default;
+    // cppcheck-suppress noExplicitConstructor
+    VlProcessRef(std::nullptr_t) {}
+    inline explicit VlProcessRef(VlProcess* processp);
+    VlProcessRef(const VlProcessRef& other)
+        : VlProcessRef{other.m_processp} {}
+    VlProcessRef(VlProcessRef&& other) noexcept
+        : m_processp{std::exchange(other.m_processp, nullptr)} {}
+    inline ~VlProcessRef();
+    VlProcessRef& operator=(const VlProcessRef& other) {
+        VlProcessRef{other}.swap(*this);
+        return *this;
+    }
+    VlProcessRef& operator=(VlProcessRef&& other) noexcept {
+        VlProcessRef{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    // METHODS
+    void swap(VlProcessRef& other) noexcept { std::swap(m_processp, other.m_processp); }
+    VlProcess* get() const { return m_processp; }
+    VlProcess* operator->() const { return m_processp; }
+    VlProcess& operator*() const { return *m_processp; }
+    explicit operator bool() const { return m_processp; }
+    bool operator==(const VlProcessRef& rhs) const { return m_processp == rhs.m_processp; }
+    bool operator!=(const VlProcessRef& rhs) const { return m_processp != rhs.m_processp; }
+    bool operator<(const VlProcessRef& rhs) const { return m_processp < rhs.m_processp; }
+};
 
 class VlProcess final {
+    friend class VlProcessRef;
+
     // MEMBERS
     int m_state;  // Current state of the process
-    VlProcessRef m_parentp = nullptr;  // Parent process, if exists
-    std::set<VlProcess*> m_children;  // Active child processes
+    uint32_t m_refCount = 0;  // Number of VlProcessRef's and children referencing this
+    VlProcess* const m_parentp;  // Parent process, if exists, referenced while this exists
+    VlProcess* m_childrenp = nullptr;  // First active child process
+    VlProcess* m_prevp = nullptr;  // Previous sibling in parent's active child list
+    VlProcess* m_nextp = nullptr;  // Next sibling in parent's active child list
 
 public:
     // TYPES
@@ -124,23 +185,50 @@ public:
         KILLED = 4,
     };
 
+private:
     // CONSTRUCTORS
-    // Construct independent process
-    VlProcess()
-        : m_state{RUNNING} {}
-    // Construct child process of parent
-    explicit VlProcess(VlProcessRef parentp)
+    explicit VlProcess(VlProcess* parentp)
         : m_state{RUNNING}
         , m_parentp{parentp} {
-        m_parentp->attach(this);
+        if (m_parentp) {
+            ++m_parentp->m_refCount;
+            m_parentp->attach(this);
+        }
     }
-
     ~VlProcess() {
-        if (m_parentp) m_parentp->detach(this);
+        if (m_parentp) {
+            m_parentp->detach(this);
+            m_parentp->release();
+        }
     }
+    VL_UNCOPYABLE(VlProcess);
 
-    void attach(VlProcess* childp) { m_children.insert(childp); }
-    void detach(VlProcess* childp) { m_children.erase(childp); }
+    // Forks allocate and free processes at a high rate, so they are recycled by VlBlockPool
+    void release() {
+        if (--m_refCount) return;
+        this->~VlProcess();
+        VlBlockPool::deallocate(this, sizeof(VlProcess));
+    }
+    void attach(VlProcess* childp) {
+        childp->m_nextp = m_childrenp;
+        if (m_childrenp) m_childrenp->m_prevp = childp;
+        m_childrenp = childp;
+    }
+    void detach(VlProcess* childp) {
+        if (childp->m_prevp) {
+            childp->m_prevp->m_nextp = childp->m_nextp;
+        } else {
+            m_childrenp = childp->m_nextp;
+        }
+        if (childp->m_nextp) childp->m_nextp->m_prevp = childp->m_prevp;
+    }
+
+public:
+    // Construct independent process, or child process of parent
+    static VlProcessRef create(const VlProcessRef& parentp = nullptr) {
+        void* const memp = VlBlockPool::allocate(sizeof(VlProcess));
+        return VlProcessRef{new (memp) VlProcess{parentp.get()}};
+    }
 
     int state() const { return m_state; }
     void state(int s) { m_state = s; }
@@ -149,16 +237,24 @@ public:
         disableFork();
     }
     void disableFork() {
-        for (VlProcess* childp : m_children) childp->disable();
+        for (VlProcess* childp = m_childrenp; childp; childp = childp->m_nextp) childp->disable();
     }
     bool completed() const { return state() == FINISHED || state() == KILLED; }
     bool completedFork() const {
-        for (const VlProcess* const childp : m_children)
+        for (const VlProcess* childp = m_childrenp; childp; childp = childp->m_nextp)
             if (!childp->completed()) return false;
         return true;
     }
 };
 
+VlProcessRef::VlProcessRef(VlProcess* processp)
+    : m_processp{processp} {
+    if (m_processp) ++m_processp->m_refCount;
+}
+VlProcessRef::~VlProcessRef() {
+    if (m_processp) m_processp->release();
+}
+
 inline std::string VL_TO_STRING(const VlProcessRef& p) { return std::string("process"); }
 
 //===================================================================
@@ -171,6 +267,17 @@ class VlTriggerVec final {
     // MEMBERS
     alignas(16) std::array<uint64_t, roundUpToMultipleOf<64>(N_Size) / 64> m_flags;  // The flags
 
+    // Index of least significant set bit; w must be non-zero
+    static size_t ctz(uint64_t w) {
+#ifdef __GNUC__
+        return __builtin_ctzll(w);
+#else
+        size_t r = 0;
+        for (; !(w & 1); w >>= 1) ++r;
+        return r;
+#endif
+    }
+
 public:
     // CONSTRUCTOR
     VlTriggerVec() { clear(); }
@@ -197,9 +304,18 @@ public:
 
     // Return true iff at least one element is set
     bool any() const {
-        for (size_t i = 0; i < m_flags.size(); ++i)
-            if (m_flags[i]) return true;
-        return false;
+        // Reduce without early exit, so the compiler can vectorize wide vectors
+        uint64_t result = 0;
+        for (size_t i = 0; i < m_flags.size(); ++i) result |= m_flags[i];
+        return result != 0;
+    }
+
+    // Call 'f' with the index of each set element, in increasing order
+    template <typename T_Func>
+    void forEachSet(T_Func&& f) const {
+        for (size_t i = 0; i < m_flags.size(); ++i) {
+            for (uint64_t w = m_flags[i]; w; w &= w - 1) f(i * 64 + ctz(w));
+        }
     }
 
     // Set all elements true in 'this' that are set in 'other'
@@ -296,6 +412,22 @@ public:
     std::string get_randstate() const VL_MT_UNSAFE;
     void set_randstate(const std::string& state) VL_MT_UNSAFE;
     uint64_t rand64() VL_MT_UNSAFE;
+    // Fill n values, each the low bits of the next rand64(), the same as calling
+    // rand64() n times, but keeping the state in registers
+    template <typename T>
+    void fill(T* datap, size_t n) VL_MT_UNSAFE {
+        // Xoroshiro128+ algorithm
+        uint64_t s0 = m_state[0];
+        uint64_t s1 = m_state[1];
+        for (size_t i = 0; i < n; ++i) {
+            datap[i] = static_cast<T>(s0 + s1);
+            s1 ^= s0;
+            s0 = ((s0 << 55) | (s0 >> 9)) ^ s1 ^ (s1 << 14);
+            s1 = (s1 << 36) | (s1 >> 28);
+        }
+        m_state[0] = s0;
+        m_state[1] = s1;
+    }
     // Threadsafe, but requires use on vl_thread_rng
     static uint64_t vl_thread_rng_rand64() VL_MT_SAFE;
     static VlRNG& vl_thread_rng() VL_MT_SAFE;
@@ -381,6 +513,17 @@ class VlReadMem final {
     QData m_addr = 0;  // Next address to read
     int m_linenum = 0;  // Line number last read from file
     bool m_anyAddr = false;  // Had address directive in the file
+    std::vector<char> m_buf;  // File contents being parsed, read a block at a time
+    size_t m_bufPos = 0;  // Next character to parse in m_buf
+    size_t m_bufEnd = 0;  // End of valid characters in m_buf
+
+    bool fill();
+    int nextc() {
+        if (VL_UNLIKELY(m_bufPos == m_bufEnd) && !fill()) return EOF;
+        return static_cast<unsigned char>(m_buf[m_bufPos++]);
+    }
+    void unnextc() { --m_bufPos; }  // Only after nextc() returned a character
+
 public:
     VlReadMem(bool hex, int bits, const std::string& filename, QData start, QData end);
     ~VlReadMem();
@@ -474,6 +617,312 @@ std::string VL_TO_STRING(const VlWide<N_Words>& obj) {
     return VL_TO_STRING_W(N_Words, obj.data());
 }
 
+//===================================================================
+// Ring buffer backing store for VlQueue
+// Elements live in contiguous power-of-two storage addressed modulo its
+// capacity, so push/pop at either end is O(1) and indexing is a mask.
+// When N_InlineSize is non-zero that many elements (rounded up to a power
+// of two) are held inside the object, and heap storage is only used if a
+// queue grows past it.
+
+template <size_t N_Value>
+struct VlRingPow2 final {
+    static constexpr size_t value = VlRingPow2<(N_Value + 1) / 2>::value * 2;
+};
+template <>
+struct VlRingPow2<1> final {
+    static constexpr size_t value = 1;
+};
+template <>
+struct VlRingPow2<0> final {
+    static constexpr size_t value = 0;
+};
+
+template <typename T_Value, size_t N_InlineSize>
+struct VlRingInline final {
+    static constexpr size_t capacity = VlRingPow2<N_InlineSize>::value;
+    alignas(T_Value) unsigned char m_storage[capacity * sizeof(T_Value)];
+    T_Value* datap() { return reinterpret_cast<T_Value*>(m_storage); }
+};
+template <typename T_Value>
+struct VlRingInline<T_Value, 0> final {
+    static constexpr size_t capacity = 0;
+    T_Value* datap() { return nullptr; }
+};
+
+template <typename T_Value, size_t N_InlineSize = 0>
+class VlRingBuffer final {
+    // TYPES
+    using Inline = VlRingInline<T_Value, N_InlineSize>;
+
+    template <bool T_Const>
+    class Iterator final {
+        friend class VlRingBuffer;
+        template <bool T_OtherConst>
+        friend class Iterator;
+        using Container = typename std::conditional<T_Const, const VlRingBuffer, VlRingBuffer>::type;
+        Container* m_containerp = nullptr;
+        std::ptrdiff_t m_index = 0;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T_Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<T_Const, const T_Value*, T_Value*>::type;
+        using reference = typename std::conditional<T_Const, const T_Value&, T_Value&>::type;
+
+        Iterator() = default;
+        Iterator(Container* containerp, std::ptrdiff_t index)
+            : m_containerp{containerp}
+            , m_index{index} {}
+        // Mutable iterators convert to const ones
+        template <bool T_OtherConst,
+                  typename = typename std::enable_if<T_Const && !T_OtherConst>::type>
+        Iterator(const Iterator<T_OtherConst>& other)  // cppcheck-suppress noExplicitConstructor
+            : m_containerp{other.m_containerp}
+            , m_index{other.m_index} {}
+
+        reference operator*() const { return (*m_containerp)[m_index]; }
+        pointer operator->() const { return &(*m_containerp)[m_index]; }
+        reference operator[](difference_type n) const { return (*m_containerp)[m_index + n]; }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator it = *this;
+            ++m_index;
+            return it;
+        }
+        Iterator& operator--() {
+            --m_index;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator it = *this;
+            --m_index;
+            return it;
+        }
+        Iterator& operator+=(difference_type n) {
+            m_index += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) {
+            m_index -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const { return Iterator{m_containerp, m_index + n}; }
+        friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+        Iterator operator-(difference_type n) const { return Iterator{m_containerp, m_index - n}; }
+        difference_type operator-(const Iterator& rhs) const { return m_index - rhs.m_index; }
+        bool operator==(const Iterator& rhs) const { return m_index == rhs.m_index; }
+        bool operator!=(const Iterator& rhs) const { return m_index != rhs.m_index; }
+        bool operator<(const Iterator& rhs) const { return m_index < rhs.m_index; }
+        bool operator>(const Iterator& rhs) const { return m_index > rhs.m_index; }
+        bool operator<=(const Iterator& rhs) const { return m_index <= rhs.m_index; }
+        bool operator>=(const Iterator& rhs) const { return m_index >= rhs.m_index; }
+    };
+
+public:
+    using value_type = T_Value;
+    using size_type = size_t;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    // MEMBERS
+    Inline m_inline;  // Inline storage, used while size fits
+    T_Value* m_datap = m_inline.datap();  // Element storage, m_inline or heap
+    size_t m_capacity = Inline::capacity;  // Storage size, zero or a power of two
+    size_t m_head = 0;  // Storage slot of element 0
+    size_t m_size = 0;  // Number of constructed elements
+
+public:
+    // CONSTRUCTORS
+    VlRingBuffer() = default;
+    ~VlRingBuffer() {
+        clear();
+        releaseStorage();
+    }
+    VlRingBuffer(const VlRingBuffer& rhs) {
+        reserve(rhs.m_size);
+        for (const T_Value& value : rhs) emplaceBack(value);
+    }
+    VlRingBuffer(VlRingBuffer&& rhs) { takeFrom(rhs); }
+    VlRingBuffer& operator=(const VlRingBuffer& rhs) {
+        if (this != &rhs) {
+            clear();
+            reserve(rhs.m_size);
+            for (const T_Value& value : rhs) emplaceBack(value);
+        }
+        return *this;
+    }
+    VlRingBuffer& operator=(VlRingBuffer&& rhs) {
+        if (this != &rhs) {
+            clear();
+            releaseStorage();
+            takeFrom(rhs);
+        }
+        return *this;
+    }
+    // Also allow copying from a buffer with a different inline size
+    template <size_t N_RhsInlineSize>
+    VlRingBuffer& operator=(const VlRingBuffer<T_Value, N_RhsInlineSize>& rhs) {
+        clear();
+        reserve(rhs.size());
+        for (const T_Value& value : rhs) emplaceBack(value);
+        return *this;
+    }
+
+    bool operator==(const VlRingBuffer& rhs) const {
+        return m_size == rhs.m_size && std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const VlRingBuffer& rhs) const { return !(*this == rhs); }
+
+    // METHODS
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    T_Value& operator[](size_t index) { return m_datap[slot(index)]; }
+    const T_Value& operator[](size_t index) const { return m_datap[slot(index)]; }
+    T_Value& front() { return (*this)[0]; }
+    const T_Value& front() const { return (*this)[0]; }
+    T_Value& back() { return (*this)[m_size - 1]; }
+    const T_Value& back() const { return (*this)[m_size - 1]; }
+
+    iterator begin() { return iterator{this, 0}; }
+    iterator end() { return iterator{this, static_cast<std::ptrdiff_t>(m_size)}; }
+    const_iterator begin() const { return const_iterator{this, 0}; }
+    const_iterator end() const { return const_iterator{this, static_cast<std::ptrdiff_t>(m_size)}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+
+    void clear() {
+        for (size_t i = 0; i < m_size; ++i) (*this)[i].~T_Value();
+        m_head = 0;
+        m_size = 0;
+    }
+    void push_back(const T_Value& value) {
+        if (VL_UNLIKELY(m_size == m_capacity)) {
+            T_Value copy(value);  // value may be an element about to move
+            reserve(m_size + 1);
+            emplaceBack(std::move(copy));
+        } else {
+            emplaceBack(value);
+        }
+    }
+    void push_front(const T_Value& value) {
+        if (VL_UNLIKELY(m_size == m_capacity)) {
+            T_Value copy(value);  // value may be an element about to move
+            reserve(m_size + 1);
+            emplaceFront(std::move(copy));
+        } else {
+            emplaceFront(value);
+        }
+    }
+    void pop_back() {
+        back().~T_Value();
+        --m_size;
+    }
+    void pop_front() {
+        front().~T_Value();
+        m_head = slot(1);
+        --m_size;
+    }
+    void resize(size_t size, const T_Value& value) {
+        if (size < m_size) {
+            while (m_size > size) pop_back();
+        } else if (size > m_size) {
+            const T_Value copy(value);  // value may be an element about to move
+            reserve(size);
+            while (m_size < size) emplaceBack(copy);
+        }
+    }
+    void resize(size_t size) { resize(size, T_Value{}); }
+    iterator insert(const_iterator pos, const T_Value& value) {
+        const std::ptrdiff_t index = pos.m_index;
+        // Add at the nearer end, then rotate into place
+        if (static_cast<size_t>(index) < m_size / 2) {
+            push_front(value);
+            std::rotate(begin(), begin() + 1, begin() + index + 1);
+        } else {
+            push_back(value);
+            std::rotate(begin() + index, end() - 1, end());
+        }
+        return begin() + index;
+    }
+    iterator erase(const_iterator pos) {
+        const std::ptrdiff_t index = pos.m_index;
+        // Close the gap from the nearer end
+        if (static_cast<size_t>(index) < m_size / 2) {
+            std::move_backward(begin(), begin() + index, begin() + index + 1);
+            pop_front();
+        } else {
+            std::move(begin() + index + 1, end(), begin() + index);
+            pop_back();
+        }
+        return begin() + index;
+    }
+
+private:
+    size_t slot(size_t index) const { return (m_head + index) & (m_capacity - 1); }
+    template <typename T_Arg>
+    void emplaceBack(T_Arg&& value) {
+        new (&m_datap[slot(m_size)]) T_Value(std::forward<T_Arg>(value));
+        ++m_size;
+    }
+    template <typename T_Arg>
+    void emplaceFront(T_Arg&& value) {
+        const size_t head = (m_head + m_capacity - 1) & (m_capacity - 1);
+        new (&m_datap[head]) T_Value(std::forward<T_Arg>(value));
+        m_head = head;
+        ++m_size;
+    }
+    // Ensure capacity for 'size' elements, unwrapping into new storage if needed
+    void reserve(size_t size) {
+        if (size <= m_capacity) return;
+        size_t capacity = m_capacity ? m_capacity : 4;
+        while (capacity < size) capacity *= 2;
+        T_Value* const datap = static_cast<T_Value*>(::operator new(capacity * sizeof(T_Value)));
+        for (size_t i = 0; i < m_size; ++i) {
+            T_Value& item = (*this)[i];
+            new (&datap[i]) T_Value(std::move(item));
+            item.~T_Value();
+        }
+        releaseStorage();
+        m_datap = datap;
+        m_capacity = capacity;
+        m_head = 0;
+    }
+    void releaseStorage() {
+        if (m_datap != m_inline.datap()) ::operator delete(m_datap);
+        m_datap = m_inline.datap();
+        m_capacity = Inline::capacity;
+        m_head = 0;
+    }
+    // Take rhs's elements, leaving it empty. This must be empty on entry.
+    void takeFrom(VlRingBuffer& rhs) {
+        if (rhs.m_datap != rhs.m_inline.datap()) {
+            m_datap = rhs.m_datap;
+            m_capacity = rhs.m_capacity;
+            m_head = rhs.m_head;
+            m_size = rhs.m_size;
+            rhs.m_datap = rhs.m_inline.datap();
+            rhs.m_capacity = Inline::capacity;
+            rhs.m_head = 0;
+            rhs.m_size = 0;
+        } else {
+            for (T_Value& value : rhs) emplaceBack(std::move(value));
+            rhs.clear();
+        }
+    }
+};
+
 //===================================================================
 // Verilog queue and dynamic array container
 // There are no multithreaded locks on this; the base variable must
@@ -485,7 +934,11 @@ template <typename T_Value, size_t N_MaxSize = 0>
 class VlQueue final {
 private:
     // TYPES
-    using Deque = std::deque<T_Value>;
+    // Small bounded queues keep their elements inline
+    static constexpr size_t InlineSize
+        = (N_MaxSize != 0 && N_MaxSize <= 16 && N_MaxSize * sizeof(T_Value) <= 256) ? N_MaxSize
+                                                                                   : 0;
+    using Deque = VlRingBuffer<T_Value, InlineSize>;
 
 public:
     using const_iterator = typename Deque::const_iterator;
@@ -934,11 +1387,40 @@ struct VlContainsCustomStruct<VlQueue<T_Value, N_MaxSize>> : VlContainsCustomStr
 // There are no multithreaded locks on this; the base variable must
 // be protected by other means
 //
-template <typename T_Key, typename T_Value>
+// With T_Hashed the elements are kept in a hash table, for arrays with integral
+// or VlWide keys that are never walked with first/last/next/prev. Methods
+// with results depending on the key order still visit the elements in order.
+
+// Hash and equality of hashed associative array keys
+template <typename T_Key>
+struct VlAssocKeyOps final {
+    size_t operator()(const T_Key& key) const {
+        const uint64_t h = static_cast<uint64_t>(key) * 0x9e3779b97f4a7c15ULL;
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+    bool operator()(const T_Key& a, const T_Key& b) const { return a == b; }
+};
+template <std::size_t N_Words>
+struct VlAssocKeyOps<VlWide<N_Words>> final {
+    size_t operator()(const VlWide<N_Words>& key) const {
+        uint64_t h = 0;
+        for (size_t i = 0; i < N_Words; ++i) h = (h ^ key.at(i)) * 0x9e3779b97f4a7c15ULL;
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+    bool operator()(const VlWide<N_Words>& a, const VlWide<N_Words>& b) const {
+        return !(a != b);
+    }
+};
+
+template <typename T_Key, typename T_Value, bool T_Hashed = false>
 class VlAssocArray final {
 private:
     // TYPES
-    using Map = std::map<T_Key, T_Value>;
+    using Map = typename std::conditional<
+        T_Hashed,
+        std::unordered_map<T_Key, T_Value, VlAssocKeyOps<T_Key>, VlAssocKeyOps<T_Key>>,
+        std::map<T_Key, T_Value>>::type;
+    using Item = std::pair<const T_Key, T_Value>;
 
 public:
     using const_iterator = typename Map::const_iterator;
@@ -962,7 +1444,105 @@ public:
     VlAssocArray& operator=(VlAssocArray&&) = default;
     bool operator==(const VlAssocArray& rhs) const { return m_map == rhs.m_map; }
     bool operator!=(const VlAssocArray& rhs) const { return m_map != rhs.m_map; }
-    bool operator<(const VlAssocArray& rhs) const { return m_map < rhs.m_map; }
+    bool operator<(const VlAssocArray& rhs) const { return lessThan(m_map, rhs.m_map); }
+
+private:
+    // Hashed and ordered implementations of key order dependent operations
+    static bool lessThan(const std::map<T_Key, T_Value>& lhs,
+                         const std::map<T_Key, T_Value>& rhs) {
+        return lhs < rhs;
+    }
+    template <typename T_Map>
+    static bool lessThan(const T_Map& lhs, const T_Map& rhs) {
+        const std::vector<const Item*> litems = sortedItems(lhs);
+        const std::vector<const Item*> ritems = sortedItems(rhs);
+        return std::lexicographical_compare(
+            litems.begin(), litems.end(), ritems.begin(), ritems.end(),
+            [](const Item* ap, const Item* bp) { return *ap < *bp; });
+    }
+    template <typename T_Map>
+    static std::vector<const Item*> sortedItems(const T_Map& map) {
+        std::vector<const Item*> items;
+        items.reserve(map.size());
+        for (const Item& item : map) items.push_back(&item);
+        std::sort(items.begin(), items.end(),
+                  [](const Item* ap, const Item* bp) { return ap->first < bp->first; });
+        return items;
+    }
+    // Call func on each element in key order, until it returns false
+    template <typename T_Func>
+    static void forOrdered(const std::map<T_Key, T_Value>& map, T_Func func) {
+        for (const Item& item : map) {
+            if (!func(item)) return;
+        }
+    }
+    template <typename T_Map, typename T_Func>
+    static void forOrdered(const T_Map& map, T_Func func) {
+        for (const Item* const itemp : sortedItems(map)) {
+            if (!func(*itemp)) return;
+        }
+    }
+    static const Item* firstItemp(const std::map<T_Key, T_Value>& map) {
+        return map.empty() ? nullptr : &*map.cbegin();
+    }
+    static const Item* lastItemp(const std::map<T_Key, T_Value>& map) {
+        return map.empty() ? nullptr : &*map.crbegin();
+    }
+    static const Item* nextItemp(const std::map<T_Key, T_Value>& map, const T_Key& index) {
+        auto it = map.find(index);
+        if (VL_UNLIKELY(it == map.end())) return nullptr;
+        ++it;
+        if (VL_UNLIKELY(it == map.end())) return nullptr;
+        return &*it;
+    }
+    static const Item* prevItemp(const std::map<T_Key, T_Value>& map, const T_Key& index) {
+        auto it = map.find(index);
+        if (VL_UNLIKELY(it == map.end())) return nullptr;
+        if (VL_UNLIKELY(it == map.begin())) return nullptr;
+        --it;
+        return &*it;
+    }
+    // Hashed versions scan all elements
+    template <typename T_Map>
+    static const Item* firstItemp(const T_Map& map) {
+        const Item* resultp = nullptr;
+        for (const Item& item : map) {
+            if (!resultp || item.first < resultp->first) resultp = &item;
+        }
+        return resultp;
+    }
+    template <typename T_Map>
+    static const Item* lastItemp(const T_Map& map) {
+        const Item* resultp = nullptr;
+        for (const Item& item : map) {
+            if (!resultp || resultp->first < item.first) resultp = &item;
+        }
+        return resultp;
+    }
+    template <typename T_Map>
+    static const Item* nextItemp(const T_Map& map, const T_Key& index) {
+        if (VL_UNLIKELY(map.find(index) == map.end())) return nullptr;
+        const Item* resultp = nullptr;
+        for (const Item& item : map) {
+            if (index < item.first && (!resultp || item.first < resultp->first)) {
+                resultp = &item;
+            }
+        }
+        return resultp;
+    }
+    template <typename T_Map>
+    static const Item* prevItemp(const T_Map& map, const T_Key& index) {
+        if (VL_UNLIKELY(map.find(index) == map.end())) return nullptr;
+        const Item* resultp = nullptr;
+        for (const Item& item : map) {
+            if (item.first < index && (!resultp || resultp->first < item.first)) {
+                resultp = &item;
+            }
+        }
+        return resultp;
+    }
+
+public:
     // METHODS
     T_Value& atDefault() { return m_defaultValue; }
     const T_Value& atDefault() const { return m_defaultValue; }
@@ -977,34 +1557,30 @@ public:
     int exists(const T_Key& index) const { return m_map.find(index) != m_map.end(); }
     // Return first element.  Verilog: function int first(ref index);
     int first(T_Key& indexr) const {
-        const auto it = m_map.cbegin();
-        if (it == m_map.end()) return 0;
-        indexr = it->first;
+        const Item* const itemp = firstItemp(m_map);
+        if (!itemp) return 0;
+        indexr = itemp->first;
         return 1;
     }
     // Return last element.  Verilog: function int last(ref index)
     int last(T_Key& indexr) const {
-        const auto it = m_map.crbegin();
-        if (it == m_map.crend()) return 0;
-        indexr = it->first;
+        const Item* const itemp = lastItemp(m_map);
+        if (!itemp) return 0;
+        indexr = itemp->first;
         return 1;
     }
     // Return next element. Verilog: function int next(ref index)
     int next(T_Key& indexr) const {
-        auto it = m_map.find(indexr);
-        if (VL_UNLIKELY(it == m_map.end())) return 0;
-        ++it;
-        if (VL_UNLIKELY(it == m_map.end())) return 0;
-        indexr = it->first;
+        const Item* const itemp = nextItemp(m_map, indexr);
+        if (!itemp) return 0;
+        indexr = itemp->first;
         return 1;
     }
     // Return prev element. Verilog: function int prev(ref index)
     int prev(T_Key& indexr) const {
-        auto it = m_map.find(indexr);
-        if (VL_UNLIKELY(it == m_map.end())) return 0;
-        if (VL_UNLIKELY(it == m_map.begin())) return 0;
-        --it;
-        indexr = it->first;
+        const Item* const itemp = prevItemp(m_map, indexr);
+        if (!itemp) return 0;
+        indexr = itemp->first;
         return 1;
     }
     // Setting. Verilog: assoc[index] = v
@@ -1037,21 +1613,30 @@ public:
         return *this;
     }
 
-    // For save/restore
+    // For save/restore, in no particular order when hashed
     const_iterator begin() const { return m_map.begin(); }
     const_iterator end() const { return m_map.end(); }
+    // Call func(key, value) on each element in key order
+    template <typename T_Func>
+    void forEachOrdered(T_Func func) const {
+        forOrdered(m_map, [&](const Item& item) {
+            func(item.first, item.second);
+            return true;
+        });
+    }
 
     // Methods
     VlQueue<T_Value> unique() const {
         VlQueue<T_Value> out;
         std::set<T_Value> saw;
-        for (const auto& i : m_map) {
+        forOrdered(m_map, [&](const Item& i) {
             auto it = saw.find(i.second);
             if (it == saw.end()) {
                 saw.insert(it, i.second);
                 out.push_back(i.second);
             }
-        }
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
@@ -1060,26 +1645,28 @@ public:
         T_Key default_key;
         using WithType = decltype(with_func(m_map.begin()->first, m_map.begin()->second));
         std::set<WithType> saw;
-        for (const auto& i : m_map) {
+        forOrdered(m_map, [&](const Item& i) {
             const auto i_mapped = with_func(default_key, i.second);
             const auto it = saw.find(i_mapped);
             if (it == saw.end()) {
                 saw.insert(it, i_mapped);
                 out.push_back(i.second);
             }
-        }
+            return true;
+        });
         return out;
     }
     VlQueue<T_Key> unique_index() const {
         VlQueue<T_Key> out;
         std::set<T_Key> saw;
-        for (const auto& i : m_map) {
+        forOrdered(m_map, [&](const Item& i) {
             auto it = saw.find(i.second);
             if (it == saw.end()) {
                 saw.insert(it, i.second);
                 out.push_back(i.first);
             }
-        }
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
@@ -1087,127 +1674,154 @@ public:
         VlQueue<T_Key> out;
         using WithType = decltype(with_func(m_map.begin()->first, m_map.begin()->second));
         std::set<WithType> saw;
-        for (const auto& i : m_map) {
+        forOrdered(m_map, [&](const Item& i) {
             const auto i_mapped = with_func(i.first, i.second);
             auto it = saw.find(i_mapped);
             if (it == saw.end()) {
                 saw.insert(it, i_mapped);
                 out.push_back(i.first);
             }
-        }
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
     VlQueue<T_Value> find(T_Func with_func) const {
         VlQueue<T_Value> out;
-        for (const auto& i : m_map)
+        forOrdered(m_map, [&](const Item& i) {
             if (with_func(i.first, i.second)) out.push_back(i.second);
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
     VlQueue<T_Key> find_index(T_Func with_func) const {
         VlQueue<T_Key> out;
-        for (const auto& i : m_map)
+        forOrdered(m_map, [&](const Item& i) {
             if (with_func(i.first, i.second)) out.push_back(i.first);
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
     VlQueue<T_Value> find_first(T_Func with_func) const {
-        const auto it
-            = std::find_if(m_map.cbegin(), m_map.cend(), [=](const std::pair<T_Key, T_Value>& i) {
-                  return with_func(i.first, i.second);
-              });
-        if (it == m_map.end()) return VlQueue<T_Value>{};
-        return VlQueue<T_Value>::consV(it->second);
+        const Item* foundp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (with_func(i.first, i.second)) foundp = &i;
+            return !foundp;
+        });
+        if (!foundp) return VlQueue<T_Value>{};
+        return VlQueue<T_Value>::consV(foundp->second);
     }
     template <typename T_Func>
     VlQueue<T_Key> find_first_index(T_Func with_func) const {
-        const auto it
-            = std::find_if(m_map.cbegin(), m_map.cend(), [=](const std::pair<T_Key, T_Value>& i) {
-                  return with_func(i.first, i.second);
-              });
-        if (it == m_map.end()) return VlQueue<T_Value>{};
-        return VlQueue<T_Key>::consV(it->first);
+        const Item* foundp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (with_func(i.first, i.second)) foundp = &i;
+            return !foundp;
+        });
+        if (!foundp) return VlQueue<T_Key>{};
+        return VlQueue<T_Key>::consV(foundp->first);
     }
     template <typename T_Func>
     VlQueue<T_Value> find_last(T_Func with_func) const {
-        const auto it = std::find_if(
-            m_map.crbegin(), m_map.crend(),
-            [=](const std::pair<T_Key, T_Value>& i) { return with_func(i.first, i.second); });
-        if (it == m_map.rend()) return VlQueue<T_Value>{};
-        return VlQueue<T_Value>::consV(it->second);
+        const Item* foundp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (with_func(i.first, i.second)) foundp = &i;
+            return true;
+        });
+        if (!foundp) return VlQueue<T_Value>{};
+        return VlQueue<T_Value>::consV(foundp->second);
     }
     template <typename T_Func>
     VlQueue<T_Key> find_last_index(T_Func with_func) const {
-        const auto it = std::find_if(
-            m_map.crbegin(), m_map.crend(),
-            [=](const std::pair<T_Key, T_Value>& i) { return with_func(i.first, i.second); });
-        if (it == m_map.rend()) return VlQueue<T_Value>{};
-        return VlQueue<T_Key>::consV(it->first);
+        const Item* foundp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (with_func(i.first, i.second)) foundp = &i;
+            return true;
+        });
+        if (!foundp) return VlQueue<T_Key>{};
+        return VlQueue<T_Key>::consV(foundp->first);
     }
 
     // Reduction operators
     VlQueue<T_Value> min() const {
         if (m_map.empty()) return VlQueue<T_Value>();
-        const auto it = std::min_element(
-            m_map.cbegin(), m_map.cend(),
-            [](const std::pair<T_Key, T_Value>& a, const std::pair<T_Key, T_Value>& b) {
-                return a.second < b.second;
-            });
-        return VlQueue<T_Value>::consV(it->second);
+        const Item* minp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (!minp || i.second < minp->second) minp = &i;
+            return true;
+        });
+        return VlQueue<T_Value>::consV(minp->second);
     }
     template <typename T_Func>
     VlQueue<T_Value> min(T_Func with_func) const {
         if (m_map.empty()) return VlQueue<T_Value>();
-        const auto it = std::min_element(
-            m_map.cbegin(), m_map.cend(),
-            [&with_func](const std::pair<T_Key, T_Value>& a, const std::pair<T_Key, T_Value>& b) {
-                return with_func(a.first, a.second) < with_func(b.first, b.second);
-            });
-        return VlQueue<T_Value>::consV(it->second);
+        const Item* minp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (!minp || with_func(i.first, i.second) < with_func(minp->first, minp->second)) {
+                minp = &i;
+            }
+            return true;
+        });
+        return VlQueue<T_Value>::consV(minp->second);
     }
     VlQueue<T_Value> max() const {
         if (m_map.empty()) return VlQueue<T_Value>();
-        const auto it = std::max_element(
-            m_map.cbegin(), m_map.cend(),
-            [](const std::pair<T_Key, T_Value>& a, const std::pair<T_Key, T_Value>& b) {
-                return a.second < b.second;
-            });
-        return VlQueue<T_Value>::consV(it->second);
+        const Item* maxp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (!maxp || maxp->second < i.second) maxp = &i;
+            return true;
+        });
+        return VlQueue<T_Value>::consV(maxp->second);
     }
     template <typename T_Func>
     VlQueue<T_Value> max(T_Func with_func) const {
         if (m_map.empty()) return VlQueue<T_Value>();
-        const auto it = std::max_element(
-            m_map.cbegin(), m_map.cend(),
-            [&with_func](const std::pair<T_Key, T_Value>& a, const std::pair<T_Key, T_Value>& b) {
-                return with_func(a.first, a.second) < with_func(b.first, b.second);
-            });
-        return VlQueue<T_Value>::consV(it->second);
+        const Item* maxp = nullptr;
+        forOrdered(m_map, [&](const Item& i) {
+            if (!maxp || with_func(maxp->first, maxp->second) < with_func(i.first, i.second)) {
+                maxp = &i;
+            }
+            return true;
+        });
+        return VlQueue<T_Value>::consV(maxp->second);
     }
 
     T_Value r_sum() const {
         T_Value out(0);  // Type must have assignment operator
-        for (const auto& i : m_map) out += i.second;
+        forOrdered(m_map, [&](const Item& i) {
+            out += i.second;
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_sum(T_Func with_func) const {
         WithFuncReturnType<T_Func> out = WithFuncReturnType<T_Func>(0);
-        for (const auto& i : m_map) out += with_func(i.first, i.second);
+        forOrdered(m_map, [&](const Item& i) {
+            out += with_func(i.first, i.second);
+            return true;
+        });
         return out;
     }
     T_Value r_product() const {
         if (m_map.empty()) return T_Value(0);  // The big three do it this way
         T_Value out = T_Value(1);
-        for (const auto& i : m_map) out *= i.second;
+        forOrdered(m_map, [&](const Item& i) {
+            out *= i.second;
+            return true;
+        });
         return out;
     }
     template <typename T_Func>
     WithFuncReturnType<T_Func> r_product(T_Func with_func) const {
         if (m_map.empty()) return WithFuncReturnType<T_Func>(0);  // The big three do it this way
         WithFuncReturnType<T_Func> out = WithFuncReturnType<T_Func>(1);
-        for (const auto& i : m_map) out *= with_func(i.first, i.second);
+        forOrdered(m_map, [&](const Item& i) {
+            out *= with_func(i.first, i.second);
+            return true;
+        });
         return out;
     }
     T_Value r_and() const {
@@ -1251,31 +1865,34 @@ public:
         if (m_map.empty()) return "'{}";  // No trailing space
         std::string out = "'{";
         std::string comma;
-        for (const auto& i : m_map) {
+        forOrdered(m_map, [&](const Item& i) {
             out += comma + VL_TO_STRING(i.first) + ":" + VL_TO_STRING(i.second);
             comma = ", ";
-        }
+            return true;
+        });
         // Default not printed - maybe random init data
         return out + "} ";
     }
 };
 
-template <typename T_Key, typename T_Value>
-std::string VL_TO_STRING(const VlAssocArray<T_Key, T_Value>& obj) {
+template <typename T_Key, typename T_Value, bool T_Hashed>
+std::string VL_TO_STRING(const VlAssocArray<T_Key, T_Value, T_Hashed>& obj) {
     return obj.to_string();
 }
 
-template <typename T_Key, typename T_Value>
-struct VlContainsCustomStruct<VlAssocArray<T_Key, T_Value>> : VlContainsCustomStruct<T_Value> {};
+template <typename T_Key, typename T_Value, bool T_Hashed>
+struct VlContainsCustomStruct<VlAssocArray<T_Key, T_Value, T_Hashed>>
+    : VlContainsCustomStruct<T_Value> {};
 
-template <typename T_Key, typename T_Value>
+template <typename T_Key, typename T_Value, bool T_Hashed>
 void VL_READMEM_N(bool hex, int bits, const std::string& filename,
-                  VlAssocArray<T_Key, T_Value>& obj, QData start, QData end) VL_MT_SAFE {
+                  VlAssocArray<T_Key, T_Value, T_Hashed>& obj, QData start,
+                  QData end) VL_MT_SAFE {
     VlReadMem rmem{hex, bits, filename, start, end};
     if (VL_UNLIKELY(!rmem.isOpen())) return;
+    std::string data;
     while (true) {
         QData addr;
-        std::string data;
         if (rmem.get(addr /*ref*/, data /*ref*/)) {
             rmem.setData(&(obj.at(addr)), data);
         } else {
@@ -1284,15 +1901,16 @@ void VL_READMEM_N(bool hex, int bits, const std::string& filename,
     }
 }
 
-template <typename T_Key, typename T_Value>
+template <typename T_Key, typename T_Value, bool T_Hashed>
 void VL_WRITEMEM_N(bool hex, int bits, const std::string& filename,
-                   const VlAssocArray<T_Key, T_Value>& obj, QData start, QData end) VL_MT_SAFE {
+                   const VlAssocArray<T_Key, T_Value, T_Hashed>& obj, QData start,
+                   QData end) VL_MT_SAFE {
     VlWriteMem wmem{hex, bits, filename, start, end};
     if (VL_UNLIKELY(!wmem.isOpen())) return;
-    for (const auto& i : obj) {
-        const QData addr = i.first;
-        if (addr >= start && addr <= end) wmem.print(addr, true, &(i.second));
-    }
+    obj.forEachOrdered([&](const T_Key& key, const T_Value& value) {
+        const QData addr = key;
+        if (addr >= start && addr <= end) wmem.print(addr, true, &value);
+    });
 }
 
 //===================================================================
@@ -1606,6 +2224,116 @@ std::string VL_TO_STRING(const VlUnpacked<T_Value, N_Depth>& obj) {
 template <typename T_Value, std::size_t N_Depth>
 struct VlContainsCustomStruct<VlUnpacked<T_Value, N_Depth>> : VlContainsCustomStruct<T_Value> {};
 
+// Constant pool arrays emitted with --output-const-blob are a string of the
+// little endian bytes of each element, unpacked when the library is loaded
+template <typename T_Value>
+inline void VL_CONST_BLOB_ELEM(T_Value& elem, const unsigned char* bytesp) {
+    T_Value value = 0;
+    for (std::size_t b = 0; b < sizeof(T_Value); ++b) {
+        value |= static_cast<T_Value>(bytesp[b]) << (8 * b);
+    }
+    elem = value;
+}
+template <std::size_t N_Words>
+inline void VL_CONST_BLOB_ELEM(VlWide<N_Words>& elem, const unsigned char* bytesp) {
+    for (std::size_t w = 0; w < N_Words; ++w) {
+        VL_CONST_BLOB_ELEM(elem.m_storage[w], bytesp + w * sizeof(EData));
+    }
+}
+template <typename T_Value, std::size_t N_Depth>
+VlUnpacked<T_Value, N_Depth> VL_CONST_BLOB_UNPACKED(const char* bytesp) {
+    VlUnpacked<T_Value, N_Depth> result;
+    const unsigned char* const datap = reinterpret_cast<const unsigned char*>(bytesp);
+    for (std::size_t i = 0; i < N_Depth; ++i) {
+        VL_CONST_BLOB_ELEM(result.m_storage[i], datap + i * sizeof(T_Value));
+    }
+    return result;
+}
+
+//===================================================================
+/// Verilog unpacked array container for very large memories
+/// Used in place of VlUnpacked for big one dimensional arrays of integral
+/// elements that are only accessed one element at a time (see
+/// --sparse-array-depth). Elements are held in fixed size pages that are
+/// allocated and zeroed when an element in them is first accessed, so the
+/// memory used follows the part of the array the model actually touches.
+
+template <typename T_Value, std::size_t N_Depth>
+class VlSparseArray final {
+public:
+    // Elements per page, a power of two, about 64 KiB of storage each
+    static constexpr std::size_t PageSize
+        = VlRingPow2<(sizeof(T_Value) < 65536) ? 65536 / sizeof(T_Value) : 1>::value;
+    static constexpr std::size_t Pages = (N_Depth + PageSize - 1) / PageSize;
+
+private:
+    // MEMBERS
+    std::vector<T_Value*> m_pages;  // Page table, nullptr for pages never accessed
+    std::size_t m_allocated = 0;  // Number of pages allocated
+
+public:
+    // CONSTRUCTORS
+    VlSparseArray()
+        : m_pages(Pages, nullptr) {}
+    ~VlSparseArray() { clear(); }
+    VlSparseArray(const VlSparseArray& rhs)
+        : m_pages(Pages, nullptr) {
+        *this = rhs;
+    }
+    VlSparseArray& operator=(const VlSparseArray& rhs) {
+        if (this == &rhs) return *this;
+        for (std::size_t page = 0; page < Pages; ++page) {
+            if (const T_Value* const datap = rhs.m_pages[page]) {
+                std::copy_n(datap, PageSize, pagep(page));
+            } else if (m_pages[page]) {
+                delete[] m_pages[page];
+                m_pages[page] = nullptr;
+                --m_allocated;
+            }
+        }
+        return *this;
+    }
+
+    // METHODS
+    constexpr std::size_t size() const { return N_Depth; }
+    // Number of pages that have storage
+    std::size_t allocatedPages() const { return m_allocated; }
+
+    T_Value& operator[](std::size_t index) {
+        T_Value* const datap = m_pages[index / PageSize];
+        if (VL_LIKELY(datap)) return datap[index % PageSize];
+        return pagep(index / PageSize)[index % PageSize];
+    }
+    // Reading an element never accessed does not allocate
+    const T_Value& operator[](std::size_t index) const {
+        static const T_Value s_zero{};
+        const T_Value* const datap = m_pages[index / PageSize];
+        return VL_LIKELY(datap) ? datap[index % PageSize] : s_zero;
+    }
+    // Read without allocating, as the const operator[], for generated code
+    const T_Value& get(std::size_t index) const { return (*this)[index]; }
+
+    // Storage of the given page, allocating it if needed
+    T_Value* pagep(std::size_t page) {
+        if (!m_pages[page]) {
+            m_pages[page] = new T_Value[PageSize]();
+            ++m_allocated;
+        }
+        return m_pages[page];
+    }
+    // Storage of the given page, or nullptr if never accessed
+    const T_Value* findPagep(std::size_t page) const { return m_pages[page]; }
+
+    // Release all storage, so all elements read as zero
+    void clear() {
+        for (T_Value*& datap : m_pages) {
+            delete[] datap;
+            datap = nullptr;
+        }
+        m_allocated = 0;
+    }
+};
+
 //===================================================================
 // Helper to apply the given indices to a target expression
 
@@ -1658,6 +2386,43 @@ template <typename T_Target,  // Type of the variable this commit queue updates
           >
 class VlNBACommitQueue;
 
+// Bounds the length of a commit queue, when the same elements are updated many times before a
+// commit, by coalescing entries for the same element. Entries are sorted by element, keeping
+// program order for the same element, then each run of such entries is merged into one.
+// Coalescing is only done when the queue reaches twice its length after the previous coalesce,
+// so it costs amortized constant time per enqueue, and commits in element order.
+template <std::size_t N_Rank>
+class VlNBACoalescer final {
+    // CONSTANTS
+    static constexpr size_t MIN_LENGTH = 64;  // Shorter queues are never coalesced
+
+    // STATE
+    size_t m_coalesceAt = MIN_LENGTH;  // Length at which to coalesce next
+
+public:
+    // METHODS
+    bool needed(size_t length) const { return VL_UNLIKELY(length >= m_coalesceAt); }
+    // 'merge(earlier, later)' merges 'later' into 'earlier'
+    template <typename T_Entry, typename T_Merge>
+    void coalesce(std::vector<T_Entry>& pending, T_Merge merge) {
+        std::stable_sort(pending.begin(), pending.end(), [](const T_Entry& a, const T_Entry& b) {
+            return std::lexicographical_compare(a.indices, a.indices + N_Rank, b.indices,
+                                                b.indices + N_Rank);
+        });
+        auto outIt = pending.begin();
+        for (auto it = pending.begin() + 1; it != pending.end(); ++it) {
+            if (std::equal(it->indices, it->indices + N_Rank, outIt->indices)) {
+                merge(*outIt, *it);
+            } else {
+                *++outIt = *it;
+            }
+        }
+        pending.erase(outIt + 1, pending.end());
+        const size_t length = 2 * pending.size();
+        m_coalesceAt = length > MIN_LENGTH ? length : MIN_LENGTH;
+    }
+};
+
 // Specialization for whole element updates only
 template <typename T_Target, typename T_Element, std::size_t N_Rank>
 class VlNBACommitQueue<T_Target, /* Partial: */ false, T_Element, N_Rank> final {
@@ -1668,7 +2433,8 @@ class VlNBACommitQueue<T_Target, /* Partial: */ false, T_Element, N_Rank> final
     };
 
     // STATE
-    std::vector<Entry> m_pending;  // Pending updates, in program order
+    std::vector<Entry> m_pending;  // Pending updates, in program order for the same element
+    VlNBACoalescer<N_Rank> m_coalescer;  // Merges updates of the same element
 
 public:
     // CONSTRUCTOR
@@ -1679,6 +2445,11 @@ public:
     template <typename... T_Args>
     void enqueue(const T_Element& value, T_Args... indices) {
         m_pending.emplace_back(Entry{value, {indices...}});
+        if (m_coalescer.needed(m_pending.size())) {
+            // The last update of an element wins
+            m_coalescer.coalesce(m_pending,
+                                 [](Entry& earlier, const Entry& later) { earlier = later; });
+        }
     }
 
     // Note: T_Commit might be different from T_Target. Specifically, when the signal is a
@@ -1704,7 +2475,8 @@ class VlNBACommitQueue<T_Target, /* Partial: */ true, T_Element, N_Rank> final {
     };
 
     // STATE
-    std::vector<Entry> m_pending;  // Pending updates, in program order
+    std::vector<Entry> m_pending;  // Pending updates, in program order for the same element
+    VlNBACoalescer<N_Rank> m_coalescer;  // Merges updates of the same element
 
     // STATIC METHODS
 
@@ -1764,6 +2536,14 @@ public:
     template <typename... T_Args>
     void enqueue(const T_Element& value, const T_Element& mask, T_Args... indices) {
         m_pending.emplace_back(Entry{value, mask, {indices...}});
+        if (m_coalescer.needed(m_pending.size())) {
+            // Later updates win in the bits they mask
+            m_coalescer.coalesce(m_pending, [](Entry& earlier, const Entry& later) {
+                earlier.value = bOr(bAnd(later.value, later.mask),
+                                    bAnd(earlier.value, bNot(later.mask)));
+                earlier.mask = bOr(earlier.mask, later.mask);
+            });
+        }
     }
 
     // Note: T_Commit might be different from T_Target. Specifically, when the signal is a
@@ -1785,6 +2565,11 @@ public:
 // Object that VlDeleter is capable of deleting
 
 class VlDeletable VL_NOT_FINAL {
+    friend class VlDeleter;  // Needed for access to the garbage list link
+
+    // MEMBERS
+    VlDeletable* m_nextGarbagep = nullptr;  // Next object in VlDeleter's garbage list
+
 public:
     VlDeletable() = default;
     virtual ~VlDeletable() = default;
@@ -1796,12 +2581,8 @@ public:
 
 class VlDeleter final {
     // MEMBERS
-    // Queue of new objects that should be deleted
-    std::vector<VlDeletable*> m_newGarbage VL_GUARDED_BY(m_mutex);
-    // Queue of objects currently being deleted (only for deleteAll())
-    std::vector<VlDeletable*> m_deleteNow VL_GUARDED_BY(m_deleteMutex);
-    mutable VerilatedMutex m_mutex;  // Mutex protecting the 'new garbage' queue
-    mutable VerilatedMutex m_deleteMutex;  // Mutex protecting the delete queue
+    // Lock-free list of new objects that should be deleted, linked through m_nextGarbagep
+    std::atomic<VlDeletable*> m_newGarbagep{nullptr};
 
 public:
     // CONSTRUCTOR
@@ -1813,14 +2594,16 @@ private:
 
 public:
     // METHODS
-    // Adds a new object to the 'new garbage' queue.
+    // Adds a new object to the 'new garbage' list.
     void put(VlDeletable* const objp) VL_MT_SAFE {
-        const VerilatedLockGuard lock{m_mutex};
-        m_newGarbage.push_back(objp);
+        objp->m_nextGarbagep = m_newGarbagep.load(std::memory_order_relaxed);
+        while (!m_newGarbagep.compare_exchange_weak(objp->m_nextGarbagep, objp,
+                                                    std::memory_order_release,
+                                                    std::memory_order_relaxed)) {}
     }
 
     // Deletes all queued garbage objects.
-    void deleteAll() VL_EXCLUDES(m_mutex) VL_EXCLUDES(m_deleteMutex) VL_MT_SAFE;
+    void deleteAll() VL_MT_SAFE;
 };
 
 //===================================================================
@@ -1854,6 +2637,13 @@ public:
     VlClass() {}
     VlClass(const VlClass& copied) {}
     ~VlClass() override = default;
+
+    // Objects are allocated from VlBlockPool, which recycles the memory of deleted objects of the
+    // same size, so short lived objects such as sequence items avoid the heap
+    static void* operator new(size_t size) { return VlBlockPool::allocate(size); }
+    static void operator delete(void* objp, size_t size) VL_MT_SAFE {
+        VlBlockPool::deallocate(objp, size);
+    }
 };
 
 //===================================================================
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <cstdlib>
 #include <fcntl.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
@@ -87,6 +88,80 @@ ssize_t VerilatedVcdFile::write(const char* bufp, ssize_t len) VL_MT_UNSAFE {
     return ::write(m_fd, bufp, len);
 }
 
+//=============================================================================
+// VerilatedVcdAsyncFile
+
+VerilatedVcdAsyncFile::VerilatedVcdAsyncFile(VerilatedVcdFile* filep)
+    : m_filep{filep ? filep : new VerilatedVcdFile}
+    , m_fileNewed{filep == nullptr} {}
+
+VerilatedVcdAsyncFile::~VerilatedVcdAsyncFile() {
+    if (m_threadp) close();
+    if (m_fileNewed) delete m_filep;
+}
+
+bool VerilatedVcdAsyncFile::open(const std::string& name) VL_MT_UNSAFE {
+    if (!m_filep->open(name)) return false;
+    m_threadp.reset(new std::thread{&VerilatedVcdAsyncFile::writerThread, this});
+    return true;
+}
+
+void VerilatedVcdAsyncFile::close() VL_MT_UNSAFE {
+    waitAsync();
+    if (m_threadp) {
+        m_requests.put({nullptr, 0});
+        m_threadp->join();
+        m_threadp.reset();
+    }
+    m_filep->close();
+}
+
+ssize_t VerilatedVcdAsyncFile::write(const char* bufp, ssize_t len) VL_MT_UNSAFE {
+    // Keep the data in order with any write in flight
+    waitAsync();
+    return m_filep->write(bufp, len);
+}
+
+void VerilatedVcdAsyncFile::writeAsync(const char* bufp, ssize_t len) VL_MT_UNSAFE {
+    assert(m_threadp && !m_pending);
+    m_pending = true;
+    m_requests.put({bufp, len});
+}
+
+void VerilatedVcdAsyncFile::waitAsync() VL_MT_UNSAFE {
+    if (!m_pending) return;
+    m_completions.get();
+    m_pending = false;
+}
+
+void VerilatedVcdAsyncFile::writerThread() {
+    while (true) {
+        const Request req = m_requests.get();
+        if (!req.first) break;
+        const char* wp = req.first;
+        ssize_t remaining = req.second;
+        while (remaining > 0) {
+            errno = 0;
+            const ssize_t got = m_filep->write(wp, remaining);
+            if (got > 0) {
+                wp += got;
+                remaining -= got;
+            } else if (VL_UNCOVERABLE(got < 0)) {
+                if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+                    // LCOV_EXCL_START
+                    // write failed, presume error (perhaps out of disk space)
+                    const std::string msg
+                        = "VerilatedVcdAsyncFile::writerThread: "s + std::strerror(errno);
+                    VL_FATAL_MT("", 0, "", msg.c_str());
+                    break;
+                    // LCOV_EXCL_STOP
+                }
+            }
+        }
+        m_completions.put(true);
+    }
+}
+
 //=============================================================================
 //=============================================================================
 //=============================================================================
@@ -98,6 +173,7 @@ VerilatedVcd::VerilatedVcd(VerilatedVcdFile* filep) {
     m_filep = m_fileNewed ? new VerilatedVcdFile : filep;
     m_wrChunkSize = 8 * 1024;
     m_wrBufp = new char[m_wrChunkSize * 8];
+    if (m_filep->async()) m_wrSpareBufp = new char[m_wrChunkSize * 8];
     m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
     m_writep = m_wrBufp;
     m_wrTimeBeginp = nullptr;
@@ -110,10 +186,19 @@ void VerilatedVcd::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
 
     // Set member variables
     m_filename = filename;  // "" is ok, as someone may overload open
+    m_sliceBaseName = m_filename;
+    m_sliceNum = 0;
 
     openNextImp(m_rolloverSize != 0);
     if (!isOpen()) return;
 
+    printHeader();
+
+    // When using rollover, the first chunk contains the header only.
+    if (m_rolloverSize) openNextImp(true);
+}
+
+void VerilatedVcd::printHeader() {
     printStr("$version Generated by VerilatedVcd $end\n");
     printStr("$timescale ");
     printStr(timeResStr().c_str());  // lintok-begin-on-ref
@@ -127,9 +212,6 @@ void VerilatedVcd::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     assert(m_indent >= 0);
 
     printStr("$enddefinitions $end\n\n\n");
-
-    // When using rollover, the first chunk contains the header only.
-    if (m_rolloverSize) openNextImp(true);
 }
 
 void VerilatedVcd::openNext(bool incFilename) VL_MT_SAFE_EXCLUDES(m_mutex) {
@@ -183,8 +265,27 @@ void VerilatedVcd::openNextImp(bool incFilename) {
     m_wroteBytes = 0;
 }
 
+void VerilatedVcd::openSliceImp() {
+    closePrev();  // Close existing
+    Super::closeBase();  // Header below restarts any tracing thread
+    sliceCommandImp(m_filename);
+    m_filename = sliceFilename(m_sliceBaseName, ++m_sliceNum);
+    openNextImp(false);
+    if (!isOpen()) return;
+    // Each slice is a complete file, starting with its own header and full dump
+    printHeader();
+    m_sliceStartTime = timeLastDump();
+}
+
 bool VerilatedVcd::preChangeDump() {
-    if (VL_UNLIKELY(m_rolloverSize && m_wroteBytes > m_rolloverSize)) openNextImp(true);
+    if (VL_UNLIKELY(slicing())) {
+        if ((m_sliceTime && timeLastDump() - m_sliceStartTime >= m_sliceTime)
+            || (m_sliceSize && m_wroteBytes > m_sliceSize)) {
+            openSliceImp();
+        }
+    } else if (VL_UNLIKELY(m_rolloverSize && m_wroteBytes > m_rolloverSize)) {
+        openNextImp(true);
+    }
     return isOpen();
 }
 
@@ -207,6 +308,7 @@ void VerilatedVcd::emitTimeChange(uint64_t timeui) {
 VerilatedVcd::~VerilatedVcd() {
     close();
     if (m_wrBufp) VL_DO_CLEAR(delete[] m_wrBufp, m_wrBufp = nullptr);
+    if (m_wrSpareBufp) VL_DO_CLEAR(delete[] m_wrSpareBufp, m_wrSpareBufp = nullptr);
     if (m_filep && m_fileNewed) VL_DO_CLEAR(delete m_filep, m_filep = nullptr);
     if (parallel()) {
         assert(m_numBuffers == m_freeBuffers.size());
@@ -238,17 +340,69 @@ void VerilatedVcd::closeErr() {
 void VerilatedVcd::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     // This function is on the flush() call path
     const VerilatedLockGuard lock{m_mutex};
-    if (!isOpen()) return;
-    closePrev();
-    // closePrev() called Super::flush(), so we just
-    // need to shut down the tracing thread here.
-    Super::closeBase();
+    if (isOpen()) {
+        closePrev();
+        // closePrev() called Super::flush(), so we just
+        // need to shut down the tracing thread here.
+        Super::closeBase();
+        sliceCommandImp(m_filename);
+    }
+    // Wait for the commands on closed files to complete
+    sliceShutdown();
+}
+
+//=============================================================================
+// Slice commands
+
+void VerilatedVcd::sliceCommand(const std::string& command, unsigned threads)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    m_sliceCommand = command;
+    m_sliceThreads = std::max(threads, 1U);
+}
+
+void VerilatedVcd::sliceCommandImp(const std::string& filename) {
+    if (m_sliceCommand.empty() || filename.empty()) return;
+    // Start the workers on the first closed file
+    while (m_sliceWorkers.size() < m_sliceThreads) {
+        m_sliceWorkers.emplace_back(&VerilatedVcd::sliceWorkerMain, this);
+    }
+    m_sliceClosed.put(filename);
+}
+
+void VerilatedVcd::sliceShutdown() {
+    // An empty filename tells a worker to exit
+    for (size_t i = 0; i < m_sliceWorkers.size(); ++i) m_sliceClosed.put("");
+    for (std::thread& thread : m_sliceWorkers) thread.join();
+    m_sliceWorkers.clear();
+}
+
+void VerilatedVcd::sliceWorkerMain() {
+    while (true) {
+        const std::string filename = m_sliceClosed.get();
+        if (filename.empty()) break;
+        // Quote the filename for the shell
+        std::string cmd = m_sliceCommand + " '";
+        for (const char c : filename) {
+            if (c == '\'') {
+                cmd += "'\\''";
+            } else {
+                cmd += c;
+            }
+        }
+        cmd += "'";
+        if (VL_UNCOVERABLE(std::system(cmd.c_str()) != 0)) {
+            VL_PRINTF_MT("%%Warning: VerilatedVcd slice command failed: %s\n",
+                         cmd.c_str());  // LCOV_EXCL_LINE
+        }
+    }
 }
 
 void VerilatedVcd::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     Super::flushBase();
     bufferFlush();
+    m_filep->waitAsync();
 }
 
 void VerilatedVcd::printStr(const char* str) {
@@ -274,6 +428,12 @@ void VerilatedVcd::bufferResize(size_t minsize) {
         }
         m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
         VL_DO_CLEAR(delete[] oldbufp, oldbufp = nullptr);
+        if (m_wrSpareBufp) {
+            // The spare buffer may still be being written
+            m_filep->waitAsync();
+            delete[] m_wrSpareBufp;
+            m_wrSpareBufp = new char[m_wrChunkSize * 8];
+        }
     }
 }
 
@@ -284,6 +444,24 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     // When it gets nearly full we dump it using this routine which calls write()
     // This is much faster than using buffered I/O
     if (VL_UNLIKELY(!m_isOpen)) return;
+    const uint64_t profStartNs = profiling() ? profNowNs() : 0;
+    if (m_wrSpareBufp) {
+        // Hand the buffer to the file, and continue in the spare buffer once
+        // the file has finished with it
+        if (m_writep != m_wrBufp) {
+            m_filep->waitAsync();
+            m_filep->writeAsync(m_wrBufp, m_writep - m_wrBufp);
+            m_wroteBytes += m_writep - m_wrBufp;
+            if (traceContextp()) traceContextp()->metricsTraceBytes(m_writep - m_wrBufp);
+            std::swap(m_wrBufp, m_wrSpareBufp);
+            m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+        }
+        m_writep = m_wrBufp;
+        m_wrTimeBeginp = nullptr;
+        m_wrTimeEndp = nullptr;
+        if (profStartNs) profWriteNs(profNowNs() - profStartNs);
+        return;
+    }
     const char* wp = m_wrBufp;
     while (true) {
         const ssize_t remaining = (m_writep - wp);
@@ -293,6 +471,7 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
         if (got > 0) {
             wp += got;
             m_wroteBytes += got;
+            if (traceContextp()) traceContextp()->metricsTraceBytes(got);
         } else if (VL_UNCOVERABLE(got < 0)) {
             if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
                 // LCOV_EXCL_START
@@ -310,6 +489,7 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     m_writep = m_wrBufp;
     m_wrTimeBeginp = nullptr;
     m_wrTimeEndp = nullptr;
+    if (profStartNs) profWriteNs(profNowNs() - profStartNs);
 }
 
 //=============================================================================
@@ -532,6 +712,71 @@ void VerilatedVcd::commitTraceBuffer(VerilatedVcd::Buffer* bufp) {
     delete bufp;
 }
 
+// A slice of the parallel merge in VerilatedVcd::commitTraceBuffers
+struct VerilatedVcdMergeJob final {
+    char* m_dstp;  // Destination in the output buffer
+    const char* m_srcp;  // Trace buffer contents
+    size_t m_size;  // Number of bytes to copy
+    VlMTaskVertex* m_donep;  // Signalled when the copy is complete
+
+    static void run(void* datap, bool) {
+        const VerilatedVcdMergeJob* const jobp = static_cast<VerilatedVcdMergeJob*>(datap);
+        std::memcpy(jobp->m_dstp, jobp->m_srcp, jobp->m_size);
+        jobp->m_donep->signalUpstreamDone(true);
+    }
+};
+
+void VerilatedVcd::commitTraceBuffers(VerilatedVcd::Buffer* const* bufpp, size_t n) {
+    // Note: This is called from VerilatedVcd::dump, which already holds the lock
+    // Below this many bytes in total the merge is cheaper than the hand-off
+    constexpr size_t parallelMergeMinBytes = 64 * 1024;
+    VlThreadPool* const threadPoolp
+        = static_cast<VlThreadPool*>(traceContextp()->threadPoolp());
+    size_t maxSize = 0;
+    size_t totalSize = 0;
+    for (size_t i = 0; i < n; ++i) {
+        maxSize = std::max(maxSize, bufpp[i]->m_size);
+        totalSize += bufpp[i]->m_writep - bufpp[i]->m_bufp;
+    }
+    if (n < 2 || totalSize < parallelMergeMinBytes || !threadPoolp
+        || !threadPoolp->numThreads()) {
+        Super::commitTraceBuffers(bufpp, n);
+        return;
+    }
+    // Make room for all buffers at once, so the copies can proceed independently
+    bufferResize(std::max(maxSize, totalSize));
+    if (m_writep + totalSize > m_wrBufp + m_wrChunkSize * 8) bufferFlush();
+    // Copy each trace buffer to its place in the output buffer, using the whole
+    // pool + the main thread, with the same distribution as the rendering
+    const unsigned threads = threadPoolp->numThreads() + 1;
+    std::vector<VerilatedVcdMergeJob> jobs;
+    jobs.reserve(n);
+    VlPaddedMTaskVertex done{static_cast<uint32_t>(n)};
+    char* dstp = m_writep;
+    for (size_t i = 0; i < n; ++i) {
+        const size_t usedSize = bufpp[i]->m_writep - bufpp[i]->m_bufp;
+        jobs.push_back({dstp, bufpp[i]->m_bufp, usedSize, &done});
+        dstp += usedSize;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (const unsigned rem = i % threads) {
+            threadPoolp->workerp(rem - 1)->addStealableTask(&VerilatedVcdMergeJob::run,
+                                                            &jobs[i]);
+        }
+    }
+    for (size_t i = 0; i < n; i += threads) VerilatedVcdMergeJob::run(&jobs[i], false);
+    done.waitUntilUpstreamDone(true);
+    // Adjust write pointer
+    m_writep = dstp;
+    // Flush if necessary
+    bufferCheck();
+    // Put buffers back on free list
+    for (size_t i = 0; i < n; ++i) {
+        m_freeBuffers.emplace_back(bufpp[i]->m_bufp, bufpp[i]->m_size);
+        delete bufpp[i];
+    }
+}
+
 //=============================================================================
 // VerilatedVcdBuffer implementation
 
@@ -597,6 +842,7 @@ void VerilatedVcdBuffer::finishLine(uint32_t code, char* writep) {
             m_owner.m_writep = m_writep;
             m_owner.bufferFlush();
             m_writep = m_owner.m_writep;
+            m_wrFlushp = m_owner.m_wrFlushp;
         }
     }
 }
@@ -24,7 +24,9 @@
 #include "verilated.h"
 #include "verilated_trace.h"
 
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 class VerilatedVcdBuffer;
@@ -50,9 +52,19 @@ private:
     bool m_isOpen = false;  // True indicates open file
     std::string m_filename;  // Filename we're writing to (if open)
     uint64_t m_rolloverSize = 0;  // File size to rollover at
+    uint64_t m_sliceTime = 0;  // Time after which to start a new slice file, or 0
+    uint64_t m_sliceSize = 0;  // File size after which to start a new slice file, or 0
+    uint64_t m_sliceStartTime = 0;  // Time of the first dump in this slice
+    uint32_t m_sliceNum = 0;  // Number of the slice being written
+    std::string m_sliceBaseName;  // Filename given to open, slice names derive from it
+    std::string m_sliceCommand;  // Command to run on each closed file, or empty
+    unsigned m_sliceThreads = 1;  // Number of threads running m_sliceCommand
+    std::vector<std::thread> m_sliceWorkers;  // Threads running m_sliceCommand
+    VerilatedThreadQueue<std::string> m_sliceClosed;  // Closed files for m_sliceWorkers
     int m_indent = 0;  // Indentation depth
 
     char* m_wrBufp;  // Output buffer
+    char* m_wrSpareBufp = nullptr;  // Second output buffer, when the file writes asynchronously
     char* m_wrFlushp;  // Output buffer flush trigger location
     char* m_writep;  // Write pointer into output buffer
     char* m_wrTimeBeginp = nullptr;  // Write pointer for last time dump
@@ -79,6 +91,12 @@ private:
         if (VL_UNLIKELY(m_writep > m_wrFlushp)) bufferFlush();
     }
     void openNextImp(bool incFilename);
+    void openSliceImp();
+    void printHeader();
+    bool slicing() const { return m_sliceTime || m_sliceSize; }
+    void sliceCommandImp(const std::string& filename);
+    void sliceShutdown();
+    void sliceWorkerMain();
     void closePrev();
     void closeErr();
     void printIndent(int level_change);
@@ -97,12 +115,16 @@ protected:
     void emitTimeChange(uint64_t timeui) override;
 
     // Hooks called from VerilatedTrace
-    bool preFullDump() override { return isOpen(); }
+    bool preFullDump() override {
+        m_sliceStartTime = timeLastDump();
+        return isOpen();
+    }
     bool preChangeDump() override;
 
     // Trace buffer management
     Buffer* getTraceBuffer(uint32_t fidx) override;
     void commitTraceBuffer(Buffer*) override;
+    void commitTraceBuffers(Buffer* const* bufpp, size_t n) override;
 
     // Configure sub-class
     void configure(const VerilatedTraceConfig&) override{};
@@ -118,6 +140,12 @@ public:
     // ACCESSORS
     // Set size in bytes after which new file should be created.
     void rolloverSize(uint64_t size) VL_MT_SAFE { m_rolloverSize = size; }
+    // Set time after which a new self-contained file should be created.
+    void sliceTime(uint64_t time) VL_MT_SAFE { m_sliceTime = time; }
+    // Set size in bytes after which a new self-contained file should be created.
+    void sliceSize(uint64_t size) VL_MT_SAFE { m_sliceSize = size; }
+    // Set command to run in the background on each closed file
+    void sliceCommand(const std::string& command, unsigned threads) VL_MT_SAFE_EXCLUDES(m_mutex);
 
     // METHODS - All must be thread safe
     // Open the file; call isOpen() to see if errors
@@ -171,6 +199,10 @@ template <>
 void VerilatedVcd::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedVcd::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedVcd::Super::profile(bool flag);
+template <>
+std::string VerilatedVcd::Super::profileReport();
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -188,7 +220,7 @@ class VerilatedVcdBuffer VL_NOT_FINAL {
     // Write pointer into output buffer (in parallel mode, this is set up in 'getTraceBuffer')
     char* m_writep = m_owner.parallel() ? nullptr : m_owner.m_writep;
     // Output buffer flush trigger location (only used when not parallel)
-    char* const m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
+    char* m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
 
     // VCD line end string codes + metadata
     const char* const m_suffixes = m_owner.m_suffixes.data();
@@ -246,6 +278,48 @@ public:
     virtual void close() VL_MT_UNSAFE;
     /// Write data to file (if it is open)
     virtual ssize_t write(const char* bufp, ssize_t len) VL_MT_UNSAFE;
+    /// True if writeAsync may be used instead of write
+    virtual bool async() const VL_MT_UNSAFE { return false; }
+    /// Start writing all of the data, returning before it is written.
+    /// Data must not be changed until the following waitAsync returns.
+    virtual void writeAsync(const char* bufp, ssize_t len) VL_MT_UNSAFE {}
+    /// Wait for the previous writeAsync, if any, to complete
+    virtual void waitAsync() VL_MT_UNSAFE {}
+};
+
+//=============================================================================
+// VerilatedVcdAsyncFile
+/// File that writes from a separate thread, so the simulation does not wait
+/// on storage.  VerilatedVcd then alternates between two output buffers,
+/// handing each to this file in turn without copying.  Pass a pointer to
+/// the trace constructor, e.g. VerilatedVcdC{&asyncFile}.
+
+class VerilatedVcdAsyncFile VL_NOT_FINAL : public VerilatedVcdFile {
+private:
+    // A write request, or {nullptr, 0} to stop the writer thread
+    using Request = std::pair<const char*, ssize_t>;
+    VerilatedVcdFile* const m_filep;  // File actually written
+    const bool m_fileNewed;  // m_filep needs destruction
+    std::unique_ptr<std::thread> m_threadp;  // Writer thread
+    VerilatedThreadQueue<Request> m_requests;  // Writes for the writer thread
+    VerilatedThreadQueue<bool> m_completions;  // Writes completed by the writer thread
+    bool m_pending = false;  // A writeAsync was started but not waited for
+
+    void writerThread();
+
+public:
+    // METHODS
+    /// Construct a (as yet) closed file, writing through the given file,
+    /// or a new VerilatedVcdFile if nullptr
+    explicit VerilatedVcdAsyncFile(VerilatedVcdFile* filep = nullptr);
+    /// Close and destruct
+    ~VerilatedVcdAsyncFile() override;
+    bool open(const std::string& name) override VL_MT_UNSAFE;
+    void close() override VL_MT_UNSAFE;
+    ssize_t write(const char* bufp, ssize_t len) override VL_MT_UNSAFE;
+    bool async() const override VL_MT_UNSAFE { return true; }
+    void writeAsync(const char* bufp, ssize_t len) override VL_MT_UNSAFE;
+    void waitAsync() override VL_MT_UNSAFE;
 };
 
 //=============================================================================
@@ -284,6 +358,21 @@ public:
     /// alignment to a start of a given time's dump).  Any file but the
     /// first may be removed.  Cat files together to create viewable vcd.
     void rolloverSize(size_t size) VL_MT_SAFE { m_sptrace.rolloverSize(size); }
+    /// Set time after which a new slice file should be created
+    /// Each slice is a complete VCD file, with the header and a full dump
+    /// at its first time, so it can be viewed on its own.  The first slice
+    /// has the name passed to open(), later slices append _slice0001 etc.
+    /// to the base name.  Not to be combined with rolloverSize().
+    void sliceTime(uint64_t time) VL_MT_SAFE { m_sptrace.sliceTime(time); }
+    /// Set size in bytes after which a new slice file should be created
+    /// As with rolloverSize(), a file may be larger than the given size.
+    void sliceSize(uint64_t size) VL_MT_SAFE { m_sptrace.sliceSize(size); }
+    /// Set command to run on each file once it is closed, e.g. "gzip" or
+    /// "zstd -q --rm", with the filename appended.  The commands run on the
+    /// given number of background threads, and close() waits for them.
+    void sliceCommand(const std::string& command, unsigned threads = 1) VL_MT_SAFE {
+        m_sptrace.sliceCommand(command, threads);
+    }
     /// Close dump
     void close() VL_MT_SAFE {
         m_sptrace.close();
@@ -321,6 +410,10 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Record where dump time goes and which scopes change most; call before open
+    void profile(bool flag) VL_MT_SAFE { m_sptrace.profile(flag); }
+    // Return a report of the profile so far
+    std::string profileReport() VL_MT_SAFE { return m_sptrace.profileReport(); }
 
     // Internal class access
     VerilatedVcd* spTrace() { return &m_sptrace; }
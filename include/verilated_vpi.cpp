@@ -30,15 +30,17 @@
 
 #include "verilated.h"
 #include "verilated_imp.h"
+#include "verilated_profiler.h"
 
 #include "vltstd/vpi_user.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <list>
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -853,13 +855,28 @@ public:
     }
 };
 
-struct VerilatedVpiTimedCbsCmp final {
-    // Ordering sets keyed by time, then callback unique id
-    bool operator()(const std::pair<QData, uint64_t>& a,
-                    const std::pair<QData, uint64_t>& b) const {
-        if (a.first < b.first) return true;
-        if (a.first > b.first) return false;
-        return a.second < b.second;
+class VerilatedVpiTimedCb final {
+    // A time based callback waiting in a VpioTimedCbs heap.  Trivially copyable, so the
+    // heap's storage is reused between registrations, rather than allocating a node for each
+public:
+    QData m_time;  // Time callback becomes current
+    uint64_t m_id;  // Unique id/sequence number, orders callbacks at the same time
+    s_cb_data m_cbData;  // Copy of user's callback data, with value not valid
+    PLI_INT32 m_valueFormat;  // Format of user's value, or vpiSuppressVal
+    bool m_removed;  // Removed by vpi_remove_cb, discard when reaches heap top
+
+    VerilatedVpiTimedCb(QData time, uint64_t id, const s_cb_data* cbDatap)
+        : m_time{time}
+        , m_id{id}
+        , m_cbData{*cbDatap}
+        , m_valueFormat{cbDatap->value ? cbDatap->value->format : vpiSuppressVal}
+        , m_removed{false} {
+        m_cbData.value = nullptr;
+    }
+    // Heap ordering, so earliest time, then lowest id, is at front
+    static bool later(const VerilatedVpiTimedCb& a, const VerilatedVpiTimedCb& b) {
+        if (a.m_time != b.m_time) return a.m_time > b.m_time;
+        return a.m_id > b.m_id;
     }
 };
 
@@ -868,26 +885,98 @@ class VerilatedVpiError;
 class VerilatedVpiImp final {
     enum { CB_ENUM_MAX_VALUE = cbAtEndOfSimTime + 1 };  // Maximum callback reason
     using VpioCbList = std::list<VerilatedVpiCbHolder>;
-    using VpioFutureCbs = std::map<std::pair<QData, uint64_t>, VerilatedVpiCbHolder>;
+    using VpioTimedCbs = std::vector<VerilatedVpiTimedCb>;  // Min-heap, see timedPush
 
     // All only medium-speed, so use singleton function
     // Callbacks that are past or at current timestamp
     std::array<VpioCbList, CB_ENUM_MAX_VALUE> m_cbCurrentLists;
     VpioCbList m_cbCallList;  // List of callbacks currently being called by callCbs
-    VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
-    VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
+    VpioTimedCbs m_futureCbs;  // Time based callbacks for future timestamps
+    VpioTimedCbs m_nextCbs;  // cbNextSimTime callbacks
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
     uint64_t m_nextCallbackId = 1;  // Id to identify callback
     bool m_evalNeeded = false;  // Model has had signals updated via vpi_put_value()
+    bool m_valueCbsChanged = false;  // cbValueChange list changed since valueCbsGather
+    bool m_valueCbsUntracked = false;  // Some cbValueChange object has no --vpi-dirty flag
+    std::set<CData*> m_valueCbsAnyDirtyps;  // Model dirty flags of cbValueChange objects
+
+public:
+    struct NameEntry final {
+        const VerilatedScope* m_scopep;  // Scope, or scope containing m_varp
+        const VerilatedVar* m_varp;  // Variable, or nullptr if the name is of a scope
+    };
+
+private:
+    // Full hierarchical names, so vpi_handle_by_name need not split them
+    std::unordered_map<std::string, NameEntry> m_nameIndex;
+    const VerilatedContext* m_nameIndexContextp = nullptr;  // Context m_nameIndex is of
+    uint64_t m_nameIndexGeneration = 0;  // VerilatedContext::scopeNameGeneration when built
 
     static VerilatedVpiImp& s() {  // Singleton
         static VerilatedVpiImp s_s;
         return s_s;
     }
 
+    static bool nameIsPlain(const char* namep) {
+        // No escaped identifier or package separator, which need vpi_handle_by_name's splitting
+        for (; *namep; ++namep) {
+            if (*namep == '\\' || *namep == ':') return false;
+        }
+        return true;
+    }
+    static void nameIndexBuild(VerilatedContext* contextp) VL_MT_UNSAFE_ONE {
+        // Must give what vpi_handle_by_name would find by splitting each name
+        std::unordered_map<std::string, NameEntry>& index = s().m_nameIndex;
+        index.clear();
+        const VerilatedScopeNameMap* const scopesp = contextp->scopeNameMap();
+        // Scopes first, as a scope wins over a variable of the same name
+        for (const auto& it : *scopesp) index.emplace(it.first, NameEntry{it.second, nullptr});
+        const VerilatedScope* const topScopep = contextp->scopeFind("TOP");
+        const VerilatedVarNameMap* const topVarsp = topScopep ? topScopep->varsp() : nullptr;
+        for (const auto& it : *scopesp) {
+            const VerilatedScope* const scopep = it.second;
+            if (!scopep->varsp() || !nameIsPlain(it.first)) continue;
+            const std::string scopeName{it.first};
+            // Names one level below the top find TOP's ports first
+            const bool topLevel = scopeName.find('.') == std::string::npos;
+            for (const auto& varIt : *scopep->varsp()) {
+                if (!nameIsPlain(varIt.first) || std::strchr(varIt.first, '.')) continue;
+                NameEntry entry{scopep, &varIt.second};
+                if (topLevel && topVarsp) {
+                    const auto topIt = topVarsp->find(varIt.first);
+                    if (topIt != topVarsp->end()) entry = NameEntry{topScopep, &topIt->second};
+                }
+                index.emplace(scopeName + "." + varIt.first, entry);
+                if (scopep->type() == VerilatedScope::SCOPE_PACKAGE)
+                    index.emplace(scopeName + "::" + varIt.first, entry);
+            }
+        }
+        // Names without a scope are of TOP's ports
+        if (topVarsp) {
+            for (const auto& varIt : *topVarsp) {
+                if (nameIsPlain(varIt.first) && !std::strchr(varIt.first, '.'))
+                    index.emplace(varIt.first, NameEntry{topScopep, &varIt.second});
+            }
+        }
+        VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: name index of %zu names\n", index.size()););
+    }
+
 public:
+    static const NameEntry* nameIndexFind(const std::string& name) VL_MT_UNSAFE_ONE {
+        // Built on first use, and rebuilt if a model was created or destroyed since
+        VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t generation = contextp->scopeNameGeneration();
+        if (VL_UNLIKELY(contextp != s().m_nameIndexContextp
+                        || generation != s().m_nameIndexGeneration)) {
+            nameIndexBuild(contextp);
+            s().m_nameIndexContextp = contextp;
+            s().m_nameIndexGeneration = generation;
+        }
+        const auto it = s().m_nameIndex.find(name);
+        return it == s().m_nameIndex.end() ? nullptr : &it->second;
+    }
     static void assertOneCheck() { s().m_assertOne.check(); }
     static uint64_t nextCallbackId() { return ++s().m_nextCallbackId; }
 
@@ -899,7 +988,10 @@ public:
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " obj=%p\n",
                                     cb_data_p->reason, id, cb_data_p->obj););
         VerilatedVpioVar* varop = nullptr;
-        if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
+        if (cb_data_p->reason == cbValueChange) {
+            varop = VerilatedVpioVar::castp(cb_data_p->obj);
+            s().m_valueCbsChanged = true;
+        }
         s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
     }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
@@ -907,16 +999,47 @@ public:
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " time=%" PRIu64
                                     " obj=%p\n",
                                     cb_data_p->reason, id, time, cb_data_p->obj););
-        s().m_futureCbs.emplace(std::piecewise_construct, std::forward_as_tuple(time, id),
-                                std::forward_as_tuple(id, cb_data_p, nullptr));
+        timedPush(s().m_futureCbs, time, id, cb_data_p);
     }
     static void cbNextAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d(NEXT) id=%" PRId64
                                     " time=%" PRIu64 " obj=%p\n",
                                     cb_data_p->reason, id, time, cb_data_p->obj););
-        s().m_nextCbs.emplace(std::piecewise_construct, std::forward_as_tuple(time, id),
-                              std::forward_as_tuple(id, cb_data_p, nullptr));
+        timedPush(s().m_nextCbs, time, id, cb_data_p);
+    }
+    static void timedPush(VpioTimedCbs& cbs, QData time, uint64_t id, const s_cb_data* cb_data_p) {
+        // A binary heap in a vector; once the vector has grown, registering a callback,
+        // and later moving it to the current list, allocates nothing
+        cbs.emplace_back(time, id, cb_data_p);
+        std::push_heap(cbs.begin(), cbs.end(), VerilatedVpiTimedCb::later);
+    }
+    static bool timedRemove(VpioTimedCbs& cbs, uint64_t id, QData time) {
+        // Linear, but removal is rare compared to registration, and the heap is small
+        for (VerilatedVpiTimedCb& cb : cbs) {
+            if (cb.m_id == id && cb.m_time == time) {
+                cb.m_removed = true;
+                return true;
+            }
+        }
+        return false;
+    }
+    static void timedMove(VpioTimedCbs& cbs, QData time, bool atTime) VL_MT_UNSAFE_ONE {
+        // Move callbacks before time, or also at time if atTime, to cbCurrent queue
+        while (!cbs.empty()
+               && (cbs.front().m_time < time || (atTime && cbs.front().m_time == time))) {
+            std::pop_heap(cbs.begin(), cbs.end(), VerilatedVpiTimedCb::later);
+            VerilatedVpiTimedCb& cb = cbs.back();
+            if (VL_LIKELY(!cb.m_removed)) {
+                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs id=%" PRId64 "\n", cb.m_id););
+                s_vpi_value value;
+                value.format = cb.m_valueFormat;
+                cb.m_cbData.value = &value;  // VerilatedVpiCbHolder copies the format only
+                s().m_cbCurrentLists[cb.m_cbData.reason].emplace_back(cb.m_id, &cb.m_cbData,
+                                                                      nullptr);
+            }
+            cbs.pop_back();
+        }
     }
     static void cbReasonRemove(uint64_t id, uint32_t reason, QData time) {
         // Id might no longer exist, if already removed due to call after event, or teardown
@@ -926,6 +1049,7 @@ public:
         for (auto& ir : s().m_cbCurrentLists[reason]) {
             if (ir.id() == id) {
                 ir.invalidate();
+                if (reason == cbValueChange) s().m_valueCbsChanged = true;
                 return;  // Once found, it won't also be in m_cbCallList, m_futureCbs, or m_nextCbs
             }
         }
@@ -935,52 +1059,19 @@ public:
                 return;  // Once found, it won't also be in m_futureCbs or m_nextCbs
             }
         }
-        {  // Remove from cbFuture queue
-            const auto it = s().m_futureCbs.find(std::make_pair(time, id));
-            if (it != s().m_futureCbs.end()) {
-                it->second.invalidate();
-                return;
-            }
-        }
-        {  // Remove from cbNext
-            const auto it = s().m_nextCbs.find(std::make_pair(time, id));
-            if (it != s().m_nextCbs.end()) {
-                it->second.invalidate();
-                return;
-            }
-        }
+        if (timedRemove(s().m_futureCbs, id, time)) return;  // Remove from cbFuture queue
+        timedRemove(s().m_nextCbs, id, time);  // Remove from cbNext
     }
     static void moveFutureCbs() VL_MT_UNSAFE_ONE {
         // For any events past current time, move from cbFuture queue to cbCurrent queue
         if (s().m_futureCbs.empty() && s().m_nextCbs.empty()) return;
         // VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs\n"); dumpCbs(); );
         const QData time = VL_TIME_Q();
-        for (auto it = s().m_futureCbs.begin();  //
-             VL_UNLIKELY(it != s().m_futureCbs.end() && it->first.first <= time);) {
-            VerilatedVpiCbHolder& hor = it->second;
-            const auto last_it = it;
-            ++it;
-            if (VL_UNLIKELY(!hor.invalid())) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs id=%" PRId64 "\n", hor.id()););
-                s().m_cbCurrentLists[hor.cb_datap()->reason].emplace_back(hor);
-            }
-            s().m_futureCbs.erase(last_it);
-        }
-        for (auto it = s().m_nextCbs.begin();  //
-             VL_UNLIKELY(it != s().m_nextCbs.end() && it->first.first < time);) {
-            VerilatedVpiCbHolder& hor = it->second;
-            const auto last_it = it;
-            ++it;
-            if (VL_UNLIKELY(!hor.invalid())) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: moveFutureCbs id=%" PRId64 "\n", hor.id()););
-                s().m_cbCurrentLists[hor.cb_datap()->reason].emplace_back(hor);
-            }
-            s().m_nextCbs.erase(last_it);
-        }
+        timedMove(s().m_futureCbs, time, true);
+        timedMove(s().m_nextCbs, time, false);
     }
     static QData cbNextDeadline() {
-        const auto it = s().m_futureCbs.cbegin();
-        if (VL_LIKELY(it != s().m_futureCbs.cend())) return it->first.first;
+        if (VL_LIKELY(!s().m_futureCbs.empty())) return s().m_futureCbs.front().m_time;
         return ~0ULL;  // maxquad
     }
     static bool hasCbs(const uint32_t reason) VL_MT_UNSAFE_ONE {
@@ -1007,12 +1098,37 @@ public:
         s().m_cbCallList.clear();
         return called;
     }
+    static void valueCbsGather() VL_MT_UNSAFE_ONE {
+        // Find which models' --vpi-dirty flags cover all cbValueChange objects
+        s().m_valueCbsChanged = false;
+        s().m_valueCbsUntracked = false;
+        s().m_valueCbsAnyDirtyps.clear();
+        for (VerilatedVpiCbHolder& ho : s().m_cbCurrentLists[cbValueChange]) {
+            if (ho.invalid()) continue;
+            const VerilatedVpioVar* const varop
+                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
+            if (CData* const anyDirtyp = varop->varp()->anyDirtyp()) {
+                s().m_valueCbsAnyDirtyps.insert(anyDirtyp);
+            } else {
+                s().m_valueCbsUntracked = true;
+            }
+        }
+    }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
+        const VlRegionProfiler::Guard regionGuard{Verilated::threadContextp(), "vpi value cbs"};
         VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
         bool called = false;
         std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
+        std::set<CData*> written;  // --vpi-dirty flags that were set, and are now cleared
         if (cbObjList.empty()) return called;
+        if (s().m_valueCbsChanged) valueCbsGather();
+        bool anyDirty = s().m_valueCbsUntracked;
+        for (CData* const anyDirtyp : s().m_valueCbsAnyDirtyps) {
+            anyDirty |= *anyDirtyp != 0;
+            *anyDirtyp = 0;
+        }
+        if (!anyDirty) return called;  // Nothing watched was written, so nothing to compare
         const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
         for (auto it = cbObjList.begin(); true;) {
             // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
@@ -1030,7 +1146,16 @@ public:
             VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
                                         varop->fullname(), *(static_cast<CData*>(newDatap)),
                                         *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
-            if (std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
+            bool mayDiffer = true;
+            if (CData* const dirtyp = varop->varp()->dirtyp()) {
+                // Clear when first seen; a callback writing it again sets it for next time
+                if (*dirtyp) {
+                    *dirtyp = 0;
+                    written.insert(dirtyp);
+                }
+                mayDiffer = written.count(dirtyp) != 0;
+            }
+            if (mayDiffer && std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
                 VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
                                             ho.id(), varop->fullname(),
                                             *(static_cast<CData*>(newDatap))););
@@ -1185,24 +1310,20 @@ void VerilatedVpiImp::dumpCbs() VL_MT_UNSAFE_ONE {
             }
         }
     }
-    for (auto& ifuture : s().m_nextCbs) {
-        const QData time = ifuture.first.first;
-        VerilatedVpiCbHolder& ho = ifuture.second;
-        if (VL_UNLIKELY(!ho.invalid())) {
-            VL_DBG_MSGF("- vpi:   time=%" PRId64 "(NEXT) reason=%d=%s  id=%" PRId64 "\n", time,
-                        ho.cb_datap()->reason,
-                        VerilatedVpiError::strFromVpiCallbackReason(ho.cb_datap()->reason),
-                        ho.id());
+    for (const VerilatedVpiTimedCb& cb : s().m_nextCbs) {  // Heap, so not in time order
+        if (VL_UNLIKELY(!cb.m_removed)) {
+            VL_DBG_MSGF("- vpi:   time=%" PRId64 "(NEXT) reason=%d=%s  id=%" PRId64 "\n",
+                        cb.m_time, cb.m_cbData.reason,
+                        VerilatedVpiError::strFromVpiCallbackReason(cb.m_cbData.reason),
+                        cb.m_id);
         }
     }
-    for (auto& ifuture : s().m_futureCbs) {
-        const QData time = ifuture.first.first;
-        VerilatedVpiCbHolder& ho = ifuture.second;
-        if (VL_UNLIKELY(!ho.invalid())) {
-            VL_DBG_MSGF("- vpi:   time=%" PRId64 " reason=%d=%s  id=%" PRId64 "\n", time,
-                        ho.cb_datap()->reason,
-                        VerilatedVpiError::strFromVpiCallbackReason(ho.cb_datap()->reason),
-                        ho.id());
+    for (const VerilatedVpiTimedCb& cb : s().m_futureCbs) {  // Heap, so not in time order
+        if (VL_UNLIKELY(!cb.m_removed)) {
+            VL_DBG_MSGF("- vpi:   time=%" PRId64 " reason=%d=%s  id=%" PRId64 "\n",
+                        cb.m_time, cb.m_cbData.reason,
+                        VerilatedVpiError::strFromVpiCallbackReason(cb.m_cbData.reason),
+                        cb.m_id);
         }
     }
 }
@@ -2050,6 +2171,16 @@ void vpi_get_systf_info(vpiHandle /*object*/, p_vpi_systf_data /*systf_data_p*/)
 
 // for obtaining handles
 
+static vpiHandle vl_vpi_scope_handle(const VerilatedScope* scopep) {
+    if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
+        return (new VerilatedVpioModule{scopep})->castVpiHandle();
+    } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
+        return (new VerilatedVpioPackage{scopep})->castVpiHandle();
+    } else {
+        return (new VerilatedVpioScope{scopep})->castVpiHandle();
+    }
+}
+
 vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     VerilatedVpiImp::assertOneCheck();
     VL_VPI_ERROR_RESET_();
@@ -2064,19 +2195,16 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
         scopeAndName = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + namep;
         namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
     }
-    {
+    if (const VerilatedVpiImp::NameEntry* const entryp
+        = VerilatedVpiImp::nameIndexFind(scopeAndName)) {
+        scopep = entryp->m_scopep;
+        varp = entryp->m_varp;
+        if (!varp) return vl_vpi_scope_handle(scopep);
+    } else {
         // This doesn't yet follow the hierarchy in the proper way
         bool isPackage = false;
         scopep = Verilated::threadContextp()->scopeFind(namep);
-        if (scopep) {  // Whole thing found as a scope
-            if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
-                return (new VerilatedVpioModule{scopep})->castVpiHandle();
-            } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
-                return (new VerilatedVpioPackage{scopep})->castVpiHandle();
-            } else {
-                return (new VerilatedVpioScope{scopep})->castVpiHandle();
-            }
-        }
+        if (scopep) return vl_vpi_scope_handle(scopep);  // Whole thing found as a scope
         std::string basename = scopeAndName;
         std::string scopename;
         std::string::size_type prevpos = std::string::npos;
@@ -2756,6 +2884,7 @@ vpiHandle vpi_put_value(vpiHandle object, p_vpi_value valuep, p_vpi_time /*time_
             return object;
         }
         VerilatedVpiImp::evalNeeded(true);
+        vop->varp()->markDirty();
         const int varBits = vop->bitSize();
         if (valuep->format == vpiVectorVal) {
             if (VL_UNLIKELY(!valuep->value.vector)) return nullptr;
@@ -3708,3 +3837,142 @@ vpiHandle vpi_handle_by_multi_index(vpiHandle /*obj*/, PLI_INT32 /*num_index*/,
     VL_VPI_UNIMP_();
     return nullptr;
 }
+
+//======================================================================
+// Verilator extension: bulk get and put
+
+class VerilatedVpiBulk final {
+public:
+    struct Entry final {
+        const VerilatedVpioVar* m_vop;  // User's handle
+        PLI_INT32 m_format;  // vpiIntVal, vpiRealVal or vpiVectorVal
+        size_t m_offset;  // Byte offset in buffer
+        int m_words;  // s_vpi_vecval's for vpiVectorVal
+    };
+    std::vector<Entry> m_entries;
+    size_t m_size = 0;  // Bytes of buffer
+    bool m_writable = true;  // All variables are public_flat_rw
+};
+
+VerilatedVpiBulk* VerilatedVpi::bulkCreate(const vpiHandle* handlesp, const PLI_INT32* formatsp,
+                                           size_t count) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    std::unique_ptr<VerilatedVpiBulk> bulkp{new VerilatedVpiBulk};
+    bulkp->m_entries.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(handlesp[i]);
+        if (VL_UNLIKELY(!vop)) {
+            VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Handle %zu (%p) is not a variable", __func__,
+                          i, handlesp[i]);
+            return nullptr;
+        }
+        const PLI_INT32 format = formatsp[i];
+        const VerilatedVarType vltype = vop->varp()->vltype();
+        const bool isInt = vltype == VLVT_UINT8 || vltype == VLVT_UINT16
+                           || vltype == VLVT_UINT32 || vltype == VLVT_UINT64
+                           || vltype == VLVT_WDATA;
+        size_t bytes;
+        int words = 0;
+        if ((format == vpiIntVal && isInt) || (format == vpiRealVal && vltype == VLVT_REAL)) {
+            bytes = format == vpiIntVal ? sizeof(PLI_INT32) : sizeof(double);
+        } else if (format == vpiVectorVal && isInt) {
+            words = VL_WORDS_I(vop->bitSize());
+            if (VL_UNCOVERABLE(words >= VL_VALUE_STRING_MAX_WORDS)) {
+                VL_VPI_ERROR_(__FILE__, __LINE__,
+                              "%s: More than VL_VALUE_STRING_MAX_WORDS for %s; increase and "
+                              "recompile",
+                              __func__, vop->fullname());
+                return nullptr;
+            }
+            bytes = words * sizeof(s_vpi_vecval);
+        } else {
+            VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported format (%s) as requested for %s",
+                          __func__, VerilatedVpiError::strFromVpiVal(format), vop->fullname());
+            return nullptr;
+        }
+        const size_t align = format == vpiRealVal ? sizeof(double) : sizeof(PLI_INT32);
+        const size_t offset = (bulkp->m_size + align - 1) / align * align;
+        bulkp->m_entries.push_back(VerilatedVpiBulk::Entry{vop, format, offset, words});
+        bulkp->m_size = offset + bytes;
+        if (!vop->varp()->isPublicRW()) bulkp->m_writable = false;
+    }
+    return bulkp.release();
+}
+
+void VerilatedVpi::bulkDestroy(VerilatedVpiBulk* bulkp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_DO_DANGLING(delete bulkp, bulkp);
+}
+
+size_t VerilatedVpi::bulkSize(const VerilatedVpiBulk* bulkp) VL_MT_UNSAFE_ONE {
+    return bulkp->m_size;
+}
+
+size_t VerilatedVpi::bulkOffset(const VerilatedVpiBulk* bulkp, size_t i) VL_MT_UNSAFE_ONE {
+    return bulkp->m_entries[i].m_offset;
+}
+
+void VerilatedVpi::bulkGet(const VerilatedVpiBulk* bulkp, void* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    uint8_t* const bytep = static_cast<uint8_t*>(bufp);
+    for (const VerilatedVpiBulk::Entry& entry : bulkp->m_entries) {
+        const VerilatedVpioVar* const vop = entry.m_vop;
+        uint8_t* const valuep = bytep + entry.m_offset;
+        if (entry.m_format == vpiIntVal) {
+            const PLI_INT32 value = static_cast<PLI_INT32>(vl_vpi_get_word(vop, 32, 0));
+            std::memcpy(valuep, &value, sizeof(value));
+        } else if (entry.m_format == vpiRealVal) {
+            std::memcpy(valuep, vop->varRealDatap(), sizeof(double));
+        } else {
+            s_vpi_vecval* const vecp = reinterpret_cast<s_vpi_vecval*>(valuep);
+            if (vop->varp()->vltype() == VLVT_UINT64 && entry.m_words == 2) {
+                const QData data = vl_vpi_get_word(vop, 64, 0);
+                vecp[0].aval = static_cast<IData>(data);
+                vecp[1].aval = static_cast<IData>(data >> 32ULL);
+            } else {
+                for (int i = 0; i < entry.m_words; ++i) {
+                    vecp[i].aval = vl_vpi_get_word(vop, 32, i * 32);
+                }
+            }
+            for (int i = 0; i < entry.m_words; ++i) vecp[i].bval = 0;
+        }
+    }
+}
+
+void VerilatedVpi::bulkPut(const VerilatedVpiBulk* bulkp, const void* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    if (VL_UNLIKELY(!bulkp->m_writable)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: Some signal is marked read-only, use public_flat_rw instead",
+                      __func__);
+        return;
+    }
+    VerilatedVpiImp::evalNeeded(true);
+    const uint8_t* const bytep = static_cast<const uint8_t*>(bufp);
+    for (const VerilatedVpiBulk::Entry& entry : bulkp->m_entries) {
+        const VerilatedVpioVar* const vop = entry.m_vop;
+        const uint8_t* const valuep = bytep + entry.m_offset;
+        vop->varp()->markDirty();
+        if (entry.m_format == vpiIntVal) {
+            PLI_INT32 value;
+            std::memcpy(&value, valuep, sizeof(value));
+            vl_vpi_put_word(vop, value, 64, 0);
+        } else if (entry.m_format == vpiRealVal) {
+            std::memcpy(vop->varRealDatap(), valuep, sizeof(double));
+        } else {
+            const s_vpi_vecval* const vecp = reinterpret_cast<const s_vpi_vecval*>(valuep);
+            if (vop->varp()->vltype() == VLVT_UINT64 && entry.m_words == 2) {
+                const QData val = (static_cast<QData>(static_cast<uint32_t>(vecp[1].aval)) << 32)
+                                  | static_cast<QData>(static_cast<uint32_t>(vecp[0].aval));
+                vl_vpi_put_word(vop, val, 64, 0);
+            } else {
+                for (int i = 0; i < entry.m_words; ++i) {
+                    vl_vpi_put_word(vop, vecp[i].aval, 32, i * 32);
+                }
+            }
+        }
+    }
+}
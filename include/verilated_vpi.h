@@ -36,6 +36,8 @@
 
 //======================================================================
 
+class VerilatedVpiBulk;
+
 /// Class for namespace-like grouping of Verilator VPI functions.
 
 class VerilatedVpi final {
@@ -65,6 +67,25 @@ public:
     /// Perform inertially delayed puts
     static void doInertialPuts() VL_MT_UNSAFE_ONE;
 
+    /// Verilator extension: prepare to get or put the values of many
+    /// variables with one call.  Handle i is accessed in formatsp[i], which
+    /// is vpiIntVal, vpiRealVal or vpiVectorVal; handles must stay valid
+    /// until bulkDestroy.  Returns nullptr, with vpi_chk_error set, if a
+    /// handle is not a variable or cannot be accessed in its format.
+    static VerilatedVpiBulk* bulkCreate(const vpiHandle* handlesp, const PLI_INT32* formatsp,
+                                        size_t count) VL_MT_UNSAFE_ONE;
+    static void bulkDestroy(VerilatedVpiBulk* bulkp) VL_MT_UNSAFE_ONE;
+    /// Bytes needed for the bulkGet/bulkPut buffer, which must be 8 byte aligned.
+    /// Values are packed in handle order, each aligned to its size: a
+    /// PLI_INT32, a double, or an s_vpi_vecval per 32 bits.
+    static size_t bulkSize(const VerilatedVpiBulk* bulkp) VL_MT_UNSAFE_ONE;
+    /// Byte offset of handle i's value within the buffer
+    static size_t bulkOffset(const VerilatedVpiBulk* bulkp, size_t i) VL_MT_UNSAFE_ONE;
+    /// Read every value into bufp
+    static void bulkGet(const VerilatedVpiBulk* bulkp, void* bufp) VL_MT_UNSAFE_ONE;
+    /// Write every value from bufp, as vpi_put_value with vpiNoDelay would
+    static void bulkPut(const VerilatedVpiBulk* bulkp, const void* bufp) VL_MT_UNSAFE_ONE;
+
     // Self test, for internal use only
     static void selfTest() VL_MT_UNSAFE_ONE;
 };
@@ -69,6 +69,11 @@
 # define VL_UNLIKELY(x) __builtin_expect(!!(x), 0)  // Prefer over C++20 [[unlikely]]
 # define VL_PREFETCH_RD(p) __builtin_prefetch((p), 0)
 # define VL_PREFETCH_RW(p) __builtin_prefetch((p), 1)
+# if defined(__clang__)
+#  define VL_LOOP_INDEPENDENT _Pragma("clang loop vectorize(assume_safety)")
+# else
+#  define VL_LOOP_INDEPENDENT _Pragma("GCC ivdep")
+# endif
 #endif
 
 #ifdef __cpp_lib_unreachable
@@ -195,6 +200,9 @@
 #ifndef VL_PREFETCH_RW
 # define VL_PREFETCH_RW(p)  ///< Prefetch pointer argument with read/write intent
 #endif
+#ifndef VL_LOOP_INDEPENDENT
+# define VL_LOOP_INDEPENDENT  ///< Following loop's iterations do not alias each other
+#endif
 
 
 #ifndef VL_NO_LEGACY
@@ -606,6 +614,10 @@ static inline double VL_ROUND(double n) {
 # ifdef __x86_64__
 #  define VL_X86_64 1
 # endif
+// Define VL_NO_INT128 to compute 65-128 bit values with only 32-bit words
+# if defined(__SIZEOF_INT128__) && !defined(VL_NO_INT128)
+#  define VL_HAVE_INT128 1
+# endif
 #endif  // VL_PORTABLE_ONLY
 // clang-format on
 
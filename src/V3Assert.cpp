@@ -49,6 +49,7 @@ class AssertVisitor final : public VNVisitor {
     VDouble0 m_statAsImm;  // Statistic tracking
     VDouble0 m_statAsFull;  // Statistic tracking
     bool m_inSampled = false;  // True inside a sampled expression
+    bool m_inAssertOnly = false;  // True where sampled values are only used by assertions
 
     // METHODS
     static AstNodeExpr* assertOnCond(FileLine* fl, VAssertType type,
@@ -146,6 +147,7 @@ class AssertVisitor final : public VNVisitor {
     AstSampled* newSampledExpr(AstNodeExpr* nodep) {
         AstSampled* const sampledp = new AstSampled{nodep->fileline(), nodep};
         sampledp->dtypeFrom(nodep);
+        sampledp->assertOnly(m_inAssertOnly);
         return sampledp;
     }
     AstVarRef* newMonitorNumVarRefp(AstNode* nodep, VAccess access) {
@@ -485,8 +487,10 @@ class AssertVisitor final : public VNVisitor {
     void visit(AstSampled* nodep) override {
         if (nodep->user1()) return;
         VL_RESTORER(m_inSampled);
+        VL_RESTORER(m_inAssertOnly);
         {
             m_inSampled = true;
+            if (nodep->assertOnly()) m_inAssertOnly = true;
             iterateChildren(nodep);
         }
         nodep->replaceWith(nodep->exprp()->unlinkFrBack());
@@ -595,7 +599,12 @@ class AssertVisitor final : public VNVisitor {
         VL_DO_DANGLING(pushDeletep(nodep), nodep);
     }
     void visit(AstAssert* nodep) override {
-        iterateChildren(nodep);
+        {
+            // Everything under is skipped while assertions are off
+            VL_RESTORER(m_inAssertOnly);
+            m_inAssertOnly = true;
+            iterateChildren(nodep);
+        }
         newPslAssertion(nodep, nodep->failsp());
     }
     void visit(AstAssertCtl* nodep) override {
@@ -678,7 +687,11 @@ class AssertVisitor final : public VNVisitor {
         newPslAssertion(nodep, nodep->failsp());
     }
     void visit(AstCover* nodep) override {
-        iterateChildren(nodep);
+        {
+            VL_RESTORER(m_inAssertOnly);
+            m_inAssertOnly = true;
+            iterateChildren(nodep);
+        }
         newPslAssertion(nodep, nullptr);
     }
     void visit(AstRestrict* nodep) override {
@@ -24,6 +24,7 @@
 #include "V3AssertPre.h"
 
 #include "V3Const.h"
+#include "V3Stats.h"
 #include "V3Task.h"
 #include "V3UniqueNames.h"
 
@@ -37,6 +38,8 @@ class AssertPreVisitor final : public VNVisitor {
     // Eventually inlines calls to sequences, properties, etc.
     // We're not parsing the tree, or anything more complicated.
 private:
+    // CONSTANTS
+    static constexpr uint32_t SEQ_WARN_WIDTH = 256;  // Sequence length to warn about cost
     // NODE STATE
     const VNUser1InUse m_inuser1;
     // STATE
@@ -53,8 +56,11 @@ private:
     AstSenItem* m_seniAlwaysp = nullptr;  // Last sensitivity in always
     // Reset each assertion:
     AstNodeExpr* m_disablep = nullptr;  // Last disable
+    AstNodeBiop* m_disableBlockp = nullptr;  // Expression applying the last disable
     // Other:
     V3UniqueNames m_cycleDlyNames{"__VcycleDly"};  // Cycle delay counter name generator
+    V3UniqueNames m_seqNames{"__Vseq"};  // Sequence automaton register name generator
+    VDouble0 m_statSequences;  // Statistic tracking
     bool m_inAssign = false;  // True if in an AssignNode
     bool m_inAssignDlyLhs = false;  // True if in AssignDly's LHS
     bool m_inSynchDrive = false;  // True if in synchronous drive
@@ -81,6 +87,7 @@ private:
     void clearAssertInfo() {
         m_senip = nullptr;
         m_disablep = nullptr;
+        m_disableBlockp = nullptr;
     }
     AstPropSpec* getPropertyExprp(const AstProperty* const propp) {
         // The only statements possible in AstProperty are AstPropSpec (body)
@@ -151,6 +158,197 @@ private:
         return nodep;
     }
 
+    // Sequences are matched by an automaton holding every attempt in flight at once as one bit
+    // of a vector indexed by the attempt's age in cycles, so all attempts advance together with
+    // a few vector operations per clock.  Register 'd' of stage 'i' holds the attempts that
+    // matched stage 'i - 1' exactly 'd' cycles ago.
+    struct SeqStage final {
+        AstNodeExpr* exprp;  // Boolean to match, nullptr to match any cycle
+        uint32_t minDelay;  // Minimum cycles after the previous stage
+        uint32_t maxDelay;  // Maximum cycles after the previous stage
+    };
+    static bool flattenSequence(AstNodeExpr* nodep, uint32_t minDelay, uint32_t maxDelay,
+                                std::vector<SeqStage>& stages) {
+        // Flatten a sequence into its stages, return false if it cannot be
+        if (AstSExpr* const sexprp = VN_CAST(nodep, SExpr)) {
+            if (AstNodeExpr* const prep = sexprp->preExprp()) {
+                if (!flattenSequence(prep, minDelay, maxDelay, stages)) return false;
+            } else {
+                stages.push_back({nullptr, minDelay, maxDelay});
+            }
+            const AstConst* const minp = VN_CAST(sexprp->delayp(), Const);
+            const AstConst* const maxp
+                = sexprp->maxDelayp() ? VN_CAST(sexprp->maxDelayp(), Const) : minp;
+            if (!minp || !maxp) return false;
+            return flattenSequence(sexprp->exprp(), minp->toUInt(), maxp->toUInt(), stages);
+        }
+        if (nodep->exists([](const AstSExpr*) { return true; })) return false;
+        stages.push_back({nodep, minDelay, maxDelay});
+        return true;
+    }
+    void iterateSequenceOperands(AstNodeExpr* nodep) {
+        // Iterate the booleans of a sequence, but not the sequence itself
+        if (AstSExpr* const sexprp = VN_CAST(nodep, SExpr)) {
+            if (sexprp->preExprp()) iterateSequenceOperands(sexprp->preExprp());
+            iterateSequenceOperands(sexprp->exprp());
+        } else {
+            iterate(nodep);
+        }
+    }
+    AstNodeCoverOrAssert* propertyAssertp(AstNode* nodep) const {
+        // Return the assertion if nodep is its whole property, else nullptr
+        AstNode* abovep = nodep->backp();
+        if (abovep && abovep == m_disableBlockp && VN_AS(abovep, NodeBiop)->rhsp() == nodep) {
+            nodep = abovep;
+            abovep = abovep->backp();
+        }
+        if (VN_IS(abovep, Sampled)) {
+            nodep = abovep;
+            abovep = abovep->backp();
+        }
+        AstNodeCoverOrAssert* const assertp = VN_CAST(abovep, NodeCoverOrAssert);
+        return assertp && assertp->propp() == nodep ? assertp : nullptr;
+    }
+    AstNodeExpr* lowerSequence(AstNodeExpr* nodep, AstNodeExpr* startp,
+                               const std::vector<SeqStage>& stages, bool cover) {
+        // Build the automaton matching 'stages' for attempts starting when 'startp' (nullptr
+        // for every cycle), return the property value: matched if 'cover', else not failed
+        FileLine* const flp = nodep->fileline();
+        UASSERT_OBJ(stages.front().maxDelay == 0, nodep, "First sequence stage is delayed");
+        uint32_t width = 1;
+        for (const SeqStage& stage : stages) width += stage.maxDelay;
+        if (width > SEQ_WARN_WIDTH) {
+            nodep->v3warn(TICKCOUNT, "Sequence cycle delays totalling "
+                                         << width - 1 << " may have a large performance cost");
+        }
+        AstNodeDType* const dtypep = nodep->findLogicDType(width, width, VSigning::UNSIGNED);
+        const std::string name = m_seqNames.get(nodep);
+        std::vector<std::vector<AstVar*>> regps(stages.size());
+        for (size_t i = 1; i < stages.size(); ++i) {
+            for (uint32_t d = 1; d <= stages[i].maxDelay; ++d) {
+                AstVar* const varp
+                    = new AstVar{flp, VVarType::MODULETEMP,
+                                 name + "_" + cvtToStr(i) + "_" + cvtToStr(d), dtypep};
+                varp->lifetime(VLifetime::STATIC);
+                m_modp->addStmtsp(varp);
+                m_modp->addStmtsp(new AstInitialStatic{
+                    flp, new AstAssign{flp, new AstVarRef{flp, varp, VAccess::WRITE},
+                                       new AstConst{flp, AstConst::WidthedValue{},
+                                                    static_cast<int>(width), 0}}});
+                regps[i].push_back(varp);
+            }
+        }
+        // Expressions are built fresh for each use; the register updates sample the booleans
+        bool sampled = false;
+        const auto constp = [&](uint32_t value) {
+            return new AstConst{flp, AstConst::WidthedValue{}, static_cast<int>(width), value};
+        };
+        const auto refp = [&](size_t i, uint32_t d) {
+            return new AstVarRef{flp, regps[i][d - 1], VAccess::READ};
+        };
+        const auto orp = [](AstNodeExpr* ap, AstNodeExpr* bp) -> AstNodeExpr* {
+            if (!ap) return bp;
+            return new AstOr{ap->fileline(), ap, bp};
+        };
+        const auto boolp = [&](AstNodeExpr* exprp) -> AstNodeExpr* {
+            if (!exprp) return nullptr;
+            exprp = exprp->cloneTreePure(false);
+            if (!sampled) return exprp;
+            AstSampled* const sampledp = new AstSampled{flp, exprp};
+            sampledp->dtypeFrom(exprp);
+            sampledp->assertOnly(true);
+            return sampledp;
+        };
+        // Attempts matching stage 'i' this cycle
+        const std::function<AstNodeExpr*(size_t)> matchp = [&](size_t i) -> AstNodeExpr* {
+            const SeqStage& stage = stages[i];
+            AstNodeExpr* condp = boolp(stage.exprp);
+            AstNodeExpr* valuep = nullptr;
+            if (i == 0) {
+                if (startp) {
+                    AstNodeExpr* const sp = boolp(startp);
+                    condp = condp ? new AstLogAnd{flp, sp, condp} : sp;
+                }
+                valuep = constp(1);
+            } else {
+                for (uint32_t d = std::max<uint32_t>(stage.minDelay, 1); d <= stage.maxDelay; ++d)
+                    valuep = orp(valuep, refp(i, d));
+                if (stage.minDelay == 0) valuep = orp(valuep, matchp(i - 1));
+            }
+            return condp ? new AstCond{flp, condp, valuep, constp(0)} : valuep;
+        };
+        // Attempts held in register 'd' of stage 'i' next cycle, before aging
+        const auto nextp = [&](size_t i, uint32_t d) -> AstNodeExpr* {
+            AstNodeExpr* const heldp = d == 1 ? matchp(i - 1) : refp(i, d - 1);
+            return new AstAnd{flp, heldp, new AstNot{flp, matchp(stages.size() - 1)}};
+        };
+
+        sampled = true;
+        AstAlways* const alwaysp
+            = new AstAlways{flp, VAlwaysKwd::ALWAYS, newSenTree(nodep), nullptr};
+        for (size_t i = 1; i < stages.size(); ++i) {
+            for (uint32_t d = 1; d <= stages[i].maxDelay; ++d) {
+                AstNodeExpr* valuep = new AstShiftL{flp, nextp(i, d), new AstConst{flp, 1},
+                                                    static_cast<int>(width)};
+                if (m_disablep) {
+                    valuep = new AstCond{flp, boolp(m_disablep), constp(0), valuep};
+                }
+                alwaysp->addStmtsp(
+                    new AstAssignDly{flp, new AstVarRef{flp, regps[i][d - 1], VAccess::WRITE},
+                                     valuep});
+            }
+        }
+        if (alwaysp->stmtsp()) {
+            m_modp->addStmtsp(alwaysp);
+        } else {
+            VL_DO_DANGLING(pushDeletep(alwaysp), alwaysp);
+        }
+        sampled = false;
+
+        AstNodeExpr* resultp;
+        if (cover) {
+            resultp = new AstNeq{flp, matchp(stages.size() - 1), constp(0)};
+        } else {
+            // Failed if an attempt was live, did not match, and is held nowhere next cycle
+            AstNodeExpr* livep = constp(1);
+            if (startp) {
+                livep = new AstCond{flp, startp->cloneTreePure(false), livep, constp(0)};
+            }
+            AstNodeExpr* heldp = nullptr;
+            for (size_t i = 1; i < stages.size(); ++i) {
+                for (uint32_t d = 1; d <= stages[i].maxDelay; ++d) {
+                    livep = new AstOr{flp, livep, refp(i, d)};
+                    heldp = orp(heldp, nextp(i, d));
+                }
+            }
+            AstNodeExpr* failp
+                = new AstAnd{flp, livep, new AstNot{flp, matchp(stages.size() - 1)}};
+            if (heldp) failp = new AstAnd{flp, failp, new AstNot{flp, heldp}};
+            resultp = new AstEq{flp, failp, constp(0)};
+        }
+        if (startp) VL_DO_DANGLING(pushDeletep(startp), startp);
+        ++m_statSequences;
+        return resultp;
+    }
+    void lowerSequenceProperty(AstNodeExpr* nodep, AstNodeExpr* seqp, AstNodeExpr* startp,
+                               bool overlapped) {
+        // Replace nodep, a whole property ending in sequence seqp, with its automaton
+        AstNodeCoverOrAssert* const assertp = propertyAssertp(nodep);
+        std::vector<SeqStage> stages;
+        if (!overlapped) stages.push_back({nullptr, 0, 0});
+        if (!assertp || !flattenSequence(seqp, !overlapped, !overlapped, stages)) {
+            nodep->v3warn(E_UNSUPPORTED, "Unsupported: ## (in sequence expression) other than"
+                                         " as a whole property or implication consequent");
+            if (startp) VL_DO_DANGLING(pushDeletep(startp), startp);
+            nodep->replaceWith(new AstConst{nodep->fileline(), AstConst::BitTrue{}});
+            VL_DO_DANGLING(pushDeletep(nodep), nodep);
+            return;
+        }
+        AstNodeExpr* const newp = lowerSequence(nodep, startp, stages, VN_IS(assertp, Cover));
+        nodep->replaceWith(newp);
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+    }
+
     // VISITORS
     //========== Statements
     void visit(AstClocking* const nodep) override {
@@ -509,6 +707,18 @@ private:
         if (nodep->sentreep()) return;  // Already processed
 
         FileLine* const fl = nodep->fileline();
+        if (nodep->rhsp()->exists([](const AstSExpr*) { return true; })) {
+            iterateAndNextNull(nodep->lhsp());
+            iterateSequenceOperands(nodep->rhsp());
+            AstNodeExpr* startp = nodep->lhsp()->unlinkFrBack();
+            if (m_disablep) {
+                startp = new AstLogAnd{fl, new AstLogNot{fl, m_disablep->cloneTreePure(false)},
+                                       startp};
+            }
+            lowerSequenceProperty(nodep, nodep->rhsp(), startp, nodep->isOverlapped());
+            return;
+        }
+        UASSERT_OBJ(!nodep->isOverlapped(), nodep, "Overlapped implication without sequence");
         AstNodeExpr* const rhsp = nodep->rhsp()->unlinkFrBack();
         AstNodeExpr* lhsp = nodep->lhsp()->unlinkFrBack();
 
@@ -523,6 +733,15 @@ private:
         VL_DO_DANGLING(pushDeletep(nodep), nodep);
     }
 
+    void visit(AstSExpr* nodep) override {
+        // Only reached for a sequence that is not an implication's consequent
+        iterateSequenceOperands(nodep);
+        AstNodeExpr* const startp
+            = m_disablep ? new AstLogNot{nodep->fileline(), m_disablep->cloneTreePure(false)}
+                         : nullptr;
+        lowerSequenceProperty(nodep, nodep, startp, true);
+    }
+
     void visit(AstDefaultDisable* nodep) override {
         // Done with these
         VL_DO_DANGLING(pushDeletep(nodep->unlinkFrBack()), nodep);
@@ -552,12 +771,14 @@ private:
         if (AstNodeExpr* const disablep = nodep->disablep()) {
             m_disablep = disablep->cloneTreePure(false);
             if (VN_IS(nodep->backp(), Cover)) {
-                blockp = new AstAnd{disablep->fileline(),
-                                    new AstNot{disablep->fileline(), disablep->unlinkFrBack()},
-                                    blockp};
+                m_disableBlockp = new AstAnd{
+                    disablep->fileline(),
+                    new AstNot{disablep->fileline(), disablep->unlinkFrBack()}, blockp};
             } else {
-                blockp = new AstOr{disablep->fileline(), disablep->unlinkFrBack(), blockp};
+                m_disableBlockp
+                    = new AstOr{disablep->fileline(), disablep->unlinkFrBack(), blockp};
             }
+            blockp = m_disableBlockp;
         }
         // Unlink and just keep a pointer to it, convert to sentree as needed
         m_senip = nodep->sensesp();
@@ -606,7 +827,9 @@ public:
         // Fix up varref names
         for (AstVarXRef* xrefp : m_xrefsp) xrefp->name(xrefp->varp()->name());
     }
-    ~AssertPreVisitor() override = default;
+    ~AssertPreVisitor() override {
+        V3Stats::addStat("Assertions, sequence automata", m_statSequences);
+    }
 };
 
 //######################################################################
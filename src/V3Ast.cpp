@@ -22,6 +22,7 @@
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -49,6 +50,18 @@ bool VNUser4InUse::s_userBusy = false;
 
 int AstNodeDType::s_uniqueNum = 0;
 
+int AstNode::INSTR_COUNT_BRANCH = 4;
+int AstNode::INSTR_COUNT_CALL = INSTR_COUNT_BRANCH + 10;
+int AstNode::INSTR_COUNT_LD = 2;
+int AstNode::INSTR_COUNT_INT_MUL = 3;
+int AstNode::INSTR_COUNT_INT_DIV = 10;
+int AstNode::INSTR_COUNT_DBL = 8;
+int AstNode::INSTR_COUNT_DBL_DIV = 40;
+int AstNode::INSTR_COUNT_DBL_TRIG = 200;
+int AstNode::INSTR_COUNT_STR = 100;
+int AstNode::INSTR_COUNT_TIME = INSTR_COUNT_CALL + 5;
+int AstNode::INSTR_COUNT_PLI = 20;
+
 //######################################################################
 // VNType
 
@@ -64,6 +77,15 @@ std::ostream& operator<<(std::ostream& os, VNType rhs);
 const std::shared_ptr<const string> VSelfPointerText::s_emptyp = std::make_shared<string>("");
 const std::shared_ptr<const string> VSelfPointerText::s_thisp = std::make_shared<string>("this");
 
+std::shared_ptr<const string> VSelfPointerText::intern(const string& text) VL_MT_SAFE {
+    static V3Mutex s_mutex;
+    static std::unordered_map<string, std::shared_ptr<const string>> s_texts;
+    const V3LockGuard lock{s_mutex};
+    std::shared_ptr<const string>& strpr = s_texts[text];
+    if (!strpr) strpr = std::make_shared<const string>(text);
+    return strpr;
+}
+
 string VSelfPointerText::replaceThis(bool useSelfForThis, const string& text) {
     return useSelfForThis ? VString::replaceWord(text, "this", "vlSelf") : text;
 }
@@ -942,6 +964,93 @@ void AstNode::operator delete(void* objp, size_t size) {
     V3Broken::deleted(nodep);
     ::operator delete(objp);
 }
+
+size_t AstNode::allocatorBytes() VL_MT_SAFE { return 0; }
+#else
+// Nodes are small, very numerous and short lived in many passes, so rather than going to
+// the general allocator they are carved from large chunks, and freed nodes are put on a
+// per thread, per size class free list for reuse. Chunks are never returned.
+class AstNodeAllocator final {
+    static constexpr size_t GRANULE = 16;  // Size class granularity, also the alignment
+    static constexpr size_t MAX_BYTES = 512;  // Larger nodes use the general allocator
+    static constexpr size_t CHUNK_BYTES = 1024 * 1024;  // Bytes per chunk
+
+    struct FreeNode final {
+        FreeNode* m_nextp;
+    };
+
+    // MEMBERS - per thread, trivially destructible
+    FreeNode* m_freeps[MAX_BYTES / GRANULE + 1];  // Free list per size class
+    char* m_chunkp;  // Unused part of current chunk
+    size_t m_chunkLeft;  // Bytes left in current chunk
+
+    // STATIC MEMBERS
+    static V3Mutex s_mutex;  // Protects s_chunkps
+    static std::vector<std::unique_ptr<char[]>> s_chunkps VL_GUARDED_BY(s_mutex);
+    static std::atomic<size_t> s_chunkBytes;  // Total bytes in chunks
+
+    static size_t sizeClass(size_t size) { return (size + GRANULE - 1) / GRANULE; }
+    void* newChunkSpace(size_t bytes) VL_MT_SAFE_EXCLUDES(s_mutex) {
+        {
+            const V3LockGuard lock{s_mutex};
+            s_chunkps.emplace_back(new char[CHUNK_BYTES]);
+            m_chunkp = s_chunkps.back().get();
+        }
+        m_chunkLeft = CHUNK_BYTES;
+        s_chunkBytes.fetch_add(CHUNK_BYTES, std::memory_order_relaxed);
+        return chunkSpace(bytes);
+    }
+    void* chunkSpace(size_t bytes) {
+        void* const resultp = m_chunkp;
+        m_chunkp += bytes;
+        m_chunkLeft -= bytes;
+        return resultp;
+    }
+
+public:
+    static thread_local AstNodeAllocator t_allocator;
+
+    // METHODS
+    void* allocate(size_t size) {
+        if (VL_UNLIKELY(size > MAX_BYTES)) return ::operator new(size);
+        const size_t sclass = sizeClass(size);
+        if (FreeNode* const freep = m_freeps[sclass]) {
+            m_freeps[sclass] = freep->m_nextp;
+            return freep;
+        }
+        const size_t bytes = sclass * GRANULE;
+        if (VL_UNLIKELY(m_chunkLeft < bytes)) return newChunkSpace(bytes);
+        return chunkSpace(bytes);
+    }
+    void release(void* objp, size_t size) {
+        if (VL_UNLIKELY(size > MAX_BYTES)) {
+            ::operator delete(objp);
+            return;
+        }
+        // Freed on this thread's list, even if allocated by another
+        FreeNode* const freep = static_cast<FreeNode*>(objp);
+        const size_t sclass = sizeClass(size);
+        freep->m_nextp = m_freeps[sclass];
+        m_freeps[sclass] = freep;
+    }
+    static size_t chunkBytes() VL_MT_SAFE { return s_chunkBytes.load(std::memory_order_relaxed); }
+};
+
+V3Mutex AstNodeAllocator::s_mutex;
+std::vector<std::unique_ptr<char[]>> AstNodeAllocator::s_chunkps;
+std::atomic<size_t> AstNodeAllocator::s_chunkBytes{0};
+thread_local AstNodeAllocator AstNodeAllocator::t_allocator;
+
+void* AstNode::operator new(size_t size) {
+    return AstNodeAllocator::t_allocator.allocate(size);
+}
+
+void AstNode::operator delete(void* objp, size_t size) {
+    if (!objp) return;
+    AstNodeAllocator::t_allocator.release(objp, size);
+}
+
+size_t AstNode::allocatorBytes() VL_MT_SAFE { return AstNodeAllocator::chunkBytes(); }
 #endif
 
 //======================================================================
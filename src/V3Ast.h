@@ -584,6 +584,7 @@ public:
         SCOPEPTR,
         CHARPTR,
         MTASKSTATE,
+        MTASKSTATE_PADDED,
         TRIGGERVEC,
         DELAY_SCHEDULER,
         TRIGGER_SCHEDULER,
@@ -618,6 +619,7 @@ public:
                                             "VerilatedScope*",
                                             "char*",
                                             "VlMTaskState",
+                                            "VlPaddedMTaskState",
                                             "VlTriggerVec",
                                             "VlDelayScheduler",
                                             "VlTriggerScheduler",
@@ -633,12 +635,14 @@ public:
     }
     const char* dpiType() const {
         static const char* const names[]
-            = {"%E-unk",       "svBit",           "char",          "void*",        "char",
-               "int",          "%E-integer",      "svLogic",       "long long",    "double",
-               "short",        "%E-time",         "const char*",   "%E-untyped",   "dpiScope",
-               "const char*",  "%E-mtaskstate",   "%E-triggervec", "%E-dly-sched", "%E-trig-sched",
-               "%E-dyn-sched", "%E-fork",         "%E-proc-ref",   "%E-rand-gen",  "IData",
-               "QData",        "%E-logic-implct", " MAX"};
+            = {"%E-unk",          "svBit",          "char",          "void*",
+               "char",            "int",            "%E-integer",    "svLogic",
+               "long long",       "double",         "short",         "%E-time",
+               "const char*",     "%E-untyped",     "dpiScope",      "const char*",
+               "%E-mtaskstate",   "%E-mtaskstate",  "%E-triggervec", "%E-dly-sched",
+               "%E-trig-sched",   "%E-dyn-sched",   "%E-fork",       "%E-proc-ref",
+               "%E-rand-gen",     "IData",          "QData",         "%E-logic-implct",
+               " MAX"};
         return names[m_e];
     }
     static void selfTest() {
@@ -672,6 +676,7 @@ public:
         case SCOPEPTR: return 0;  // opaque
         case CHARPTR: return 0;  // opaque
         case MTASKSTATE: return 0;  // opaque
+        case MTASKSTATE_PADDED: return 0;  // opaque
         case TRIGGERVEC: return 0;  // opaque
         case DELAY_SCHEDULER: return 0;  // opaque
         case TRIGGER_SCHEDULER: return 0;  // opaque
@@ -716,15 +721,18 @@ public:
     }
     bool isOpaque() const VL_MT_SAFE {  // IE not a simple number we can bit optimize
         return (m_e == EVENT || m_e == STRING || m_e == SCOPEPTR || m_e == CHARPTR
-                || m_e == MTASKSTATE || m_e == TRIGGERVEC || m_e == DELAY_SCHEDULER
-                || m_e == TRIGGER_SCHEDULER || m_e == DYNAMIC_TRIGGER_SCHEDULER || m_e == FORK_SYNC
+                || m_e == MTASKSTATE || m_e == MTASKSTATE_PADDED || m_e == TRIGGERVEC
+                || m_e == DELAY_SCHEDULER || m_e == TRIGGER_SCHEDULER
+                || m_e == DYNAMIC_TRIGGER_SCHEDULER || m_e == FORK_SYNC
                 || m_e == PROCESS_REFERENCE || m_e == RANDOM_GENERATOR || m_e == DOUBLE
                 || m_e == UNTYPED);
     }
     bool isDouble() const VL_MT_SAFE { return m_e == DOUBLE; }
     bool isEvent() const { return m_e == EVENT; }
     bool isString() const VL_MT_SAFE { return m_e == STRING; }
-    bool isMTaskState() const VL_MT_SAFE { return m_e == MTASKSTATE; }
+    bool isMTaskState() const VL_MT_SAFE {
+        return m_e == MTASKSTATE || m_e == MTASKSTATE_PADDED;
+    }
     // Does this represent a C++ LiteralType? (can be constexpr)
     bool isLiteralType() const VL_MT_SAFE {
         switch (m_e) {
@@ -765,6 +773,7 @@ public:
             /* SCOPEPTR:                  */ "",  // Should not be traced
             /* CHARPTR:                   */ "",  // Should not be traced
             /* MTASKSTATE:                */ "",  // Should not be traced
+            /* MTASKSTATE_PADDED:         */ "",  // Should not be traced
             /* TRIGGERVEC:                */ "",  // Should not be traced
             /* DELAY_SCHEDULER:           */ "",  // Should not be traced
             /* TRIGGER_SCHEDULER:         */ "",  // Should not be traced
@@ -1700,6 +1709,9 @@ class VSelfPointerText final {
     // MEMBERS
     std::shared_ptr<const string> m_strp;
 
+    // Return shared copy of the given text; the same few texts are used by very many refs
+    static std::shared_ptr<const string> intern(const string& text) VL_MT_SAFE;
+
 public:
     // CONSTRUCTORS
     class Empty {};  // for creator type-overload selection
@@ -1709,10 +1721,10 @@ public:
     explicit VSelfPointerText(This)
         : m_strp{s_thisp} {}
     VSelfPointerText(This, const string& field)
-        : m_strp{std::make_shared<const string>("this->" + field)} {}
+        : m_strp{intern("this->" + field)} {}
     class VlSyms {};  // for creator type-overload selection
     VSelfPointerText(VlSyms, const string& field)
-        : m_strp{std::make_shared<const string>("(&vlSymsp->" + field + ')')} {}
+        : m_strp{intern("(&vlSymsp->" + field + ')')} {}
 
     // METHODS
     bool isEmpty() const { return m_strp == s_emptyp; }
@@ -1721,7 +1733,9 @@ public:
     string protect(bool useSelfForThis, bool protect) const;
     static string replaceThis(bool useSelfForThis, const string& text);
     const std::string& asString() const { return *m_strp; }
-    bool operator==(const VSelfPointerText& other) const { return *m_strp == *other.m_strp; }
+    bool operator==(const VSelfPointerText& other) const {
+        return m_strp == other.m_strp || *m_strp == *other.m_strp;
+    }
 };
 
 // ######################################################################
@@ -2199,25 +2213,26 @@ public:
 
     // CONSTRUCTORS
     virtual ~AstNode() = default;
-#ifdef VL_LEAK_CHECKS
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
-#endif
+    // Bytes of memory reserved for allocating nodes
+    static size_t allocatorBytes() VL_MT_SAFE;
 
     // CONSTANTS
     // The following are relative dynamic costs (~ execution cycle count) of various operations.
     // They are used by V3InstCount to estimate the relative execution time of code fragments.
-    static constexpr int INSTR_COUNT_BRANCH = 4;  // Branch
-    static constexpr int INSTR_COUNT_CALL = INSTR_COUNT_BRANCH + 10;  // Subroutine call
-    static constexpr int INSTR_COUNT_LD = 2;  // Load memory
-    static constexpr int INSTR_COUNT_INT_MUL = 3;  // Integer multiply
-    static constexpr int INSTR_COUNT_INT_DIV = 10;  // Integer divide
-    static constexpr int INSTR_COUNT_DBL = 8;  // Convert or do float ops
-    static constexpr int INSTR_COUNT_DBL_DIV = 40;  // Double divide
-    static constexpr int INSTR_COUNT_DBL_TRIG = 200;  // Double trigonometric ops
-    static constexpr int INSTR_COUNT_STR = 100;  // String ops
-    static constexpr int INSTR_COUNT_TIME = INSTR_COUNT_CALL + 5;  // Determine simulation time
-    static constexpr int INSTR_COUNT_PLI = 20;  // PLI routines
+    // Defaults are in V3Ast.cpp; --instr-count-table may override them before any use.
+    static int INSTR_COUNT_BRANCH;  // Branch
+    static int INSTR_COUNT_CALL;  // Subroutine call
+    static int INSTR_COUNT_LD;  // Load memory
+    static int INSTR_COUNT_INT_MUL;  // Integer multiply
+    static int INSTR_COUNT_INT_DIV;  // Integer divide
+    static int INSTR_COUNT_DBL;  // Convert or do float ops
+    static int INSTR_COUNT_DBL_DIV;  // Double divide
+    static int INSTR_COUNT_DBL_TRIG;  // Double trigonometric ops
+    static int INSTR_COUNT_STR;  // String ops
+    static int INSTR_COUNT_TIME;  // Determine simulation time
+    static int INSTR_COUNT_PLI;  // PLI routines
 
     // ACCESSORS
     virtual string name() const VL_MT_STABLE { return ""; }
@@ -325,6 +325,7 @@ class AstAssocArrayDType final : public AstNodeDType {
     //
     // @astgen ptr := m_refDTypep : Optional[AstNodeDType]  // Elements of this type (post-width)
     // @astgen ptr := m_keyDTypep : Optional[AstNodeDType]  // Keys of this type (post-width)
+    bool m_hashed = false;  // Implemented as hash table, never walked in key order
 public:
     AstAssocArrayDType(FileLine* fl, VFlagChildDType, AstNodeDType* dtp, AstNodeDType* keyDtp)
         : ASTGEN_SUPER_AssocArrayDType(fl) {
@@ -350,7 +351,8 @@ public:
         const AstAssocArrayDType* const asamep = VN_DBG_AS(samep, AssocArrayDType);
         if (!asamep->subDTypep()) return false;
         if (!asamep->keyDTypep()) return false;
-        return (subDTypep() == asamep->subDTypep() && keyDTypep() == asamep->keyDTypep());
+        return (subDTypep() == asamep->subDTypep() && keyDTypep() == asamep->keyDTypep()
+                && hashed() == asamep->hashed());
     }
     bool similarDTypeNode(const AstNodeDType* samep) const override {
         const AstAssocArrayDType* const asamep = VN_DBG_AS(samep, AssocArrayDType);
@@ -378,6 +380,8 @@ public:
         return m_keyDTypep ? m_keyDTypep : keyChildDTypep();
     }
     void keyDTypep(AstNodeDType* nodep) { m_keyDTypep = nodep; }
+    bool hashed() const { return m_hashed; }
+    void hashed(bool flag) { m_hashed = flag; }
     // METHODS
     AstBasicDType* basicp() const override VL_MT_STABLE { return nullptr; }
     int widthAlignBytes() const override { return subDTypep()->widthAlignBytes(); }
@@ -1382,6 +1386,7 @@ public:
 class AstUnpackArrayDType final : public AstNodeArrayDType {
     // Array data type, ie "some_dtype var_name [2:0]"
     bool m_isCompound = false;  // Non-POD subDType, or parent requires compound
+    bool m_isSparse = false;  // Stored as lazily allocated pages, see V3Common
 public:
     AstUnpackArrayDType(FileLine* fl, VFlagChildDType, AstNodeDType* dtp, AstRange* rangep)
         : ASTGEN_SUPER_UnpackArrayDType(fl) {
@@ -1406,13 +1411,15 @@ public:
     string prettyDTypeName(bool full) const override;
     bool sameNode(const AstNode* samep) const override {
         const AstUnpackArrayDType* const sp = VN_DBG_AS(samep, UnpackArrayDType);
-        return m_isCompound == sp->m_isCompound;
+        return m_isCompound == sp->m_isCompound && m_isSparse == sp->m_isSparse;
     }
     bool isAggregateType() const override { return true; }
     // Outer dimension comes first. The first element is this node.
     std::vector<AstUnpackArrayDType*> unpackDimensions();
     void isCompound(bool flag) { m_isCompound = flag; }
     bool isCompound() const override VL_MT_SAFE { return m_isCompound; }
+    void isSparse(bool flag) { m_isSparse = flag; }
+    bool isSparse() const { return m_isSparse; }
     bool isIntegralOrPacked() const override { return false; }
 };
 
@@ -1993,6 +1993,7 @@ class AstVar final : public AstNode {
     bool m_ignorePostRead : 1;  // Ignore reads in 'Post' blocks during ordering
     bool m_ignorePostWrite : 1;  // Ignore writes in 'Post' blocks during ordering
     bool m_ignoreSchedWrite : 1;  // Ignore writes in scheduling (for special optimizations)
+    bool m_cacheLineAlign : 1;  // Emit aligned to a cache line, starts a writer thread group
 
     void init() {
         m_ansi = false;
@@ -2040,6 +2041,7 @@ class AstVar final : public AstNode {
         m_ignorePostRead = false;
         m_ignorePostWrite = false;
         m_ignoreSchedWrite = false;
+        m_cacheLineAlign = false;
         m_attrClocker = VVarAttrClocker::CLOCKER_UNKNOWN;
     }
 
@@ -2201,6 +2203,8 @@ public:
     void setIgnorePostWrite() { m_ignorePostWrite = true; }
     bool ignoreSchedWrite() const { return m_ignoreSchedWrite; }
     void setIgnoreSchedWrite() { m_ignoreSchedWrite = true; }
+    bool cacheLineAlign() const { return m_cacheLineAlign; }
+    void setCacheLineAlign() { m_cacheLineAlign = true; }
 
     // METHODS
     void name(const string& name) override { m_name = name; }
@@ -3050,16 +3054,35 @@ public:
     bool isPure() override { return false; }
     AstCoverDecl* declp() const { return m_declp; }  // Where defined
 };
+class AstCoverIncBits final : public AstNodeStmt {
+    // Increment the coverage count of each point whose bit is set in bitsp
+    // Parents:  {statement list}
+    // @astgen op1 := bitsp : AstNodeExpr  // Clean, at most 64 bits
+    // @astgen op2 := incsp : List[AstCoverInc]  // One per bit of bitsp, LSB first
+public:
+    AstCoverIncBits(FileLine* fl, AstNodeExpr* bitsp, AstCoverInc* incsp)
+        : ASTGEN_SUPER_CoverIncBits(fl) {
+        this->bitsp(bitsp);
+        addIncsp(incsp);
+    }
+    ASTGEN_MEMBERS_AstCoverIncBits;
+    int instrCount() const override { return 4 + INSTR_COUNT_BRANCH; }
+    bool sameNode(const AstNode* /*samep*/) const override { return true; }
+    bool isGateOptimizable() const override { return false; }
+    bool isPredictOptimizable() const override { return false; }
+    bool isOutputter() override { return true; }
+    bool isPure() override { return false; }
+};
 class AstCoverToggle final : public AstNodeStmt {
     // Toggle analysis of given signal
     // Parents:  MODULE
-    // @astgen op1 := incp : AstCoverInc
+    // @astgen op1 := incsp : List[AstCoverInc]  // One per bit of origp, LSB first
     // @astgen op2 := origp : AstNodeExpr
     // @astgen op3 := changep : AstNodeExpr
 public:
-    AstCoverToggle(FileLine* fl, AstCoverInc* incp, AstNodeExpr* origp, AstNodeExpr* changep)
+    AstCoverToggle(FileLine* fl, AstCoverInc* incsp, AstNodeExpr* origp, AstNodeExpr* changep)
         : ASTGEN_SUPER_CoverToggle(fl) {
-        this->incp(incp);
+        addIncsp(incsp);
         this->origp(origp);
         this->changep(changep);
     }
@@ -3737,6 +3760,7 @@ class AstWhile final : public AstNodeStmt {
     // @astgen op3 := stmtsp : List[AstNode]
     // @astgen op4 := incsp : List[AstNode]
     VOptionBool m_unrollFull;  // Full, disable, or default unrolling
+    bool m_independent = false;  // Iterations do not alias each other, may vectorize
 public:
     AstWhile(FileLine* fl, AstNodeExpr* condp, AstNode* stmtsp = nullptr, AstNode* incsp = nullptr)
         : ASTGEN_SUPER_While(fl) {
@@ -3748,12 +3772,16 @@ public:
     void dump(std::ostream& str) const override;
     bool isGateOptimizable() const override { return false; }
     int instrCount() const override { return INSTR_COUNT_BRANCH; }
-    bool sameNode(const AstNode* /*samep*/) const override { return true; }
+    bool sameNode(const AstNode* samep) const override {
+        return m_independent == VN_DBG_AS(samep, While)->m_independent;
+    }
     // Stop statement searchback here
     void addNextStmt(AstNode* newp, AstNode* belowp) override;
     bool isFirstInMyListOfStatements(AstNode* n) const override { return n == stmtsp(); }
     VOptionBool unrollFull() const { return m_unrollFull; }
     void unrollFull(const VOptionBool flag) { m_unrollFull = flag; }
+    bool independent() const { return m_independent; }
+    void independent(bool flag) { m_independent = flag; }
 };
 
 // === AstNodeAssign ===
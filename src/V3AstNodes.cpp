@@ -46,9 +46,15 @@ void AstNode::dumpJsonStr(std::ostream& os, const std::string& name, const std::
 }
 void AstNode::dumpJsonPtr(std::ostream& os, const std::string& name, const AstNode* const valp) {
     v3Global.saveJsonPtrFieldName(name);
-    std::string addr = "UNLINKED";
-    if (valp) addr = (v3Global.opt.jsonIds() ? v3Global.ptrToId(valp) : cvtToHex(valp));
-    os << ",\"" << name << "\":\"" << addr << '"';
+    os << ",\"" << name << "\":\"";
+    if (!valp) {
+        os << "UNLINKED";
+    } else if (v3Global.opt.jsonIds()) {
+        os << v3Global.ptrToId(valp);  // Without copying the interned id
+    } else {
+        os << cvtToHex(valp);
+    }
+    os << '"';
 }
 
 // Shorthands for dumping fields that use func name as key
@@ -908,7 +914,8 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         const CTypeRecursed key = adtypep->keyDTypep()->cTypeRecurse(true, false);
         const CTypeRecursed val = adtypep->subDTypep()->cTypeRecurse(true, false);
-        info.m_type = "VlAssocArray<" + key.m_type + ", " + val.m_type + ">";
+        info.m_type = "VlAssocArray<" + key.m_type + ", " + val.m_type
+                      + (adtypep->hashed() ? ", true>" : ">");
     } else if (const auto* const adtypep = VN_CAST(dtypep, CDType)) {
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         info.m_type = adtypep->name();
@@ -941,7 +948,7 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         if (adtypep->isCompound()) compound = true;
         const CTypeRecursed sub = adtypep->subDTypep()->cTypeRecurse(compound, false);
-        info.m_type = "VlUnpacked<" + sub.m_type;
+        info.m_type = (adtypep->isSparse() ? "VlSparseArray<" : "VlUnpacked<") + sub.m_type;
         info.m_type += ", " + cvtToStr(adtypep->declRange().elements());
         info.m_type += ">";
     } else if (const auto* const adtypep = VN_CAST(dtypep, NBACommitQueueDType)) {
@@ -985,6 +992,8 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
             info.m_type = "double";
         } else if (bdtypep->keyword().isString()) {
             info.m_type = "std::string";
+        } else if (bdtypep->keyword() == VBasicDTypeKwd::MTASKSTATE_PADDED) {
+            info.m_type = "VlPaddedMTaskVertex";
         } else if (bdtypep->keyword().isMTaskState()) {
             info.m_type = "VlMTaskVertex";
         } else if (bdtypep->isTriggerVec()) {
@@ -1569,9 +1578,11 @@ void dumpNodeListJson(std::ostream& os, const AstNode* nodep, const std::string&
     if (!nodep) {  // empty list, print inline
         os << '"' << listName << "\": []";
     } else {
-        os << '\n' << indent + " \"" << listName << "\": [\n";
+        os << '\n' << indent << " \"" << listName << "\": [\n";
+        // Build the indent once per list, not once per node, as lists can be huge
+        const string childIndent = indent + "  ";
         for (; nodep; nodep = nodep->nextp()) {
-            nodep->dumpTreeJson(os, indent + "  ");
+            nodep->dumpTreeJson(os, childIndent);
             if (nodep->nextp()) os << ',';
             os << '\n';
         }
@@ -1912,6 +1923,14 @@ void AstIfaceRefDType::dumpSmall(std::ostream& str) const {
     this->AstNodeDType::dumpSmall(str);
     str << "iface";
 }
+void AstImplication::dump(std::ostream& str) const {
+    this->AstNodeExpr::dump(str);
+    if (isOverlapped()) str << " [OVERLAPPED]";
+}
+void AstImplication::dumpJson(std::ostream& str) const {
+    dumpJsonBoolFunc(str, isOverlapped);
+    dumpJsonGen(str);
+}
 void AstInitArray::dumpInitList(std::ostream& str) const {
     int n = 0;
     const auto& mapr = map();
@@ -2260,6 +2279,9 @@ void AstNodeArrayDType::dumpSmall(std::ostream& str) const {
 void AstNodeArrayDType::dump(std::ostream& str) const {
     this->AstNodeDType::dump(str);
     if (isCompound()) str << " [COMPOUND]";
+    if (const AstUnpackArrayDType* const adtypep = VN_CAST(this, UnpackArrayDType)) {
+        if (adtypep->isSparse()) str << " [SPARSE]";
+    }
     str << " " << declRange();
 }
 void AstNodeArrayDType::dumpJson(std::ostream& str) const {
@@ -2446,6 +2468,7 @@ void AstTypeTable::dumpJson(std::ostream& str) const { dumpJsonGen(str); }
 void AstAssocArrayDType::dumpSmall(std::ostream& str) const {
     this->AstNodeDType::dumpSmall(str);
     str << "[assoc-" << nodeAddr(keyDTypep()) << "]";
+    if (hashed()) str << "[HASH]";
 }
 string AstAssocArrayDType::prettyDTypeName(bool full) const {
     return subDTypep()->prettyDTypeName(full) + "$[" + keyDTypep()->prettyDTypeName(full) + "]";
@@ -2619,6 +2642,7 @@ void AstVar::dump(std::ostream& str) const {
     if (isDpiOpenArray()) str << " [DPIOPENA]";
     if (ignorePostWrite()) str << " [IGNPWR]";
     if (ignoreSchedWrite()) str << " [IGNWR]";
+    if (cacheLineAlign()) str << " [CLALIGN]";
     if (!attrClocker().unknown()) str << " [" << attrClocker().ascii() << "] ";
     if (!lifetime().isNone()) str << " [" << lifetime().ascii() << "] ";
     str << " " << varType();
@@ -2665,6 +2689,15 @@ void AstWhile::dump(std::ostream& str) const {
         str << " [unrollfull]";
     else if (unrollFull().isSetFalse())
         str << " [unrolldis]";
+    if (independent()) str << " [independent]";
+}
+void AstSampled::dump(std::ostream& str) const {
+    this->AstNodeExpr::dump(str);
+    if (assertOnly()) str << " [ASSERTONLY]";
+}
+void AstSampled::dumpJson(std::ostream& str) const {
+    dumpJsonBoolFunc(str, assertOnly);
+    dumpJsonGen(str);
 }
 void AstScope::dump(std::ostream& str) const {
     this->AstNode::dump(str);
@@ -2893,6 +2926,16 @@ void AstCoverInc::dump(std::ostream& str) const {
     }
 }
 void AstCoverInc::dumpJson(std::ostream& str) const { dumpJsonGen(str); }
+void AstCoverHit::dump(std::ostream& str) const {
+    this->AstNodeExpr::dump(str);
+    str << " -> ";
+    if (declp()) {
+        declp()->dump(str);
+    } else {
+        str << "%E:UNLINKED";
+    }
+}
+void AstCoverHit::dumpJson(std::ostream& str) const { dumpJsonGen(str); }
 void AstFork::dump(std::ostream& str) const {
     this->AstNodeBlock::dump(str);
     if (!joinType().join()) str << " [" << joinType() << "]";
@@ -24,9 +24,9 @@
 //                                                  (other items))
 //                                              body
 //              Or, converts to a if/else tree.
+//              Or, for wide cases of plain constants (address muxes), sorts
+//              the values into ranges and converts to a tree of < compares.
 //      FUTURES:
-//          Large 16+ bit tables with constants and no masking (address muxes)
-//              Enter all into std::multimap, sort by value and use a tree of < and == compares.
 //          "Diagonal" find of {rightmost,leftmost} bit {set,clear}
 //              Ignoring mask, check each value is unique (using std::multimap as above?)
 //              Each branch is then mask-and-compare operation (IE
@@ -45,6 +45,9 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 #define CASE_OVERLAP_WIDTH 16  // Maximum width we can check for overlaps in
 #define CASE_BARF 999999  // Magic width when non-constant
 #define CASE_ENCODER_GROUP_DEPTH 8  // Levels of priority to be ORed together in top IF tree
+#define CASE_TREE_MIN_VALUES 8  // Minimum values in a wide case to make a search tree
+#define CASE_TREE_LEAF_RANGES 2  // Ranges compared in turn at each search tree leaf
+#define CASE_TREE_GROWTH 4  // Maximum statement growth from cloning into search tree leaves
 
 //######################################################################
 
@@ -122,6 +125,7 @@ class CaseVisitor final : public VNVisitor {
     // STATE
     VDouble0 m_statCaseFast;  // Statistic tracking
     VDouble0 m_statCaseSlow;  // Statistic tracking
+    VDouble0 m_statCaseTree;  // Statistic tracking
     const AstNode* m_alwaysp = nullptr;  // Always in which case is located
 
     // Per-CASE
@@ -130,6 +134,14 @@ class CaseVisitor final : public VNVisitor {
     bool m_caseNoOverlapsAllCovered = false;  // Proven to be synopsys parallel_case compliant
     // For each possible value, the case branch we need
     std::array<AstNode*, 1 << CASE_OVERLAP_WIDTH> m_valueItem;
+    // For search trees, sorted runs of consecutive values selecting the same branch
+    struct CaseRange final {
+        uint64_t m_lo;  // First value in range
+        uint64_t m_hi;  // Last value in range, inclusive
+        AstCaseItem* m_itemp;  // Case item selected by the range
+    };
+    std::vector<CaseRange> m_caseRanges;
+    AstCaseItem* m_caseDefaultp = nullptr;  // Default item, if any, for the search tree
 
     // METHODS
     //! Determine whether we should check case items are complete
@@ -399,6 +411,111 @@ class CaseVisitor final : public VNVisitor {
         if (debug() >= 9) ifrootp->dumpTree("-    _simp: ");
     }
 
+    static size_t stmtsCount(const AstNode* stmtsp) {
+        size_t count = 0;
+        if (stmtsp) stmtsp->foreachAndNext([&count](const AstNode*) { ++count; });
+        return count;
+    }
+
+    bool isCaseTreeSearch(AstCase* nodep) {
+        // Wide case of plain constants, too wide for the isCaseTreeFast value table
+        const AstNodeExpr* const cexprp = nodep->exprp();
+        if (m_caseWidth <= CASE_OVERLAP_WIDTH || m_caseWidth == CASE_BARF) return false;
+        if (cexprp->width() > VL_QUADSIZE || cexprp->isDouble()) return false;
+        std::map<uint64_t, AstCaseItem*> valueItems;  // Value -> first item matching it
+        m_caseDefaultp = nullptr;
+        size_t origCount = 0;
+        for (AstCaseItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), CaseItem)) {
+            origCount += stmtsCount(itemp->stmtsp());
+            if (itemp->isDefault()) m_caseDefaultp = itemp;
+            for (AstNode* icondp = itemp->condsp(); icondp; icondp = icondp->nextp()) {
+                AstConst* const iconstp = VN_CAST(icondp, Const);
+                if (!iconstp) return false;
+                if (neverItem(nodep, iconstp)) continue;  // X in casez can't ever be executed
+                if (iconstp->num().isFourState()) return false;  // Wildcard, needs masking
+                // Earlier items have priority, so keep the first for each value
+                valueItems.emplace(iconstp->num().toUQuad(), itemp);
+            }
+        }
+        if (valueItems.size() < CASE_TREE_MIN_VALUES) return false;
+        m_caseRanges.clear();
+        for (const auto& pair : valueItems) {
+            if (!m_caseRanges.empty() && m_caseRanges.back().m_itemp == pair.second
+                && m_caseRanges.back().m_hi + 1 == pair.first) {
+                m_caseRanges.back().m_hi = pair.first;
+            } else {
+                m_caseRanges.push_back({pair.first, pair.first, pair.second});
+            }
+        }
+        // Each range clones its item's statements, and each leaf the default's
+        size_t treeCount = 0;
+        for (const CaseRange& range : m_caseRanges) {
+            treeCount += stmtsCount(range.m_itemp->stmtsp());
+        }
+        if (m_caseDefaultp) {
+            const size_t leaves
+                = (m_caseRanges.size() + CASE_TREE_LEAF_RANGES - 1) / CASE_TREE_LEAF_RANGES;
+            treeCount += leaves * stmtsCount(m_caseDefaultp->stmtsp());
+        }
+        return treeCount <= CASE_TREE_GROWTH * origCount;
+    }
+
+    static AstNode* newCaseStmts(AstCaseItem* itemp) {
+        return itemp && itemp->stmtsp() ? itemp->stmtsp()->cloneTree(true) : nullptr;
+    }
+    static AstConst* newCaseValue(AstNodeExpr* cexprp, uint64_t value) {
+        V3Number num{cexprp, cexprp->width()};
+        num.setQuad(value);
+        return new AstConst{cexprp->fileline(), num};
+    }
+
+    AstNode* replaceCaseTreeRecurse(AstNodeExpr* cexprp, size_t lo, size_t hi) {
+        // Build the search tree for m_caseRanges[lo, hi)
+        FileLine* const flp = cexprp->fileline();
+        if (hi - lo <= CASE_TREE_LEAF_RANGES) {
+            // Few enough ranges to test each in turn, falling through to the default
+            AstNode* resultp = newCaseStmts(m_caseDefaultp);
+            for (size_t i = hi; i-- > lo;) {
+                const CaseRange& range = m_caseRanges[i];
+                AstNodeExpr* condp;
+                if (range.m_lo == range.m_hi) {
+                    condp = AstEq::newTyped(flp, cexprp->cloneTreePure(false),
+                                            newCaseValue(cexprp, range.m_lo));
+                } else {
+                    condp = new AstLogAnd{
+                        flp,
+                        new AstGte{flp, cexprp->cloneTreePure(false),
+                                   newCaseValue(cexprp, range.m_lo)},
+                        new AstLte{flp, cexprp->cloneTreePure(false),
+                                   newCaseValue(cexprp, range.m_hi)}};
+                }
+                resultp = new AstIf{flp, condp, newCaseStmts(range.m_itemp), resultp};
+            }
+            return resultp;
+        }
+        const size_t mid = lo + (hi - lo) / 2;
+        AstNodeExpr* const condp = new AstLt{flp, cexprp->cloneTreePure(false),
+                                             newCaseValue(cexprp, m_caseRanges[mid].m_lo)};
+        return new AstIf{flp, condp, replaceCaseTreeRecurse(cexprp, lo, mid),
+                         replaceCaseTreeRecurse(cexprp, mid, hi)};
+    }
+
+    void replaceCaseTree(AstCase* nodep) {
+        // CASE(cexpr, ITEM(v0..v3, s0), ITEM(v4, s1), ..., ITEM(default, sd))
+        // ->  IF(cexpr < v4, IF(cexpr >= v0 && cexpr <= v3, s0, ...),
+        //                    IF(cexpr == v4, s1, ..., sd))
+        AstNodeExpr* const cexprp = nodep->exprp()->unlinkFrBack();
+        // Handle any assertions
+        replaceCaseParallel(nodep, false);
+        AstNode* const ifrootp = replaceCaseTreeRecurse(cexprp, 0, m_caseRanges.size());
+        if (debug() >= 9) ifrootp->dumpTree("-    _tree: ");
+        nodep->replaceWith(ifrootp);
+        VL_DO_DANGLING(nodep->deleteTree(), nodep);
+        VL_DO_DANGLING(cexprp->deleteTree(), cexprp);
+        m_caseRanges.clear();
+    }
+
     void replaceCaseComplicated(AstCase* nodep) {
         // CASEx(cexpr,ITEM(icond1,istmts1),ITEM(icond2,istmts2),ITEM(default,istmts3))
         // ->  IF((cexpr==icond1),istmts1,
@@ -569,6 +686,11 @@ class CaseVisitor final : public VNVisitor {
             // we can make a tree of statements to avoid extra comparisons
             ++m_statCaseFast;
             VL_DO_DANGLING(replaceCaseFast(nodep), nodep);
+        } else if (v3Global.opt.fCase() && isCaseTreeSearch(nodep)) {
+            // Wide case of constants, binary search the sorted values
+            if (m_alwaysp) m_alwaysp->fileline()->warnOff(V3ErrorCode::LATCH, true);
+            ++m_statCaseTree;
+            VL_DO_DANGLING(replaceCaseTree(nodep), nodep);
         } else {
             // If a case statement is whole, presume signals involved aren't forming a latch
             if (m_alwaysp) m_alwaysp->fileline()->warnOff(V3ErrorCode::LATCH, true);
@@ -593,6 +715,7 @@ public:
     ~CaseVisitor() override {
         V3Stats::addStat("Optimizations, Cases parallelized", m_statCaseFast);
         V3Stats::addStat("Optimizations, Cases complex", m_statCaseSlow);
+        V3Stats::addStat("Optimizations, Cases search tree", m_statCaseTree);
     }
 };
 
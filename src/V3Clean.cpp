@@ -274,6 +274,10 @@ class CleanVisitor final : public VNVisitor {
         iterateChildren(nodep);
         ensureClean(nodep->condp());
     }
+    void visit(AstCoverIncBits* nodep) override {
+        iterateChildren(nodep);
+        ensureClean(nodep->bitsp());
+    }
     void visit(AstSFormatF* nodep) override {
         iterateChildren(nodep);
         ensureCleanAndNext(nodep->exprsp());
@@ -73,6 +73,7 @@ class ClockVisitor final : public VNVisitor {
     AstCFunc* const m_evalp = nullptr;  // The '_eval' function
     AstSenTree* m_lastSenp = nullptr;  // Last sensitivity match, so we can detect duplicates.
     AstIf* m_lastIfp = nullptr;  // Last sensitivity if active to add more under
+    AstIf* m_sampledGatedIfp = nullptr;  // If updating sampled values while assertions are on
 
     // METHODS
 
@@ -100,7 +101,10 @@ class ClockVisitor final : public VNVisitor {
         // if (debug()) nodep->dumpTree("-  ct: ");
         // COVERTOGGLE(INC, ORIG, CHANGE) ->
         //   IF(ORIG ^ CHANGE) { INC; CHANGE = ORIG; }
-        AstNode* const incp = nodep->incp()->unlinkFrBack();
+        // COVERTOGGLE(INC0 INC1 ..., ORIG, CHANGE) ->
+        //   IF(ORIG ^ CHANGE) { COVERINCBITS(ORIG ^ CHANGE, INC0 INC1 ...); CHANGE = ORIG; }
+        AstCoverInc* const incsp = nodep->incsp()->unlinkFrBackWithNext();
+        AstNode* incp = incsp;
         AstNodeExpr* const origp = nodep->origp()->unlinkFrBack();
         AstNodeExpr* const changeWrp = nodep->changep()->unlinkFrBack();
         AstNodeExpr* const changeRdp = ConvertWriteRefsToRead::main(changeWrp->cloneTree(false));
@@ -112,12 +116,29 @@ class ClockVisitor final : public VNVisitor {
             if (!bdtypep->isOpaque()) comparedp = new AstXor{nodep->fileline(), origp, changeRdp};
         }
         if (!comparedp) comparedp = AstEq::newTyped(nodep->fileline(), origp, changeRdp);
+        if (incsp->nextp()) {
+            // Multi-bit, only bump the points whose bits changed
+            UASSERT_OBJ(VN_IS(comparedp, Xor), nodep, "Multi-bit toggle of opaque type");
+            incp = new AstCoverIncBits{nodep->fileline(), comparedp->cloneTree(false), incsp};
+        }
         AstIf* const newp = new AstIf{nodep->fileline(), comparedp, incp};
         // We could add another IF to detect posedges, and only increment if so.
         // It's another whole branch though versus a potential memory miss.
         // We'll go with the miss.
         newp->addThensp(new AstAssign{nodep->fileline(), changeWrp, origp->cloneTree(false)});
-        nodep->replaceWith(newp);
+        if (v3Global.opt.coverageHitOnce() && !incsp->nextp()) {
+            // Once the flag is set there is nothing more to record, so skip the compare:
+            //   IF(!HIT) { IF(ORIG ^ CHANGE) { INC; CHANGE = ORIG; } }
+            // (Multi-bit toggles must still look at each bit, and CoverIncBits does so)
+            AstCoverDecl* const declp = incsp->declp();
+            AstIf* const hitIfp = new AstIf{
+                nodep->fileline(),
+                new AstLogNot{nodep->fileline(), new AstCoverHit{nodep->fileline(), declp}},
+                newp};
+            nodep->replaceWith(hitIfp);
+        } else {
+            nodep->replaceWith(newp);
+        }
         VL_DO_DANGLING(nodep->deleteTree(), nodep);
     }
     void visit(AstSenTree* nodep) override {
@@ -162,9 +183,21 @@ class ClockVisitor final : public VNVisitor {
     void visit(AstVarScope* nodep) override {
         AstVar* varp = nodep->varp();
         if (varp->valuep() && varp->name().substr(0, strlen("__Vsampled")) == "__Vsampled") {
-            m_evalp->addInitsp(new AstAssign{
+            AstAssign* const assignp = new AstAssign{
                 nodep->fileline(), new AstVarRef{nodep->fileline(), nodep, VAccess::WRITE},
-                VN_AS(varp->valuep()->unlinkFrBack(), NodeExpr)});
+                VN_AS(varp->valuep()->unlinkFrBack(), NodeExpr)};
+            if (VString::startsWith(varp->name(), "__VsampledGated_")) {
+                // Only read by assertions, so need no update while all are off
+                if (!m_sampledGatedIfp) {
+                    FileLine* const flp = m_evalp->fileline();
+                    m_sampledGatedIfp = new AstIf{
+                        flp, new AstCExpr{flp, "vlSymsp->_vm_contextp__->assertOn()", 1}};
+                    m_evalp->addInitsp(m_sampledGatedIfp);
+                }
+                m_sampledGatedIfp->addThensp(assignp);
+            } else {
+                m_evalp->addInitsp(assignp);
+            }
             varp->direction(VDirection::NONE);  // Restore defaults
             varp->primaryIO(false);
         }
@@ -0,0 +1,172 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Outline cold branches into slow functions
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3ColdSplit's Transformations:
+//
+// Each fast function:
+//      For each IF branch that is unlikely to be taken, either according
+//      to the branch prediction, or because it contains $stop, $display
+//      or similar, move the branch body into a new slow CFunc, and call
+//      that instead. This keeps assertion and message code out of the
+//      hot functions, so they are denser in the instruction cache.
+//
+//      Must be after V3Localize, so branches referencing function locals
+//      are left alone rather than keeping variables from being localized.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3ColdSplit.h"
+
+#include "V3EmitCBase.h"
+#include "V3InstrCount.h"
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class ColdSplitVisitor final : public VNVisitor {
+    // Branches cheaper than this are not worth the call overhead
+    static constexpr uint32_t MIN_INSTR_COUNT = 20;
+
+    // STATE - for current visit position (use VL_RESTORER)
+    const AstNodeModule* m_modp = nullptr;  // Current module
+    AstCFunc* m_cfuncp = nullptr;  // Current function
+    int m_coldNum = 0;  // How many functions made from current function
+
+    // STATE - across all visitors
+    VDouble0 m_statOutlined;  // Number of branches outlined
+
+    // METHODS
+
+    // True if the statements contain something that makes the branch unlikely
+    static bool hasUnlikely(AstNode* stmtsp) {
+        bool found = false;
+        stmtsp->foreachAndNext([&](const AstNode* nodep) {
+            if (nodep->isUnlikely()) found = true;
+        });
+        return found;
+    }
+
+    // True if the statements can be moved into a separate function
+    static bool isMovable(AstNode* stmtsp) {
+        bool movable = true;
+        stmtsp->foreachAndNext([&](const AstNode* nodep) {
+            if (!movable) return;
+            // Jumps and returns are relative to the current function, text
+            // and coroutines might depend on the function's context
+            if (VN_IS(nodep, JumpGo) || VN_IS(nodep, CReturn) || VN_IS(nodep, CAwait)
+                || VN_IS(nodep, NodeSimpleText) || VN_IS(nodep, TextBlock)
+                || VN_IS(nodep, TraceInc)
+                || (VN_IS(nodep, NodeCCall) && VN_AS(nodep, NodeCCall)->funcp()->isCoroutine())) {
+                movable = false;
+            } else if (const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef)) {
+                if (refp->varp()->isFuncLocal()) movable = false;
+            }
+        });
+        return movable;
+    }
+
+    static uint32_t instrCount(AstNode* stmtsp) {
+        uint32_t count = 0;
+        for (AstNode* nodep = stmtsp; nodep; nodep = nodep->nextp()) {
+            count += V3InstrCount::count(nodep, false);
+        }
+        return count;
+    }
+
+    bool isCold(AstNode* stmtsp, AstNode* otherp, bool predicted) {
+        if (!stmtsp) return false;
+        if (!predicted && (!hasUnlikely(stmtsp) || (otherp && hasUnlikely(otherp)))) {
+            return false;
+        }
+        return isMovable(stmtsp) && instrCount(stmtsp) >= MIN_INSTR_COUNT;
+    }
+
+    AstNode* createColdFunc(AstNode* stmtsp) {
+        FileLine* const flp = stmtsp->fileline();
+        stmtsp->unlinkFrBackWithNext();
+        // Create sub function
+        AstScope* const scopep = m_cfuncp->scopep();
+        const string name = m_cfuncp->name() + "__cold" + cvtToStr(++m_coldNum);
+        AstCFunc* const funcp = new AstCFunc{flp, name, scopep};
+        funcp->slow(true);
+        funcp->isStatic(m_cfuncp->isStatic());
+        funcp->isLoose(m_cfuncp->isLoose());
+        funcp->addStmtsp(stmtsp);
+        scopep->addBlocksp(funcp);
+        // Call sub function in place of the body
+        AstCCall* const callp = new AstCCall{flp, funcp};
+        callp->dtypeSetVoid();
+        if (VN_IS(m_modp, Class)) {
+            funcp->argTypes(EmitCBase::symClassVar());
+            callp->argTypes("vlSymsp");
+        }
+        UINFO(6, "      New " << callp);
+        ++m_statOutlined;
+        return callp->makeStmt();
+    }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        m_modp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstCFunc* nodep) override {
+        // Already cold, or might be suspended
+        if (nodep->slow() || nodep->isCoroutine() || !nodep->scopep()) return;
+        VL_RESTORER(m_cfuncp);
+        VL_RESTORER(m_coldNum);
+        m_cfuncp = nodep;
+        m_coldNum = 0;
+        iterateChildren(nodep);
+    }
+    void visit(AstIf* nodep) override {
+        if (!m_cfuncp) return;
+        const VBranchPred pred = nodep->branchPred();
+        if (isCold(nodep->thensp(), nodep->elsesp(), pred.unlikely())) {
+            nodep->addThensp(createColdFunc(nodep->thensp()));
+        } else {
+            iterateAndNextNull(nodep->thensp());
+        }
+        if (isCold(nodep->elsesp(), nodep->thensp(), pred.likely())) {
+            nodep->addElsesp(createColdFunc(nodep->elsesp()));
+        } else {
+            iterateAndNextNull(nodep->elsesp());
+        }
+    }
+    void visit(AstNodeExpr*) override {}  // Accelerate
+    void visit(AstVar*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit ColdSplitVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~ColdSplitVisitor() override {
+        V3Stats::addStat("Optimizations, Cold split branches", m_statOutlined);
+    }
+};
+
+//######################################################################
+// ColdSplit class functions
+
+void V3ColdSplit::coldSplitAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { ColdSplitVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("coldsplit", 0, dumpTreeEitherLevel() >= 3);
+}
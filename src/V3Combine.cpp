@@ -17,6 +17,11 @@
 //
 //      Combine identical CFuncs by retaining only a single copy
 //      Also drop empty CFuncs
+//
+//      Functions are only combined within a module. Functions of different
+//      modules are members of different classes, referencing their own
+//      class's state, so even a body identical across two modules cannot be
+//      shared without making both classes share one layout.
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -53,6 +58,7 @@ class CombineVisitor final : VNVisitor {
     AstUser1Allocator<AstCFunc, std::vector<AstCCall*>> m_callSites;  // Call sites of the AstCFunc
     AstNodeModule* m_modp = nullptr;  // Current module
     const V3Hasher m_hasher;  // For hashing
+    const bool m_doExpensiveChecks = v3Global.opt.debugCheck();  // Re-hash to verify
     VDouble0 m_cfuncsCombined;  // Statistic tracking
 
     // METHODS
@@ -124,15 +130,17 @@ class CombineVisitor final : VNVisitor {
                 // Redirect the calls
                 for (AstCCall* const callp : m_callSites(oldp)) {
                     // For sanity check only
-                    const V3Hash oldHash = m_hasher(callp);
+                    const V3Hash oldHash = m_doExpensiveChecks ? m_hasher(callp) : V3Hash{};
 
                     // Redirect the call
                     callp->funcp(newp);
 
                     // When redirecting a call to an equivalent function, we do not need to re-hash
                     // the caller, because the hash of the two calls must be the same, and hence
-                    // the hash of the caller should not change.
-                    UASSERT_OBJ(oldHash == m_hasher.rehash(callp), callp, "Hash changed");
+                    // the hash of the caller should not change. So the cached hashes of the
+                    // caller stay valid, and only --debug-check pays for re-hashing to confirm.
+                    UASSERT_OBJ(!m_doExpensiveChecks || oldHash == m_hasher.rehash(callp), callp,
+                                "Hash changed");
                 }
 
                 // Erase the replaced duplicate
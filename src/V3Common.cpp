@@ -17,6 +17,8 @@
 //
 //  Each class:
 //      Create string access functions
+//  Each huge unpacked array accessed only by element:
+//      Mark as sparse
 //
 //*************************************************************************
 
@@ -26,6 +28,10 @@
 
 #include "V3EmitCBase.h"
 
+#include <map>
+#include <set>
+#include <vector>
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 //######################################################################
@@ -153,6 +159,94 @@ static void makeToStringMiddle(AstClass* nodep) {
     nodep->addStmtsp(funcp);
 }
 
+// Use hash tables for associative arrays with integral keys that are never walked in key order.
+// All arrays of the same C++ type must agree, as they can be assigned to each other.
+static void markHashedAssocArrays() {
+    // Arrays by C++ type, computed before any are marked
+    std::map<std::string, std::vector<AstAssocArrayDType*>> groups;
+    std::set<std::string> ordered;  // C++ types that are walked in order, or not integral
+    v3Global.rootp()->foreach([&](AstAssocArrayDType* dtypep) {
+        const std::string ctype = dtypep->cType("", false, false);
+        groups[ctype].push_back(dtypep);
+        const AstNodeDType* const keyp = dtypep->keyDTypep()->skipRefp();
+        if (!(VN_IS(keyp, BasicDType) || VN_IS(keyp, EnumDType))
+            || !keyp->basicp()->keyword().isIntNumeric()) {
+            ordered.insert(ctype);
+        }
+    });
+    // Foreach loops are lowered to first/next calls by now
+    v3Global.rootp()->foreach([&](const AstCMethodHard* nodep) {
+        const std::string& name = nodep->name();
+        if (name != "first" && name != "last" && name != "next" && name != "prev") return;
+        if (const AstAssocArrayDType* const dtypep
+            = VN_CAST(nodep->fromp()->dtypep()->skipRefp(), AssocArrayDType)) {
+            ordered.insert(dtypep->cType("", false, false));
+        }
+    });
+    for (const auto& pair : groups) {
+        if (ordered.count(pair.first)) continue;
+        for (AstAssocArrayDType* const dtypep : pair.second) dtypep->hashed(true);
+    }
+}
+
+// Store huge unpacked arrays in lazily allocated pages, so memory use follows what is touched.
+// Only 1-D arrays of integral elements that are accessed one element at a time qualify.
+static void markSparseArrays() {
+    const uint64_t minDepth = v3Global.opt.sparseArrayDepth();
+    std::vector<AstVar*> candidates;  // In tree order, for stable output
+    std::set<const AstVar*> dense;  // Candidates that need contiguous storage
+    v3Global.rootp()->foreach([&](AstVar* varp) {
+        const AstUnpackArrayDType* const dtypep
+            = VN_CAST(varp->dtypeSkipRefp(), UnpackArrayDType);
+        if (!dtypep || static_cast<uint64_t>(dtypep->elementsConst()) < minDepth) return;
+        const AstBasicDType* const basicp
+            = VN_CAST(dtypep->subDTypep()->skipRefToEnump(), BasicDType);
+        if (!basicp || !basicp->keyword().isIntNumeric()) return;
+        // Visible outside the model, or initialized as a whole
+        if (varp->isIO() || varp->isSigPublic() || varp->isParam() || varp->valuep()) return;
+        if (varp->isClassMember() || varp->isFuncLocal()) return;
+        candidates.push_back(varp);
+    });
+    if (candidates.empty()) return;
+    v3Global.rootp()->foreach([&](const AstVarRef* refp) {
+        const AstNode* const abovep = refp->firstAbovep();
+        if (const AstArraySel* const selp = VN_CAST(abovep, ArraySel)) {
+            if (selp->fromp() == refp) return;
+        }
+        if (const AstNodeReadWriteMem* const memp = VN_CAST(abovep, NodeReadWriteMem)) {
+            if (memp->memp() == refp) return;
+        }
+        if (VN_IS(abovep, CReset)) return;
+        // Target of an NBA commit queue, which writes by element
+        if (const AstCMethodHard* const callp = VN_CAST(abovep, CMethodHard)) {
+            if (callp->name() == "commit" && callp->pinsp() == refp) return;
+        }
+        dense.insert(refp->varp());
+    });
+    // Tracing reads every element
+    v3Global.rootp()->foreach([&](const AstTraceInc* tracep) {
+        tracep->foreach([&](const AstVarRef* refp) { dense.insert(refp->varp()); });
+    });
+    std::map<const AstVar*, AstUnpackArrayDType*> sparseDTypes;
+    for (AstVar* const varp : candidates) {
+        if (dense.count(varp)) continue;
+        const AstUnpackArrayDType* const dtypep = VN_AS(varp->dtypeSkipRefp(), UnpackArrayDType);
+        FileLine* const flp = dtypep->fileline();
+        AstUnpackArrayDType* const newp = new AstUnpackArrayDType{
+            flp, dtypep->subDTypep(), new AstRange{flp, dtypep->declRange()}};
+        newp->isCompound(dtypep->isCompound());
+        newp->isSparse(true);
+        v3Global.rootp()->typeTablep()->addTypesp(newp);
+        varp->dtypep(newp);
+        sparseDTypes.emplace(varp, newp);
+        UINFO(4, "Sparse array: " << varp);
+    }
+    v3Global.rootp()->foreach([&](AstVarRef* refp) {
+        const auto it = sparseDTypes.find(refp->varp());
+        if (it != sparseDTypes.end()) refp->dtypep(it->second);
+    });
+}
+
 //######################################################################
 // V3Common class functions
 
@@ -179,5 +273,7 @@ void V3Common::commonAll() {
             if (!dtypep->packed()) makeVlToString(dtypep);
         }
     }
+    if (v3Global.opt.fAssocHash()) markHashedAssocArrays();
+    if (v3Global.opt.sparseArrayDepth()) markSparseArrays();
     V3Global::dumpCheckGlobalTree("common", 0, dumpTreeEitherLevel() >= 3);
 }
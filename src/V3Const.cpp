@@ -950,7 +950,7 @@ class ConstVisitor final : public VNVisitor {
     }
     V3Number toNumC(AstNode* nodep, V3Number& numv) {
         // Extend V width back to C width for given node
-        return !numv.isNumber() ? numv : V3Number{nodep, nodep->width(), numv};
+        return !numv.isNumber() ? std::move(numv) : V3Number{nodep, nodep->width(), numv};
     }
 
     bool operandConst(AstNode* nodep) { return VN_IS(nodep, Const); }
@@ -1576,12 +1576,13 @@ class ConstVisitor final : public VNVisitor {
     // Constant Replacement functions.
     // These all take a node, delete its tree, and replaces it with a constant
 
-    void replaceNum(AstNode* oldp, const V3Number& num) {
+    void replaceNum(AstNode* oldp, V3Number num) {
         // Replace oldp node with a constant set to specified value
+        // By value, so folded results move into the new constant without a copy
         UASSERT(oldp, "Null old");
         UASSERT_OBJ(!(VN_IS(oldp, Const) && !VN_AS(oldp, Const)->num().isFourState()), oldp,
                     "Already constant??");
-        AstNode* const newp = new AstConst{oldp->fileline(), num};
+        AstNode* const newp = new AstConst{oldp->fileline(), std::move(num)};
         oldp->replaceWithKeepDType(newp);
         if (debug() > 5) oldp->dumpTree("-  const_old: ");
         if (debug() > 5) newp->dumpTree("-       _new: ");
@@ -1589,7 +1590,7 @@ class ConstVisitor final : public VNVisitor {
     }
     void replaceNum(AstNode* nodep, uint32_t val) {
         V3Number num{nodep, nodep->width(), val};
-        VL_DO_DANGLING(replaceNum(nodep, num), nodep);
+        VL_DO_DANGLING(replaceNum(nodep, std::move(num)), nodep);
     }
     void replaceNumSigned(AstNodeBiop* nodep, uint32_t val) {
         // We allow both sides to be constant, as one may have come from
@@ -1621,37 +1622,37 @@ class ConstVisitor final : public VNVisitor {
     void replaceAllOnes(AstNode* nodep) {
         V3Number ones{nodep, nodep->width(), 0};
         ones.setMask(nodep->width());
-        VL_DO_DANGLING(replaceNum(nodep, ones), nodep);
+        VL_DO_DANGLING(replaceNum(nodep, std::move(ones)), nodep);
     }
     void replaceConst(AstNodeUniop* nodep) {
         V3Number numv{nodep, nodep->widthMinV()};
         nodep->numberOperate(numv, constNumV(nodep->lhsp()));
-        const V3Number& num = toNumC(nodep, numv);
+        V3Number num = toNumC(nodep, numv);
         UINFO(4, "UNICONST -> " << num);
-        VL_DO_DANGLING(replaceNum(nodep, num), nodep);
+        VL_DO_DANGLING(replaceNum(nodep, std::move(num)), nodep);
     }
     void replaceConst(AstNodeBiop* nodep) {
         V3Number numv{nodep, nodep->widthMinV()};
         nodep->numberOperate(numv, constNumV(nodep->lhsp()), constNumV(nodep->rhsp()));
-        const V3Number& num = toNumC(nodep, numv);
+        V3Number num = toNumC(nodep, numv);
         UINFO(4, "BICONST -> " << num);
-        VL_DO_DANGLING(replaceNum(nodep, num), nodep);
+        VL_DO_DANGLING(replaceNum(nodep, std::move(num)), nodep);
     }
     void replaceConst(AstNodeTriop* nodep) {
         V3Number numv{nodep, nodep->widthMinV()};
         nodep->numberOperate(numv, constNumV(nodep->lhsp()), constNumV(nodep->rhsp()),
                              constNumV(nodep->thsp()));
-        const V3Number& num = toNumC(nodep, numv);
+        V3Number num = toNumC(nodep, numv);
         UINFO(4, "TRICONST -> " << num);
-        VL_DO_DANGLING(replaceNum(nodep, num), nodep);
+        VL_DO_DANGLING(replaceNum(nodep, std::move(num)), nodep);
     }
     void replaceConst(AstNodeQuadop* nodep) {
         V3Number numv{nodep, nodep->widthMinV()};
         nodep->numberOperate(numv, constNumV(nodep->lhsp()), constNumV(nodep->rhsp()),
                              constNumV(nodep->thsp()), constNumV(nodep->fhsp()));
-        const V3Number& num = toNumC(nodep, numv);
+        V3Number num = toNumC(nodep, numv);
         UINFO(4, "QUADCONST -> " << num);
-        VL_DO_DANGLING(replaceNum(nodep, num), nodep);
+        VL_DO_DANGLING(replaceNum(nodep, std::move(num)), nodep);
     }
 
     void replaceConstString(AstNode* oldp, const string& num) {
@@ -3986,6 +3987,9 @@ void V3Const::constifyAllLive(AstNetlist* nodep) {
 
 void V3Const::constifyAll(AstNetlist* nodep) {
     // Only call from Verilator.cpp, as it uses user#'s
+    // Note this is not run per module on V3ThreadPool: user4 marks shared AstVar/AstEnum
+    // nodes and AstVarScope's, new dtypes go in the shared type table, and after V3Scope
+    // nearly all logic is under the single top module, so there is little to partition.
     UINFO(2, __FUNCTION__ << ":");
     {
         ConstVisitor visitor{ConstVisitor::PROC_V_EXPENSIVE, /* globalPass: */ true};
@@ -20,6 +20,7 @@
 
 #include "V3String.h"
 
+#include <map>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -551,6 +552,9 @@ class V3ControlResolver final {
     V3ControlScopeTraceResolver m_scopeTraces;  // Regexp to trace enables
     std::unordered_map<string, std::unordered_map<string, uint64_t>>
         m_profileData;  // Access to profile_data records
+    // With --prof-pgo-normalize, profile_data records by file until merged into m_profileData
+    std::map<string, std::unordered_map<string, std::unordered_map<string, uint64_t>>>
+        m_profileFileData;
     uint8_t m_mode = NONE;
     std::unordered_map<string, V3ControlResolverHierWorkerEntry> m_hierWorkers;
     FileLine* m_profileFileLine = nullptr;
@@ -575,11 +579,44 @@ public:
                         ProfileDataMode mode = MTASK) {
         if (!m_profileFileLine) m_profileFileLine = fl;
         if (cost == 0) cost = 1;  // Cost 0 means delete (or no data)
-        m_profileData[model][key] += cost;
+        if (v3Global.opt.profPgoNormalize()) {
+            m_profileFileData[fl->filename()][model][key] += cost;
+        } else {
+            m_profileData[model][key] += cost;
+        }
         m_mode |= mode;
     }
+    void normalizeProfileData() {
+        // Scale each file's costs for a model to the mean over the files, so that every
+        // profiled run has equal weight however long it ran.  Ratios within a run are kept.
+        if (m_profileFileData.empty()) return;
+        std::unordered_map<string, std::vector<uint64_t>> totals;  // Per model, per file
+        for (const auto& fileIt : m_profileFileData) {
+            for (const auto& modelIt : fileIt.second) {
+                uint64_t total = 0;
+                for (const auto& keyIt : modelIt.second) total += keyIt.second;
+                totals[modelIt.first].push_back(total);
+            }
+        }
+        for (const auto& fileIt : m_profileFileData) {
+            for (const auto& modelIt : fileIt.second) {
+                const std::vector<uint64_t>& modelTotals = totals[modelIt.first];
+                double mean = 0.0;
+                for (const uint64_t total : modelTotals) mean += total;
+                mean /= modelTotals.size();
+                uint64_t total = 0;
+                for (const auto& keyIt : modelIt.second) total += keyIt.second;
+                const double scale = mean / total;
+                for (const auto& keyIt : modelIt.second) {
+                    const uint64_t cost = static_cast<uint64_t>(keyIt.second * scale);
+                    m_profileData[modelIt.first][keyIt.first] += std::max<uint64_t>(cost, 1);
+                }
+            }
+        }
+        m_profileFileData.clear();
+    }
     bool containsMTaskProfileData() const { return m_mode & MTASK; }
-    uint64_t getProfileData(const string& hierDpi) const {
+    uint64_t getProfileData(const string& hierDpi) {
         // Empty key for hierarchical DPI wrapper costs.
         return getProfileData(hierDpi, "");
     }
@@ -596,7 +633,8 @@ public:
         const auto mit = m_hierWorkers.find(model);
         return mit != m_hierWorkers.cend() ? mit->second.flp() : v3Global.rootp()->fileline();
     }
-    uint64_t getProfileData(const string& model, const string& key) const {
+    uint64_t getProfileData(const string& model, const string& key) {
+        normalizeProfileData();
         const auto mit = m_profileData.find(model);
         if (mit == m_profileData.cend()) return 0;
         const auto it = mit->second.find(key);
@@ -392,32 +392,46 @@ class CoverageVisitor final : public VNVisitor {
         }
     }
 
-    void toggleVarBottom(const ToggleEnt& above, const AstVar* varp) {
+    AstCoverInc* newToggleInc(const string& comment, const AstVar* varp) {
         const std::string hierPrefix
             = (m_beginHier != "") ? AstNode::prettyName(m_beginHier) + "." : "";
-        AstCoverToggle* const newp = new AstCoverToggle{
-            varp->fileline(),
-            newCoverInc(varp->fileline(), "", "v_toggle",
-                        hierPrefix + varp->name() + above.m_comment, "", 0, ""),
-            above.m_varRefp->cloneTree(false), above.m_chgRefp->cloneTree(false)};
+        return newCoverInc(varp->fileline(), "", "v_toggle", hierPrefix + varp->name() + comment,
+                           "", 0, "");
+    }
+    void toggleVarBottom(const ToggleEnt& above, const AstVar* varp) {
+        AstCoverToggle* const newp
+            = new AstCoverToggle{varp->fileline(), newToggleInc(above.m_comment, varp),
+                                 above.m_varRefp->cloneTree(false),
+                                 above.m_chgRefp->cloneTree(false)};
         m_modp->addStmtsp(newp);
     }
+    void toggleVarBits(const ToggleEnt& above, const AstBasicDType* bdtypep,
+                       const AstVar* varp) {
+        // One toggle per quad of bits, each bit with its own point, so V3Clock can
+        // detect changes a word at a time instead of comparing every bit
+        for (int chunkLsb = 0; chunkLsb < bdtypep->width(); chunkLsb += VL_QUADSIZE) {
+            const int chunkWidth = std::min(VL_QUADSIZE, bdtypep->width() - chunkLsb);
+            AstCoverInc* incsp = nullptr;
+            for (int index_code = chunkLsb; index_code < chunkLsb + chunkWidth; ++index_code) {
+                const int index_docs = index_code + bdtypep->lo();
+                incsp = AstNode::addNext(
+                    incsp, newToggleInc(above.m_comment + "["s + cvtToStr(index_docs) + "]", varp));
+            }
+            AstCoverToggle* const newp = new AstCoverToggle{
+                varp->fileline(), incsp,
+                new AstSel{varp->fileline(), above.m_varRefp->cloneTree(false), chunkLsb,
+                           chunkWidth},
+                new AstSel{varp->fileline(), above.m_chgRefp->cloneTree(false), chunkLsb,
+                           chunkWidth}};
+            m_modp->addStmtsp(newp);
+        }
+    }
 
     void toggleVarRecurse(const AstNodeDType* const dtypep, const int depth,  // per-iteration
                           const ToggleEnt& above, const AstVar* const varp) {  // Constant
         if (const AstBasicDType* const bdtypep = VN_CAST(dtypep, BasicDType)) {
             if (bdtypep->isRanged()) {
-                for (int index_docs = bdtypep->lo(); index_docs < bdtypep->hi() + 1;
-                     ++index_docs) {
-                    const int index_code = index_docs - bdtypep->lo();
-                    ToggleEnt newent{above.m_comment + "["s + cvtToStr(index_docs) + "]",
-                                     new AstSel{varp->fileline(),
-                                                above.m_varRefp->cloneTree(false), index_code, 1},
-                                     new AstSel{varp->fileline(),
-                                                above.m_chgRefp->cloneTree(false), index_code, 1}};
-                    toggleVarBottom(newent, varp);
-                    newent.cleanup();
-                }
+                toggleVarBits(above, bdtypep, varp);
             } else {
                 toggleVarBottom(above, varp);
             }
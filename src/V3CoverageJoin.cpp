@@ -70,19 +70,25 @@ class CoverageJoinVisitor final : public VNVisitor {
                 // covertoggle which is immediately above, so:
                 AstCoverToggle* const removep = VN_AS(duporigp->backp(), CoverToggle);
                 UASSERT_OBJ(removep, nodep, "CoverageJoin duplicate of wrong type");
-                UINFO(8, "  Orig " << nodep << " -->> " << nodep->incp()->declp());
-                UINFO(8, "   dup " << removep << " -->> " << removep->incp()->declp());
-                // The CoverDecl the duplicate pointed to now needs to point to the
-                // original's data. I.e. the duplicate will get the coverage number
-                // from the non-duplicate
-                AstCoverDecl* const datadeclp = nodep->incp()->declp()->dataDeclThisp();
-                removep->incp()->declp()->dataDeclp(datadeclp);
-                UINFO(8, "   new " << removep->incp()->declp());
+                UINFO(8, "  Orig " << nodep);
+                UINFO(8, "   dup " << removep);
+                // The CoverDecls the duplicate pointed to now need to point to the
+                // original's data. I.e. the duplicate will get the coverage numbers
+                // from the non-duplicate, bit by bit
+                AstCoverInc* origIncp = nodep->incsp();
+                AstCoverInc* dupIncp = removep->incsp();
+                for (; origIncp && dupIncp; origIncp = VN_AS(origIncp->nextp(), CoverInc),
+                                            dupIncp = VN_AS(dupIncp->nextp(), CoverInc)) {
+                    AstCoverDecl* const datadeclp = origIncp->declp()->dataDeclThisp();
+                    dupIncp->declp()->dataDeclp(datadeclp);
+                    UINFO(8, "   new " << dupIncp->declp());
+                    ++m_statToggleJoins;
+                }
+                UASSERT_OBJ(!origIncp && !dupIncp, removep, "CoverageJoin of mismatched widths");
                 // Mark the found node as a duplicate of the first node
                 // (Not vice-versa as we have the iterator for the found node)
                 removep->unlinkFrBack();
                 VL_DO_DANGLING(pushDeletep(removep), removep);
-                ++m_statToggleJoins;
             }
         }
     }
@@ -109,6 +109,18 @@
 //  - Add new "Post-scheduled" logic:
 //      __VdlyCommitQueue.commit(LHS);
 //
+// "In place" scheme. Used with --nba-in-place for unpacked arrays that
+// are only written by NBAs in a single clocked process, outside loops,
+// with all reads in that process preceding the first NBA, and no other
+// readers but combinational logic. E.g.:
+//   q <= LHS[raddr];
+//   LHS[waddr] <= RHS;
+// is converted to:
+//  - In the original logic, replace the AstAssignDelay with:
+//      LHS[waddr] = RHS;
+// No reader can observe the early update: the process has already read
+// the array, and V3Order schedules combinational readers after the write.
+//
 // TODO: generic LHS scheme as discussed in #5092
 //
 //*************************************************************************
@@ -140,7 +152,8 @@ class DelayedVisitor final : public VNVisitor {
         FlagShared,
         FlagUnique,
         ValueQueueWhole,
-        ValueQueuePartial
+        ValueQueuePartial,
+        InPlace
     };
 
     // All info associated with a variable that is the target of an NBA
@@ -155,6 +168,11 @@ class DelayedVisitor final : public VNVisitor {
         bool m_inSuspOrFork = false;  // Used on LHS of NBA in suspendable process or fork
         Scheme m_scheme = Scheme::Undecided;  // Conversion scheme to use for this variable
         uint32_t m_nTmp = 0;  // Temporary number for unique names
+        // Only clocked process referencing the variable, for Scheme::InPlace
+        const AstNodeProcedure* m_inPlaceProcp = nullptr;
+        bool m_inPlaceUnsafe = false;  // Referenced such that Scheme::InPlace can't be used
+        size_t m_inPlaceReadSeq = 0;  // Sequence number of last read in 'm_inPlaceProcp'
+        size_t m_inPlaceNbaSeq = 0;  // Sequence number of first NBA in 'm_inPlaceProcp'
 
     private:
         // Combined sensitivities of all NBAs targeting this variable
@@ -268,6 +286,7 @@ class DelayedVisitor final : public VNVisitor {
     bool m_ignoreBlkAndNBlk = false;  // Suppress delayed assignment BLKANDNBLK
     bool m_inNonCombLogic = false;  // We are in non-combinational logic
     AstVarRef* m_currNbaLhsRefp = nullptr;  // Current NBA LHS variable reference
+    size_t m_refSeq = 0;  // Sequence number of references, for Scheme::InPlace
 
     // STATE - during NBA conversion (after visit)
     std::vector<NBA> m_nbas;  // AstAssignDly instances to lower at the end
@@ -282,6 +301,7 @@ class DelayedVisitor final : public VNVisitor {
     VDouble0 m_nSchemeFlagUnique;  // Number of variables using Scheme::FlagUnique
     VDouble0 m_nSchemeValueQueuesWhole;  //  Number of variables using Scheme::ValueQueueWhole
     VDouble0 m_nSchemeValueQueuesPartial;  //  Number of variables using Scheme::ValueQueuePartial
+    VDouble0 m_nSchemeInPlace;  // Number of variables using Scheme::InPlace
     VDouble0 m_nSharedSetFlags;  // "Set" flags actually shared by Scheme::FlagShared variables
 
     // METHODS
@@ -423,6 +443,8 @@ class DelayedVisitor final : public VNVisitor {
             }
             // In a suspendable of fork, we must use the unique flag scheme, TODO: why?
             if (vscpInfo.m_inSuspOrFork) return Scheme::FlagUnique;
+            // If no reader can observe an early update, write the array directly
+            if (basicp && inPlaceOk(vscp, vscpInfo)) return Scheme::InPlace;
             // Otherwise if an array of packed/basic elements, use the shared flag scheme
             if (basicp) return Scheme::FlagShared;
             // Finally fall back on the shadow variable scheme, e.g. for
@@ -456,6 +478,17 @@ class DelayedVisitor final : public VNVisitor {
         return Scheme::ShadowVar;
     }
 
+    // True if the array can be updated directly at the NBA, see Scheme::InPlace
+    static bool inPlaceOk(const AstVarScope* vscp, const VarScopeInfo& vscpInfo) {
+        if (!v3Global.opt.nbaInPlace()) return false;
+        if (vscpInfo.m_inPlaceUnsafe || !vscpInfo.m_inPlaceProcp) return false;
+        // Public variables can be read via the VPI or from DPI calls at any point
+        if (vscp->varp()->isSigPublic() || vscp->varp()->isIO()) return false;
+        // All reads in the writing process must be before the first NBA. Note without
+        // loops (which use the value queues), tree order follows execution order.
+        return vscpInfo.m_inPlaceReadSeq < vscpInfo.m_inPlaceNbaSeq;
+    }
+
     // Create new AstVarScope in the given 'scopep', with the given 'name' and 'dtypep'
     AstVarScope* createTemp(FileLine* flp, AstScope* scopep, const std::string& name,
                             AstNodeDType* dtypep) {
@@ -945,6 +978,48 @@ class DelayedVisitor final : public VNVisitor {
         pushDeletep(nodep->unlinkFrBack());
     }
 
+    // Scheme::InPlace
+    void convertSchemeInPlace(AstAssignDly* nodep, AstVarScope* vscp, VarScopeInfo& vscpInfo) {
+        UASSERT_OBJ(vscpInfo.m_scheme == Scheme::InPlace, vscp, "Inconsistent NBA scheme");
+        AstAssign* const newp = new AstAssign{nodep->fileline(), nodep->lhsp()->unlinkFrBack(),
+                                              nodep->rhsp()->unlinkFrBack()};
+        nodep->replaceWith(newp);
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+    }
+
+    // Record references to unpacked arrays, to decide if Scheme::InPlace is safe
+    void recordInPlaceRef(AstVarRef* nodep, bool nonBlocking) {
+        AstVarScope* const vscp = nodep->varScopep();
+        if (!VN_IS(vscp->dtypep()->skipRefp(), UnpackArrayDType)) return;
+        VarScopeInfo& vscpInfo = m_vscpInfo(vscp);
+        if (vscpInfo.m_inPlaceUnsafe) return;
+        // Initial and static logic runs before any clocked logic
+        if (m_ignoreBlkAndNBlk) return;
+        // Functions can be called from anywhere
+        if (m_cfuncp || !m_activep) {
+            vscpInfo.m_inPlaceUnsafe = true;
+            return;
+        }
+        // Combinational logic is ordered after the clocked logic writing the variable
+        if (!m_inNonCombLogic) {
+            if (nodep->access().isWriteOrRW()) vscpInfo.m_inPlaceUnsafe = true;
+            return;
+        }
+        // Otherwise it must be the single writing process
+        if (!m_procp || (vscpInfo.m_inPlaceProcp && vscpInfo.m_inPlaceProcp != m_procp)) {
+            vscpInfo.m_inPlaceUnsafe = true;
+            return;
+        }
+        vscpInfo.m_inPlaceProcp = m_procp;
+        if (nonBlocking) {
+            if (!vscpInfo.m_inPlaceNbaSeq) vscpInfo.m_inPlaceNbaSeq = ++m_refSeq;
+        } else if (nodep->access().isWriteOrRW()) {
+            vscpInfo.m_inPlaceUnsafe = true;
+        } else {
+            vscpInfo.m_inPlaceReadSeq = ++m_refSeq;
+        }
+    }
+
     // Record where a variable is assigned
     void recordWriteRef(AstVarRef* nodep, bool nonBlocking) {
         // Ignore references in certain contexts
@@ -1006,6 +1081,10 @@ class DelayedVisitor final : public VNVisitor {
                 prepareSchemeValueQueue</* Partial: */ true>(vscp, vscpInfo);
                 break;
             }
+            case Scheme::InPlace: {
+                ++m_nSchemeInPlace;
+                break;
+            }
             }
         }
         // Convert all NBAs
@@ -1048,6 +1127,10 @@ class DelayedVisitor final : public VNVisitor {
             case Scheme::ValueQueuePartial:
                 convertSchemeValueQueue(nbap, vscp, vscpInfo, /* partial: */ true);
                 break;
+            case Scheme::InPlace: {
+                convertSchemeInPlace(nbap, vscp, vscpInfo);
+                break;
+            }
             }
         }
     }
@@ -1165,6 +1248,9 @@ class DelayedVisitor final : public VNVisitor {
                     E_NOTIMING,
                     "Delayed assignment in a non-inlined function/task requires --timing");
             }
+            if (v3Global.opt.nbaInPlace()) {
+                nodep->foreach([this](AstVarRef* refp) { recordInPlaceRef(refp, false); });
+            }
             return;
         }
         UASSERT_OBJ(m_procp, nodep, "Delayed assignment not under process");
@@ -1242,10 +1328,18 @@ class DelayedVisitor final : public VNVisitor {
         recordWriteRef(m_currNbaLhsRefp, true);
 
         iterateChildren(nodep);
+
+        // The RHS and LHS indices are evaluated before the update, so record the NBA after them
+        if (v3Global.opt.nbaInPlace()) {
+            // Intra-assignment delays are not supported
+            if (nodep->timingControlp()) m_vscpInfo(vscp).m_inPlaceUnsafe = true;
+            recordInPlaceRef(m_currNbaLhsRefp, true);
+        }
     }
     void visit(AstVarRef* nodep) override {
         // Already checked the NBA LHS ref, ignore here
         if (nodep == m_currNbaLhsRefp) return;
+        if (v3Global.opt.nbaInPlace()) recordInPlaceRef(nodep, false);
         // Only care about write refs
         if (!nodep->access().isWriteOrRW()) return;
         // Record write reference
@@ -1279,6 +1373,7 @@ public:
         V3Stats::addStat("NBA, variables using ValueQueueWhole scheme", m_nSchemeValueQueuesWhole);
         V3Stats::addStat("NBA, variables using ValueQueuePartial scheme",
                          m_nSchemeValueQueuesPartial);
+        V3Stats::addStat("NBA, variables using InPlace scheme", m_nSchemeInPlace);
         V3Stats::addStat("Optimizations, NBA flags shared", m_nSharedSetFlags);
     }
 };
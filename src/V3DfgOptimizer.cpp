@@ -26,6 +26,7 @@
 #include "V3Dfg.h"
 #include "V3DfgPasses.h"
 #include "V3Graph.h"
+#include "V3Stats.h"
 #include "V3UniqueNames.h"
 
 #include <vector>
@@ -250,7 +251,9 @@ static void process(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
     // Quick sanity check
     UASSERT_OBJ(dfg.size() == 0, dfg.modulep(), "DfgGraph should have become empty");
 
-    // For each acyclic component
+    // For each acyclic component. These are independent, but are optimized serially, as the
+    // passes create AST nodes (data types via the shared type table, and new variables and
+    // logic added to the module or scope), none of which is thread safe.
     for (auto& component : acyclicComponents) {
         if (dumpDfgLevel() >= 7) component->dumpDotFilePrefixed(ctx.prefix() + "source");
         // Optimize the component
@@ -276,6 +279,7 @@ static void process(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
 
 void V3DfgOptimizer::optimize(AstNetlist* netlistp, const string& label) {
     UINFO(2, __FUNCTION__ << ":");
+    const V3StatsTraceScope traceScope{"V3DfgOptimizer::optimize"};
 
     // NODE STATE
     // AstVar::user1 -> Used by:
@@ -35,6 +35,11 @@ V3DfgCseContext::~V3DfgCseContext() {
                      m_eliminated);
 }
 
+V3DfgNarrowSelsContext::~V3DfgNarrowSelsContext() {
+    V3Stats::addStat("Optimizations, DFG " + m_label + " NarrowSels, vertices narrowed",
+                     m_narrowed);
+}
+
 V3DfgRegularizeContext::~V3DfgRegularizeContext() {
     V3Stats::addStat("Optimizations, DFG " + m_label + " Regularize, temporaries introduced",
                      m_temporariesIntroduced);
@@ -231,8 +236,122 @@ void V3DfgPasses::removeUnused(DfgGraph& dfg) {
     }
 }
 
+void V3DfgPasses::narrowSels(DfgGraph& dfg, V3DfgNarrowSelsContext& ctx) {
+    // Select 'width' bits from 'srcp' starting at 'lsb'
+    const auto makeSel = [&](DfgVertex* srcp, uint32_t lsb, AstNodeDType* dtypep) {
+        DfgSel* const selp = new DfgSel{dfg, srcp->fileline(), dtypep};
+        selp->fromp(srcp);
+        selp->lsb(lsb);
+        return selp;
+    };
+    // Same operation as 'vtxp', computing only 'dtypep' bits starting at 'lsb'
+    const auto makeNarrow = [&](DfgVertex* vtxp, uint32_t lsb, AstNodeDType* dtypep) {
+        if (DfgNot* const notp = vtxp->cast<DfgNot>()) {
+            DfgNot* const newp = new DfgNot{dfg, notp->fileline(), dtypep};
+            newp->srcp(makeSel(notp->srcp(), lsb, dtypep));
+            return static_cast<DfgVertex*>(newp);
+        }
+        if (DfgShiftL* const shiftp = vtxp->cast<DfgShiftL>()) {
+            DfgShiftL* const newp = new DfgShiftL{dfg, shiftp->fileline(), dtypep};
+            newp->lhsp(makeSel(shiftp->lhsp(), lsb, dtypep));
+            newp->rhsp(shiftp->rhsp());
+            return static_cast<DfgVertex*>(newp);
+        }
+        const auto makeBinary = [&](auto* binp) -> DfgVertex* {
+            using Vertex = typename std::remove_pointer<decltype(binp)>::type;
+            Vertex* const newp = new Vertex{dfg, binp->fileline(), dtypep};
+            newp->lhsp(makeSel(binp->lhsp(), lsb, dtypep));
+            newp->rhsp(makeSel(binp->rhsp(), lsb, dtypep));
+            return newp;
+        };
+        if (DfgAnd* const binp = vtxp->cast<DfgAnd>()) return makeBinary(binp);
+        if (DfgOr* const binp = vtxp->cast<DfgOr>()) return makeBinary(binp);
+        if (DfgXor* const binp = vtxp->cast<DfgXor>()) return makeBinary(binp);
+        if (DfgAdd* const binp = vtxp->cast<DfgAdd>()) return makeBinary(binp);
+        if (DfgSub* const binp = vtxp->cast<DfgSub>()) return makeBinary(binp);
+        if (DfgMul* const binp = vtxp->cast<DfgMul>()) return makeBinary(binp);
+        vtxp->v3fatalSrc("Unhandled vertex type");
+        return static_cast<DfgVertex*>(nullptr);
+    };
+
+    // A variable that is not read anywhere, and would be removed by 'eliminateVars'
+    const auto isDeadVar = [](DfgVertex& vtx) {
+        DfgVarPacked* const varp = vtx.cast<DfgVarPacked>();
+        return varp && !varp->hasSinks() && varp->isDrivenFullyByDfg() && !varp->keep()
+               && !varp->hasNonLocalRefs();
+    };
+
+    // Demanded bits: if every sink of an operation is a select (or a dead variable), the
+    // operation only needs to compute the range of bits the selects read. For bitwise
+    // operations any range will do, for shifts and arithmetic the low bits only depend on the
+    // low bits of the operands. Narrowing a vertex can make its operands narrowable, so repeat
+    // until no more change.
+    std::vector<DfgVertex*> vtxps;
+    std::vector<DfgSel*> selps;
+    std::vector<DfgVarPacked*> deadVarps;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        vtxps.clear();
+        for (DfgVertex& vtx : dfg.opVertices()) {
+            if (!vtx.hasSinks()) continue;
+            if (vtx.is<DfgAnd>() || vtx.is<DfgOr>() || vtx.is<DfgXor>() || vtx.is<DfgNot>()
+                || vtx.is<DfgShiftL>() || vtx.is<DfgAdd>() || vtx.is<DfgSub>()
+                || vtx.is<DfgMul>()) {
+                vtxps.push_back(&vtx);
+            }
+        }
+        for (DfgVertex* const vtxp : vtxps) {
+            // Gather the range of bits read by the sinks, if they are all selects
+            uint32_t lsb = vtxp->width();
+            uint32_t msb = 0;
+            bool allSels = true;
+            selps.clear();
+            deadVarps.clear();
+            vtxp->forEachSink([&](DfgVertex& sink) {
+                if (isDeadVar(sink)) {
+                    deadVarps.push_back(sink.as<DfgVarPacked>());
+                    return;
+                }
+                DfgSel* const selp = sink.cast<DfgSel>();
+                if (!selp) {
+                    allSels = false;
+                    return;
+                }
+                selps.push_back(selp);
+                lsb = std::min(lsb, selp->lsb());
+                msb = std::max(msb, selp->lsb() + selp->width() - 1);
+            });
+            // A single select is pushed through the operation by 'peephole'
+            if (!allSels || selps.size() < 2) continue;
+            const bool bitwise = vtxp->is<DfgAnd>() || vtxp->is<DfgOr>() || vtxp->is<DfgXor>()
+                                 || vtxp->is<DfgNot>();
+            if (!bitwise) lsb = 0;
+            const uint32_t width = msb - lsb + 1;
+            if (width == vtxp->width()) continue;
+
+            // Compute only the demanded bits, and redirect the selects
+            DfgVertex* const newp = makeNarrow(vtxp, lsb, DfgVertex::dtypeForWidth(width));
+            for (DfgSel* const selp : selps) {
+                selp->fromp(newp);
+                selp->lsb(selp->lsb() - lsb);
+            }
+            for (DfgVarPacked* const varp : deadVarps) {
+                varp->nodep()->unlinkFrBack()->deleteTree();
+                VL_DO_DANGLING(varp->unlinkDelete(dfg), varp);
+            }
+            ++ctx.m_narrowed;
+            changed = true;
+        }
+        // Remove the now unused wide vertices
+        if (changed) removeUnused(dfg);
+    }
+}
+
 void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
-    UASSERT(dfg.modulep(), "binToOneHot only works with unscoped DfgGraphs for now");
+    // Scope cache for below
+    const bool scoped = !dfg.modulep();
+    DfgVertex::ScopeCache scopeCache;
 
     const auto userDataInUse = dfg.userDataInUse();
 
@@ -360,6 +479,23 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
         // - and replace the comparisons with 'tab[const]'
 
         FileLine* const flp = srcp->fileline();
+        // In a scoped graph, the decoder goes in the scope of the decoded value
+        AstScope* const scopep = scoped ? srcp->scopep(scopeCache, true) : nullptr;
+        // Reference to a variable the decoder logic uses
+        const auto makeRef = [&](AstVar* varp, AstVarScope* vscp, VAccess access) {
+            return scoped ? new AstVarRef{flp, vscp, access} : new AstVarRef{flp, varp, access};
+        };
+        const auto vtxRef = [&](DfgVertexVar* vtxp, VAccess access) {
+            return makeRef(vtxp->varp(), vtxp->varScopep(), access);
+        };
+        // Where the decoder logic goes
+        const auto addLogic = [&](AstNode* nodep) {
+            if (scoped) {
+                scopep->addBlocksp(nodep);
+            } else {
+                dfg.modulep()->addStmtsp(nodep);
+            }
+        };
 
         // Required data types
         AstNodeDType* const idxDTypep = srcp->dtypep();
@@ -374,7 +510,7 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
             DfgVarPacked* varp = srcp->getResultVar();
             if (!varp) {
                 const std::string name = dfg.makeUniqueName("BinToOneHot_Idx", nTables);
-                varp = dfg.makeNewVar(flp, name, idxDTypep, nullptr)->as<DfgVarPacked>();
+                varp = dfg.makeNewVar(flp, name, idxDTypep, scopep)->as<DfgVarPacked>();
                 varp->varp()->isInternal(true);
                 varp->addDriver(flp, 0, srcp);
             }
@@ -382,10 +518,17 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
             return varp;
         }();
         // The previous index variable - we don't need a vertex for this
+        AstVarScope* preVscp = nullptr;
         AstVar* const preVarp = [&]() {
             const std::string name = dfg.makeUniqueName("BinToOneHot_Pre", nTables);
             AstVar* const varp = new AstVar{flp, VVarType::MODULETEMP, name, idxDTypep};
-            dfg.modulep()->addStmtsp(varp);
+            if (scoped) {
+                scopep->modp()->addStmtsp(varp);
+                preVscp = new AstVarScope{flp, scopep, varp};
+                scopep->addVarsp(preVscp);
+            } else {
+                dfg.modulep()->addStmtsp(varp);
+            }
             varp->isInternal(true);
             varp->noReset(true);
             varp->setIgnoreSchedWrite();
@@ -395,7 +538,7 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
         DfgVarArray* const tabVtxp = [&]() {
             const std::string name = dfg.makeUniqueName("BinToOneHot_Tab", nTables);
             DfgVarArray* const varp
-                = dfg.makeNewVar(flp, name, tabDTypep, nullptr)->as<DfgVarArray>();
+                = dfg.makeNewVar(flp, name, tabDTypep, scopep)->as<DfgVarArray>();
             varp->varp()->isInternal(true);
             varp->varp()->noReset(true);
             varp->setHasModRefs();
@@ -407,16 +550,16 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
 
         // Initialize 'tab' and 'pre' variables statically
         AstInitialStatic* const initp = new AstInitialStatic{flp, nullptr};
-        dfg.modulep()->addStmtsp(initp);
+        addLogic(initp);
         {  // pre = 0
             initp->addStmtsp(new AstAssign{
                 flp,  //
-                new AstVarRef{flp, preVarp, VAccess::WRITE},  //
+                makeRef(preVarp, preVscp, VAccess::WRITE),  //
                 new AstConst{flp, AstConst::WidthedValue{}, static_cast<int>(width), 0}});
         }
         {  // tab.fill(0)
-            AstCMethodHard* const callp = new AstCMethodHard{
-                flp, new AstVarRef{flp, tabVtxp->varp(), VAccess::WRITE}, "fill"};
+            AstCMethodHard* const callp
+                = new AstCMethodHard{flp, vtxRef(tabVtxp, VAccess::WRITE), "fill"};
             callp->addPinsp(new AstConst{flp, AstConst::BitFalse{}});
             callp->dtypeSetVoid();
             initp->addStmtsp(callp->makeStmt());
@@ -424,25 +567,25 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
 
         // Build the decoder logic
         AstAlways* const logicp = new AstAlways{flp, VAlwaysKwd::ALWAYS_COMB, nullptr, nullptr};
-        dfg.modulep()->addStmtsp(logicp);
+        addLogic(logicp);
         {  // tab[pre] = 0;
             logicp->addStmtsp(new AstAssign{
                 flp,  //
-                new AstArraySel{flp, new AstVarRef{flp, tabVtxp->varp(), VAccess::WRITE},
-                                new AstVarRef{flp, preVarp, VAccess::READ}},  //
+                new AstArraySel{flp, vtxRef(tabVtxp, VAccess::WRITE),
+                                makeRef(preVarp, preVscp, VAccess::READ)},  //
                 new AstConst{flp, AstConst::BitFalse{}}});
         }
         {  // tab[idx] = 1
             logicp->addStmtsp(new AstAssign{
                 flp,  //
-                new AstArraySel{flp, new AstVarRef{flp, tabVtxp->varp(), VAccess::WRITE},
-                                new AstVarRef{flp, idxVtxp->varp(), VAccess::READ}},  //
+                new AstArraySel{flp, vtxRef(tabVtxp, VAccess::WRITE),
+                                vtxRef(idxVtxp, VAccess::READ)},  //
                 new AstConst{flp, AstConst::BitTrue{}}});
         }
         {  // pre = idx
             logicp->addStmtsp(new AstAssign{flp,  //
-                                            new AstVarRef{flp, preVarp, VAccess::WRITE},  //
-                                            new AstVarRef{flp, idxVtxp->varp(), VAccess::READ}});
+                                            makeRef(preVarp, preVscp, VAccess::WRITE),  //
+                                            vtxRef(idxVtxp, VAccess::READ)});
         }
 
         // Replace terms with ArraySels
@@ -613,9 +756,8 @@ void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
     apply(3, "input           ", [&]() {});
     apply(4, "inlineVars      ", [&]() { inlineVars(dfg); });
     apply(4, "cse0            ", [&]() { cse(dfg, ctx.m_cseContext0); });
-    if (dfg.modulep()) {
-        apply(4, "binToOneHot     ", [&]() { binToOneHot(dfg, ctx.m_binToOneHotContext); });
-    }
+    apply(4, "binToOneHot     ", [&]() { binToOneHot(dfg, ctx.m_binToOneHotContext); });
+    apply(4, "narrowSels      ", [&]() { narrowSels(dfg, ctx.m_narrowSelsContext); });
     if (v3Global.opt.fDfgPeephole()) {
         apply(4, "peephole        ", [&]() { peephole(dfg, ctx.m_peepholeContext); });
         // We just did CSE above, so without peephole there is no need to run it again these
@@ -50,6 +50,16 @@ public:
     ~V3DfgCseContext() VL_MT_DISABLED;
 };
 
+class V3DfgNarrowSelsContext final {
+    const std::string m_label;  // Label to apply to stats
+
+public:
+    VDouble0 m_narrowed;  // Number of vertices narrowed to the bits selected from them
+    explicit V3DfgNarrowSelsContext(const std::string& label)
+        : m_label{label} {}
+    ~V3DfgNarrowSelsContext() VL_MT_DISABLED;
+};
+
 class V3DfgRegularizeContext final {
     const std::string m_label;  // Label to apply to stats
 
@@ -95,6 +105,7 @@ public:
     V3DfgBinToOneHotContext m_binToOneHotContext{m_label};
     V3DfgCseContext m_cseContext0{m_label + " 1st"};
     V3DfgCseContext m_cseContext1{m_label + " 2nd"};
+    V3DfgNarrowSelsContext m_narrowSelsContext{m_label};
     V3DfgPeepholeContext m_peepholeContext{m_label};
     V3DfgRegularizeContext m_regularizeContext{m_label};
     V3DfgEliminateVarsContext m_eliminateVarsContext{m_label};
@@ -136,6 +147,8 @@ void binToOneHot(DfgGraph&, V3DfgBinToOneHotContext&) VL_MT_DISABLED;
 void cse(DfgGraph&, V3DfgCseContext&) VL_MT_DISABLED;
 // Inline fully driven variables
 void inlineVars(DfgGraph&) VL_MT_DISABLED;
+// Narrow operations to the bits selected from them
+void narrowSels(DfgGraph&, V3DfgNarrowSelsContext&) VL_MT_DISABLED;
 // Peephole optimizations
 void peephole(DfgGraph&, V3DfgPeepholeContext&) VL_MT_DISABLED;
 // Regularize graph. This must be run before converting back to Ast.
@@ -413,6 +413,29 @@ class V3DfgPeephole final : public DfgVisitor {
                 }
             }
         }
+        // Similarly, in a right leaning associative chain 'a op (b op c)', order adjacent
+        // variables, so chains of the same variables in a different order become identical.
+        if VL_CONSTEXPR_CXX17 (std::is_same<DfgAnd, Vertex>::value
+                               || std::is_same<DfgOr, Vertex>::value
+                               || std::is_same<DfgXor, Vertex>::value
+                               || std::is_same<DfgAdd, Vertex>::value
+                               || std::is_same<DfgMul, Vertex>::value
+                               || std::is_same<DfgMulS, Vertex>::value) {
+            Vertex* const rVtxp = rhsp->cast<Vertex>();
+            if (lhsp->is<DfgVertexVar>() && rVtxp && !rVtxp->hasMultipleSinks()
+                && rVtxp->lhsp()->template is<DfgVertexVar>()) {
+                AstNode* const lVarp = lhsp->as<DfgVertexVar>()->nodep();
+                AstNode* const rlVarp = rVtxp->lhsp()->template as<DfgVertexVar>()->nodep();
+                if (lVarp->name() > rlVarp->name()) {
+                    APPLYING(SWAP_VAR_IN_COMMUTATIVE_ASSOC_CHAIN) {
+                        Vertex* const childp = make<Vertex>(rVtxp, lhsp, rVtxp->rhsp());
+                        Vertex* const replacementp = make<Vertex>(vtxp, rVtxp->lhsp(), childp);
+                        replace(vtxp, replacementp);
+                        return true;
+                    }
+                }
+            }
+        }
 
         return false;
     }
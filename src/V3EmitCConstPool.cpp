@@ -38,6 +38,7 @@ class EmitCConstPool final : public EmitCConstInit {
     int m_outFileSize = 0;
     VDouble0 m_tablesEmitted;
     VDouble0 m_constsEmitted;
+    VDouble0 m_blobsEmitted;
 
     // METHODS
 
@@ -67,6 +68,48 @@ class EmitCConstPool final : public EmitCConstInit {
         setOutputFile(outFileAndNodePair.first, outFileAndNodePair.second);
     }
 
+    static const AstUnpackArrayDType* blobDTypep(const AstVar* varp) {
+        // The array type, if the variable should be emitted as a blob (--output-const-blob)
+        if (!v3Global.opt.outputConstBlob()) return nullptr;
+        const AstUnpackArrayDType* const dtypep
+            = VN_CAST(varp->dtypep()->skipRefp(), UnpackArrayDType);
+        if (!dtypep) return nullptr;
+        const AstBasicDType* const subp = VN_CAST(dtypep->subDTypep()->skipRefp(), BasicDType);
+        if (!subp || !subp->keyword().isIntNumeric()) return nullptr;
+        const uint64_t bytes
+            = static_cast<uint64_t>(dtypep->elementsConst()) * subp->widthTotalBytes();
+        if (bytes < static_cast<uint64_t>(v3Global.opt.outputConstBlob())) return nullptr;
+        return dtypep;
+    }
+
+    void emitBlob(const AstVar* varp, const AstUnpackArrayDType* dtypep) {
+        // Emit the little endian bytes of each element as a string literal
+        const AstInitArray* const initp = VN_AS(varp->valuep(), InitArray);
+        const AstNodeDType* const subp = dtypep->subDTypep()->skipRefp();
+        const uint32_t elemBytes = subp->widthTotalBytes();
+        const int elements = dtypep->elementsConst();
+        putns(varp, "VL_CONST_BLOB_UNPACKED<" + subp->cType("", false, false) + ", "
+                        + cvtToStr(elements) + ">(\n");
+        uint32_t lineBytes = 0;
+        for (int n = 0; n < elements; ++n) {
+            const AstConst* const constp = VN_AS(initp->getIndexDefaultedValuep(n), Const);
+            const V3Number& num = constp->num();
+            UASSERT_OBJ(!num.isFourState(), constp, "4-state value in constant pool");
+            for (uint32_t b = 0; b < elemBytes; ++b) {
+                if (!lineBytes) puts("\"");
+                const uint32_t byte = (num.edataWord(b / 4) >> ((b % 4) * 8)) & 0xff;
+                ofp()->printf("\\x%02" PRIx32, byte);
+                if (++lineBytes == 32) {
+                    puts("\"\n");
+                    lineBytes = 0;
+                }
+            }
+        }
+        if (lineBytes) puts("\"\n");
+        puts(")");
+        m_outFileSize += elements * elemBytes / 32 + 1;
+    }
+
     void emitVars(const AstConstPool* poolp) {
         std::vector<const AstVar*> varps;
         for (AstNode* nodep = poolp->modp()->stmtsp(); nodep; nodep = nodep->nextp()) {
@@ -90,7 +133,12 @@ class EmitCConstPool final : public EmitCConstInit {
             putns(varp, varp->dtypep()->cType(nameProtect, false, false));
             putns(varp, " = ");
             UASSERT_OBJ(varp, varp->valuep(), "Var without value");
-            iterateConst(varp->valuep());
+            if (const AstUnpackArrayDType* const dtypep = blobDTypep(varp)) {
+                emitBlob(varp, dtypep);
+                ++m_blobsEmitted;
+            } else {
+                iterateConst(varp->valuep());
+            }
             putns(varp, ";\n");
             // Keep track of stats
             if (VN_IS(varp->dtypep(), UnpackArrayDType)) {
@@ -114,6 +162,7 @@ public:
         emitVars(poolp);
         V3Stats::addStatSum("ConstPool, Tables emitted", m_tablesEmitted);
         V3Stats::addStatSum("ConstPool, Constants emitted", m_constsEmitted);
+        V3Stats::addStatSum("ConstPool, Tables emitted as blobs", m_blobsEmitted);
     }
 };
 
@@ -133,6 +133,10 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
                         needComma = true;
                     }
                     break;
+                case 'T':
+                    // As %W, but as a template argument so the width is a compile-time constant
+                    if (lhsp->isWide()) puts("<" + cvtToStr(lhsp->widthWords()) + ">");
+                    break;
                 case 'i':
                     COMMA;
                     UASSERT_OBJ(detailp, nodep, "emitOperator() references undef node");
@@ -425,9 +429,9 @@ void EmitCFunc::emitCCallArgs(const AstNodeCCall* nodep, const string& selfPoint
         if (VN_IS(nodep->backp(), CAwait) || !nodep->funcp()->isCoroutine()) {
             puts("vlProcess");
         } else if (inProcess) {
-            puts("std::make_shared<VlProcess>(vlProcess)");
+            puts("VlProcess::create(vlProcess)");
         } else {
-            puts("std::make_shared<VlProcess>()");
+            puts("VlProcess::create()");
         }
         comma = true;
     }
@@ -713,6 +717,28 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     } else if (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
         UASSERT_OBJ(adtypep->hi() >= adtypep->lo(), varp,
                     "Should have swapped msb & lsb earlier.");
+        // Pages are zeroed when first accessed, so resetting each element would defeat them
+        if (adtypep->isSparse()) {
+            return constructing ? "" : varNameProtected + suffix + ".clear();\n";
+        }
+        // Reset arrays of narrow elements with a single fill, which also computes a
+        // random reset value once, rather than for each element
+        AstNodeDType* const subDTypep = adtypep->subDTypep()->skipRefp();
+        if ((VN_IS(subDTypep, BasicDType) || VN_IS(subDTypep, EnumDType))
+            && !subDTypep->basicp()->isOpaque()) {
+            splitSizeInc(1);
+            if (!subDTypep->isWide()) {
+                const bool zeroit = emitVarResetZero(varp, subDTypep->basicp());
+                return varNameProtected + suffix + ".fill("
+                       + emitVarResetNarrowValue(varp, subDTypep, zeroit) + ");\n";
+            }
+            // Wide elements all reset to the same value too, so reset the first and copy
+            const string firstName = varNameProtected + suffix + "[0]";
+            const string first = emitVarResetRecurse(varp, constructing, varNameProtected,
+                                                     subDTypep, depth + 1, suffix + "[0]");
+            if (first.empty()) return "";
+            return first + varNameProtected + suffix + ".fill(" + firstName + ");\n";
+        }
         const string ivar = "__Vi"s + cvtToStr(depth);
         const string pre = ("for (int " + ivar + " = " + cvtToStr(0) + "; " + ivar + " < "
                             + cvtToStr(adtypep->elementsConst()) + "; ++" + ivar + ") {\n");
@@ -748,14 +774,7 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     } else if (basicp && basicp->isRandomGenerator()) {
         return "";
     } else if (basicp) {
-        const bool zeroit
-            = (varp->attrFileDescr()  // Zero so we don't do file IO if never $fopen
-               || varp->isFuncLocal()  // Randomization too slow
-               || (basicp && basicp->isZeroInit())
-               || (v3Global.opt.underlineZero() && !varp->name().empty() && varp->name()[0] == '_')
-               || (varp->isXTemp()
-                       ? (v3Global.opt.xAssign() != "unique")
-                       : (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0")));
+        const bool zeroit = emitVarResetZero(varp, basicp);
         const bool slow = !varp->isFuncLocal() && !varp->isClassMember();
         splitSizeInc(1);
         if (dtypep->isWide()) {  // Handle unpacked; not basicp->isWide
@@ -786,25 +805,8 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
             }
             return out;
         } else {
-            string out = varNameProtected + suffix;
-            // If --x-initial-edge is set, we want to force an initial
-            // edge on uninitialized clocks (from 'X' to whatever the
-            // first value is). Since the class is instantiated before
-            // initial blocks are evaluated, this should not clash
-            // with any initial block settings.
-            if (zeroit || (v3Global.opt.xInitialEdge() && varp->isUsedClock())) {
-                out += " = 0;\n";
-            } else {
-                emitVarResetScopeHash();
-                const uint64_t salt = VString::hashMurmur(varp->prettyName());
-                out += " = VL_SCOPED_RAND_RESET_";
-                if (varp->isXTemp()) out += "ASSIGN_";
-                out += dtypep->charIQWN();
-                out += "(" + cvtToStr(dtypep->widthMin()) + ", "
-                       + (m_classOrPackage ? m_classOrPackageHash : "__VscopeHash") + ", "
-                       + std::to_string(salt) + "ull);\n";
-            }
-            return out;
+            return varNameProtected + suffix + " = "
+                   + emitVarResetNarrowValue(varp, dtypep, zeroit) + ";\n";
         }
     } else {  // LCOV_EXCL_BR_LINE
         v3fatalSrc("Unknown node type in reset generator: " << varp->prettyTypeName());
@@ -812,6 +814,34 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     return "";
 }
 
+bool EmitCFunc::emitVarResetZero(const AstVar* varp, const AstBasicDType* basicp) const {
+    return (varp->attrFileDescr()  // Zero so we don't do file IO if never $fopen
+            || varp->isFuncLocal()  // Randomization too slow
+            || (basicp && basicp->isZeroInit())
+            || (v3Global.opt.underlineZero() && !varp->name().empty() && varp->name()[0] == '_')
+            || (varp->isXTemp()
+                    ? (v3Global.opt.xAssign() != "unique")
+                    : (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0")));
+}
+
+string EmitCFunc::emitVarResetNarrowValue(const AstVar* varp, AstNodeDType* dtypep, bool zeroit) {
+    // If --x-initial-edge is set, we want to force an initial
+    // edge on uninitialized clocks (from 'X' to whatever the
+    // first value is). Since the class is instantiated before
+    // initial blocks are evaluated, this should not clash
+    // with any initial block settings.
+    if (zeroit || (v3Global.opt.xInitialEdge() && varp->isUsedClock())) return "0";
+    emitVarResetScopeHash();
+    const uint64_t salt = VString::hashMurmur(varp->prettyName());
+    string out = "VL_SCOPED_RAND_RESET_";
+    if (varp->isXTemp()) out += "ASSIGN_";
+    out += dtypep->charIQWN();
+    out += "(" + cvtToStr(dtypep->widthMin()) + ", "
+           + (m_classOrPackage ? m_classOrPackageHash : "__VscopeHash") + ", "
+           + std::to_string(salt) + "ull)";
+    return out;
+}
+
 void EmitCFunc::emitVarResetScopeHash() {
     if (VL_LIKELY(m_createdScopeHash)) { return; }
     if (m_classOrPackage) {
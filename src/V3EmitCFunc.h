@@ -179,6 +179,13 @@ public:
     bool splitNeeded() const {
         return v3Global.opt.outputSplit() && m_splitSize >= v3Global.opt.outputSplit();
     }
+    // For --output-split-stable: split within a factor of two of the limit, but only before
+    // functions selected by their name, so the boundaries only move near the changed code
+    bool splitNeededStable(const AstCFunc* nextp) const {
+        const int limit = v3Global.opt.outputSplit();
+        if (!limit || m_splitSize < limit / 2) return false;
+        return m_splitSize >= 2 * limit || V3Hash{nextp->name()}.value() % 4 == 0;
+    }
 
     // METHODS
     void displayNode(AstNode* nodep, AstScopeName* scopenamep, const string& vformat,
@@ -187,6 +194,9 @@ public:
     void displayArg(AstNode* dispp, AstNode** elistp, bool isScan, const string& vfmt, bool ignore,
                     char fmtLetter);
 
+    // With --coverage-hit-once, __Vcoverage word and bit mask holding a bin's flag
+    static string coverWord(int binNum) { return cvtToStr(binNum / 32); }
+    static string coverMask(int binNum) { return "0x" + cvtToHex(1U << (binNum % 32)) + "U"; }
     bool emitSimpleOk(AstNodeExpr* nodep);
     void emitIQW(AstNode* nodep) {
         // See "Type letters" in verilated.h
@@ -226,6 +236,8 @@ public:
     string emitVarResetRecurse(const AstVar* varp, bool constructing,
                                const string& varNameProtected, AstNodeDType* dtypep, int depth,
                                const string& suffix);
+    bool emitVarResetZero(const AstVar* varp, const AstBasicDType* basicp) const;
+    string emitVarResetNarrowValue(const AstVar* varp, AstNodeDType* dtypep, bool zeroit);
     void emitVarResetScopeHash();
     void emitChangeDet();
     void emitConstInit(AstNode* initp) {
@@ -352,7 +364,7 @@ public:
         });
         if (m_instantiatesOwnProcess) {
             AstNode* const vlprocp = new AstCStmt{
-                nodep->fileline(), "VlProcessRef vlProcess = std::make_shared<VlProcess>();\n"};
+                nodep->fileline(), "VlProcessRef vlProcess = VlProcess::create();\n"};
             nodep->stmtsp()->addHereThisAsNext(vlprocp);
         }
 
@@ -640,9 +652,21 @@ public:
     }
     void visit(AstCoverDecl* nodep) override {
         putns(nodep, "vlSelf->__vlCoverInsert(");  // As Declared in emitCoverageDecl
-        puts("&(vlSymsp->__Vcoverage[");
-        puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
-        puts("])");
+        if (v3Global.opt.coverageHitOnce()) {
+            const int binNum = nodep->dataDeclThisp()->binNum();
+            puts("VerilatedCovBit{");
+            if (v3Global.opt.threads() > 1) puts("reinterpret_cast<uint32_t*>");
+            puts("(&vlSymsp->__Vcoverage[" + coverWord(binNum) + "]), " + coverMask(binNum));
+            puts("}");
+        } else if (v3Global.opt.coveragePerThread()) {
+            puts("VerilatedCovShards::Bin{&vlSymsp->__Vcoverage, ");
+            puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
+            puts("}");
+        } else {
+            puts("&(vlSymsp->__Vcoverage[");
+            puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
+            puts("])");
+        }
         // If this isn't the first instantiation of this module under this
         // design, don't really count the bucket, and rely on verilator_cov to
         // aggregate counts.  This is because Verilator combines all
@@ -666,17 +690,74 @@ public:
         putsQuoted(nodep->linescov());
         puts(");\n");
     }
-    void visit(AstCoverInc* nodep) override {
-        if (v3Global.opt.threads() > 1) {
-            putns(nodep, "vlSymsp->__Vcoverage[");
-            puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
-            puts("].fetch_add(1, std::memory_order_relaxed);\n");
+    void visit(AstCoverHit* nodep) override {
+        const int binNum = nodep->declp()->dataDeclThisp()->binNum();
+        putns(nodep, "(0U != (vlSymsp->__Vcoverage[" + coverWord(binNum) + "]");
+        if (v3Global.opt.threads() > 1) puts(".load(std::memory_order_relaxed)");
+        puts(" & " + coverMask(binNum) + "))");
+    }
+    void emitCoverInc(AstNode* nodep, const string& bin, const string& word,
+                      const string& mask) {
+        if (v3Global.opt.coverageHitOnce()) {
+            const string wordp = "vlSymsp->__Vcoverage[" + word + "]";
+            if (v3Global.opt.threads() > 1) {
+                // Test first so the shared word is only written on the first hit
+                putns(nodep, "if (VL_UNLIKELY(0U == (" + wordp
+                                 + ".load(std::memory_order_relaxed) & " + mask + "))) {\n");
+                puts(wordp + ".fetch_or(" + mask + ", std::memory_order_relaxed);\n");
+                puts("}\n");
+            } else {
+                putns(nodep, wordp + " |= " + mask + ";\n");
+            }
+        } else if (v3Global.opt.coveragePerThread()) {
+            putns(nodep, "++(vlSymsp->__Vcoverage.threadCountsp()[" + bin + "]);\n");
+        } else if (v3Global.opt.threads() > 1) {
+            putns(nodep, "vlSymsp->__Vcoverage[" + bin
+                             + "].fetch_add(1, std::memory_order_relaxed);\n");
         } else {
-            putns(nodep, "++(vlSymsp->__Vcoverage[");
-            puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
-            puts("]);\n");
+            putns(nodep, "++(vlSymsp->__Vcoverage[" + bin + "]);\n");
         }
     }
+    void visit(AstCoverInc* nodep) override {
+        const int binNum = nodep->declp()->dataDeclThisp()->binNum();
+        emitCoverInc(nodep, cvtToStr(binNum), coverWord(binNum), coverMask(binNum));
+    }
+    void visit(AstCoverIncBits* nodep) override {
+        // Walk only the set bits, rather than testing every bit
+        std::vector<int> bins;
+        for (const AstCoverInc* incp = nodep->incsp(); incp;
+             incp = VN_AS(incp->nextp(), CoverInc)) {
+            bins.push_back(incp->declp()->dataDeclThisp()->binNum());
+        }
+        bool contiguous = true;
+        for (size_t i = 1; i < bins.size(); ++i) {
+            if (bins[i] != bins[0] + static_cast<int>(i)) contiguous = false;
+        }
+        putns(nodep, "{\n");
+        if (!contiguous) {
+            // Joined points are scattered, so look them up
+            puts("static const uint32_t __Vcovbins[] = {");
+            for (size_t i = 0; i < bins.size(); ++i) {
+                if (i) puts(", ");
+                puts(cvtToStr(bins[i]));
+            }
+            puts("};\n");
+        }
+        const bool isQuad = nodep->bitsp()->isQuad();
+        puts(isQuad ? "QData" : "IData");
+        puts(" __Vcovbits = ");
+        iterateConst(nodep->bitsp());
+        puts(";\n");
+        puts("while (__Vcovbits) {\n");
+        puts("const uint32_t __Vcovbin = ");
+        const string ctz = string{isQuad ? "VL_CTZ_Q" : "VL_CTZ_I"} + "(__Vcovbits)";
+        puts(contiguous ? cvtToStr(bins[0]) + "U + " + ctz : "__Vcovbins[" + ctz + "]");
+        puts(";\n");
+        emitCoverInc(nodep, "__Vcovbin", "__Vcovbin / 32U", "(1U << (__Vcovbin % 32U))");
+        puts("__Vcovbits &= __Vcovbits - 1;\n");
+        puts("}\n");
+        puts("}\n");
+    }
     void visit(AstDisableFork* nodep) override { putns(nodep, "vlProcess->disableFork();\n"); }
     void visit(AstCReturn* nodep) override {
         putns(nodep, "return (");
@@ -835,7 +916,10 @@ public:
         emitCvtPackStr(nodep->filenamep());
         putbs(", ");
         {
-            const bool need_ptr = !VN_IS(nodep->memp()->dtypep(), AssocArrayDType);
+            const AstUnpackArrayDType* const adtypep
+                = VN_CAST(nodep->memp()->dtypep()->skipRefp(), UnpackArrayDType);
+            const bool need_ptr = !VN_IS(nodep->memp()->dtypep(), AssocArrayDType)
+                                  && !(adtypep && adtypep->isSparse());
             if (need_ptr) puts(" &(");
             iterateAndNextConstNull(nodep->memp());
             if (need_ptr) puts(")");
@@ -992,6 +1076,7 @@ public:
     void visit(AstWhile* nodep) override {
         VL_RESTORER(m_createdScopeHash);
         iterateAndNextConstNull(nodep->precondsp());
+        if (nodep->independent()) putns(nodep, "VL_LOOP_INDEPENDENT\n");
         putns(nodep, "while (");
         iterateAndNextConstNull(nodep->condp());
         puts(") {\n");
@@ -1068,18 +1153,18 @@ public:
         emitOpName(nodep, nodep->emitC(), nullptr, nullptr, nullptr);
     }
     void visit(AstTime* nodep) override {
-        putns(nodep, "VL_TIME_UNITED_Q(");
+        putns(nodep, "VL_TIME_UNITED_Q_CTX(");
         UASSERT_OBJ(!nodep->timeunit().isNone(), nodep, "$time has no units");
         puts(cvtToStr(nodep->timeunit().multiplier()
                       / v3Global.rootp()->timeprecision().multiplier()));
-        puts(")");
+        puts(", vlSymsp->_vm_contextp__)");
     }
     void visit(AstTimeD* nodep) override {
-        putns(nodep, "VL_TIME_UNITED_D(");
+        putns(nodep, "VL_TIME_UNITED_D_CTX(");
         UASSERT_OBJ(!nodep->timeunit().isNone(), nodep, "$realtime has no units");
         puts(cvtToStr(nodep->timeunit().multiplier()
                       / v3Global.rootp()->timeprecision().multiplier()));
-        puts(")");
+        puts(", vlSymsp->_vm_contextp__)");
     }
     void visit(AstTimeFormat* nodep) override {
         putns(nodep, "VL_TIMEFORMAT_IINI(");
@@ -1203,6 +1288,20 @@ public:
             emitOpName(nodep, nodep->emitC(), nodep->lhsp(), nodep->rhsp(), nullptr);
         }
     }
+    void visit(AstArraySel* nodep) override {
+        const AstVarRef* const refp = VN_CAST(nodep->fromp(), VarRef);
+        const AstUnpackArrayDType* const adtypep
+            = refp ? VN_CAST(refp->dtypep()->skipRefp(), UnpackArrayDType) : nullptr;
+        if (adtypep && adtypep->isSparse() && refp->access().isReadOnly()) {
+            // Reading an element never written must not allocate its page
+            iterateConst(nodep->fromp());
+            puts(".get(");
+            iterateConst(nodep->bitp());
+            puts(")");
+            return;
+        }
+        visit(static_cast<AstNodeBiop*>(nodep));
+    }
     void visit(AstNodeTriop* nodep) override {
         UASSERT_OBJ(!emitSimpleOk(nodep), nodep, "Triop cannot be described in a simple way");
         emitOpName(nodep, nodep->emitC(), nodep->lhsp(), nodep->rhsp(), nodep->thsp());
@@ -19,10 +19,12 @@
 #include "V3EmitC.h"
 #include "V3EmitCConstInit.h"
 #include "V3File.h"
+#include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
 #include <algorithm>
 #include <cstdint>
+#include <list>
 #include <set>
 #include <string>
 #include <vector>
@@ -52,6 +54,11 @@ class EmitCHeader final : public EmitCConstInit {
             }
         }
     }
+    void emitDesignVarDecl(const AstVar* varp) {
+        // Start of a group written by another thread, see V3VariableOrder
+        if (varp->cacheLineAlign()) puts("alignas(VL_CACHE_LINE_BYTES) ");
+        emitVarDecl(varp);
+    }
     void emitDesignVarDecls(const AstNodeModule* modp) {
         bool first = true;
         std::vector<const AstVar*> varList;
@@ -88,7 +95,7 @@ class EmitCHeader final : public EmitCConstInit {
                         for (int l1 = 0; l1 < anonL1s && it != varList.cend(); ++l1) {
                             if (anonL1s != 1) puts("struct {\n");
                             for (int l0 = 0; l0 < lim && it != varList.cend(); ++l0) {
-                                emitVarDecl(*it);
+                                emitDesignVarDecl(*it);
                                 ++it;
                             }
                             if (anonL1s != 1) puts("};\n");
@@ -98,9 +105,9 @@ class EmitCHeader final : public EmitCConstInit {
                     if (anonL3s != 1) puts("};\n");
                 }
                 // Leftovers, just in case off by one error somewhere above
-                for (; it != varList.cend(); ++it) emitVarDecl(*it);
+                for (; it != varList.cend(); ++it) emitDesignVarDecl(*it);
             } else {  // Output as nonanons
-                for (const auto& pair : varList) emitVarDecl(pair);
+                for (const auto& pair : varList) emitDesignVarDecl(pair);
             }
 
             varList.clear();
@@ -174,8 +181,15 @@ class EmitCHeader final : public EmitCConstInit {
         if (v3Global.opt.coverage() && !VN_IS(modp, Class)) {
             decorateFirst(first, section);
             puts("void __vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
+            if (v3Global.opt.coverageHitOnce()) {
+                puts("VerilatedCovBit countp");
+            } else if (v3Global.opt.coveragePerThread()) {
+                puts("VerilatedCovShards::Bin countp");
+            } else {
+                puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+                puts("* countp");
+            }
+            puts(", bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp);\n");
         }
@@ -184,6 +198,8 @@ class EmitCHeader final : public EmitCConstInit {
             decorateFirst(first, section);
             puts("void " + protect("__Vserialize") + "(VerilatedSerialize& os);\n");
             puts("void " + protect("__Vdeserialize") + "(VerilatedDeserialize& os);\n");
+            puts("void " + protect("__Vcopy") + "(const " + prefixNameProtect(modp)
+                 + "& rhs);\n");
         }
     }
     void emitEnums(const AstNodeModule* modp) {
@@ -604,12 +620,14 @@ class EmitCHeader final : public EmitCConstInit {
         emitTextSection(modp, VNType::atScHdrPost);
     }
 
-    explicit EmitCHeader(const AstNodeModule* modp) {
+    EmitCHeader(const AstNodeModule* modp, AstCFile*& cfilepr) {
         UINFO(5, "  Emitting header for " << prefixNameProtect(modp));
 
         // Open output file
         const string filename = v3Global.opt.makeDir() + "/" + prefixNameProtect(modp) + ".h";
-        AstCFile* const cfilep = newCFile(filename, /* slow: */ false, /* source: */ false);
+        // Added to the netlist by the caller, as headers are emitted in parallel
+        AstCFile* const cfilep = createCFile(filename, /* slow: */ false, /* source: */ false);
+        cfilepr = cfilep;
         V3OutCFile* const ofilep
             = v3Global.opt.systemC() ? new V3OutScFile{filename} : new V3OutCFile{filename};
 
@@ -658,7 +676,9 @@ class EmitCHeader final : public EmitCConstInit {
     ~EmitCHeader() override = default;
 
 public:
-    static void main(const AstNodeModule* modp) { EmitCHeader emitCHeader{modp}; }
+    static void main(const AstNodeModule* modp, AstCFile*& cfilepr) VL_MT_STABLE {
+        EmitCHeader{modp, cfilepr};
+    }
 };
 
 //######################################################################
@@ -667,9 +687,18 @@ public:
 void V3EmitC::emitcHeaders() {
     UINFO(2, __FUNCTION__ << ":");
 
+    std::list<AstCFile*> cfiles;
+    V3ThreadScope threadScope;
+
     // Process each module in turn
     for (const AstNode* nodep = v3Global.rootp()->modulesp(); nodep; nodep = nodep->nextp()) {
         if (VN_IS(nodep, Class)) continue;  // Declared with the ClassPackage
-        EmitCHeader::main(VN_AS(nodep, NodeModule));
+        const AstNodeModule* const modp = VN_AS(nodep, NodeModule);
+        cfiles.emplace_back(nullptr);
+        AstCFile*& cfilepr = cfiles.back();
+        threadScope.enqueue([modp, &cfilepr] { EmitCHeader::main(modp, cfilepr); });
     }
+    // Wait for futures
+    threadScope.wait();
+    for (AstCFile* const cfilep : cfiles) v3Global.rootp()->addFilesp(cfilep);
 }
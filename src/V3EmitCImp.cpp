@@ -18,6 +18,7 @@
 
 #include "V3EmitC.h"
 #include "V3EmitCFunc.h"
+#include "V3Stats.h"
 #include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
@@ -283,9 +284,13 @@ class EmitCImp final : EmitCFunc {
 
         puts(" {\n");
 
+        if (v3Global.opt.profStartup()) puts("vlSymsp->__Vm_startupProfiler.push();\n");
         putsDecoration(modp, "// Reset structure values\n");
         puts(modName + "__" + protect("_ctor_var_reset") + "(this);\n");
         emitTextSection(modp, VNType::atScCtor);
+        if (v3Global.opt.profStartup()) {
+            puts("vlSymsp->__Vm_startupProfiler.pop(\"ctor " + modName + "\");\n");
+        }
 
         puts("}\n");
     }
@@ -312,27 +317,45 @@ class EmitCImp final : EmitCFunc {
             // Rather than putting out VL_COVER_INSERT calls directly, we do it via this
             // function. This gets around gcc slowness constructing all of the template
             // arguments.
+            const bool hitOnce = v3Global.opt.coverageHitOnce();
+            const bool perThread = v3Global.opt.coveragePerThread();
             puts("void " + prefixNameProtect(m_modp) + "::__vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
+            if (hitOnce) {
+                puts("VerilatedCovBit countp");
+            } else if (perThread) {
+                puts("VerilatedCovShards::Bin countp");
+            } else {
+                puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+                puts("* countp");
+            }
+            puts(", bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp) "
                  "{\n");
-            if (v3Global.opt.threads() > 1) {
-                puts("assert(sizeof(uint32_t) == sizeof(std::atomic<uint32_t>));\n");
-                puts("uint32_t* count32p = reinterpret_cast<uint32_t*>(countp);\n");
-            } else {
-                puts("uint32_t* count32p = countp;\n");
+            // Inserting a VerilatedCovBit or VerilatedCovShards::Bin zeros it, so no count32p
+            if (!hitOnce && !perThread) {
+                if (v3Global.opt.threads() > 1) {
+                    puts("assert(sizeof(uint32_t) == sizeof(std::atomic<uint32_t>));\n");
+                    puts("uint32_t* count32p = reinterpret_cast<uint32_t*>(countp);\n");
+                } else {
+                    puts("uint32_t* count32p = countp;\n");
+                }
+                // static doesn't need save-restore as is constant
+                puts("static uint32_t fake_zero_count = 0;\n");
             }
-            // static doesn't need save-restore as is constant
-            puts("static uint32_t fake_zero_count = 0;\n");
             puts("std::string fullhier = std::string{VerilatedModule::name()} + hierp;\n");
             puts("if (!fullhier.empty() && fullhier[0] == '.') fullhier = fullhier.substr(1);\n");
             // Used for second++ instantiation of identical bin
-            puts("if (!enable) count32p = &fake_zero_count;\n");
-            puts("*count32p = 0;\n");
+            if (hitOnce) {
+                puts("if (!enable) countp.m_wordp = nullptr;\n");
+            } else if (perThread) {
+                puts("if (!enable) countp.m_shardsp = nullptr;\n");
+            } else {
+                puts("if (!enable) count32p = &fake_zero_count;\n");
+                puts("*count32p = 0;\n");
+            }
             puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), VerilatedModule::name(), "
-                 "count32p,");
+                 + std::string{hitOnce || perThread ? "countp," : "count32p,"});
             puts("  \"filename\",filenamep,");
             puts("  \"lineno\",lineno,");
             puts("  \"column\",column,\n");
@@ -351,6 +374,30 @@ class EmitCImp final : EmitCFunc {
         puts("}\n");
         splitSizeInc(10);
     }
+    static bool isSavableFlat(const AstVar* varp) {
+        // True if an unpacked array with elements that are stored as plain numbers,
+        // or a wide number, so is contiguous in memory
+        const AstNodeDType* elementp = varp->dtypeSkipRefp();
+        if (!VN_IS(elementp, UnpackArrayDType) && !elementp->isWide()) return false;
+        while (const AstUnpackArrayDType* const arrayp = VN_CAST(elementp, UnpackArrayDType)) {
+            elementp = arrayp->subDTypep()->skipRefp();
+        }
+        const AstBasicDType* const basicp = VN_CAST(elementp, BasicDType);
+        return basicp && (basicp->keyword().isIntNumeric() || basicp->isDouble());
+    }
+    bool isSavableVar(const AstNodeModule* modp, const AstVar* varp) {
+        // True if the variable is part of the saved state
+        if (varp->isIO() && modp->isTop() && optSystemC()) {
+            // System C top I/O doesn't need loading, as the
+            // lower level subinst code does it.
+            return false;
+        }
+        if (varp->isParam()) return false;
+        if (varp->isStatic() && varp->isConst()) return false;
+        if (varp->basicp() && varp->basicp()->isTriggerVec()) return false;
+        if (VN_IS(varp->dtypep(), NBACommitQueueDType)) return false;
+        return true;
+    }
     void emitSavableImp(const AstNodeModule* modp) {
         if (v3Global.opt.savable()) {
             puts("\n// Savable\n");
@@ -388,13 +435,18 @@ class EmitCImp final : EmitCFunc {
                 // Save all members
                 for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
                     if (const AstVar* const varp = VN_CAST(nodep, Var)) {
-                        if (varp->isIO() && modp->isTop() && optSystemC()) {
-                            // System C top I/O doesn't need loading, as the
-                            // lower level subinst code does it.
-                        } else if (varp->isParam()) {
-                        } else if (varp->isStatic() && varp->isConst()) {
-                        } else if (varp->basicp() && varp->basicp()->isTriggerVec()) {
-                        } else if (VN_IS(varp->dtypep(), NBACommitQueueDType)) {
+                        const AstUnpackArrayDType* const adtypep
+                            = VN_CAST(varp->dtypeSkipRefp(), UnpackArrayDType);
+                        if (!isSavableVar(modp, varp)) {
+                        } else if (adtypep && adtypep->isSparse()) {
+                            // Only the pages that were accessed
+                            putns(varp, "os" + op + varp->nameProtect() + ";\n");
+                        } else if (isSavableFlat(varp)) {
+                            // Contiguous plain numbers, so serialize in one call,
+                            // in the same format as by element or by word
+                            putns(varp, "os." + std::string{de ? "read" : "write"} + "(&"
+                                            + varp->nameProtect() + ", sizeof("
+                                            + varp->nameProtect() + "));\n");
                         } else {
                             int vects = 0;
                             AstNodeDType* elementp = varp->dtypeSkipRefp();
@@ -432,6 +484,18 @@ class EmitCImp final : EmitCFunc {
 
                 puts("}\n");
             }
+
+            // Copy the same state from another instance of the module
+            putns(modp, "void " + prefixNameProtect(modp) + "::" + protect("__Vcopy") + "(const "
+                            + prefixNameProtect(modp) + "& rhs) {\n");
+            for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+                const AstVar* const varp = VN_CAST(nodep, Var);
+                if (!varp || !isSavableVar(modp, varp)) continue;
+                // Do not copy MTask state, only matters within an evaluation
+                if (varp->basicp() && varp->basicp()->keyword().isMTaskState()) continue;
+                putns(varp, varp->nameProtect() + " = rhs." + varp->nameProtect() + ";\n");
+            }
+            puts("}\n");
         }
     }
     // Predicate to check if we actually need to emit anything into the common implementation file.
@@ -535,13 +599,16 @@ class EmitCImp final : EmitCFunc {
 
     // VISITORS
     void visit(AstCFunc* nodep) override {
-        if (splitNeeded()) {
+        const bool stable = v3Global.opt.outputSplitStable();
+        if (stable ? splitNeededStable(nodep) : splitNeeded()) {
             // Splitting file, so using parallel build.
             v3Global.useParallelBuild(true);
             // Close old file
             closeOutputFile();
-            // Open a new file
-            openNextOutputFile(*m_requiredHeadersp, m_subFileName);
+            // Open a new file, if stable named by its first function, not by sequence number
+            const string subFileName
+                = stable ? m_subFileName + "__" + V3Hash{nodep->name()}.toString() : m_subFileName;
+            openNextOutputFile(*m_requiredHeadersp, subFileName);
         }
 
         EmitCFunc::visit(nodep);
@@ -981,6 +1048,7 @@ public:
 
 void V3EmitC::emitcImp() {
     UINFO(2, __FUNCTION__ << ":");
+    const V3StatsTraceScope traceScope{"V3EmitC::emitcImp"};
     // Make parent module pointers available.
     const EmitCParentModule emitCParentModule;
     std::list<std::deque<AstCFile*>> cfiles;
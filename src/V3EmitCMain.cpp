@@ -59,6 +59,7 @@ private:
         puts("\n");
 
         puts("#include \"verilated.h\"\n");
+        if (v3Global.opt.fuzzServer()) puts("#include \"verilated_fuzz.h\"\n");
         puts("#include \"" + topClassName() + ".h\"\n");
 
         puts("\n//======================\n\n");
@@ -76,6 +77,17 @@ private:
              + "{contextp.get(), \"" + topName + "\"}};\n");
         puts("\n");
 
+        if (v3Global.opt.fuzzServer()) {
+            puts("// Run initial blocks, then in each run forked for a fuzzer,"
+                 " continue from here\n");
+            puts("topp->eval();\n");
+            puts("VerilatedFuzzServer::serve(contextp.get());\n");
+            if (v3Global.opt.coverage()) {
+                puts("if (VerilatedFuzzServer::child()) contextp->coveragep()->zero();\n");
+            }
+            puts("\n");
+        }
+
         puts("// Simulate until $finish\n");
         puts("while (VL_LIKELY(!contextp->gotFinish())) {\n");
         puts(/**/ "// Evaluate model\n");
@@ -102,9 +114,22 @@ private:
         puts("topp->final();\n");
         puts("\n");
 
+        if (v3Global.opt.coverage() && v3Global.opt.fuzzServer()) {
+            puts("// Report coverage to the fuzzer, if any (since Verilated with"
+                 " --fuzz-server)\n");
+            puts("size_t fuzzMapSize = 0;\n");
+            puts("if (uint8_t* const fuzzMapp = VerilatedFuzzServer::mapp(fuzzMapSize)) {\n");
+            puts(/**/ "contextp->coveragep()->hitMap(fuzzMapp, fuzzMapSize);\n");
+            puts("}\n");
+            puts("\n");
+        }
         if (v3Global.opt.coverage()) {
             puts("// Write coverage data (since Verilated with --coverage)\n");
-            puts("contextp->coveragep()->write();\n");
+            if (v3Global.opt.fuzzServer()) {
+                puts("if (!VerilatedFuzzServer::child()) contextp->coveragep()->write();\n");
+            } else {
+                puts("contextp->coveragep()->write();\n");
+            }
             puts("\n");
         }
 
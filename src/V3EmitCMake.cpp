@@ -122,6 +122,8 @@ class CMakeEmitter final {
         cmake_set_raw(*of, name + "_THREADS", cvtToStr(v3Global.opt.threads()));
         *of << "# FST Tracing output mode? 0/1 (from --trace-fst)\n";
         cmake_set_raw(*of, name + "_TRACE_FST", (v3Global.opt.traceEnabledFst()) ? "1" : "0");
+        *of << "# Raw Tracing output mode? 0/1 (from --trace-raw)\n";
+        cmake_set_raw(*of, name + "_TRACE_RAW", (v3Global.opt.traceEnabledRaw()) ? "1" : "0");
         *of << "# SAIF Tracing output mode? 0/1 (from --trace-saif)\n";
         cmake_set_raw(*of, name + "_TRACE_SAIF", (v3Global.opt.traceEnabledSaif()) ? "1" : "0");
         *of << "# VCD Tracing output mode?  0/1 (from --trace-vcd)\n";
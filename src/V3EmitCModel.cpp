@@ -32,6 +32,7 @@ class EmitCModel final : public EmitCFunc {
 
     // MEMBERS
     V3UniqueNames m_uniqueNames;  // For generating unique file names
+    std::vector<const AstVar*> m_skipInputps;  // Inputs checked by --eval-skip-unchanged
 
     // METHODS
     CFuncVector findFuncps(std::function<bool(const AstCFunc*)> cb) {
@@ -46,6 +47,33 @@ class EmitCModel final : public EmitCFunc {
         return funcps;
     }
 
+    // Inputs whose previous values are compared to skip unchanged evals, or empty if the
+    // model can change other than through its inputs (--eval-skip-unchanged)
+    static std::vector<const AstVar*> findSkipInputps(const AstNodeModule* modp) {
+        std::vector<const AstVar*> varps;
+        if (!v3Global.opt.evalSkipUnchanged()) return varps;
+        if (v3Global.usesTiming() || v3Global.opt.systemC() || v3Global.dpi()
+            || v3Global.opt.vpi() || v3Global.opt.publicFlatRW()) {
+            return varps;
+        }
+        bool rwPublic = false;
+        v3Global.rootp()->foreach([&](const AstVar* varp) {  //
+            if (varp->isSigUserRWPublic()) rwPublic = true;
+        });
+        if (rwPublic) return varps;
+        for (const AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+            const AstVar* const varp = VN_CAST(nodep, Var);
+            if (!varp || !varp->isPrimaryInish()) continue;
+            if (!varp->dtypeSkipRefp()->isIntegralOrPacked()) {
+                varps.clear();
+                return varps;
+            }
+            varps.push_back(varp);
+        }
+        if (varps.empty()) UINFO(4, "No inputs, not skipping unchanged evals");
+        return varps;
+    }
+
     void putSectionDelimiter(const string& name) {
         puts("\n");
         puts("//============================================================\n");
@@ -99,6 +127,14 @@ class EmitCModel final : public EmitCFunc {
 
         puts("// Symbol table holding complete model state (owned by this class)\n");
         puts(symClassName() + "* const vlSymsp;\n");
+        if (!m_skipInputps.empty()) {
+            puts("// Input values at the previous eval (for --eval-skip-unchanged)\n");
+            for (const AstVar* const varp : m_skipInputps) {
+                putns(varp, varp->dtypep()->cType("__Vm_prev_" + varp->nameProtect(), false,
+                                                  false)
+                                + ";\n");
+            }
+        }
 
         puts("\n");
         ofp()->putsPrivate(false);  // public:
@@ -211,6 +247,13 @@ class EmitCModel final : public EmitCFunc {
         puts("bool eventsPending();\n");
         puts("/// Returns time at next time slot. Aborts if !eventsPending()\n");
         puts("uint64_t nextTimeSlot();\n");
+        if (!optSystemC()) {
+            puts("/// Run clock cycles without returning to the application: toggles the\n");
+            puts("/// given clock input twice per cycle, evaluating after each toggle and\n");
+            puts("/// then advancing time by halfPeriod.  Stops early on $finish.\n");
+            puts("/// Returns the number of cycles run.\n");
+            puts("uint64_t run(uint64_t cycles, CData& clock, uint64_t halfPeriod = 1);\n");
+        }
 
         if (v3Global.opt.trace() || !optSystemC()) {
             puts("/// Trace signals in the model; called by application code\n");
@@ -246,6 +289,9 @@ class EmitCModel final : public EmitCFunc {
                  + topClassName() + "& rhs);\n");
             puts("friend VerilatedDeserialize& operator>>(VerilatedDeserialize& os, "
                  + topClassName() + "& rhs);\n");
+            puts("/// Copy the model state from another instance of the same model, as if\n");
+            puts("/// saved and restored. The VerilatedContext state is not copied.\n");
+            puts("void restoreFrom(const " + topClassName() + "& rhs);\n");
         }
 
         puts("\n// Abstract methods from VerilatedModel\n");
@@ -273,6 +319,86 @@ class EmitCModel final : public EmitCFunc {
         closeOutputFile();
     }
 
+    void emitLanesHeader(AstNodeModule* modp) {
+        UASSERT(!ofp(), "Output file should not be open");
+
+        const string className = topClassName() + "__Lanes";
+        const string filename = v3Global.opt.makeDir() + "/" + className + ".h";
+        setOutputFile(new V3OutCFile{filename},
+                      newCFile(filename, /* slow: */ false, /* source: */ false));
+
+        ofp()->putsHeader();
+        puts("// DESCRIPTION: Verilator output: Lanes of independent model instances\n");
+        puts("//\n");
+        puts("// This header declares a container of --lanes instances of the model,\n");
+        puts("// evaluated in lock-step.  See the Verilator manual for details.\n");
+
+        ofp()->putsGuard();
+
+        puts("\n");
+        puts("#include \"" + topClassName() + ".h\"\n");
+        puts("\n");
+        puts("#include <array>\n");
+        puts("#include <memory>\n");
+        puts("#include <string>\n");
+
+        const string lanes = std::to_string(v3Global.opt.lanes());
+        puts("\n");
+        puts("// This class holds the model instances of all lanes\n");
+        putns(modp, "class " + className + " final {\n");
+        ofp()->resetPrivate();
+        ofp()->putsPrivate(true);  // private:
+        puts("// Model instance of each lane (owned by this class)\n");
+        puts("std::array<std::unique_ptr<" + topClassName() + ">, " + lanes + "> m_lanesp;\n");
+
+        puts("\n");
+        ofp()->putsPrivate(false);  // public:
+        puts("/// Number of lanes, as set by --lanes\n");
+        puts("static constexpr size_t lanes = " + lanes + ";\n");
+
+        puts("\n// CONSTRUCTORS\n");
+        puts("/// Construct the lanes; called by application code\n");
+        puts("/// Lane i of the model is named \"<name>.lane<i>\"\n");
+        puts("explicit " + className
+             + "(VerilatedContext* contextp, const char* name = \"TOP\") {\n");
+        puts("for (size_t i = 0; i < lanes; ++i) {\n");
+        puts("const std::string laneName = std::string{name} + \".lane\" + std::to_string(i);\n");
+        puts("m_lanesp[i].reset(new " + topClassName() + "{contextp, laneName.c_str()});\n");
+        puts("}\n");
+        puts("}\n");
+        puts("explicit " + className + "(const char* name = \"TOP\")\n");
+        puts(": " + className + "{Verilated::threadContextp(), name} {}\n");
+        puts("/// Destroy the lanes; called (often implicitly) by application code\n");
+        puts("~" + className + "() = default;\n");
+        ofp()->putsPrivate(true);
+        puts("VL_UNCOPYABLE(" + className + ");  ///< Copying not allowed\n");
+
+        puts("\n");
+        ofp()->putsPrivate(false);  // public:
+        puts("// API METHODS\n");
+        puts("/// Return the model of the given lane, for access to its ports\n");
+        puts(topClassName() + "& lane(size_t i) { return *m_lanesp[i]; }\n");
+        puts("const " + topClassName() + "& lane(size_t i) const { return *m_lanesp[i]; }\n");
+        puts("/// Evaluate all lanes.  Application must call when inputs change.\n");
+        puts("void eval() {\n");
+        puts("for (const auto& modelp : m_lanesp) modelp->eval_step();\n");
+        puts("for (const auto& modelp : m_lanesp) modelp->eval_end_step();\n");
+        puts("}\n");
+        puts("/// Simulation complete, run final blocks of all lanes.  Application\n");
+        puts("/// must call on completion.\n");
+        puts("void final() {\n");
+        puts("for (const auto& modelp : m_lanesp) modelp->final();\n");
+        puts("}\n");
+        puts("/// Return the context shared by all lanes\n");
+        puts("VerilatedContext* contextp() const { return m_lanesp[0]->contextp(); }\n");
+
+        puts("};\n");
+
+        ofp()->putsEndGuard();
+
+        closeOutputFile();
+    }
+
     void emitConstructorImplementation(AstNodeModule* modp) {
         putSectionDelimiter("Constructors");
 
@@ -419,6 +545,27 @@ class EmitCModel final : public EmitCFunc {
              + "(&(vlSymsp->TOP));\n");
         puts("#endif  // VL_DEBUG\n");
 
+        if (!m_skipInputps.empty()) {
+            putsDecoration(nullptr, "// Skip evaluation if no input changed since last eval\n");
+            puts("if (VL_LIKELY(vlSymsp->__Vm_didInit)\n");
+            puts("&& !(");
+            bool first = true;
+            for (const AstVar* const varp : m_skipInputps) {
+                if (!first) puts("\n|| ");
+                first = false;
+                const string name = varp->nameProtect();
+                putns(varp, "vlSymsp->TOP." + name + " != __Vm_prev_" + name);
+            }
+            puts(")) {\n");
+            puts("VL_DEBUG_IF(VL_DBG_MSGF(\"+ Inputs unchanged, skipping eval\\n\"););\n");
+            puts("return;\n");
+            puts("}\n");
+            for (const AstVar* const varp : m_skipInputps) {
+                const string name = varp->nameProtect();
+                putns(varp, "__Vm_prev_" + name + " = vlSymsp->TOP." + name + ";\n");
+            }
+        }
+
         if (v3Global.opt.trace()) puts("vlSymsp->__Vm_activity = true;\n");
 
         if (v3Global.hasEvents()) puts("vlSymsp->clearTriggeredEvents();\n");
@@ -427,16 +574,35 @@ class EmitCModel final : public EmitCFunc {
         puts("if (VL_UNLIKELY(!vlSymsp->__Vm_didInit)) {\n");
         puts("vlSymsp->__Vm_didInit = true;\n");
         puts("VL_DEBUG_IF(VL_DBG_MSGF(\"+ Initial\\n\"););\n");
-        puts(topModNameProtected + "__" + protect("_eval_static") + "(&(vlSymsp->TOP));\n");
-        puts(topModNameProtected + "__" + protect("_eval_initial") + "(&(vlSymsp->TOP));\n");
-        puts(topModNameProtected + "__" + protect("_eval_settle") + "(&(vlSymsp->TOP));\n");
+        for (const string& phase : std::vector<string>{"static", "initial", "settle"}) {
+            if (v3Global.opt.profStartup()) puts("vlSymsp->__Vm_startupProfiler.push();\n");
+            puts(topModNameProtected + "__" + protect("_eval_" + phase) + "(&(vlSymsp->TOP));\n");
+            if (v3Global.opt.profStartup()) {
+                puts("vlSymsp->__Vm_startupProfiler.pop(\"eval " + phase + "\");\n");
+            }
+        }
+        if (v3Global.opt.profStartup()) {
+            puts("vlSymsp->__Vm_startupProfiler.write(\"" + topClassName()
+                 + "\", vlSymsp->_vm_contextp__->profExecFilename());\n");
+        }
         puts("}\n");
 
         if (v3Global.opt.profExec() && !v3Global.opt.hierChild())
             puts("vlSymsp->__Vm_executionProfilerp->configure();\n");
 
         puts("VL_DEBUG_IF(VL_DBG_MSGF(\"+ Eval\\n\"););\n");
+        // Hierarchical blocks are evaluated within their parent's eval, so not counted again
+        const bool metrics = !v3Global.opt.hierChild();
+        if (metrics) {
+            puts("const uint64_t __VmetricsStartNs"
+                 " = vlSymsp->_vm_contextp__->metricsEvalBegin();\n");
+        }
         puts(topModNameProtected + "__" + protect("_eval") + "(&(vlSymsp->TOP));\n");
+        if (metrics) puts("vlSymsp->_vm_contextp__->metricsEvalEnd(__VmetricsStartNs);\n");
+        if (v3Global.dpi() && v3Global.opt.dpiDeferreds()) {
+            putsDecoration(nullptr, "// Complete --dpi-deferred calls before returning\n");
+            puts("VerilatedDpiDeferred::join();\n");
+        }
 
         putsDecoration(nullptr, "// Evaluate cleanup\n");
         puts("Verilated::endOfEval(vlSymsp->__Vm_evalMsgQp);\n");
@@ -444,6 +610,36 @@ class EmitCModel final : public EmitCFunc {
         puts("}\n");
     }
 
+    void emitRun(AstNodeModule* modp) {
+        // ::run
+        const bool delays = v3Global.rootp()->delaySchedulerp();
+        puts("\n");
+        putns(modp, "uint64_t " + topClassName()
+                        + "::run(uint64_t cycles, CData& clock, uint64_t halfPeriod) {\n");
+        puts("VerilatedContext* const contextp = vlSymsp->_vm_contextp__;\n");
+        puts("for (uint64_t cycle = 0; cycle < cycles; ++cycle) {\n");
+        puts("for (int edge = 0; edge < 2; ++edge) {\n");
+        puts("clock = !clock;\n");
+        puts("eval();\n");
+        puts("if (VL_UNLIKELY(contextp->gotFinish())) return cycle + 1;\n");
+        if (delays) {
+            putsDecoration(nullptr, "// Evaluate delayed events due before the next toggle\n");
+            puts("const uint64_t toggleTime = contextp->time() + halfPeriod;\n");
+            puts("while (eventsPending() && nextTimeSlot() < toggleTime) {\n");
+            puts("contextp->time(nextTimeSlot());\n");
+            puts("eval();\n");
+            puts("if (VL_UNLIKELY(contextp->gotFinish())) return cycle + 1;\n");
+            puts("}\n");
+            puts("contextp->time(toggleTime);\n");
+        } else {
+            puts("contextp->timeInc(halfPeriod);\n");
+        }
+        puts("}\n");
+        puts("}\n");
+        puts("return cycles;\n");
+        puts("}\n");
+    }
+
     void emitStandardMethods2(AstNodeModule* modp) {
         const string topModNameProtected = prefixNameProtect(modp);
         const string selfDecl = "(" + topModNameProtected + "* vlSelf)";
@@ -478,6 +674,8 @@ class EmitCModel final : public EmitCFunc {
             puts("return 0;\n}\n");
         }
 
+        if (!optSystemC()) emitRun(modp);
+
         putSectionDelimiter("Utilities");
 
         if (!optSystemC()) {
@@ -496,6 +694,7 @@ class EmitCModel final : public EmitCFunc {
         // ::final
         puts("\nVL_ATTR_COLD void " + topClassName() + "::final() {\n");
         puts(/**/ topModNameProtected + "__" + protect("_eval_final") + "(&(vlSymsp->TOP));\n");
+        if (v3Global.dpi() && v3Global.opt.dpiDeferreds()) puts("VerilatedDpiDeferred::join();\n");
         puts("}\n");
 
         putSectionDelimiter("Implementations of abstract methods from VerilatedModel\n");
@@ -613,6 +812,12 @@ class EmitCModel final : public EmitCFunc {
         puts(/**/ "rhs.vlSymsp->" + protect("__Vdeserialize") + "(os);\n");
         puts(/**/ "return os;\n");
         puts("}\n");
+
+        puts("\nvoid " + topClassName() + "::restoreFrom(const " + topClassName() + "& rhs) {\n");
+        puts(/**/ "Verilated::quiesce();\n");
+        puts(/**/ "if (VL_UNLIKELY(&rhs == this)) return;\n");
+        puts(/**/ "vlSymsp->" + protect("__Vcopy") + "(*rhs.vlSymsp);\n");
+        puts("}\n");
     }
 
     void emitImplementation(AstNodeModule* modp) {
@@ -685,8 +890,10 @@ class EmitCModel final : public EmitCFunc {
 
     void main(AstNodeModule* modp) {
         m_modp = modp;
+        m_skipInputps = findSkipInputps(modp);
         emitHeader(modp);
         emitImplementation(modp);
+        if (v3Global.opt.lanes()) emitLanesHeader(modp);
         if (v3Global.dpi()) emitDpiExportDispatchers(modp);
     }
 
@@ -22,6 +22,11 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 //######################################################################
 // Precompiled header emitter
+//
+// There is one PCH for the whole model. Through the Syms header it already
+// holds every module class header, so only class headers are parsed per
+// file. A PCH per dependency set would need its own build for each of the
+// fast and slow flags, costing more than the few headers it would save.
 
 class EmitCPch final : EmitCBase {
 public:
@@ -20,6 +20,7 @@
 #include "V3EmitCBase.h"
 #include "V3ExecGraph.h"
 #include "V3LanguageWords.h"
+#include "V3Split.h"
 #include "V3StackCount.h"
 #include "V3Stats.h"
 
@@ -106,6 +107,8 @@ class EmitCSyms final : EmitCBaseVisitorConst {
     std::vector<ModVarPair> m_modVars;  // Each public {mod,var}
     std::map<const std::string, ScopeFuncData> m_scopeFuncs;  // Each {scope,dpi-export-func}
     std::map<const std::string, ScopeVarData> m_scopeVars;  // Each {scope,public-var}
+    std::map<std::pair<const AstNodeModule*, std::string>, AstVar*>
+        m_vpiDirtyVars;  // Each {module,flag-name} from V3VpiDirty
     ScopeNames m_scopeNames;  // Each unique AstScopeName. Dpi scopes added later
     ScopeNames m_dpiScopeNames;  // Each unique AstScopeName for DPI export
     ScopeNames m_vpiScopeCandidates;  // All scopes for VPI
@@ -371,6 +374,8 @@ class EmitCSyms final : EmitCBaseVisitorConst {
         iterateChildrenConst(nodep);
         if ((nodep->isSigUserRdPublic() || nodep->isSigUserRWPublic()) && !m_cfuncp)
             m_modVars.emplace_back(m_modp, nodep);
+        if (v3Global.opt.vpiDirty() && VString::startsWith(nodep->name(), "__Vvpidirty__"))
+            m_vpiDirtyVars.emplace(std::make_pair(m_modp, nodep->name()), nodep);
     }
     void visit(AstVarScope* nodep) override {
         iterateChildrenConst(nodep);
@@ -495,6 +500,17 @@ void EmitCSyms::emitSymHdr() {
         puts("VlExecutionProfiler* const __Vm_executionProfilerp;\n");
     }
 
+    if (v3Global.opt.profRegions()) {
+        puts("\n// EVAL REGION PROFILING\n");
+        puts("VlRegionProfiler __Vm_regionProfiler;\n");
+    }
+
+    if (v3Global.opt.profStartup()) {
+        puts("\n// STARTUP PROFILING\n");
+        // Before the module instances, so their construction is timed
+        puts("VlStartupProfiler __Vm_startupProfiler;\n");
+    }
+
     puts("\n// MODULE INSTANCE STATE\n");
     for (const auto& i : m_scopes) {
         const AstScope* const scopep = i.first;
@@ -507,15 +523,26 @@ void EmitCSyms::emitSymHdr() {
 
     if (m_coverBins) {
         puts("\n// COVERAGE\n");
-        puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-        puts(" __Vcoverage[");
-        puts(cvtToStr(m_coverBins));
-        puts("];\n");
+        if (v3Global.opt.coverageHitOnce()) {
+            // Bit packed flags
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(" __Vcoverage[");
+            puts(cvtToStr((m_coverBins + 31) / 32));
+            puts("];\n");
+        } else if (v3Global.opt.coveragePerThread()) {
+            puts("VerilatedCovShards __Vcoverage;\n");
+        } else {
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(" __Vcoverage[");
+            puts(cvtToStr(m_coverBins));
+            puts("];\n");
+        }
     }
 
     if (v3Global.opt.profPgo()) {
         puts("\n// PGO PROFILING\n");
-        puts("VlPgoProfiler<" + std::to_string(ExecMTask::numUsedIds()) + "> _vm_pgoProfiler;\n");
+        puts("VlPgoProfiler<" + std::to_string(ExecMTask::numUsedIds()) + ", "
+             + std::to_string(V3Split::pgoCountKeys().size()) + "> _vm_pgoProfiler;\n");
     }
 
     if (!m_scopeNames.empty()) {  // Scope names
@@ -541,6 +568,9 @@ void EmitCSyms::emitSymHdr() {
         if (i.second) puts("int __Vfinal");
         puts(");\n");
     }
+    if (v3Global.dpi() && !m_scopeVars.empty()) {
+        puts("void " + protect("__VvarsInit") + "(int __Vfinal);\n");
+    }
 
     puts("\n// METHODS\n");
     puts("const char* name() { return TOP.name(); }\n");
@@ -579,6 +609,7 @@ void EmitCSyms::emitSymHdr() {
     if (v3Global.opt.savable()) {
         puts("void " + protect("__Vserialize") + "(VerilatedSerialize& os);\n");
         puts("void " + protect("__Vdeserialize") + "(VerilatedDeserialize& os);\n");
+        puts("void " + protect("__Vcopy") + "(const " + symClassName() + "& rhs);\n");
     }
     puts("};\n");
 
@@ -716,6 +747,18 @@ void EmitCSyms::emitSymImp() {
             }
             puts("}\n");
         }
+        puts("void " + symClassName() + "::" + protect("__Vcopy") + "(const " + symClassName()
+             + "& rhs) {\n");
+        puts("// Internal state\n");
+        if (v3Global.opt.trace()) puts("__Vm_activity = rhs.__Vm_activity;\n");
+        puts("__Vm_didInit = rhs.__Vm_didInit;\n");
+        puts("// Module instance state\n");
+        for (const auto& pair : m_scopes) {
+            const AstScope* const scopep = pair.first;
+            const string name = protectIf(scopep->nameDotless(), scopep->protect());
+            puts(name + "." + protect("__Vcopy") + "(rhs." + name + ");\n");
+        }
+        puts("}\n");
         puts("\n");
     }
 
@@ -737,6 +780,10 @@ void EmitCSyms::emitSymImp() {
         puts("_vm_pgoProfiler.write(\"" + topClassName()
              + "\", _vm_contextp__->profVltFilename(), " + firstHierCall + ");\n");
     }
+    if (v3Global.opt.profRegions()) {
+        puts("__Vm_regionProfiler.write(\"" + topClassName()
+             + "\", _vm_contextp__->profExecFilename());\n");
+    }
     puts("}\n");
 
     if (v3Global.needTraceDumper()) {
@@ -744,7 +791,7 @@ void EmitCSyms::emitSymImp() {
             puts("\nvoid " + symClassName() + "::_traceDump() {\n");
             // Caller checked for __Vm_dumperp non-nullptr
             puts("const VerilatedLockGuard lock(__Vm_dumperMutex);\n");
-            puts("__Vm_dumperp->dump(VL_TIME_Q());\n");
+            puts("__Vm_dumperp->dump(_vm_contextp__->time());\n");
             puts("}\n");
         }
 
@@ -804,6 +851,7 @@ void EmitCSyms::emitSymImp() {
              "__Vm_executionProfilerp{static_cast<VlExecutionProfiler*>(contextp->"
              "enableExecutionProfiler(&VlExecutionProfiler::construct))}\n");
     }
+    if (v3Global.opt.profRegions()) puts("    , __Vm_regionProfiler{contextp}\n");
 
     puts("    // Setup module instances\n");
     for (const auto& i : m_scopes) {
@@ -823,6 +871,11 @@ void EmitCSyms::emitSymImp() {
         puts("}\n");
         ++m_numStmts;
     }
+    if (m_coverBins && v3Global.opt.coveragePerThread()) {
+        // One shard per thread pool worker, plus one for the thread calling eval()
+        puts("    , __Vcoverage{" + cvtToStr(m_coverBins)
+             + ", static_cast<size_t>(__Vm_threadPoolp->numThreads()) + 1}\n");
+    }
     puts("{\n");
 
     {
@@ -843,9 +896,17 @@ void EmitCSyms::emitSymImp() {
                     const ExecMTask& mt = static_cast<const ExecMTask&>(vtx);
                     puts("_vm_pgoProfiler.addCounter(" + cvtToStr(mt.id()) + ", \"" + mt.hashName()
                          + "\");\n");
+                    for (const auto& pair : mt.pgoShares()) {
+                        puts("_vm_pgoProfiler.addCounterShare(" + cvtToStr(mt.id()) + ", \""
+                             + pair.first + "\", " + std::to_string(pair.second) + ");\n");
+                    }
                 }
             });
         }
+        const std::vector<std::string>& countKeys = V3Split::pgoCountKeys();
+        for (size_t i = 0; i < countKeys.size(); ++i) {
+            puts("_vm_pgoProfiler.addCount(" + cvtToStr(i) + ", \"" + countKeys[i] + "\");\n");
+        }
     }
 
     puts("// Configure time unit / time precision\n");
@@ -937,9 +998,36 @@ void EmitCSyms::emitSymImp() {
                 ++m_numStmts;
             }
         }
+        closeSplit();
+        m_ofpBase->puts("}\n");
+        if (!m_scopeVars.empty()) {
+            // Variables are only looked up by VPI and scope introspection, so leave
+            // registering them to the first lookup rather than slow model construction
+            m_ofpBase->puts("// Setup public variables on first lookup\n");
+            m_ofpBase->puts("__Vm_varsInitp = [](VerilatedSyms* symsp) {\n");
+            m_ofpBase->puts("static_cast<" + symClassName() + "*>(symsp)->"
+                            + protect("__VvarsInit") + "(1);\n");
+            m_ofpBase->puts("};\n");
+        }
+    }
+
+    if (v3Global.opt.profStartup()) m_ofpBase->puts("__Vm_startupProfiler.pop(\"construct\");\n");
+    m_ofpBase->puts("}\n");
+
+    if (v3Global.dpi() && !m_scopeVars.empty()) {
+        m_ofpBase->puts("\nvoid " + symClassName() + "::" + protect("__VvarsInit")
+                        + "(int __Vfinal) {\n");
         // It would be less code if each module inserted its own variables.
         // Someday.  For now public isn't common.
-        for (auto it = m_scopeVars.begin(); it != m_scopeVars.end(); ++it) {
+        // Insert in the runtime's name order, so each VerilatedVarNameMap only appends
+        std::vector<decltype(m_scopeVars)::const_iterator> sortedVars;
+        for (auto it = m_scopeVars.cbegin(); it != m_scopeVars.cend(); ++it) {
+            sortedVars.push_back(it);
+        }
+        std::stable_sort(sortedVars.begin(), sortedVars.end(), [](auto ap, auto bp) {
+            return protect(ap->second.m_varBasePretty) < protect(bp->second.m_varBasePretty);
+        });
+        for (const auto& it : sortedVars) {
             checkSplit(true);
             AstScope* const scopep = it->second.m_scopep;
             AstVar* const varp = it->second.m_varp;
@@ -1011,12 +1099,25 @@ void EmitCSyms::emitSymImp() {
             puts(bounds);
             puts(");\n");
             ++m_numStmts;
+
+            const auto dirtyIt = m_vpiDirtyVars.find(
+                std::make_pair(it->second.m_modp, "__Vvpidirty__" + varp->name()));
+            if (dirtyIt != m_vpiDirtyVars.end()) {
+                const AstScope* const topScopep = v3Global.rootp()->topScopep()->scopep();
+                putns(varp, protect("__Vscope_" + it->second.m_scopeName));
+                puts(".varDirty(__Vfinal, ");
+                putsQuoted(protect(it->second.m_varBasePretty));
+                puts(", &(" + protectIf(scopep->nameDotless(), scopep->protect()) + "."
+                     + protect(dirtyIt->second->name()) + ")");
+                puts(", &(" + protectIf(topScopep->nameDotless(), topScopep->protect())
+                     + "." + protect("__Vvpidirty") + "));\n");
+                ++m_numStmts;
+            }
         }
+        closeSplit();
         m_ofpBase->puts("}\n");
     }
 
-    m_ofpBase->puts("}\n");
-
     closeSplit();
     setOutputFile(nullptr);
     VL_DO_CLEAR(delete m_ofpBase, m_ofpBase = nullptr);
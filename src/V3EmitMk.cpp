@@ -25,6 +25,11 @@
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 // Groups adjacent files in a list, evenly distributing sum of scores
+//
+// Scores are the emitted code size estimates, not compile times measured in a
+// previous build, so the grouping, and hence the output, depends only on the
+// input design and options. Measured times would regroup files from one run
+// to the next, rebuilding every group and defeating --output-keep-identical.
 class EmitGroup final {
 public:
     struct FileOrConcatenatedFilesList final {
@@ -551,7 +556,7 @@ public:
         of.puts("VM_PARALLEL_BUILDS = ");
         of.puts(v3Global.useParallelBuild() ? "1" : "0");
         of.puts("\n");
-        of.puts("# Tracing output mode?  0/1 (from --trace-fst/--trace-saif/--trace-vcd)\n");
+        of.puts("# Tracing output mode?  0/1 (from --trace-fst/--trace-raw/--trace-saif/--trace-vcd)\n");
         of.puts("VM_TRACE = ");
         of.puts(v3Global.opt.trace() ? "1" : "0");
         of.puts("\n");
@@ -559,6 +564,10 @@ public:
         of.puts("VM_TRACE_FST = ");
         of.puts(v3Global.opt.traceEnabledFst() ? "1" : "0");
         of.puts("\n");
+        of.puts("# Tracing output mode in raw format?  0/1 (from --trace-raw)\n");
+        of.puts("VM_TRACE_RAW = ");
+        of.puts(v3Global.opt.traceEnabledRaw() ? "1" : "0");
+        of.puts("\n");
         of.puts("# Tracing output mode in SAIF format?  0/1 (from --trace-saif)\n");
         of.puts("VM_TRACE_SAIF = ");
         of.puts(v3Global.opt.traceEnabledSaif() ? "1" : "0");
@@ -604,14 +613,24 @@ public:
                         putMakeClassEntry(of, entry.m_filename);
                     }
                 } else {
+                    std::vector<const AstCFile*> cfileps;
                     for (AstNodeFile* nodep = v3Global.rootp()->filesp(); nodep;
                          nodep = VN_AS(nodep->nextp(), NodeFile)) {
                         const AstCFile* const cfilep = VN_CAST(nodep, CFile);
                         if (cfilep && cfilep->source() && cfilep->slow() == (slow != 0)
                             && cfilep->support() == (support != 0)) {
-                            putMakeClassEntry(of, cfilep->name());
+                            cfileps.push_back(cfilep);
                         }
                     }
+                    // Make starts parallel jobs in list order, so list the most complex
+                    // files first, to avoid waiting on a large file started last
+                    std::stable_sort(cfileps.begin(), cfileps.end(),
+                                     [](const AstCFile* ap, const AstCFile* bp) {
+                                         return ap->complexityScore() > bp->complexityScore();
+                                     });
+                    for (const AstCFile* const cfilep : cfileps) {
+                        putMakeClassEntry(of, cfilep->name());
+                    }
                 }
                 of.puts("\n");
                 V3Stats::addStat("Makefile targets, " + targetVar, m_putClassCount);
@@ -98,6 +98,7 @@ class V3EmitMkJsonEmitter final {
             .put("threads", v3Global.opt.threads())
             .put("trace", v3Global.opt.trace())
             .put("trace_fst", v3Global.opt.traceEnabledFst())
+            .put("trace_raw", v3Global.opt.traceEnabledRaw())
             .put("trace_saif", v3Global.opt.traceEnabledSaif())
             .put("trace_vcd", v3Global.opt.traceEnabledVcd())
             .end()
@@ -137,6 +138,10 @@ class V3EmitMkJsonEmitter final {
                     sources.emplace_back(
                         V3Os::filenameSlashPath(V3Os::filenameRealPath(i.filename())));
 
+                // The wrapper is what parents read, as listed in their sources
+                std::vector<std::string> outputs;
+                outputs.emplace_back(makeDir + "/" + hblockp->hierWrapperFilename(true));
+
                 std::vector<std::string> cflags;
                 cflags.emplace_back("-fPIC");
 
@@ -146,6 +151,7 @@ class V3EmitMkJsonEmitter final {
                     .putList("deps", childDeps)
                     .put("directory", makeDir + "/" + hblockp->hierPrefix())
                     .putList("sources", sources)
+                    .putList("outputs", outputs)
                     .putList("cflags", cflags)
                     .put("verilator_args", V3Os::filenameSlashPath(V3Os::filenameRealPath(
                                                hblockp->commandArgsFilename(true))))
@@ -232,7 +232,9 @@ class EmitVBaseVisitorConst VL_NOT_FINAL : public EmitCBaseVisitorConst {
         if (!m_suppressSemi) puts(";\n");
     }
     void visit(AstCoverDecl*) override {}  // N/A
+    void visit(AstCoverHit*) override {}  // N/A
     void visit(AstCoverInc*) override {}  // N/A
+    void visit(AstCoverIncBits*) override {}  // N/A
     void visit(AstCoverToggle*) override {}  // N/A
 
     void visit(AstTestPlusArgs* nodep) override {
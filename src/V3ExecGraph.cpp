@@ -27,6 +27,9 @@
 #include "V3Os.h"
 #include "V3Stats.h"
 
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -332,6 +335,58 @@ constexpr double V3ExecGraph::ThreadSchedule::s_threadBoxWidth;
 // depending on which thread is looking. Be a little bit pessimistic when
 // thread A checks the end time of an mtask running on thread B. This extra
 // "padding" avoids tight "layovers" at cross-thread dependencies.
+//
+// Additionally, charge a cross-thread dependency for the cache lines of state
+// the two mtasks share, as those lines move between cores when the consumer
+// runs on another thread. This favours keeping producer/consumer chains that
+// communicate through a lot of state on the same thread.
+
+// Gather the variables referenced from an mtask, through all called functions
+class PackThreadsVarGather final : VNVisitorConst {
+    // NODE STATE
+    //  AstCFunc::user1()  // bool: Already traced this function
+    //  AstVar::user1()  // bool: Already recorded this variable
+    const VNUser1InUse m_user1InUse;
+
+    // STATE
+    std::vector<const AstVar*>& m_varps;  // Variables referenced
+
+    // VISIT
+    void visit(AstNodeVarRef* nodep) override {
+        AstVar* const varp = nodep->varp();
+        if (varp->user1SetOnce()) return;
+        // Ignore TriggerVec. They are big and read-only in the MTask bodies
+        const AstBasicDType* const basicp = varp->dtypep()->basicp();
+        if (basicp && basicp->isTriggerVec()) return;
+        m_varps.push_back(varp);
+    }
+    void visit(AstCFunc* nodep) override {
+        if (nodep->user1SetOnce()) return;  // Prevent repeat traversals/recursion
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeCCall* nodep) override {
+        iterateChildrenConst(nodep);  // Arguments
+        iterateConst(nodep->funcp());  // Callee
+    }
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+    // CONSTRUCTORS
+    PackThreadsVarGather(const ExecMTask* mtaskp, std::vector<const AstVar*>& varps)
+        : m_varps{varps} {
+        iterateChildrenConst(mtaskp->bodyp());
+        std::sort(m_varps.begin(), m_varps.end());
+    }
+    ~PackThreadsVarGather() = default;
+
+public:
+    // Return variables referenced by the mtask, sorted by address
+    static std::vector<const AstVar*> apply(const ExecMTask* mtaskp) {
+        std::vector<const AstVar*> varps;
+        PackThreadsVarGather{mtaskp, varps};
+        return varps;
+    }
+};
+
 class PackThreads final {
     // TYPES
     struct MTaskCmp final {
@@ -345,19 +400,81 @@ class PackThreads final {
     const uint32_t m_nHierThreads;  // Number of threads used for hierarchical tasks
     const uint32_t m_sandbagNumerator;  // Numerator padding for est runtime
     const uint32_t m_sandbagDenom;  // Denominator padding for est runtime
+    const uint32_t m_cacheLineCost;  // Est runtime of moving a cache line between threads
+    // Cache lines of state shared by the two ends of each dependency edge
+    std::unordered_map<const V3GraphEdge*, uint32_t> m_sharedLines;
 
     // CONSTRUCTORS
     explicit PackThreads(uint32_t nThreads = v3Global.opt.threads(),
                          uint32_t nHierThreads = v3Global.opt.hierThreads(),
-                         unsigned sandbagNumerator = 30, unsigned sandbagDenom = 100)
+                         unsigned sandbagNumerator = 30, unsigned sandbagDenom = 100,
+                         unsigned cacheLineCost = 10)
         : m_nThreads{nThreads}
         , m_nHierThreads{nHierThreads}
         , m_sandbagNumerator{sandbagNumerator}
-        , m_sandbagDenom{sandbagDenom} {}
+        , m_sandbagDenom{sandbagDenom}
+        , m_cacheLineCost{cacheLineCost} {}
     ~PackThreads() = default;
     VL_UNCOPYABLE(PackThreads);
 
     // METHODS
+    static uint32_t varBytes(const AstVar* varp) {
+        // Approximate storage size, one cache line if not simple
+        if (varp->dtypep()->isIntegralOrPacked()) return (varp->width() + 7) / 8;
+        return VL_CACHE_LINE_BYTES;
+    }
+
+    // Compute m_sharedLines for every dependency edge, return total shared bytes
+    uint64_t computeSharedState(const V3Graph& mtaskGraph) {
+        std::unordered_map<const ExecMTask*, std::vector<const AstVar*>> mtaskVarps;
+        for (const V3GraphVertex& vtx : mtaskGraph.vertices()) {
+            const ExecMTask* const mtaskp = vtx.as<const ExecMTask>();
+            mtaskVarps.emplace(mtaskp, PackThreadsVarGather::apply(mtaskp));
+        }
+        uint64_t totalBytes = 0;
+        for (const V3GraphVertex& vtx : mtaskGraph.vertices()) {
+            const std::vector<const AstVar*>& fromVarps = mtaskVarps[vtx.as<const ExecMTask>()];
+            for (const V3GraphEdge& edge : vtx.outEdges()) {
+                const std::vector<const AstVar*>& toVarps
+                    = mtaskVarps[edge.top()->as<const ExecMTask>()];
+                // Both are sorted, so merge-intersect
+                uint64_t bytes = 0;
+                auto fromIt = fromVarps.cbegin();
+                auto toIt = toVarps.cbegin();
+                while (fromIt != fromVarps.cend() && toIt != toVarps.cend()) {
+                    if (*fromIt < *toIt) {
+                        ++fromIt;
+                    } else if (*toIt < *fromIt) {
+                        ++toIt;
+                    } else {
+                        bytes += varBytes(*fromIt);
+                        ++fromIt;
+                        ++toIt;
+                    }
+                }
+                if (!bytes) continue;
+                totalBytes += bytes;
+                const uint64_t lines = (bytes + VL_CACHE_LINE_BYTES - 1) / VL_CACHE_LINE_BYTES;
+                m_sharedLines.emplace(&edge, static_cast<uint32_t>(std::min<uint64_t>(
+                                                 lines, std::numeric_limits<uint32_t>::max())));
+            }
+        }
+        return totalBytes;
+    }
+
+    uint32_t communicationCost(const ThreadSchedule& schedule, const V3GraphEdge& edge,
+                               uint32_t threadId) const {
+        // Cost of getting the state shared with the producer over from another thread
+        const ExecMTask* const priorp = edge.fromp()->as<const ExecMTask>();
+        if (!schedule.contains(priorp)) return 0;
+        if (schedule.threadId(priorp) == threadId) return 0;
+        const auto it = m_sharedLines.find(&edge);
+        if (it == m_sharedLines.end()) return 0;
+        // Don't let communication dominate small mtasks, those are cheap to move anyway
+        return std::min<uint64_t>(static_cast<uint64_t>(it->second) * m_cacheLineCost,
+                                  priorp->cost());
+    }
+
     uint32_t completionTime(const ThreadSchedule& schedule, const ExecMTask* mtaskp,
                             uint32_t threadId) {
         // Ignore tasks that were scheduled on a different schedule
@@ -463,7 +580,9 @@ class PackThreads final {
                     }
                     for (const V3GraphEdge& edge : mtaskp->inEdges()) {
                         const ExecMTask* const priorp = edge.fromp()->as<ExecMTask>();
-                        const uint32_t priorEndTime = completionTime(schedule, priorp, threadId);
+                        const uint32_t priorEndTime
+                            = completionTime(schedule, priorp, threadId)
+                              + communicationCost(schedule, edge, threadId);
                         if (priorEndTime > timeBegin) timeBegin = priorEndTime;
                     }
                     UINFO(6, "Task " << mtaskp->name() << " start at " << timeBegin
@@ -503,6 +622,7 @@ class PackThreads final {
             UASSERT(bestMtaskp, "Should have found some task");
 
             bestMtaskp->predictStart(bestTime);
+            bestMtaskp->thread(bestThreadId);
             const uint32_t bestEndTime = schedule.scheduleOn(bestMtaskp, bestThreadId);
             busyUntil[bestThreadId] = bestEndTime;
 
@@ -730,7 +850,11 @@ public:
     }
 
     static std::vector<ThreadSchedule> apply(V3Graph& mtaskGraph) {
-        return PackThreads{}.pack(mtaskGraph);
+        PackThreads packer;
+        const uint64_t sharedBytes = packer.computeSharedState(mtaskGraph);
+        V3Stats::addStatSum("Optimizations, Thread schedule shared state bytes",
+                            static_cast<double>(sharedBytes));
+        return packer.pack(mtaskGraph);
     }
 };
 
@@ -790,22 +914,91 @@ void normalizeCosts(Costs& costs) {
     }
 }
 
+// Profile key and estimated cost of each statement of an mtask body, merging equal statements
+std::map<string, uint64_t> statementCosts(const AstMTaskBody* bodyp) {
+    std::map<string, uint64_t> costs;
+    for (const AstNode* stmtp = bodyp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+        costs["stmt_" + V3Hasher::uncachedHash(stmtp).toString()]
+            += V3InstrCount::count(const_cast<AstNode*>(stmtp), false);
+    }
+    return costs;
+}
+
+// When an mtask changed since profiling, estimate its cost from the profiled share of the
+// statements it still has in common with the profiled mtasks, or 0 if it has none
+uint64_t overlapCost(const std::map<string, uint64_t>& stmtCosts) {
+    uint64_t profiled = 0;  // Profiled cost of matched statements
+    uint64_t matchedEstimate = 0;  // Estimated cost of matched statements
+    uint64_t unmatchedEstimate = 0;  // Estimated cost of other statements
+    for (const auto& pair : stmtCosts) {
+        const uint64_t cost = V3Control::getProfileData(v3Global.opt.prefix(), pair.first);
+        if (cost) {
+            profiled += cost;
+            matchedEstimate += pair.second;
+        } else {
+            unmatchedEstimate += pair.second;
+        }
+    }
+    if (!profiled) return 0;
+    if (!matchedEstimate) return profiled;
+    return profiled
+           + static_cast<uint64_t>(static_cast<double>(unmatchedEstimate) * profiled
+                                   / matchedEstimate);
+}
+
 void fillinCosts(V3Graph* execMTaskGraphp) {
+    // Profile data only re-costs the final mtasks here; it does not reshape
+    // the partition. The records are keyed by the hash of each final mtask
+    // body, and V3OrderParallel partitions logic vertices long before those
+    // bodies exist, so a profile cannot be mapped back onto the vertices the
+    // partitioner merges. The cycle counts recorded by VlPgoProfiler already
+    // include cache miss stalls, so separate hardware counters would not
+    // change the cost used here.
+    //
+    // The profile also shares each mtask's time among its statements, so an
+    // mtask changed by an RTL edit can still be costed from the statements it
+    // has in common with the profiled mtasks.
+
     // Pass 1: See what profiling data applies
     Costs costs;  // For each mtask, costs
+    const bool profileData = V3Control::containsMTaskProfileData();
+    size_t overlapCosted = 0;  // Mtasks costed from their statements
 
     for (V3GraphVertex& vtx : execMTaskGraphp->vertices()) {
         ExecMTask* const mtp = vtx.as<ExecMTask>();
         // This estimate is 64 bits, but the final mtask graph algorithm needs 32 bits
         const uint64_t costEstimate = V3InstrCount::count(mtp->bodyp(), false);
-        const uint64_t costProfiled
-            = V3Control::getProfileData(v3Global.opt.prefix(), mtp->hashName());
+        uint64_t costProfiled = V3Control::getProfileData(v3Global.opt.prefix(), mtp->hashName());
         if (costProfiled) {
             UINFO(5, "Profile data for mtask " << mtp->id() << " " << mtp->hashName()
                                                << " cost override " << costProfiled);
         }
+        if ((!costProfiled && profileData) || v3Global.opt.profPgo()) {
+            const std::map<string, uint64_t> stmtCosts = statementCosts(mtp->bodyp());
+            if (!costProfiled && profileData) {
+                costProfiled = overlapCost(stmtCosts);
+                if (costProfiled) {
+                    UINFO(5, "Profile data for changed mtask " << mtp->id() << " "
+                                                               << mtp->hashName()
+                                                               << " cost from statements "
+                                                               << costProfiled);
+                    ++overlapCosted;
+                }
+            }
+            if (v3Global.opt.profPgo()) {
+                std::vector<std::pair<std::string, double>> shares;
+                for (const auto& pair : stmtCosts) {
+                    const double share = costEstimate ? static_cast<double>(pair.second)
+                                                            / static_cast<double>(costEstimate)
+                                                      : 1.0 / stmtCosts.size();
+                    shares.emplace_back(pair.first, share);
+                }
+                mtp->pgoShares(std::move(shares));
+            }
+        }
         costs[mtp->id()] = std::make_pair(costEstimate, costProfiled);
     }
+    V3Stats::addStatSum("Optimizations, Thread PGO mtasks costed by overlap", overlapCosted);
 
     normalizeCosts(costs /*ref*/);
 
@@ -905,8 +1098,19 @@ void finalizeCosts(V3Graph* execMTaskGraphp) {
     }
 }
 
+// Data type of an MTask state variable. With --threads-state-layout padded every
+// variable is on its own cache line. With 'grouped', variables waited on by the same
+// thread are adjacent (as created thread by thread), and only the first of each
+// group is padded, so no two threads' groups share a cache line.
+AstBasicDType* mtaskStateDtypep(FileLine* fl, bool groupStart) {
+    const string& layout = v3Global.opt.threadsStateLayout();
+    const bool padded = layout == "padded" || (layout == "grouped" && groupStart);
+    return v3Global.rootp()->typeTablep()->findBasicDType(
+        fl, padded ? VBasicDTypeKwd::MTASKSTATE_PADDED : VBasicDTypeKwd::MTASKSTATE);
+}
+
 void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId, AstCFunc* funcp,
-                        const ExecMTask* mtaskp) {
+                        const ExecMTask* mtaskp, bool& groupStart) {
     AstNodeModule* const modp = v3Global.rootp()->topModulep();
     FileLine* const fl = modp->fileline();
 
@@ -919,15 +1123,24 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
         // This mtask has dependencies executed on another thread, so it may block. Create the task
         // state variable and wait to be notified.
         const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
-        AstBasicDType* const mtaskStateDtypep
-            = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
-        AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, mtaskStateDtypep};
+        AstVar* const varp
+            = new AstVar{fl, VVarType::MODULETEMP, name, mtaskStateDtypep(fl, groupStart)};
+        groupStart = false;
         varp->valuep(new AstConst{fl, nDependencies});
         varp->protect(false);  // Do not protect as we still have references in AstText
         modp->addStmtsp(varp);
         // For now, reference is still via text bashing
         if (v3Global.opt.profExec()) {
-            addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();\n");
+            // Name the mtasks waited for, so verilator_gantt can attribute the wait
+            string upstream;
+            for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+                const ExecMTask* const prevp = edge.fromp()->as<ExecMTask>();
+                if (schedule.threadId(prevp) == threadId || !schedule.contains(prevp)) continue;
+                if (!upstream.empty()) upstream += ',';
+                upstream += cvtToStr(prevp->id());
+            }
+            addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin("
+                       + cvtToStr(mtaskp->id()) + ", \"" + upstream + "\");\n");
         }
         addStrStmt("vlSelf->" + name + +".waitUntilUpstreamDone(even_cycle);\n");
         if (v3Global.opt.profExec()) {
@@ -986,8 +1199,9 @@ const std::vector<AstCFunc*> createThreadFunctions(const ThreadSchedule& schedul
         funcp->addStmtsp(new AstCStmt{fl, EmitCBase::symClassAssign()});
 
         // Invoke each mtask scheduled to this thread from the thread function
+        bool groupStart = true;
         for (const ExecMTask* const mtaskp : thread) {
-            addMTaskToFunction(schedule, threadId, funcp, mtaskp);
+            addMTaskToFunction(schedule, threadId, funcp, mtaskp, groupStart);
         }
 
         // Unblock the fake "final" mtask when this thread is finished
@@ -996,12 +1210,10 @@ const std::vector<AstCFunc*> createThreadFunctions(const ThreadSchedule& schedul
                                               + ".signalUpstreamDone(even_cycle);\n"});
     }
 
-    // Create the fake "final" mtask state variable
-    AstBasicDType* const mtaskStateDtypep
-        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
-    AstVar* const varp
-        = new AstVar{fl, VVarType::MODULETEMP,
-                     "__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag, mtaskStateDtypep};
+    // Create the fake "final" mtask state variable, signalled by all threads
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP,
+                                    "__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag,
+                                    mtaskStateDtypep(fl, true)};
     varp->valuep(new AstConst(fl, funcps.size()));
     varp->protect(false);  // Do not protect as we still have references in AstText
     modp->addStmtsp(varp);
@@ -1056,20 +1268,30 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
     };
 
     const uint32_t last = funcps.size() - 1;
+    const bool hier = v3Global.opt.hierChild() || !v3Global.opt.hierBlocks().empty();
+    // Workers to run on. Workers 0 to N-1 unless the thread pool is shared by
+    // several contexts at run-time, in which case they are assigned per graph.
+    const string workersName = "__Vworkers__" + tag;
     if (!v3Global.opt.hierBlocks().empty() && last > 0) {
         addStrStmt(
             "for (size_t i = 0; i < " + cvtToStr(last)
             + "; ++i) indexes.push_back(vlSymsp->__Vm_threadPoolp->assignWorkerIndex());\n");
+    } else if (!hier && last > 0) {
+        addStrStmt("size_t " + workersName + "[" + cvtToStr(last) + "];\n");
+        addStrStmt("vlSymsp->__Vm_threadPoolp->assignWorkerIndexes(" + cvtToStr(last) + ", "
+                   + workersName + ");\n");
     }
     uint32_t i = 0;
     for (AstCFunc* const funcp : funcps) {
         if (i != last) {
-            // The first N-1 will run on the thread pool.
-            if (v3Global.opt.hierChild() || !v3Global.opt.hierBlocks().empty()) {
+            // The first N-1 will run on the thread pool. With work stealing enabled at
+            // run-time, an idle worker may pick up the function if its worker is busy.
+            if (hier) {
                 addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(indexes[" + cvtToStr(i)
-                            + "])->addTask(");
+                            + "])->addStealableTask(");
             } else {
-                addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(" + cvtToStr(i) + ")->addTask(");
+                addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(" + workersName + "["
+                            + cvtToStr(i) + "])->addStealableTask(");
             }
             execGraphp->addStmtsp(new AstAddrOfCFunc{fl, funcp});
             addTextStmt(", vlSelf, vlSymsp->__Vm_even_cycle__" + tag + ");\n");
@@ -1095,6 +1317,9 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
     // Free all assigned worker indices in this section
     if (!v3Global.opt.hierBlocks().empty() && last > 0) {
         addStrStmt("vlSymsp->__Vm_threadPoolp->freeWorkerIndexes(indexes);\n");
+    } else if (!hier && last > 0) {
+        addStrStmt("vlSymsp->__Vm_threadPoolp->freeWorkerIndexes(" + cvtToStr(last) + ", "
+                   + workersName + ");\n");
     }
 }
 
@@ -1164,6 +1389,105 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
     addThreadStartToExecGraph(execGraphp, funcps, schedule.id());
 }
 
+void implementExecGraphDynamic(AstExecGraph* const execGraphp) {
+    // Nothing to be done if there are no MTasks in the graph at all.
+    const V3Graph& depGraph = *execGraphp->depGraphp();
+    if (depGraph.empty()) return;
+
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    // There is no consuming thread to group by, so 'grouped' pads every variable
+    AstBasicDType* const stateDtypep = mtaskStateDtypep(fl, true);
+    const auto addStateVar = [&](const string& name, uint32_t nDependencies) {
+        AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, stateDtypep};
+        varp->valuep(new AstConst{fl, nDependencies});
+        varp->protect(false);  // Do not protect as we still have references in AstText
+        modp->addStmtsp(varp);
+    };
+    const string evenCycle = "vlSymsp->__Vm_even_cycle__" + tag;
+    // Statement calling 'funcp' on the thread pool's shared ready queue
+    const auto newEnqueueStmt = [&](const string& prefix, AstCFunc* funcp, const string& even) {
+        AstCStmt* const stmtp = new AstCStmt{
+            fl, new AstText{fl, prefix + "vlSymsp->__Vm_threadPoolp->addDynamicTask(", true}};
+        stmtp->addExprsp(new AstAddrOfCFunc{fl, funcp});
+        stmtp->addExprsp(new AstText{fl, ", vlSelf, " + even + ");\n", true});
+        return stmtp;
+    };
+    const string finalName = "__Vm_mtaskstate_final__dyn" + tag;
+
+    // Create an entry point function for each MTask, and count the sink MTasks,
+    // which will notify the fake "final" MTask the main thread is waiting for.
+    std::unordered_map<const ExecMTask*, AstCFunc*> funcps;
+    uint32_t nSinks = 0;
+    for (const V3GraphVertex& vtx : depGraph.vertices()) {
+        const ExecMTask* const mtaskp = vtx.as<ExecMTask>();
+        AstCFunc* const funcp = new AstCFunc{
+            fl, "__Vmtask__" + tag + "__" + cvtToStr(mtaskp->id()), nullptr, "void"};
+        modp->addStmtsp(funcp);
+        funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+        funcp->isLoose(true);
+        funcp->entryPoint(true);
+        funcp->argTypes("void* voidSelf, bool even_cycle");
+        funcp->addStmtsp(new AstCStmt{fl, EmitCBase::voidSelfAssign(modp)});
+        funcp->addStmtsp(new AstCStmt{fl, EmitCBase::symClassAssign()});
+        funcps.emplace(mtaskp, funcp);
+        if (!vtx.inEmpty()) {
+            addStateVar("__Vm_mtaskstate_" + cvtToStr(mtaskp->id()),
+                        static_cast<uint32_t>(vtx.inEdges().size()));
+        }
+        if (vtx.outEmpty()) ++nSinks;
+    }
+    addStateVar(finalName, nSinks);
+
+    for (const V3GraphVertex& vtx : depGraph.vertices()) {
+        const ExecMTask* const mtaskp = vtx.as<const ExecMTask>();
+        AstCFunc* const funcp = funcps.at(mtaskp);
+        if (v3Global.opt.profPgo()) {
+            // No lock around startCounter, as counter numbers are unique per MTask
+            funcp->addStmtsp(new AstCStmt{fl, "vlSymsp->_vm_pgoProfiler.startCounter("
+                                                  + std::to_string(mtaskp->id()) + ");\n"});
+        }
+        funcp->addStmtsp(mtaskp->bodyp()->unlinkFrBack());
+        if (v3Global.opt.profPgo()) {
+            funcp->addStmtsp(new AstCStmt{fl, "vlSymsp->_vm_pgoProfiler.stopCounter("
+                                                  + std::to_string(mtaskp->id()) + ");\n"});
+        }
+        // Enqueue dependents that become ready
+        for (const V3GraphEdge& edge : vtx.outEdges()) {
+            const ExecMTask* const nextp = edge.top()->as<ExecMTask>();
+            funcp->addStmtsp(newEnqueueStmt("if (vlSelf->__Vm_mtaskstate_"
+                                                + cvtToStr(nextp->id())
+                                                + ".signalUpstreamDone(even_cycle)) ",
+                                            funcps.at(nextp), "even_cycle"));
+        }
+        if (vtx.outEmpty()) {
+            funcp->addStmtsp(
+                new AstCStmt{fl, "vlSelf->" + finalName + ".signalUpstreamDone(even_cycle);\n"});
+        }
+    }
+
+    // Start the source MTasks, then help executing the graph until all sinks are done
+    uint32_t nSources = 0;
+    for (const V3GraphVertex& vtx : depGraph.vertices()) {
+        if (!vtx.inEmpty()) continue;
+        execGraphp->addStmtsp(newEnqueueStmt("", funcps.at(vtx.as<const ExecMTask>()), evenCycle));
+        ++nSources;
+    }
+    V3Stats::addStatSum("Optimizations, Thread schedule dynamic source tasks", nSources);
+    if (v3Global.opt.profExec()) {
+        execGraphp->addStmtsp(
+            new AstCStmt{fl, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();\n"});
+    }
+    execGraphp->addStmtsp(new AstCStmt{
+        fl, "vlSymsp->__Vm_threadPoolp->executeDynamicUntilDone(vlSelf->" + finalName + ", "
+                + evenCycle + ");\n"});
+    if (v3Global.opt.profExec()) {
+        execGraphp->addStmtsp(
+            new AstCStmt{fl, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();\n"});
+    }
+}
+
 void implement(AstNetlist* netlistp) {
     // Called by Verilator top stage
     netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
@@ -1179,6 +1503,16 @@ void implement(AstNetlist* netlistp) {
 
         addThreadStartWrapper(execGraphp);
 
+        if (v3Global.opt.threadsDynamic()) {
+            // Wrap each MTask body into a CFunc for better profiling/debugging
+            wrapMTaskBodies(execGraphp);
+            // Replace the graph body with an implementation dispatching each mtask
+            // to any free thread at run-time, as soon as its dependencies are done.
+            implementExecGraphDynamic(execGraphp);
+            addThreadEndWrapper(execGraphp);
+            return;
+        }
+
         // Schedule the mtasks: statically associate each mtask with a thread,
         // and determine the order in which each thread will run its mtasks.
         const std::vector<ThreadSchedule> packed = PackThreads::apply(*execGraphp->depGraphp());
@@ -23,6 +23,7 @@
 #include "V3Graph.h"
 
 #include <atomic>
+#include <limits>
 
 class AstNetlist;
 class AstMTaskBody;
@@ -44,6 +45,9 @@ private:
     uint32_t m_cost = 0;
     uint64_t m_predictStart = 0;  // Predicted start time of task
     int m_threads = 1;  // Threads used by this mtask
+    uint32_t m_thread = std::numeric_limits<uint32_t>::max();  // Thread statically packed onto
+    // With --prof-pgo, profile keys of the statements in the body, and their share of its cost
+    std::vector<std::pair<std::string, double>> m_pgoShares;
     VL_UNCOPYABLE(ExecMTask);
 
 public:
@@ -60,6 +64,13 @@ public:
     string hashName() const { return m_hashName; }
     void threads(int threads) { m_threads = threads; }
     int threads() const { return m_threads; }
+    // Thread PackThreads assigned this mtask to, or max() if not statically packed
+    void thread(uint32_t thread) { m_thread = thread; }
+    uint32_t thread() const { return m_thread; }
+    const std::vector<std::pair<std::string, double>>& pgoShares() const { return m_pgoShares; }
+    void pgoShares(std::vector<std::pair<std::string, double>>&& shares) {
+        m_pgoShares = std::move(shares);
+    }
     void dump(std::ostream& str) const;
 
     static uint32_t numUsedIds() VL_MT_SAFE { return s_nextId; }
@@ -20,6 +20,7 @@
 
 #include "V3Os.h"
 #include "V3String.h"
+#include "V3ThreadPool.h"
 
 #include <cerrno>
 #include <cstdarg>
@@ -331,6 +332,7 @@ class VInFilterImp final {
     using StrList = VInFilter::StrList;
 
     std::map<const std::string, std::string> m_contentsMap;  // Cache of file contents
+    std::map<const std::string, std::string> m_prefetchMap;  // Contents read by prefetch()
     bool m_readEof = false;  // Received EOF on read
 #ifdef INFILTER_PIPE
     pid_t m_pid = 0;  // fork() process id
@@ -572,7 +574,13 @@ protected:
             outl.push_back(it->second);
             return true;
         }
-        if (!readContents(filename, outl)) return false;
+        const auto pit = m_prefetchMap.find(filename);
+        if (pit != m_prefetchMap.end()) {
+            outl.push_back(std::move(pit->second));
+            m_prefetchMap.erase(pit);
+        } else if (!readContents(filename, outl)) {
+            return false;
+        }
         if (listSize(outl) < INFILTER_CACHE_MAX) {
             // Cache small files (only to save space)
             // It's quite common to `include "timescale" thousands of times
@@ -581,6 +589,45 @@ protected:
         }
         return true;
     }
+    void prefetch(const std::vector<string>& filenames) {
+        if (m_pid) return;  // Filter requests must stay in order
+        if (v3Global.opt.verilateJobs() <= 1) return;  // Nothing gained
+        std::vector<std::pair<bool, string>> results(filenames.size());
+        {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < filenames.size(); ++i) {
+                std::pair<bool, string>* const resultp = &results[i];
+                const string* const filenamep = &filenames[i];
+                threadScope.enqueue([resultp, filenamep]() {
+                    resultp->first = readFileString(*filenamep, resultp->second);
+                });
+            }
+        }
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            if (!results[i].first) continue;
+            m_prefetchMap.emplace(filenames[i], std::move(results[i].second));
+        }
+        UINFO(4, "Prefetched " << m_prefetchMap.size() << " files");
+    }
+    static bool readFileString(const string& filename, string& contents) VL_MT_SAFE {
+        // Like readContentsFile but without member state, so can be called from any thread
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        char buf[INFILTER_IPC_BUFSIZ];
+        while (true) {
+            errno = 0;
+            const ssize_t got = read(fd, buf, sizeof(buf));
+            if (got > 0) {
+                contents.append(buf, got);
+            } else if (got < 0 && errno == EINTR) {
+                continue;
+            } else {
+                break;
+            }
+        }
+        close(fd);
+        return true;
+    }
     static size_t listSize(const StrList& sl) {
         size_t result = 0;
         for (const string& i : sl) result += i.length();
@@ -610,6 +657,11 @@ bool VInFilter::readWholefile(const string& filename, VInFilter::StrList& outl)
     return m_impp->readWholefile(filename, outl);
 }
 
+void VInFilter::prefetch(const std::vector<string>& filenames) {
+    UASSERT(m_impp, "prefetch on invalid filter");
+    m_impp->prefetch(filenames);
+}
+
 //######################################################################
 // V3OutFormatter: A class for printing to a file, with automatic indentation of C++ code.
 
@@ -935,18 +987,48 @@ void V3OutFormatter::printf(const char* fmt...) {
 V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
     : V3OutFormatter{filename, lang}
     , m_bufferp{new std::array<char, WRITE_BUFFER_SIZE_BYTES>{}} {
-    if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
+    if (v3Global.opt.outputKeepIdentical() && (m_fp = V3File::new_fopen_cmp(filename))) {
+        // Only rewrite if contents change, so the timestamp is kept for make/ccache
+        m_comparing = true;
+        m_oldBufferp.reset(new std::array<char, WRITE_BUFFER_SIZE_BYTES>{});
+    } else if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
         v3fatal("Can't write file: " << filename);
     }
 }
 
 V3OutFile::~V3OutFile() {
     writeBlock();
+    // Existing file was longer
+    if (m_comparing && fgetc(m_fp) != EOF) rewriteExisting();
 
     if (m_fp) fclose(m_fp);
     m_fp = nullptr;
 }
 
+bool V3OutFile::compareBlock() {
+    // Return true if the buffer matches the existing file, else switch to writing
+    const std::size_t got = fread(m_oldBufferp->data(), 1, m_usedBytes, m_fp);
+    if (got == m_usedBytes && !std::memcmp(m_oldBufferp->data(), m_bufferp->data(), got)) {
+        return true;
+    }
+    rewriteExisting();
+    return false;
+}
+
+void V3OutFile::rewriteExisting() {
+    // Reopen for writing, keeping the m_writtenBytes already known to match
+    std::string prefix(m_writtenBytes, '\0');
+    std::rewind(m_fp);
+    const bool ok = fread(&prefix[0], 1, m_writtenBytes, m_fp) == m_writtenBytes;
+    fclose(m_fp);
+    m_comparing = false;
+    m_oldBufferp.reset();
+    if (!ok || (m_fp = V3File::new_fopen_w(filename())) == nullptr) {
+        v3fatal("Can't write file: " << filename());
+    }
+    fwrite(prefix.data(), m_writtenBytes, 1, m_fp);
+}
+
 void V3OutFile::putsForceIncs() {
     const V3StringList& forceIncs = v3Global.opt.forceIncs();
     for (const string& i : forceIncs) puts("#include \"" + i + "\"\n");
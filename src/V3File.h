@@ -24,6 +24,7 @@
 #include "V3Stats.h"
 
 #include <array>
+#include <cmath>
 #include <fstream>
 #include <list>
 #include <memory>
@@ -62,6 +63,11 @@ public:
         addTgtDepend(filename);
         return fopen(filename.c_str(), "w");
     }
+    // Open an existing output file for comparing against new contents, nullptr if none
+    static FILE* new_fopen_cmp(const string& filename) {
+        addTgtDepend(filename);
+        return fopen(filename.c_str(), "r");
+    }
 
     // Dependencies
     static void addSrcDepend(const string& filename) VL_MT_SAFE;
@@ -99,6 +105,8 @@ public:
     // METHODS
     // Read file contents and return it.  Return true on success.
     bool readWholefile(const string& filename, StrList& outl);
+    // Read the given files ahead of use, concurrently when --verilate-jobs allows
+    void prefetch(const std::vector<string>& filenames);
 };
 
 //============================================================================
@@ -205,6 +213,9 @@ class V3OutFile VL_NOT_FINAL : public V3OutFormatter {
     std::size_t m_usedBytes = 0;  // Number of bytes stored in m_bufferp
     std::size_t m_writtenBytes = 0;  // Number of bytes written to output
     std::unique_ptr<std::array<char, WRITE_BUFFER_SIZE_BYTES>> m_bufferp;  // Write buffer
+    // Existing file contents, when comparing (--output-keep-identical)
+    std::unique_ptr<std::array<char, WRITE_BUFFER_SIZE_BYTES>> m_oldBufferp;
+    bool m_comparing = false;  // m_fp is the existing file, identical so far
 
 public:
     V3OutFile(const string& filename, V3OutFormatter::Language lang);
@@ -224,11 +235,13 @@ public:
 private:
     void writeBlock() {
         if (VL_LIKELY(m_usedBytes > 0)) {
-            fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
+            if (!m_comparing || !compareBlock()) fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
             m_writtenBytes += m_usedBytes;
             m_usedBytes = 0;
         }
     }
+    bool compareBlock();
+    void rewriteExisting();
     // CALLBACKS
     void putcOutput(char chr) override {
         m_bufferp->at(m_usedBytes++) = chr;
@@ -333,6 +346,14 @@ public:
     V3OutJsonFile& put(const std::string& name, int value) {
         return putNamed(name, std::to_string(value), false);
     }
+    V3OutJsonFile& put(const std::string& name, uint64_t value) {
+        return putNamed(name, std::to_string(value), false);
+    }
+    V3OutJsonFile& put(const std::string& name, double value) {
+        char buf[32];
+        VL_SNPRINTF(buf, sizeof(buf), "%.6g", std::isfinite(value) ? value : 0.0);
+        return putNamed(name, buf, false);
+    }
 
     // Put unnamed value
     V3OutJsonFile& put(const std::string& value) { return putNamed("", value, true); }
@@ -122,6 +122,29 @@ FileLineSingleton::msgEnSetIdx_t FileLineSingleton::addMsgEnBitSet(const MsgEnBi
     return idx;
 }
 
+FileLineSingleton::~FileLineSingleton() {
+    // Interned contexts each hold a reference to their contents
+    for (const Context& context : m_internedContexts) {
+        if (context.first) context.first->refDec();
+    }
+}
+
+FileLineSingleton::contextIdx_t FileLineSingleton::addContext(const Context& context)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    V3LockGuard lock{m_mutex};
+    const auto pair = m_internedContextIdxs.emplace(context, 0);
+    contextIdx_t& idx = pair.first->second;
+    if (pair.second) {
+        const size_t nextIdx = m_internedContexts.size();
+        UASSERT(nextIdx <= std::numeric_limits<contextIdx_t>::max(),
+                "Too many unique file line contexts (" + cvtToStr(nextIdx) + "+).");
+        idx = static_cast<contextIdx_t>(nextIdx);
+        if (context.first) context.first->refInc();
+        m_internedContexts.push_back(context);
+    }
+    return idx;
+}
+
 FileLineSingleton::msgEnSetIdx_t FileLineSingleton::defaultMsgEnIndex() VL_MT_SAFE {
     MsgEnBitSet msgEnBitSet;
     for (int i = V3ErrorCode::EC_MIN; i < V3ErrorCode::_ENUM_MAX; ++i) {
@@ -205,14 +228,8 @@ std::ostream& operator<<(std::ostream& os, VFileContent* contentp) {
 // ######################################################################
 //  FileLine class functions
 
-FileLine::~FileLine() {
-    if (m_contentp) VL_DO_DANGLING(m_contentp->refDec(), m_contentp);
-}
-
 void FileLine::newContent() {
-    if (m_contentp) VL_DO_DANGLING(m_contentp->refDec(), m_contentp);
-    m_contentp = new VFileContent;
-    m_contentp->refInc();
+    m_contextIdx = singleton().addContext(Context{new VFileContent, parent()});
     m_contentLineno = 1;
 }
 
@@ -353,7 +370,7 @@ string FileLine::profileFuncname() const {
 
 string FileLine::asciiLineCol() const {
     return (cvtToStr(firstLineno()) + "-" + cvtToStr(lastLineno()) + ":" + cvtToStr(firstColumn())
-            + "-" + cvtToStr(lastColumn()) + "[" + (m_contentp ? m_contentp->ascii() : "ct0") + "+"
+            + "-" + cvtToStr(lastColumn()) + "[" + (contentp() ? contentp()->ascii() : "ct0") + "+"
             + cvtToStr(m_contentLineno) + "]");
 }
 string FileLine::ascii() const {
@@ -469,7 +486,7 @@ string FileLine::warnOther() const VL_REQUIRES(V3Error::s().m_mutex) {
 };
 
 string FileLine::source() const VL_MT_SAFE {
-    if (VL_UNCOVERABLE(!m_contentp)) {  // LCOV_EXCL_START
+    if (VL_UNCOVERABLE(!contentp())) {  // LCOV_EXCL_START
         if (debug() || v3Global.opt.debugCheck()) {
             // The newline here is to work around the " <line#> | "
             return "\n%Error: internal tracking of file contents failed";
@@ -477,7 +494,7 @@ string FileLine::source() const VL_MT_SAFE {
             return "";
         }
     }  // LCOV_EXCL_STOP
-    return m_contentp->getLine(m_contentLineno);
+    return contentp()->getLine(m_contentLineno);
 }
 string FileLine::sourcePrefix(int toColumn) const VL_MT_SAFE {
     const std::string src = source();
@@ -37,6 +37,7 @@
 // ######################################################################
 
 class FileLine;
+class VFileContent;
 
 //! Singleton class with tables of per-file data.
 
@@ -48,7 +49,9 @@ class FileLineSingleton final {
     // TYPES
     using fileNameIdx_t = uint16_t;  // Increase width if 64K input files are not enough
     using msgEnSetIdx_t = uint16_t;  // Increase width if 64K unique message sets are not enough
+    using contextIdx_t = uint32_t;  // Index of interned contents and include parent
     using MsgEnBitSet = std::bitset<V3ErrorCode::_ENUM_MAX>;
+    using Context = std::pair<VFileContent*, FileLine*>;  // Contents, and parent that included
 
     // MEMBERS
     V3Mutex m_mutex;  // protects members
@@ -61,9 +64,14 @@ class FileLineSingleton final {
     // Interned message enablement flag sets
     std::vector<MsgEnBitSet> m_internedMsgEns;
 
+    // Map from context to the index in m_internedContexts for interning
+    std::map<Context, contextIdx_t> m_internedContextIdxs VL_GUARDED_BY(m_mutex);
+    // Interned contexts, each shared by all FileLines from one input stream
+    std::deque<Context> m_internedContexts;
+
     // CONSTRUCTORS
-    FileLineSingleton() = default;
-    ~FileLineSingleton() = default;
+    FileLineSingleton() { addContext(Context{nullptr, nullptr}); }
+    ~FileLineSingleton();
 
     fileNameIdx_t nameToNumber(const string& filename);
     string numberToName(fileNameIdx_t filenameno) const VL_MT_SAFE { return m_names[filenameno]; }
@@ -92,11 +100,17 @@ class FileLineSingleton final {
     const MsgEnBitSet& msgEn(msgEnSetIdx_t idx) const VL_MT_SAFE {
         return m_internedMsgEns.at(idx);
     }
+
+    // Add given context to the interned contexts, return interned index
+    contextIdx_t addContext(const Context& context) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Retrieve interned context at given interned index
+    const Context& context(contextIdx_t idx) const VL_MT_SAFE { return m_internedContexts[idx]; }
 };
 
 // All source lines from a file/stream, to enable errors to show sources
 class VFileContent final {
     friend class FileLine;
+    friend class FileLineSingleton;
     // MEMBERS
     int m_id;  // Content ID number
     // Reference count for sharing (shared_ptr has size overhead that we don't want)
@@ -136,6 +150,8 @@ class FileLine final {
     // TYPES
     using fileNameIdx_t = FileLineSingleton::fileNameIdx_t;
     using msgEnSetIdx_t = FileLineSingleton::msgEnSetIdx_t;
+    using contextIdx_t = FileLineSingleton::contextIdx_t;
+    using Context = FileLineSingleton::Context;
     using MsgEnBitSet = FileLineSingleton::MsgEnBitSet;
 
     // MEMBERS
@@ -148,8 +164,9 @@ class FileLine final {
     int m_firstColumn = 0;  // `line corrected token's first column number
     int m_lastLineno = 0;  // `line corrected token's last line number
     int m_lastColumn = 0;  // `line corrected token's last column number
-    VFileContent* m_contentp = nullptr;  // Source text contents line is within
-    FileLine* m_parent = nullptr;  // Parent line that included this line
+    // Source text contents line is within, and parent line that included this line
+    // (index into interned array, as these are the same for every line of a stream)
+    contextIdx_t m_contextIdx = 0;
 
 protected:
     // User routines should never need to change line numbers
@@ -192,10 +209,7 @@ public:
         , m_firstColumn{from.m_firstColumn}
         , m_lastLineno{from.m_lastLineno}
         , m_lastColumn{from.m_lastColumn}
-        , m_contentp{from.m_contentp}
-        , m_parent{from.m_parent} {
-        if (m_contentp) m_contentp->refInc();
-    }
+        , m_contextIdx{from.m_contextIdx} {}
     explicit FileLine(FileLine* fromp)
         : m_msgEnIdx{fromp->m_msgEnIdx}
         , m_filenameno{fromp->m_filenameno}
@@ -205,15 +219,12 @@ public:
         , m_firstColumn{fromp->m_firstColumn}
         , m_lastLineno{fromp->m_lastLineno}
         , m_lastColumn{fromp->m_lastColumn}
-        , m_contentp{fromp->m_contentp}
-        , m_parent{fromp->m_parent} {
-        if (m_contentp) m_contentp->refInc();
-    }
+        , m_contextIdx{fromp->m_contextIdx} {}
     void applyIgnores();
     FileLine* copyOrSameFileLine();
     FileLine* copyOrSameFileLineApplied();
     static void deleteAllRemaining();
-    ~FileLine();
+    ~FileLine() = default;
 #ifdef VL_LEAK_CHECKS
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
@@ -236,7 +247,9 @@ public:
     }
     void language(V3LangCode lang) const { singleton().numberToLang(filenameno(), lang); }
     void filename(const string& name) { m_filenameno = singleton().nameToNumber(name); }
-    void parent(FileLine* fileline) { m_parent = fileline; }
+    void parent(FileLine* fileline) {
+        m_contextIdx = singleton().addContext(Context{contentp(), fileline});
+    }
     void lineDirective(const char* textp, int& enterExitRef);
     void lineDirectiveParse(const char* textp, string& filenameRef, int& linenoRef,
                             int& enterExitRef);
@@ -255,14 +268,16 @@ public:
     int firstColumn() const VL_MT_SAFE { return m_firstColumn; }
     int lastLineno() const VL_MT_SAFE { return m_lastLineno; }
     int lastColumn() const VL_MT_SAFE { return m_lastColumn; }
-    VFileContent* contentp() const { return m_contentp; }
+    VFileContent* contentp() const VL_MT_SAFE {
+        return singleton().context(m_contextIdx).first;
+    }
     // If not otherwise more specific, use last lineno for errors etc,
     // as the parser errors etc generally make more sense pointing at the last parse point
     int lineno() const VL_MT_SAFE { return m_lastLineno; }
     string source() const VL_MT_SAFE;
     string sourcePrefix(int toColumn) const VL_MT_SAFE;
     string prettySource() const VL_MT_SAFE;  // Source, w/stripped unprintables and newlines
-    FileLine* parent() const VL_MT_SAFE { return m_parent; }
+    FileLine* parent() const VL_MT_SAFE { return singleton().context(m_contextIdx).second; }
     V3LangCode language() const { return singleton().numberToLang(filenameno()); }
     string ascii() const VL_MT_SAFE;
     string asciiLineCol() const;
@@ -40,6 +40,9 @@
 //
 //  After each WRITE of forced RHS
 //      reevaluate <lhs>__VforceVal to support VarRef rollback after release
+//
+//  With --force-guard, reevaluating a ranged <name>__VforceRd reads <name>
+//  directly until anything has been forced, as flagged by __VforceActive
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -78,10 +81,13 @@ public:
         AstVarScope* const m_rdVscp;  // New variable to replace read references with
         AstVarScope* const m_valVscp;  // Forced value
         AstVarScope* const m_enVscp;  // Force enabled signal
-        explicit ForceComponentsVarScope(AstVarScope* vscp, ForceComponentsVar& fcv)
+        AstVarScope* const m_activeVscp;  // Anything ever forced, nullptr if not --force-guard
+        explicit ForceComponentsVarScope(AstVarScope* vscp, ForceComponentsVar& fcv,
+                                         AstVarScope* activeVscp)
             : m_rdVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_rdVarp}}
             , m_valVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_valVarp}}
-            , m_enVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_enVarp}} {
+            , m_enVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_enVarp}}
+            , m_activeVscp{ForceState::isRangedDType(vscp) ? activeVscp : nullptr} {
             m_rdVscp->addNext(m_enVscp);
             m_rdVscp->addNext(m_valVscp);
             vscp->addNextHere(m_rdVscp);
@@ -121,8 +127,19 @@ public:
                 AstActive* const activep
                     = new AstActive{flp, "force-update", new AstSenTree{flp, itemsp}};
                 activep->sensesStorep(activep->sensesp());
-                activep->addStmtsp(new AstAlways{flp, VAlwaysKwd::ALWAYS, nullptr,
-                                                 new AstAssign{flp, lhsp, rhsp}});
+                AstAssign* const updatep = new AstAssign{flp, lhsp, rhsp};
+                AstNode* stmtsp = updatep;
+                if (m_activeVscp) {
+                    // Also catches the enable being set externally, as that triggers this
+                    AstNodeExpr* const anyp = new AstOr{
+                        flp, new AstVarRef{flp, m_activeVscp, VAccess::READ},
+                        new AstRedOr{flp, new AstVarRef{flp, m_enVscp, VAccess::READ}}};
+                    AstAssign* const setActivep = new AstAssign{
+                        flp, new AstVarRef{flp, m_activeVscp, VAccess::WRITE}, anyp};
+                    setActivep->addNext(updatep);
+                    stmtsp = setActivep;
+                }
+                activep->addStmtsp(new AstAlways{flp, VAlwaysKwd::ALWAYS, nullptr, stmtsp});
                 vscp->scopep()->addBlocksp(activep);
             }
         }
@@ -131,12 +148,17 @@ public:
             AstVarRef* const origp = new AstVarRef{flp, vscp, VAccess::READ};
             ForceState::markNonReplaceable(origp);
             if (ForceState::isRangedDType(vscp)) {
-                return new AstOr{
+                AstNodeExpr* const forcedp = new AstOr{
                     flp,
                     new AstAnd{flp, new AstVarRef{flp, m_enVscp, VAccess::READ},
                                new AstVarRef{flp, m_valVscp, VAccess::READ}},
                     new AstAnd{flp, new AstNot{flp, new AstVarRef{flp, m_enVscp, VAccess::READ}},
                                origp}};
+                if (!m_activeVscp) return forcedp;
+                AstVarRef* const unforcedp = origp->cloneTree(false);
+                ForceState::markNonReplaceable(unforcedp);
+                return new AstCond{flp, new AstVarRef{flp, m_activeVscp, VAccess::READ},
+                                   forcedp, unforcedp};
             }
             return new AstCond{flp, new AstVarRef{flp, m_enVscp, VAccess::READ},
                                new AstVarRef{flp, m_valVscp, VAccess::READ}, origp};
@@ -155,6 +177,7 @@ private:
     const VNUser3InUse m_user3InUse;
     AstUser1Allocator<AstVar, ForceComponentsVar> m_forceComponentsVar;
     AstUser1Allocator<AstVarScope, ForceComponentsVarScope> m_forceComponentsVarScope;
+    AstVarScope* m_activeVscp = nullptr;  // Anything ever forced, for --force-guard
 
 public:
     // CONSTRUCTORS
@@ -178,9 +201,27 @@ public:
     }
 
     // METHODS
+    AstVarScope* getActiveVscp() {
+        if (!v3Global.opt.forceGuard()) return nullptr;
+        if (!m_activeVscp) {
+            AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
+            FileLine* const flp = scopep->fileline();
+            m_activeVscp = scopep->createTemp("__VforceActive", 1);
+            AstAssign* const assignp
+                = new AstAssign{flp, new AstVarRef{flp, m_activeVscp, VAccess::WRITE},
+                                new AstConst{flp, AstConst::BitFalse{}}};
+            AstActive* const activep = new AstActive{
+                flp, "force-init", new AstSenTree{flp, new AstSenItem{flp, AstSenItem::Static{}}}};
+            activep->sensesStorep(activep->sensesp());
+            activep->addStmtsp(new AstInitial{flp, assignp});
+            scopep->addBlocksp(activep);
+        }
+        return m_activeVscp;
+    }
     const ForceComponentsVarScope& getForceComponents(AstVarScope* vscp) {
         AstVar* const varp = vscp->varp();
-        return m_forceComponentsVarScope(vscp, vscp, m_forceComponentsVar(varp, varp));
+        return m_forceComponentsVarScope(vscp, vscp, m_forceComponentsVar(varp, varp),
+                                         getActiveVscp());
     }
     ForceComponentsVarScope* tryGetForceComponents(AstVarRef* nodep) const {
         return m_forceComponentsVarScope.tryGet(nodep->varScopep());
@@ -248,7 +289,14 @@ class ForceConvertVisitor final : public VNVisitor {
 
         setEnp->addNext(setValp);
         setEnp->addNext(setRdp);
-        relinker.relink(setEnp);
+        AstNode* stmtsp = setEnp;
+        if (AstVarScope* const activeVscp = m_state.getActiveVscp()) {
+            // Later writes to the forced signal then re-evaluate the read signal in full
+            stmtsp = new AstAssign{flp, new AstVarRef{flp, activeVscp, VAccess::WRITE},
+                                   new AstConst{flp, AstConst::BitTrue{}}};
+            stmtsp->addNext(setEnp);
+        }
+        relinker.relink(stmtsp);
     }
 
     void visit(AstRelease* nodep) override {
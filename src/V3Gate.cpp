@@ -725,8 +725,9 @@ class GateInline final {
         if (pair.second) pair.first->second = substp->cloneTreePure(false);
     }
 
-    void commitSubstitutions(AstNode* logicp) {
-        if (!m_hasPending.erase(logicp)) return;  // Had no pending substitutions
+    // Returns true if the logic was changed
+    bool commitSubstitutions(AstNode* logicp) {
+        if (!m_hasPending.erase(logicp)) return false;  // Had no pending substitutions
 
         Substitutions& substitutions = m_substitutions(logicp);
         UASSERT_OBJ(!substitutions.empty(), logicp, "No pending substitutions");
@@ -776,6 +777,7 @@ class GateInline final {
         UASSERT_OBJ(simplifiedp == logicp, simplifiedp, "Should not remove whole logic");
         for (const auto& pair : substitutions) pair.second->deleteTree();
         substitutions.clear();
+        return true;
     }
 
     void optimizeSignals(bool allowMultiIn) {
@@ -804,15 +806,24 @@ class GateInline final {
             AstNode* const logicp = lVtxp->nodep();
 
             // Commit pending optimizations to driving logic, as we will re-analyze
-            commitSubstitutions(logicp);
+            if (commitSubstitutions(logicp)) {
+                // Logic changed, so earlier rejections of the variables it drives are stale
+                for (V3GraphEdge& edge : lVtxp->outEdges()) edge.top()->user(0);
+            }
+
+            // Rejected by an earlier sweep, and neither the logic nor the clock changed since
+            const uint32_t rejectedFlag = vVtxp->isClock() ? 2 : 1;
+            if (vVtxp->user() == rejectedFlag) continue;
 
             // Can we eliminate?
             const GateOkVisitor okVisitor{logicp, vVtxp->isClock(), false};
 
             // Was it ok?
-            if (!okVisitor.isSimple()) continue;
             // If the varScope is already removed from logicp, no need to try substitution.
-            if (!okVisitor.varAssigned(vVtxp->varScp())) continue;
+            if (!okVisitor.isSimple() || !okVisitor.varAssigned(vVtxp->varScp())) {
+                vVtxp->user(rejectedFlag);
+                continue;
+            }
             if (excludedWide(vVtxp, okVisitor.substitutionp())) {
                 ++m_statExcluded;
                 UINFO(9, "Gate inline exclude '" << vVtxp->name() << "'");
@@ -913,7 +924,8 @@ class GateInline final {
     explicit GateInline(GateGraph& graph)
         : m_graph{graph} {
         // Find gate interconnect and optimize
-        graph.userClearVertices();  // vertex->user(): bool. Indicates we've set it as consumed
+        // vertex->user(): GateVarVertex: 1/2 if its logic was rejected with !isClock/isClock
+        graph.userClearVertices();
         // Get rid of buffers first,
         optimizeSignals(false);
         // Then propagate more complicated equations
@@ -75,6 +75,20 @@ void V3Global::readFiles() {
                          "Cannot find verilated_std.sv containing built-in std:: definitions: ");
     }
 
+    // Read the source files ahead, in parallel; preprocessing and parsing stay in order
+    {
+        std::vector<string> filenames;
+        for (const auto& filelib : v3Global.opt.vFiles()) {
+            const string filename = v3Global.opt.filePath(nullptr, filelib.filename(), "", "");
+            if (!filename.empty()) filenames.push_back(filename);
+        }
+        for (const auto& filelib : v3Global.opt.libraryFiles()) {
+            const string filename = v3Global.opt.filePath(nullptr, filelib.filename(), "", "");
+            if (!filename.empty()) filenames.push_back(filename);
+        }
+        filter.prefetch(filenames);
+    }
+
     // Read top module
     for (const auto& filelib : v3Global.opt.vFiles()) {
         parser.parseFile(new FileLine{FileLine::commandLineFilename()}, filelib.filename(), false,
@@ -198,6 +212,7 @@ std::vector<std::string> V3Global::verilatedCppFiles() {
     if (v3Global.opt.vpi()) result.emplace_back("verilated_vpi.cpp");
     if (v3Global.opt.savable()) result.emplace_back("verilated_save.cpp");
     if (v3Global.opt.coverage()) result.emplace_back("verilated_cov.cpp");
+    if (v3Global.opt.fuzzServer()) result.emplace_back("verilated_fuzz.cpp");
     if (v3Global.opt.trace()) result.emplace_back(v3Global.opt.traceSourceBase() + "_c.cpp");
     if (v3Global.usesProbDist()) result.emplace_back("verilated_probdist.cpp");
     if (v3Global.usesTiming()) result.emplace_back("verilated_timing.cpp");
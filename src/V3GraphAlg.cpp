@@ -34,6 +34,31 @@
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+//######################################################################
+//######################################################################
+// Frozen CSR view
+
+V3GraphCsr::V3GraphCsr(V3Graph* graphp, V3EdgeFuncP edgeFuncp) {
+    // Vertex::user  // Index of the vertex
+    uint32_t nVertices = 0;
+    size_t nEdges = 0;
+    for (V3GraphVertex& vertex : graphp->vertices()) {
+        vertex.user(nVertices++);
+        nEdges += vertex.outEdges().size();
+    }
+    m_vertexps.reserve(nVertices);
+    m_outBegin.reserve(nVertices + 1);
+    m_outTo.reserve(nEdges);
+    for (V3GraphVertex& vertex : graphp->vertices()) {
+        m_vertexps.push_back(&vertex);
+        m_outBegin.push_back(static_cast<uint32_t>(m_outTo.size()));
+        for (V3GraphEdge& edge : vertex.outEdges()) {
+            if (edge.weight() && edgeFuncp(&edge)) m_outTo.push_back(edge.top()->user());
+        }
+    }
+    m_outBegin.push_back(static_cast<uint32_t>(m_outTo.size()));
+}
+
 //######################################################################
 //######################################################################
 // Algorithms - Remove redundancies
@@ -175,80 +200,81 @@ void V3Graph::weaklyConnected(V3EdgeFuncP edgeFuncp) { GraphAlgWeakly{this, edge
 // Changes user() and color()
 
 class GraphAlgStrongly final : GraphAlg<> {
+    const V3GraphCsr m_csr;  // Frozen view of the graph
+    std::vector<uint32_t> m_dfs;  // Per vertex index: DFS number, possible root of subtree
+    std::vector<uint32_t> m_color;  // Per vertex index: Output subtree number
     uint32_t m_currentDfs = 0;  // DFS count
-    std::vector<V3GraphVertex*> m_callTrace;  // List of everything we hit processing so far
+    std::vector<uint32_t> m_callTrace;  // List of everything we hit processing so far
 
     void main() {
         // Use Pearce's algorithm to color the strongly connected components. For reference see
         // "An Improved Algorithm for Finding the Strongly Connected Components of a Directed
         // Graph", David J.Pearce, 2005
         //
-        // Node State:
-        //     Vertex::user     // DFS number indicating possible root of subtree, 0=not iterated
-        //     Vertex::color    // Output subtree number (fully processed)
-
-        // Clear info
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            vertex.color(0);
-            vertex.user(0);
-        }
+        // Node State, indexed by CSR vertex index, copied back to the graph at the end:
+        //     m_dfs -> Vertex::user     // DFS number indicating possible root of subtree,
+        //                               // 0=not iterated
+        //     m_color -> Vertex::color  // Output subtree number (fully processed)
+        const uint32_t size = m_csr.size();
+        m_dfs.assign(size, 0);
+        m_color.assign(size, 0);
         // Color graph
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            if (!vertex.user()) {
+        for (uint32_t idx = 0; idx < size; ++idx) {
+            if (!m_dfs[idx]) {
                 m_currentDfs++;
-                vertexIterate(&vertex);
+                vertexIterate(idx);
             }
         }
         // If there's a single vertex of a color, it doesn't need a subgraph
         // This simplifies the consumer's code, and reduces graph debugging clutter
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
+        for (uint32_t idx = 0; idx < size; ++idx) {
             bool onecolor = true;
-            for (V3GraphEdge& edge : vertex.outEdges()) {
-                if (followEdge(&edge)) {
-                    if (vertex.color() == edge.top()->color()) {
-                        onecolor = false;
-                        break;
-                    }
+            for (const uint32_t* top = m_csr.outBegin(idx); top != m_csr.outEnd(idx); ++top) {
+                if (m_color[idx] == m_color[*top]) {
+                    onecolor = false;
+                    break;
                 }
             }
-            if (onecolor) vertex.color(0);
+            // Colors are only read from out edge destinations, so can write back here
+            V3GraphVertex* const vertexp = m_csr.vertexp(idx);
+            vertexp->user(m_dfs[idx]);
+            vertexp->color(onecolor ? 0 : m_color[idx]);
         }
     }
 
-    void vertexIterate(V3GraphVertex* vertexp) {
+    void vertexIterate(uint32_t idx) {
         const uint32_t thisDfsNum = m_currentDfs++;
-        vertexp->user(thisDfsNum);
-        vertexp->color(0);
-        for (V3GraphEdge& edge : vertexp->outEdges()) {
-            if (followEdge(&edge)) {
-                V3GraphVertex* top = edge.top();
-                if (!top->user()) {  // Dest not computed yet
-                    vertexIterate(top);
-                }
-                if (!top->color()) {  // Dest not in a component
-                    if (vertexp->user() > top->user()) vertexp->user(top->user());
-                }
+        m_dfs[idx] = thisDfsNum;
+        m_color[idx] = 0;
+        for (const uint32_t* topp = m_csr.outBegin(idx); topp != m_csr.outEnd(idx); ++topp) {
+            const uint32_t top = *topp;
+            if (!m_dfs[top]) {  // Dest not computed yet
+                vertexIterate(top);
+            }
+            if (!m_color[top]) {  // Dest not in a component
+                if (m_dfs[idx] > m_dfs[top]) m_dfs[idx] = m_dfs[top];
             }
         }
-        if (vertexp->user() == thisDfsNum) {  // New head of subtree
-            vertexp->color(thisDfsNum);  // Mark as component
+        if (m_dfs[idx] == thisDfsNum) {  // New head of subtree
+            m_color[idx] = thisDfsNum;  // Mark as component
             while (!m_callTrace.empty()) {
-                V3GraphVertex* popVertexp = m_callTrace.back();
-                if (popVertexp->user() >= thisDfsNum) {  // Lower node is part of this subtree
+                const uint32_t popIdx = m_callTrace.back();
+                if (m_dfs[popIdx] >= thisDfsNum) {  // Lower node is part of this subtree
                     m_callTrace.pop_back();
-                    popVertexp->color(thisDfsNum);
+                    m_color[popIdx] = thisDfsNum;
                 } else {
                     break;
                 }
             }
         } else {  // In another subtree (maybe...)
-            m_callTrace.push_back(vertexp);
+            m_callTrace.push_back(idx);
         }
     }
 
 public:
     GraphAlgStrongly(V3Graph* graphp, V3EdgeFuncP edgeFuncp)
-        : GraphAlg<>{graphp, edgeFuncp} {
+        : GraphAlg<>{graphp, edgeFuncp}
+        , m_csr{graphp, edgeFuncp} {
         main();
     }
     ~GraphAlgStrongly() = default;
@@ -262,41 +288,57 @@ void V3Graph::stronglyConnected(V3EdgeFuncP edgeFuncp) { GraphAlgStrongly{this,
 // Changes user() and rank()
 
 class GraphAlgRank final : GraphAlg<> {
+    const V3GraphCsr m_csr;  // Frozen view of the graph
+    std::vector<uint32_t> m_rank;  // Per vertex index: rank
+    std::vector<uint32_t> m_rankAdder;  // Per vertex index: Vertex::rankAdder(), cached
+    std::vector<uint8_t> m_state;  // Per vertex index: 1 indicates processing, 2 completed
+
     void main() {
         // Rank each vertex, ignoring cutable edges
-        // Vertex::m_user begin: 1 indicates processing, 2 indicates completed
-        // Clear existing ranks
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            vertex.rank(0);
-            vertex.user(0);
+        // Node State, indexed by CSR vertex index, copied back to the graph at the end:
+        //     m_rank -> Vertex::rank
+        //     m_state -> Vertex::user
+        const uint32_t size = m_csr.size();
+        m_rank.assign(size, 0);
+        m_state.assign(size, 0);
+        m_rankAdder.reserve(size);
+        for (uint32_t idx = 0; idx < size; ++idx) {
+            m_rankAdder.push_back(m_csr.vertexp(idx)->rankAdder());
         }
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            if (!vertex.user()) {  //
-                vertexIterate(&vertex, 1);
+        for (uint32_t idx = 0; idx < size; ++idx) {
+            if (!m_state[idx]) {  //
+                vertexIterate(idx, 1);
             }
         }
+        for (uint32_t idx = 0; idx < size; ++idx) {
+            V3GraphVertex* const vertexp = m_csr.vertexp(idx);
+            vertexp->rank(m_rank[idx]);
+            vertexp->user(m_state[idx]);
+        }
     }
 
-    void vertexIterate(V3GraphVertex* vertexp, uint32_t currentRank) {
+    void vertexIterate(uint32_t idx, uint32_t currentRank) {
         // Assign rank to each unvisited node
         // If larger rank is found, assign it and loop back through
         // If we hit a back node make a list of all loops
-        if (vertexp->user() == 1) {
-            m_graphp->loopsMessageCb(vertexp, m_edgeFuncp);
+        if (m_state[idx] == 1) {
+            m_graphp->loopsMessageCb(m_csr.vertexp(idx), m_edgeFuncp);
             return;  // LCOV_EXCL_LINE  // gcc gprof bug misses this return
         }
-        if (vertexp->rank() >= currentRank) return;  // Already processed it
-        vertexp->user(1);
-        vertexp->rank(currentRank);
-        for (V3GraphEdge& edge : vertexp->outEdges()) {
-            if (followEdge(&edge)) vertexIterate(edge.top(), currentRank + vertexp->rankAdder());
+        if (m_rank[idx] >= currentRank) return;  // Already processed it
+        m_state[idx] = 1;
+        m_rank[idx] = currentRank;
+        const uint32_t nextRank = currentRank + m_rankAdder[idx];
+        for (const uint32_t* topp = m_csr.outBegin(idx); topp != m_csr.outEnd(idx); ++topp) {
+            vertexIterate(*topp, nextRank);
         }
-        vertexp->user(2);
+        m_state[idx] = 2;
     }
 
 public:
     GraphAlgRank(V3Graph* graphp, V3EdgeFuncP edgeFuncp)
-        : GraphAlg<>{graphp, edgeFuncp} {
+        : GraphAlg<>{graphp, edgeFuncp}
+        , m_csr{graphp, edgeFuncp} {
         main();
     }
     ~GraphAlgRank() = default;
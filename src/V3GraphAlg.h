@@ -23,6 +23,8 @@
 #include "V3Global.h"
 #include "V3Graph.h"
 
+#include <vector>
+
 //=============================================================================
 // Algorithms - common class
 // For internal use, most graph algorithms use this as a base class
@@ -41,6 +43,34 @@ protected:
     bool followEdge(V3GraphEdge* edgep) { return (edgep->weight() && (m_edgeFuncp)(edgep)); }
 };
 
+//=============================================================================
+// Frozen compressed sparse row (CSR) view of the followed edges of a graph.
+// Built once, then read-only; analysis passes walk contiguous index arrays
+// rather than chasing the vertex and edge lists. Out edges of each vertex
+// keep their original order, so traversals visit vertices in the same order
+// as they would on the V3Graph itself.
+// Side-effect of construction: changes user() of every vertex
+
+class V3GraphCsr final {
+    std::vector<V3GraphVertex*> m_vertexps;  // Vertex of each index, in vertices() order
+    std::vector<uint32_t> m_outBegin;  // Start of each vertex's edges in m_outTo, plus end
+    std::vector<uint32_t> m_outTo;  // Destination vertex index of each edge
+
+public:
+    // CONSTRUCTORS
+    V3GraphCsr(V3Graph* graphp, V3EdgeFuncP edgeFuncp) VL_MT_DISABLED;
+    ~V3GraphCsr() = default;
+    VL_UNCOPYABLE(V3GraphCsr);
+    // ACCESSORS
+    uint32_t size() const { return static_cast<uint32_t>(m_vertexps.size()); }
+    uint32_t edgeCount() const { return static_cast<uint32_t>(m_outTo.size()); }
+    V3GraphVertex* vertexp(uint32_t idx) const { return m_vertexps[idx]; }
+    // Destination indices of the out edges of vertex 'idx', for range-for
+    const uint32_t* outBegin(uint32_t idx) const { return m_outTo.data() + m_outBegin[idx]; }
+    const uint32_t* outEnd(uint32_t idx) const { return m_outTo.data() + m_outBegin[idx + 1]; }
+    bool hasOut(uint32_t idx) const { return m_outBegin[idx] != m_outBegin[idx + 1]; }
+};
+
 //============================================================================
 
 #endif  // Guard
@@ -21,6 +21,7 @@
 
 #include "V3Global.h"
 #include "V3Graph.h"
+#include "V3GraphAlg.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -117,6 +118,36 @@ public:
     }
 };
 
+class V3GraphTestCsr final : public V3GraphTest {
+public:
+    string name() override { return "csr"; }
+    void runTest() override {
+        V3Graph* gp = &m_graph;
+        // Verify the frozen view drops unfollowed edges and ranks match the graph
+        V3GraphTestVertex* a = new V3GraphTestVarVertex{gp, "a"};
+        V3GraphTestVertex* b = new V3GraphTestVarVertex{gp, "b"};
+        V3GraphTestVertex* c = new V3GraphTestVarVertex{gp, "c"};
+        V3GraphTestVertex* d = new V3GraphTestVarVertex{gp, "d"};
+        new V3GraphEdge{gp, a, b, 2, true};
+        new V3GraphEdge{gp, a, c, 2, true};
+        new V3GraphEdge{gp, b, d, 2, true};
+        new V3GraphEdge{gp, c, d, 0, true};  // Zero weight, not followed
+
+        {
+            const V3GraphCsr csr{gp, &V3GraphEdge::followAlwaysTrue};
+            UASSERT(csr.size() == 4 && csr.edgeCount() == 3, "SelfTest: CSR size wrong");
+            UASSERT(csr.vertexp(0) == a && csr.vertexp(3) == d, "SelfTest: CSR order wrong");
+            UASSERT(!csr.hasOut(2) && !csr.hasOut(3), "SelfTest: CSR edges wrong");
+            UASSERT(*csr.outBegin(1) == 3, "SelfTest: CSR edge destination wrong");
+        }
+
+        gp->rank(&V3GraphEdge::followAlwaysTrue);
+        dumpSelf();
+        UASSERT(a->rank() == 1 && b->rank() == 2 && c->rank() == 2 && d->rank() == 3,
+                "SelfTest: Ranks not assigned");
+    }
+};
+
 class V3GraphTestAcyc final : public V3GraphTest {
 public:
     string name() override { return "acyc"; }
@@ -300,6 +331,7 @@ void V3Graph::selfTest() {
     // Execute all of the tests
     UINFO(2, __FUNCTION__ << ":");
     { V3GraphTestStrong{}.run(); }
+    { V3GraphTestCsr{}.run(); }
     { V3GraphTestAcyc{}.run(); }
     { V3GraphTestVars{}.run(); }
     { V3GraphTestImport{}.run(); }
@@ -35,6 +35,13 @@
 //
 // Then user can build Verilated module as usual.
 //
+// At run time a block is evaluated through the wrapper's DPI update calls.
+// V3ProtectLib marks these as non-hazardous and gives them the block's cost
+// and hier_workers, so with --threads the parent schedules each call as its
+// own MTask, running concurrently with unrelated logic, and the block's eval
+// uses its workers from the shared thread pool. Blocks are synchronized with
+// the parent only through their ports, by the parent's scheduling edges.
+//
 // Here is more detailed internal process.
 // 1) Parser adds VPragmaType::HIER_BLOCK of AstPragma to modules
 //    that are marked with /*verilator hier_block*/ metacomment in Verilator run a).
@@ -111,6 +118,24 @@ static string V3HierParametersFileName(const string& prefix) {
     return v3Global.opt.makeDir() + "/" + prefix + "__hierParameters.v";
 }
 
+// Write file contents, leaving an identical existing file untouched with
+// --output-keep-identical, so make does not re-verilate unchanged blocks
+static void V3HierWriteFile(const string& filename, const string& contents) {
+    if (v3Global.opt.outputKeepIdentical()) {
+        const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream_nodepend(filename)};
+        if (!ifp->fail()) {
+            std::stringstream old;
+            old << ifp->rdbuf();
+            if (old.str() == contents) {
+                V3File::addTgtDepend(filename);
+                return;
+            }
+        }
+    }
+    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(filename)};
+    *of << contents;
+}
+
 static void V3HierWriteCommonInputs(const V3HierBlock* hblockp, std::ostream* of, bool forCMake) {
     string topModuleFile;
     if (hblockp) topModuleFile = hblockp->vFileIfNecessary();
@@ -258,7 +283,8 @@ string V3HierBlock::vFileIfNecessary() const {
 }
 
 void V3HierBlock::writeCommandArgsFile(bool forCMake) const {
-    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(commandArgsFilename(forCMake))};
+    std::ostringstream os;
+    std::ostream* const of = &os;
     *of << "--cc\n";
 
     if (!forCMake) {
@@ -267,12 +293,13 @@ void V3HierBlock::writeCommandArgsFile(bool forCMake) const {
         }
         *of << "-Mdir " << v3Global.opt.makeDir() << "/" << hierPrefix() << " \n";
     }
-    V3HierWriteCommonInputs(this, of.get(), forCMake);
+    V3HierWriteCommonInputs(this, of, forCMake);
     const V3StringList& commandOpts = commandArgs(false);
     for (const string& opt : commandOpts) *of << opt << "\n";
     *of << hierBlockArgs().front() << "\n";
     for (const auto& hierblockp : m_children) *of << hierblockp->hierBlockArgs().front() << "\n";
     *of << v3Global.opt.allArgsStringForHierBlock(false) << "\n";
+    V3HierWriteFile(commandArgsFilename(forCMake), os.str());
 }
 
 string V3HierBlock::commandArgsFilename(bool forCMake) const {
@@ -288,7 +315,8 @@ void V3HierBlock::writeParametersFile() const {
 
     VHashSha256 hash{"type params"};
     const string moduleName = "Vhsh" + hash.digestSymbol();
-    const std::unique_ptr<std::ofstream> of{V3File::new_ofstream(typeParametersFilename())};
+    std::ostringstream os;
+    std::ostream* const of = &os;
     *of << "module " << moduleName << ";\n";
     for (AstParamTypeDType* const gparam : m_params.gTypeParams()) {
         AstTypedef* tdefp
@@ -300,6 +328,7 @@ void V3HierBlock::writeParametersFile() const {
     *of << "endmodule\n\n";
     *of << "`verilator_config\n";
     *of << "hier_params -module \"" << moduleName << "\"\n";
+    V3HierWriteFile(typeParametersFilename(), os.str());
 }
 
 //######################################################################
@@ -466,15 +495,15 @@ void V3HierBlockPlan::writeCommandArgsFiles(bool forCMake) const {
         it->second->writeCommandArgsFile(forCMake);
     }
     // For the top module
-    const std::unique_ptr<std::ofstream> of{
-        V3File::new_ofstream(topCommandArgsFilename(forCMake))};
+    std::ostringstream os;
+    std::ostream* const of = &os;
     if (!forCMake) {
         // Load wrappers first not to be overwritten by the original HDL
         for (const_iterator it = begin(); it != end(); ++it) {
             *of << it->second->hierWrapperFilename(true) << "\n";
         }
     }
-    V3HierWriteCommonInputs(nullptr, of.get(), forCMake);
+    V3HierWriteCommonInputs(nullptr, of, forCMake);
     if (!forCMake) {
         const V3StringSet& cppFiles = v3Global.opt.cppFiles();
         for (const string& i : cppFiles) *of << i << "\n";
@@ -496,6 +525,7 @@ void V3HierBlockPlan::writeCommandArgsFiles(bool forCMake) const {
     *of << "--threads " << cvtToStr(v3Global.opt.threads()) << "\n";
     *of << (v3Global.opt.systemC() ? "--sc" : "--cc") << "\n";
     *of << v3Global.opt.allArgsStringForHierBlock(true) << "\n";
+    V3HierWriteFile(topCommandArgsFilename(forCMake), os.str());
 }
 
 string V3HierBlockPlan::topCommandArgsFilename(bool forCMake) {
@@ -39,6 +39,8 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 // CONFIG
 static const int INLINE_MODS_SMALLER = 100;  // If a mod is < this # nodes, can always inline it
+// With -finline-const-ports, budget multiplier added when all input pins are tied to constants
+static const double INLINE_CONST_PORTS_BONUS = 3.0;
 
 //######################################################################
 // Inlining state. Kept as AstNodeModule::user1p via AstUser1Allocator
@@ -48,6 +50,8 @@ namespace {
 struct ModuleState final {
     bool m_inlined = false;  // Whether to inline this module
     unsigned m_cellRefs = 0;  // Number of AstCells instantiating this module
+    unsigned m_inputPins = 0;  // Number of input pins over all instances
+    unsigned m_constPins = 0;  // Number of those input pins tied to a constant
     std::vector<AstCell*> m_childCells;  // AstCells under this module (to speed up traversal)
 };
 
@@ -81,6 +85,8 @@ class InlineMarkVisitor final : public VNVisitor {
     // STATE
     AstNodeModule* m_modp = nullptr;  // Current module
     VDouble0 m_statUnsup;  // Statistic tracking
+    VDouble0 m_statConstPorts;  // Statistic tracking
+    VDouble0 m_statShared;  // Statistic tracking
     std::vector<AstNodeModule*> m_allMods;  // All modules, in top-down order.
 
     // Within the context of a given module, LocalInstanceMap maps
@@ -106,6 +112,22 @@ class InlineMarkVisitor final : public VNVisitor {
         }
     }
 
+    bool constPortsBenefit(const AstNodeModule* modp, int growth) {
+        // Inputs tied to constants will mostly simplify away once inlined, so scale the
+        // allowed code growth by the fraction of instance inputs that are constant
+        if (!v3Global.opt.fInlineConstPorts()) return false;
+        const ModuleState& state = m_moduleState(modp);
+        if (!state.m_constPins) return false;
+        const double constFraction = static_cast<double>(state.m_constPins) / state.m_inputPins;
+        const double budget
+            = v3Global.opt.inlineMult() * (1.0 + INLINE_CONST_PORTS_BONUS * constFraction);
+        if (growth >= budget) return false;
+        UINFO(4, " Inline for constant ports " << state.m_constPins << "/" << state.m_inputPins
+                                                << "  " << modp);
+        ++m_statConstPorts;
+        return true;
+    }
+
     // VISITORS
     void visit(AstNodeModule* nodep) override {
         UASSERT_OBJ(!m_modp, nodep, "Unsupported: Nested modules");
@@ -132,7 +154,13 @@ class InlineMarkVisitor final : public VNVisitor {
         iterateChildren(nodep);
     }
     void visit(AstCell* nodep) override {
-        m_moduleState(nodep->modp()).m_cellRefs++;
+        ModuleState& childState = m_moduleState(nodep->modp());
+        childState.m_cellRefs++;
+        for (const AstPin* pinp = nodep->pinsp(); pinp; pinp = VN_AS(pinp->nextp(), Pin)) {
+            if (!pinp->modVarp() || !pinp->modVarp()->isNonOutput()) continue;
+            childState.m_inputPins++;
+            if (VN_IS(pinp->exprp(), Const)) childState.m_constPins++;
+        }
         m_moduleState(m_modp).m_childCells.push_back(nodep);
         m_instances[m_modp][nodep->modp()]++;
         iterateChildren(nodep);
@@ -203,6 +231,10 @@ class InlineMarkVisitor final : public VNVisitor {
 
             const int allowed = modp->user2();
             const int refs = m_moduleState(modp).m_cellRefs;
+            // With --inline-max-refs, keep heavily replicated modules as shared code
+            const bool shared
+                = v3Global.opt.inlineMaxRefs() > 0 && refs > v3Global.opt.inlineMaxRefs();
+            if (shared && allowed == CIL_MAYBE) ++m_statShared;
 
             // Should we automatically inline this module?
             // If --flatten is specified, then force everything to be inlined that can be.
@@ -215,9 +247,11 @@ class InlineMarkVisitor final : public VNVisitor {
                               && (allowed == CIL_USER  //
                                   || v3Global.opt.flatten()  //
                                   || refs == 1  //
-                                  || statements < INLINE_MODS_SMALLER  //
-                                  || v3Global.opt.inlineMult() < 1  //
-                                  || refs * statements < v3Global.opt.inlineMult());
+                                  || (!shared
+                                      && (statements < INLINE_MODS_SMALLER  //
+                                          || v3Global.opt.inlineMult() < 1  //
+                                          || refs * statements < v3Global.opt.inlineMult()
+                                          || constPortsBenefit(modp, refs * statements))));
             m_moduleState(modp).m_inlined = doit;
             UINFO(4, " Inline=" << doit << " Possible=" << allowed << " Refs=" << refs
                                 << " Stmts=" << statements << "  " << modp);
@@ -237,6 +271,8 @@ public:
     }
     ~InlineMarkVisitor() override {
         V3Stats::addStat("Optimizations, Inline unsupported", m_statUnsup);
+        V3Stats::addStat("Optimizations, Inline for constant ports", m_statConstPorts);
+        V3Stats::addStat("Optimizations, Inline shared replicated modules", m_statShared);
     }
 };
 
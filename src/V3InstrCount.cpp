@@ -19,7 +19,10 @@
 
 #include "V3InstrCount.h"
 
+#include "V3File.h"
+
 #include <iomanip>
+#include <sstream>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -30,6 +33,9 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 /// whichever is larger. We know we won't run both.
 
 class InstrCountVisitor final : public VNVisitorConst {
+    // Estimated pending updates in an NBA commit queue when committed
+    static constexpr uint32_t NBA_COMMIT_ENTRIES = 64;
+
     // NODE STATE
     //  AstNode::user1()        -> bool. Processed if assertNoDups
     //  AstNode::user2()        -> int.  Path cost + 1, 0 means don't dump
@@ -250,6 +256,27 @@ private:
         markCost(nodep);
         UASSERT_OBJ(nodep == m_startNodep, nodep, "Multiple actives, or not start node");
     }
+    void visit(AstCMethodHard* nodep) override {
+        if (m_ignoreRemaining) return;
+        const VisitBase vb{this, nodep};
+        iterateChildrenConst(nodep);
+        // Committing a V3Delayed commit queue replays each pending update, so it
+        // costs more than the call. Assume the target array gets up to
+        // NBA_COMMIT_ENTRIES pending updates, which is where the queue starts
+        // coalescing updates to the same element. This lets the partitioner run
+        // the commits of different memories in parallel, rather than merging them
+        // into other MTasks as if they were cheap.
+        if (nodep->name() != "commit") return;
+        const AstNBACommitQueueDType* const cqDTypep
+            = VN_CAST(nodep->fromp()->dtypep()->skipRefp(), NBACommitQueueDType);
+        if (!cqDTypep) return;
+        const uint32_t entries = std::min<uint32_t>(
+            cqDTypep->subDTypep()->skipRefp()->arrayUnpackedElements(), NBA_COMMIT_ENTRIES);
+        // Each entry loads the value and indices, partial updates also apply a mask
+        const uint32_t entryCost = AstNode::INSTR_COUNT_BRANCH
+                                   + AstNode::INSTR_COUNT_LD * (cqDTypep->partial() ? 4 : 2);
+        m_instrCount += entries * entryCost;
+    }
     void visit(AstNodeCCall* nodep) override {
         if (m_ignoreRemaining) return;
         const VisitBase vb{this, nodep};
@@ -322,3 +349,41 @@ uint32_t V3InstrCount::count(AstNode* nodep, bool assertNoDups, std::ostream* os
     if (osp) InstrCountDumpVisitor dumper{nodep, osp};
     return visitor.instrCount();
 }
+
+void V3InstrCount::loadCostTable(const string& filename) {
+    // Each line is "<name> <cost>", where name is an AstNode::INSTR_COUNT_* suffix
+    static const std::map<string, int*> s_costs = {
+        {"BRANCH", &AstNode::INSTR_COUNT_BRANCH},
+        {"CALL", &AstNode::INSTR_COUNT_CALL},
+        {"LD", &AstNode::INSTR_COUNT_LD},
+        {"INT_MUL", &AstNode::INSTR_COUNT_INT_MUL},
+        {"INT_DIV", &AstNode::INSTR_COUNT_INT_DIV},
+        {"DBL", &AstNode::INSTR_COUNT_DBL},
+        {"DBL_DIV", &AstNode::INSTR_COUNT_DBL_DIV},
+        {"DBL_TRIG", &AstNode::INSTR_COUNT_DBL_TRIG},
+        {"STR", &AstNode::INSTR_COUNT_STR},
+        {"TIME", &AstNode::INSTR_COUNT_TIME},
+        {"PLI", &AstNode::INSTR_COUNT_PLI},
+    };
+    const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream(filename)};
+    if (ifp->fail()) v3fatal("Cannot open --instr-count-table file: " << filename);
+    string line;
+    int lineno = 0;
+    while (std::getline(*ifp, line)) {
+        ++lineno;
+        const string::size_type commentPos = line.find('#');
+        if (commentPos != string::npos) line.erase(commentPos);
+        std::istringstream is{line};
+        string name;
+        if (!(is >> name)) continue;  // Blank line
+        int cost = 0;
+        string extra;
+        const auto it = s_costs.find(name);
+        if (it == s_costs.end() || !(is >> cost) || cost < 1 || (is >> extra)) {
+            v3fatal("Malformed --instr-count-table entry at " << filename << ":" << lineno
+                                                                << ": '" << line << "'");
+        }
+        UINFO(2, "Instruction cost " << name << " = " << cost);
+        *(it->second) = cost;
+    }
+}
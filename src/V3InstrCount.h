@@ -21,6 +21,8 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <string>
+
 class AstNode;
 
 class V3InstrCount final {
@@ -40,6 +42,10 @@ public:
     // Optional osp is stream to dump critical path to.
     static uint32_t count(AstNode* nodep, bool assertNoDups,
                           std::ostream* osp = nullptr) VL_MT_DISABLED;
+
+    // Override the AstNode::INSTR_COUNT_* operation costs from a table
+    // written by nodist/instr_count_calibrate; see --instr-count-table.
+    static void loadCostTable(const std::string& filename) VL_MT_DISABLED;
 };
 
 #endif  // guard
@@ -224,24 +224,13 @@ public:
             pair.first->second.complexAssign();
         }
     }
-    void consumedFind(AstVarScope* nodep) {
-        const auto pair = m_map.emplace(nodep, LifeVarEntry::CONSUMED{});
-        if (!pair.second) pair.first->second.consumed();
-    }
     void lifeToAbove() {
         // Any varrefs under a if/else branch affect statements outside and after the if/else
         UASSERT(m_aboveLifep, "Pushing life when already at the top level");
-        for (auto& itr : m_map) {
-            AstVarScope* const nodep = itr.first;
-            m_aboveLifep->complexAssignFind(nodep);
-            if (itr.second.everSet()) {
-                // Record there may be an assignment, so we don't constant propagate across the if.
-                complexAssignFind(nodep);
-            } else {
-                // Record consumption, so we don't eliminate earlier assignments
-                consumedFind(nodep);
-            }
-        }
+        // This marks every variable as a complex assignment above, which both stops constant
+        // propagation across the if, and stops elimination of earlier assignments. This
+        // block's own map is discarded afterwards, so needs no updating.
+        for (const auto& itr : m_map) m_aboveLifep->complexAssignFind(itr.first);
     }
     void dualBranch(LifeBlock* life1p, LifeBlock* life2p) {
         // Find any common sets on both branches of IF and propagate upwards
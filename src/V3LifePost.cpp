@@ -178,7 +178,14 @@ class LifePostDlyVisitor final : public VNVisitor {
             return true;
         }
         if (before(assignPostLoc, loc)) return true;
+        // dlyVarAssigns is sorted by mtask then sequence, so the first assignment in each
+        // mtask decides for the rest of that mtask, and the others need not be checked.
+        bool first = true;
+        const ExecMTask* lastMTaskp = nullptr;
         for (const auto& i : dlyVarAssigns) {
+            if (!first && i.mtaskp == lastMTaskp) continue;
+            first = false;
+            lastMTaskp = i.mtaskp;
             if (!before(loc, i)) return false;
         }
         return true;
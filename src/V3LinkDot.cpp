@@ -4648,6 +4648,9 @@ void V3LinkDot::linkDotGuts(AstNetlist* rootp, VLinkDotStep step) {
     state.computeIfaceVarSyms();
     state.computeScopeAliases();
     state.dumpSelf();
+    // Resolution is serial: it still inserts symbols (class imports, randomize/with blocks,
+    // implicit nets), sets user1/user3 on nodes shared between modules, and error order
+    // must be deterministic, so the VSymGraph is not frozen at this point.
     { LinkDotResolveVisitor{rootp, &state}; }
     state.dumpSelf();
 }
@@ -19,6 +19,9 @@
 //             if only referenced in one CFUNC, make it local
 //          VARSCOPE
 //             if non-public, always written before used, make it local
+//          With -flocalize-reads, each leaf CFUNC:
+//             VARSCOPE read more than once and never written in the function,
+//             copy into a local at the top, and read that instead
 //
 //*************************************************************************
 
@@ -53,13 +56,26 @@ class LocalizeVisitor final : public VNVisitor {
     AstUser4Allocator<AstCFunc, std::unordered_multimap<const AstVarScope*, AstVarRef*>>
         m_references;
 
+    // TYPES
+    struct CacheVar final {
+        uint32_t m_reads = 0;  // Number of reads in the function statements
+        bool m_unsafe = false;  // Written, or referenced outside the function statements
+    };
+
     // STATE - across all visitors
     std::vector<AstVarScope*> m_varScopeps;  // List of variables to consider for localization
+    // Functions, and the VarScopes in them to cache in locals, with -flocalize-reads
+    std::vector<std::pair<AstCFunc*, std::vector<AstVarScope*>>> m_cacheFuncs;
     VDouble0 m_statLocVars;  // Statistic tracking
+    VDouble0 m_statCachedVars;  // Statistic tracking
 
     // STATE - for current visit position (use VL_RESTORER)
     AstCFunc* m_cfuncp = nullptr;  // Current active function
     uint32_t m_nodeDepth = 0;  // Node depth under m_cfuncp
+    bool m_inStmts = false;  // Under AstCFunc::stmtsp, rather than arguments or initializers
+    bool m_cacheOk = false;  // No code in m_cfuncp might write variables without a VarRef
+    std::vector<AstVarScope*> m_cacheOrder;  // VarScopes referenced by m_cfuncp, in order
+    std::unordered_map<AstVarScope*, CacheVar> m_cacheVars;  // Per VarScope in m_cfuncp
 
     // METHODS
     bool isOptimizable(AstVarScope* nodep) {
@@ -126,10 +142,74 @@ class LocalizeVisitor final : public VNVisitor {
         m_varScopeps.clear();
     }
 
+    static bool isCacheable(const AstVarScope* nodep) {
+        // Narrow values only, so the copy is cheap and may live in a register
+        const AstVar* const varp = nodep->varp();
+        const AstBasicDType* const basicp = VN_CAST(nodep->dtypep()->skipRefp(), BasicDType);
+        return basicp && basicp->isIntegralOrPacked() && !nodep->isWide()
+               && !varp->isSigPublic()  // Might be written by VPI from a callback
+               && !varp->isFuncLocal()  // Already a local
+               && !varp->isClassMember();
+    }
+
+    void collectCacheVars() {
+        // Called at the end of m_cfuncp, picking out the variables to cache
+        std::vector<AstVarScope*> vscps;
+        if (m_cacheOk && !m_cfuncp->user1()) {
+            for (AstVarScope* const vscp : m_cacheOrder) {
+                const CacheVar& cacheVar = m_cacheVars[vscp];
+                if (cacheVar.m_unsafe || cacheVar.m_reads < 2) continue;
+                if (isCacheable(vscp)) vscps.push_back(vscp);
+            }
+        }
+        if (!vscps.empty()) m_cacheFuncs.emplace_back(m_cfuncp, std::move(vscps));
+        m_cacheOrder.clear();
+        m_cacheVars.clear();
+    }
+
+    void cacheVarScopes() {
+        for (const auto& pair : m_cacheFuncs) {
+            AstCFunc* const funcp = pair.first;
+            AstNode* const firstp = funcp->stmtsp();
+            for (AstVarScope* const nodep : pair.second) {
+                const auto er = m_references(funcp).equal_range(nodep);
+                // Skip if moved entirely into locals by moveVarScopes
+                if (!er.first->second->varScopep()) continue;
+
+                UINFO(4, "Caching " << nodep << " in " << funcp);
+                ++m_statCachedVars;
+                AstVar* const oldVarp = nodep->varp();
+                FileLine* const flp = oldVarp->fileline();
+                const string newName
+                    = "__Vcache__"
+                      + (nodep->scopep() == funcp->scopep()
+                             ? oldVarp->name()
+                             : nodep->scopep()->nameDotless() + "__DOT__" + oldVarp->name());
+                AstVar* const newVarp
+                    = new AstVar{flp, VVarType::BLOCKTEMP, newName, oldVarp};
+                newVarp->funcLocal(true);
+                newVarp->noReset(true);
+                funcp->addInitsp(newVarp);
+
+                for (auto it = er.first; it != er.second; ++it) {
+                    AstVarRef* const refp = it->second;
+                    refp->varScopep(nullptr);
+                    refp->varp(newVarp);
+                }
+                // Nothing in the function writes it, so read it once before any statement
+                firstp->addHereThisAsNext(
+                    new AstAssign{flp, new AstVarRef{flp, newVarp, VAccess::WRITE},
+                                  new AstVarRef{flp, nodep, VAccess::READ}});
+            }
+        }
+        m_cacheFuncs.clear();
+    }
+
     // VISITORS
     void visit(AstNetlist* nodep) override {
         iterateChildrenConst(nodep);
         moveVarScopes();
+        cacheVarScopes();
     }
 
     void visit(AstCAwait* nodep) override {
@@ -141,10 +221,20 @@ class LocalizeVisitor final : public VNVisitor {
         UINFO(4, "  CFUNC " << nodep);
         VL_RESTORER(m_cfuncp);
         VL_RESTORER(m_nodeDepth);
+        VL_RESTORER(m_cacheOk);
         m_cfuncp = nodep;
         m_nodeDepth = 0;
+        m_cacheOk = true;
         const VNUser2InUse user2InUse;
-        iterateChildrenConst(nodep);
+        iterateAndNextConstNull(nodep->argsp());
+        iterateAndNextConstNull(nodep->initsp());
+        {
+            VL_RESTORER(m_inStmts);
+            m_inStmts = true;
+            iterateAndNextConstNull(nodep->stmtsp());
+        }
+        iterateAndNextConstNull(nodep->finalsp());
+        if (v3Global.opt.fLocalizeReads()) collectCacheVars();
     }
 
     void visit(AstCCall* nodep) override {
@@ -152,6 +242,19 @@ class LocalizeVisitor final : public VNVisitor {
         iterateChildrenConst(nodep);
     }
 
+    // Code that might write variables without a VarRef, so don't cache reads
+    void visitOpaque(AstNode* nodep) {
+        m_cacheOk = false;
+        VL_RESTORER(m_nodeDepth);
+        ++m_nodeDepth;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeCCall* nodep) override { visitOpaque(nodep); }
+    void visit(AstCStmt* nodep) override { visitOpaque(nodep); }
+    void visit(AstCExpr* nodep) override { visitOpaque(nodep); }
+    void visit(AstUCStmt* nodep) override { visitOpaque(nodep); }
+    void visit(AstUCFunc* nodep) override { visitOpaque(nodep); }
+
     void visit(AstNodeAssign* nodep) override {
         // Analyze RHS first so "a = a + 1" is detected as a read before write
         iterate(nodep->rhsp());
@@ -194,6 +297,16 @@ class LocalizeVisitor final : public VNVisitor {
         m_accessors(varScopep).emplace(m_cfuncp);
         // Remember the reference so we can fix it up later (we always need this as well)
         m_references(m_cfuncp).emplace(varScopep, nodep);
+        if (v3Global.opt.fLocalizeReads()) {
+            const auto pair = m_cacheVars.emplace(varScopep, CacheVar{});
+            if (pair.second) m_cacheOrder.push_back(varScopep);
+            CacheVar& cacheVar = pair.first->second;
+            if (!m_inStmts || nodep->access().isWriteOrRW()) {
+                cacheVar.m_unsafe = true;
+            } else {
+                ++cacheVar.m_reads;
+            }
+        }
 
         // Check if already marked as not optimizable
         if (!varScopep->user1()) {
@@ -220,6 +333,7 @@ public:
     explicit LocalizeVisitor(AstNetlist* nodep) { iterate(nodep); }
     ~LocalizeVisitor() override {
         V3Stats::addStat("Optimizations, Vars localized", m_statLocVars);
+        V3Stats::addStat("Optimizations, Vars cached in locals", m_statCachedVars);
     }
 };
 
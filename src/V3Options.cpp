@@ -366,6 +366,7 @@ void V3Options::addCFlags(const string& filename) { m_cFlags.push_back(filename)
 void V3Options::addCompilerIncludes(const string& filename) {
     m_compilerIncludes.insert(filename);
 }
+void V3Options::addDpiDeferred(const string& name) { m_dpiDeferreds.insert(name); }
 void V3Options::addLdLibs(const string& filename) { m_ldLibs.push_back(filename); }
 void V3Options::addMakeFlags(const string& filename) { m_makeFlags.push_back(filename); }
 void V3Options::addFuture(const string& flag) { m_futures.insert(flag); }
@@ -881,6 +882,10 @@ void V3Options::notify() VL_MT_DISABLED {
                 + ". Suggest see manual");
     }
 
+    if (m_lanes && m_systemC) {
+        cmdfl->v3error("--lanes cannot be used together with --sc. Suggest see manual");
+    }
+
     if (m_exe && !v3Global.opt.libCreate().empty()) {
         cmdfl->v3error("--exe cannot be used together with --lib-create. Suggest see manual");
     }
@@ -951,6 +956,15 @@ void V3Options::notify() VL_MT_DISABLED {
                       "--main not usable with SystemC. Suggest see examples for sc_main().");
     }
 
+    if (fuzzServer() && !main()) {
+        cmdfl->v3error("--fuzz-server requires --main; a user main() may instead call"
+                       " VerilatedFuzzServer::serve()");
+    }
+
+    if (threadsDynamic() && (hierarchical() || hierChild())) {
+        cmdfl->v3warn(E_UNSUPPORTED, "Unsupported: --threads-dynamic with --hierarchical");
+    }
+
     if (coverage() && savable()) {
         cmdfl->v3error("Unsupported: --coverage and --savable not supported together");
     }
@@ -1185,6 +1199,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_assertCase = flag;
     });
     DECL_OPTION("-assert-case", OnOff, &m_assertCase);
+    DECL_OPTION("-assert-gate-sampled", OnOff, &m_assertGateSampled);
     DECL_OPTION("-autoflush", OnOff, &m_autoflush);
 
     DECL_OPTION("-bbox-sys", OnOff, &m_bboxSys);
@@ -1247,8 +1262,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-coverage", CbOnOff, [this](bool flag) { coverage(flag); });
     DECL_OPTION("-coverage-expr", OnOff, &m_coverageExpr);
     DECL_OPTION("-coverage-expr-max", Set, &m_coverageExprMax);
+    DECL_OPTION("-coverage-hit-once", OnOff, &m_coverageHitOnce);
     DECL_OPTION("-coverage-line", OnOff, &m_coverageLine);
     DECL_OPTION("-coverage-max-width", Set, &m_coverageMaxWidth);
+    DECL_OPTION("-coverage-per-thread", OnOff, &m_coveragePerThread);
     DECL_OPTION("-coverage-toggle", OnOff, &m_coverageToggle);
     DECL_OPTION("-coverage-underscore", OnOff, &m_coverageUnderscore);
     DECL_OPTION("-coverage-user", OnOff, &m_coverageUser);
@@ -1288,6 +1305,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_diagnosticsSarifOutput = optp;
         m_diagnosticsSarif = true;
     });
+    DECL_OPTION("-dpi-deferred", CbVal, callStrSetter(&V3Options::addDpiDeferred));
     DECL_OPTION("-dpi-hdr-only", OnOff, &m_dpiHdrOnly);
     DECL_OPTION("-dump-", CbPartialMatch, [this](const char* optp) { m_dumpLevel[optp] = 3; });
     DECL_OPTION("-no-dump-", CbPartialMatch, [this](const char* optp) { m_dumpLevel[optp] = 0; });
@@ -1304,6 +1322,8 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     });
     DECL_OPTION("-emit-accessors", OnOff, &m_emitAccessors);
     DECL_OPTION("-error-limit", CbVal, static_cast<void (*)(int)>(&V3Error::errorLimit));
+    DECL_OPTION("-eval-skip-unchanged", OnOff, &m_evalSkipUnchanged);
+    DECL_OPTION("-eval-straight-line", OnOff, &m_evalStraightLine);
     DECL_OPTION("-exe", OnOff, &m_exe);
     DECL_OPTION("-expand-limit", CbVal,
                 [this](const char* valp) { m_expandLimit = std::atoi(valp); });
@@ -1317,12 +1337,16 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         parseOptsFile(fl, parseFileArg(optdir, valp), false);
     });
     DECL_OPTION("-flatten", OnOff, &m_flatten);
+    DECL_OPTION("-force-guard", OnOff, &m_forceGuard);
     DECL_OPTION("-future0", CbVal, [this](const char* valp) { addFuture0(valp); });
     DECL_OPTION("-future1", CbVal, [this](const char* valp) { addFuture1(valp); });
+    DECL_OPTION("-fuzz-server", OnOff, &m_fuzzServer);
 
     DECL_OPTION("-facyc-simp", FOnOff, &m_fAcycSimp);
     DECL_OPTION("-fassemble", FOnOff, &m_fAssemble);
+    DECL_OPTION("-fassoc-hash", FOnOff, &m_fAssocHash);
     DECL_OPTION("-fcase", FOnOff, &m_fCase);
+    DECL_OPTION("-fcold-split", FOnOff, &m_fColdSplit);
     DECL_OPTION("-fcombine", FOnOff, &m_fCombine);
     DECL_OPTION("-fconst", FOnOff, &m_fConst);
     DECL_OPTION("-fconst-before-dfg", FOnOff, &m_fConstBeforeDfg);
@@ -1355,10 +1379,12 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-ffunc-opt-split-cat", FOnOff, &m_fFuncSplitCat);
     DECL_OPTION("-fgate", FOnOff, &m_fGate);
     DECL_OPTION("-finline", FOnOff, &m_fInline);
+    DECL_OPTION("-finline-const-ports", FOnOff, &m_fInlineConstPorts);
     DECL_OPTION("-finline-funcs", FOnOff, &m_fInlineFuncs);
     DECL_OPTION("-flife", FOnOff, &m_fLife);
     DECL_OPTION("-flife-post", FOnOff, &m_fLifePost);
     DECL_OPTION("-flocalize", FOnOff, &m_fLocalize);
+    DECL_OPTION("-flocalize-reads", FOnOff, &m_fLocalizeReads);
     DECL_OPTION("-fmerge-cond", FOnOff, &m_fMergeCond);
     DECL_OPTION("-fmerge-cond-motion", FOnOff, &m_fMergeCondMotion);
     DECL_OPTION("-fmerge-const-pool", FOnOff, &m_fMergeConstPool);
@@ -1403,11 +1429,17 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                 [this, &optdir](const char* optp) { addIncDirUser(parseFileArg(optdir, optp)); });
     DECL_OPTION("-if-depth", Set, &m_ifDepth);
     DECL_OPTION("-ignc", OnOff, &m_ignc);
+    DECL_OPTION("-inline-funcs-mult", Set, &m_inlineFuncsMult);
+    DECL_OPTION("-inline-max-refs", CbVal, [this, fl](int val) {
+        m_inlineMaxRefs = val;
+        if (m_inlineMaxRefs < 0) fl->v3fatal("--inline-max-refs must be non-negative: " << val);
+    });
     DECL_OPTION("-inline-mult", Set, &m_inlineMult);
     DECL_OPTION("-instr-count-dpi", CbVal, [this, fl](int val) {
         m_instrCountDpi = val;
         if (m_instrCountDpi < 0) fl->v3fatal("--instr-count-dpi must be non-negative: " << val);
     });
+    DECL_OPTION("-instr-count-table", Set, &m_instrCountTable);
 
     DECL_OPTION("-json-edit-nums", OnOff, &m_jsonEditNums);
     DECL_OPTION("-json-ids", OnOff, &m_jsonIds);
@@ -1438,6 +1470,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         }
     };
     DECL_OPTION("-default-language", CbVal, setLang);
+    DECL_OPTION("-lanes", CbVal, [this, fl](const char* valp) {
+        m_lanes = std::atoi(valp);
+        if (m_lanes < 1) fl->v3error("--lanes must be >= 1: " << valp);
+    });
     DECL_OPTION("-language", CbVal, setLang);
     DECL_OPTION("-lib-create", CbVal, [this, fl](const char* valp) {
         validateIdentifier(fl, valp, "--lib-create");
@@ -1472,6 +1508,8 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_modPrefix = valp;
     });
 
+    DECL_OPTION("-nba-in-place", OnOff, &m_nbaInPlace);
+
     DECL_OPTION("-O0", CbCall, [this]() { optimize(0); });
     DECL_OPTION("-O1", CbCall, [this]() { optimize(1); });
     DECL_OPTION("-O2", CbCall, [this]() { optimize(2); });
@@ -1481,10 +1519,15 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-order-clock-delay", CbOnOff, [fl](bool /*flag*/) {
         fl->v3warn(DEPRECATED, "Option order-clock-delay is deprecated and has no effect.");
     });
+    DECL_OPTION("-output-const-blob", CbVal, [this, fl](const char* valp) {
+        m_outputConstBlob = std::atoi(valp);
+        if (m_outputConstBlob < 0) fl->v3error("--output-const-blob must be >= 0: " << valp);
+    });
     DECL_OPTION("-output-groups", CbVal, [this, fl](const char* valp) {
         m_outputGroups = std::atoi(valp);
         if (m_outputGroups < -1) fl->v3error("--output-groups must be >= -1: " << valp);
     });
+    DECL_OPTION("-output-keep-identical", OnOff, &m_outputKeepIdentical);
     DECL_OPTION("-output-split", Set, &m_outputSplit);
     DECL_OPTION("-output-split-cfuncs", CbVal, [this, fl](const char* valp) {
         m_outputSplitCFuncs = std::atoi(valp);
@@ -1498,6 +1541,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
             fl->v3error("--output-split-ctrace must be >= 0: " << valp);
         }
     });
+    DECL_OPTION("-output-split-stable", OnOff, &m_outputSplitStable);
 
     DECL_OPTION("-P", Set, &m_preprocNoLine);
     DECL_OPTION("-pins64", CbCall, [this]() { m_pinsBv = 65; });
@@ -1516,6 +1560,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_pinsScBigUint = flag;
         m_pinsBv = 513;
     });
+    DECL_OPTION("-pins-sc-change-only", OnOff, &m_pinsScChangeOnly);
     DECL_OPTION("-pins-uint8", OnOff, &m_pinsUint8);
     DECL_OPTION("-pipe-filter", Set, &m_pipeFilter);
     DECL_OPTION("-pp-comments", OnOff, &m_ppComments);
@@ -1532,7 +1577,14 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-prof-c", OnOff, &m_profC);
     DECL_OPTION("-prof-cfuncs", CbCall, [this]() { m_profC = m_profCFuncs = true; });
     DECL_OPTION("-prof-exec", OnOff, &m_profExec);
+    DECL_OPTION("-prof-exec-blocks", CbOnOff, [this](bool flag) {
+        m_profExecBlocks = flag;
+        m_profExec |= flag;
+    });
     DECL_OPTION("-prof-pgo", OnOff, &m_profPgo);
+    DECL_OPTION("-prof-pgo-normalize", OnOff, &m_profPgoNormalize);
+    DECL_OPTION("-prof-regions", OnOff, &m_profRegions);
+    DECL_OPTION("-prof-startup", OnOff, &m_profStartup);
     DECL_OPTION("-profile-cfuncs", CbCall,
                 [this]() { m_profC = m_profCFuncs = true; });  // Renamed
     DECL_OPTION("-protect-ids", OnOff, &m_protectIds);
@@ -1580,13 +1632,21 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         addCFlags("-DVL_DEBUG=1");
     });
 
-    DECL_OPTION("-savable", OnOff, &m_savable);
+    DECL_OPTION("-savable", CbOnOff, [this](bool flag) {
+        m_savable = flag;
+        if (flag) addLdLibs("-lz");  // For compressed save files
+    });
     DECL_OPTION("-sc", CbCall, [this]() {
         m_outFormatOk = true;
         m_systemC = true;
     });
     DECL_OPTION("-skip-identical", OnOff, &m_skipIdentical);
+    DECL_OPTION("-sparse-array-depth", Set, &m_sparseArrayDepth);
     DECL_OPTION("-stats", OnOff, &m_stats);
+    DECL_OPTION("-stats-trace", CbOnOff, [this](bool flag) {
+        m_statsTrace = flag;
+        m_stats |= flag;
+    });
     DECL_OPTION("-stats-vars", CbOnOff, [this](bool flag) {
         m_statsVars = flag;
         m_stats |= flag;
@@ -1634,10 +1694,28 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                         << fl->warnMore() << "... Suggest 'all', 'none', or 'pure'");
         }
     });
+    DECL_OPTION("-threads-dynamic", OnOff, &m_threadsDynamic);
+    DECL_OPTION("-threads-var-padding", OnOff, &m_threadsVarPadding);
+    DECL_OPTION("-threads-state-layout", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "packed") || !std::strcmp(valp, "padded")
+            || !std::strcmp(valp, "grouped")) {
+            m_threadsStateLayout = valp;
+        } else {
+            fl->v3error("Unknown setting for --threads-state-layout: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'packed', 'padded', or 'grouped'");
+        }
+    });
     DECL_OPTION("-threads-max-mtasks", CbVal, [this, fl](const char* valp) {
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
     });
+    DECL_OPTION("-threads-partition-time", CbVal, [this, fl](const char* valp) {
+        m_threadsPartitionTime = std::atoi(valp);
+        if (m_threadsPartitionTime < 0) {
+            fl->v3fatal("--threads-partition-time must be >= 0: " << valp);
+        }
+    });
     DECL_OPTION("-timescale", CbVal, [this, fl](const char* valp) {
         VTimescale unit;
         VTimescale prec;
@@ -1662,6 +1740,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-top", Set, &m_topModule);
     DECL_OPTION("-top-module", Set, &m_topModule);
     DECL_OPTION("-trace", OnOff, &m_trace);
+    DECL_OPTION("-trace-raw", CbCall, [this]() {
+        m_trace = true;
+        m_traceFormat = TraceFormat::RAW;
+    });
     DECL_OPTION("-trace-saif", CbCall, [this]() {
         m_trace = true;
         m_traceFormat = TraceFormat::SAIF;
@@ -1684,6 +1766,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-trace-max-array", Set, &m_traceMaxArray);
     DECL_OPTION("-trace-max-width", Set, &m_traceMaxWidth);
     DECL_OPTION("-trace-params", OnOff, &m_traceParams);
+    DECL_OPTION("-trace-scope-groups", OnOff, &m_traceScopeGroups);
     DECL_OPTION("-trace-structs", OnOff, &m_traceStructs);
     DECL_OPTION("-trace-threads", CbVal, [this, fl](const char* valp) {
         m_trace = true;
@@ -1700,6 +1783,8 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-U", CbPartialMatch, &V3PreShell::undef);
     DECL_OPTION("-underline-zero", OnOff, &m_underlineZero);  // Deprecated
     DECL_OPTION("-no-unlimited-stack", CbCall, []() {});  // Processed only in bin/verilator shell
+    DECL_OPTION("-unoptflat-min-cost", OnOff, &m_unoptflatMinCost);
+    DECL_OPTION("-unroll-cost", Set, &m_unrollCost);
     DECL_OPTION("-unroll-count", Set, &m_unrollCount).undocumented();  // Optimization tweak
     DECL_OPTION("-unroll-stmts", Set, &m_unrollStmts).undocumented();  // Optimization tweak
     DECL_OPTION("-unused-regexp", Set, &m_unusedRegexp);
@@ -1729,6 +1814,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         std::exit(0);
     });
     DECL_OPTION("-vpi", OnOff, &m_vpi);
+    DECL_OPTION("-vpi-dirty", OnOff, &m_vpiDirty);
 
     DECL_OPTION("-Wall", CbCall, []() {
         FileLine::globalWarnLintOff(false);
@@ -2180,7 +2266,9 @@ void V3Options::optimize(int level) {
     const bool flag = level > 0;
     m_fAcycSimp = flag;
     m_fAssemble = flag;
+    m_fAssocHash = flag;
     m_fCase = flag;
+    m_fColdSplit = flag;
     m_fCombine = flag;
     m_fConst = flag;
     m_fConstBitOpTree = flag;
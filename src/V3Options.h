@@ -161,7 +161,7 @@ inline std::ostream& operator<<(std::ostream& os, const VTimescale& rhs) {
 
 class TraceFormat final {
 public:
-    enum en : uint8_t { VCD = 0, FST, SAIF } m_e;
+    enum en : uint8_t { VCD = 0, FST, SAIF, RAW } m_e;
     // cppcheck-suppress noExplicitConstructor
     constexpr TraceFormat(en _e = VCD)
         : m_e{_e} {}
@@ -169,14 +169,17 @@ public:
         : m_e(static_cast<en>(_e)) {}  // Need () or GCC 4.8 false warning
     constexpr operator en() const { return m_e; }
     bool fst() const { return m_e == FST; }
+    bool raw() const { return m_e == RAW; }
     bool saif() const { return m_e == SAIF; }
     bool vcd() const { return m_e == VCD; }
     string classBase() const VL_MT_SAFE {
-        static const char* const names[] = {"VerilatedVcd", "VerilatedFst", "VerilatedSaif"};
+        static const char* const names[]
+            = {"VerilatedVcd", "VerilatedFst", "VerilatedSaif", "VerilatedRaw"};
         return names[m_e];
     }
     string sourceName() const VL_MT_SAFE {
-        static const char* const names[] = {"verilated_vcd", "verilated_fst", "verilated_saif"};
+        static const char* const names[]
+            = {"verilated_vcd", "verilated_fst", "verilated_saif", "verilated_raw"};
         return names[m_e];
     }
 };
@@ -232,6 +235,7 @@ private:
     V3StringList m_ldLibs;      // argument: user LDFLAGS
     V3StringList m_makeFlags;   // argument: user MAKEFLAGS
     V3StringSet m_compilerIncludes; // argument: user --compiler-include
+    V3StringSet m_dpiDeferreds;     // argument: --dpi-deferred
     V3StringSet m_futures;      // argument: -Wfuture- list
     V3StringSet m_future0s;     // argument: -future list
     V3StringSet m_future1s;     // argument: -future1 list
@@ -253,6 +257,7 @@ private:
     bool m_preprocNoLine = false;   // main switch: -P
     bool m_assert = true;           // main switch: --assert
     bool m_assertCase = true;       // main switch: --assert-case
+    bool m_assertGateSampled = false;  // main switch: --assert-gate-sampled
     bool m_autoflush = false;       // main switch: --autoflush
     bool m_bboxSys = false;         // main switch: --bbox-sys
     bool m_bboxUnsup = false;       // main switch: --bbox-unsup
@@ -261,7 +266,9 @@ private:
     bool m_cmake = false;           // main switch: --make cmake
     bool m_context = true;          // main switch: --Wcontext
     bool m_coverageExpr = false;    // main switch: --coverage-expr
+    bool m_coverageHitOnce = false;  // main switch: --coverage-hit-once
     bool m_coverageLine = false;    // main switch: --coverage-block
+    bool m_coveragePerThread = false;  // main switch: --coverage-per-thread
     bool m_coverageToggle = false;  // main switch: --coverage-toggle
     bool m_coverageUnderscore = false;  // main switch: --coverage-underscore
     bool m_coverageUser = false;    // main switch: --coverage-func
@@ -283,8 +290,14 @@ private:
     bool m_diagnosticsSarif = false;  // main switch: --diagnostics-sarif
     bool m_dpiHdrOnly = false;      // main switch: --dpi-hdr-only
     bool m_emitAccessors = false;   // main switch: --emit-accessors
+    bool m_evalSkipUnchanged = false;  // main switch: --eval-skip-unchanged
+    bool m_evalStraightLine = false;  // main switch: --eval-straight-line
     bool m_exe = false;             // main switch: --exe
+    bool m_outputKeepIdentical = false;  // main switch: --output-keep-identical
+    bool m_outputSplitStable = false;  // main switch: --output-split-stable
     bool m_flatten = false;         // main switch: --flatten
+    bool m_forceGuard = false;      // main switch: --force-guard
+    bool m_fuzzServer = false;      // main switch: --fuzz-server
     bool m_hierarchical = false;    // main switch: --hierarchical
     bool m_ignc = false;            // main switch: --ignc
     bool m_jsonOnly = false;        // main switch: --json-only
@@ -292,18 +305,24 @@ private:
     bool m_gmake = false;           // main switch: --make gmake
     bool m_makeJson = false;        // main switch: --make json
     bool m_main = false;            // main switch: --main
+    bool m_nbaInPlace = false;      // main switch: --nba-in-place
     bool m_outFormatOk = false;     // main switch: --cc, --sc or --sp was specified
     bool m_pedantic = false;        // main switch: --Wpedantic
     bool m_pinsInoutEnables = false;// main switch: --pins-inout-enables
     bool m_pinsScUint = false;      // main switch: --pins-sc-uint
     bool m_pinsScUintBool = false;  // main switch: --pins-sc-uint-bool
     bool m_pinsScBigUint = false;   // main switch: --pins-sc-biguint
+    bool m_pinsScChangeOnly = false;// main switch: --pins-sc-change-only
     bool m_pinsUint8 = false;       // main switch: --pins-uint8
     bool m_ppComments = false;      // main switch: --pp-comments
     bool m_profC = false;           // main switch: --prof-c
     bool m_profCFuncs = false;      // main switch: --prof-cfuncs
     bool m_profExec = false;        // main switch: --prof-exec
+    bool m_profExecBlocks = false;  // main switch: --prof-exec-blocks
     bool m_profPgo = false;         // main switch: --prof-pgo
+    bool m_profPgoNormalize = false;  // main switch: --prof-pgo-normalize
+    bool m_profRegions = false;     // main switch: --prof-regions
+    bool m_profStartup = false;     // main switch: --prof-startup
     bool m_protectIds = false;      // main switch: --protect-ids
     bool m_public = false;          // main switch: --public
     bool m_publicFlatRW = false;    // main switch: --public-flat-rw
@@ -319,20 +338,26 @@ private:
     bool m_structsPacked = false;   // main switch: --structs-packed
     bool m_systemC = false;         // main switch: --sc: System C instead of simple C++
     bool m_stats = false;           // main switch: --stats
+    bool m_statsTrace = false;      // main switch: --stats-trace
     bool m_statsVars = false;       // main switch: --stats-vars
     bool m_threadsCoarsen = true;   // main switch: --threads-coarsen
     bool m_threadsDpiPure = true;   // main switch: --threads-dpi all/pure
     bool m_threadsDpiUnpure = false;  // main switch: --threads-dpi all
+    bool m_threadsDynamic = false;  // main switch: --threads-dynamic
+    bool m_threadsVarPadding = false;  // main switch: --threads-var-padding
     VOptionBool m_timing;           // main switch: --timing
     bool m_trace = false;           // main switch: --trace
     bool m_traceCoverage = false;   // main switch: --trace-coverage
     bool m_traceParams = true;      // main switch: --trace-params
+    bool m_traceScopeGroups = false;  // main switch: --trace-scope-groups
     bool m_traceStructs = false;    // main switch: --trace-structs
     bool m_noTraceTop = false;      // main switch: --no-trace-top
     bool m_traceUnderscore = false; // main switch: --trace-underscore
     bool m_underlineZero = false;   // main switch: --underline-zero; undocumented old Verilator 2
+    bool m_unoptflatMinCost = false;  // main switch: --unoptflat-min-cost
     bool m_verilate = true;         // main switch: --verilate
     bool m_vpi = false;             // main switch: --vpi
+    bool m_vpiDirty = false;        // main switch: --vpi-dirty
     bool m_waiverMultiline = false;  // main switch: --waiver-multiline
     bool m_xInitialEdge = false;    // main switch: --x-initial-edge
     bool m_xmlOnly = false;         // main switch: --xml-only
@@ -346,14 +371,18 @@ private:
     int         m_hierChild = 0;      // main switch: --hierarchical-child
     int         m_hierThreads = 0;      // main switch: --hierarchical-threads
     int         m_ifDepth = 0;      // main switch: --if-depth
+    int         m_inlineFuncsMult = 0;  // main switch: --inline-funcs-mult
+    int         m_inlineMaxRefs = 0;  // main switch: --inline-max-refs
     int         m_inlineMult = 2000;   // main switch: --inline-mult
     int         m_instrCountDpi = 200;   // main switch: --instr-count-dpi
     bool        m_jsonEditNums = true; // main switch: --no-json-edit-nums
     bool        m_jsonIds = true; // main switch: --no-json-ids
+    int         m_lanes = 0;        // main switch: --lanes
     int         m_localizeMaxSize = 1024;  // main switch: --localize-max-size
     VOptionBool m_makeDepend;  // main switch: -MMD
     int         m_maxNumWidth = 65536;  // main switch: --max-num-width
     int         m_moduleRecursion = 100;  // main switch: --module-recursion-depth
+    int         m_outputConstBlob = 0;  // main switch: --output-const-blob
     int         m_outputGroups = -1;  // main switch: --output-groups
     int         m_outputSplit = 20000;  // main switch: --output-split
     int         m_outputSplitCFuncs = -1;  // main switch: --output-split-cfuncs
@@ -363,9 +392,11 @@ private:
     int         m_publicDepth = 0;   // main switch: --public-depth
     int         m_reloopLimit = 40; // main switch: --reloop-limit
     VOptionBool m_skipIdentical;  // main switch: --skip-identical
+    int         m_sparseArrayDepth = 0;  // main switch: --sparse-array-depth
     bool        m_stopFail = true;  // main switch: --stop-fail
     int         m_threads = 1;      // main switch: --threads
     int         m_threadsMaxMTasks = 0;  // main switch: --threads-max-mtasks
+    int         m_threadsPartitionTime = 0;  // main switch: --threads-partition-time
     VTimescale  m_timeDefaultPrec;  // main switch: --timescale
     VTimescale  m_timeDefaultUnit;  // main switch: --timescale
     VTimescale  m_timeOverridePrec;  // main switch: --timescale-override
@@ -375,6 +406,7 @@ private:
     int         m_traceMaxArray = 32;  // main switch: --trace-max-array
     int         m_traceMaxWidth = 256; // main switch: --trace-max-width
     int         m_traceThreads = 0; // main switch: --trace-threads
+    int         m_unrollCost = 0;  // main switch: --unroll-cost
     int         m_unrollCount = 64;  // main switch: --unroll-count
     int         m_unrollStmts = 30000;  // main switch: --unroll-stmts
     int         m_verilateJobs = -1;  // main switch: --verilate-jobs
@@ -387,6 +419,7 @@ private:
     string      m_diagnosticsSarifOutput;  // main switch: --diagnostics-sarif-output
     string      m_exeName;      // main switch: -o {name}
     string      m_flags;        // main switch: -f {name}
+    string      m_instrCountTable;  // main switch: --instr-count-table {filename}
     VFileLibList m_hierParamsFile; // main switch: --hierarchical-params-file
     string      m_jsonOnlyOutput;    // main switch: --json-only-output
     string      m_jsonOnlyMetaOutput;    // main switch: --json-only-meta-output
@@ -398,6 +431,7 @@ private:
     string      m_pipeFilter;   // main switch: --pipe-filter
     string      m_prefix;       // main switch: --prefix
     string      m_protectKey;   // main switch: --protect-key
+    string      m_threadsStateLayout = "packed";  // main switch: --threads-state-layout
     string      m_topModule;    // main switch: --top-module
     string      m_unusedRegexp; // main switch: --unused-regexp
     string      m_waiverOutput;  // main switch: --waiver-output {filename}
@@ -413,7 +447,9 @@ private:
     // MEMBERS (optimizations)
     bool m_fAcycSimp;    // main switch: -fno-acyc-simp: acyclic pre-optimizations
     bool m_fAssemble;    // main switch: -fno-assemble: assign assemble
+    bool m_fAssocHash;   // main switch: -fno-assoc-hash: hashed associative arrays
     bool m_fCase;        // main switch: -fno-case: case tree conversion
+    bool m_fColdSplit;   // main switch: -fno-cold-split: outline unlikely branches
     bool m_fCombine;     // main switch: -fno-combine: common icode packing
     bool m_fConst;       // main switch: -fno-const: constant folding
     bool m_fConstBeforeDfg = true;  // main switch: -fno-const-before-dfg for testing only!
@@ -431,10 +467,12 @@ private:
     bool m_fFuncSplitCat = true;  // main switch: -fno-func-split-cat: expansion of C macros
     bool m_fGate;        // main switch: -fno-gate: gate wire elimination
     bool m_fInline;      // main switch: -fno-inline: module inlining
+    bool m_fInlineConstPorts = false;  // main switch: -finline-const-ports
     bool m_fInlineFuncs = true;  // main switch: -fno-inline-funcs: function inlining
     bool m_fLife;        // main switch: -fno-life: variable lifetime
     bool m_fLifePost;    // main switch: -fno-life-post: delayed assignment elimination
     bool m_fLocalize;    // main switch: -fno-localize: convert temps to local variables
+    bool m_fLocalizeReads = false;  // main switch: -flocalize-reads: cache reads in locals
     bool m_fMergeCond;   // main switch: -fno-merge-cond: merge conditionals
     bool m_fMergeCondMotion = true; // main switch: -fno-merge-cond-motion: perform code motion
     bool m_fMergeConstPool = true;  // main switch: -fno-merge-const-pool
@@ -491,6 +529,7 @@ public:
     void addCppFile(const string& filename);
     void addCFlags(const string& filename);
     void addCompilerIncludes(const string& filename);
+    void addDpiDeferred(const string& name);
     void addLdLibs(const string& filename);
     void addMakeFlags(const string& filename);
     void addLibraryFile(const string& filename, const string& libname);
@@ -511,16 +550,19 @@ public:
     bool preprocResolve() const { return m_preprocResolve; }
     int preprocTokenLimit() const { return m_preprocTokenLimit; }
     bool underlineZero() const { return m_underlineZero; }
+    bool unoptflatMinCost() const { return m_unoptflatMinCost; }
     string flags() const { return m_flags; }
     bool systemC() const VL_MT_SAFE { return m_systemC; }
     bool savable() const VL_MT_SAFE { return m_savable; }
     bool stats() const { return m_stats; }
+    bool statsTrace() const VL_MT_SAFE { return m_statsTrace; }
     bool statsVars() const { return m_statsVars; }
     bool stdPackage() const { return m_stdPackage; }
     bool stdWaiver() const { return m_stdWaiver; }
     bool structsPacked() const { return m_structsPacked; }
     bool assertOn() const { return m_assert; }  // assertOn as __FILE__ may be defined
     bool assertCase() const { return m_assertCase; }
+    bool assertGateSampled() const { return m_assertGateSampled; }
     bool autoflush() const { return m_autoflush; }
     bool bboxSys() const { return m_bboxSys; }
     bool bboxUnsup() const { return m_bboxUnsup; }
@@ -534,7 +576,12 @@ public:
         return m_coverageLine || m_coverageToggle || m_coverageExpr || m_coverageUser;
     }
     bool coverageExpr() const { return m_coverageExpr; }
+    bool coverageHitOnce() const { return m_coverageHitOnce; }
     bool coverageLine() const { return m_coverageLine; }
+    // Per-thread counters are only needed when multithreaded, and with counters
+    bool coveragePerThread() const {
+        return m_coveragePerThread && m_threads > 1 && !m_coverageHitOnce;
+    }
     bool coverageToggle() const { return m_coverageToggle; }
     bool coverageUnderscore() const { return m_coverageUnderscore; }
     bool coverageUser() const { return m_coverageUser; }
@@ -560,20 +607,28 @@ public:
         return m_dumpLevel.count("tree-dot") && m_dumpLevel.at("tree-dot");
     }
     bool emitAccessors() const { return m_emitAccessors; }
+    bool evalSkipUnchanged() const { return m_evalSkipUnchanged; }
+    bool evalStraightLine() const { return m_evalStraightLine; }
     bool exe() const { return m_exe; }
     bool flatten() const { return m_flatten; }
+    bool forceGuard() const { return m_forceGuard; }
+    bool fuzzServer() const { return m_fuzzServer; }
     bool gmake() const { return m_gmake; }
     bool makeJson() const { return m_makeJson; }
     bool threadsDpiPure() const { return m_threadsDpiPure; }
     bool threadsDpiUnpure() const { return m_threadsDpiUnpure; }
     bool threadsCoarsen() const { return m_threadsCoarsen; }
+    bool threadsDynamic() const { return m_threadsDynamic; }
+    bool threadsVarPadding() const { return m_threadsVarPadding; }
     VOptionBool timing() const { return m_timing; }
     bool trace() const { return m_trace; }
     bool traceCoverage() const { return m_traceCoverage; }
     bool traceParams() const { return m_traceParams; }
+    bool traceScopeGroups() const { return m_traceScopeGroups; }
     bool traceStructs() const { return m_traceStructs; }
     bool traceUnderscore() const { return m_traceUnderscore; }
     bool main() const { return m_main; }
+    bool nbaInPlace() const { return m_nbaInPlace; }
     bool outFormatOk() const { return m_outFormatOk; }
     bool jsonOnly() const { return m_jsonOnly; }
     bool keepTempFiles() const { return (V3Error::debugDefault() != 0); }
@@ -582,13 +637,20 @@ public:
     bool pinsScUint() const { return m_pinsScUint; }
     bool pinsScUintBool() const { return m_pinsScUintBool; }
     bool pinsScBigUint() const VL_MT_SAFE { return m_pinsScBigUint; }
+    bool pinsScChangeOnly() const { return m_pinsScChangeOnly; }
     bool pinsUint8() const { return m_pinsUint8; }
     bool ppComments() const { return m_ppComments; }
     bool profC() const { return m_profC; }
     bool profCFuncs() const { return m_profCFuncs; }
     bool profExec() const { return m_profExec; }
+    bool profExecBlocks() const { return m_profExecBlocks; }
     bool profPgo() const { return m_profPgo; }
-    bool usesProfiler() const { return profExec() || profPgo(); }
+    bool profPgoNormalize() const { return m_profPgoNormalize; }
+    bool profRegions() const { return m_profRegions; }
+    bool profStartup() const { return m_profStartup; }
+    bool usesProfiler() const {
+        return profExec() || profPgo() || profRegions() || profStartup();
+    }
     bool protectIds() const VL_MT_SAFE { return m_protectIds; }
     bool allPublic() const { return m_public; }
     bool publicParams() const { return m_publicParams; }
@@ -603,6 +665,7 @@ public:
     bool reportUnoptflat() const { return m_reportUnoptflat; }
     bool verilate() const { return m_verilate; }
     bool vpi() const { return m_vpi; }
+    bool vpiDirty() const { return m_vpiDirty; }
     bool waiverMultiline() const { return m_waiverMultiline; }
     bool xInitialEdge() const { return m_xInitialEdge; }
     bool xmlOnly() const { return m_xmlOnly; }
@@ -617,24 +680,33 @@ public:
     int expandLimit() const { return m_expandLimit; }
     int gateStmts() const { return m_gateStmts; }
     int ifDepth() const { return m_ifDepth; }
+    int inlineFuncsMult() const { return m_inlineFuncsMult; }
+    int inlineMaxRefs() const { return m_inlineMaxRefs; }
     int inlineMult() const { return m_inlineMult; }
     int instrCountDpi() const { return m_instrCountDpi; }
+    string instrCountTable() const { return m_instrCountTable; }
     int localizeMaxSize() const { return m_localizeMaxSize; }
     bool jsonEditNums() const { return m_jsonEditNums; }
     bool jsonIds() const { return m_jsonIds; }
+    int lanes() const { return m_lanes; }
     VOptionBool makeDepend() const { return m_makeDepend; }
     int maxNumWidth() const { return m_maxNumWidth; }
     int moduleRecursionDepth() const { return m_moduleRecursion; }
+    int outputConstBlob() const { return m_outputConstBlob; }
+    bool outputKeepIdentical() const VL_MT_SAFE { return m_outputKeepIdentical; }
     int outputSplit() const { return m_outputSplit; }
     int outputSplitCFuncs() const { return m_outputSplitCFuncs; }
     int outputSplitCTrace() const { return m_outputSplitCTrace; }
+    bool outputSplitStable() const { return m_outputSplitStable; }
     int outputGroups() const { return m_outputGroups; }
     int pinsBv() const VL_MT_SAFE { return m_pinsBv; }
     int reloopLimit() const { return m_reloopLimit; }
     VOptionBool skipIdentical() const { return m_skipIdentical; }
+    int sparseArrayDepth() const { return m_sparseArrayDepth; }
     bool stopFail() const { return m_stopFail; }
     int threads() const VL_MT_SAFE { return m_threads; }
     int threadsMaxMTasks() const { return m_threadsMaxMTasks; }
+    int threadsPartitionTime() const { return m_threadsPartitionTime; }
     bool mtasks() const VL_MT_SAFE { return (m_threads > 1); }
     VTimescale timeDefaultPrec() const { return m_timeDefaultPrec; }
     VTimescale timeDefaultUnit() const { return m_timeDefaultUnit; }
@@ -645,6 +717,7 @@ public:
     int traceDepth() const { return m_traceDepth; }
     TraceFormat traceFormat() const { return m_traceFormat; }
     bool traceEnabledFst() const { return trace() && traceFormat().fst(); }
+    bool traceEnabledRaw() const { return trace() && traceFormat().raw(); }
     bool traceEnabledSaif() const { return trace() && traceFormat().saif(); }
     bool traceEnabledVcd() const { return trace() && traceFormat().vcd(); }
     int traceMaxArray() const { return m_traceMaxArray; }
@@ -658,6 +731,7 @@ public:
     unsigned vmTraceThreads() const {
         return useTraceParallel() ? threads() : useTraceOffload() ? 1 : 0;
     }
+    int unrollCost() const { return m_unrollCost; }
     int unrollCount() const { return m_unrollCount; }
     int unrollCountAdjusted(const VOptionBool& full, bool generate, bool simulate);
     int unrollStmts() const { return m_unrollStmts; }
@@ -694,6 +768,7 @@ public:
     // Not just called protectKey() to avoid bugs of not using protectKeyDefaulted()
     bool protectKeyProvided() const { return !m_protectKey.empty(); }
     string protectKeyDefaulted() VL_MT_SAFE;  // Set default key if not set by user
+    string threadsStateLayout() const { return m_threadsStateLayout; }
     string topModule() const { return m_topModule; }
     bool noTraceTop() const { return m_noTraceTop; }
     string unusedRegexp() const { return m_unusedRegexp; }
@@ -707,6 +782,10 @@ public:
     const V3StringSet& cppFiles() const { return m_cppFiles; }
     const V3StringList& cFlags() const { return m_cFlags; }
     const V3StringSet& compilerIncludes() const { return m_compilerIncludes; }
+    bool dpiDeferred(const string& name) const {
+        return m_dpiDeferreds.find(name) != m_dpiDeferreds.end();
+    }
+    bool dpiDeferreds() const { return !m_dpiDeferreds.empty(); }
     const V3StringList& ldLibs() const { return m_ldLibs; }
     const V3StringList& makeFlags() const { return m_makeFlags; }
     const VFileLibSet& libraryFiles() const { return m_libraryFiles; }
@@ -728,7 +807,9 @@ public:
     // ACCESSORS (optimization options)
     bool fAcycSimp() const { return m_fAcycSimp; }
     bool fAssemble() const { return m_fAssemble; }
+    bool fAssocHash() const { return m_fAssocHash; }
     bool fCase() const { return m_fCase; }
+    bool fColdSplit() const { return m_fColdSplit; }
     bool fCombine() const { return m_fCombine; }
     bool fConst() const { return m_fConst; }
     bool fConstBeforeDfg() const { return m_fConstBeforeDfg; }
@@ -750,10 +831,12 @@ public:
     bool fFunc() const { return fFuncSplitCat() || fFuncBalanceCat(); }
     bool fGate() const { return m_fGate; }
     bool fInline() const { return m_fInline; }
+    bool fInlineConstPorts() const { return m_fInlineConstPorts; }
     bool fInlineFuncs() const { return m_fInlineFuncs; }
     bool fLife() const { return m_fLife; }
     bool fLifePost() const { return m_fLifePost; }
     bool fLocalize() const { return m_fLocalize; }
+    bool fLocalizeReads() const { return m_fLocalizeReads; }
     bool fMergeCond() const { return m_fMergeCond; }
     bool fMergeCondMotion() const { return m_fMergeCondMotion; }
     bool fMergeConstPool() const { return m_fMergeConstPool; }
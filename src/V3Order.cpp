@@ -75,6 +75,7 @@
 
 #include "V3OrderInternal.h"
 #include "V3Sched.h"
+#include "V3Stats.h"
 
 #include <memory>
 #include <vector>
@@ -106,6 +107,7 @@ AstCFunc* V3Order::order(AstNetlist* netlistp,  //
                          bool parallel,  //
                          bool slow,  //
                          const ExternalDomainsProvider& externalDomains) {
+    const V3StatsTraceScope traceScope{"V3Order::order"};
     FileLine* const flp = netlistp->fileline();
 
     // Create the result function
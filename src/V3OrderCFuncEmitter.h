@@ -25,6 +25,7 @@
 #include "verilatedos.h"
 
 #include "V3Ast.h"
+#include "V3File.h"
 #include "V3Graph.h"
 #include "V3OrderGraph.h"
 
@@ -49,8 +50,12 @@ class V3OrderCFuncEmitter final {
         if (const size_t limit = v3Global.opt.outputSplitCFuncs()) return limit - 1;
         return std::numeric_limits<size_t>::max();
     }();
+    // Whether to time each logic vertex in the execution profile
+    const bool m_profBlocks = v3Global.opt.profExecBlocks();
     // Current function being populated
     AstCFunc* m_funcp = nullptr;
+    // True if m_funcp has pushed an execution profile section, which must be popped
+    bool m_funcProfiled = false;
     // Function ordinals to ensure unique names
     std::map<std::pair<AstNodeModule*, std::string>, unsigned> m_funcNums;
     // The result Active blocks that must be invoked to run the code in the order it was emitted
@@ -67,6 +72,14 @@ class V3OrderCFuncEmitter final {
         return name;
     }
 
+    // Name of the execution profile section timing the logic at 'flp' in 'scopep'
+    static std::string profSectionName(FileLine* flp, AstScope* scopep) {
+        std::string name = v3Global.opt.hierChild() ? (v3Global.opt.topModule() + " ") : "";
+        name += "block " + scopep->prettyName() + " " + flp->filebasename() + ":"
+                + std::to_string(flp->lineno());
+        return V3OutFormatter::quoteNameControls(name);
+    }
+
 public:
     // CONSTRUCTOR
     V3OrderCFuncEmitter(const std::string& tag, bool slow)
@@ -77,6 +90,12 @@ public:
 
     // Force the creation of a new function
     void forceNewFunction() {
+        if (m_funcProfiled) {
+            FileLine* const flp = m_funcp->fileline();
+            m_funcp->addStmtsp(
+                new AstCStmt{flp, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).sectionPop();\n"});
+            m_funcProfiled = false;
+        }
         m_size = 0;
         m_funcp = nullptr;
     }
@@ -95,6 +114,8 @@ public:
         AstNode* const logicp = lVtxp->nodep()->unlinkFrBack();
         // If the logic is a procedure, we need to do a few special things
         AstNodeProcedure* const procp = VN_CAST(logicp, NodeProcedure);
+        // Location of the whole logic, as it is deleted below if a procedure
+        FileLine* const logicFlp = logicp->fileline();
 
         // Some properties to consider
         const bool suspendable = procp && procp->isSuspendable();
@@ -108,6 +129,8 @@ public:
         if (suspendable) forceNewFunction();
         // When profCFuncs, create a new function for each logic vertex
         if (v3Global.opt.profCFuncs()) forceNewFunction();
+        // When profExecBlocks, likewise, so each can be timed separately
+        if (m_profBlocks) forceNewFunction();
         // If the new domain is different, force a new function as it needs to be called separately
         if (!m_activeps.empty() && m_activeps.back()->sensesp() != domainp) forceNewFunction();
 
@@ -142,6 +165,13 @@ public:
                 m_funcp->isLoose(true);
                 m_funcp->slow(slow);
                 scopep->addBlocksp(m_funcp);
+                // Time the function, unless it can suspend, which would leave the section open
+                if (m_profBlocks && !suspendable) {
+                    m_funcp->addStmtsp(new AstCStmt{
+                        flp, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).sectionPush(\""
+                                 + profSectionName(logicFlp, scopep) + "\");\n"});
+                    m_funcProfiled = true;
+                }
                 // Create call to the new functino
                 AstCCall* const callp = new AstCCall{flp, m_funcp};
                 callp->dtypeSetVoid();
@@ -1127,6 +1127,10 @@ class Contraction final {
                                                                             // at
     unsigned m_mergesSinceRescore = 0;  // Merges since last rescore
     const bool m_slowAsserts;  // Take extra time to validate algorithm
+    const uint64_t m_deadlineUsecs;  // Wall time to stop merging at, 0 = unlimited
+    uint64_t m_mergeCount = 0;  // Merges done, for spacing deadline checks
+    bool m_pastDeadline = false;  // Past m_deadlineUsecs
+    size_t m_mergesAfterDeadline = 0;  // Merges still needed to reach maxMTasks after deadline
     MergeCandidateScoreboard m_sb;  // Scoreboard
 
     PropagateCp<GraphWay::FORWARD> m_forwardPropagator{m_slowAsserts};  // Forward propagator
@@ -1136,12 +1140,34 @@ class Contraction final {
     LogicMTask* const m_exitMTaskp;  // Singular sink vertex of the dependency graph
 
 public:
+    // METHODS
+    bool stopForDeadline(unsigned maxMTasks) {
+        // Once past the --threads-partition-time deadline, only merge until
+        // there are at most maxMTasks, as the scheduler needs that many.
+        if (!m_pastDeadline) {
+            // Reading the clock per merge is measurable, so only check periodically
+            if ((m_mergeCount & 0xff) || V3Os::timeUsecs() < m_deadlineUsecs) return false;
+            m_pastDeadline = true;
+            const size_t mtaskCount = m_mTaskGraph.vertices().size();
+            m_mergesAfterDeadline = mtaskCount > maxMTasks ? mtaskCount - maxMTasks : 0;
+            UINFO(1, "Partitioner reached --threads-partition-time after "
+                         << m_mergeCount << " merges, mtasks=" << mtaskCount);
+        }
+        if (!m_mergesAfterDeadline) return true;
+        --m_mergesAfterDeadline;
+        return false;
+    }
+
     // CONSTRUCTORS
     Contraction(V3Graph& mTaskGraph, uint64_t scoreLimit, LogicMTask* entryMTaskp,
                 LogicMTask* exitMTaskp, bool slowAsserts)
         : m_mTaskGraph{mTaskGraph}
         , m_scoreLimit{scoreLimit}
         , m_slowAsserts{slowAsserts}
+        , m_deadlineUsecs{v3Global.opt.threadsPartitionTime()
+                              ? V3Os::timeUsecs()
+                                    + v3Global.opt.threadsPartitionTime() * 1000000ULL
+                              : 0}
         , m_entryMTaskp{entryMTaskp}
         , m_exitMTaskp{exitMTaskp} {
         if (m_slowAsserts) {
@@ -1229,7 +1255,8 @@ public:
                     const unsigned mtaskCount = m_mTaskGraph.vertices().size();
                     if (mtaskCount > maxMTasks) {
                         const uint64_t oldLimit = m_scoreLimit;
-                        m_scoreLimit = (m_scoreLimit * 120) / 100;
+                        // Out of time, so converge faster at some cost in quality
+                        m_scoreLimit = (m_scoreLimit * (m_pastDeadline ? 200 : 120)) / 100;
                         FileLine* const flp = v3Global.rootp()->fileline();
                         if (!flp->warnIsOff(V3ErrorCode::UNOPTTHREADS)) {
                             flp->v3warn(UNOPTTHREADS,
@@ -1306,8 +1333,11 @@ public:
                 UINFO(6, "New scoreLimitBeforeRescore: " << m_scoreLimitBeforeRescore);
             }
 
+            if (VL_UNLIKELY(m_deadlineUsecs) && stopForDeadline(maxMTasks)) break;
+
             // Finally merge this candidate.
             contract(mergeCanp);
+            ++m_mergeCount;
         }
 
         // Free remaining SiblingMCs
@@ -2435,6 +2465,11 @@ AstExecGraph* V3Order::createParallel(OrderGraph& orderGraph, const std::string&
     if (dumpGraphLevel() >= 9) moveGraphp->dumpDotFilePrefixed(tag + "_ordermv_pruned");
 
     // Create the AstExecGraph node which represents the execution of the MTask graph.
+    // There is one flat graph per region, even with many clock domains. Logic of an inactive
+    // domain costs only a failed trigger test inside its MTask, but the MTask itself must still
+    // run: transitive edges are removed from the graph, so its downstream MTasks rely on it to
+    // order them after its own upstream MTasks. Separate per-trigger sub-graphs would each need
+    // their own thread pool dispatch and join, which costs more than the skipped MTasks save.
     FileLine* const rootFlp = v3Global.rootp()->fileline();
     AstExecGraph* const execGraphp = new AstExecGraph{rootFlp, tag};
     V3Graph* const depGraphp = execGraphp->depGraphp();
@@ -26,6 +26,7 @@
 #include "V3OrderGraph.h"
 #include "V3OrderInternal.h"
 #include "V3SenTree.h"
+#include "V3Stats.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -52,6 +53,9 @@ class V3OrderProcessDomains final {
     // Logic that is never triggered and hence can be deleted
     std::vector<OrderLogicVertex*> m_logicpsToDelete;
     const string m_tag;  // Substring to add to generated names
+    VDouble0 m_statSingle;  // Combinational logic evaluated only when its one trigger fires
+    VDouble0 m_statMulti;  // Combinational logic evaluated when any of several triggers fire
+    VDouble0 m_statDeleted;  // Combinational logic never triggered
 
     // METHODS
 
@@ -166,10 +170,21 @@ class V3OrderProcessDomains final {
             // If nothing triggers this vertex, we can delete the corresponding logic
             if (!domainp) {
                 domainp = m_deleteDomainp;
-                if (lvtxp) m_logicpsToDelete.push_back(lvtxp);
+                if (lvtxp) {
+                    m_logicpsToDelete.push_back(lvtxp);
+                    ++m_statDeleted;
+                }
             } else {
                 // Simplify and create canonical global SenTree
                 domainp = simplifyDomain(domainp);
+                // Logic is skipped in evaluations where none of its triggers fired
+                if (lvtxp) {
+                    if (domainp->isMulti()) {
+                        ++m_statMulti;
+                    } else {
+                        ++m_statSingle;
+                    }
+                }
             }
 
             // Set the domain of the vertex
@@ -243,7 +258,12 @@ class V3OrderProcessDomains final {
         }
     }
 
-    ~V3OrderProcessDomains() = default;
+    ~V3OrderProcessDomains() {
+        const string prefix = "Scheduling, '" + m_tag + "' combo logic, ";
+        V3Stats::addStatSum(prefix + "single trigger", m_statSingle);
+        V3Stats::addStatSum(prefix + "multiple triggers", m_statMulti);
+        V3Stats::addStatSum(prefix + "never triggered", m_statDeleted);
+    }
 
 public:
     // Order the logic
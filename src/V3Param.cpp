@@ -607,6 +607,8 @@ class ParamProcessor final {
         // Deep clone of new module
         // Note all module internal variables will be re-linked to the new modules by clone
         // However links outside the module (like on the upper cells) will not.
+        // Clones are made serially: cloning uses clonep() links shared by the whole tree,
+        // and each specialization is then widthed/constified, which is not MT safe.
         AstNodeModule* newModp;
         if (srcModp->user3p()) {
             newModp = VN_CAST(srcModp->user3p()->cloneTree(false), NodeModule);
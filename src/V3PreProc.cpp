@@ -35,6 +35,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <stack>
+#include <unordered_map>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -196,6 +197,9 @@ public:
     // For getline()
     string m_lineChars;  ///< Characters left for next line
 
+    // For include guards
+    std::unordered_map<string, string> m_includeGuards;  ///< Filename -> guard macro, or ""
+
     void v3errorEnd(std::ostringstream& str) VL_RELEASE(V3Error::s().m_mutex) {
         fileline()->v3errorEnd(str);
     }
@@ -210,6 +214,7 @@ private:
     void endOfOneFile();
     string defineSubst(VDefineRef* refp);
 
+    static string includeGuard(const StrList& wholefile);
     bool defExists(const string& name);
     bool defCmdline(const string& name);
     string defValue(const string& name);
@@ -812,12 +817,91 @@ string V3PreProcImp::defineSubst(VDefineRef* refp) {
 //**********************************************************************
 // Parser routines
 
+string V3PreProcImp::includeGuard(const StrList& wholefile) {
+    // Return NAME if the only thing outside comments is a `ifndef NAME ... `endif
+    // block, with no `else or `elsif at its level, otherwise ""
+    string text;
+    for (const string& i : wholefile) text += i;
+    const size_t len = text.size();
+    size_t pos = 0;
+    const auto skipSpaceAndComments = [&]() {
+        while (pos < len) {
+            if (std::isspace(static_cast<unsigned char>(text[pos]))) {
+                ++pos;
+            } else if (text.compare(pos, 2, "//") == 0) {
+                pos = text.find('\n', pos);
+                if (pos == string::npos) pos = len;
+            } else if (text.compare(pos, 2, "/*") == 0) {
+                pos = text.find("*/", pos + 2);
+                pos = (pos == string::npos) ? len + 1 : pos + 2;
+            } else {
+                break;
+            }
+        }
+    };
+    const auto isIdChar = [&](size_t p) {
+        return p < len
+               && (std::isalnum(static_cast<unsigned char>(text[p])) || text[p] == '_'
+                   || text[p] == '$');
+    };
+    const auto readWord = [&]() {
+        const size_t start = pos;
+        while (isIdChar(pos)) ++pos;
+        return text.substr(start, pos - start);
+    };
+
+    skipSpaceAndComments();
+    if (pos >= len || text.compare(pos, 7, "`ifndef") != 0 || isIdChar(pos + 7)) return "";
+    pos += 7;
+    while (pos < len && (text[pos] == ' ' || text[pos] == '\t')) ++pos;
+    if (pos >= len || std::isdigit(static_cast<unsigned char>(text[pos]))) return "";
+    const string guard = readWord();
+    if (guard.empty()) return "";
+
+    int depth = 1;
+    while (pos < len && depth) {
+        const char c = text[pos];
+        if (text.compare(pos, 2, "//") == 0 || text.compare(pos, 2, "/*") == 0) {
+            skipSpaceAndComments();
+        } else if (c == '"') {
+            for (++pos; pos < len && text[pos] != '"' && text[pos] != '\n'; ++pos) {
+                if (text[pos] == '\\') ++pos;
+            }
+            ++pos;
+        } else if (c == '`') {
+            ++pos;
+            const string directive = readWord();
+            if (directive == "ifdef" || directive == "ifndef") {
+                ++depth;
+            } else if (directive == "endif") {
+                --depth;
+            } else if (depth == 1 && (directive == "else" || directive == "elsif")) {
+                return "";
+            }
+        } else {
+            ++pos;
+        }
+    }
+    if (depth) return "";
+    skipSpaceAndComments();
+    return pos >= len ? guard : "";
+}
+
 void V3PreProcImp::openFile(FileLine*, VInFilter* filterp, const string& filename) {
     // Open a new file, possibly overriding the current one which is active.
     if (m_incError) return;
     m_lexp->setYYDebug(debug() >= 5);
     V3File::addSrcDepend(filename);
 
+    // A file wholly inside an `ifndef guard is empty once the guard is defined, so
+    // skip reading it again.  Not with -E, where the `line markers show each include.
+    const auto guardIt = m_includeGuards.find(filename);
+    if (guardIt != m_includeGuards.end() && !guardIt->second.empty()
+        && !v3Global.opt.preprocOnly() && defExists(guardIt->second)) {
+        UINFO(4, "Skip include of " << filename << ", guard defined: " << guardIt->second);
+        return;
+    }
+
     // Read a list<string> with the whole file.
     StrList wholefile;
     const bool ok = filterp->readWholefile(filename, wholefile /*ref*/);
@@ -825,6 +909,9 @@ void V3PreProcImp::openFile(FileLine*, VInFilter* filterp, const string& filenam
         fileline()->v3error("File not found: " + filename);
         return;
     }
+    if (guardIt == m_includeGuards.end()) {
+        m_includeGuards.emplace(filename, includeGuard(wholefile));
+    }
 
     if (!m_preprocp->isEof()) {  // IE not the first file.
         // We allow the same include file twice, because occasionally it pops
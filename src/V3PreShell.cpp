@@ -87,6 +87,11 @@ protected:
     bool preproc(FileLine* fl, const string& modname, VInFilter* filterp, V3ParseImp* parsep,
                  const string& errmsg) {  // "" for no error
         // Preprocess the given module, putting output in vppFilename
+        // The output is not cached across runs.  It depends on every `define made
+        // by earlier files and includes, not just on this file and the command line,
+        // so a sound cache key costs about as much as preprocessing.  Builds wanting
+        // to share the work can preprocess once with -E, whose `line directives keep
+        // the original file locations, and pass that output to later runs.
         UINFO(1, "Preprocessing " << modname);
 
         // Preprocess
@@ -46,6 +46,7 @@ class PremitVisitor final : public VNVisitor {
 
     // STATE - across all visitors
     VDouble0 m_extractedToConstPool;  // Statistic tracking
+    VDouble0 m_assignedInPlace;  // Statistic tracking
 
     // STATE - for current visit position (use VL_RESTORER)
     AstCFunc* m_cfuncp = nullptr;  // Current block
@@ -159,6 +160,16 @@ class PremitVisitor final : public VNVisitor {
         });
     }
 
+    static bool assignsInPlace(AstNodeAssign* nodep) {
+        // Each word of a wide AND/OR/XOR/NOT depends only on the same word
+        // of its operands, so the VL_*_W functions may write over an operand.
+        // Operands other than the whole variable itself will get temporaries.
+        if (!VN_IS(nodep->lhsp(), VarRef) || AstVar::scVarRecurse(nodep->lhsp())) return false;
+        const AstNodeExpr* const rhsp = nodep->rhsp();
+        return rhsp->isWide()
+               && (VN_IS(rhsp, And) || VN_IS(rhsp, Or) || VN_IS(rhsp, Xor) || VN_IS(rhsp, Not));
+    }
+
     // VISITORS
     void visit(AstCFunc* nodep) override {
         UASSERT_OBJ(!m_cfuncp, nodep, "Should not nest");
@@ -221,11 +232,15 @@ class PremitVisitor final : public VNVisitor {
             }
         }
 
-        if (rhsReadsLhs(nodep)) {
+        if (!rhsReadsLhs(nodep)) {
+            iterateAndNextNull(nodep->rhsp());
+        } else if (assignsInPlace(nodep)) {
+            // Write the result straight over the variable, without a copy from a temporary
+            ++m_assignedInPlace;
+            iterateAndNextNull(nodep->rhsp());
+        } else {
             // Need to do this even if not wide, as e.g. a select may be on a wide operator
             createWideTemp(nodep->rhsp());
-        } else {
-            iterateAndNextNull(nodep->rhsp());
         }
 
         m_assignLhs = true;  // Restored by VL_RESTORER in START_STATEMENT_OR_RETURN
@@ -360,6 +375,7 @@ public:
     ~PremitVisitor() override {
         V3Stats::addStat("Optimizations, Prelim extracted value to ConstPool",
                          m_extractedToConstPool);
+        V3Stats::addStat("Optimizations, Prelim wide assignments in place", m_assignedInPlace);
     }
 };
 
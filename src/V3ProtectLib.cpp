@@ -333,6 +333,14 @@ class ProtectVisitor final : public VNVisitor {
                               + m_topName + "_container*>(vhandlep__V);\n");
     }
 
+    static string evalIfDirty() {
+        // Evaluating with unchanged inputs would give the same outputs, so skip it
+        return "if (handlep__V->m_dirty) {\n"
+               "handlep__V->m_dirty = false;\n"
+               "handlep__V->eval();\n"
+               "}\n";
+    }
+
     void createCppFile(FileLine* fl) {
         // Comments
         AstTextBlock* const txtp = new AstTextBlock{fl};
@@ -349,6 +357,7 @@ class ProtectVisitor final : public VNVisitor {
         txtp->addText(fl, "class " + m_topName + "_container: public " + m_topName + " {\n");
         txtp->addText(fl, "public:\n");
         txtp->addText(fl, "long long m_seqnum;\n");
+        txtp->addText(fl, "bool m_dirty = true;  // Inputs changed since last eval\n");
         txtp->addText(fl, m_topName + "_container(const char* scopep__V):\n");
         txtp->addText(fl, m_topName + "(scopep__V) {}\n");
         txtp->addText(fl, "};\n\n");
@@ -390,7 +399,7 @@ class ProtectVisitor final : public VNVisitor {
         m_cComboInsp = new AstTextBlock{fl, "{\n"};
         castPtr(fl, m_cComboInsp);
         txtp->addNodesp(m_cComboInsp);
-        m_cComboOutsp = new AstTextBlock{fl, "handlep__V->eval();\n"};
+        m_cComboOutsp = new AstTextBlock{fl, evalIfDirty()};
         txtp->addNodesp(m_cComboOutsp);
         txtp->addText(fl, "return handlep__V->m_seqnum++;\n");
         txtp->addText(fl, "}\n\n");
@@ -405,7 +414,7 @@ class ProtectVisitor final : public VNVisitor {
             m_cSeqClksp = new AstTextBlock{fl, "{\n"};
             castPtr(fl, m_cSeqClksp);
             txtp->addNodesp(m_cSeqClksp);
-            m_cSeqOutsp = new AstTextBlock{fl, "handlep__V->eval();\n"};
+            m_cSeqOutsp = new AstTextBlock{fl, evalIfDirty()};
             txtp->addNodesp(m_cSeqOutsp);
             txtp->addText(fl, "return handlep__V->m_seqnum++;\n");
             txtp->addText(fl, "}\n\n");
@@ -451,7 +460,12 @@ class ProtectVisitor final : public VNVisitor {
     void visit(AstNode*) override {}
 
     string cInputConnection(AstVar* varp) {
-        return V3Task::assignDpiToInternal("handlep__V->" + varp->name(), varp);
+        // Assign the input, marking the model dirty if the value changed
+        const string lhs = "handlep__V->" + varp->name();
+        const string prev = varp->name() + "__Vprev";
+        return "const auto " + prev + " = " + lhs + ";\n"
+               + V3Task::assignDpiToInternal(lhs, varp) + "if (" + lhs + " != " + prev
+               + ") handlep__V->m_dirty = true;\n";
     }
 
     void handleClock(AstVar* varp) {
@@ -40,11 +40,14 @@
 #include "V3FileLine.h"
 #include "V3Global.h"
 #include "V3MemberMap.h"
+#include "V3Stats.h"
 #include "V3UniqueNames.h"
 
+#include <algorithm>
 #include <queue>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -1232,6 +1235,290 @@ public:
     }
 };
 
+//######################################################################
+// Decomposes class constraints that need no SMT solver: each constraint expression must be
+// a combination (&&, ||, !) of comparisons of a single rand variable against constants,
+// which covers ranges, inside sets, dist and ==. The legal values of each variable are then
+// known at compile time as a list of intervals, and can be sampled directly at runtime.
+
+class ConstraintFastPath final {
+public:
+    // TYPES
+    using Ranges = std::vector<std::pair<uint64_t, uint64_t>>;  // Sorted, disjoint [lo, hi]
+    using VarRanges = std::vector<std::pair<AstVar*, Ranges>>;
+
+private:
+    struct Term final {
+        AstVar* varp = nullptr;  // Constrained variable, nullptr if expression is constant
+        Ranges ranges;  // Values of varp making the expression true; non-empty if const true
+    };
+    enum class CmpOp : uint8_t { LT, LTE, GT, GTE, EQ, NEQ };
+
+    // STATE
+    VarRanges m_vars;  // Legal values of each constrained variable, in order of appearance
+
+    // METHODS
+    static Ranges normalize(Ranges ranges) {
+        std::sort(ranges.begin(), ranges.end());
+        Ranges result;
+        for (const auto& range : ranges) {
+            if (!result.empty()
+                && (result.back().second == ~0ULL || range.first <= result.back().second + 1)) {
+                result.back().second = std::max(result.back().second, range.second);
+            } else {
+                result.push_back(range);
+            }
+        }
+        return result;
+    }
+    static Ranges intersect(const Ranges& as, const Ranges& bs) {
+        Ranges result;
+        auto ait = as.begin();
+        auto bit = bs.begin();
+        while (ait != as.end() && bit != bs.end()) {
+            const uint64_t lo = std::max(ait->first, bit->first);
+            const uint64_t hi = std::min(ait->second, bit->second);
+            if (lo <= hi) result.emplace_back(lo, hi);
+            if (ait->second < bit->second) {
+                ++ait;
+            } else {
+                ++bit;
+            }
+        }
+        return result;
+    }
+    static Ranges unite(const Ranges& as, const Ranges& bs) {
+        Ranges result = as;
+        result.insert(result.end(), bs.begin(), bs.end());
+        return normalize(result);
+    }
+    static Ranges complement(const Ranges& ranges, uint64_t maxValue) {
+        Ranges result;
+        uint64_t lo = 0;
+        for (const auto& range : ranges) {
+            if (range.first > lo) result.emplace_back(lo, range.first - 1);
+            if (range.second == maxValue) return result;
+            lo = range.second + 1;
+        }
+        result.emplace_back(lo, maxValue);
+        return result;
+    }
+    static Term constTerm(bool value) {
+        Term term;
+        if (value) term.ranges.emplace_back(0, 0);
+        return term;
+    }
+    // Variable a comparison operand refers to, if it may be sampled directly
+    static AstVar* candidateVar(const AstNodeExpr* nodep) {
+        const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef);
+        if (!refp || VN_IS(refp, VarXRef)) return nullptr;
+        AstVar* const varp = refp->varp();
+        if (!varp->rand().isRand() || varp->rand().isRandC()) return nullptr;
+        if (!VN_IS(varp->user2p(), Class)) return nullptr;
+        const RandomizeMode randMode = {.asInt = varp->user1()};
+        if (randMode.usesMode) return nullptr;
+        const AstBasicDType* const basicp = VN_CAST(varp->dtypep()->skipRefp(), BasicDType);
+        if (!basicp || !basicp->isIntegralOrPacked()) return nullptr;
+        if (varp->width() > 64 || refp->width() != varp->width()) return nullptr;
+        return varp;
+    }
+    static bool compare(AstNodeBiop* nodep, Term& term) {
+        CmpOp op;
+        bool isSigned = false;
+        if (VN_IS(nodep, Lt) || VN_IS(nodep, LtS)) {
+            op = CmpOp::LT;
+            isSigned = VN_IS(nodep, LtS);
+        } else if (VN_IS(nodep, Lte) || VN_IS(nodep, LteS)) {
+            op = CmpOp::LTE;
+            isSigned = VN_IS(nodep, LteS);
+        } else if (VN_IS(nodep, Gt) || VN_IS(nodep, GtS)) {
+            op = CmpOp::GT;
+            isSigned = VN_IS(nodep, GtS);
+        } else if (VN_IS(nodep, Gte) || VN_IS(nodep, GteS)) {
+            op = CmpOp::GTE;
+            isSigned = VN_IS(nodep, GteS);
+        } else if (VN_IS(nodep, Eq) || VN_IS(nodep, EqWild)) {
+            op = CmpOp::EQ;
+        } else if (VN_IS(nodep, Neq) || VN_IS(nodep, NeqWild)) {
+            op = CmpOp::NEQ;
+        } else {
+            return false;
+        }
+        AstNodeExpr* exprp = nodep->lhsp();
+        AstNodeExpr* otherp = nodep->rhsp();
+        const int cmpWidth = exprp->width();
+        if (cmpWidth > 64 || otherp->width() != cmpWidth) return false;
+        const uint64_t cmpMask = VL_MASK_Q(cmpWidth);
+        const uint64_t signBit = isSigned ? 1ULL << (cmpWidth - 1) : 0;
+        // Comparing keys as unsigned orders values as the comparison does
+        const auto keyOf = [&](uint64_t value) { return (value ^ signBit) & cmpMask; };
+        const AstConst* const lconstp = VN_CAST(exprp, Const);
+        const AstConst* const rconstp = VN_CAST(otherp, Const);
+        if ((lconstp && lconstp->num().isAnyXZ()) || (rconstp && rconstp->num().isAnyXZ())) {
+            return false;
+        }
+        if (lconstp && rconstp) {
+            const uint64_t lkey = keyOf(lconstp->num().toUQuad());
+            const uint64_t rkey = keyOf(rconstp->num().toUQuad());
+            switch (op) {
+            case CmpOp::LT: term = constTerm(lkey < rkey); break;
+            case CmpOp::LTE: term = constTerm(lkey <= rkey); break;
+            case CmpOp::GT: term = constTerm(lkey > rkey); break;
+            case CmpOp::GTE: term = constTerm(lkey >= rkey); break;
+            case CmpOp::EQ: term = constTerm(lkey == rkey); break;
+            case CmpOp::NEQ: term = constTerm(lkey != rkey); break;
+            }
+            return true;
+        }
+        if (lconstp) {  // Normalize to 'variable op constant'
+            std::swap(exprp, otherp);
+            if (op == CmpOp::LT) {
+                op = CmpOp::GT;
+            } else if (op == CmpOp::LTE) {
+                op = CmpOp::GTE;
+            } else if (op == CmpOp::GT) {
+                op = CmpOp::LT;
+            } else if (op == CmpOp::GTE) {
+                op = CmpOp::LTE;
+            }
+        }
+        const AstConst* const constp = lconstp ? lconstp : rconstp;
+        if (!constp) return false;
+        bool signExtend = false;
+        if (const AstExtend* const extendp = VN_CAST(exprp, Extend)) {
+            exprp = extendp->lhsp();
+        } else if (const AstExtendS* const extendp = VN_CAST(exprp, ExtendS)) {
+            exprp = extendp->lhsp();
+            signExtend = true;
+        }
+        AstVar* const varp = candidateVar(exprp);
+        if (!varp) return false;
+        const int varWidth = varp->width();
+
+        // Keys for which the comparison holds
+        const uint64_t constKey = keyOf(constp->num().toUQuad());
+        Ranges keys;
+        switch (op) {
+        case CmpOp::LT:
+            if (constKey > 0) keys.emplace_back(0, constKey - 1);
+            break;
+        case CmpOp::LTE: keys.emplace_back(0, constKey); break;
+        case CmpOp::GT:
+            if (constKey < cmpMask) keys.emplace_back(constKey + 1, cmpMask);
+            break;
+        case CmpOp::GTE: keys.emplace_back(constKey, cmpMask); break;
+        case CmpOp::EQ: keys.emplace_back(constKey, constKey); break;
+        case CmpOp::NEQ: keys = complement({{constKey, constKey}}, cmpMask); break;
+        }
+
+        // Map keys back to variable values. Within each half of the variable's value range
+        // (split at its sign bit) the extended value's key grows with the variable's value.
+        const uint64_t varMask = VL_MASK_Q(varWidth);
+        const uint64_t varSignBit = 1ULL << (varWidth - 1);
+        const uint64_t extendBits = signExtend ? cmpMask & ~varMask : 0;
+        Ranges ranges;
+        const std::pair<uint64_t, uint64_t> halves[2]
+            = {{0, varSignBit - 1}, {varSignBit, varMask}};
+        for (const auto& half : halves) {
+            const uint64_t firstKey
+                = keyOf(half.first >= varSignBit ? half.first | extendBits : half.first);
+            const uint64_t lastKey = firstKey + (half.second - half.first);
+            for (const auto& key : keys) {
+                const uint64_t lo = std::max(key.first, firstKey);
+                const uint64_t hi = std::min(key.second, lastKey);
+                if (lo <= hi) {
+                    ranges.emplace_back(half.first + (lo - firstKey),
+                                        half.first + (hi - firstKey));
+                }
+            }
+        }
+        term.varp = varp;
+        term.ranges = normalize(ranges);
+        return true;
+    }
+    static bool combine(Term& term, const Term& other, bool isAnd) {
+        if (!other.varp) {
+            const bool otherValue = !other.ranges.empty();
+            if (otherValue != isAnd) term = constTerm(otherValue);
+            return true;
+        }
+        if (!term.varp) {
+            const bool termValue = !term.ranges.empty();
+            if (termValue == isAnd) term = other;
+            return true;
+        }
+        if (term.varp != other.varp) return false;  // Coupled variables, use the solver
+        term.ranges = isAnd ? intersect(term.ranges, other.ranges)
+                            : unite(term.ranges, other.ranges);
+        return true;
+    }
+    static bool evaluate(AstNodeExpr* nodep, Term& term) {
+        if (nodep->width() != 1) return false;
+        if (const AstConst* const constp = VN_CAST(nodep, Const)) {
+            if (constp->num().isAnyXZ()) return false;
+            term = constTerm(!constp->num().isEqZero());
+            return true;
+        }
+        if (const AstLogNot* const notp = VN_CAST(nodep, LogNot)) {
+            if (!evaluate(notp->lhsp(), term)) return false;
+            if (term.varp) {
+                term.ranges = complement(term.ranges, VL_MASK_Q(term.varp->width()));
+            } else {
+                term = constTerm(term.ranges.empty());
+            }
+            return true;
+        }
+        const bool isAnd = VN_IS(nodep, LogAnd) || VN_IS(nodep, And);
+        if (isAnd || VN_IS(nodep, LogOr) || VN_IS(nodep, Or)) {
+            AstNodeBiop* const biopp = VN_AS(nodep, NodeBiop);
+            Term other;
+            return evaluate(biopp->lhsp(), term) && evaluate(biopp->rhsp(), other)
+                   && combine(term, other, isAnd);
+        }
+        if (AstNodeBiop* const biopp = VN_CAST(nodep, NodeBiop)) return compare(biopp, term);
+        return false;
+    }
+    Ranges& rangesFor(AstVar* varp) {
+        for (auto& pair : m_vars) {
+            if (pair.first == varp) return pair.second;
+        }
+        m_vars.emplace_back(varp, Ranges{{0, VL_MASK_Q(varp->width())}});
+        return m_vars.back().second;
+    }
+
+public:
+    // CONSTRUCTORS
+    ConstraintFastPath() = default;
+
+    // METHODS
+    // Add the constraint to the decomposition, return false if it needs the solver
+    bool addConstraint(const AstConstraint* constrp) {
+        const RandomizeMode constraintMode = {.asInt = constrp->user1()};
+        if (constraintMode.usesMode) return false;
+        for (AstNode* itemp = constrp->itemsp(); itemp; itemp = itemp->nextp()) {
+            const AstConstraintExpr* const cexprp = VN_CAST(itemp, ConstraintExpr);
+            if (!cexprp || cexprp->isSoft() || cexprp->isDisableSoft()) return false;
+            Term term;
+            if (!evaluate(cexprp->exprp(), term)) return false;
+            if (term.varp) {
+                Ranges& rangesr = rangesFor(term.varp);
+                rangesr = intersect(rangesr, term.ranges);
+            } else if (term.ranges.empty()) {
+                m_vars.emplace_back(nullptr, Ranges{});  // Constant false
+            }
+        }
+        return true;
+    }
+    // Constraints can never be met
+    bool unsat() const {
+        for (const auto& pair : m_vars) {
+            if (pair.second.empty()) return true;
+        }
+        return false;
+    }
+    const VarRanges& vars() const { return m_vars; }
+};
+
 //######################################################################
 // Visitor that defines a randomize method where needed
 
@@ -1267,6 +1554,7 @@ class RandomizeVisitor final : public VNVisitor {
     int m_randCaseNum = 0;  // Randcase number within a module for var naming
     std::map<std::string, AstCDType*> m_randcDtypes;  // RandC data type deduplication
     AstConstraint* m_constraintp = nullptr;  // Current constraint
+    VDouble0 m_statFastPath;  // Statistic tracking classes randomized without the solver
 
     // METHODS
     void createRandomGenerator(AstClass* const classp) {
@@ -1673,6 +1961,63 @@ class RandomizeVisitor final : public VNVisitor {
             return new AstRandRNG{fl, dtypep};
         }
     }
+    // Sample the variables of a class whose constraints ConstraintFastPath fully decomposed,
+    // returning the randomize() result
+    AstNodeExpr* newFastPathRandomize(FileLine* const fl, AstFunc* const randomizep,
+                                      const ConstraintFastPath& fastPath) {
+        if (fastPath.unsat()) return new AstConst{fl, AstConst::WidthedValue{}, 32, 0};
+        AstNodeDType* const u64Dtypep = randomizep->findUInt64DType();
+        AstVar* tmpVarp = nullptr;
+        for (const auto& pair : fastPath.vars()) {
+            AstVar* const varp = pair.first;
+            const ConstraintFastPath::Ranges& ranges = pair.second;
+            AstClass* const classp = VN_AS(varp->user2p(), Class);
+            const int width = varp->width();
+            if (ranges.size() == 1 && ranges.front().first == 0
+                && ranges.front().second == VL_MASK_Q(width)) {
+                randomizep->addStmtsp(
+                    new AstAssign{fl, new AstVarRef{fl, classp, varp, VAccess::WRITE},
+                                  newRandValue(fl, nullptr, varp->dtypep())});
+                continue;
+            }
+            if (!tmpVarp) {
+                tmpVarp = new AstVar{fl, VVarType::BLOCKTEMP, "__Vrandfast", u64Dtypep};
+                tmpVarp->noSubst(true);
+                tmpVarp->funcLocal(true);
+                randomizep->addStmtsp(tmpVarp);
+            }
+            // tmp = random % count; then var = lo + tmp - below, for the range tmp falls in
+            uint64_t count = 0;
+            for (const auto& range : ranges) count += range.second - range.first + 1;
+            AstNodeExpr* const moddivp
+                = new AstModDiv{fl, new AstRandRNG{fl, u64Dtypep},
+                                new AstConst{fl, AstConst::Unsized64{}, count}};
+            randomizep->addStmtsp(
+                new AstAssign{fl, new AstVarRef{fl, tmpVarp, VAccess::WRITE}, moddivp});
+            AstNodeStmt* stmtp = nullptr;
+            uint64_t below = 0;  // Values of tmp selecting earlier ranges
+            for (const auto& range : ranges) {
+                // Wraps around, but tmp >= below so the sum is in range
+                AstNodeExpr* valuep = new AstAdd{
+                    fl, new AstVarRef{fl, tmpVarp, VAccess::READ},
+                    new AstConst{fl, AstConst::Unsized64{}, range.first - below}};
+                if (width < 64) valuep = new AstSel{fl, valuep, 0, width};
+                AstNodeStmt* const assignp
+                    = new AstAssign{fl, new AstVarRef{fl, classp, varp, VAccess::WRITE}, valuep};
+                if (!stmtp) {
+                    stmtp = assignp;
+                } else {
+                    stmtp = new AstIf{fl,
+                                      new AstGte{fl, new AstVarRef{fl, tmpVarp, VAccess::READ},
+                                                 new AstConst{fl, AstConst::Unsized64{}, below}},
+                                      assignp, stmtp};
+                }
+                below += range.second - range.first + 1;
+            }
+            randomizep->addStmtsp(stmtp);
+        }
+        return new AstConst{fl, AstConst::WidthedValue{}, 32, 1};
+    }
     void addPrePostCall(AstClass* const classp, AstFunc* const funcp, const string& name) {
         if (AstTask* userFuncp = VN_CAST(m_memberMap.findMember(classp, name), Task)) {
             AstTaskRef* const callp = new AstTaskRef{userFuncp->fileline(), userFuncp, nullptr};
@@ -2010,6 +2355,14 @@ class RandomizeVisitor final : public VNVisitor {
         AstNodeExpr* beginValp = nullptr;
         AstVar* genp = getRandomGenerator(nodep);
         if (genp) {
+            // Sample directly when all constraints are on independent variables
+            ConstraintFastPath fastPath;
+            bool useFastPath = !randModeVarp && !getConstraintModeVar(nodep);
+            if (useFastPath) {
+                nodep->foreachMember([&](AstClass* const classp, AstConstraint* const constrp) {
+                    if (classp != nodep || !fastPath.addConstraint(constrp)) useFastPath = false;
+                });
+            }
             nodep->foreachMember([&](AstClass* const classp, AstConstraint* const constrp) {
                 AstTask* taskp = VN_AS(constrp->user2p(), Task);
                 if (!taskp) {
@@ -2038,19 +2391,24 @@ class RandomizeVisitor final : public VNVisitor {
                         nodep, constrp, constrp->itemsp()->unlinkFrBackWithNext()));
                 }
             });
-            randomizep->addStmtsp(implementConstraintsClear(fl, genp));
-            AstTask* setupAllTaskp = getCreateConstraintSetupFunc(nodep);
-            AstTaskRef* const setupTaskRefp = new AstTaskRef{fl, setupAllTaskp, nullptr};
-            randomizep->addStmtsp(setupTaskRefp->makeStmt());
-
-            AstNodeModule* const genModp = VN_AS(genp->user2p(), NodeModule);
-            AstVarRef* const genRefp = new AstVarRef{fl, genModp, genp, VAccess::READWRITE};
-            AstNode* const argsp = genRefp;
-            argsp->addNext(new AstText{fl, ".next(__Vm_rng)"});
-
-            AstNodeExpr* const solverCallp = new AstCExpr{fl, argsp};
-            solverCallp->dtypeSetBit();
-            beginValp = solverCallp;
+            if (useFastPath) {
+                ++m_statFastPath;
+                beginValp = newFastPathRandomize(fl, randomizep, fastPath);
+            } else {
+                randomizep->addStmtsp(implementConstraintsClear(fl, genp));
+                AstTask* setupAllTaskp = getCreateConstraintSetupFunc(nodep);
+                AstTaskRef* const setupTaskRefp = new AstTaskRef{fl, setupAllTaskp, nullptr};
+                randomizep->addStmtsp(setupTaskRefp->makeStmt());
+
+                AstNodeModule* const genModp = VN_AS(genp->user2p(), NodeModule);
+                AstVarRef* const genRefp = new AstVarRef{fl, genModp, genp, VAccess::READWRITE};
+                AstNode* const argsp = genRefp;
+                argsp->addNext(new AstText{fl, ".next(__Vm_rng)"});
+
+                AstNodeExpr* const solverCallp = new AstCExpr{fl, argsp};
+                solverCallp->dtypeSetBit();
+                beginValp = solverCallp;
+            }
 
             if (randModeVarp) {
                 AstNodeModule* const randModeClassp = VN_AS(randModeVarp->user2p(), Class);
@@ -2362,7 +2720,9 @@ public:
             VL_DO_DANGLING(pushDeletep(constrp->unlinkFrBack()), constrp);
         });
     }
-    ~RandomizeVisitor() override = default;
+    ~RandomizeVisitor() override {
+        V3Stats::addStat("Randomize, constrained classes without solver", m_statFastPath);
+    }
 };
 
 //######################################################################
@@ -103,6 +103,9 @@ class ReloopVisitor final : public VNVisitor {
                     fl, new AstVarRef{fl, itp, VAccess::WRITE},
                     new AstAdd{fl, new AstConst{fl, 1}, new AstVarRef{fl, itp, VAccess::READ}}};
                 AstWhile* const whilep = new AstWhile{fl, condp, nullptr, incp};
+                // Each iteration writes a different element, and reads if at all from
+                // a different variable, so the compiler may vectorize the loop
+                whilep->independent(true);
                 initp->addNext(whilep);
                 itp->AstNode::addNext(initp);
                 bodyp->replaceWith(itp);
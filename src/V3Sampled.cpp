@@ -34,7 +34,9 @@ class SampledVisitor final : public VNVisitor {
     // NODE STATE
     //  AstVarScope::user1()  -> AstVarScope*. The VarScope that stores sampled value
     //  AstVarRef::user1()    -> bool. Whether already converted
+    //  AstVarScope::user2()  -> bool. Sampled other than only for assertions
     const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
 
     // STATE - for current visit position (use VL_RESTORER)
     AstScope* m_scopep = nullptr;  // Current scope
@@ -45,8 +47,10 @@ class SampledVisitor final : public VNVisitor {
     AstVarScope* createSampledVar(AstVarScope* vscp) {
         if (vscp->user1p()) return VN_AS(vscp->user1p(), VarScope);
         const AstVar* const varp = vscp->varp();
-        const string newvarname
-            = "__Vsampled_" + vscp->scopep()->nameDotless() + "__" + varp->name();
+        // V3Clock skips updating gated values while assertions are off
+        const bool gated = v3Global.opt.assertGateSampled() && !vscp->user2();
+        const string newvarname = (gated ? "__VsampledGated_" : "__Vsampled_")
+                                  + vscp->scopep()->nameDotless() + "__" + varp->name();
         FileLine* const flp = vscp->fileline();
         AstVar* const newvarp = new AstVar{flp, VVarType::MODULETEMP, newvarname, varp->dtypep()};
         m_scopep->modp()->addStmtsp(newvarp);
@@ -92,7 +96,15 @@ class SampledVisitor final : public VNVisitor {
 
 public:
     // CONSTRUCTORS
-    explicit SampledVisitor(AstNetlist* netlistp) { iterate(netlistp); }
+    explicit SampledVisitor(AstNetlist* netlistp) {
+        if (v3Global.opt.assertGateSampled()) {
+            netlistp->foreach([](const AstSampled* sampledp) {
+                if (sampledp->assertOnly()) return;
+                sampledp->foreach([](const AstVarRef* refp) { refp->varScopep()->user2(true); });
+            });
+        }
+        iterate(netlistp);
+    }
     ~SampledVisitor() override = default;
 };
 
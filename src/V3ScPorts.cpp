@@ -0,0 +1,123 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Only write SystemC outputs when changed
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3ScPorts's Transformations:
+//
+// With --pins-sc-change-only, each assignment to a SystemC output:
+//      Becomes
+//          if (!__Vscwritten__OUT || __Vscprev__OUT != RHS) {
+//              __Vscwritten__OUT = 1;
+//              __Vscprev__OUT = RHS;
+//              OUT = __Vscprev__OUT;
+//          }
+//      so the conversion to the SystemC type and the sc_signal write are
+//      only done when the value changes. The previous value is the last one
+//      written, not the port's current value, which only updates after the
+//      delta cycle, so several writes in the same evaluation stay correct.
+//
+//      Must be before V3Descope, as it creates scoped variables.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3ScPorts.h"
+
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class ScPortsVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstVarScope::user1p()   -> AstVarScope*. Previous value of SystemC output
+    //  AstVarScope::user2p()   -> AstVarScope*. Whether the SystemC output was written
+    const VNUser1InUse m_inuser1;
+    const VNUser2InUse m_inuser2;
+
+    // STATE - for current visit position (use VL_RESTORER)
+    const AstCFunc* m_cfuncp = nullptr;  // Current function
+
+    // STATE - across all visitors
+    VDouble0 m_statWrites;  // Number of output writes made change-only
+
+    // METHODS
+    static bool isScOutput(const AstVarRef* refp) {
+        const AstVar* const varp = refp->varp();
+        return varp->isSc() && varp->isPrimaryIO() && varp->isWritable() && !varp->isInout()
+               && VN_IS(varp->dtypeSkipRefp(), BasicDType);
+    }
+
+    // VISITORS
+    void visit(AstCFunc* nodep) override {
+        VL_RESTORER(m_cfuncp);
+        m_cfuncp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeAssign* nodep) override {
+        if (!m_cfuncp) return;
+        if (!VN_IS(nodep, Assign) && !VN_IS(nodep, AssignW)) return;
+        AstVarRef* const lhsp = VN_CAST(nodep->lhsp(), VarRef);
+        if (!lhsp || !isScOutput(lhsp)) return;
+        // The value is computed again when it changed, so must be cheap and side effect free
+        AstNodeExpr* const rhsp = nodep->rhsp();
+        if (!rhsp->isPure() || rhsp->nodeCount() > 8) return;
+        FileLine* const flp = nodep->fileline();
+        AstVarScope* const vscp = lhsp->varScopep();
+        if (!vscp->user1p()) {
+            AstScope* const scopep = vscp->scopep();
+            const string name = vscp->varp()->name();
+            vscp->user1p(scopep->createTempLike("__Vscprev__" + name, vscp));
+            vscp->user2p(scopep->createTemp("__Vscwritten__" + name,
+                                            nodep->findBasicDType(VBasicDTypeKwd::BIT)));
+        }
+        AstVarScope* const prevp = VN_AS(vscp->user1p(), VarScope);
+        AstVarScope* const writtenp = VN_AS(vscp->user2p(), VarScope);
+
+        AstNodeExpr* const condp = new AstLogOr{
+            flp, new AstLogNot{flp, new AstVarRef{flp, writtenp, VAccess::READ}},
+            new AstNeq{flp, new AstVarRef{flp, prevp, VAccess::READ}, rhsp->cloneTree(false)}};
+        AstIf* const ifp = new AstIf{flp, condp};
+        ifp->addThensp(new AstAssign{flp, new AstVarRef{flp, writtenp, VAccess::WRITE},
+                                     new AstConst{flp, AstConst::BitTrue{}}});
+        ifp->addThensp(new AstAssign{flp, new AstVarRef{flp, prevp, VAccess::WRITE},
+                                     rhsp->unlinkFrBack()});
+        ifp->addThensp(new AstAssign{flp, lhsp->unlinkFrBack(),
+                                     new AstVarRef{flp, prevp, VAccess::READ}});
+        nodep->replaceWith(ifp);
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+        ++m_statWrites;
+    }
+    void visit(AstNodeExpr*) override {}  // Accelerate
+    void visit(AstVar*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit ScPortsVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~ScPortsVisitor() override {
+        V3Stats::addStat("Optimizations, SystemC change-only writes", m_statWrites);
+    }
+};
+
+//######################################################################
+// ScPorts class functions
+
+void V3ScPorts::scPortsAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { ScPortsVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("scports", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -167,6 +167,67 @@ AstNodeStmt* profExecSectionPop(FileLine* flp) {
     return new AstCStmt{flp, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).sectionPop();\n"};
 }
 
+AstNodeStmt* profRegionPush(FileLine* flp, const string& region) {
+    return new AstCStmt{flp, "vlSymsp->__Vm_regionProfiler.push(\"" + region + "\");\n"};
+}
+
+AstNodeStmt* profRegionPop(FileLine* flp) {
+    return new AstCStmt{flp, "vlSymsp->__Vm_regionProfiler.pop();\n"};
+}
+
+// Wrap the statement in region timing with --prof-regions
+AstNodeStmt* profRegion(FileLine* flp, const string& region, AstNodeStmt* stmtp) {
+    if (!v3Global.opt.profRegions()) return stmtp;
+    AstNodeStmt* const pushp = profRegionPush(flp, region);
+    pushp->addNext(stmtp);
+    pushp->addNext(profRegionPop(flp));
+    return pushp;
+}
+
+// Gather variables read (or written if 'write') by the function and the functions it calls.
+// Returns false if it contains C++ code that might access variables not known here.
+bool gatherAccesses(AstCFunc* funcp, bool write, std::unordered_set<const AstVarScope*>& vscps,
+                    std::unordered_set<const AstCFunc*>& visited) {
+    if (!visited.insert(funcp).second) return true;
+    bool known = true;
+    std::vector<AstCFunc*> calleeps;
+    funcp->foreach([&](AstNode* nodep) {
+        if (const AstVarRef* const refp = VN_CAST(nodep, VarRef)) {
+            if (write ? refp->access().isWriteOrRW() : refp->access().isReadOrRW()) {
+                vscps.insert(refp->varScopep());
+            }
+        } else if (const AstNodeCCall* const callp = VN_CAST(nodep, NodeCCall)) {
+            if (callp->funcp()) calleeps.push_back(callp->funcp());
+        } else if (VN_IS(nodep, CStmt) || VN_IS(nodep, CExpr)) {
+            known = false;
+        }
+    });
+    for (AstCFunc* const calleep : calleeps) {
+        known &= gatherAccesses(calleep, write, vscps, visited);
+    }
+    return known;
+}
+
+// Whether, after the trigger computation 'trigFuncp' found no triggers, running the region
+// functions 'funcps' could never make the triggers fire, so the eval loop iterating them can
+// skip re-computing the triggers and checking for convergence.
+bool convergesInOnePass(AstCFunc* trigFuncp, std::initializer_list<AstCFunc*> funcps) {
+    if (!v3Global.opt.evalStraightLine() || v3Global.usesTiming()) return false;
+    std::unordered_set<const AstVarScope*> readps;
+    std::unordered_set<const AstCFunc*> visited;
+    if (!gatherAccesses(trigFuncp, false, readps, visited)) return false;
+    std::unordered_set<const AstVarScope*> writtenps;
+    visited.clear();
+    for (AstCFunc* const funcp : funcps) {
+        if (!gatherAccesses(funcp, true, writtenps, visited)) return false;
+    }
+    for (const AstVarScope* const vscp : writtenps) {
+        if (readps.count(vscp)) return false;
+    }
+    V3Stats::addStatSum("Scheduling, single-pass eval loops", 1);
+    return true;
+}
+
 struct EvalLoop final {
     // Flag set to true during the first iteration of the loop
     AstVarScope* firstIterp;
@@ -180,6 +241,7 @@ EvalLoop createEvalLoop(
     const std::string& tag,  // Tag for current phase
     const string& name,  // Name of current phase
     bool slow,  // Should create slow functions
+    bool singlePass,  // Work cannot fire triggers again, so run only once, see convergesInOnePass
     AstVarScope* trigp,  // The trigger vector
     AstCFunc* dumpFuncp,  // Trigger dump function for debugging only
     AstNodeStmt* innerp,  // The inner loop, if any
@@ -230,6 +292,9 @@ EvalLoop createEvalLoop(
 
     // Prof-exec section push
     if (v3Global.opt.profExec()) stmtps = profExecSectionPush(flp, "loop " + tag);
+    if (v3Global.opt.profRegions()) {
+        stmtps = AstNode::addNext(stmtps, profRegionPush(flp, "loop " + tag));
+    }
 
     const auto addVar = [&](const std::string& name, int width, uint32_t initVal) {
         AstVarScope* const vscp = scopeTopp->createTemp("__V" + tag + name, width);
@@ -238,10 +303,22 @@ EvalLoop createEvalLoop(
         return vscp;
     };
 
-    // The iteration counter
-    AstVarScope* const counterp = addVar("IterCount", 32, 0);
     // The first iteration flag
     AstVarScope* const firstIterFlagp = addVar("FirstIteration", 1, 1);
+
+    if (singlePass) {
+        // No loop, the only iteration is the first
+        stmtps->addNext(innerp);
+        AstCCall* const callp = new AstCCall{flp, phaseFuncp};
+        callp->dtypeSetBit();
+        stmtps->addNext(callp->makeStmt());
+        if (v3Global.opt.profExec()) stmtps->addNext(profExecSectionPop(flp));
+        if (v3Global.opt.profRegions()) stmtps->addNext(profRegionPop(flp));
+        return {firstIterFlagp, stmtps};
+    }
+
+    // The iteration counter
+    AstVarScope* const counterp = addVar("IterCount", 32, 0);
     // The continuation flag
     AstVarScope* const continueFlagp = addVar("Continue", 1, 1);
 
@@ -277,6 +354,7 @@ EvalLoop createEvalLoop(
 
     // Prof-exec section pop
     if (v3Global.opt.profExec()) stmtps->addNext(profExecSectionPop(flp));
+    if (v3Global.opt.profRegions()) stmtps->addNext(profRegionPop(flp));
 
     return {firstIterFlagp, stmtps};
 }
@@ -397,7 +475,7 @@ LogicClasses gatherLogicClasses(AstNetlist* netlistp) {
 //============================================================================
 // Simple ordering in source order
 
-void orderSequentially(AstCFunc* funcp, const LogicByScope& lbs) {
+void orderSequentially(AstCFunc* funcp, const LogicByScope& lbs, bool profStartup = false) {
     // Create new subfunc for scope
     const auto createNewSubFuncp = [&](AstScope* const scopep) {
         const string subName{funcp->name() + "__" + scopep->nameDotless()};
@@ -444,6 +522,17 @@ void orderSequentially(AstCFunc* funcp, const LogicByScope& lbs) {
                                              true},
                                 bodyp};
                         }
+                    } else if (profStartup) {
+                        // Time each block, suspendable ones would include their delays
+                        FileLine* const flp = procp->fileline();
+                        const string name = flp->filebasename() + ":" + cvtToStr(flp->lineno());
+                        AstNode* const pushp
+                            = new AstCStmt{flp, "vlSymsp->__Vm_startupProfiler.push();\n"};
+                        pushp->addNext(bodyp);
+                        pushp->addNext(new AstCStmt{
+                            flp, "vlSymsp->__Vm_startupProfiler.pop(\"initial "
+                                     + V3OutFormatter::quoteNameControls(name) + "\");\n"});
+                        bodyp = pushp;
                     }
                     subFuncp->addStmtsp(bodyp);
                     if (procp->needProcess()) subFuncp->setNeedProcess();
@@ -470,7 +559,7 @@ AstCFunc* createStatic(AstNetlist* netlistp, const LogicClasses& logicClasses) {
 
 void createInitial(AstNetlist* netlistp, const LogicClasses& logicClasses) {
     AstCFunc* const funcp = makeTopFunction(netlistp, "_eval_initial", /* slow: */ true);
-    orderSequentially(funcp, logicClasses.m_initial);
+    orderSequentially(funcp, logicClasses.m_initial, v3Global.opt.profStartup());
     splitCheck(funcp);
 }
 
@@ -585,6 +674,11 @@ public:
 //============================================================================
 // Helper that creates virtual interface trigger resets
 
+// Description of the trigger of an interface member
+std::string vifTriggerName(const VirtIfaceTriggers::IfaceMember& member) {
+    return "virtual interface: " + member.first->name() + "." + member.second->name();
+}
+
 void addVirtIfaceTriggerAssignments(const VirtIfaceTriggers& virtIfaceTriggers,
                                     size_t vifTriggerIndex, const TriggerKit& actTrig) {
     for (const auto& p : virtIfaceTriggers) {
@@ -640,6 +734,7 @@ const TriggerKit createTriggers(AstNetlist* netlistp, AstCFunc* const initFuncp,
     // Create the trigger computation function
     AstCFunc* const funcp = makeSubFunction(netlistp, "_eval_triggers__" + name, slow);
     if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPush(flp, "trig " + name));
+    if (v3Global.opt.profRegions()) funcp->addStmtsp(profRegionPush(flp, "trig " + name));
 
     // Create the trigger dump function (for debugging, always 'slow')
     AstCFunc* const dumpp = makeSubFunction(netlistp, "_dump_triggers__" + name, true);
@@ -826,6 +921,7 @@ const TriggerKit createTriggers(AstNetlist* netlistp, AstCFunc* const initFuncp,
     }
 
     if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPop(flp));
+    if (v3Global.opt.profRegions()) funcp->addStmtsp(profRegionPop(flp));
 
     // The debug code might leak signal names, so simply delete it when using --protect-ids
     if (v3Global.opt.protectIds()) dumpp->stmtsp()->unlinkFrBackWithNext()->deleteTree();
@@ -879,7 +975,8 @@ void createSettle(AstNetlist* netlistp, AstCFunc* const initFuncp, SenExprBuilde
 
     // Create the eval loop
     const EvalLoop stlLoop = createEvalLoop(  //
-        netlistp, "stl", "Settle", /* slow: */ true, trig.m_vscp, trig.m_dumpp,
+        netlistp, "stl", "Settle", /* slow: */ true, /* singlePass: */ false, trig.m_vscp,
+        trig.m_dumpp,
         // Inner loop statements
         nullptr,
         // Prep statements: Compute the current 'stl' triggers
@@ -927,7 +1024,7 @@ AstNode* createInputCombLoop(AstNetlist* netlistp, AstCFunc* const initFuncp,
                                              : std::numeric_limits<unsigned>::max();
     const size_t firstVifTriggerIndex = extraTriggers.size();
     for (const auto& p : virtIfaceTriggers) {
-        extraTriggers.allocate("virtual interface: " + p.first->name());
+        extraTriggers.allocate(vifTriggerName(p.first));
     }
 
     // Gather the relevant sensitivity expressions and create the trigger kit
@@ -967,16 +1064,18 @@ AstNode* createInputCombLoop(AstNetlist* netlistp, AstCFunc* const initFuncp,
                                  out.push_back(inputChanged);
                              }
                              if (varp->isWrittenByDpi()) out.push_back(dpiExportTriggered);
-                             if (vscp->varp()->sensIfacep()) {
-                                 const auto it = vifTriggered.find(vscp->varp()->sensIfacep());
-                                 if (it != vifTriggered.end()) out.push_back(it->second);
-                             }
+                             VirtIfaceTriggers::addSensitivities(vifTriggered, vscp, out);
                          });
     splitCheck(icoFuncp);
 
+    // The 'ico' logic cannot re-trigger itself, if the only extra trigger is the first iteration
+    const bool singlePass
+        = extraTriggers.size() == 1 && convergesInOnePass(trig.m_funcp, {icoFuncp});
+
     // Create the eval loop
     const EvalLoop icoLoop = createEvalLoop(  //
-        netlistp, "ico", "Input combinational", /* slow: */ false, trig.m_vscp, trig.m_dumpp,
+        netlistp, "ico", "Input combinational", /* slow: */ false, singlePass, trig.m_vscp,
+        trig.m_dumpp,
         // Inner loop statements
         nullptr,
         // Prep statements: Compute the current 'ico' triggers
@@ -1031,13 +1130,20 @@ void createEval(AstNetlist* netlistp,  //
                 const EvalKit& obsKit,  //
                 const EvalKit& reactKit,  //
                 AstCFunc* postponedFuncp,  //
-                TimingKit& timingKit  //
+                TimingKit& timingKit,  //
+                bool noExtraTriggers  //
 ) {
     FileLine* const flp = netlistp->fileline();
 
+    // Neither the 'act' nor the 'nba' logic write what the 'act' triggers are computed from
+    const bool actSinglePass
+        = noExtraTriggers && convergesInOnePass(actKit.m_triggerComputep, {actKit.m_funcp});
+    const bool nbaSinglePass = actSinglePass && !netlistp->nbaEventp()
+                               && convergesInOnePass(actKit.m_triggerComputep, {nbaKit.m_funcp});
+
     // Create the active eval loop
     const EvalLoop actLoop = createEvalLoop(  //
-        netlistp, "act", "Active", /* slow: */ false, actKit.m_vscp, actKit.m_dumpp,
+        netlistp, "act", "Active", /* slow: */ false, actSinglePass, actKit.m_vscp, actKit.m_dumpp,
         // Inner loop statements
         nullptr,
         // Prep statements
@@ -1046,7 +1152,7 @@ void createEval(AstNetlist* netlistp,  //
             AstNodeStmt* const stmtsp = callVoidFunc(actKit.m_triggerComputep);
             // Commit trigger awaits from the previous iteration
             if (AstCCall* const commitp = timingKit.createCommit(netlistp)) {
-                stmtsp->addNext(commitp->makeStmt());
+                stmtsp->addNext(profRegion(flp, "timing commit", commitp->makeStmt()));
             }
             //
             return stmtsp;
@@ -1060,7 +1166,7 @@ void createEval(AstNetlist* netlistp,  //
             workp->addNext(createTriggerSetCall(flp, nbaKit.m_vscp, actKit.m_vscp));
             // Resume triggered timing schedulers
             if (AstCCall* const resumep = timingKit.createResume(netlistp)) {
-                workp->addNext(resumep->makeStmt());
+                workp->addNext(profRegion(flp, "timing resume", resumep->makeStmt()));
             }
             // Invoke the 'act' function
             workp->addNext(callVoidFunc(actKit.m_funcp));
@@ -1070,7 +1176,7 @@ void createEval(AstNetlist* netlistp,  //
 
     // Create the NBA eval loop, which is the default top level loop.
     EvalLoop topLoop = createEvalLoop(  //
-        netlistp, "nba", "NBA", /* slow: */ false, nbaKit.m_vscp, nbaKit.m_dumpp,
+        netlistp, "nba", "NBA", /* slow: */ false, nbaSinglePass, nbaKit.m_vscp, nbaKit.m_dumpp,
         // Inner loop statements
         actLoop.stmtsp,
         // Prep statements
@@ -1115,7 +1221,8 @@ void createEval(AstNetlist* netlistp,  //
     if (!obsKit.empty()) {
         // Create the Observed eval loop, which becomes the top level loop.
         topLoop = createEvalLoop(  //
-            netlistp, "obs", "Observed", /* slow: */ false, obsKit.m_vscp, obsKit.m_dumpp,
+            netlistp, "obs", "Observed", /* slow: */ false, /* singlePass: */ false, obsKit.m_vscp,
+            obsKit.m_dumpp,
             // Inner loop statements
             topLoop.stmtsp,
             // Prep statements
@@ -1139,7 +1246,8 @@ void createEval(AstNetlist* netlistp,  //
     if (!reactKit.empty()) {
         // Create the Reactive eval loop, which becomes the top level loop.
         topLoop = createEvalLoop(  //
-            netlistp, "react", "Reactive", /* slow: */ false, reactKit.m_vscp, reactKit.m_dumpp,
+            netlistp, "react", "Reactive", /* slow: */ false, /* singlePass: */ false,
+            reactKit.m_vscp, reactKit.m_dumpp,
             // Inner loop statements
             topLoop.stmtsp,
             // Prep statements
@@ -1172,6 +1280,67 @@ void createEval(AstNetlist* netlistp,  //
     if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPop(flp));
 }
 
+// Whether '_eval' can be straight-line code, without the usual iteration to convergence. This
+// is the case when only primary inputs can fire triggers, and the NBA region cannot change a
+// primary input, and there is no Active region logic, so a second iteration would never run.
+bool isStraightLineEval(AstNetlist* netlistp, const std::vector<const AstSenTree*>& senTreeps,
+                        const LogicClasses& logicClasses, const ExtraTriggers& extraTriggers,
+                        const EvalKit& actKit, const EvalKit& obsKit, const EvalKit& reactKit) {
+    if (!v3Global.opt.evalStraightLine()) return false;
+    if (v3Global.usesTiming() || netlistp->nbaEventp()) return false;
+    if (extraTriggers.size() || !obsKit.empty() || !reactKit.empty()) return false;
+    if (!logicClasses.m_hybrid.empty() || actKit.m_funcp->stmtsp()) return false;
+    std::unordered_set<const AstVarScope*> inputps;
+    for (const AstSenTree* const senTreep : senTreeps) {
+        for (const AstSenItem* itemp = senTreep->sensesp(); itemp;
+             itemp = VN_AS(itemp->nextp(), SenItem)) {
+            const AstNodeVarRef* const refp = itemp->varrefp();
+            if (!refp || !itemp->isClocked()) return false;
+            const AstVar* const varp = refp->varp();
+            if (!varp->isPrimaryIO() || varp->direction() != VDirection::INPUT) return false;
+            inputps.insert(refp->varScopep());
+        }
+    }
+    // Inputs are not normally written by the design, but check it is not via e.g. a force
+    const bool written = netlistp->exists([&](const AstVarRef* refp) {
+        return refp->access().isWriteOrRW() && inputps.count(refp->varScopep());
+    });
+    return !written;
+}
+
+// Create the straight-line '_eval' function, see isStraightLineEval
+void createStraightLineEval(AstNetlist* netlistp,  //
+                            AstNode* icoLoop,  //
+                            const EvalKit& actKit,  //
+                            const EvalKit& nbaKit,  //
+                            AstCFunc* postponedFuncp) {
+    FileLine* const flp = netlistp->fileline();
+
+    AstCFunc* const funcp = makeTopFunction(netlistp, "_eval", false);
+    netlistp->evalp(funcp);
+
+    if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPush(flp, "eval"));
+
+    // Start with the ico loop, if any
+    if (icoLoop) funcp->addStmtsp(icoLoop);
+
+    // Compute the 'act' triggers, which are directly the 'nba' triggers
+    funcp->addStmtsp(callVoidFunc(actKit.m_triggerComputep));
+    AstCMethodHard* const anyp
+        = new AstCMethodHard{flp, new AstVarRef{flp, actKit.m_vscp, VAccess::READ}, "any"};
+    anyp->dtypeSetBit();
+    AstIf* const ifp = new AstIf{flp, anyp};
+    ifp->addThensp(createTriggerSetCall(flp, nbaKit.m_vscp, actKit.m_vscp));
+    ifp->addThensp(callVoidFunc(nbaKit.m_funcp));
+    ifp->addThensp(createTriggerClearCall(flp, nbaKit.m_vscp));
+    funcp->addStmtsp(ifp);
+
+    // Add the Postponed eval call
+    if (postponedFuncp) funcp->addStmtsp(callVoidFunc(postponedFuncp));
+
+    if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPop(flp));
+}
+
 }  // namespace
 
 //============================================================================
@@ -1180,19 +1349,33 @@ void createEval(AstNetlist* netlistp,  //
 VirtIfaceTriggers::IfaceSensMap
 VirtIfaceTriggers::makeIfaceToSensMap(AstNetlist* const netlistp, size_t vifTriggerIndex,
                                       AstVarScope* trigVscp) const {
-    std::map<const AstIface*, AstSenTree*> ifaceToSensMap;
+    IfaceSensMap ifaceToSensMap;
     for (const auto& p : *this) {
-        ifaceToSensMap.emplace(
-            std::make_pair(p.first, createTriggerSenTree(netlistp, trigVscp, vifTriggerIndex)));
+        ifaceToSensMap[p.first.first].emplace_back(
+            p.first.second, createTriggerSenTree(netlistp, trigVscp, vifTriggerIndex));
         ++vifTriggerIndex;
     }
     return ifaceToSensMap;
 }
 
+void VirtIfaceTriggers::addSensitivities(const IfaceSensMap& map, const AstVarScope* vscp,
+                                         std::vector<AstSenTree*>& out) {
+    const AstVar* const varp = vscp->varp();
+    if (!varp->sensIfacep()) return;
+    const auto it = map.find(varp->sensIfacep());
+    if (it == map.end()) return;
+    // Reads through a virtual interface handle can see any member
+    const bool anyMember = VN_IS(varp->dtypep(), IfaceRefDType);
+    for (const auto& p : it->second) {
+        if (anyMember || p.first == varp) out.push_back(p.second);
+    }
+}
+
 //============================================================================
 // Top level entry-point to scheduling
 
 void schedule(AstNetlist* netlistp) {
+    const V3StatsTraceScope traceScope{"V3Sched::schedule"};
     const auto addSizeStat = [](const string& name, const LogicByScope& lbs) {
         uint64_t size = 0;
         lbs.foreachLogic([&](AstNode* nodep) { size += nodep->nodeCount(); });
@@ -1204,6 +1387,18 @@ void schedule(AstNetlist* netlistp) {
     const auto& virtIfaceTriggers = makeVirtIfaceTriggers(netlistp);
     // Prepare timing-related logic and external domains
     TimingKit timingKit = prepareTiming(netlistp);
+    if (v3Global.opt.stats() && v3Global.usesTiming()) {
+        const auto groups = independentTimingProcesses(netlistp);
+        size_t procs = 0;
+        size_t largest = 0;
+        for (const auto& group : groups) {
+            procs += group.size();
+            largest = std::max(largest, group.size());
+        }
+        V3Stats::addStat("Scheduling, timing, suspendable processes", procs);
+        V3Stats::addStat("Scheduling, timing, independent process groups", groups.size());
+        V3Stats::addStat("Scheduling, timing, largest process group", largest);
+    }
 
     // Step 1. Gather and classify all logic in the design
     LogicClasses logicClasses = gatherLogicClasses(netlistp);
@@ -1287,7 +1482,7 @@ void schedule(AstNetlist* netlistp) {
                                              : std::numeric_limits<unsigned>::max();
     const size_t firstVifTriggerIndex = extraTriggers.size();
     for (const auto& p : virtIfaceTriggers) {
-        extraTriggers.allocate("virtual interface: " + p.first->name());
+        extraTriggers.allocate(vifTriggerName(p.first));
     }
 
     const auto& senTreeps = getSenTreesUsedBy({&logicRegions.m_pre,  //
@@ -1366,10 +1561,7 @@ void schedule(AstNetlist* netlistp) {
             auto it = actTimingDomains.find(vscp);
             if (it != actTimingDomains.end()) out = it->second;
             if (vscp->varp()->isWrittenByDpi()) out.push_back(dpiExportTriggeredAct);
-            if (vscp->varp()->sensIfacep()) {
-                const auto sit = vifTriggeredAct.find(vscp->varp()->sensIfacep());
-                if (sit != vifTriggeredAct.end()) out.push_back(sit->second);
-            }
+            VirtIfaceTriggers::addSensitivities(vifTriggeredAct, vscp, out);
         });
     splitCheck(actFuncp);
     if (v3Global.opt.stats()) V3Stats::statsStage("sched-create-act");
@@ -1404,10 +1596,7 @@ void schedule(AstNetlist* netlistp) {
                 auto it = timingDomains.find(vscp);
                 if (it != timingDomains.end()) out = it->second;
                 if (vscp->varp()->isWrittenByDpi()) out.push_back(dpiExportTriggered);
-                if (vscp->varp()->sensIfacep()) {
-                    const auto sit = vifTriggered.find(vscp->varp()->sensIfacep());
-                    if (sit != vifTriggered.end()) out.push_back(sit->second);
-                }
+                VirtIfaceTriggers::addSensitivities(vifTriggered, vscp, out);
             });
 
         // Create the trigger dumping function, which is the same as act trigger
@@ -1457,8 +1646,14 @@ void schedule(AstNetlist* netlistp) {
     auto* const postponedFuncp = createPostponed(netlistp, logicClasses);
 
     // Step 14: Bolt it all together to create the '_eval' function
-    createEval(netlistp, icoLoopp, actKit, preTrigVscp, nbaKit, obsKit, reactKit, postponedFuncp,
-               timingKit);
+    if (isStraightLineEval(netlistp, senTreeps, logicClasses, extraTriggers, actKit, obsKit,
+                           reactKit)) {
+        createStraightLineEval(netlistp, icoLoopp, actKit, nbaKit, postponedFuncp);
+        V3Stats::addStat("Scheduling, straight-line eval", 1);
+    } else {
+        createEval(netlistp, icoLoopp, actKit, preTrigVscp, nbaKit, obsKit, reactKit,
+                   postponedFuncp, timingKit, extraTriggers.size() == 0);
+    }
 
     transformForks(netlistp);
 
@@ -153,9 +153,15 @@ public:
 };
 
 class VirtIfaceTriggers final {
-    using IfaceTrigger = std::pair<const AstIface*, AstVarScope*>;
+public:
+    // Interface type and member variable written
+    using IfaceMember = std::pair<const AstIface*, const AstVar*>;
+
+private:
+    using IfaceTrigger = std::pair<IfaceMember, AstVarScope*>;
     using IfaceTriggerVec = std::vector<IfaceTrigger>;
-    using IfaceSensMap = std::map<const AstIface*, AstSenTree*>;
+    using MemberSensVec = std::vector<std::pair<const AstVar*, AstSenTree*>>;
+    using IfaceSensMap = std::map<const AstIface*, MemberSensVec>;
     IfaceTriggerVec m_triggers;
 
 public:
@@ -164,6 +170,9 @@ public:
     IfaceTriggerVec::const_iterator end() const { return m_triggers.end(); }
     IfaceSensMap makeIfaceToSensMap(AstNetlist* netlistp, size_t vifTriggerIndex,
                                     AstVarScope* trigVscp) const;
+    // Add to 'out' the triggers from 'map' that logic reading 'vscp' is sensitive to
+    static void addSensitivities(const IfaceSensMap& map, const AstVarScope* vscp,
+                                 std::vector<AstSenTree*>& out);
     VL_UNCOPYABLE(VirtIfaceTriggers);
     VirtIfaceTriggers() = default;
     VirtIfaceTriggers(VirtIfaceTriggers&&) = default;
@@ -176,6 +185,11 @@ VirtIfaceTriggers makeVirtIfaceTriggers(AstNetlist* nodep) VL_MT_DISABLED;
 // Creates the timing kit and marks variables written by suspendables
 TimingKit prepareTiming(AstNetlist* const netlistp) VL_MT_DISABLED;
 
+// Groups suspendable processes such that processes in different groups share no variable
+// written by either, so could be resumed independently
+std::vector<std::vector<AstNodeProcedure*>>
+independentTimingProcesses(AstNetlist* netlistp) VL_MT_DISABLED;
+
 // Transforms fork sub-statements into separate functions
 void transformForks(AstNetlist* const netlistp) VL_MT_DISABLED;
 
@@ -36,11 +36,14 @@
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
 
 #include "V3Graph.h"
+#include "V3InstrCount.h"
 #include "V3Sched.h"
 #include "V3SenTree.h"
 #include "V3SplitVar.h"
 #include "V3Stats.h"
 
+#include <algorithm>
+#include <map>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -234,6 +237,174 @@ void resetEdgeWeights(const std::vector<SchedAcyclicVarVertex*>& cutVertices) {
     }
 }
 
+// Choose variables to cut so that the total cost of re-evaluating the logic reading them, which
+// becomes hybrid logic, is minimal. Each strongly connected component is solved on its own:
+// exactly by branch and bound if it has few variables, otherwise greedily by cutting the
+// cheapest variable on each remaining cycle, then un-cutting any that turned out redundant.
+// Variables marked isolate_assignments are preferred as they cost nothing. Cut variables get
+// zero weight on their edges, as V3Graph::acyclic would give the edges it cuts.
+class MinCostCutter final {
+    // Largest number of variables in a component to solve exactly
+    static constexpr size_t EXACT_LIMIT = 12;
+
+    // STATE - for the current component, indexed by vertex user() - 1
+    std::vector<V3GraphVertex*> m_vtxps;  // The vertices
+    std::vector<std::vector<size_t>> m_succs;  // Successors within the component
+    std::vector<uint8_t> m_cut;  // Whether variable is cut
+    std::vector<uint8_t> m_state;  // DFS state: 0 unvisited, 1 on stack, 2 done
+    std::vector<size_t> m_varIdxs;  // Indices of the variable vertices
+    std::vector<uint64_t> m_cost;  // Cost of cutting each variable
+    // Exact search
+    std::vector<uint8_t> m_bestCut;  // Cheapest cut found so far
+    uint64_t m_bestCost = 0;  // Cost of m_bestCut
+    // Other
+    std::unordered_map<const AstNode*, uint32_t> m_logicCost;  // Cached instruction counts
+    uint64_t m_totalCost = 0;  // Cost of all cuts made
+
+    uint64_t cutCost(const SchedAcyclicVarVertex* vvtxp) {
+        if (vvtxp->varp()->attrIsolateAssign()) return 0;
+        uint64_t cost = 0;
+        for (const V3GraphEdge& edge : vvtxp->outEdges()) {
+            AstNode* const logicp = edge.top()->as<SchedAcyclicLogicVertex>()->logicp();
+            const auto pair = m_logicCost.emplace(logicp, 0);
+            if (pair.second) pair.first->second = V3InstrCount::count(logicp, false) + 1;
+            cost += pair.first->second;
+        }
+        return cost;
+    }
+
+    // Find a cycle in the component with the current cuts. Returns the indices of the variables
+    // on it, or empty if there are no cycles left.
+    std::vector<size_t> findCycle() {
+        std::fill(m_state.begin(), m_state.end(), 0);
+        std::vector<std::pair<size_t, size_t>> path;  // Vertex index, next successor to visit
+        for (size_t root = 0; root < m_vtxps.size(); ++root) {
+            if (m_state[root]) continue;
+            m_state[root] = 1;
+            path.emplace_back(root, 0);
+            while (!path.empty()) {
+                const size_t idx = path.back().first;
+                const std::vector<size_t>& succs = m_succs[idx];
+                if (m_cut[idx] || path.back().second == succs.size()) {
+                    m_state[idx] = 2;
+                    path.pop_back();
+                    continue;
+                }
+                const size_t topIdx = succs[path.back().second++];
+                if (m_state[topIdx] == 1) {
+                    // Back edge, the cycle is the path from 'topIdx'
+                    std::vector<size_t> cycle;
+                    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+                        if (m_vtxps[it->first]->is<SchedAcyclicVarVertex>()) {
+                            cycle.push_back(it->first);
+                        }
+                        if (it->first == topIdx) break;
+                    }
+                    return cycle;
+                }
+                if (m_state[topIdx]) continue;
+                m_state[topIdx] = 1;
+                path.emplace_back(topIdx, 0);
+            }
+        }
+        return {};
+    }
+
+    void searchExact(size_t i, uint64_t cost) {
+        if (cost >= m_bestCost) return;
+        if (findCycle().empty()) {
+            m_bestCost = cost;
+            m_bestCut = m_cut;
+            return;
+        }
+        if (i == m_varIdxs.size()) return;
+        const size_t idx = m_varIdxs[i];
+        m_cut[idx] = 1;
+        searchExact(i + 1, cost + m_cost[idx]);
+        m_cut[idx] = 0;
+        searchExact(i + 1, cost);
+    }
+
+    void solveGreedy() {
+        // Cut the cheapest variable on each cycle until none remain
+        for (std::vector<size_t> cycle = findCycle(); !cycle.empty(); cycle = findCycle()) {
+            const size_t idx = *std::min_element(cycle.begin(), cycle.end(),
+                                                 [&](size_t a, size_t b) {  //
+                                                     return m_cost[a] < m_cost[b];
+                                                 });
+            m_cut[idx] = 1;
+        }
+        // Un-cut the most expensive variables first, if not needed to break a cycle
+        std::vector<size_t> cutIdxs;
+        for (const size_t idx : m_varIdxs) {
+            if (m_cut[idx]) cutIdxs.push_back(idx);
+        }
+        std::stable_sort(cutIdxs.begin(), cutIdxs.end(),
+                         [&](size_t a, size_t b) { return m_cost[a] > m_cost[b]; });
+        for (const size_t idx : cutIdxs) {
+            m_cut[idx] = 0;
+            if (!findCycle().empty()) m_cut[idx] = 1;
+        }
+    }
+
+    void solve(const std::vector<V3GraphVertex*>& vtxps) {
+        m_vtxps = vtxps;
+        m_cut.assign(vtxps.size(), 0);
+        m_state.assign(vtxps.size(), 0);
+        m_cost.assign(vtxps.size(), 0);
+        m_varIdxs.clear();
+        for (size_t idx = 0; idx < vtxps.size(); ++idx) {
+            vtxps[idx]->user(static_cast<uint32_t>(idx + 1));
+        }
+        m_succs.assign(vtxps.size(), {});
+        for (size_t idx = 0; idx < vtxps.size(); ++idx) {
+            for (const V3GraphEdge& edge : vtxps[idx]->outEdges()) {
+                if (const uint32_t user = edge.top()->user()) m_succs[idx].push_back(user - 1);
+            }
+            const SchedAcyclicVarVertex* const vvtxp = vtxps[idx]->cast<SchedAcyclicVarVertex>();
+            if (!vvtxp) continue;
+            m_varIdxs.push_back(idx);
+            m_cost[idx] = cutCost(vvtxp);
+        }
+        if (m_varIdxs.size() <= EXACT_LIMIT) {
+            // Start from cutting everything, which always works
+            m_bestCut.assign(vtxps.size(), 0);
+            m_bestCost = 1;
+            for (const size_t idx : m_varIdxs) {
+                m_bestCut[idx] = 1;
+                m_bestCost += m_cost[idx];
+            }
+            // Try cheapest first, to find good bounds early
+            std::stable_sort(m_varIdxs.begin(), m_varIdxs.end(),
+                             [&](size_t a, size_t b) { return m_cost[a] < m_cost[b]; });
+            searchExact(0, 0);
+            m_cut = m_bestCut;
+        } else {
+            solveGreedy();
+        }
+        for (size_t idx = 0; idx < vtxps.size(); ++idx) {
+            vtxps[idx]->user(0);
+            if (!m_cut[idx]) continue;
+            m_totalCost += m_cost[idx];
+            for (V3GraphEdge& edge : vtxps[idx]->inEdges()) edge.weight(0);
+            for (V3GraphEdge& edge : vtxps[idx]->outEdges()) edge.weight(0);
+        }
+    }
+
+public:
+    explicit MinCostCutter(Graph* graphp) {
+        // Color the strongly connected components, also used by reportCycles
+        graphp->stronglyConnected(&V3GraphEdge::followAlwaysTrue);
+        graphp->userClearVertices();
+        std::map<uint32_t, std::vector<V3GraphVertex*>> components;
+        for (V3GraphVertex& vtx : graphp->vertices()) {
+            if (vtx.color()) components[vtx.color()].push_back(&vtx);
+        }
+        for (const auto& pair : components) solve(pair.second);
+        V3Stats::addStat("Scheduling, UNOPTFLAT cut cost", m_totalCost);
+    }
+};
+
 // A VarVertex together with its fanout
 using Candidate = std::pair<SchedAcyclicVarVertex*, unsigned>;
 
@@ -420,10 +591,14 @@ LogicByScope breakCycles(AstNetlist* netlistp, const LogicByScope& combinational
     if (dumpGraphLevel() >= 6) graphp->dumpDotFilePrefixed("sched-comb-cycles");
 
     // Make graph acyclic by cutting some edges. Note: This also colors strongly connected
-    // components which reportCycles uses to print each SCCs separately.
-    // TODO: A more optimal algorithm that cuts by removing/marking VarVertex vertices is possible
-    //       Search for "Feedback vertex set" (current algorithm is "Feedback arc set")
-    graphp->acyclic(&V3GraphEdge::followAlwaysTrue);
+    // components which reportCycles uses to print each SCCs separately. By default this finds a
+    // small "Feedback arc set", with --unoptflat-min-cost a "Feedback vertex set" of variables
+    // weighted by the cost of the logic re-evaluated.
+    if (v3Global.opt.unoptflatMinCost()) {
+        const MinCostCutter cutter{graphp.get()};
+    } else {
+        graphp->acyclic(&V3GraphEdge::followAlwaysTrue);
+    }
 
     // Find all cut vertices
     const std::vector<SchedAcyclicVarVertex*> cutVertices = findCutVertices(graphp.get());
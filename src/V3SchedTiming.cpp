@@ -30,6 +30,7 @@
 #include "V3Sched.h"
 
 #include <unordered_map>
+#include <unordered_set>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -268,6 +269,118 @@ TimingKit prepareTiming(AstNetlist* const netlistp) {
     return {std::move(lbs), postUpdates, std::move(externalDomains)};
 }
 
+//============================================================================
+// Groups suspendable processes that share no variable written by one of them
+
+std::vector<std::vector<AstNodeProcedure*>> independentTimingProcesses(AstNetlist* netlistp) {
+    // Variables accessed by a process, including in the functions it calls
+    struct Accesses final {
+        std::unordered_set<const AstVarScope*> m_reads;
+        std::unordered_set<const AstVarScope*> m_writes;
+        bool m_opaque = false;  // Has effects not attributable to variables (classes, DPI, ...)
+    };
+    class AccessVisitor final : public VNVisitorConst {
+        // STATE
+        Accesses& m_accesses;  // Accesses of the process being visited
+        std::unordered_set<const AstCFunc*> m_visitedFuncs;  // Functions already visited
+
+        // VISITORS
+        void visit(AstNodeVarRef* nodep) override {
+            const AstVarScope* const vscp = nodep->varScopep();
+            if (!vscp || nodep->varp()->isFuncLocal()) return;  // Local to the call
+            // Scheduler queues are shared by design, they are not process data
+            if (const AstBasicDType* const basicp = nodep->varp()->dtypep()->basicp()) {
+                if (basicp->isDelayScheduler() || basicp->isTriggerScheduler()
+                    || basicp->isDynamicTriggerScheduler())
+                    return;
+            }
+            if (nodep->access().isWriteOrRW()) m_accesses.m_writes.insert(vscp);
+            if (nodep->access().isReadOrRW()) m_accesses.m_reads.insert(vscp);
+        }
+        void visit(AstCAwait* nodep) override {
+            if (AstSenTree* const sensesp = nodep->sensesp()) iterateConst(sensesp);
+            iterateChildrenConst(nodep);
+        }
+        void visit(AstNodeCCall* nodep) override {
+            iterateChildrenConst(nodep);
+            AstCFunc* const funcp = nodep->funcp();
+            if (funcp->dpiImportPrototype() || funcp->dpiImportWrapper()) {
+                m_accesses.m_opaque = true;
+            } else if (m_visitedFuncs.insert(funcp).second) {
+                iterateConst(funcp);
+            }
+        }
+        // Object members are not tracked per object, and output must stay in order
+        void visit(AstCMethodCall* nodep) override { m_accesses.m_opaque = true; }
+        void visit(AstCNew* nodep) override { m_accesses.m_opaque = true; }
+        void visit(AstMemberSel* nodep) override { m_accesses.m_opaque = true; }
+        void visit(AstDisplay* nodep) override { m_accesses.m_opaque = true; }
+        void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+    public:
+        // CONSTRUCTORS
+        AccessVisitor(AstNodeProcedure* nodep, Accesses& accesses)
+            : m_accesses{accesses} {
+            iterateConst(nodep);
+        }
+        ~AccessVisitor() override = default;
+    };
+
+    std::vector<AstNodeProcedure*> procps;
+    netlistp->foreach([&](AstNodeProcedure* procp) {
+        if (procp->isSuspendable()) procps.push_back(procp);
+    });
+    std::vector<Accesses> accesses(procps.size());
+    for (size_t i = 0; i < procps.size(); ++i) AccessVisitor{procps[i], accesses[i]};
+
+    // Union-find over process indices
+    std::vector<size_t> parents(procps.size());
+    for (size_t i = 0; i < parents.size(); ++i) parents[i] = i;
+    const auto findRoot = [&](size_t i) {
+        while (parents[i] != i) i = parents[i] = parents[parents[i]];
+        return i;
+    };
+    const auto unite = [&](size_t a, size_t b) { parents[findRoot(a)] = findRoot(b); };
+
+    // Processes writing the same variable, or reading what another writes, are dependent.
+    // Processes which are opaque are all dependent on each other.
+    std::unordered_map<const AstVarScope*, size_t> writers;
+    constexpr size_t NONE = ~static_cast<size_t>(0);
+    size_t opaque = NONE;
+    for (size_t i = 0; i < procps.size(); ++i) {
+        for (const AstVarScope* const vscp : accesses[i].m_writes) {
+            const auto pair = writers.emplace(vscp, i);
+            if (!pair.second) unite(i, pair.first->second);
+        }
+        if (accesses[i].m_opaque) {
+            if (opaque != NONE) unite(i, opaque);
+            opaque = i;
+        }
+    }
+    for (size_t i = 0; i < procps.size(); ++i) {
+        for (const AstVarScope* const vscp : accesses[i].m_reads) {
+            const auto it = writers.find(vscp);
+            if (it != writers.end()) unite(i, it->second);
+        }
+    }
+
+    // Gather groups, in process order
+    std::vector<std::vector<AstNodeProcedure*>> groups;
+    std::unordered_map<size_t, size_t> rootGroups;  // Root process index -> index in groups
+    for (size_t i = 0; i < procps.size(); ++i) {
+        const auto pair = rootGroups.emplace(findRoot(i), groups.size());
+        if (pair.second) groups.emplace_back();
+        groups[pair.first->second].push_back(procps[i]);
+    }
+    if (debug() >= 5) {
+        for (const auto& group : groups) {
+            UINFO(5, "Independent timing process group, " << group.size() << " processes");
+            for (const AstNodeProcedure* const procp : group) UINFO(5, "  " << procp);
+        }
+    }
+    return groups;
+}
+
 //============================================================================
 // Visits all forks and transforms their sub-statements into separate functions.
 
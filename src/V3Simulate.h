@@ -142,6 +142,10 @@ private:
     std::unordered_map<const AstNodeDType*, ConstAllocator> m_constps;
     size_t m_constGeneration = 0;
     std::vector<SimStackNode*> m_callStack;  ///< Call stack for verbose error messages
+    // Constant function results, keyed by function and argument values, held for the visitor's
+    // lifetime so repeated calls with the same arguments in one elaboration are evaluated once
+    std::unordered_map<const AstNodeFTask*, bool> m_funcPure;  // Function is safe to memoize
+    std::unordered_map<string, V3Number> m_funcMemo;  // Key is function and argument values
 
     // Cleanup
     // V3Numbers that represents strings are a bit special and the API for
@@ -1069,6 +1073,26 @@ private:
         }
     }
 
+    bool funcPure(const AstNodeFTask* funcp) {
+        // Result depends only on argument values, and there are no messages to repeat
+        const auto pair = m_funcPure.emplace(funcp, false);
+        if (!pair.second) return pair.first->second;
+        bool pure = true;
+        funcp->foreach([&](const AstNode* nodep) {
+            if (!pure) return;
+            if (VN_IS(nodep, Display) || VN_IS(nodep, Stop) || VN_IS(nodep, Finish)) {
+                pure = false;
+            } else if (const AstNodeFTaskRef* const refp = VN_CAST(nodep, NodeFTaskRef)) {
+                pure = refp->taskp() && funcPure(refp->taskp());
+            } else if (const AstVarRef* const refp = VN_CAST(nodep, VarRef)) {
+                // Other variables may hold different values between calls
+                pure = refp->varp()->isParam() || refp->varp()->isFuncLocal();
+            }
+        });
+        m_funcPure[funcp] = pure;
+        return pure;
+    }
+
     void visit(AstFuncRef* nodep) override {
         if (jumpingOver(nodep)) return;
         if (!optimizable()) return;  // Accelerate
@@ -1109,6 +1133,28 @@ private:
                 iterateConst(pinp);
             }
         }
+        string memoKey;
+        if (!m_checkOnly && optimizable() && funcPure(funcp)) {
+            memoKey = cvtToHex(funcp);
+            for (const auto& itr : tconnects) {
+                AstNode* const pinp = itr.second->exprp();
+                const AstConst* const valuep = pinp ? fetchConstNull(pinp) : nullptr;
+                if (pinp && !valuep) {
+                    memoKey.clear();
+                    break;
+                }
+                memoKey += valuep ? " " + valuep->num().ascii() : " -";
+            }
+        }
+        if (!memoKey.empty()) {
+            const auto it = m_funcMemo.find(memoKey);
+            if (it != m_funcMemo.end()) {
+                UINFO(5, "   FUNCREF memoized " << memoKey);
+                AstConst cnst{nodep->fileline(), it->second};
+                newValue(nodep, &cnst);
+                return;
+            }
+        }
         for (V3TaskConnects::iterator it = tconnects.begin(); it != tconnects.end(); ++it) {
             AstVar* const portp = it->first;
             AstNode* const pinp = it->second->exprp();
@@ -1137,7 +1183,13 @@ private:
         if (!m_checkOnly && optimizable()) {
             // Grab return value from output variable (if it's a function)
             UASSERT_OBJ(funcp->fvarp(), nodep, "Function reference points at non-function");
-            newValue(nodep, fetchValue(funcp->fvarp()));
+            AstNodeExpr* const resultp = fetchValue(funcp->fvarp());
+            newValue(nodep, resultp);
+            if (!memoKey.empty()) {
+                if (const AstConst* const constp = VN_CAST(resultp, Const)) {
+                    m_funcMemo.emplace(memoKey, constp->num());
+                }
+            }
         }
     }
 
@@ -75,21 +75,41 @@
 //
 //  Also vars must not be "public" and we also scoreboard nodep->isPure()
 //
+// With --prof-pgo, each split block counts how often the original always
+// and each if/else branch in it executed.  When that profile is read back,
+// a branch taken in under 1/SPLIT_PGO_COLD_RATIO of the always's
+// executions is cold.  Split blocks holding only statements from cold
+// branches are merged into one block, while split blocks with any hot
+// statement stay separate, so rarely run logic does not add vertices for
+// V3OrderParallel to balance.
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
 
 #include "V3Split.h"
 
+#include "V3Control.h"
 #include "V3Graph.h"
+#include "V3Hash.h"
 #include "V3Stats.h"
 
+#include <algorithm>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+// A profiled branch taken in under 1/ratio of its always's executions is cold
+constexpr uint64_t SPLIT_PGO_COLD_RATIO = 100;
+
+static std::vector<std::string>& splitPgoCountKeys() {
+    static std::vector<std::string> s_keys;  // Keys of --prof-pgo counts, by count number
+    return s_keys;
+}
+
 //######################################################################
 // Support classes
 
@@ -684,16 +704,20 @@ class EmitSplitVisitor final : public VNVisitor {
     std::unordered_map<uint32_t, AstNode*> m_addAfter;
 
     AlwaysVec* const m_newBlocksp;  // Split always blocks we have generated
+    const string m_pgoKey;  // Profile key of the always, empty to not count executions
+    int m_ifNum = 0;  // Number of the next if-statement, for profile keys
 
     // CONSTRUCTORS
 public:
     // EmitSplitVisitor visits through always block *nodep
     // and generates its split blocks, writing the split blocks
     // into *newBlocksp.
-    EmitSplitVisitor(AstAlways* nodep, const IfColorVisitor* ifColorp, AlwaysVec* newBlocksp)
+    EmitSplitVisitor(AstAlways* nodep, const IfColorVisitor* ifColorp, AlwaysVec* newBlocksp,
+                     const string& pgoKey)
         : m_origAlwaysp{nodep}
         , m_ifColorp{ifColorp}
-        , m_newBlocksp{newBlocksp} {
+        , m_newBlocksp{newBlocksp}
+        , m_pgoKey{pgoKey} {
         UINFO(6, "  splitting always " << nodep);
     }
 
@@ -715,6 +739,7 @@ public:
             m_addAfter[color] = placeholderp;
             m_newBlocksp->push_back(alwaysp);
         }
+        if (!m_pgoKey.empty()) addCount(colors, m_pgoKey);
         // Scan the body of the always. We'll handle if/else
         // specially, everything else is a leaf node that we can
         // just clone into one of the split always blocks.
@@ -725,6 +750,17 @@ protected:
     AstSplitPlaceholder* makePlaceholderp() {
         return new AstSplitPlaceholder{m_origAlwaysp->fileline()};
     }
+    void addCount(const ColorSet& colors, const string& key) {
+        // Every split block runs whenever the original would, so count in just one of them
+        const uint32_t color = *std::min_element(colors.begin(), colors.end());
+        const size_t count = splitPgoCountKeys().size();
+        splitPgoCountKeys().push_back(key);
+        AstCStmt* const countp = new AstCStmt{
+            m_origAlwaysp->fileline(),
+            "vlSymsp->_vm_pgoProfiler.incCount(" + std::to_string(count) + ");\n"};
+        m_addAfter[color]->addNextHere(countp);
+        m_addAfter[color] = countp;
+    }
 
     void visit(AstNode* nodep) override {
         // Anything that's not an if/else we assume is a leaf
@@ -750,6 +786,8 @@ protected:
 
     void visit(AstNodeIf* nodep) override {
         const ColorSet& colors = m_ifColorp->colors(nodep);
+        const string key = m_pgoKey.empty() ? "" : m_pgoKey + "_" + cvtToStr(m_ifNum);
+        ++m_ifNum;
         using CloneMap = std::unordered_map<uint32_t, AstNodeIf*>;
         CloneMap clones;
 
@@ -774,10 +812,12 @@ protected:
             m_addAfter[color] = if_placeholderp;
         }
 
+        if (!key.empty() && nodep->thensp()) addCount(colors, key + "t");
         iterateAndNextNull(nodep->thensp());
 
         for (const auto& color : colors) m_addAfter[color] = clones[color]->elsesp();
 
+        if (!key.empty() && nodep->elsesp()) addCount(colors, key + "e");
         iterateAndNextNull(nodep->elsesp());
 
         for (const auto& color : colors) m_addAfter[color] = clones[color];
@@ -847,7 +887,9 @@ class SplitVisitor final : public SplitReorderBaseVisitor {
 
     // AstNodeIf* whose condition we're currently visiting
     const AstNode* m_curIfConditional = nullptr;
+    const AstScope* m_scopep = nullptr;  // Current scope
     VDouble0 m_statSplits;  // Statistic tracking
+    VDouble0 m_statColdMerged;  // Statistic tracking
 
     // CONSTRUCTORS
 public:
@@ -870,7 +912,10 @@ public:
         }
     }
 
-    ~SplitVisitor() override { V3Stats::addStat("Optimizations, Split always", m_statSplits); }
+    ~SplitVisitor() override {
+        V3Stats::addStat("Optimizations, Split always", m_statSplits);
+        V3Stats::addStat("Optimizations, Split always cold blocks merged", m_statColdMerged);
+    }
 
     // METHODS
 protected:
@@ -884,6 +929,68 @@ protected:
         }
     }
 
+    string pgoKey(const AstAlways* nodep) const {
+        // Same key in the profiling and the optimizing run, as long as the design is unchanged
+        if (!m_scopep) return "";
+        return "split_" + V3Hash{m_scopep->name() + " " + nodep->fileline()->ascii()}.toString();
+    }
+
+    void findColdStatements(AstNode* stmtsp, const string& key, uint64_t alwaysCount,
+                            bool cold, int& ifNum,
+                            std::unordered_set<const SplitLogicVertex*>& coldps) {
+        // Find statements under a cold branch. Walks ifs in EmitSplitVisitor's order.
+        for (AstNode* stmtp = stmtsp; stmtp; stmtp = stmtp->nextp()) {
+            const SplitLogicVertex* const vxp
+                = reinterpret_cast<SplitLogicVertex*>(stmtp->user3p());
+            if (cold && vxp) coldps.insert(vxp);
+            AstNodeIf* const ifp = VN_CAST(stmtp, NodeIf);
+            if (!ifp) continue;
+            const string ifKey = key + "_" + cvtToStr(ifNum);
+            ++ifNum;
+            for (AstNode* const branchp : {ifp->thensp(), ifp->elsesp()}) {
+                if (!branchp) continue;
+                bool branchCold = cold;
+                if (!branchCold) {
+                    const string branchKey = ifKey + (branchp == ifp->thensp() ? "t" : "e");
+                    const uint64_t count
+                        = V3Control::getProfileData(v3Global.opt.prefix(), branchKey);
+                    branchCold = count && count * SPLIT_PGO_COLD_RATIO < alwaysCount;
+                    if (branchCold) UINFO(6, "  Cold branch " << branchKey << " count " << count);
+                }
+                findColdStatements(branchp, key, alwaysCount, branchCold, ifNum, coldps);
+            }
+        }
+    }
+
+    void mergeColdColors(AstAlways* nodep, const string& key) {
+        // A color with only statements from cold branches would become a block
+        // that rarely does anything, so give all such colors the same color.
+        const uint64_t alwaysCount
+            = key.empty() ? 0 : V3Control::getProfileData(v3Global.opt.prefix(), key);
+        if (!alwaysCount) return;
+        std::unordered_set<const SplitLogicVertex*> coldps;
+        int ifNum = 0;
+        findColdStatements(nodep->stmtsp(), key, alwaysCount, false, ifNum, coldps);
+        if (coldps.empty()) return;
+        std::map<uint32_t, bool> colorCold;  // Color -> all of its statements are cold
+        for (const V3GraphVertex& vertex : m_graph.vertices()) {
+            const SplitLogicVertex* const logicp = vertex.cast<const SplitLogicVertex>();
+            if (!logicp) continue;
+            const auto pair = colorCold.emplace(logicp->color(), true);
+            pair.first->second = pair.first->second && coldps.count(logicp);
+        }
+        ColorSet coldColors;
+        for (const auto& pair : colorCold) {
+            if (pair.second) coldColors.insert(pair.first);
+        }
+        if (coldColors.size() < 2) return;
+        const uint32_t mergedColor = *std::min_element(coldColors.begin(), coldColors.end());
+        for (V3GraphVertex& vertex : m_graph.vertices()) {
+            if (coldColors.count(vertex.color())) vertex.color(mergedColor);
+        }
+        m_statColdMerged += coldColors.size() - 1;
+    }
+
     void colorAlwaysGraph() {
         // Color the graph to indicate subsets, each of which
         // we can split into its own always block.
@@ -964,6 +1071,8 @@ protected:
         // and color regions that must be kept together.
         UINFO(5, "SplitVisitor @ " << nodep);
         colorAlwaysGraph();
+        const string key = pgoKey(nodep);
+        mergeColdColors(nodep, key);
 
         // Map each AstNodeIf to the set of colors (split always blocks)
         // it must participate in. Also find the whole set of colors.
@@ -977,10 +1086,16 @@ protected:
 
             // Visit through the original always block one more time,
             // and emit the split always blocks into m_replaceBlocks:
-            EmitSplitVisitor emitSplit{nodep, &ifColor, &(m_replaceBlocks[nodep])};
+            EmitSplitVisitor emitSplit{nodep, &ifColor, &(m_replaceBlocks[nodep]),
+                                       v3Global.opt.profPgo() ? key : ""};
             emitSplit.go();
         }
     }
+    void visit(AstScope* nodep) override {
+        VL_RESTORER(m_scopep);
+        m_scopep = nodep;
+        iterateChildren(nodep);
+    }
     void visit(AstNodeIf* nodep) override {
         UINFO(4, "     IF " << nodep);
         if (!nodep->condp()->isPure()) m_noReorderWhy = "Impure IF condition";
@@ -1005,6 +1120,7 @@ void V3Split::splitReorderAll(AstNetlist* nodep) {
     { ReorderVisitor{nodep}; }  // Destruct before checking
     V3Global::dumpCheckGlobalTree("reorder", 0, dumpTreeEitherLevel() >= 3);
 }
+const std::vector<std::string>& V3Split::pgoCountKeys() { return splitPgoCountKeys(); }
 void V3Split::splitAlwaysAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     { SplitVisitor{nodep}; }  // Destruct before checking
@@ -20,6 +20,9 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <string>
+#include <vector>
+
 class AstNetlist;
 
 //============================================================================
@@ -28,6 +31,8 @@ class V3Split final {
 public:
     static void splitReorderAll(AstNetlist* nodep) VL_MT_DISABLED;
     static void splitAlwaysAll(AstNetlist* nodep) VL_MT_DISABLED;
+    // Keys of the --prof-pgo execution counts added by splitAlwaysAll, by count number
+    static const std::vector<std::string>& pgoCountKeys() VL_MT_DISABLED;
 };
 
 #endif  // Guard
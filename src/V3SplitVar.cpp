@@ -84,7 +84,20 @@
 //     end
 //
 //
-// Two visitor classes are defined here, SplitUnpackedVarVisitor and SplitPackedVarVisitor.
+// Unpacked arrays of unpacked structs that are only accessed one member of one element at a time
+// are first split by SplitStructArrayVisitor into an array per member (structure of arrays), so
+// loops over one member of a large table only touch that member's storage.
+//
+//     // Original
+//     entry_t table[0:65535] /*verilator split_var*/;
+//     ... table[idx].valid ...
+//
+//  is converted to
+//
+//     logic table__DOT__valid[0:65535];
+//     ... table__DOT__valid[idx] ...
+//
+// Two more visitor classes are defined here, SplitUnpackedVarVisitor and SplitPackedVarVisitor.
 //
 // - SplitUnpackedVarVisitor class splits unpacked arrays. ( 1) in the explanation above.)
 //   "unpacked_array_var" in the example above is a target of the class.
@@ -233,6 +246,121 @@ static void warnNoSplit(const AstVar* varp, const AstNode* wherep, const char* r
                                  << reasonp << ".\n");
 }
 
+//######################################################################
+// Split unpacked arrays of unpacked structs into an array per member
+
+class SplitStructArrayVisitor final : public VNVisitor {
+    // STATE
+    // Candidate variables, and the member selects that reference them
+    std::unordered_map<AstVar*, std::vector<AstStructSel*>> m_candidates;
+    std::vector<AstVar*> m_candidateOrder;  // Candidates in declaration order
+    std::unordered_set<AstVar*> m_rejected;  // Candidates with a reference that is not a member
+    std::unordered_set<AstVar*> m_dynamicIndex;  // Candidates with a non-constant element index
+    size_t m_numSplit = 0;  // Statistic tracking
+
+    static const AstStructDType* memberStructp(const AstVar* varp) {
+        const AstUnpackArrayDType* const adtypep
+            = VN_CAST(varp->dtypep()->skipRefp(), UnpackArrayDType);
+        if (!adtypep) return nullptr;
+        const AstStructDType* const sdtypep = VN_CAST(adtypep->subDTypep()->skipRefp(), StructDType);
+        if (!sdtypep || sdtypep->packed()) return nullptr;
+        for (const AstMemberDType* memberp = sdtypep->membersp(); memberp;
+             memberp = VN_AS(memberp->nextp(), MemberDType)) {
+            if (memberp->valuep()) return nullptr;  // Default member values are not split
+        }
+        return sdtypep;
+    }
+
+    void split(AstVar* varp, const std::vector<AstStructSel*>& selps) {
+        UINFO(4, "Split into member arrays: " << varp);
+        const AstUnpackArrayDType* const adtypep
+            = VN_AS(varp->dtypep()->skipRefp(), UnpackArrayDType);
+        FileLine* const flp = varp->fileline();
+        std::map<std::string, AstVar*> memberVars;
+        AstNode* insertp = varp;
+        for (const AstMemberDType* memberp = memberStructp(varp)->membersp(); memberp;
+             memberp = VN_AS(memberp->nextp(), MemberDType)) {
+            AstNodeDType* const subDTypep = memberp->subDTypep();
+            AstUnpackArrayDType* const dtypep = new AstUnpackArrayDType{
+                flp, subDTypep, new AstRange{flp, adtypep->declRange()}};
+            dtypep->isCompound(subDTypep->skipRefp()->isCompound());
+            v3Global.rootp()->typeTablep()->addTypesp(dtypep);
+            // Traced as members of a scope with the array's name
+            const std::string name = varp->name() + "__DOT__" + memberp->name();
+            AstVar* const newp = new AstVar{flp, VVarType::VAR, name, dtypep};
+            newp->propagateAttrFrom(varp);
+            newp->trace(varp->isTrace());
+            newp->funcLocal(varp->isFuncLocal());
+            newp->lifetime(varp->lifetime());
+            insertp->addNextHere(newp);
+            insertp = newp;
+            memberVars.emplace(memberp->name(), newp);
+        }
+        for (AstStructSel* const selp : selps) {
+            AstArraySel* const aselp = VN_AS(selp->fromp(), ArraySel);
+            const AstVarRef* const refp = VN_AS(aselp->fromp(), VarRef);
+            AstVar* const memberVarp = memberVars.at(selp->name());
+            AstNodeExpr* const newp = new AstArraySel{
+                selp->fileline(), new AstVarRef{refp->fileline(), memberVarp, refp->access()},
+                aselp->bitp()->unlinkFrBack()};
+            selp->replaceWith(newp);
+            VL_DO_DANGLING(pushDeletep(selp), selp);
+        }
+        VL_DO_DANGLING(pushDeletep(varp->unlinkFrBack()), varp);
+        ++m_numSplit;
+    }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        if (!VN_IS(nodep, Module)) return;
+        UASSERT_OBJ(m_candidates.empty(), nodep, "Nested module declaration");
+        iterateChildren(nodep);
+        for (AstVar* const varp : m_candidateOrder) {
+            // Arrays indexed only by constants are split by element instead
+            if (m_rejected.count(varp) || !m_dynamicIndex.count(varp)) continue;
+            split(varp, m_candidates[varp]);
+        }
+        m_candidates.clear();
+        m_candidateOrder.clear();
+        m_rejected.clear();
+        m_dynamicIndex.clear();
+        doDeletes();
+    }
+    void visit(AstNodeFTask* nodep) override {
+        if (!SplitVarImpl::cannotSplitTaskReason(nodep)) iterateChildren(nodep);
+    }
+    void visit(AstVar* nodep) override {
+        if (!nodep->attrSplitVar() || nodep->isIO() || nodep->valuep()) return;
+        if (!memberStructp(nodep) || SplitVarImpl::cannotSplitVarCommonReason(nodep)) return;
+        m_candidates.emplace(nodep, std::vector<AstStructSel*>{});
+        m_candidateOrder.push_back(nodep);
+    }
+    void visit(AstVarRef* nodep) override {
+        const auto it = m_candidates.find(nodep->varp());
+        if (it == m_candidates.end()) return;
+        AstArraySel* const aselp = VN_CAST(nodep->firstAbovep(), ArraySel);
+        AstStructSel* const selp = aselp ? VN_CAST(aselp->firstAbovep(), StructSel) : nullptr;
+        if (!selp || aselp->fromp() != nodep || selp->fromp() != aselp) {
+            m_rejected.emplace(nodep->varp());
+            return;
+        }
+        if (!VN_IS(aselp->bitp(), Const)) m_dynamicIndex.emplace(nodep->varp());
+        it->second.push_back(selp);
+    }
+    void visit(AstVarXRef* nodep) override {
+        if (nodep->varp()) m_rejected.emplace(nodep->varp());
+        iterateChildren(nodep);
+    }
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit SplitStructArrayVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~SplitStructArrayVisitor() override {
+        V3Stats::addStat("SplitVar, struct arrays split into member arrays", m_numSplit);
+    }
+};
+
 //######################################################################
 // Split Unpacked Variables
 // Replacement policy:
@@ -1343,6 +1471,7 @@ const char* SplitVarImpl::cannotSplitPackedVarReason(const AstVar* varp) {
 
 void V3SplitVar::splitVariable(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
+    { SplitStructArrayVisitor{nodep}; }
     SplitVarRefs refs;
     {
         const SplitUnpackedVarVisitor visitor{nodep};
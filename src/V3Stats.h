@@ -147,6 +147,22 @@ public:
     static void infoHeader(std::ofstream& os, const string& prefix);
     /// Called for final build report
     static void summaryReport();
+    /// Record a --stats-trace event on the calling thread, times from V3Os::timeUsecs()
+    static void traceEvent(const string& name, uint64_t startUs, uint64_t endUs) VL_MT_SAFE;
+};
+
+//============================================================================
+// Scoped --stats-trace event, nesting with other events on the same thread
+
+class V3StatsTraceScope final {
+    const char* const m_namep;  // Event name, must outlive the trace
+    const uint64_t m_startUs;  // Start time, or 0 when not tracing
+
+public:
+    explicit V3StatsTraceScope(const char* namep) VL_MT_SAFE;
+    ~V3StatsTraceScope() VL_MT_SAFE;
+    VL_UNCOPYABLE(V3StatsTraceScope);
+    VL_UNMOVABLE(V3StatsTraceScope);
 };
 
 #endif  // Guard
@@ -20,10 +20,15 @@
 #include "V3Global.h"
 #include "V3Os.h"
 #include "V3Stats.h"
+#include "V3ThreadPool.h"
 
 #include <iomanip>
 #include <unordered_map>
 
+#if !defined(_WIN32) && !defined(__MINGW32__)
+#include <sys/resource.h>
+#endif
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 //######################################################################
@@ -195,6 +200,110 @@ void V3Statistic::dump(std::ofstream& os) const {
        << value();
 }
 
+//######################################################################
+// Per stage resource profile, for <prefix>__stats_stages.json
+
+struct StatsStageProfile final {
+    string m_name;  // Stage name, with number
+    double m_wallTime;  // Wall time spent in stage (sec)
+    double m_cpuTime;  // CPU time spent in stage, all threads (sec)
+    double m_poolBusy;  // V3ThreadPool worker time spent in stage (sec)
+    double m_memory;  // Memory at end of stage (MB)
+    double m_memoryDelta;  // Memory change in stage (MB)
+    double m_memoryPeak;  // Peak resident memory so far (MB)
+    double m_astMemory;  // AST node pool memory at end of stage (MB)
+};
+
+static std::vector<StatsStageProfile> s_stageProfiles;  // Profile of each stage
+static VlOs::DeltaCpuTime s_cpuTime{true};  // CPU time since program start
+
+static double memoryPeakMB() {
+    // Peak resident set size, or 0 if unknown
+#if !defined(_WIN32) && !defined(__MINGW32__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024.0 / 1024.0;  // In bytes
+#else
+    return usage.ru_maxrss / 1024.0;  // In kilobytes
+#endif
+#else
+    return 0;
+#endif
+}
+
+static void statsStagesReport() {
+    const string filename = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                            + "__stats_stages.json";
+    V3OutJsonFile of{filename};
+    of.put("version", V3Options::version());
+    of.put("verilateJobs", v3Global.opt.verilateJobs());
+    of.begin("stages", '[');
+    for (const StatsStageProfile& stage : s_stageProfiles) {
+        of.begin()
+            .put("name", stage.m_name)
+            .put("wallTime", stage.m_wallTime)
+            .put("cpuTime", stage.m_cpuTime)
+            .put("poolBusyTime", stage.m_poolBusy)
+            .put("memoryMB", stage.m_memory)
+            .put("memoryDeltaMB", stage.m_memoryDelta)
+            .put("memoryPeakMB", stage.m_memoryPeak)
+            .put("astMemoryMB", stage.m_astMemory)
+            .end();
+    }
+    of.end();
+}
+
+//######################################################################
+// Wall time events, for <prefix>__stats_trace.json
+
+struct StatsTraceEvent final {
+    string m_name;  // Event name
+    uint64_t m_startUs;  // Start, from V3Os::timeUsecs()
+    uint64_t m_durUs;  // Duration
+    int m_tid;  // Recording thread, in order of first event
+};
+
+static V3Mutex s_traceMutex;  // Protects s_traceEvents
+static std::vector<StatsTraceEvent> s_traceEvents VL_GUARDED_BY(s_traceMutex);
+
+static void statsTraceReport() VL_MT_SAFE_EXCLUDES(s_traceMutex) {
+    const V3LockGuard lock{s_traceMutex};
+    uint64_t baseUs = UINT64_MAX;
+    for (const StatsTraceEvent& event : s_traceEvents) baseUs = std::min(baseUs, event.m_startUs);
+    const string filename = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                            + "__stats_trace.json";
+    V3OutJsonFile of{filename};
+    of.put("displayTimeUnit", "ms");
+    of.begin("traceEvents", '[');
+    for (const StatsTraceEvent& event : s_traceEvents) {
+        of.begin()
+            .put("name", event.m_name)
+            .put("ph", "X")
+            .put("ts", event.m_startUs - baseUs)
+            .put("dur", event.m_durUs)
+            .put("pid", 1)
+            .put("tid", event.m_tid)
+            .end();
+    }
+    of.end();
+}
+
+void V3Stats::traceEvent(const string& name, uint64_t startUs, uint64_t endUs) VL_MT_SAFE {
+    static std::atomic<int> s_nextTid{0};
+    static thread_local int t_tid = s_nextTid++;
+    const V3LockGuard lock{s_traceMutex};
+    s_traceEvents.push_back({name, startUs, endUs - startUs, t_tid});
+}
+
+V3StatsTraceScope::V3StatsTraceScope(const char* namep) VL_MT_SAFE
+    : m_namep{namep},
+      m_startUs{v3Global.opt.statsTrace() ? V3Os::timeUsecs() : 0} {}
+
+V3StatsTraceScope::~V3StatsTraceScope() VL_MT_SAFE {
+    if (m_startUs) V3Stats::traceEvent(m_namep, m_startUs, V3Os::timeUsecs());
+}
+
 //######################################################################
 // Top Stats class
 
@@ -208,7 +317,11 @@ void V3Stats::statsStage(const string& name) {
 
     const string digitName = V3Global::digitsFilename(++fileNumber) + "_" + name;
 
-    const double wallTime = V3Os::timeUsecs() / 1.0e6;
+    const uint64_t wallTimeUs = V3Os::timeUsecs();
+    static uint64_t lastWallTimeUs = wallTimeUs;
+    if (v3Global.opt.statsTrace()) traceEvent(digitName, lastWallTimeUs, wallTimeUs);
+    lastWallTimeUs = wallTimeUs;
+    const double wallTime = wallTimeUs / 1.0e6;
     if (lastWallTime < 0) lastWallTime = wallTime;
     const double wallTimeDelta = wallTime - lastWallTime;
     lastWallTime = wallTime;
@@ -217,6 +330,21 @@ void V3Stats::statsStage(const string& name) {
 
     const double memory = VlOs::memUsageBytes() / 1024.0 / 1024.0;
     V3Stats::addStatPerf("Stage, Memory (MB), " + digitName, memory);
+    const double astMemory = AstNode::allocatorBytes() / 1024.0 / 1024.0;
+    V3Stats::addStatPerf("Stage, AST node memory (MB), " + digitName, astMemory);
+
+    static double lastCpuTime = 0;
+    static double lastPoolBusy = 0;
+    static double lastMemory = 0;
+    const double cpuTimeNow = s_cpuTime.deltaTime();
+    const V3ThreadPool* const poolp = v3Global.threadPoolp();
+    const double poolBusy = poolp ? poolp->busySeconds() : 0;
+    s_stageProfiles.push_back({digitName, wallTimeDelta, cpuTimeNow - lastCpuTime,
+                               poolBusy - lastPoolBusy, memory, memory - lastMemory,
+                               memoryPeakMB(), astMemory});
+    lastCpuTime = cpuTimeNow;
+    lastPoolBusy = poolBusy;
+    lastMemory = memory;
 }
 
 void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
@@ -241,6 +369,9 @@ void V3Stats::statsReport() {
     // Cleanup
     ofp->close();
     VL_DO_DANGLING(delete ofp, ofp);
+
+    statsStagesReport();
+    if (v3Global.opt.statsTrace()) statsTraceReport();
 }
 
 void V3Stats::summaryReport() {
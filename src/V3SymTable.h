@@ -29,6 +29,7 @@
 #include <iomanip>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -44,7 +45,25 @@ class VSymEnt final {
     // Symbol table that can have a "superior" table for resolving upper references
     // MEMBERS
     using IdNameMap = std::multimap<std::string, VSymEnt*>;
-    IdNameMap m_idNameMap;  // Hash of variables by name
+    // Key for hashed lookup, with the hash computed once when walking fallbacks
+    struct IdKey final {
+        size_t m_hash;  // Hash of name
+        const std::string* m_namep;  // Name, owned by caller or m_idNameMap
+        explicit IdKey(const std::string& name)
+            : m_hash{std::hash<std::string>{}(name)}
+            , m_namep{&name} {}
+    };
+    struct IdKeyHash final {
+        size_t operator()(const IdKey& key) const { return key.m_hash; }
+    };
+    struct IdKeyEqual final {
+        bool operator()(const IdKey& a, const IdKey& b) const {
+            return a.m_hash == b.m_hash && *a.m_namep == *b.m_namep;
+        }
+    };
+    using IdIndex = std::unordered_map<IdKey, IdNameMap::iterator, IdKeyHash, IdKeyEqual>;
+    IdNameMap m_idNameMap;  // Variables by name, ordered for deterministic iteration
+    IdIndex m_idIndex;  // Hashed index into m_idNameMap, for lookups
     AstNode* m_nodep;  // Node that entry belongs to
     VSymEnt* m_fallbackp = nullptr;  // Table "above" this in name scope, for fallback resolution
     VSymEnt* m_parentp = nullptr;  // Table that created this
@@ -125,7 +144,8 @@ public:
     VSymEnt* insert(const string& name, VSymEnt* entp) {
         UINFO(9, "     SymInsert se" << cvtToHex(this) << " '" << name << "' se" << cvtToHex(entp)
                                      << "  " << entp->nodep());
-        if (name != "" && m_idNameMap.find(name) != m_idNameMap.end()) {
+        const IdKey key{name};
+        if (name != "" && m_idIndex.find(key) != m_idIndex.end()) {
             // If didn't already report warning
             if (!V3Error::errorCount()) {  // LCOV_EXCL_START
                 if (debug() >= 9 || V3Error::debugDefault())
@@ -133,38 +153,46 @@ public:
                 entp->nodep()->v3fatalSrc("Inserting two symbols with same name: " << name);
             }  // LCOV_EXCL_STOP
         } else {
-            m_idNameMap.emplace(name, entp);
+            const auto it = m_idNameMap.emplace(name, entp);
+            // Index refers to the map's copy of the name; keeps first of any "" duplicates
+            m_idIndex.emplace(IdKey{it->first}, it);
         }
         return entp;
     }
     void reinsert(const string& name, VSymEnt* entp) {
-        const auto it = m_idNameMap.find(name);
-        if (name != "" && it != m_idNameMap.end()) {
+        const auto it = m_idIndex.find(IdKey{name});
+        if (name != "" && it != m_idIndex.end()) {
             UINFO(9, "     SymReinsert se" << cvtToHex(this) << " '" << name << "' se"
                                            << cvtToHex(entp) << "  " << entp->nodep());
-            it->second = entp;  // Replace
+            it->second->second = entp;  // Replace
         } else {
             insert(name, entp);
         }
     }
+private:
+    VSymEnt* findIdFlat(const IdKey& key) const {
+        const auto it = m_idIndex.find(key);
+        VSymEnt* const entp = it == m_idIndex.end() ? nullptr : it->second->second;
+        UINFO(9, "     SymFind   se" << cvtToHex(this) << " '" << *key.m_namep << "' -> "
+                                     << (!entp ? "NONE"
+                                               : "se" + cvtToHex(entp)
+                                                     + " n=" + cvtToHex(entp->nodep())));
+        return entp;
+    }
+
+public:
     VSymEnt* findIdFlat(const string& name) const {
         // Find identifier without looking upward through symbol hierarchy
         // First, scan this begin/end block or module for the name
-        const auto it = m_idNameMap.find(name);
-        UINFO(9, "     SymFind   se"
-                     << cvtToHex(this) << " '" << name << "' -> "
-                     << (it == m_idNameMap.end() ? "NONE"
-                                                 : "se" + cvtToHex(it->second)
-                                                       + " n=" + cvtToHex(it->second->nodep())));
-        if (it != m_idNameMap.end()) return it->second;
-        return nullptr;
+        return findIdFlat(IdKey{name});
     }
     VSymEnt* findIdFallback(const string& name) const {
         // Find identifier looking upward through symbol hierarchy
-        // First, scan this begin/end block or module for the name
-        if (VSymEnt* const entp = findIdFlat(name)) return entp;
-        // Then scan the upper begin/end block or module for the name
-        if (m_fallbackp) return m_fallbackp->findIdFallback(name);
+        const IdKey key{name};
+        for (const VSymEnt* symp = this; symp; symp = symp->m_fallbackp) {
+            // Scan this begin/end block or module for the name, then the upper ones
+            if (VSymEnt* const entp = symp->findIdFlat(key)) return entp;
+        }
         return nullptr;
     }
     void candidateIdFlat(VSpellCheck* spellerp, const VNodeMatcher* matcherp) const {
@@ -215,9 +243,9 @@ public:
     void importFromPackage(VSymGraph* graphp, const VSymEnt* srcp, const string& id_or_star) {
         // Import tokens from source symbol table into this symbol table
         if (id_or_star != "*") {
-            const auto it = srcp->m_idNameMap.find(id_or_star);
-            if (it != srcp->m_idNameMap.end()) {
-                importOneSymbol(graphp, it->first, it->second, true);
+            const auto it = srcp->m_idIndex.find(IdKey{id_or_star});
+            if (it != srcp->m_idIndex.end()) {
+                importOneSymbol(graphp, it->second->first, it->second->second, true);
             }
         } else {
             for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
@@ -229,8 +257,10 @@ public:
     void exportFromPackage(VSymGraph* graphp, const VSymEnt* srcp, const string& id_or_star) {
         // Export tokens from source symbol table into this symbol table
         if (id_or_star != "*") {
-            const auto it = vlstd::as_const(srcp->m_idNameMap).find(id_or_star);
-            if (it != srcp->m_idNameMap.end()) exportOneSymbol(graphp, it->first, it->second);
+            const auto it = srcp->m_idIndex.find(IdKey{id_or_star});
+            if (it != srcp->m_idIndex.end()) {
+                exportOneSymbol(graphp, it->second->first, it->second->second);
+            }
         } else {
             for (IdNameMap::const_iterator it = srcp->m_idNameMap.begin();
                  it != srcp->m_idNameMap.end(); ++it) {
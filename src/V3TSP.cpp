@@ -37,6 +37,14 @@
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+// Above this many states, building the complete graph for Christofides is
+// quadratic in memory as well as time, so use the greedy ordering instead
+constexpr size_t TSP_GREEDY_THRESHOLD = 1000;
+// Maximum distance between the two endpoints of a 2-opt segment reversal
+constexpr size_t TSP_TWO_OPT_WINDOW = 64;
+// Maximum improvement passes of 2-opt over the greedy ordering
+constexpr int TSP_TWO_OPT_PASSES = 4;
+
 //######################################################################
 // Support classes
 
@@ -45,6 +53,8 @@ static uint32_t edgeIdNext = 0;
 
 static void selfTestStates();
 static void selfTestString();
+static void selfTestGreedy();
+static void tspSortGreedy(const StateVec& states, StateVec* resultp) VL_MT_SAFE;
 }  // namespace V3TSP
 
 // Vertex that tracks a per-vertex key
@@ -432,6 +442,62 @@ private:
     VL_UNCOPYABLE(TspGraphTmpl);
 };
 
+//######################################################################
+// Greedy algorithm for large state sets
+
+void V3TSP::tspSortGreedy(const V3TSP::StateVec& states, V3TSP::StateVec* resultp) VL_MT_SAFE {
+    // Nearest neighbour walk from the first state.  This still evaluates
+    // O(n^2) costs, but without building the graph, and ties resolve to the
+    // earliest state so the result is stable.
+    V3TSP::StateVec remaining{states.begin() + 1, states.end()};
+    resultp->push_back(states.front());
+    while (!remaining.empty()) {
+        const TspStateBase* const lastp = resultp->back();
+        size_t bestIdx = 0;
+        int bestCost = lastp->cost(remaining[0]);
+        for (size_t i = 1; i < remaining.size() && bestCost; ++i) {
+            const int cost = lastp->cost(remaining[i]);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestIdx = i;
+            }
+        }
+        resultp->push_back(remaining[bestIdx]);
+        remaining.erase(remaining.begin() + bestIdx);
+    }
+
+    // Improve with 2-opt, reversing [i, j] when it lowers the open path cost.
+    // Only segments within a window are tried, as later greedy picks are
+    // usually long jumps back to states passed by earlier.
+    V3TSP::StateVec& path = *resultp;
+    const size_t size = path.size();
+    for (int pass = 0; pass < TSP_TWO_OPT_PASSES; ++pass) {
+        bool improved = false;
+        for (size_t i = 0; i + 1 < size; ++i) {
+            const size_t jEnd = std::min(size, i + TSP_TWO_OPT_WINDOW);
+            for (size_t j = i + 1; j < jEnd; ++j) {
+                // Arcs into i and out of j are replaced; the first and last
+                // states have none, as the path does not cycle back.
+                int before = 0;
+                int after = 0;
+                if (i > 0) {
+                    before += path[i - 1]->cost(path[i]);
+                    after += path[i - 1]->cost(path[j]);
+                }
+                if (j + 1 < size) {
+                    before += path[j]->cost(path[j + 1]);
+                    after += path[i]->cost(path[j + 1]);
+                }
+                if (after < before) {
+                    std::reverse(path.begin() + i, path.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        }
+        if (!improved) break;
+    }
+}
+
 //######################################################################
 // Main algorithm
 
@@ -446,6 +512,11 @@ void V3TSP::tspSort(const V3TSP::StateVec& states, V3TSP::StateVec* resultp) VL_
         resultp->push_back(*(states.begin()));
         return;
     }
+    if (states.size() > TSP_GREEDY_THRESHOLD) {
+        UINFO(4, "Greedy TSP sort of " << states.size() << " states");
+        tspSortGreedy(states, resultp);
+        return;
+    }
 
     // Build the initial graph from the starting state set.
     using Graph = TspGraphTmpl<const TspStateBase*>;
@@ -650,6 +721,39 @@ void V3TSP::selfTestStates() {
     }
 }
 
+void V3TSP::selfTestGreedy() {
+    // Linear test -- greedy walk from the first state, then 2-opt fixes the start
+    V3TSP::StateVec states;
+    const TspTestState s10{10, 0};
+    const TspTestState s60{60, 0};
+    const TspTestState s20{20, 0};
+    const TspTestState s100{100, 0};
+    const TspTestState s5{5, 0};
+    states.push_back(&s10);
+    states.push_back(&s60);
+    states.push_back(&s20);
+    states.push_back(&s100);
+    states.push_back(&s5);
+
+    V3TSP::StateVec result;
+    tspSortGreedy(states, &result);
+
+    V3TSP::StateVec expect;
+    expect.push_back(&s5);
+    expect.push_back(&s10);
+    expect.push_back(&s20);
+    expect.push_back(&s60);
+    expect.push_back(&s100);
+    if (VL_UNCOVERABLE(expect != result)) {
+        for (V3TSP::StateVec::iterator it = result.begin(); it != result.end(); ++it) {
+            const TspTestState* const statep = dynamic_cast<const TspTestState*>(*it);
+            cout << statep->xpos() << " ";
+        }
+        cout << endl;
+        v3fatalSrc("TSP greedy self-test fail. Result (above) did not match expectation.");
+    }
+}
+
 void V3TSP::selfTestString() {
     using Graph = TspGraphTmpl<std::string>;
     Graph graph;
@@ -696,4 +800,5 @@ void V3TSP::selfTestString() {
 void V3TSP::selfTest() {
     selfTestString();
     selfTestStates();
+    selfTestGreedy();
 }
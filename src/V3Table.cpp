@@ -269,7 +269,7 @@ private:
         createTables(nodep, outputAssignedTableBuilder);
 
         AstNode* const stmtsp = createLookupInput(fl, indexVscp);
-        createOutputAssigns(nodep, stmtsp, indexVscp, outputAssignedTableBuilder.varScopep());
+        createOutputAssigns(nodep, stmtsp, indexVscp, outputAssignedTableBuilder);
 
         // Link it in.
         // Keep sensitivity list, but delete all else
@@ -355,7 +355,7 @@ private:
     }
 
     void createOutputAssigns(AstNode* nodep, AstNode* stmtsp, AstVarScope* indexVscp,
-                             AstVarScope* outputAssignedTableVscp) {
+                             TableBuilder& outputAssignedTableBuilder) {
         FileLine* const fl = nodep->fileline();
         for (TableOutputVar& tov : m_outVarps) {
             AstNodeExpr* const alhsp = new AstVarRef{fl, tov.varScopep(), VAccess::WRITE};
@@ -364,8 +364,11 @@ private:
                                    ? static_cast<AstNode*>(new AstAssignDly{fl, alhsp, arhsp})
                                    : static_cast<AstNode*>(new AstAssign{fl, alhsp, arhsp});
 
-            // If this output is unassigned on some code paths, wrap the assignment in an If
+            // If this output is unassigned on some code paths, wrap the assignment in an If.
+            // The 'output assigned' table is only created (in the constant pool) if needed.
             if (tov.mayBeUnassigned()) {
+                AstVarScope* const outputAssignedTableVscp
+                    = outputAssignedTableBuilder.varScopep();
                 V3Number outputChgMask{nodep, static_cast<int>(m_outVarps.size()), 0};
                 outputChgMask.setBit(tov.ord(), 1);
                 AstNodeExpr* const condp
@@ -31,9 +31,11 @@
 #include "V3Control.h"
 #include "V3EmitCBase.h"
 #include "V3Graph.h"
+#include "V3InstrCount.h"
 #include "V3Stats.h"
 
 #include <tuple>
+#include <unordered_set>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -41,6 +43,7 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 // Graph subclasses
 
 class TaskBaseVertex VL_NOT_FINAL : public V3GraphVertex {
+    VL_RTTI_IMPL(TaskBaseVertex, V3GraphVertex)
     AstNode* m_impurep = nullptr;  // Node causing impure function w/ outside references
     bool m_noInline = false;  // Marked with pragma
 public:
@@ -55,6 +58,7 @@ public:
 };
 
 class TaskFTaskVertex final : public TaskBaseVertex {
+    VL_RTTI_IMPL(TaskFTaskVertex, TaskBaseVertex)
     // Every task gets a vertex, and we link tasks together based on funcrefs.
     AstNodeFTask* const m_nodep;
     AstCFunc* m_cFuncp = nullptr;
@@ -72,6 +76,7 @@ public:
 };
 
 class TaskCodeVertex final : public TaskBaseVertex {
+    VL_RTTI_IMPL(TaskCodeVertex, TaskBaseVertex)
     // Top vertex for all calls not under another task
 public:
     explicit TaskCodeVertex(V3Graph* graphp)
@@ -113,6 +118,7 @@ class TaskStateVisitor final : public VNVisitor {
     V3Graph m_callGraph;  // Task call graph
     TaskBaseVertex* m_curVxp;  // Current vertex we're adding to
     std::vector<AstInitialAutomatic*> m_initialps;  // Initial blocks to move
+    VDouble0 m_statCostNoInline;  // Statistic tracking
 
 public:
     // METHODS
@@ -151,6 +157,42 @@ private:
         m_assignwp->convertToAlways();
         VL_DO_CLEAR(pushDeletep(m_assignwp), m_assignwp = nullptr);
     }
+    static bool pureCallTree(const TaskBaseVertex* vxp,
+                             std::unordered_set<const TaskBaseVertex*>& visited) {
+        if (!visited.insert(vxp).second) return true;
+        if (!vxp->pure()) return false;
+        for (const V3GraphEdge& edge : vxp->outEdges()) {
+            if (!pureCallTree(static_cast<const TaskBaseVertex*>(edge.top()), visited)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    void costNoInline() {
+        // Inlining copies the body into every call site, so keep a function out of line
+        // when the copies would add more than --inline-funcs-mult operations.  Only pure
+        // functions qualify; tasks may suspend, and anything referencing outside
+        // variables must stay inlined to see them.
+        const uint64_t limit = v3Global.opt.inlineFuncsMult();
+        for (V3GraphVertex& vtx : m_callGraph.vertices()) {
+            TaskFTaskVertex* const vxp = vtx.cast<TaskFTaskVertex>();
+            if (!vxp || vxp->noInline()) continue;
+            AstNodeFTask* const ftaskp = vxp->nodep();
+            if (!VN_IS(ftaskp, Func) || ftaskp->dpiExport()) continue;
+            // Edges were merged per caller, with the weight summing the call sites
+            uint64_t calls = 0;
+            for (const V3GraphEdge& edge : vxp->inEdges()) calls += edge.weight();
+            if (calls < 2) continue;
+            std::unordered_set<const TaskBaseVertex*> visited;
+            if (!pureCallTree(vxp, visited)) continue;
+            const uint64_t cost = V3InstrCount::count(ftaskp, false);
+            if (cost * (calls - 1) <= limit) continue;
+            UINFO(4, "No function inline due to cost " << cost << " * " << calls << " calls: "
+                                                       << ftaskp);
+            vxp->noInline(true);
+            ++m_statCostNoInline;
+        }
+    }
     void checkPurity(AstNodeFTask* nodep, TaskBaseVertex* vxp) {
         if (nodep->recursive()) return;  // Impure, but no warning
         if (!vxp->pure()) {
@@ -298,9 +340,12 @@ public:
         iterate(nodep);
         //
         m_callGraph.removeRedundantEdgesSum(&TaskEdge::followAlwaysTrue);
+        if (v3Global.opt.inlineFuncsMult() > 0) costNoInline();
         if (dumpGraphLevel()) m_callGraph.dumpDotFilePrefixed("task_call");
     }
-    ~TaskStateVisitor() override = default;
+    ~TaskStateVisitor() override {
+        V3Stats::addStat("Optimizations, Functions not inlined by cost", m_statCostNoInline);
+    }
     VL_UNCOPYABLE(TaskStateVisitor);
 };
 
@@ -349,6 +394,50 @@ struct TaskDpiUtils final {
         }
         return false;
     }
+    // True if a DPI import argument's internal representation already has the layout of its
+    // DPI C type, so it may be passed by pointer without a temporary and conversions
+    static bool dpiDirectPass(const AstVar* portp) {
+        if (portp->isDpiOpenArray() || portp->isFuncReturn()) return false;
+        const AstNodeDType* dtypep = portp->dtypep()->skipRefp();
+        bool isArray = false;
+        while (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
+            isArray = true;
+            dtypep = adtypep->subDTypep()->skipRefp();
+        }
+        const AstBasicDType* const basicp = VN_CAST(dtypep, BasicDType);
+        if (!basicp) return false;
+        if (basicp->isDpiBitVec()) {
+            // svBitVecVal is an array of 32-bit words, as are IData and VlWide. The unused
+            // top bits are clear internally, but DPI may write them, so outputs need whole words
+            const int width = basicp->width();
+            const bool wholeWords = width % VL_EDATASIZE == 0;
+            if (width > VL_QUADSIZE) return wholeWords || !portp->isWritable();
+            if (width > 16 && width <= VL_IDATASIZE && isArray) {
+                return wholeWords || !portp->isWritable();
+            }
+            return false;
+        }
+        // Scalars are passed by value or pointer already, so only arrays need a copy
+        if (!isArray) return false;
+        switch (basicp->keyword()) {
+        case VBasicDTypeKwd::BYTE:
+        case VBasicDTypeKwd::SHORTINT:
+        case VBasicDTypeKwd::INT:
+        case VBasicDTypeKwd::LONGINT:
+        case VBasicDTypeKwd::DOUBLE: return true;
+        default: return false;
+        }
+    }
+    // Argument passing a dpiDirectPass port's storage
+    static string dpiDirectArg(const AstVar* portp) {
+        string addr = "&" + portp->name();
+        for (const AstNodeDType* dtypep = portp->dtypep()->skipRefp();
+             const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType);
+             dtypep = adtypep->subDTypep()->skipRefp()) {
+            addr += "[0]";
+        }
+        return "reinterpret_cast<" + portp->dpiArgType(false, false) + ">(" + addr + ")";
+    }
 };
 
 //######################################################################
@@ -380,6 +469,7 @@ class TaskVisitor final : public VNVisitor {
     DpiCFuncs m_dpiNames;  // Map of all created DPI functions
     VDouble0 m_statInlines;  // Statistic tracking
     VDouble0 m_statHierDpisWithCosts;  // Statistic tracking
+    VDouble0 m_statDpiDirectArgs;  // Statistic tracking
 
     // METHODS
 
@@ -1071,9 +1161,44 @@ class TaskVisitor final : public VNVisitor {
         }
     }
 
+    static bool dpiDeferred(AstNodeFTask* nodep, AstVarScope* rtnvscp, AstCFunc* cfuncp) {
+        // True if a --dpi-deferred import, error if it cannot be deferred
+        if (!v3Global.opt.dpiDeferred(AstNode::prettyName(nodep->cname()))) return false;
+        string why;
+        if (rtnvscp || nodep->dpiTask()) {
+            why = "is not a void function";
+        } else if (nodep->dpiContext()) {
+            why = "is a context import";
+        } else {
+            for (AstNode* stmtp = cfuncp->argsp(); stmtp; stmtp = stmtp->nextp()) {
+                const AstVar* const portp = VN_CAST(stmtp, Var);
+                if (!portp || !portp->isIO()) continue;
+                if (portp->isWritable()) {
+                    why = "has output argument " + portp->prettyNameQ();
+                } else if (portp->isDpiOpenArray()) {
+                    why = "has open array argument " + portp->prettyNameQ();
+                } else if (portp->isString()) {
+                    why = "has string argument " + portp->prettyNameQ();
+                }
+                if (!why.empty()) break;
+            }
+        }
+        if (why.empty()) return true;
+        nodep->v3warn(E_UNSUPPORTED,
+                      "Unsupported: --dpi-deferred import " << nodep->prettyNameQ() << ' ' << why
+                          << '\n'
+                          << nodep->warnMore()
+                          << "... Deferred imports must be non-context void functions with only"
+                             " input arguments, other than strings and open arrays");
+        return false;
+    }
+
     void bodyDpiImportFunc(AstNodeFTask* nodep, AstVarScope* rtnvscp, AstCFunc* cfuncp,
                            AstCFunc* dpiFuncp) {
         const char* const tmpSuffixp = V3Task::dpiTemporaryVarSuffix();
+        // Deferred calls run later on another thread, so must copy all arguments
+        const bool deferred = dpiDeferred(nodep, rtnvscp, cfuncp);
+        if (deferred) cfuncp->dpiPure(true);  // Only queues the call, so no DPI hazard
         // Convert input/inout arguments to DPI types
         string args;
         for (AstNode* stmtp = cfuncp->argsp(); stmtp; stmtp = stmtp->nextp()) {
@@ -1109,6 +1234,9 @@ class TaskVisitor final : public VNVisitor {
                                + name + " (&" + propName + ", &" + portp->name() + ");\n");
                         cfuncp->addStmtsp(new AstCStmt{portp->fileline(), varCode});
                         args += "&" + name;
+                    } else if (!deferred && TaskDpiUtils::dpiDirectPass(portp)) {
+                        args += TaskDpiUtils::dpiDirectArg(portp);
+                        ++m_statDpiDirectArgs;
                     } else {
                         if (portp->isWritable() && portp->basicp()->isDpiPrimitive()) {
                             if (!VN_IS(portp->dtypep()->skipRefp(), UnpackArrayDType)) args += "&";
@@ -1126,6 +1254,11 @@ class TaskVisitor final : public VNVisitor {
             }
         }
 
+        // Other imports may depend on the effects of deferred calls, so complete them first
+        if (!deferred && v3Global.opt.dpiDeferreds()) {
+            cfuncp->addStmtsp(new AstCStmt{nodep->fileline(), "VerilatedDpiDeferred::join();\n"});
+        }
+
         // Store context, if needed
         if (nodep->dpiContext()) {
             const string stmt = "Verilated::dpiContext(__Vscopep, __Vfilenamep, __Vlineno);\n";
@@ -1143,7 +1276,17 @@ class TaskVisitor final : public VNVisitor {
             AstCCall* const callp = new AstCCall{nodep->fileline(), dpiFuncp};
             callp->dtypeSetVoid();
             callp->argTypes(args);
-            cfuncp->addStmtsp(callp->makeStmt());
+            if (deferred) {
+                // Lambda captures the DPI temporaries by value
+                FileLine* const flp = nodep->fileline();
+                AstCStmt* const stmtp
+                    = new AstCStmt{flp, new AstText{flp, "VerilatedDpiDeferred::push([=]() {\n"}};
+                stmtp->addExprsp(callp->makeStmt());
+                stmtp->addExprsp(new AstText{flp, "});\n"});
+                cfuncp->addStmtsp(stmtp);
+            } else {
+                cfuncp->addStmtsp(callp->makeStmt());
+            }
         }
 
         // Convert output/inout arguments back to internal type
@@ -1151,7 +1294,7 @@ class TaskVisitor final : public VNVisitor {
             if (AstVar* const portp = VN_CAST(stmtp, Var)) {
                 portp->protect(false);  // No additional exposure - already part of shown proto
                 if (portp->isIO() && (portp->isWritable() || portp->isFuncReturn())
-                    && !portp->isDpiOpenArray()) {
+                    && !portp->isDpiOpenArray() && !TaskDpiUtils::dpiDirectPass(portp)) {
                     AstVarScope* const portvscp = VN_AS(
                         portp->user2p(), VarScope);  // Remembered when we created it earlier
                     cfuncp->addStmtsp(
@@ -1640,6 +1783,7 @@ public:
         V3Stats::addStat("Optimizations, Functions inlined", m_statInlines);
         V3Stats::addStat("Optimizations, Hierarchical DPI wrappers with costs",
                          m_statHierDpisWithCosts);
+        V3Stats::addStat("Optimizations, DPI arguments passed directly", m_statDpiDirectArgs);
     }
 };
 
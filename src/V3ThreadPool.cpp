@@ -19,6 +19,9 @@
 #include "V3Error.h"
 #include "V3Global.h"
 #include "V3Mutex.h"
+#include "V3Stats.h"
+
+#include <chrono>
 
 V3ThreadPool::V3ThreadPool(int numThreads) {
     numThreads = std::max(numThreads, 1);
@@ -81,7 +84,14 @@ void V3ThreadPool::workerJobLoop() {
             job = std::move(m_queue.front());
             m_queue.pop();
         }
-        job();
+        const auto start = std::chrono::steady_clock::now();
+        {
+            const V3StatsTraceScope traceScope{"V3ThreadPool job"};
+            job();
+        }
+        const auto busy = std::chrono::steady_clock::now() - start;
+        m_busyNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(busy).count(),
+                           std::memory_order_relaxed);
         m_pendingJobs.fetch_sub(1, std::memory_order_release);
     }
 }
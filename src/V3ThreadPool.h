@@ -38,6 +38,7 @@ class V3ThreadPool final {
     std::condition_variable_any m_cv;  // Conditions to wake up workers
     std::atomic<bool> m_shutdown{false};  // Termination pending
     std::atomic<size_t> m_pendingJobs{0};  // Number of started and not yet finished jobs
+    std::atomic<uint64_t> m_busyNs{0};  // Total time workers spent running jobs
     V3Mutex m_mutex;  // Mutex for use by m_queue
 
 public:
@@ -47,6 +48,13 @@ public:
     VL_UNCOPYABLE(V3ThreadPool);
     VL_UNMOVABLE(V3ThreadPool);
 
+    // Number of worker threads, 0 if jobs run on the calling thread
+    size_t numWorkers() const { return m_workers.size(); }
+    // Seconds of worker time spent running jobs so far
+    double busySeconds() const VL_MT_SAFE {
+        return m_busyNs.load(std::memory_order_relaxed) / 1.0e9;
+    }
+
     static void selfTest();
     static void selfTestMtDisabled() VL_MT_DISABLED;
 
@@ -116,16 +116,19 @@ public:
 class TraceTraceVertex final : public V3GraphVertex {
     VL_RTTI_IMPL(TraceTraceVertex, V3GraphVertex)
     AstTraceDecl* const m_nodep;  // TRACEINC this represents
+    const AstCFunc* const m_initFuncp;  // Trace init function declaring this trace
     // nullptr, or other vertex with the real code() that duplicates this one
     TraceTraceVertex* m_duplicatep = nullptr;
 
 public:
-    TraceTraceVertex(V3Graph* graphp, AstTraceDecl* nodep)
+    TraceTraceVertex(V3Graph* graphp, AstTraceDecl* nodep, const AstCFunc* initFuncp)
         : V3GraphVertex{graphp}
-        , m_nodep{nodep} {}
+        , m_nodep{nodep}
+        , m_initFuncp{initFuncp} {}
     ~TraceTraceVertex() override = default;
     // ACCESSORS
     AstTraceDecl* nodep() const { return m_nodep; }
+    const AstCFunc* initFuncp() const { return m_initFuncp; }
     string name() const override { return nodep()->name(); }
     string dotColor() const override { return "red"; }
     FileLine* fileline() const override { return nodep()->fileline(); }
@@ -190,8 +193,11 @@ class TraceVisitor final : public VNVisitor {
 
     VDouble0 m_statSetters;  // Statistic tracking
     VDouble0 m_statSettersSlow;  // Statistic tracking
+    VDouble0 m_statActShared;  // Statistic tracking
     VDouble0 m_statUniqCodes;  // Statistic tracking
     VDouble0 m_statUniqSigs;  // Statistic tracking
+    VDouble0 m_statDupSigs;  // Statistic tracking
+    VDouble0 m_statConstSigs;  // Statistic tracking
 
     // All activity numbers applying to a given trace
     using ActCodeSet = std::set<uint32_t>;
@@ -287,13 +293,28 @@ class TraceVisitor final : public VNVisitor {
 
     uint32_t assignactivityNumbers() {
         uint32_t activityNumber = 1;  // Note 0 indicates "slow" only
+        // Activity points that enable exactly the same traces are interchangeable, so
+        // share one flag between them, to test fewer flags in the change dump
+        std::map<std::vector<const V3GraphVertex*>, uint32_t> codeByTraces;
+        m_statActShared = 0;
         for (V3GraphVertex& vtx : m_graph.vertices()) {
             if (TraceActivityVertex* const vvertexp = vtx.cast<TraceActivityVertex>()) {
                 if (vvertexp != m_alwaysVtxp) {
                     if (vvertexp->slow()) {
                         vvertexp->activityCode(TraceActivityVertex::ACTIVITY_SLOW);
                     } else {
-                        vvertexp->activityCode(activityNumber++);
+                        std::vector<const V3GraphVertex*> traces;
+                        for (const V3GraphEdge& edge : vvertexp->outEdges()) {
+                            traces.push_back(edge.top());
+                        }
+                        std::sort(traces.begin(), traces.end());
+                        const auto pair = codeByTraces.emplace(std::move(traces), activityNumber);
+                        if (pair.second) {
+                            ++activityNumber;
+                        } else {
+                            ++m_statActShared;
+                        }
+                        vvertexp->activityCode(pair.first->second);
                     }
                 }
             }
@@ -592,6 +613,7 @@ class TraceVisitor final : public VNVisitor {
                 UASSERT_OBJ(canonDeclp->code() != 0, canonDeclp,
                             "Canonical node should have code assigned already");
                 declp->code(canonDeclp->code());
+                ++m_statDupSigs;
                 continue;
             }
 
@@ -607,6 +629,7 @@ class TraceVisitor final : public VNVisitor {
             // If this is a const signal, add the AstTraceInc
             const ActCodeSet& actSet = it->first;
             if (actSet.count(TraceActivityVertex::ACTIVITY_NEVER)) {
+                ++m_statConstSigs;
                 // Crate new sub function if required
                 if (!subFuncp || subStmts > splitLimit) {
                     subStmts = 0;
@@ -621,10 +644,19 @@ class TraceVisitor final : public VNVisitor {
         }
     }
 
+    void addScopeGroupGuard(AstCFunc* funcp, uint32_t baseCode, uint32_t endCode) {
+        // Skip the whole sub function if none of its signals are enabled by dumpvars
+        funcp->addInitsp(new AstCStmt{funcp->fileline(),
+                                      "if (!bufp->anyEnabled(vlSymsp->__Vm_baseCode + "
+                                          + cvtToStr(baseCode) + ", "
+                                          + cvtToStr(endCode - baseCode) + ")) return;\n"});
+    }
+
     void createNonConstTraceFunctions(const TraceVec& traces, uint32_t nAllCodes,
                                       uint32_t parallelism) {
         const int splitLimit = v3Global.opt.outputSplitCTrace() ? v3Global.opt.outputSplitCTrace()
                                                                 : std::numeric_limits<int>::max();
+        const bool scopeGroups = v3Global.opt.traceScopeGroups();
 
         // pre-incremented, so starts at 0
         uint32_t topFuncNum = std::numeric_limits<uint32_t>::max();
@@ -641,6 +673,13 @@ class TraceVisitor final : public VNVisitor {
             const ActCodeSet* prevActSet = nullptr;
             AstIf* ifp = nullptr;
             uint32_t baseCode = 0;
+            uint32_t endCode = 0;  // Code after the last signal in the sub functions
+            const AstCFunc* initFuncp = nullptr;  // Trace init function of the sub functions
+            const auto addGuards = [&]() {
+                if (!scopeGroups || !subFulFuncp) return;
+                addScopeGroupGuard(subFulFuncp, baseCode, endCode);
+                addScopeGroupGuard(subChgFuncp, baseCode, endCode);
+            };
             for (; nCodes < maxCodes && it != traces.end(); ++it) {
                 const ActCodeSet& actSet = it->first;
                 // Traced value never changes, no need to add it
@@ -663,8 +702,12 @@ class TraceVisitor final : public VNVisitor {
                     topChgFuncp = newCFunc(VTraceType::CHANGE, nullptr, topFuncNum);
                 }
 
-                // Create new sub function if required
-                if (!subFulFuncp || subStmts > splitLimit) {
+                // Create new sub function if required. With --trace-scope-groups
+                // also start a new one for each scope, so it can be skipped as a group.
+                if (!subFulFuncp || subStmts > splitLimit
+                    || (scopeGroups && vtxp->initFuncp() != initFuncp)) {
+                    addGuards();
+                    initFuncp = vtxp->initFuncp();
                     baseCode = declp->code();
                     subStmts = 0;
                     subFulFuncp = newCFunc(VTraceType::FULL, topFulFuncp, subFuncNum, baseCode);
@@ -704,6 +747,7 @@ class TraceVisitor final : public VNVisitor {
 
                 // Set the function index of the decl
                 declp->fidx(topFuncNum);
+                endCode = std::max(endCode, declp->code() + declp->codeInc());
 
                 // Track splitting due to size
                 UASSERT_OBJ(incFulp->nodeCount() == incChgp->nodeCount(), declp,
@@ -719,6 +763,7 @@ class TraceVisitor final : public VNVisitor {
                 // Track partitioning
                 nCodes += declp->codeInc();
             }
+            addGuards();
         }
     }
 
@@ -890,7 +935,7 @@ class TraceVisitor final : public VNVisitor {
     void visit(AstTraceDecl* nodep) override {
         UINFO(8, "   TRACE " << nodep);
         if (!m_finding) {
-            V3GraphVertex* const vertexp = new TraceTraceVertex{&m_graph, nodep};
+            V3GraphVertex* const vertexp = new TraceTraceVertex{&m_graph, nodep, m_cfuncp};
             nodep->user1p(vertexp);
 
             UASSERT_OBJ(m_cfuncp, nodep, "Trace not under func");
@@ -935,8 +980,11 @@ public:
     ~TraceVisitor() override {
         V3Stats::addStat("Tracing, Activity setters", m_statSetters);
         V3Stats::addStat("Tracing, Activity slow blocks", m_statSettersSlow);
+        V3Stats::addStat("Tracing, Activity flags shared", m_statActShared);
         V3Stats::addStat("Tracing, Unique trace codes", m_statUniqCodes);
         V3Stats::addStat("Tracing, Unique traced signals", m_statUniqSigs);
+        V3Stats::addStat("Tracing, Duplicate traced signals", m_statDupSigs);
+        V3Stats::addStat("Tracing, Constant traced signals", m_statConstSigs);
     }
 };
 
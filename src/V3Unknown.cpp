@@ -52,6 +52,7 @@ class UnknownVisitor final : public VNVisitor {
 
     // STATE - across all visitors
     VDouble0 m_statUnkVars;  // Statistic tracking
+    VDouble0 m_statBoundsProven;  // Statistic tracking
     V3UniqueNames m_lvboundNames;  // For generating unique temporary variable names
     std::unique_ptr<V3UniqueNames> m_xrandNames;  // For generating unique temporary variable names
 
@@ -65,6 +66,35 @@ class UnknownVisitor final : public VNVisitor {
 
     // METHODS
 
+    static uint64_t maxValue(const AstNodeExpr* nodep) {
+        // Upper bound of the unsigned value of an index expression, from its width
+        // and the masks, modulos and shifts applied to it
+        const int width = nodep->width();
+        const uint64_t widthMax = width >= 64 ? ~0ULL : (1ULL << width) - 1;
+        uint64_t result = widthMax;
+        if (const AstConst* const constp = VN_CAST(nodep, Const)) {
+            if (width <= 64 && !constp->num().isFourState()) result = constp->toUQuad();
+        } else if (const AstAnd* const andp = VN_CAST(nodep, And)) {
+            result = std::min(maxValue(andp->lhsp()), maxValue(andp->rhsp()));
+        } else if (const AstModDiv* const modp = VN_CAST(nodep, ModDiv)) {
+            const AstConst* const rhsp = VN_CAST(modp->rhsp(), Const);
+            if (rhsp && !rhsp->num().isFourState() && !rhsp->isZero()) {
+                result = std::min(maxValue(modp->lhsp()), maxValue(rhsp) - 1);
+            }
+        } else if (const AstShiftR* const shiftp = VN_CAST(nodep, ShiftR)) {
+            const AstConst* const rhsp = VN_CAST(shiftp->rhsp(), Const);
+            if (rhsp && rhsp->num().fitsInUInt()) {
+                const uint32_t shift = rhsp->num().toUInt();
+                result = shift >= 64 ? 0 : maxValue(shiftp->lhsp()) >> shift;
+            }
+        } else if (const AstExtend* const extendp = VN_CAST(nodep, Extend)) {
+            result = maxValue(extendp->lhsp());
+        } else if (const AstCond* const condp = VN_CAST(nodep, Cond)) {
+            result = std::max(maxValue(condp->thenp()), maxValue(condp->elsep()));
+        }
+        return std::min(result, widthMax);
+    }
+
     void replaceBoundLvalue(AstNodeExpr* nodep, AstNodeExpr* condp) {
         // Spec says a out-of-range LHS SEL results in a NOP.
         // This is a PITA.  We could:
@@ -390,6 +420,11 @@ class UnknownVisitor final : public VNVisitor {
             const int maxmsb = nodep->fromp()->dtypep()->width() - 1;
             if (debug() >= 9) nodep->dumpTree("-  sel_old: ");
 
+            // If the select can never exceed maxmsb, we're in bound
+            if (maxValue(nodep->lsbp()) <= static_cast<uint64_t>(maxmsb)) {
+                ++m_statBoundsProven;
+                return;
+            }
             // If (maxmsb >= selected), we're in bound
             AstNodeExpr* condp
                 = new AstGte{nodep->fileline(),
@@ -449,17 +484,14 @@ class UnknownVisitor final : public VNVisitor {
             declElements = adtypep->elementsConst();
             if (debug() >= 9) nodep->dumpTree("-  arraysel_old: ");
 
-            // If value MODDIV constant, where constant <= declElements, known ok
-            // V3Random makes these to intentionally prevent exceeding enum array bounds.
-            if (const AstModDiv* const moddivp = VN_CAST(nodep->bitp(), ModDiv)) {
-                if (const AstConst* const modconstp = VN_CAST(moddivp->rhsp(), Const)) {
-                    if (modconstp->width() <= 32
-                        && modconstp->toUInt() <= static_cast<uint32_t>(declElements)) {
-                        UINFO(9, "arraysel mod const " << declElements
-                                                       << " >= " << modconstp->toUInt());
-                        return;
-                    }
-                }
+            // If the index can never exceed the array, known ok. E.g. a value MODDIV
+            // constant, where constant <= declElements, which V3Random makes to
+            // intentionally prevent exceeding enum array bounds.
+            if (declElements > 0
+                && maxValue(nodep->bitp()) < static_cast<uint64_t>(declElements)) {
+                UINFO(9, "arraysel index in range " << declElements);
+                ++m_statBoundsProven;
+                return;
             }
             // See if the condition is constant true
             AstNodeExpr* condp
@@ -520,6 +552,7 @@ public:
     }
     ~UnknownVisitor() override {  //
         V3Stats::addStat("Unknowns, variables created", m_statUnkVars);
+        V3Stats::addStat("Unknowns, bound checks proven unneeded", m_statBoundsProven);
     }
 };
 
@@ -20,6 +20,9 @@
 // Each module:
 //      Look for "FOR" loops and unroll them if <= 32 loops.
 //      (Eventually, a better way would be to simulate the entire loop; ala V3Table.)
+//      With --unroll-cost, instead weigh the instruction count of the body
+//      against the trip count, and partially unroll loops too costly to
+//      unroll fully.
 //      Convert remaining FORs to WHILEs
 //
 //*************************************************************************
@@ -29,11 +32,15 @@
 #include "V3Unroll.h"
 
 #include "V3Const.h"
+#include "V3InstrCount.h"
 #include "V3Simulate.h"
 #include "V3Stats.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+// Largest factor loops too costly to fully unroll are partially unrolled by
+constexpr int UNROLL_PARTIAL_MAX = 8;
+
 //######################################################################
 // Unroll state, as a visitor of each AstNode
 
@@ -50,6 +57,7 @@ class UnrollVisitor final : public VNVisitor {
     string m_beginName;  // What name to give begin iterations
     VDouble0 m_statLoops;  // Statistic tracking
     VDouble0 m_statIters;  // Statistic tracking
+    VDouble0 m_statPartial;  // Statistic tracking
 
     // METHODS
 
@@ -77,6 +85,73 @@ class UnrollVisitor final : public VNVisitor {
         return bodySizeOverRecurse(nodep->nextp(), bodySize, bodyLimit);
     }
 
+    bool indexedByLoopVar(AstNode* nodep) const {
+        // Whether once the loop variable is a constant, V3Const can fold a select,
+        // e.g. a constant index into an array instead of a computed address
+        const auto usesVar = [this](const AstNode* exprp) {
+            return exprp->exists([this](const AstVarRef* refp) {
+                return refp->varp() == m_forVarp && refp->varScopep() == m_forVscp;
+            });
+        };
+        for (; nodep; nodep = nodep->nextp()) {
+            if (nodep->exists([&](const AstNode* subp) {
+                    if (const AstArraySel* const selp = VN_CAST(subp, ArraySel)) {
+                        return usesVar(selp->bitp());
+                    }
+                    if (const AstSel* const selp = VN_CAST(subp, Sel)) {
+                        return usesVar(selp->lsbp());
+                    }
+                    return false;
+                })) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int unrollFactor(AstNode* nodep, AstNode* precondsp, AstNode* incp, AstNode* bodysp,
+                     int loops, int limit) {
+        // Return the number of copies of the body to make: 'loops' to fully
+        // unroll, fewer to partially unroll, or 0 to leave the loop alone
+        const uint64_t budget = v3Global.opt.unrollCost();
+        uint64_t iterCost = 0;
+        for (AstNode* stmtp = precondsp; stmtp; stmtp = stmtp->nextp()) {
+            iterCost += V3InstrCount::count(stmtp, false);
+        }
+        for (AstNode* stmtp = bodysp; stmtp && stmtp != incp; stmtp = stmtp->nextp()) {
+            iterCost += V3InstrCount::count(stmtp, false);
+        }
+        iterCost += V3InstrCount::count(incp, false);
+        // Folding after unrolling roughly halves the cost of each copy
+        const uint64_t copyCost
+            = indexedByLoopVar(precondsp) || indexedByLoopVar(bodysp) ? iterCost / 2 : iterCost;
+        UINFO(6, "   Unroll cost " << iterCost << " copy " << copyCost << " loops " << loops);
+        if (loops <= limit && copyCost * loops <= budget) return loops;
+        // Partial unrolling repeats the body between condition checks, so
+        // needs a factor dividing the trip count, and no preconditions
+        if (precondsp || !VN_IS(nodep, While) || !VN_AS(nodep, While)->stmtsp()) return 0;
+        for (int factor = std::min(UNROLL_PARTIAL_MAX, loops / 2); factor >= 2; --factor) {
+            if (loops % factor == 0 && iterCost * factor <= budget) return factor;
+        }
+        return 0;
+    }
+
+    void partialUnroller(AstWhile* nodep, int factor) {
+        UINFO(6, "   Partial unroll by " << factor << " " << nodep);
+        // Each iteration becomes 'factor' copies of body and increment; the
+        // last increment stays in incsp, or the body when it holds it
+        AstNode* const stmtsp = nodep->stmtsp()->unlinkFrBackWithNext();
+        AstNode* newp = nullptr;
+        for (int i = 0; i < factor; ++i) {
+            if (i && nodep->incsp()) {
+                newp = AstNode::addNext(newp, nodep->incsp()->cloneTree(true));
+            }
+            newp = AstNode::addNext(newp, i == factor - 1 ? stmtsp : stmtsp->cloneTree(true));
+        }
+        nodep->addStmtsp(newp);
+        ++m_statPartial;
+    }
+
     bool forUnrollCheck(
         AstNode* const nodep,
         const VOptionBool& unrollFull,  // Pragma unroll_full, unroll_disable
@@ -159,12 +234,22 @@ class UnrollVisitor final : public VNVisitor {
             // Check whether to we actually want to try and unroll.
             int loops;
             const int limit = v3Global.opt.unrollCountAdjusted(unrollFull, m_generate, false);
-            if (!countLoops(initAssp, condp, incp, limit, loops)) {
+            const bool byCost = v3Global.opt.unrollCost() > 0 && !unrollFull.isSetTrue();
+            // Partial unrolling needs the trip count of loops too long to fully unroll
+            const int countLimit = byCost ? std::max(limit, v3Global.opt.unrollCost()) : limit;
+            if (!countLoops(initAssp, condp, incp, countLimit, loops)) {
                 return cantUnroll(nodep, "Unable to simulate loop");
             }
 
-            // Less than 10 statements in the body?
-            if (!unrollFull.isSetTrue()) {
+            if (byCost) {
+                const int factor = unrollFactor(nodep, precondsp, incp, bodysp, loops, limit);
+                if (factor == 0) return cantUnroll(nodep, "too costly");
+                if (factor < loops) {
+                    partialUnroller(VN_AS(nodep, While), factor);
+                    return false;  // Loop remains
+                }
+            } else if (!unrollFull.isSetTrue()) {
+                // Less than 10 statements in the body?
                 int bodySize = 0;
                 int bodyLimit = v3Global.opt.unrollStmts();
                 if (loops > 0) bodyLimit = v3Global.opt.unrollStmts() / loops;
@@ -479,6 +564,7 @@ public:
     ~UnrollVisitor() override {
         V3Stats::addStatSum("Optimizations, Unrolled Loops", m_statLoops);
         V3Stats::addStatSum("Optimizations, Unrolled Iterations", m_statIters);
+        V3Stats::addStatSum("Optimizations, Partially unrolled loops", m_statPartial);
     }
     // METHODS
     void init(bool generate, const string& beginName) {
@@ -36,6 +36,10 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 using MTaskIdVec = std::vector<bool>;  // Used as a bit-set indexed by MTask ID
 using MTaskAffinityMap = std::unordered_map<const AstVar*, MTaskIdVec>;
+// Thread writing each variable, for --threads-var-padding
+using WriterThreadMap = std::unordered_map<const AstVar*, uint32_t>;
+constexpr uint32_t WRITER_NONE = 0;  // Not written by any statically packed mtask
+constexpr uint32_t WRITER_MULTI = std::numeric_limits<uint32_t>::max();  // Several threads
 
 // Trace through code reachable form an MTask and annotate referenced variabels
 class GatherMTaskAffinity final : VNVisitorConst {
@@ -46,13 +50,18 @@ class GatherMTaskAffinity final : VNVisitorConst {
 
     // STATE
     MTaskAffinityMap& m_results;  // The result map being built;
+    WriterThreadMap* const m_writersp;  // Writer threads being built, or nullptr
     const uint32_t m_id;  // Id of mtask being analysed
+    const uint32_t m_thread;  // Thread of mtask being analysed
     const size_t m_usedIds = ExecMTask::numUsedIds();  // Value of max id + 1
 
     // CONSTRUCTOR
-    GatherMTaskAffinity(const ExecMTask* mTaskp, MTaskAffinityMap& results)
+    GatherMTaskAffinity(const ExecMTask* mTaskp, MTaskAffinityMap& results,
+                        WriterThreadMap* writersp)
         : m_results{results}
-        , m_id{mTaskp->id()} {
+        , m_writersp{writersp}
+        , m_id{mTaskp->id()}
+        , m_thread{mTaskp->thread()} {
         iterateChildrenConst(mTaskp->bodyp());
     }
     ~GatherMTaskAffinity() = default;
@@ -63,6 +72,17 @@ class GatherMTaskAffinity final : VNVisitorConst {
         // Cheaper than relying on emplace().second
         if (nodep->user1SetOnce()) return;
         AstVar* const varp = nodep->varp();
+        if (m_writersp && nodep->access().isWriteOrRW()) {
+            // Stored as thread + 1, so WRITER_NONE is distinct from thread 0
+            uint32_t& writer = m_writersp->emplace(varp, WRITER_NONE).first->second;
+            if (m_thread == std::numeric_limits<uint32_t>::max()) {
+                writer = WRITER_MULTI;  // Not statically packed, so could be on any thread
+            } else if (writer == WRITER_NONE) {
+                writer = m_thread + 1;
+            } else if (writer != m_thread + 1) {
+                writer = WRITER_MULTI;
+            }
+        }
         // Ignore TriggerVec. They are big and read-only in the MTask bodies
         AstBasicDType* const basicp = varp->dtypep()->basicp();
         if (basicp && basicp->isTriggerVec()) return;
@@ -88,8 +108,9 @@ class GatherMTaskAffinity final : VNVisitorConst {
     void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
 
 public:
-    static void apply(const ExecMTask* mTaskp, MTaskAffinityMap& results) {
-        GatherMTaskAffinity{mTaskp, results};
+    static void apply(const ExecMTask* mTaskp, MTaskAffinityMap& results,
+                      WriterThreadMap* writersp) {
+        GatherMTaskAffinity{mTaskp, results, writersp};
     }
 };
 
@@ -136,11 +157,13 @@ class VariableOrder final {
     std::unordered_map<const AstVar*, VarAttributes> m_attributes;
 
     const MTaskAffinityMap& m_mTaskAffinity;
+    const WriterThreadMap* const m_writersp;  // Writer threads, if --threads-var-padding
     std::vector<AstVar*>& m_varps;
 
     VariableOrder(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
-                  std::vector<AstVar*>& varps)
+                  const WriterThreadMap* writersp, std::vector<AstVar*>& varps)
         : m_mTaskAffinity{mTaskAffinity}
+        , m_writersp{writersp}
         , m_varps{varps} {
         orderModuleVars(modp);
     }
@@ -208,6 +231,27 @@ class VariableOrder final {
 
         // Finally add the variables with no known MTask affinity
         sortAndAppend(m2v[emptyVec]);
+
+        if (m_writersp) padByWriterThread(varps);
+    }
+
+    // Group variables by the thread writing them, keeping the order within
+    // each group, and start each group on a new cache line, so threads
+    // writing their own state do not invalidate lines other threads use.
+    // Read-only state comes first, then each writer thread, then state
+    // written by several threads.
+    void padByWriterThread(std::vector<AstVar*>& varps) {
+        const auto writerOf = [this](const AstVar* varp) {
+            const auto it = m_writersp->find(varp);
+            return it == m_writersp->end() ? WRITER_NONE : it->second;
+        };
+        std::stable_sort(varps.begin(), varps.end(),
+                         [&](const AstVar* ap, const AstVar* bp) {  //
+                             return writerOf(ap) < writerOf(bp);
+                         });
+        for (size_t i = 1; i < varps.size(); ++i) {
+            if (writerOf(varps[i]) != writerOf(varps[i - 1])) varps[i]->setCacheLineAlign();
+        }
     }
 
     void orderModuleVars(AstNodeModule* modp) {
@@ -245,8 +289,9 @@ class VariableOrder final {
 
 public:
     static void processModule(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
+                              const WriterThreadMap* writersp,
                               std::vector<AstVar*>& varps) VL_MT_STABLE {
-        VariableOrder{modp, mTaskAffinity, varps};
+        VariableOrder{modp, mTaskAffinity, writersp, varps};
     }
 };
 
@@ -257,12 +302,14 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
     UINFO(2, __FUNCTION__ << ":");
 
     MTaskAffinityMap mTaskAffinity;
+    WriterThreadMap writers;
+    WriterThreadMap* const writersp = v3Global.opt.threadsVarPadding() ? &writers : nullptr;
 
     // Gather MTask affinities
     if (v3Global.opt.mtasks()) {
         netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
             for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
-                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity);
+                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity, writersp);
             }
         });
     }
@@ -276,8 +323,8 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
         for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
+            threadScope.enqueue([modp, mTaskAffinity, writersp, &varps]() {
+                VariableOrder::processModule(modp, mTaskAffinity, writersp, varps);
             });
         }
     }
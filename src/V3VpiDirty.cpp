@@ -0,0 +1,143 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Dirty flags for VPI value change callbacks
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3VpiDirty's Transformations:
+//
+//  For each public signal, other than parameters and top level ports:
+//      Create a __Vvpidirty__<name> flag beside it
+//  For each statement writing such a signal:
+//      Add DIRTY = 1; and TOP.__Vvpidirty = 1; after the statement
+//  The VPI then only compares signals with their flag set, and may skip
+//  the comparisons entirely when the model flag is clear.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3VpiDirty.h"
+
+#include "V3Stats.h"
+
+#include <vector>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class VpiDirtyVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstVar::user1p()        -> AstVar*.  Dirty flag declared beside this variable
+    //  AstVarScope::user1p()   -> AstVarScope*.  Dirty flag of this signal
+    //  AstNodeStmt::user2p()   -> AstVarScope*.  Last dirty flag set after this statement
+    const VNUser1InUse m_inuser1;
+    const VNUser2InUse m_inuser2;
+
+    // STATE
+    AstVarScope* m_anyVscp = nullptr;  // Model flag, set when any dirty flag is set
+    AstNodeStmt* m_stmtp = nullptr;  // Innermost statement being iterated
+    std::vector<std::pair<AstNodeStmt*, AstVarScope*>> m_marks;  // Flags to set after stmts
+    VDouble0 m_statFlags;  // Statistic tracking
+    VDouble0 m_statMarks;  // Statistic tracking
+
+    // METHODS
+    static bool isTracked(const AstVar* varp) {
+        // Same signals V3EmitCSyms gives to the VPI; the model never writes
+        // parameters, and the C++ wrapper writes top level ports behind our back
+        return (varp->isSigUserRdPublic() || varp->isSigUserRWPublic()) && !varp->isParam()
+               && !varp->isPrimaryIO();
+    }
+    static AstVar* newFlagVar(AstNodeModule* modp, FileLine* fl, const string& name) {
+        AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, VFlagBitPacked{}, 1};
+        varp->sigPublic(true);  // Only read by the VPI, so must not be removed
+        modp->addStmtsp(varp);
+        return varp;
+    }
+    AstVarScope* newFlagVarScope(AstScope* scopep, AstVar* varp) {
+        AstVarScope* const vscp = new AstVarScope{varp->fileline(), scopep, varp};
+        scopep->addVarsp(vscp);
+        ++m_statFlags;
+        return vscp;
+    }
+    void createFlags(AstNetlist* netlistp) {
+        std::vector<AstVarScope*> vscps;
+        netlistp->foreach([&](AstVarScope* vscp) {
+            if (isTracked(vscp->varp())) vscps.push_back(vscp);
+        });
+        if (vscps.empty()) return;
+        for (AstVarScope* const vscp : vscps) {
+            AstVar* const varp = vscp->varp();
+            // Modules instantiated more than once share the flag's declaration
+            if (!varp->user1p()) {
+                varp->user1p(newFlagVar(vscp->scopep()->modp(), varp->fileline(),
+                                        "__Vvpidirty__" + varp->name()));
+            }
+            vscp->user1p(newFlagVarScope(vscp->scopep(), VN_AS(varp->user1p(), Var)));
+        }
+        AstScope* const topScopep = netlistp->topScopep()->scopep();
+        m_anyVscp = newFlagVarScope(
+            topScopep, newFlagVar(topScopep->modp(), topScopep->fileline(), "__Vvpidirty"));
+    }
+    static AstAssign* newSet(AstNodeStmt* stmtp, AstVarScope* vscp) {
+        FileLine* const fl = stmtp->fileline();
+        return new AstAssign{fl, new AstVarRef{fl, vscp, VAccess::WRITE},
+                             new AstConst{fl, AstConst::BitTrue{}}};
+    }
+
+    // VISITORS
+    void visit(AstNodeStmt* nodep) override {
+        VL_RESTORER(m_stmtp);
+        m_stmtp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeVarRef* nodep) override {
+        if (!m_stmtp || !nodep->access().isWriteOrRW()) return;
+        AstVarScope* const flagVscp = VN_CAST(nodep->varScopep()->user1p(), VarScope);
+        if (!flagVscp || m_stmtp->user2p() == flagVscp) return;
+        m_stmtp->user2p(flagVscp);
+        m_marks.emplace_back(m_stmtp, flagVscp);
+    }
+    void visit(AstVarScope*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit VpiDirtyVisitor(AstNetlist* nodep) {
+        createFlags(nodep);
+        if (!m_anyVscp) return;
+        iterate(nodep);
+        // Insert after iterating, as the statement lists are being walked
+        const AstNodeStmt* lastStmtp = nullptr;
+        for (const auto& pair : m_marks) {
+            AstNodeStmt* const stmtp = pair.first;
+            if (stmtp != lastStmtp) stmtp->addNextHere(newSet(stmtp, m_anyVscp));
+            stmtp->addNextHere(newSet(stmtp, pair.second));
+            lastStmtp = stmtp;
+            ++m_statMarks;
+        }
+    }
+    ~VpiDirtyVisitor() override {
+        V3Stats::addStat("VPI, dirty flags", m_statFlags);
+        V3Stats::addStat("VPI, dirty flag writes", m_statMarks);
+    }
+};
+
+//######################################################################
+// VpiDirty class functions
+
+void V3VpiDirty::vpiDirtyAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { VpiDirtyVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("vpidirty", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -76,6 +76,7 @@
 #include "V3MemberMap.h"
 #include "V3Number.h"
 #include "V3Randomize.h"
+#include "V3Stats.h"
 #include "V3String.h"
 #include "V3Task.h"
 #include "V3WidthCommit.h"
@@ -1430,6 +1431,38 @@ class WidthVisitor final : public VNVisitor {
         }
     }
 
+    void visit(AstSExpr* nodep) override {
+        if (m_vup->prelim()) {
+            if (nodep->preExprp()) iterateCheckBool(nodep, "LHS", nodep->preExprp(), BOTH);
+            iterateCheckBool(nodep, "RHS", nodep->exprp(), BOTH);
+            if (AstNodeExpr* const unboundedp = VN_CAST(nodep->maxDelayp(), Unbounded)) {
+                unboundedp->v3warn(E_UNSUPPORTED,
+                                   "Unsupported: ## range with '$' (in sequence expression)");
+                VL_DO_DANGLING(pushDeletep(unboundedp->unlinkFrBack()), unboundedp);
+            }
+            const auto constDelay = [&](bool max) -> int32_t {
+                iterateCheckSizedSelf(nodep, "Delay", max ? nodep->maxDelayp() : nodep->delayp(),
+                                      SELF, BOTH);
+                // Delay may change
+                AstNode* const delayp = V3Const::constifyParamsEdit(max ? nodep->maxDelayp()
+                                                                        : nodep->delayp());
+                const AstConst* const constp = VN_CAST(delayp, Const);
+                if (!constp || constp->toSInt() < 0) {
+                    delayp->v3error("Cycle delay must be a non-negative constant"
+                                    " (IEEE 1800-2023 16.7)");
+                    return 0;
+                }
+                return constp->toSInt();
+            };
+            const int32_t minDelay = constDelay(false);
+            if (nodep->maxDelayp() && constDelay(true) < minDelay) {
+                nodep->maxDelayp()->v3error("Cycle delay range maximum is less than its minimum"
+                                            " (IEEE 1800-2023 16.7)");
+            }
+            nodep->dtypeSetBit();
+        }
+    }
+
     void visit(AstRand* nodep) override {
         if (m_vup->prelim()) {
             if (nodep->urandom()) {
@@ -8400,6 +8433,7 @@ public:
 
 void V3Width::width(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
+    const V3StatsTraceScope traceScope{"V3Width::width"};
     {
         // We should do it in bottom-up module order, but it works in any order.
         const WidthClearVisitor cvisitor{nodep};
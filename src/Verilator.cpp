@@ -31,6 +31,7 @@
 #include "V3Class.h"
 #include "V3Clean.h"
 #include "V3Clock.h"
+#include "V3ColdSplit.h"
 #include "V3Combine.h"
 #include "V3Common.h"
 #include "V3Const.h"
@@ -62,6 +63,7 @@
 #include "V3HierBlock.h"
 #include "V3Inline.h"
 #include "V3Inst.h"
+#include "V3InstrCount.h"
 #include "V3Interface.h"
 #include "V3Life.h"
 #include "V3LifePost.h"
@@ -84,6 +86,7 @@
 #include "V3Randomize.h"
 #include "V3Reloop.h"
 #include "V3Sampled.h"
+#include "V3ScPorts.h"
 #include "V3Sched.h"
 #include "V3Scope.h"
 #include "V3Scoreboard.h"
@@ -107,6 +110,7 @@
 #include "V3Unknown.h"
 #include "V3Unroll.h"
 #include "V3VariableOrder.h"
+#include "V3VpiDirty.h"
 #include "V3Waiver.h"
 #include "V3Width.h"
 #include "V3WidthCommit.h"
@@ -472,6 +476,9 @@ static void process() {
             V3Const::constifyAll(v3Global.rootp());
             V3Dead::deadifyAllScoped(v3Global.rootp());
 
+            // Flag writes to public signals, so VPI value callbacks can skip unwritten ones
+            if (v3Global.opt.vpiDirty()) V3VpiDirty::vpiDirtyAll(v3Global.rootp());
+
             // Create tracing logic, since we ripped out some signals the user might want to trace
             // Note past this point, we presume traced variables won't move between CFuncs
             // (It's OK if untraced temporaries move around, or vars
@@ -495,6 +502,14 @@ static void process() {
             // Move variables from modules to function local variables where possible
             if (v3Global.opt.fLocalize()) V3Localize::localizeAll(v3Global.rootp());
 
+            // Move unlikely branches into slow functions, to keep hot code dense
+            if (v3Global.opt.fColdSplit()) V3ColdSplit::coldSplitAll(v3Global.rootp());
+
+            // Only write SystemC outputs when their value changes
+            if (v3Global.opt.systemC() && v3Global.opt.pinsScChangeOnly()) {
+                V3ScPorts::scPortsAll(v3Global.rootp());
+            }
+
             // Remove remaining scopes; make varrefs/funccalls relative to current module
             V3Descope::descopeAll(v3Global.rootp());
 
@@ -704,6 +719,11 @@ static void verilate(const string& argString) {
         UINFO(2, "selfTest done");
     }
 
+    // Operation costs for the target, before anything estimates run time
+    if (!v3Global.opt.instrCountTable().empty()) {
+        V3InstrCount::loadCostTable(v3Global.opt.instrCountTable());
+    }
+
     // Read first filename
     v3Global.readFiles();
     v3Global.removeStd();
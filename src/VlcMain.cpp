@@ -45,6 +45,7 @@ static int debug() { return V3Error::debugDefault(); }
 
 #include <algorithm>
 #include <fstream>
+#include <thread>
 
 //######################################################################
 // VlcOptions
@@ -70,6 +71,15 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
     DECL_OPTION("-debugi", CbVal, [](int v) { V3Error::debugDefault(v); });
     DECL_OPTION("-filter-type", Set, &m_filterType);
     DECL_OPTION("-rank", OnOff, &m_rank);
+    DECL_OPTION("-threads", CbVal, [this](const char* valp) {
+        int val = std::atoi(valp);
+        if (val < 0) {
+            v3fatal("--threads requires a non-negative integer, but '" << valp << "' was passed");
+        } else if (val == 0) {
+            val = std::max(1U, std::thread::hardware_concurrency());
+        }
+        m_threads = val;
+    });
     DECL_OPTION("-unlink", OnOff, &m_unlink);
     DECL_OPTION("-V", CbCall, []() {
         showVersion(true);
@@ -130,10 +140,7 @@ int main(int argc, char** argv) {
 
     if (top.opt.readFiles().empty()) top.opt.addReadFile("vlt_coverage.dat");
 
-    {
-        const VlStringSet& readFiles = top.opt.readFiles();
-        for (const auto& filename : readFiles) top.readCoverage(filename);
-    }
+    top.readCoverageFiles(top.opt.readFiles());
 
     if (debug() >= 9) {
         top.tests().dump(true);
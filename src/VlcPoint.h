@@ -153,6 +153,13 @@ public:
         m_points[pointnum].countInc(count);
         return pointnum;
     }
+    // Add a new point that sorts after all existing points
+    uint64_t appendPoint(const string& name, uint64_t count) {
+        m_nameMap.emplace_hint(m_nameMap.end(), name, m_numPoints);
+        m_points.emplace_back(name, m_numPoints);
+        m_points.back().countInc(count);
+        return m_numPoints++;
+    }
 };
 
 //######################################################################
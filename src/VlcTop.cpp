@@ -24,17 +24,212 @@
 #include "VlcOptions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <iterator>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
+// clang-format off
+#if !defined(_WIN32) && !defined(__MINGW32__)
+# define VL_VLC_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+// clang-format on
+
+//######################################################################
+// VlcMappedFile - Read only view of an input file's contents
+
+class VlcMappedFile final {
+    // MEMBERS
+    const char* m_datap = nullptr;  // File contents
+    size_t m_size = 0;  // Size of contents
+    bool m_ok = false;  // File was read
+#ifdef VL_VLC_MMAP
+    void* m_mapp = nullptr;  // Memory mapped contents, or nullptr if read into m_buffer
+#endif
+    string m_buffer;  // Contents when not memory mapped
+
+public:
+    // CONSTRUCTORS
+    explicit VlcMappedFile(const string& filename) {
+#ifdef VL_VLC_MMAP
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            m_ok = true;
+            m_size = static_cast<size_t>(st.st_size);
+            if (m_size) {
+                void* const mapp = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapp != MAP_FAILED) {
+                    ::madvise(mapp, m_size, MADV_SEQUENTIAL);
+                    m_mapp = mapp;
+                    m_datap = static_cast<const char*>(mapp);
+                }
+            }
+        }
+        ::close(fd);
+        if (m_mapp || (m_ok && !m_size)) return;
+        m_ok = false;
+        m_size = 0;
+#endif
+        // Fall back to reading the file, e.g. pipes or no mmap support
+        std::ifstream is{filename.c_str(), std::ios::binary};
+        if (!is) return;
+        m_buffer.assign(std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{});
+        m_ok = true;
+        m_datap = m_buffer.data();
+        m_size = m_buffer.size();
+    }
+    ~VlcMappedFile() {
+#ifdef VL_VLC_MMAP
+        if (m_mapp) ::munmap(m_mapp, m_size);
+#endif
+    }
+    VL_UNCOPYABLE(VlcMappedFile);
+
+    // ACCESSORS
+    bool ok() const { return m_ok; }
+    const char* data() const { return m_datap; }
+    size_t size() const { return m_size; }
+};
+
+//######################################################################
+// Coverage file parsing
+// Parsers only call pointCb(point, hits) for each point so they may run on
+// multiple threads; they return an error message, or empty if successful.
+
+template <typename T_PointCb>
+static string parseCoverageText(const char* datap, size_t size, T_PointCb pointCb) {
+    const char* const endp = datap + size;
+    string point;
+    for (const char* linep = datap; linep < endp;) {
+        const char* eolp = static_cast<const char*>(std::memchr(linep, '\n', endp - linep));
+        if (!eolp) eolp = endp;
+        if (linep[0] == 'C') {
+            const char* const startp = std::min(linep + 3, eolp);
+            const char* secp = startp;
+            for (; secp < eolp; ++secp) {
+                if (secp[0] == '\'' && secp + 1 < eolp && secp[1] == ' ') break;
+            }
+            point.assign(startp, secp - startp);
+            uint64_t hits = 0;
+            const char* cp = std::min(secp + 1, eolp);
+            while (cp < eolp && std::isspace(*cp)) ++cp;
+            for (; cp < eolp && std::isdigit(*cp); ++cp) hits = hits * 10 + (*cp - '0');
+            pointCb(point, hits);
+        }
+        linep = eolp + 1;
+    }
+    return "";
+}
+
+template <typename T_PointCb>
+static string parseCoverageBinary(const char* datap, size_t size, T_PointCb pointCb) {
+    // See VerilatedCovBinary for the format
+    const string corrupt = "Corrupt binary coverage file";
+    size_t pos = VerilatedCovBinary::MAGIC_SIZE;
+    // Return pointer to next column of 'colSize' bytes
+    const auto column = [&](uint64_t colSize) -> const char* {
+        const uint64_t padded = VerilatedCovBinary::padded(colSize);
+        if (padded < colSize || padded > size - pos) return nullptr;
+        const char* const colp = datap + pos;
+        pos += padded;
+        return colp;
+    };
+    if (size < VerilatedCovBinary::HEADER_SIZE) return corrupt;
+    uint32_t header32[2];
+    uint64_t header64[4];
+    uint32_t countBytes;
+    std::memcpy(header32, datap + pos, sizeof(header32));
+    std::memcpy(header64, datap + pos + sizeof(header32), sizeof(header64));
+    std::memcpy(&countBytes, datap + pos + sizeof(header32) + sizeof(header64),
+                sizeof(countBytes));
+    pos = VerilatedCovBinary::HEADER_SIZE;
+    if (header32[1] != VerilatedCovBinary::ENDIAN_MARK) {
+        return "Binary coverage file written on a machine with different byte order";
+    }
+    if (header32[0] != VerilatedCovBinary::VERSION) {
+        return "Unsupported binary coverage file version " + cvtToStr(header32[0]);
+    }
+    const uint64_t numStrings = header64[0];
+    const uint64_t stringBytes = header64[1];
+    const uint64_t numPoints = header64[2];
+    const uint64_t numRefs = header64[3];
+    if ((countBytes != 4 && countBytes != 8) || numStrings > size || numPoints > size
+        || numRefs > size) {
+        return corrupt;
+    }
+    const char* const stringEndsp = column(numStrings * sizeof(uint64_t));
+    const char* const blobp = stringEndsp ? column(stringBytes) : nullptr;
+    const char* const pointRefsp = blobp ? column(numPoints) : nullptr;
+    const char* const refsp = pointRefsp ? column(numRefs * sizeof(uint32_t)) : nullptr;
+    const char* const countsp = refsp ? column(numPoints * countBytes) : nullptr;
+    if (!countsp) return corrupt;
+
+    // Unpack the strings
+    std::vector<string> strings;
+    strings.reserve(numStrings);
+    uint64_t start = 0;
+    for (uint64_t i = 0; i < numStrings; ++i) {
+        uint64_t end;
+        std::memcpy(&end, stringEndsp + i * sizeof(uint64_t), sizeof(end));
+        if (end < start || end > stringBytes) return corrupt;
+        strings.emplace_back(blobp + start, end - start);
+        start = end;
+    }
+
+    uint64_t ref = 0;
+    string point;
+    for (uint64_t i = 0; i < numPoints; ++i) {
+        const uint8_t nrefs = static_cast<uint8_t>(pointRefsp[i]);
+        if (nrefs > numRefs - ref) return corrupt;
+        point.clear();
+        for (uint8_t r = 0; r < nrefs; ++r, ++ref) {
+            uint32_t id;
+            std::memcpy(&id, refsp + ref * sizeof(uint32_t), sizeof(id));
+            if (id >= numStrings) return corrupt;
+            point += strings[id];
+        }
+        uint64_t hits = 0;
+        if (countBytes == 8) {
+            std::memcpy(&hits, countsp + i * sizeof(uint64_t), sizeof(uint64_t));
+        } else {
+            uint32_t hits32;
+            std::memcpy(&hits32, countsp + i * sizeof(uint32_t), sizeof(uint32_t));
+            hits = hits32;
+        }
+        pointCb(point, hits);
+    }
+    return "";
+}
+
+template <typename T_PointCb>
+static string parseCoverage(const VlcMappedFile& file, T_PointCb pointCb) {
+    if (file.size() >= VerilatedCovBinary::MAGIC_SIZE
+        && std::memcmp(file.data(), VerilatedCovBinary::MAGIC, VerilatedCovBinary::MAGIC_SIZE)
+               == 0) {
+        return parseCoverageBinary(file.data(), file.size(), pointCb);
+    }
+    return parseCoverageText(file.data(), file.size(), pointCb);
+}
+
 //######################################################################
 
 void VlcTop::readCoverage(const string& filename, bool nonfatal) {
     UINFO(2, "readCoverage " << filename);
 
-    std::ifstream is{filename.c_str()};
-    if (!is) {
+    const VlcMappedFile file{filename};
+    if (!file.ok()) {
         if (!nonfatal) v3fatal("Can't read coverage file: " << filename);
         return;
     }
@@ -42,28 +237,103 @@ void VlcTop::readCoverage(const string& filename, bool nonfatal) {
     // Testrun and computrons argument unsupported as yet
     VlcTest* const testp = tests().newTest(filename, 0, 0);
 
-    while (!is.eof()) {
-        const string line = V3Os::getline(is);
-        // UINFO(9, " got " << line);
-        if (line[0] == 'C') {
-            string::size_type secspace = 3;
-            for (; secspace < line.length(); secspace++) {
-                if (line[secspace] == '\'' && line[secspace + 1] == ' ') break;
-            }
-            const string point = line.substr(3, secspace - 3);
-            if (!opt.isTypeMatch(point.c_str())) continue;
+    const string err = parseCoverage(file, [&](const string& point, uint64_t hits) {
+        readCoveragePoint(testp, point, hits);
+    });
+    if (!err.empty()) v3fatal(err << ": " << filename);
+}
 
-            const uint64_t hits = std::atoll(line.c_str() + secspace + 1);
-            // UINFO(9, "   point '" << point << "'" << " " << hits);
+void VlcTop::readCoveragePoint(VlcTest* testp, const string& point, uint64_t hits) {
+    if (!opt.isTypeMatch(point.c_str())) return;
+    const uint64_t pointnum = points().findAddPoint(point, hits);
+    if (opt.rank()) {  // Only if ranking - uses a lot of memory
+        if (hits >= VlcBuckets::sufficient()) {
+            points().pointNumber(pointnum).testsCoveringInc();
+            testp->buckets().addData(pointnum, hits);
+        }
+    }
+}
 
-            const uint64_t pointnum = points().findAddPoint(point, hits);
-            if (opt.rank()) {  // Only if ranking - uses a lot of memory
-                if (hits >= VlcBuckets::sufficient()) {
-                    points().pointNumber(pointnum).testsCoveringInc();
-                    testp->buckets().addData(pointnum, hits);
-                }
+void VlcTop::readCoverageFiles(const VlStringSet& filenames) {
+    // Per-test buckets need points numbered in file order, so ranking reads serially
+    if (opt.threads() <= 1 || opt.rank() || filenames.size() <= 1) {
+        for (const auto& filename : filenames) readCoverage(filename);
+        return;
+    }
+    const std::vector<string> files{filenames.begin(), filenames.end()};
+    const size_t nthreads = std::min<size_t>(opt.threads(), files.size());
+    UINFO(2, "readCoverageFiles " << files.size() << " files on " << nthreads << " threads");
+
+    // Each thread reads whole files, summing each point into the shard selected by
+    // the point name's hash.  Then each thread merges one shard across all threads,
+    // so every point is summed by exactly one thread without any locking.
+    using Shard = std::unordered_map<string, uint64_t>;
+    std::vector<std::vector<Shard>> shards(nthreads, std::vector<Shard>(nthreads));
+    std::vector<string> errors(files.size());
+    std::atomic<size_t> nextFile{0};
+    const auto runThreads = [nthreads](const std::function<void(size_t)>& func) {
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < nthreads; ++t) threads.emplace_back(func, t);
+        func(0);
+        for (std::thread& thread : threads) thread.join();
+    };
+    runThreads([&](size_t t) {
+        std::vector<Shard>& ownShards = shards[t];
+        const std::hash<string> hasher;
+        for (size_t f = nextFile++; f < files.size(); f = nextFile++) {
+            const VlcMappedFile file{files[f]};
+            if (!file.ok()) {
+                errors[f] = "Can't read coverage file";
+                continue;
             }
+            errors[f] = parseCoverage(file, [&](const string& point, uint64_t hits) {
+                if (!opt.isTypeMatch(point.c_str())) return;
+                // Use upper hash bits, as the shard's own table uses the lower bits
+                const uint64_t hash = static_cast<uint64_t>(hasher(point));
+                const size_t shard = ((hash * 0x9e3779b97f4a7c15ULL) >> 32) % nthreads;
+                ownShards[shard][point] += hits;
+            });
         }
+    });
+    for (size_t f = 0; f < files.size(); ++f) {
+        if (!errors[f].empty()) v3fatal(errors[f] << ": " << files[f]);
+        tests().newTest(files[f], 0, 0);
+    }
+
+    // Merge each shard across threads, then sort it by name
+    using SortedShard = std::vector<std::pair<string, uint64_t>>;
+    std::vector<SortedShard> sorted(nthreads);
+    runThreads([&](size_t s) {
+        Shard& merged = shards[0][s];
+        for (size_t t = 1; t < nthreads; ++t) {
+            Shard& other = shards[t][s];
+            if (other.size() > merged.size()) std::swap(merged, other);
+            for (auto& it : other) merged[it.first] += it.second;
+            Shard{}.swap(other);
+        }
+        SortedShard& out = sorted[s];
+        out.reserve(merged.size());
+        for (auto& it : merged) out.emplace_back(it.first, it.second);
+        Shard{}.swap(merged);
+        std::sort(out.begin(), out.end());
+    });
+
+    // Insert in name order; shards are disjoint so this is a simple k-way merge
+    std::vector<size_t> heads(nthreads, 0);
+    while (true) {
+        const std::pair<string, uint64_t>* minp = nullptr;
+        size_t minShard = 0;
+        for (size_t s = 0; s < nthreads; ++s) {
+            if (heads[s] >= sorted[s].size()) continue;
+            const std::pair<string, uint64_t>& head = sorted[s][heads[s]];
+            if (!minp || head.first < minp->first) {
+                minp = &head;
+                minShard = s;
+            }
+        }
+        if (!minp) break;
+        points().appendPoint(minp->first, minp->second);
+        ++heads[minShard];
     }
 }
 
@@ -209,14 +479,21 @@ void VlcTop::rank() {
 
 void VlcTop::annotateCalc() {
     // Calculate per-line information into filedata structure
+    // Points are sorted by name, which starts with the filename, so cache the last source
+    string lastFilename;
+    VlcSource* lastSourcep = nullptr;
     for (const auto& i : m_points) {
         const VlcPoint& point = m_points.pointNumber(i.second);
-        const string filename = point.filename();
+        string filename = point.filename();
         const int lineno = point.lineno();
         if (!filename.empty() && lineno != 0) {
-            VlcSource& source = sources().findNewSource(filename);
-            UINFO(9, "AnnoCalc count " << filename << ":" << lineno << ":" << point.column() << " "
-                                       << point.count() << " " << point.linescov());
+            if (!lastSourcep || filename != lastFilename) {
+                lastSourcep = &sources().findNewSource(filename);
+                lastFilename = std::move(filename);
+            }
+            VlcSource& source = *lastSourcep;
+            UINFO(9, "AnnoCalc count " << lastFilename << ":" << lineno << ":" << point.column()
+                                       << " " << point.count() << " " << point.linescov());
             // Base coverage
             source.insertPoint(lineno, &point);
             // Additional lines covered by this statement
@@ -299,14 +576,16 @@ void VlcTop::annotateOutputFiles(const string& dirname) {
 
         os << "//      // verilator_coverage annotation\n";
 
+        // Lines are sorted, so step through them with the file rather than searching
+        VlcSource::LinenoMap& lines = source.lines();
+        auto lit = lines.begin();
         int lineno = 0;
         while (!is.eof()) {
             lineno++;
             string line = V3Os::getline(is);
 
-            VlcSource::LinenoMap& lines = source.lines();
-            const auto lit = lines.find(lineno);
-            if (lit == lines.end()) {
+            while (lit != lines.end() && lit->first < lineno) ++lit;
+            if (lit == lines.end() || lit->first != lineno) {
                 os << "        " << line << '\n';
             } else {
                 VlcSourceCount& sc = lit->second;
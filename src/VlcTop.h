@@ -39,6 +39,7 @@ private:
     VlcSources m_sources;  //< List of all source files to annotate
 
     // METHODS
+    void readCoveragePoint(VlcTest* testp, const string& point, uint64_t hits);
     void annotateCalc();
     void annotateCalcNeeded();
     void annotateOutputFiles(const string& dirname);
@@ -56,6 +57,7 @@ public:
     // METHODS
     void annotate(const string& dirname);
     void readCoverage(const string& filename, bool nonfatal = false);
+    void readCoverageFiles(const VlStringSet& filenames);
     void writeCoverage(const string& filename);
     void writeInfo(const string& filename);
 
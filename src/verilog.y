@@ -159,6 +159,17 @@ public:
             return new AstGatePin{rangep->fileline(), exprp, rangep->cloneTree(true)};
         }
     }
+    AstSExpr* createSExpr(AstNodeExpr* preExprp, AstNode* delayp, AstNodeExpr* exprp) {
+        // A cycle delay range is parsed as an AstRange, a single cycle delay as an expression
+        FileLine* const fl = delayp->fileline();
+        AstNodeExpr* maxDelayp = nullptr;
+        if (AstRange* const rangep = VN_CAST(delayp, Range)) {
+            delayp = rangep->leftp()->unlinkFrBack();
+            maxDelayp = rangep->rightp()->unlinkFrBack();
+            VL_DO_DANGLING(rangep->deleteTree(), rangep);
+        }
+        return new AstSExpr{fl, preExprp, VN_AS(delayp, NodeExpr), maxDelayp, exprp};
+    }
     AstSenTree* createClockSenTree(FileLine* fl, AstNodeExpr* exprp) {
         return new AstSenTree{fl, new AstSenItem{fl, VEdgeType::ET_CHANGED, exprp}};
     }
@@ -6615,7 +6626,12 @@ pexpr<nodeExprp>:  // IEEE: property_expr  (The name pexpr is important as regex
         //
         //                      // IEEE: "sequence_expr yP_ORMINUSGT pexpr"
         //                      // Instead we use pexpr to prevent conflicts
-        |       ~o~pexpr yP_ORMINUSGT pexpr             { $$ = new AstLogOr{$2, new AstLogNot{$2, $1}, $3}; }
+        |       ~o~pexpr yP_ORMINUSGT pexpr
+                        { if (VN_IS($3, SExpr)) {
+                              $$ = new AstImplication{$2, $1, $3, true};
+                          } else {
+                              $$ = new AstLogOr{$2, new AstLogNot{$2, $1}, $3};
+                          } }
         |       ~o~pexpr yP_OREQGT pexpr                { $$ = new AstImplication{$2, $1, $3}; }
         //
         //                      // IEEE-2009: property_statement
@@ -6694,9 +6710,9 @@ sexpr<nodeExprp>:  // ==IEEE: sequence_expr  (The name sexpr is important as reg
         //                      // IEEE: "sequence_expr cycle_delay_range sequence_expr { cycle_delay_range sequence_expr }"
         //                      // Both rules basically mean we can repeat sequences, so make it simpler:
                 cycle_delay_range sexpr  %prec yP_POUNDPOUND
-                        { $$ = $2; BBUNSUP($2->fileline(), "Unsupported: ## (in sequence expression)"); }
+                        { $$ = GRAMMARP->createSExpr(nullptr, $1, $2); }
         |       ~p~sexpr cycle_delay_range sexpr %prec prPOUNDPOUND_MULTI
-                        { $$ = $1; BBUNSUP($2->fileline(), "Unsupported: ## (in sequence expression)"); }
+                        { $$ = GRAMMARP->createSExpr($1, $2, $3); }
         //
         //                      // IEEE: expression_or_dist [ boolean_abbrev ]
         //                      // Note expression_or_dist includes "expr"!
@@ -6747,23 +6763,17 @@ sexpr<nodeExprp>:  // ==IEEE: sequence_expr  (The name sexpr is important as reg
 
 cycle_delay_range<nodep>:  // IEEE: ==cycle_delay_range
         //                      // These three terms in 1800-2005 ONLY
-                yP_POUNDPOUND intnumAsConst
-                        { $$ = $2;
-                          BBUNSUP($<fl>1, "Unsupported: ## () cycle delay range expression"); }
+                yP_POUNDPOUND intnumAsConst             { $$ = $2; }
         |       yP_POUNDPOUND idAny
                         { $$ = new AstConst{$1, AstConst::BitFalse{}};
                           BBUNSUP($<fl>1, "Unsupported: ## id cycle delay range expression"); }
-        |       yP_POUNDPOUND '(' constExpr ')'
-                        { $$ = $3;
-                          BBUNSUP($<fl>1, "Unsupported: ## () cycle delay range expression"); }
+        |       yP_POUNDPOUND '(' constExpr ')'         { $$ = $3; }
         //                      // In 1800-2009 ONLY:
         //                      // IEEE: yP_POUNDPOUND constant_primary
         //                      // UNSUP: This causes a big grammar ambiguity
         //                      // as ()'s mismatch between primary and the following statement
         //                      // the sv-ac committee has been asked to clarify  (Mantis 1901)
-        |       yP_POUNDPOUND anyrange
-                        { $$ = new AstConst{$1, AstConst::BitFalse{}};
-                          BBUNSUP($<fl>1, "Unsupported: ## range cycle delay range expression"); }
+        |       yP_POUNDPOUND anyrange                  { $$ = $2; }
         |       yP_POUNDPOUND yP_BRASTAR ']'
                         { $$ = new AstConst{$1, AstConst::BitFalse{}};
                           BBUNSUP($<fl>1, "Unsupported: ## [*] cycle delay range expression"); }
@@ -1025,6 +1025,11 @@ class VlTest:
                 self.trace_format = 'fst-sc'  # pylint: disable=attribute-defined-outside-init
             else:
                 self.trace_format = 'fst-c'  # pylint: disable=attribute-defined-outside-init
+        elif re.search(r'-trace-raw', checkflags):
+            if self.sc:
+                self.trace_format = 'raw-sc'  # pylint: disable=attribute-defined-outside-init
+            else:
+                self.trace_format = 'raw-c'  # pylint: disable=attribute-defined-outside-init
         elif re.search(r'-trace-saif', checkflags):
             if self.sc:
                 self.trace_format = 'saif-sc'  # pylint: disable=attribute-defined-outside-init
@@ -1585,6 +1590,8 @@ class VlTest:
     def trace_filename(self) -> str:
         if re.match(r'^fst', self.trace_format):
             return self.obj_dir + "/simx.fst"
+        if re.match(r'^raw', self.trace_format):
+            return self.obj_dir + "/simx.raw"
         if re.match(r'^saif', self.trace_format):
             return self.obj_dir + "/simx.saif"
         return self.obj_dir + "/simx.vcd"
@@ -1913,6 +1920,10 @@ class VlTest:
                 fh.write("#include \"verilated_vcd_c.h\"\n")
             if self.trace and self.trace_format == 'vcd-sc':
                 fh.write("#include \"verilated_vcd_sc.h\"\n")
+            if self.trace and self.trace_format == 'raw-c':
+                fh.write("#include \"verilated_raw_c.h\"\n")
+            if self.trace and self.trace_format == 'raw-sc':
+                fh.write("#include \"verilated_raw_sc.h\"\n")
             if self.trace and self.trace_format == 'saif-c':
                 fh.write("#include \"verilated_saif_c.h\"\n")
             if self.trace and self.trace_format == 'saif-sc':
@@ -2000,6 +2011,10 @@ class VlTest:
                     fh.write("    std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC};\n")
                 if self.trace_format == 'vcd-sc':
                     fh.write("    std::unique_ptr<VerilatedVcdSc> tfp{new VerilatedVcdSc};\n")
+                if self.trace_format == 'raw-c':
+                    fh.write("    std::unique_ptr<VerilatedRawC> tfp{new VerilatedRawC};\n")
+                if self.trace_format == 'raw-sc':
+                    fh.write("    std::unique_ptr<VerilatedRawSc> tfp{new VerilatedRawSc};\n")
                 if self.trace_format == 'saif-c':
                     fh.write("    std::unique_ptr<VerilatedSaifC> tfp{new VerilatedSaifC};\n")
                 if self.trace_format == 'saif-sc':
@@ -2412,6 +2427,16 @@ class VlTest:
         self.fst2vcd(fn1, tmp)
         self.vcd_identical(tmp, fn2)
 
+    def raw2vcd(self, fn1: str, fn2: str) -> None:
+        cmd = os.environ["VERILATOR_ROOT"] + '/bin/verilator_raw2vcd "' + fn1 + '" -o "' + fn2 + '"'
+        self.run(cmd=[cmd], logfile=fn2 + ".log")
+
+    def raw_identical(self, fn1: str, fn2: str) -> None:
+        """Test if a raw trace file has logically-identical contents to a VCD file"""
+        tmp = fn1 + ".vcd"
+        self.raw2vcd(fn1, tmp)
+        self.vcd_identical(tmp, fn2)
+
     def saif_identical(self, fn1: str, fn2: str) -> None:
         """Test if two SAIF files have logically-identical contents"""
 
@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [7:0] x = 0;
+   integer fails = 0;
+
+   // Would fail while assertions are off
+   assert property (@(posedge clk) cyc < 5 || cyc > 8) else fails = fails + 1;
+   // $past history must be valid again after turning assertions back on
+   assert property (@(posedge clk) cyc < 12 || x == $past(x) + 1) else fails = fails + 1;
+   // Fails once after turning assertions back on
+   assert property (@(posedge clk) cyc != 15) else fails = fails + 1;
+
+   always @(posedge clk) begin
+      // Sampled values outside assertions are never skipped
+      if ($sampled(x) != x) $stop;
+      cyc <= cyc + 1;
+      x <= x + 1;
+      if (cyc == 2) $assertoff;
+      if (cyc == 10) $asserton;
+      if (cyc == 20) begin
+         if (fails != 1) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,79 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+   reg a = 0;
+   reg b = 0;
+   reg c = 0;
+   wire rst = (cyc % 17) < 3;
+
+   // Sampled history, indexed by cycle
+   reg ha[0:127];
+   reg hb[0:127];
+   reg hc[0:127];
+   reg hrst[0:127];
+
+   integer fails1 = 0, expFails1 = 0;
+   integer fails2 = 0, expFails2 = 0;
+   integer fails3 = 0, expFails3 = 0;
+   integer covers = 0, expCovers = 0;
+
+   assert property (@(posedge clk) a |-> ##2 b) else fails1 = fails1 + 1;
+   assert property (@(posedge clk) a |=> ##[1:3] c) else fails2 = fails2 + 1;
+   assert property (@(posedge clk) disable iff (rst) a |-> ##1 b) else fails3 = fails3 + 1;
+   cover property (@(posedge clk) a ##1 b ##[0:2] c) covers = covers + 1;
+
+   function automatic bit coverAt(integer t);
+      // An attempt starting at t0 matches at t unless it matched at an earlier c
+      for (integer t0 = t - 3; t0 <= t - 1; ++t0) begin
+         if (t0 >= 0 && ha[t0] && hb[t0 + 1] && hc[t]) begin
+            bit earlier = 0;
+            for (integer e = t0 + 1; e < t; ++e) if (hc[e]) earlier = 1;
+            if (!earlier) return 1;
+         end
+      end
+      return 0;
+   endfunction
+
+   always @(posedge clk) begin
+      ha[cyc] = a;
+      hb[cyc] = b;
+      hc[cyc] = c;
+      hrst[cyc] = rst;
+      if (cyc >= 2 && ha[cyc - 2] && !hb[cyc]) expFails1 = expFails1 + 1;
+      if (cyc >= 4 && ha[cyc - 4] && !hc[cyc - 2] && !hc[cyc - 1] && !hc[cyc])
+        expFails2 = expFails2 + 1;
+      if (cyc >= 1 && !hrst[cyc - 1] && !hrst[cyc] && ha[cyc - 1] && !hb[cyc])
+        expFails3 = expFails3 + 1;
+      if (coverAt(cyc)) expCovers = expCovers + 1;
+
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      // Go quiet at the end so every attempt has completed before checking
+      a <= cyc < 90 && crc[0] && crc[1];
+      b <= cyc < 90 && (crc[4] || crc[5]);
+      c <= cyc < 90 && crc[8] && crc[9];
+      if (cyc == 99) begin
+`ifdef TEST_VERBOSE
+         $write("fails %0d/%0d %0d/%0d %0d/%0d covers %0d/%0d\n", fails1, expFails1,
+                fails2, expFails2, fails3, expFails3, covers, expCovers);
+`endif
+         if (fails1 != expFails1 || fails2 != expFails2 || fails3 != expFails3) $stop;
+         if (covers != expCovers) $stop;
+         if (expFails1 == 0 || expFails2 == 0 || expFails3 == 0 || expCovers == 0) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
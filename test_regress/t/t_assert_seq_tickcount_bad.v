@@ -0,0 +1,19 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk, a, b
+   );
+   input clk;
+   input a;
+   input b;
+
+   // Within the limit, no warning
+   assert property (@(posedge clk) a |-> ##255 b);
+   // TICKCOUNT
+   assert property (@(posedge clk) a |-> ##300 b);
+endmodule
@@ -0,0 +1,79 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+
+   integer cyc = 0;
+
+   // Wide sparse case, too wide for a value table
+   function automatic [7:0] decode(input [31:0] addr);
+      decode = 8'h5a;
+      case (addr)
+        32'h0000_0000, 32'h0000_0001, 32'h0000_0002, 32'h0000_0003: decode = 8'h10;
+        32'h0000_1000: decode = 8'h11;
+        32'h0000_2000: decode = 8'h12;
+        32'h1000_0000: decode = 8'h13;
+        32'h1000_0004: decode = 8'h14;
+        32'h1000_0008: decode = 8'h15;
+        32'h8000_0000: decode = 8'h16;
+        32'h0000_1000: decode = 8'hee;  // Duplicate, earlier item wins
+        32'hffff_fffe, 32'hffff_ffff: decode = 8'h17;
+        32'h4000_0000: ;  // Keeps the earlier assignment
+        default: decode = 8'hff;
+      endcase
+   endfunction
+
+   // Same decode, written as an if chain for reference
+   function automatic [7:0] expect_decode(input [31:0] addr);
+      if (addr <= 3) return 8'h10;
+      if (addr == 32'h0000_1000) return 8'h11;
+      if (addr == 32'h0000_2000) return 8'h12;
+      if (addr == 32'h1000_0000) return 8'h13;
+      if (addr == 32'h1000_0004) return 8'h14;
+      if (addr == 32'h1000_0008) return 8'h15;
+      if (addr == 32'h8000_0000) return 8'h16;
+      if (addr >= 32'hffff_fffe) return 8'h17;
+      if (addr == 32'h4000_0000) return 8'h5a;
+      return 8'hff;
+   endfunction
+
+   reg [31:0] addr;
+   always_comb begin
+      case (cyc[3:0])
+        0: addr = 32'h0000_0000;
+        1: addr = 32'h0000_0003;
+        2: addr = 32'h0000_0004;
+        3: addr = 32'h0000_1000;
+        4: addr = 32'h0000_2000;
+        5: addr = 32'h1000_0004;
+        6: addr = 32'h1000_0006;
+        7: addr = 32'h8000_0000;
+        8: addr = 32'hffff_fffe;
+        9: addr = 32'hffff_ffff;
+        10: addr = 32'h4000_0000;
+        11: addr = 32'h0fff_ffff;
+        default: addr = {cyc[7:0], 24'h0};
+      endcase
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+`ifdef TEST_VERBOSE
+      $write("[%0t] cyc=%0d addr=%x decode=%x\n", $time, cyc, addr, decode(addr));
+`endif
+      if (decode(addr) !== expect_decode(addr)) $stop;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,78 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Objects are deleted at the end of each eval, and their memory recycled for
+// the next cycle's objects, which must still be freshly initialized
+
+class Item;
+   int id;
+   int payload = 32'hdead_beef;
+   logic [127:0] wide;
+   string name = "item";
+   Item next;
+   function new(int i);
+      id = i;
+   endfunction
+endclass
+
+class BigItem extends Item;
+   int extra[8];
+   function new(int i);
+      super.new(i);
+      foreach (extra[j]) extra[j] = i + j;
+   endfunction
+endclass
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   Item keep;
+
+   always @ (posedge clk) begin
+      Item head;
+      Item it;
+      BigItem big;
+      int count;
+      cyc <= cyc + 1;
+      // A new list every cycle, the previous one becoming garbage
+      for (int i = 0; i < 100; ++i) begin
+         if (i % 3 == 0) begin
+            big = new(i);
+            it = big;
+         end
+         else begin
+            it = new(i);
+         end
+         if (it.payload != 32'hdead_beef) $stop;
+         if (it.wide != 0) $stop;
+         if (it.name != "item") $stop;
+         if (it.next != null) $stop;
+         it.payload = cyc;
+         it.wide = {4{cyc}};
+         it.name = "used";
+         it.next = head;
+         head = it;
+      end
+      // Keep one object alive across cycles, while others are recycled
+      if (cyc == 3) keep = head.next;
+      if (keep != null && (keep.id != 98 || keep.payload != 3)) $stop;
+      count = 0;
+      for (it = head; it != null; it = it.next) begin
+         if (it.id != 99 - count) $stop;
+         if ($cast(big, it) && big.extra[7] != it.id + 7) $stop;
+         ++count;
+      end
+      if (count != 100) $stop;
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,67 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define check_rand(cl, field, cond) \
+begin \
+   longint prev_result; \
+   int ok = 0; \
+   if (!bit'(cl.randomize())) $stop; \
+   prev_result = longint'(field); \
+   if (!(cond)) $stop; \
+   repeat(19) begin \
+      longint result; \
+      if (!bit'(cl.randomize())) $stop; \
+      result = longint'(field); \
+      if (!(cond)) $stop; \
+      if (result != prev_result) ok = 1; \
+      prev_result = result; \
+   end \
+   if (ok != 1) $stop; \
+end
+
+// Constraints on independent variables, randomized without the solver
+class Ranges;
+   rand bit [7:0] a;
+   rand int b;
+   rand bit [63:0] c;
+   rand byte d;
+   rand bit [3:0] e;
+   rand int unsigned f;
+   constraint c_a { a > 10; a <= 20; }
+   constraint c_b { b inside {[-5:-1], 7, [100:102]}; }
+   constraint c_c { c != 0; }
+   constraint c_d { d dist { -3 := 1, [4:6] :/ 2, 9 := 0 }; }
+   constraint c_e { !(e < 12) || e == 3; }
+   constraint c_f { f == 32'hdeadbeef; }
+endclass
+
+class Unsat;
+   rand int x;
+   constraint c_x { x > 5; x < 5; }
+endclass
+
+module t;
+   initial begin
+      Ranges r = new;
+      Unsat u = new;
+      `check_rand(r, r.a, r.a > 10 && r.a <= 20);
+      `check_rand(r, r.b, r.b inside {[-5:-1], 7, [100:102]});
+      `check_rand(r, r.c, r.c != 0);
+      `check_rand(r, r.d, r.d inside {-3, [4:6]});
+      `check_rand(r, r.e, r.e inside {3, [12:15]});
+      repeat (10) begin
+         if (!bit'(r.randomize())) $stop;
+         if (r.f != 32'hdeadbeef) $stop;
+      end
+
+      u.x = 42;
+      if (bit'(u.randomize())) $stop;
+      if (u.x != 42) $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_constraint.v"
+
+
+def have_z3_library():
+    cmd = "echo '#include <z3.h>' | ${CXX:-c++} -E -x c++ - >/dev/null 2>&1 && echo z3found"
+    nout = test.run_capture(cmd, check=False)
+    return bool(nout and re.search(r'z3found', nout))
+
+
+if not have_z3_library():
+    test.skip("No Z3 library installed")
+
+# Solve in-process with the linked library, no solver program is needed
+test.compile(verilator_flags2=['-Wno-CONSTRAINTIGN -CFLAGS -DVL_SOLVER_Z3 -LDFLAGS -lz3'])
+
+test.execute(run_env='VERILATOR_SOLVER=/nonexistent/solver')
+
+test.passes()
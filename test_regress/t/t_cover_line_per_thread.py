@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_cover_line.v"
+test.golden_filename = "t/t_cover_line.out"
+
+test.compile(verilator_flags2=['--cc --coverage-line --coverage-per-thread +define+ATTRIBUTE'],
+             threads=2)
+
+syms_h = test.obj_dir + "/" + test.vm_prefix + "__Syms.h"
+test.file_grep(syms_h, r'VerilatedCovShards __Vcoverage;')
+test.file_grep_not(syms_h, r'std::atomic<uint32_t>')
+
+test.execute()
+
+test.run(cmd=[os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+              "--annotate-points",
+              "--annotate", test.obj_dir + "/annotated",
+              test.obj_dir + "/coverage.dat"],
+         verilator_run=True)  # yapf:disable
+
+test.files_identical(test.obj_dir + "/annotated/t_cover_line.v", test.golden_filename)
+
+test.passes()
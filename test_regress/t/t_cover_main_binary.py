@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_cover_main.v"
+test.golden_filename = "t/t_cover_main.out"
+
+test.compile(verilator_flags2=['--binary --coverage-line'])
+
+test.execute(all_run_flags=[
+    " +verilator+coverage+binary", " +verilator+coverage+file+" + test.obj_dir + "/coverage.datb"
+])
+
+test.file_grep_not(test.obj_dir + "/coverage.datb", r"# SystemC::Coverage")
+
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+    "--write",
+    test.obj_dir + "/coverage.dat",
+    test.obj_dir + "/coverage.datb",
+],
+         verilator_run=True)
+
+test.files_identical_sorted(test.obj_dir + "/coverage.dat", test.golden_filename)
+test.passes()
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_cover_toggle.v"
+
+test.compile(verilator_flags2=['--cc --coverage-line --coverage-toggle --coverage-hit-once'])
+
+test.execute()
+
+# Every point is reported as hit or not hit
+counts = {}
+with open(test.obj_dir + "/coverage.dat", 'r', encoding="utf8") as fh:
+    for line in fh:
+        match = re.search(r"^C '.*' (\d+)$", line)
+        if match:
+            counts[match.group(1)] = counts.get(match.group(1), 0) + 1
+if sorted(counts.keys()) != ['0', '1']:
+    test.error("Expected only 0 and 1 counts, got: " + str(counts))
+
+test.passes()
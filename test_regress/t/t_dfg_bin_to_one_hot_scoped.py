@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_dfg_bin_to_one_hot.v"
+
+test.compile(verilator_flags2=["--stats", "-fno-dfg-pre-inline", "-fno-dfg-post-inline"])
+
+test.execute()
+
+test.file_grep(test.stats, r'Optimizations, DFG scoped BinToOneHot, decoders created\s+[1-9]')
+
+test.passes()
@@ -0,0 +1,54 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define check(got ,exp) do if ((got) !== (exp)) begin $write("%%Error: %s:%0d: cyc=%0d got='h%x exp='h%x\n", `__FILE__,`__LINE__, cyc, (got), (exp)); `stop; end while(0)
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [31:0] cyc = 0;
+   reg [255:0] a = 0;
+   reg [255:0] b = 0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      a <= {a[254:0], a[255] ^ a[200] ^ ~cyc[0]};
+      b <= {b[253:0], b[255:254] ^ cyc[1:0]};
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   // Wide operations of which only a few bits are read
+   wire [255:0] bitAnd = a & b;
+   wire [255:0] bitXor = ~(a ^ b);
+   wire [255:0] sum = a + b;
+   wire [255:0] prod = a * b;
+
+   wire [7:0] andLo = bitAnd[107:100];
+   wire [7:0] andHi = bitAnd[123:116];
+   wire [7:0] xorLo = bitXor[7:0];
+   wire [7:0] xorHi = bitXor[15:8];
+   wire [15:0] sumLo = sum[15:0];
+   wire [15:0] sumHi = sum[31:16];
+   wire [7:0] prodLo = prod[7:0];
+   wire [7:0] prodHi = prod[15:8];
+
+   always @ (posedge clk) begin
+      `check(andLo, a[107:100] & b[107:100]);
+      `check(andHi, a[123:116] & b[123:116]);
+      `check(xorLo, ~(a[7:0] ^ b[7:0]));
+      `check(xorHi, ~(a[15:8] ^ b[15:8]));
+      `check({sumHi, sumLo}, a[31:0] + b[31:0]);
+      `check({prodHi, prodLo}, a[15:0] * b[15:0]);
+   end
+
+endmodule
@@ -111,6 +111,7 @@ module t (
    `signal(SWAP_CONST_IN_COMMUTATIVE_BINARY, rand_a + const_a);
    `signal(SWAP_NOT_IN_COMMUTATIVE_BINARY, rand_a + ~rand_a);
    `signal(SWAP_VAR_IN_COMMUTATIVE_BINARY, rand_b + rand_a);
+   `signal(SWAP_VAR_IN_COMMUTATIVE_ASSOC_CHAIN, rand_b | (rand_a | (rand_b >> 1)));
    `signal(PUSH_BITWISE_OP_THROUGH_CONCAT, 32'h12345678 ^ {8'h0, rand_a[23:0]});
    `signal(PUSH_BITWISE_OP_THROUGH_CONCAT_2, 32'h12345678 ^ {rand_b[7:0], rand_a[23:0]});
    `signal(PUSH_COMPARE_OP_THROUGH_CONCAT, 4'b1011 == {2'b10, rand_a[1:0]});
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_dpi_arg_inout_unpack.v"
+
+test.compile(v_flags2=["t/t_dpi_arg_inout_unpack.cpp"],
+             verilator_flags2=["-Wall -Wno-DECLFILENAME --stats"])
+
+# Arrays of int and wide bit vectors are passed without a temporary
+test.file_grep(test.stats, r'Optimizations, DPI arguments passed directly\s+([1-9]\d*)')
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp"),
+                   r'reinterpret_cast<int\*>\(&')
+
+test.execute()
+
+test.passes()
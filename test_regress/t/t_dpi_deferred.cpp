@@ -0,0 +1,31 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+//*************************************************************************
+
+#include "svdpi.h"
+
+#include "Vt_dpi_deferred__Dpi.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+//======================================================================
+
+static long long s_total = 0;
+static std::thread::id s_mainId = std::this_thread::get_id();
+
+void dpii_accum(int i, const svBitVecVal* w) {
+    if (std::this_thread::get_id() == s_mainId) {
+        printf("%%Error: dpii_accum called on the eval thread\n");
+        exit(1);
+    }
+    s_total += i + w[0] + w[2];
+}
+
+long long dpii_total() { return s_total; }
@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+import "DPI-C" function void dpii_accum(int i, bit [95:0] w);
+import "DPI-C" function longint dpii_total();
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   longint expected = 0;
+   bit [95:0] wide;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      wide = {cyc, 32'h0, cyc};
+      // Arguments are copied, so later changes do not affect queued calls
+      dpii_accum(cyc, wide);
+      wide = '0;
+      expected = expected + 3 * cyc;
+      // A non-deferred import sees all earlier deferred calls completed
+      if (dpii_total() != expected) begin
+         $display("%%Error: cyc=%0d total=%0d expected=%0d", cyc, dpii_total(), expected);
+         $stop;
+      end
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
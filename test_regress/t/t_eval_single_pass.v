@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   integer ncyc = 0;
+   logic [31:0] crc = 32'h5aef0c8d;
+
+   // Clock derived from an input, so not straight-line, but the logic it
+   // triggers never changes it, so each loop needs only one pass
+   wire gclk = ~clk;
+
+   // Combinational logic from clocked state, settled in the same eval
+   wire [31:0] swapped = {crc[15:0], crc[31:16]};
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[30:0], crc[31] ^ crc[21] ^ crc[1] ^ crc[0]};
+      if (swapped !== {crc[15:0], crc[31:16]}) $stop;
+      if (cyc == 99) begin
+         $write("[%0t] cyc=%0d ncyc=%0d\n", $time, cyc, ncyc);
+         if (ncyc !== cyc && ncyc !== cyc + 1) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   always @(posedge gclk) ncyc <= ncyc + 1;
+
+endmodule
@@ -0,0 +1,45 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+
+#include <cstdio>
+#include VM_PREFIX_INCLUDE
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    topp->clk = 0;
+    topp->narrow = 0;
+    topp->wide[0] = topp->wide[1] = topp->wide[2] = 0;
+
+    IData base = 0;
+    for (int cyc = 0; cyc < 20; ++cyc) {
+        topp->clk = !topp->clk;
+        // Repeated evals without input changes must not disturb the state
+        for (int i = 0; i < 3; ++i) topp->eval();
+        if (cyc % 4 == 1) topp->narrow = cyc;
+        if (cyc % 4 == 3) topp->wide[2] = cyc << 8;
+        topp->eval();
+        if (cyc == 0) base = topp->count;
+        const IData rep = topp->narrow * 0x01010101U;
+        if (topp->count != base + cyc / 2 || topp->wout[0] != rep
+            || topp->wout[1] != rep || topp->wout[2] != (rep ^ topp->wide[2])) {
+            printf("%%Error: cyc=%d count=%u wout=%08x_%08x_%08x\n", cyc, topp->count,
+                   topp->wout[2], topp->wout[1], topp->wout[0]);
+            return 1;
+        }
+    }
+
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
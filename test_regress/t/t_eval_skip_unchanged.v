@@ -0,0 +1,17 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input [7:0] narrow,
+    input [95:0] wide,
+    output [95:0] wout,
+    output logic [31:0] count
+);
+  initial count = 0;
+  assign wout = wide ^ {12{narrow}};
+  always @(posedge clk) count <= count + 1;
+endmodule
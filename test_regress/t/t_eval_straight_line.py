@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--eval-straight-line", "--stats"])
+
+test.file_grep(test.stats, r'Scheduling, straight-line eval\s+1')
+for filename in test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp"):
+    test.file_grep_not(filename, r'_eval_phase__')
+
+test.execute()
+
+test.passes()
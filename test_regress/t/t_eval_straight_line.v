@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [31:0] crc = 32'h5aef0c8d;
+   logic [31:0] sum = 0;
+   logic [31:0] nsum = 0;
+   logic [15:0] pipe [4];
+
+   initial for (int i = 0; i < 4; ++i) pipe[i] = 0;
+
+   // Combinational logic from clocked state, settled in the same eval
+   wire [31:0] mixed = {crc[15:0], crc[31:16]} ^ {pipe[3], pipe[2]};
+   wire        odd = ^mixed;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[30:0], crc[31] ^ crc[21] ^ crc[1] ^ crc[0]};
+      pipe[0] <= crc[15:0];
+      for (int i = 1; i < 4; ++i) pipe[i] <= pipe[i - 1];
+      sum <= sum + mixed + {31'h0, odd};
+      if (cyc == 99) begin
+         $write("[%0t] sum=%x nsum=%x\n", $time, sum, nsum);
+         if (sum !== 32'h4908f0a9) $stop;
+         if (nsum !== sum - 32'h1) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   // Both edges of the same input clock
+   always @(negedge clk) nsum <= sum - 1;
+
+endmodule
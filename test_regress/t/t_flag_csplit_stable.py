@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_csplit.v"
+
+test.compile(verilator_flags2=["--output-split 1", "--output-split-cfuncs 1",
+                               "--output-split-stable"])  # yapf:disable
+
+test.execute()
+
+# Split files are named by the hash of their first function, not numbered
+got = False
+for filename in test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root__DepSet_*.cpp"):
+    if re.search(r'__DepSet_[0-9a-f]+__[0-9a-f]+__0', filename):
+        got = True
+if not got:
+    test.error("No split file named by function hash found")
+
+test.passes()
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_hier_block_int.v"
+
+test.compile(verilator_flags2=['--make json', '--hierarchical'],
+             verilator_make_gmake=False,
+             verilator_make_cmake=False)
+
+json_filename = test.obj_dir + "/" + test.vm_prefix + ".json"
+
+# Each block lists the wrapper it generates, which its parent reads
+test.file_grep(json_filename, r'"prefix": "Vsub"')
+test.file_grep(json_filename, r'"outputs": \[[^\]]*Vsub/sub\.sv"')
+
+test.passes()
@@ -13,6 +13,8 @@ test.scenarios('vlt_all')
 
 test.compile(verilator_flags2=["--stats --stats-vars"])
 
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "__stats_stages.json", r'"memoryPeakMB"')
+
 test.execute()
 
 test.passes()
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_stats.v"
+
+test.compile(verilator_flags2=["--stats-trace"])
+
+trace = test.obj_dir + "/" + test.vm_prefix + "__stats_trace.json"
+test.file_grep(trace, r'"traceEvents"')
+test.file_grep(trace, r'"ph": "X"')
+test.file_grep(trace, r'"name": "V3Sched::schedule"')
+test.file_grep(trace, r'"name": "\d+_sched"')
+# Implies --stats
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "__stats_stages.json", r'"memoryPeakMB"')
+
+test.passes()
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios("vlt_all")
+
+test.compile(verilator_flags2=["--x-initial unique"])
+
+test.execute(all_run_flags=["+verilator+rand+reset+2", "+verilator+seed+5"])
+
+files = glob.glob(test.obj_dir + "/" + test.vm_prefix + "___024root__DepSet_*__Slow.cpp")
+# Narrow element arrays are reset by a single fill, not a loop over elements
+test.file_grep_any(files, r"mem\.fill\(VL_SCOPED_RAND_RESET_I\(8,")
+test.file_grep_any(files, r"\.fill\(VL_SCOPED_RAND_RESET_Q\(41,")
+# Wide element arrays reset the first element, then copy it
+test.file_grep_any(files, r"wide\.fill\(\S*wide\[0\]\)")
+
+test.passes()
@@ -0,0 +1,33 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [7:0] mem [0:1023];
+   reg [40:0] mem2 [0:3][0:15];
+   reg [99:0] wide [0:7];
+
+   integer cyc = 0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 1) begin
+         // Each element of an array gets the variable's reset value
+         if (mem[3] !== mem[700]) $stop;
+         if (mem2[0][1] !== mem2[3][15]) $stop;
+         if (wide[0] !== wide[7]) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+      mem[cyc] <= 8'(cyc);
+      mem2[cyc[1:0]][0] <= 41'(cyc);
+      wide[cyc[2:0]] <= 100'(cyc);
+   end
+endmodule
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   localparam int SCALE = 3;
+
+   function automatic int sq(int x);
+      return x * x * SCALE;
+   endfunction
+
+   function automatic int sum_sq(int n);
+      int s = 0;
+      // Repeats sq() with the same arguments, which must give the same results
+      for (int i = 0; i < n; ++i) s += sq(i % 4) + sq(i % 4);
+      return s;
+   endfunction
+
+   localparam int P8 = sum_sq(8);
+   localparam int P5 = sum_sq(5);
+   localparam int Q = sq(2) + sq(3);
+
+   initial begin
+      if (P8 != 168) $stop;
+      if (P5 != 84) $stop;
+      if (Q != 39) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
@@ -0,0 +1,56 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [63:0] crc = '0;
+
+   // Large enough that copies at every call site exceed the limit
+   function automatic logic [31:0] mix(input logic [31:0] a, input logic [31:0] b);
+      logic [31:0] r;
+      r = a ^ {b[15:0], b[31:16]};
+      r = r + (a >> 3) - (b << 5);
+      r = r ^ (r >> 11) ^ (r << 7);
+      r = {r[7:0], r[31:8]} + a * 3;
+      return r ^ (b & 32'h0f0f_0f0f);
+   endfunction
+
+   // Small, stays inlined
+   function automatic logic [31:0] inc(input logic [31:0] a);
+      return a + 1;
+   endfunction
+
+   wire [31:0] o1 = mix(crc[31:0], crc[63:32]);
+   wire [31:0] o2 = mix(crc[63:32], crc[31:0]);
+   wire [31:0] o3 = mix(o1, o2);
+   wire [31:0] o4 = inc(o3) ^ inc(o1);
+
+   logic [63:0] sum = '0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      sum <= {o4, o3} ^ {sum[62:0], sum[63] ^ sum[2] ^ sum[0]};
+      if (cyc == 0) begin
+         crc <= 64'h5aef0c8d_d70a4497;
+      end
+      else if (cyc < 10) begin
+         sum <= '0;
+      end
+      else if (cyc == 99) begin
+         $write("[%0t] cyc==%0d crc=%x sum=%x\n", $time, cyc, crc, sum);
+         if (crc !== 64'hc77bb9b3784ea091) $stop;
+         if (sum !== 64'hf5b1e3c2941e55d3) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import subprocess
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(verilator_flags2=["--binary --fuzz-server --coverage"])
+
+# Not run by a fuzzer, so simulates as usual
+test.execute()
+test.file_grep(test.run_log_filename, r'Run cyc=10')
+
+# Act as a fuzzer, requesting runs over the AFL fork server pipes
+(ctl_rd, ctl_wr) = os.pipe()
+(st_rd, st_wr) = os.pipe()
+
+
+def fuzzer_fds():
+    os.dup2(ctl_rd, 198)
+    os.dup2(st_wr, 199)
+
+
+runs = 3
+log = test.obj_dir + "/fuzz.log"
+with open(log, "w", encoding="utf8") as fh:
+    proc = subprocess.Popen([test.obj_dir + "/" + test.vm_prefix],
+                            stdout=fh,
+                            stderr=subprocess.STDOUT,
+                            preexec_fn=fuzzer_fds,
+                            close_fds=False)
+    os.close(ctl_rd)
+    os.close(st_wr)
+    if len(os.read(st_rd, 4)) != 4:
+        test.error("No fork server hello")
+    for _ in range(runs):
+        os.write(ctl_wr, b"\0\0\0\0")
+        pid = int.from_bytes(os.read(st_rd, 4), "little")
+        status = int.from_bytes(os.read(st_rd, 4), "little")
+        if pid <= 0 or status != 0:
+            test.error("Fork server run failed, pid=%d status=%d" % (pid, status))
+    os.close(ctl_wr)
+    if proc.wait() != 0:
+        test.error("Fork server exited with failure")
+    os.close(st_rd)
+
+test.file_grep_count(log, r'Reset', 1)
+test.file_grep_count(log, r'Run cyc=10', runs)
+
+test.passes()
@@ -0,0 +1,23 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   int cyc = 0;
+
+   initial begin
+      // Done once, before the fork server starts
+      $write("Reset\n");
+      #1;
+      // Done in each forked run
+      for (int i = 0; i < 10; ++i) begin
+         #1 cyc = cyc + 1;
+         if (cyc > 10) $stop;  // Would mean state leaked between runs
+      end
+      $write("Run cyc=%0d\n", cyc);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
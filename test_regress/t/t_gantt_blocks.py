@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+# Test for --prof-exec-blocks with bin/verilator_gantt
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as runs a few cycles
+
+test.compile(v_flags2=["--prof-exec-blocks"], threads=(2 if test.vltmt else 1))
+
+test.execute(all_run_flags=[
+    "+verilator+prof+exec+start+2",
+    " +verilator+prof+exec+window+2",
+    " +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])  # yapf:disable
+
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'SECTION_PUSH \d+ block \S+ t_gen_alw\.v:\d+')
+
+gantt_log = test.obj_dir + "/gantt.log"
+
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_gantt", test.obj_dir + "/profile_exec.dat",
+    "--no-vcd", "| tee " + gantt_log
+])
+
+test.file_grep(gantt_log, r'Block profile by block:')
+test.file_grep(gantt_log, r'Block profile by instance:')
+test.file_grep(gantt_log, r'%\s+\|\s+t_gen_alw\.v')
+
+test.passes()
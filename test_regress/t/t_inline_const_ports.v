@@ -0,0 +1,84 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   wire [7:0] on_out;
+   wire [7:0] off_out;
+
+   // Too large to inline at the --inline-mult given, unless the tied off
+   // mode input is taken into account
+   sub u_on (.clk, .mode(1'b1), .out(on_out));
+   sub u_off (.clk, .mode(1'b0), .out(off_out));
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 10) begin
+`ifdef TEST_VERBOSE
+         $write("on=%x off=%x\n", on_out, off_out);
+`endif
+         if (on_out !== 8'he4) $stop;
+         if (off_out !== 8'h00) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub (
+   input clk,
+   input mode,
+   output [7:0] out
+   );
+   logic [7:0] r0 = 8'd0;
+   logic [7:0] r1 = 8'd1;
+   logic [7:0] r2 = 8'd2;
+   logic [7:0] r3 = 8'd3;
+   logic [7:0] r4 = 8'd4;
+   logic [7:0] r5 = 8'd5;
+   logic [7:0] r6 = 8'd6;
+   logic [7:0] r7 = 8'd7;
+   logic [7:0] r8 = 8'd8;
+   logic [7:0] r9 = 8'd9;
+   logic [7:0] r10 = 8'd10;
+   logic [7:0] r11 = 8'd11;
+   logic [7:0] r12 = 8'd12;
+   logic [7:0] r13 = 8'd13;
+   logic [7:0] r14 = 8'd14;
+   logic [7:0] r15 = 8'd15;
+   logic [7:0] r16 = 8'd16;
+   logic [7:0] r17 = 8'd17;
+   logic [7:0] r18 = 8'd18;
+   logic [7:0] r19 = 8'd19;
+
+   always @(posedge clk) if (mode) r0 <= r0 + 8'd1;
+   always @(posedge clk) if (mode) r1 <= r1 + 8'd2;
+   always @(posedge clk) if (mode) r2 <= r2 + 8'd3;
+   always @(posedge clk) if (mode) r3 <= r3 + 8'd4;
+   always @(posedge clk) if (mode) r4 <= r4 + 8'd5;
+   always @(posedge clk) if (mode) r5 <= r5 + 8'd6;
+   always @(posedge clk) if (mode) r6 <= r6 + 8'd7;
+   always @(posedge clk) if (mode) r7 <= r7 + 8'd8;
+   always @(posedge clk) if (mode) r8 <= r8 + 8'd9;
+   always @(posedge clk) if (mode) r9 <= r9 + 8'd10;
+   always @(posedge clk) if (mode) r10 <= r10 + 8'd11;
+   always @(posedge clk) if (mode) r11 <= r11 + 8'd12;
+   always @(posedge clk) if (mode) r12 <= r12 + 8'd13;
+   always @(posedge clk) if (mode) r13 <= r13 + 8'd14;
+   always @(posedge clk) if (mode) r14 <= r14 + 8'd15;
+   always @(posedge clk) if (mode) r15 <= r15 + 8'd16;
+   always @(posedge clk) if (mode) r16 <= r16 + 8'd17;
+   always @(posedge clk) if (mode) r17 <= r17 + 8'd18;
+   always @(posedge clk) if (mode) r18 <= r18 + 8'd19;
+   always @(posedge clk) if (mode) r19 <= r19 + 8'd20;
+
+   assign out = r0 ^ r1 ^ r2 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^ r8 ^ r9 ^ r10 ^ r11 ^ r12 ^ r13 ^ r14 ^ r15 ^ r16 ^ r17 ^ r18 ^ r19;
+endmodule
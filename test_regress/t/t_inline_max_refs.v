@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module bank (
+   input clk,
+   input [7:0] d,
+   output logic [7:0] q
+   );
+   initial q = 0;
+   always @(posedge clk) q <= q + d;
+endmodule
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [7:0] q[16];
+   logic [7:0] sum;
+
+   // Small, so normally inlined, but replicated beyond --inline-max-refs
+   bank u_bank[15:0] (.clk, .d(8'(cyc)), .q(q));
+
+   always_comb begin
+      sum = 0;
+      for (int i = 0; i < 16; ++i) sum = sum + q[i];
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      // Each bank holds cyc*(cyc-1)/2
+      if (sum !== 8'(16 * (cyc * (cyc - 1) / 2))) $stop;
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
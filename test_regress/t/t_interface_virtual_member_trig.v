@@ -0,0 +1,53 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0x exp=%0x (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+
+interface Ifc;
+   bit [7:0] a;
+   bit [7:0] b;
+endinterface
+
+class drv_c;
+   virtual Ifc vif;
+
+   // Each member written gets its own trigger
+   task run();
+      #10 vif.a = 8'h11;
+      #10 vif.b = 8'h22;
+      #10 vif.a = 8'h33;
+   endtask
+endclass
+
+module t;
+   drv_c d_0;
+
+   Ifc u_Ifc ();
+
+   // Only re-evaluated when the member read is written
+   wire [7:0] a_plus = u_Ifc.a + 8'd1;
+   wire [7:0] b_plus = u_Ifc.b + 8'd2;
+
+   initial begin
+      d_0 = new();
+      d_0.vif = u_Ifc;
+      fork
+         d_0.run();
+      join_none
+      #15;
+      `checkh(a_plus, 8'h12);
+      `checkh(b_plus, 8'h02);
+      #10;
+      `checkh(a_plus, 8'h12);
+      `checkh(b_plus, 8'h24);
+      #10;
+      `checkh(a_plus, 8'h34);
+      `checkh(b_plus, 8'h24);
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,52 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+
+#include <cstdio>
+#include "Vt_lanes__Lanes.h"
+
+using Lanes = Vt_lanes__Lanes;
+
+static IData lfsrStep(IData v) {
+    return (v << 1) | (((v >> 31) ^ (v >> 21) ^ (v >> 1) ^ v) & 1);
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<Lanes> lanesp{new Lanes{contextp.get(), "top"}};
+    static_assert(Lanes::lanes == 4, "--lanes");
+
+    IData expect[Lanes::lanes] = {};
+    for (size_t i = 0; i < Lanes::lanes; ++i) {
+        lanesp->lane(i).clk = 0;
+        lanesp->lane(i).seed = 0x1000 + i;
+    }
+    lanesp->eval();
+
+    for (int cyc = 0; cyc < 40; ++cyc) {
+        for (size_t i = 0; i < Lanes::lanes; ++i) lanesp->lane(i).clk = !lanesp->lane(i).clk;
+        lanesp->eval();
+        if (!lanesp->lane(0).clk) continue;
+        for (size_t i = 0; i < Lanes::lanes; ++i) {
+            expect[i] = expect[i] ? lfsrStep(expect[i]) : 0x1000 + i;
+            if (lanesp->lane(i).lfsr != expect[i]) {
+                printf("%%Error: cyc=%d lane=%zu lfsr=%08x exp=%08x\n", cyc, i,
+                       lanesp->lane(i).lfsr, expect[i]);
+                return 1;
+            }
+        }
+    }
+
+    lanesp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,17 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input [31:0] seed,
+    output logic [31:0] lfsr
+);
+  initial $display("%m: start");
+  always @(posedge clk) begin
+    if (lfsr == 0) lfsr <= seed;
+    else lfsr <= {lfsr[30:0], lfsr[31] ^ lfsr[21] ^ lfsr[1] ^ lfsr[0]};
+  end
+endmodule
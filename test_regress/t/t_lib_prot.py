@@ -33,6 +33,9 @@ test.run(logfile=secret_dir + "/vlt_compile.log",
               "t/t_lib_prot_secret.v"],
          verilator_run=True)  # yapf:disable
 
+# Wrapper skips evaluating the library when inputs are unchanged
+test.file_grep(secret_dir + "/secret.cpp", r'if \(handlep__V->m_dirty\)')
+
 test.run(logfile=secret_dir + "/secret_gcc.log",
          cmd=[os.environ["MAKE"], "-C", secret_dir, "-f", "Vt_lib_prot_secret.mk"])
 
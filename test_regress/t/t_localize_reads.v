@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+
+   integer cyc = 0;
+   reg [31:0] a = 32'h1234_5678;
+   reg [31:0] b = 0;
+   reg [31:0] sum = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+   // 'a' is read many times but only written elsewhere
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      b <= (a >> 3) ^ (a << 5) ^ (a & crc[31:0]) ^ (a | crc[63:32]);
+      if (a[0]) sum <= sum + a;
+      else sum <= sum - a;
+   end
+
+   always @(negedge clk) a <= a + crc[31:0];
+
+   always @(posedge clk) begin
+      if (cyc == 20) begin
+`ifdef TEST_VERBOSE
+         $write("[%0t] b=%x sum=%x\n", $time, b, sum);
+`endif
+         if (b !== 32'h6e93bf2b) $stop;
+         if (sum !== 32'h45beba03) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,104 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include "verilated.h"
+#include "verilated_lockstep.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static const int STAGES = 4;
+
+// Combinational chain x -> y -> z, registered out of order
+static void testChain(VerilatedContext* contextp) {
+    const std::unique_ptr<VM_PREFIX> xp{new VM_PREFIX{contextp, "x"}};
+    const std::unique_ptr<VM_PREFIX> yp{new VM_PREFIX{contextp, "y"}};
+    const std::unique_ptr<VM_PREFIX> zp{new VM_PREFIX{contextp, "z"}};
+    VerilatedLockstep lockstep{contextp};
+    const uint32_t z = lockstep.addModel(zp.get());
+    const uint32_t y = lockstep.addModel(yp.get());
+    const uint32_t x = lockstep.addModel(xp.get());
+    lockstep.addInput(x, &xp->in, 32);
+    lockstep.connect(y, &yp->comb, z, &zp->in, 32);
+    lockstep.connect(x, &xp->comb, y, &yp->in, 32);
+
+    xp->in = 10;
+    lockstep.eval();
+    TEST_CHECK_EQ(zp->comb, 13);
+    // All evaluate once, then y and z again as their inputs settle
+    TEST_CHECK_EQ(lockstep.evalCount(x), 1);
+    TEST_CHECK_EQ(lockstep.evalCount(y), 2);
+    TEST_CHECK_EQ(lockstep.evalCount(z), 2);
+
+    // Nothing changed, nothing evaluated
+    lockstep.eval();
+    TEST_CHECK_EQ(lockstep.evalCount(x), 1);
+    TEST_CHECK_EQ(lockstep.evalCount(z), 2);
+
+    // Dependency order settles the chain with one evaluation each
+    xp->in = 20;
+    lockstep.eval();
+    TEST_CHECK_EQ(zp->comb, 23);
+    TEST_CHECK_EQ(lockstep.evalCount(x), 2);
+    TEST_CHECK_EQ(lockstep.evalCount(y), 3);
+    TEST_CHECK_EQ(lockstep.evalCount(z), 3);
+
+    xp->final();
+    yp->final();
+    zp->final();
+}
+
+// Pipeline of flops in separate models, each stage must sample the value
+// its predecessor had before the clock edge
+static void testPipeline(VerilatedContext* contextp) {
+    std::vector<std::unique_ptr<VM_PREFIX>> stages;
+    VerilatedLockstep lockstep{contextp};
+    for (int i = 0; i < STAGES; ++i) {
+        const std::string name = "stage" + std::to_string(i);
+        stages.emplace_back(new VM_PREFIX{contextp, name.c_str()});
+        lockstep.addModel(stages.back().get());
+        lockstep.addInput(i, &stages.back()->clk, 1);
+    }
+    lockstep.addInput(0, &stages[0]->in, 32);
+    for (int i = 1; i < STAGES; ++i) {
+        lockstep.connect(i - 1, &stages[i - 1]->q, i, &stages[i]->in, 32);
+    }
+
+    for (int cyc = 0; cyc < 20; ++cyc) {
+        stages[0]->in = cyc + 1;
+        for (const auto& stagep : stages) stagep->clk = 0;
+        lockstep.eval();
+        for (const auto& stagep : stages) stagep->clk = 1;
+        lockstep.eval();
+        const int last = cyc - (STAGES - 1);
+        TEST_CHECK_EQ(stages[STAGES - 1]->q, last >= 0 ? static_cast<uint32_t>(last + 1) : 0U);
+    }
+    for (const auto& stagep : stages) stagep->final();
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    // Workers to evaluate the independent pipeline stages in parallel
+    contextp->threads(STAGES);
+
+    testChain(contextp.get());
+    testPipeline(contextp.get());
+
+    if (!errors) printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,16 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+   input clk,
+   input [31:0] in,
+   output logic [31:0] q,
+   output [31:0] comb
+);
+   initial q = 0;
+   always_ff @(posedge clk) q <= in;
+   assign comb = in + 1;
+endmodule
@@ -0,0 +1,48 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    topp->clk = 0;
+    topp->step = 1;
+    topp->eval();
+
+    TEST_CHECK_EQ(topp->run(10, topp->clk), 10);
+    TEST_CHECK_EQ(topp->count, 10);
+    TEST_CHECK_EQ(contextp->time(), 20);
+    TEST_CHECK_EQ(topp->clk, 0);
+
+    // Other inputs may change between runs
+    topp->step = 10;
+    TEST_CHECK_EQ(topp->run(5, topp->clk, 5), 5);
+    TEST_CHECK_EQ(topp->count, 60);
+    TEST_CHECK_EQ(contextp->time(), 70);
+
+    // Stops at $finish, after count reaches 1000
+    TEST_CHECK_EQ(topp->run(1000, topp->clk), 95);
+    TEST_CHECK_EQ(contextp->gotFinish(), true);
+
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
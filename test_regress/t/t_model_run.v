@@ -0,0 +1,21 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   count,
+   // Inputs
+   clk, step
+   );
+   input clk;
+   input [7:0] step;
+   output logic [31:0] count = 0;
+
+   always @(posedge clk) begin
+      count <= count + {24'h0, step};
+      if (count == 1000) $finish;
+   end
+endmodule
@@ -0,0 +1,59 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0)
+
+// Many non-blocking updates of the same few elements in one cycle, so the
+// commit queues coalesce them
+
+module t(clk);
+  input clk;
+
+  logic [31:0] cyc = 0;
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == 9) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+  // Whole element updates, last one wins
+  logic [31:0] whole[16];
+  always @(posedge clk) begin
+    for (int i = 0; i < 1000; ++i) whole[i % 16] <= cyc * 1000 + i;
+  end
+
+  // Partial element updates, merging the bits of every update
+  logic [95:0] partial[8];
+  always @(posedge clk) begin
+    if (cyc == 0) begin
+      for (int i = 0; i < 8; ++i) partial[i] <= '0;
+    end
+    else begin
+      for (int i = 0; i < 768; ++i) partial[i % 8][i / 8] <= cyc[0] ^ i[0];
+      for (int i = 0; i < 8; ++i) partial[i][7:4] <= 4'(cyc + i);
+    end
+  end
+
+  always @(posedge clk) begin
+    if (cyc > 0) begin
+      for (int i = 0; i < 16; ++i) begin
+        `checkh(whole[i], (cyc - 1) * 1000 + 992 + (i < 8 ? i : i - 16));
+      end
+    end
+    if (cyc > 1) begin
+      for (int i = 0; i < 8; ++i) begin
+        // Every bit of element i was last set with the same value, then [7:4] overwritten
+        automatic logic bitv = cyc[0] ^ 1'b1 ^ i[0];
+        `checkh(partial[i][95:8], {88{bitv}});
+        `checkh(partial[i][7:4], 4'(cyc - 1 + i));
+        `checkh(partial[i][3:0], {4{bitv}});
+      end
+    end
+  end
+endmodule
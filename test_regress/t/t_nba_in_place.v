@@ -0,0 +1,67 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   int cyc = 0;
+
+   // Read before written in its only clocked process, so updated in place
+   logic [7:0] mem [16];
+   // Read after the NBA in tree order, so needs the usual commit
+   logic [7:0] ref_mem [16];
+
+   logic [7:0] q;
+   logic [7:0] ref_q;
+   // Combinational readers must see the updated values
+   logic [7:0] comb;
+   logic [7:0] ref_comb;
+   always_comb begin
+      comb = 0;
+      ref_comb = 0;
+      for (int i = 0; i < 16; ++i) begin
+         comb = comb ^ mem[i];
+         ref_comb = ref_comb ^ ref_mem[i];
+      end
+   end
+
+   initial begin
+      for (int i = 0; i < 16; ++i) begin
+         mem[i] = 8'(i * 5);
+         ref_mem[i] = 8'(i * 5);
+      end
+   end
+
+   always @(posedge clk) begin
+      q <= mem[4'(cyc)];
+      mem[4'(cyc * 3)] <= mem[4'(cyc + 1)] + 8'd1;
+      if (cyc[0]) mem[4'(cyc + 5)][3:0] <= cyc[3:0];
+   end
+
+   always @(posedge clk) begin
+      ref_mem[4'(cyc * 3)] <= ref_mem[4'(cyc + 1)] + 8'd1;
+      if (cyc[0]) ref_mem[4'(cyc + 5)][3:0] <= cyc[3:0];
+      ref_q <= ref_mem[4'(cyc)];
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+`ifdef TEST_VERBOSE
+      $write("[%0t] cyc=%0d q=%x ref_q=%x comb=%x ref_comb=%x\n",
+             $time, cyc, q, ref_q, comb, ref_comb);
+`endif
+      if (q !== ref_q) $stop;
+      if (comb !== ref_comb) $stop;
+      if (cyc == 40) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [31:0] cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+   reg [63:0] sum = 0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      sum <= sum ^ crc;
+      // Cold, contains $display
+      if (sum[7:0] == 8'h00 && cyc > 1000) begin
+         $display("Unexpected sum %x crc %x at cyc %0d", sum, crc, cyc);
+         $display("Stopping");
+         $stop;
+      end
+      // Cold, assertion failure
+      assert (cyc < 1000) else $error("Cycle count %0d crc %x sum %x", cyc, crc, sum);
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_opt_table_sparse.v"
+test.golden_filename = "t/t_opt_table_sparse.out"
+
+test.compile(verilator_flags2=["--stats", "--output-const-blob 1"])
+
+if test.vlt_all:
+    test.file_grep(test.stats, r'Optimizations, Tables created\s+(\d+)', 1)
+    test.file_grep(test.stats, r'ConstPool, Tables emitted\s+(\d+)', 2)
+    test.file_grep(test.stats, r'ConstPool, Tables emitted as blobs\s+(\d+)', 2)
+
+for filename in test.glob_some(test.obj_dir + "/*__ConstPool_*.cpp"):
+    test.file_grep(filename, r'VL_CONST_BLOB_UNPACKED')
+
+test.execute(expect_filename=test.golden_filename)
+
+test.passes()
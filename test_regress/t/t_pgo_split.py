@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(v_flags2=["--prof-pgo"])
+
+test.execute(all_run_flags=["+verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.obj_dir + "/profile.vlt", r'profile_data .* -mtask "split_')
+
+test.compile(v_flags2=["--stats", test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.stats, r'Optimizations, Split always cold blocks merged\s+(\d+)', 1)
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,40 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [31:0] a = 0;
+   logic [31:0] b = 0;
+   logic [7:0] e1 = 0;
+   logic [7:0] e2 = 0;
+
+   always @(posedge clk) cyc <= cyc + 1;
+
+   always @(posedge clk) begin
+      // Hot, each is split into its own block
+      a <= a + 1;
+      b <= b + 2;
+      // Cold, the blocks for these are merged once profiled
+      if (cyc == 5) begin
+         e1 <= cyc[7:0];
+         e2 <= cyc[7:0] + 8'd1;
+      end
+   end
+
+   always @(posedge clk) begin
+      if (cyc == 1000) begin
+         if (a !== 1000 || b !== 2000) $stop;
+         if (e1 !== 8'd5 || e2 !== 8'd6) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
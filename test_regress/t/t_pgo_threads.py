@@ -20,6 +20,7 @@ test.execute(all_run_flags=[
     " +verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])  # yapf:disable
 
 test.file_grep(test.obj_dir + "/profile.vlt", r'profile_data ')
+test.file_grep(test.obj_dir + "/profile.vlt", r'-mtask "stmt_')
 
 test.compile(
     # Intentionally no --prof-pgo here to make sure profile data can be read in
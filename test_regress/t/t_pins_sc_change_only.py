@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_sc_vl_assign_sbw.v"
+test.pli_filename = "t/t_sc_vl_assign_sbw.cpp"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=[
+                 "--exe --pins-sc-biguint --pins-sc-change-only --sc --stats", test.pli_filename
+             ])
+
+test.file_grep(test.stats, r'Optimizations, SystemC change-only writes\s+(\d+)', 1)
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp"),
+                   r'__Vscprev__out')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,46 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+
+   // Wider than --expand-limit, so kept as VL_*_W calls
+   localparam W = 4096;
+
+   integer cyc = 0;
+   reg [W-1:0] x;
+   reg [W-1:0] y;
+   reg [W-1:0] z;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      y = {W/32{cyc * 32'h9e3779b9}};
+      z = {W/64{32'hffff0000, cyc}};
+      if (cyc == 0) x = {W/32{32'h12345678}};
+      // Each of these reads and writes x, so needs no temporary
+      x = x ^ y;
+      x = ~x;
+      x = x & (y | z);
+      x = x | {W/32{cyc[7:0], 24'h0}};
+      // The pattern repeats every two words
+      for (int i = 2; i < W / 32; ++i) begin
+         if (x[i*32 +: 32] !== x[(i % 2)*32 +: 32]) $stop;
+      end
+`ifdef TEST_VERBOSE
+      $write("[%0t] cyc=%0d x=%x\n", $time, cyc, x[63:0]);
+`endif
+      if (cyc == 9) begin
+         if (x[63:0] !== 64'h99830000_09000008) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
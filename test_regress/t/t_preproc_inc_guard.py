@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(verilator_flags2=["--binary", "--debug --debugi 0 --debugi-V3PreProc 4"])
+
+test.execute()
+
+test.file_grep(test.compile_log_filename,
+               r'Skip include of .*t_preproc_inc_guard.vh, guard defined: T_PREPROC_INC_GUARD_VH')
+
+test.passes()
@@ -0,0 +1,23 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   // Later includes are skipped while the guard is defined
+`include "t_preproc_inc_guard.vh"
+`include "t_preproc_inc_guard.vh"
+   // But read again once it is undefined
+`undef T_PREPROC_INC_GUARD_VH
+`define T_SECOND
+`include "t_preproc_inc_guard.vh"
+`include "t_preproc_inc_guard.vh"
+
+   initial begin
+      if (first != 1) $stop;
+      if (second != 2) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
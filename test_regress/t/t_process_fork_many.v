@@ -0,0 +1,56 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   int done = 0;
+   int killed = 0;
+   process procs[4];
+
+   // Processes are recycled as transactions fork and finish
+   task automatic transaction(int i);
+      fork
+         begin
+            #1;
+            done++;
+         end
+      join_none
+   endtask
+
+   initial begin
+      for (int i = 0; i < 1000; ++i) begin
+         transaction(i);
+         if (i % 10 == 9) wait fork;
+      end
+      wait fork;
+      if (done !== 1000) $stop;
+
+      // Disabling a fork kills all children still running
+      for (int i = 0; i < 4; ++i) begin
+         fork
+            automatic int k = i;
+            begin
+               procs[k] = process::self();
+               #10;
+               killed++;
+            end
+         join_none
+      end
+      #1;
+      for (int i = 0; i < 4; ++i) begin
+         if (procs[i] == null) $stop;
+         if (i > 0 && procs[i] == procs[i - 1]) $stop;
+      end
+      procs[0].kill();
+      if (procs[0].status() != process::KILLED) $stop;
+      disable fork;
+      for (int i = 1; i < 4; ++i) if (procs[i].status() != process::KILLED) $stop;
+      #20;
+      if (killed !== 0) $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_prof_startup.v"  # It doesn't really matter what test
+
+test.compile(verilator_flags2=["--binary", "--prof-regions"])
+
+test.execute(all_run_flags=["+verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])
+
+regions_dat = test.obj_dir + "/profile_regions.dat"
+test.file_grep(regions_dat, r'model ' + test.vm_prefix)
+test.file_grep(regions_dat, r'  loop act\n')
+test.file_grep(regions_dat, r'  loop nba\n')
+test.file_grep(regions_dat, r'  trig act\n')
+
+test.passes()
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--binary", "--prof-startup"])
+
+test.execute(all_run_flags=["+verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])
+
+startup_dat = test.obj_dir + "/profile_startup.dat"
+test.file_grep(startup_dat, r'model ' + test.vm_prefix)
+test.file_grep(startup_dat, r' 1  construct\n')
+test.file_grep(startup_dat, r' 1  eval static\n')
+test.file_grep(startup_dat, r' 1  eval initial\n')
+test.file_grep(startup_dat, r' 1  eval settle\n')
+test.file_grep(startup_dat, r' 2  ctor ' + test.vm_prefix + r'_sub\n')
+test.file_grep(startup_dat, r' 2  initial t_prof_startup.v:10\n')
+test.file_grep(startup_dat, r' 1  initial t_prof_startup.v:19\n')
+
+test.passes()
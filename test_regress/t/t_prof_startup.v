@@ -0,0 +1,23 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module sub;
+   /*verilator no_inline_module*/
+   integer mem[1024] /*verilator public*/;
+   initial begin
+      for (int i = 0; i < 1024; ++i) mem[i] = i;
+   end
+endmodule
+
+module t;
+   sub sub_a ();
+   sub sub_b ();
+
+   initial begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
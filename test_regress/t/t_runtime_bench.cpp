@@ -0,0 +1,205 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Microbenchmark of runtime library hot paths not covered by the other
+// *_bench tests: queue and associative array operations, string
+// formatting, thread pool dispatch latency, and VPI value get/put.
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_threads.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static const int N = 100000;
+
+template <typename T_Func>
+static double timeNs(T_Func func, int reps) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / reps;
+}
+
+static void report(const char* name, double ns) { printf("bench: %-24s %8.2f ns/op\n", name, ns); }
+
+//======================================================================
+
+static void benchQueue() {
+    VlQueue<IData> q;
+    q.atDefault() = 0;
+    report("queue push_back", timeNs([&] {
+               for (int i = 0; i < N; ++i) q.push_back(i);
+           }, N));
+    uint64_t sum = 0;
+    report("queue at", timeNs([&] {
+               for (int i = 0; i < N; ++i) sum += q.at((i * 7919) % N);
+           }, N));
+    report("queue pop_front", timeNs([&] {
+               for (int i = 0; i < N; ++i) sum += q.pop_front();
+           }, N));
+    TEST_CHECK_EQ(sum, 2 * (static_cast<uint64_t>(N) * (N - 1) / 2));
+    TEST_CHECK_EQ(q.size(), 0);
+
+    // Bounded queue small enough to keep its elements inline
+    VlQueue<IData, 16> bq;
+    bq.atDefault() = 0;
+    report("bounded queue push/pop", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   bq.push_back(i);
+                   if (bq.size() == 16) sum += bq.pop_front();
+               }
+           }, N));
+}
+
+template <bool T_Hashed>
+static void benchAssoc(const char* insertName, const char* findName, const char* iterName) {
+    VlAssocArray<QData, IData, T_Hashed> a;
+    a.atDefault() = 0;
+    const auto keyOf = [](int i) { return static_cast<QData>(i) * 2654435761ULL; };
+    report(insertName, timeNs([&] {
+               for (int i = 0; i < N; ++i) a.at(keyOf(i)) = i;
+           }, N));
+    int found = 0;
+    report(findName, timeNs([&] {
+               for (int i = 0; i < N; ++i) found += a.exists(keyOf(i));
+           }, N));
+    TEST_CHECK_EQ(found, N);
+    int visited = 0;
+    report(iterName, timeNs([&] {
+               // Hashed arrays are only ordered on demand, so not first()/next()
+               for (const auto& item : a) visited += item.second >= 0;
+           }, N));
+    TEST_CHECK_EQ(visited, N);
+}
+
+//======================================================================
+
+static void benchString() {
+    // As emitted for $sformatf and string concatenations
+    std::string s;
+    report("string sformatf", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   s = VL_SFORMATF_N_NX("transaction id=%0d addr=%x", 0, 32,
+                                        static_cast<IData>(i), 32, static_cast<IData>(i * 4));
+               }
+           }, N));
+    TEST_CHECK_EQ(s, std::string{"transaction id=99999 addr=00061a7c"});
+    std::string c;
+    report("string concat chain", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   c = VL_CONCATN_NNN(VL_CONCATN_NNN(VL_CONCATN_NNN(s, std::string{"/"}), s),
+                                      std::string{"/"});
+               }
+           }, N));
+    TEST_CHECK_EQ(c.size(), 2 * (s.size() + 1));
+}
+
+//======================================================================
+
+static std::atomic<int> s_tasks{0};
+
+static void countTask(VlSelfP, bool) { s_tasks.fetch_add(1, std::memory_order_relaxed); }
+
+static void benchThreadPool(VerilatedContext* contextp) {
+    // Leave a CPU for the dispatching thread, as spinning workers otherwise compete with it
+    const int cpus = static_cast<int>(std::thread::hardware_concurrency());
+    const int workers = std::max(1, std::min(3, cpus - 1));
+    const int rounds = 1000;
+    VlThreadPool pool{contextp, static_cast<unsigned>(workers)};
+    // A round is one task on each worker then waiting for all, as an eval does
+    report("thread pool dispatch", timeNs([&] {
+               for (int r = 0; r < rounds; ++r) {
+                   for (int w = 0; w < workers; ++w) pool.workerp(w)->addTask(countTask, nullptr);
+                   for (int w = 0; w < workers; ++w) pool.workerp(w)->wait();
+               }
+           }, rounds));
+    TEST_CHECK_EQ(s_tasks.load(), rounds * workers);
+}
+
+//======================================================================
+
+static void benchVpi() {
+    vpiHandle const i8p = vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.i8"), nullptr);
+    vpiHandle const i100p = vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.i100"), nullptr);
+    TEST_CHECK_NZ(i8p);
+    TEST_CHECK_NZ(i100p);
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    report("vpi put int", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   v.value.integer = i & 0xff;
+                   vpi_put_value(i8p, &v, nullptr, vpiNoDelay);
+               }
+           }, N));
+    int sum = 0;
+    report("vpi get int", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   vpi_get_value(i8p, &v);
+                   sum += v.value.integer;
+               }
+           }, N));
+    TEST_CHECK_EQ(sum, N * ((N - 1) & 0xff));
+    s_vpi_vecval vec[4];
+    memset(vec, 0, sizeof(vec));
+    v.format = vpiVectorVal;
+    report("vpi put 100-bit vector", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   vec[0].aval = i;
+                   v.value.vector = vec;
+                   vpi_put_value(i100p, &v, nullptr, vpiNoDelay);
+               }
+           }, N));
+    uint64_t vsum = 0;
+    report("vpi get 100-bit vector", timeNs([&] {
+               for (int i = 0; i < N; ++i) {
+                   vpi_get_value(i100p, &v);
+                   vsum += static_cast<uint32_t>(v.value.vector[0].aval);
+               }
+           }, N));
+    TEST_CHECK_EQ(vsum, static_cast<uint64_t>(N) * (N - 1));
+    vpi_release_handle(i8p);
+    vpi_release_handle(i100p);
+}
+
+//======================================================================
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+    topp->eval();
+
+    benchQueue();
+    benchAssoc<false>("assoc insert", "assoc exists", "assoc iterate");
+    benchAssoc<true>("hashed assoc insert", "hashed assoc exists", "hashed assoc iterate");
+    benchString();
+    benchThreadPool(contextp.get());
+    benchVpi();
+
+    topp->final();
+    if (!errors) printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_vpi_bulk.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe --vpi --no-l2name", test.pli_filename])
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'bench: queue push_back +[\d.]+ ns/op')
+test.file_grep(test.run_log_filename, r'bench: hashed assoc exists +[\d.]+ ns/op')
+test.file_grep(test.run_log_filename, r'bench: string sformatf +[\d.]+ ns/op')
+test.file_grep(test.run_log_filename, r'bench: thread pool dispatch +[\d.]+ ns/op')
+test.file_grep(test.run_log_filename, r'bench: vpi get 100-bit vector +[\d.]+ ns/op')
+
+test.passes()
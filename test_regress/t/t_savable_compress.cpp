@@ -0,0 +1,90 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static std::string filename(const char* basep) {
+    return std::string{VL_STRINGIFY(TEST_OBJ_DIR) "/"} + basep;
+}
+
+static std::string readFile(const std::string& name) {
+    std::ifstream is{name, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+}
+
+static void cycle(VerilatedContext* contextp, VM_PREFIX* topp) {
+    for (int i = 0; i < 2; ++i) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+}
+
+int main(int argc, char** argv) {
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        topp->clk = 0;
+        topp->eval();
+        for (int cyc = 1; cyc <= 300; ++cyc) cycle(contextp.get(), topp.get());
+        {
+            VerilatedSave os;
+            os.compression(VerilatedSaveCodec::ZLIB, 1, 2);
+            os.open(filename("compressed.vltsv"));
+            TEST_CHECK_EQ(os.isOpen(), true);
+            os << contextp.get() << *topp;
+        }
+        {
+            VerilatedSave os;
+            os.open(filename("ref.vltsv"));
+            os << contextp.get() << *topp;
+        }
+        topp->final();
+    }
+
+    const std::string ref = readFile(filename("ref.vltsv"));
+    TEST_CHECK_EQ(readFile(filename("compressed.vltsv")).size() < ref.size() / 4, true);
+
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        {
+            // Codec is detected from the file
+            VerilatedRestore os;
+            os.open(filename("compressed.vltsv"));
+            TEST_CHECK_EQ(os.isOpen(), true);
+            os >> contextp.get() >> *topp;
+        }
+        {
+            VerilatedSave os;
+            os.open(filename("restored.vltsv"));
+            os << contextp.get() << *topp;
+        }
+        TEST_CHECK_EQ(readFile(filename("restored.vltsv")) == ref, true);
+        while (!contextp->gotFinish()) cycle(contextp.get(), topp.get());
+        topp->final();
+    }
+
+    return errors ? 10 : 0;
+}
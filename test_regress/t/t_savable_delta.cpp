@@ -0,0 +1,100 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static std::string filename(const char* basep) {
+    return std::string{VL_STRINGIFY(TEST_OBJ_DIR) "/"} + basep;
+}
+
+static std::string readFile(const std::string& name) {
+    std::ifstream is{name, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+}
+
+static void save(VerilatedContext* contextp, VM_PREFIX* topp, const std::string& name,
+                 const char* prevp = nullptr) {
+    VerilatedSave os;
+    if (prevp) {
+        os.openDelta(name, filename(prevp));
+    } else {
+        os.open(name);
+    }
+    TEST_CHECK_EQ(os.isOpen(), true);
+    os << contextp << *topp;
+}
+
+static void cycle(VerilatedContext* contextp, VM_PREFIX* topp) {
+    for (int i = 0; i < 2; ++i) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+}
+
+int main(int argc, char** argv) {
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        topp->clk = 0;
+        topp->eval();
+        for (int cyc = 1; cyc <= 300; ++cyc) {
+            cycle(contextp.get(), topp.get());
+            if (cyc == 100) save(contextp.get(), topp.get(), filename("full.vltsv"));
+            if (cyc == 200) {
+                save(contextp.get(), topp.get(), filename("delta1.vltsv"), "full.vltsv");
+            }
+            if (cyc == 300) {
+                save(contextp.get(), topp.get(), filename("delta2.vltsv"), "delta1.vltsv");
+                save(contextp.get(), topp.get(), filename("ref.vltsv"));
+            }
+        }
+        topp->final();
+    }
+
+    // Only the changed part of 'mem' is in the deltas
+    const std::string full = readFile(filename("full.vltsv"));
+    const std::string delta = readFile(filename("delta2.vltsv"));
+    TEST_CHECK_EQ(full.size() > 256 * 1024, true);
+    TEST_CHECK_EQ(delta.size() < full.size() / 8, true);
+
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        {
+            VerilatedRestore os;
+            os.open(filename("delta2.vltsv"));
+            TEST_CHECK_EQ(os.isOpen(), true);
+            os >> contextp.get() >> *topp;
+        }
+        // Restored state must match the full save made at the same time
+        save(contextp.get(), topp.get(), filename("restored.vltsv"));
+        TEST_CHECK_EQ(readFile(filename("restored.vltsv")) == readFile(filename("ref.vltsv")),
+                      true);
+        while (!contextp->gotFinish()) cycle(contextp.get(), topp.get());
+        topp->final();
+    }
+
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,33 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   integer sum = 0;
+   // Large state where only the first entries change between checkpoints
+   reg [31:0] mem [0:65535];
+
+   initial begin
+      for (int i = 0; i < 65536; ++i) mem[i] = i;
+   end
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      mem[cyc[7:0]] <= mem[cyc[7:0]] + 32'd3;
+      sum <= sum + mem[cyc[7:0]];
+      if (cyc == 400) begin
+         $write("sum = %0d\n", sum);
+         if (sum != 'ha968) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
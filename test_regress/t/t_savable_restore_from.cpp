@@ -0,0 +1,81 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static std::string filename(const char* basep) {
+    return std::string{VL_STRINGIFY(TEST_OBJ_DIR) "/"} + basep;
+}
+
+static std::string readFile(const std::string& name) {
+    std::ifstream is{name, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+}
+
+static std::string saved(VM_PREFIX* topp, const char* basep) {
+    {
+        VerilatedSave os;
+        os.open(filename(basep));
+        TEST_CHECK_EQ(os.isOpen(), true);
+        os << *topp;
+    }
+    return readFile(filename(basep));
+}
+
+static void cycle(VerilatedContext* contextp, VM_PREFIX* topp) {
+    for (int i = 0; i < 2; ++i) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> goldenContextp{new VerilatedContext};
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    goldenContextp->commandArgs(argc, argv);
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> goldenp{new VM_PREFIX{goldenContextp.get(), "top"}};
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    // Make the golden state
+    goldenp->clk = 0;
+    goldenp->eval();
+    for (int cyc = 1; cyc <= 100; ++cyc) cycle(goldenContextp.get(), goldenp.get());
+
+    // Reset to the golden state twice, each time running to the end
+    topp->clk = 0;
+    topp->eval();
+    for (int run = 0; run < 2; ++run) {
+        topp->restoreFrom(*goldenp);
+        // Context state is not copied
+        contextp->time(goldenContextp->time());
+        contextp->gotFinish(false);
+        TEST_CHECK_EQ(saved(topp.get(), "copy.vltsv") == saved(goldenp.get(), "golden.vltsv"),
+                      true);
+        while (!contextp->gotFinish()) cycle(contextp.get(), topp.get());
+    }
+
+    topp->final();
+    goldenp->final();
+    return errors ? 10 : 0;
+}
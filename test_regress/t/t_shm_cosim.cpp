@@ -0,0 +1,97 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include "verilated.h"
+#include "verilated_shm.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <cstdio>
+#include <string>
+#include <sys/wait.h>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static const int CYCLES = 1000;
+
+// Testbench process, only using the client
+static int client(const std::string& name) {
+    VerilatedShmClient c{name};
+    const uint32_t clk = c.index("clk");
+    const uint32_t a = c.index("a");
+    const uint32_t sum = c.index("sum");
+    const uint32_t count = c.index("t.count");
+    const uint32_t wideIn = c.index("wide_in");
+    const uint32_t wideOut = c.index("wide_out");
+    TEST_CHECK_EQ(c.bits(sum), 40);
+    TEST_CHECK_EQ(c.bits(wideOut), 100);
+    bool threw = false;
+    try {
+        c.bits(1000);
+    } catch (const std::runtime_error&) { threw = true; }
+    TEST_CHECK_EQ(threw, true);
+
+    uint64_t expSum = 0;
+    for (int cyc = 0; cyc < CYCLES; ++cyc) {
+        const uint64_t value = 0xf0000000ULL + cyc;
+        c.poke(a, value);
+        c.poke(clk, 0);
+        c.timeInc(1);
+        c.eval();
+        c.poke(clk, 1);
+        c.timeInc(1);
+        TEST_CHECK_EQ(c.eval(), 2ULL * (cyc + 1));
+        expSum = (expSum + (value & 0xffffffffULL)) & 0xffffffffffULL;
+        TEST_CHECK_EQ(c.peek(sum), expSum);
+    }
+    TEST_CHECK_EQ(c.peek(count), CYCLES & 0xff);
+    c.poke(count, 5);
+    TEST_CHECK_EQ(c.peek(count), 5);
+
+    const uint32_t in[4] = {0x11111111, 0x22222222, 0x33333333, 0x4};
+    c.pokeWide(wideIn, in);
+    c.eval();
+    uint32_t out[4] = {};
+    c.peekWide(wideOut, out);
+    TEST_CHECK_EQ(out[0], 0xeeeeeeeeU);
+    TEST_CHECK_EQ(out[2], 0xccccccccU);
+    TEST_CHECK_EQ(out[3], 0xbU);
+    TEST_CHECK_EQ(c.gotFinish(), false);
+    c.finish();
+    return errors;
+}
+
+int main(int argc, char** argv) {
+    const std::string name = "/vl_t_shm_cosim_" + std::to_string(getpid());
+    const pid_t pid = fork();
+    if (pid == 0) _exit(client(name));
+
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+
+    VerilatedShmServer server{contextp.get(), name, [&] { topp->eval(); }};
+    server.addSignal("clk", &topp->clk, 1);
+    server.addSignal("a", &topp->a, 32);
+    server.addSignal("wide_in", &topp->wide_in, 100);
+    server.addSignal("sum", &topp->sum, 40);
+    server.addSignal("wide_out", &topp->wide_out, 100);
+    server.addScopeVar("t", "count");
+    server.run();
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    TEST_CHECK_EQ(WIFEXITED(status) ? WEXITSTATUS(status) : -1, 0);
+
+    topp->final();
+    if (!errors) printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input [31:0] a,
+    input [99:0] wide_in,
+    output [39:0] sum,
+    output [99:0] wide_out
+);
+
+   logic [39:0] acc = 0;
+   logic [7:0] count  /*verilator public_flat_rw*/ = 0;
+
+   always_ff @(posedge clk) begin
+      acc <= acc + {8'h0, a};
+      count <= count + 1;
+   end
+
+   assign sum = acc;
+   assign wide_out = ~wide_in;
+
+endmodule
@@ -0,0 +1,41 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include "verilatedos.h"
+
+#include "verilated.h"
+
+#include <cstdio>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+#include VM_PREFIX_ROOT_INCLUDE
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    while (!contextp->gotFinish() && contextp->time() < 100) {
+        topp->clk = !topp->clk;
+        topp->eval();
+        contextp->timeInc(1);
+    }
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+
+    // Only the pages written hold storage, reading other elements must not allocate
+    const size_t memPages = topp->rootp->t__DOT__mem.allocatedPages();
+    const size_t widePages = topp->rootp->t__DOT__wide.allocatedPages();
+    if (memPages != 2 || widePages != 1) {
+        printf("%%Error: allocated pages mem=%zu wide=%zu, expected 2 and 1\n", memPages,
+               widePages);
+        return 1;
+    }
+    topp->final();
+    return 0;
+}
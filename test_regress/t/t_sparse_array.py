@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=['--exe', test.pli_filename, '--sparse-array-depth', '1048576'])
+
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.h"),
+                   r'VlSparseArray<QData, 67108864>')
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.h"),
+                   r'VlSparseArray<VlWide<3>')
+
+test.execute()
+
+test.files_identical(test.obj_dir + "/t_sparse_array.mem", "t/t_sparse_array.mem.out")
+
+test.passes()
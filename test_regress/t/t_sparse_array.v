@@ -0,0 +1,45 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define STRINGIFY(x) `"x`"
+
+module t(/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+   int   cyc;
+
+   // 512 MiB if stored densely
+   logic [63:0] mem [0:2**26-1];
+   logic [95:0] wide [0:2**21-1];
+
+   always_ff @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 1) begin
+         $readmemh("t/t_sparse_array.mem", mem);
+         mem[26'h3ffffff] <= 64'h55;
+         wide[2**21-1] <= {32'h1, 64'h2};
+      end
+      else if (cyc == 2) begin
+         `checkh(mem[26'h3000000], 64'h0123456789abcdef);
+         `checkh(mem[26'h3000001], 64'hfedcba9876543210);
+         `checkh(mem[26'h3ffffff], 64'h55);
+         `checkh(mem[5], 64'h0);
+         `checkh(wide[2**21-1], 96'h1_00000000_00000002);
+         `checkh(wide[0], 96'h0);
+         $writememh({`STRINGIFY(`TEST_OBJ_DIR),"/t_sparse_array.mem"}, mem,
+                    26'h3000000, 26'h3000002);
+      end
+      else if (cyc == 3) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
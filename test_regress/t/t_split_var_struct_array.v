@@ -0,0 +1,63 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   typedef struct {
+      logic        valid;
+      logic [19:0] tag;
+      logic [63:0] data;
+   } entry_t;
+
+   // Split into an array per member
+   entry_t table_a[1024] /*verilator split_var*/;
+   // Not split, as whole elements are copied
+   entry_t table_b[4:11] /*verilator split_var*/;
+
+   integer cyc = 0;
+   int     nvalid;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 0) begin
+         for (int i = 0; i < 1024; ++i) begin
+            table_a[i].valid = 1'b0;
+            table_a[i].tag = 20'(i * 7);
+            table_a[i].data = 64'(i) << 32;
+         end
+         for (int i = 4; i <= 11; ++i) begin
+            table_b[i].valid = 1'b1;
+            table_b[i].tag = 20'(i);
+            table_b[i].data = 64'(i);
+         end
+      end
+      else if (cyc < 10) begin
+         table_a[cyc * 100].valid <= 1'b1;
+         table_a[cyc * 100].data <= table_a[cyc * 100].data | 64'(cyc);
+         table_b[cyc % 8 + 4] <= table_b[(cyc + 1) % 8 + 4];
+      end
+      else if (cyc == 10) begin
+         nvalid = 0;
+         for (int i = 0; i < 1024; ++i) begin
+            if (table_a[i].valid) ++nvalid;
+            `checkh(table_a[i].tag, 20'(i * 7));
+         end
+         `checkh(nvalid, 9);
+         `checkh(table_a[500].data, 64'h1f4_00000005);
+         `checkh(table_a[501].data, 64'h1f5_00000000);
+         `checkh(table_b[5].tag, 20'd7);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
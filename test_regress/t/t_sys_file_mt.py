@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=['--no-threads-coarsen'])
+
+test.execute()
+
+for blk in range(4):
+    with open(test.obj_dir + "/blk" + str(blk) + ".log", 'r', encoding="utf8") as fh:
+        got = fh.read()
+    expect = "".join("blk%d cyc=%03d\n" % (blk, cyc) for cyc in range(1, 101))
+    if got != expect:
+        test.error("blk" + str(blk) + ".log has unexpected contents")
+
+test.passes()
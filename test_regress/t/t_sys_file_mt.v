@@ -0,0 +1,51 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t(/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   localparam BLOCKS = 4;
+   localparam CYCLES = 100;
+
+   integer cyc = 0;
+   integer fd[BLOCKS];
+
+   initial begin
+      for (int i = 0; i < BLOCKS; ++i) begin
+         fd[i] = $fopen($sformatf("%s/blk%0d.log", `STRINGIFY(`TEST_OBJ_DIR), i), "w");
+      end
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == CYCLES) begin
+         for (int i = 0; i < BLOCKS; ++i) $fclose(fd[i]);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   // Independent writers, so they may run in separate threads
+   for (genvar g = 0; g < BLOCKS; ++g) begin : blk
+      always @(posedge clk) begin
+         if (cyc > 0 && cyc <= CYCLES) begin
+            $fdisplay(fd[g], "blk%0d cyc=%03d", g, cyc);
+            if (cyc == 50) begin
+               // Earlier output must be written before the position is read
+               `checkd($ftell(fd[g]), 13 * 50);
+            end
+            if (cyc == 75) $fflush(fd[g]);
+         end
+      end
+   end
+
+endmodule
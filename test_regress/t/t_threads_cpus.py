@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as runs a few cycles
+
+test.compile(v_flags2=["--prof-exec"], threads=2)
+
+# CPU 0 always exists, so pin the single worker there
+test.execute(all_run_flags=[
+    "+verilator+threads+cpus+0",
+    " +verilator+prof+exec+start+2",
+    " +verilator+prof+exec+window+2",
+    " +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])  # yapf:disable
+
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROF info numa assigned 0;')
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'VLPROF info placement 0:\S+ 1:cpu0/')
+
+gantt_log = test.obj_dir + "/gantt.log"
+
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_gantt", "--no-vcd",
+    test.obj_dir + "/profile_exec.dat", "| tee " + gantt_log
+])
+
+test.file_grep(gantt_log, r'Thread placement += 0:')
+
+test.passes()
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as runs a few cycles
+
+test.compile(v_flags2=["--threads-dynamic", "--prof-exec", "--stats"], threads=4)
+
+test.execute(all_run_flags=[
+    "+verilator+prof+exec+start+2", " +verilator+prof+exec+window+2",
+    " +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"
+])
+
+test.file_grep(test.stats, r'Optimizations, Thread schedule dynamic source tasks\s+(\d+)')
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'MTASK_BEGIN')
+
+test.passes()
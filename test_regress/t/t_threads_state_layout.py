@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+# Benchmark --threads-state-layout on a 16 thread design with many
+# cross-thread dependencies. Run with --benchmark to get meaningful times in
+# the benchmarksim .csv, one line per layout. Pad/group effects on coherence
+# traffic can then be compared with e.g. 'perf stat -e cache-misses'.
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = test.obj_dir + "/t_threads_state_layout.v"
+test.cycles = (100000 if test.benchmark else 100)
+
+nlanes = 128
+nstages = 6
+
+
+def gen(filename):
+    with open(filename, 'w', encoding="utf8") as fh:
+        fh.write("// Generated by t_threads_state_layout.py\n")
+        fh.write("module t (clk);\n")
+        fh.write("   input clk;\n")
+        fh.write("   integer cyc = 0;\n")
+        for n in range(0, nlanes):
+            fh.write("   reg [63:0] r_" + str(n) + " = 64'd" + str(n + 1) + ";\n")
+            for s in range(1, nstages + 1):
+                fh.write("   wire [63:0] s" + str(s) + "_" + str(n) + ";\n")
+        fh.write("\n")
+        for n in range(0, nlanes):
+            fh.write("   assign s1_" + str(n) + " = r_" + str(n) + " + r_" +
+                     str((n + 1) % nlanes) + ";\n")
+        for s in range(2, nstages + 1):
+            for n in range(0, nlanes):
+                # Mix lanes far apart, so the mtasks depend on other threads
+                other = (n * 37 + s) % nlanes
+                fh.write("   assign s" + str(s) + "_" + str(n) + " = s" + str(s - 1) + "_" +
+                         str(n) + " ^ (s" + str(s - 1) + "_" + str(other) + " << 1);\n")
+        fh.write("\n")
+        for n in range(0, nlanes):
+            fh.write("   always @(posedge clk) r_" + str(n) + " <= s" + str(nstages) + "_" +
+                     str(n) + ";\n")
+        fh.write("\n")
+        fh.write("`ifndef SIM_CYCLES\n")
+        fh.write(" `define SIM_CYCLES 99\n")
+        fh.write("`endif\n")
+        fh.write("   always @(posedge clk) begin\n")
+        fh.write("      cyc <= cyc + 1;\n")
+        fh.write("      if (cyc == `SIM_CYCLES) begin\n")
+        fh.write('         $write("*-* All Finished *-*\\n");\n')
+        fh.write("         $finish;\n")
+        fh.write("      end\n")
+        fh.write("   end\n")
+        fh.write("endmodule\n")
+
+
+gen(test.top_filename)
+
+test.init_benchmarksim()
+
+layouts = ["packed", "padded", "grouped"]
+
+for layout in layouts:
+    test.compile(benchmarksim=1,
+                 v_flags2=["+define+SIM_CYCLES=" + str(test.cycles)],
+                 verilator_flags2=["--threads-state-layout", layout, "-Wno-UNOPTTHREADS"],
+                 threads=16)
+
+    root_h = test.obj_dir + "/" + test.vm_prefix + "___024root.h"
+    if layout == "packed":
+        test.file_grep_not(root_h, r'VlPaddedMTaskVertex')
+    else:
+        test.file_grep(root_h, r'VlPaddedMTaskVertex')
+    if layout == "grouped":
+        test.file_grep(root_h, r'\bVlMTaskVertex ')
+
+    test.execute()
+
+gotn = 0
+with open(test.benchmarksim_filename, 'r', encoding="utf8") as fh:
+    for line in fh:
+        if re.match(r'^\d+\.?\d*,\d+\.?\d*', line):
+            gotn += 1
+if gotn != len(layouts):
+    test.error("Expected " + str(len(layouts)) + " benchmark lines but found " + str(gotn))
+
+test.passes()
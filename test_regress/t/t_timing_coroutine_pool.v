@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t(/*AUTOARG*/);
+   int count = 0;
+
+   task automatic step(int n);
+      #1;
+      count += n;
+   endtask
+
+   initial begin
+      for (int i = 1; i <= 1000; i++) begin
+         fork
+            step(i);
+            step(i);
+         join
+      end
+      if (count != 1000 * 1001) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,55 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Delays on either side of the scheduler's timing wheel size
+module t(/*AUTOARG*/);
+   int count = 0;
+   int order[$];
+
+   task automatic waiter(int dly, int reps);
+      time start;
+      repeat (reps) begin
+         start = $time;
+         #dly;
+         if ($time != start + dly) begin
+            $display("%%Error: #%0d from %0t resumed at %0t", dly, start, $time);
+            $stop;
+         end
+         count++;
+      end
+   endtask
+
+   initial begin
+      fork
+         waiter(1, 3000);
+         waiter(7, 400);
+         waiter(255, 12);
+         waiter(256, 12);
+         waiter(257, 12);
+         waiter(1000, 3);
+         waiter(100000, 1);
+         begin
+            // Both resume at 300, one suspending while 300 was beyond the wheel
+            fork
+               begin #300 order.push_back(1); end
+               begin #100 #200 order.push_back(2); end
+            join
+         end
+      join
+`ifdef TEST_VERBOSE
+      $display("[%0t] count=%0d order=%p", $time, count, order);
+`endif
+      if ($time != 100000) $stop;
+      if (count != 3000 + 400 + 12 * 3 + 3 + 1) $stop;
+      if (order.size() != 2) $stop;
+`ifdef VERILATOR
+      // Same time resumptions are in suspension order
+      if (order[0] != 1 || order[1] != 2) $stop;
+`endif
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
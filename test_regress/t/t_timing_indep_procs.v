@@ -0,0 +1,27 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t(/*AUTOARG*/);
+   logic [7:0] a = 0;
+   logic [7:0] b = 0;
+   int seen = 0;
+
+   // Independent of the others
+   initial forever #3 b = b + 1;
+
+   // Dependent through 'a' and 'seen'
+   initial forever #2 a = a + 1;
+   initial forever begin
+      #5;
+      seen = seen + int'(a);
+   end
+   initial begin
+      #100;
+      if (seen == 0) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
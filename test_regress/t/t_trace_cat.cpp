@@ -33,7 +33,12 @@ int main(int argc, char** argv) {
 
     std::unique_ptr<VM_PREFIX> top{new VM_PREFIX{"top"}};
 
+#if defined(T_TRACE_CAT_ASYNC)
+    VerilatedVcdAsyncFile asyncFile;
+    std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC{&asyncFile}};
+#else
     std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC};
+#endif
     top->trace(tfp.get(), 99);
 
     // Test for traceCapable - randomly-ish selected this test
@@ -48,7 +53,7 @@ int main(int argc, char** argv) {
         top->eval();
 
         if ((main_time % 100) == 0) {
-#if defined(T_TRACE_CAT)
+#if defined(T_TRACE_CAT) || defined(T_TRACE_CAT_ASYNC)
             tfp->openNext(true);
 #elif defined(T_TRACE_CAT_REOPEN)
             tfp->close();
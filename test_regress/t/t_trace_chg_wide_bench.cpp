@@ -0,0 +1,96 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Microbenchmark of wide signal change detection in trace dumps, comparing
+// VerilatedTraceBuffer::differsWData with the plain scalar loop.
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vcd_c.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+double sc_time_stamp() { return 0; }
+
+using TraceBuffer = VerilatedTraceBuffer<VerilatedVcdBuffer>;
+
+static VL_ATTR_NOINLINE bool differsScalar(const uint32_t* oldp, const WData* newvalp,
+                                           int words) {
+    // The implementation prior to vectorization
+    for (int i = 0; i < words; ++i) {
+        if (VL_UNLIKELY(oldp[i] ^ newvalp[i])) return true;
+    }
+    return false;
+}
+
+static VL_ATTR_NOINLINE bool differsVector(const uint32_t* oldp, const WData* newvalp,
+                                           int words) {
+    return TraceBuffer::differsWData(oldp, newvalp, words);
+}
+
+template <typename T_Func>
+static double timeNs(T_Func func, const std::vector<uint32_t>& oldv,
+                     const std::vector<uint32_t>& newv, int words, int reps) {
+    const size_t nSigs = oldv.size() / words;
+    size_t changed = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < reps; ++rep) {
+        for (size_t s = 0; s < nSigs; ++s) {
+            changed += func(oldv.data() + s * words, newv.data() + s * words, words);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    if (changed != 0) {
+        printf("%%Error: unchanged signals reported as changed\n");
+        exit(1);
+    }
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (static_cast<double>(reps) * nSigs);
+}
+
+int main(int argc, char** argv) {
+    Verilated::commandArgs(argc, argv);
+    const int reps = 200;
+
+    for (const int bits : {64, 96, 256, 512, 1000, 1024}) {
+        const int words = VL_WORDS_I(bits);
+        // Check every single-word difference is detected, at every offset
+        std::vector<uint32_t> oldv(words + 8);
+        std::vector<uint32_t> newv(words + 8);
+        for (int offset = 0; offset < 8; ++offset) {
+            for (int i = 0; i < words; ++i) {
+                std::fill(oldv.begin(), oldv.end(), 0x5a5a5a5a);
+                std::fill(newv.begin(), newv.end(), 0x5a5a5a5a);
+                if (differsVector(oldv.data() + offset, newv.data() + offset, words)) {
+                    printf("%%Error: %d bits: equal values differ\n", bits);
+                    return 1;
+                }
+                newv[offset + i] ^= 1U << (i % 32);
+                if (!differsVector(oldv.data() + offset, newv.data() + offset, words)) {
+                    printf("%%Error: %d bits: difference in word %d not found\n", bits, i);
+                    return 1;
+                }
+            }
+        }
+
+        // Time the common case of a trace dump, where most signals are unchanged
+        constexpr size_t nSigs = 4096;
+        oldv.resize(nSigs * words);
+        newv.resize(nSigs * words);
+        for (size_t i = 0; i < oldv.size(); ++i) oldv[i] = newv[i] = i * 2654435761U;
+        const double scalarNs = timeNs(differsScalar, oldv, newv, words, reps);
+        const double vectorNs = timeNs(differsVector, oldv, newv, words, reps);
+        printf("bench: %4d bits: scalar %7.2f ns, vector %7.2f ns, speedup %.2fx\n", bits,
+               scalarNs, vectorNs, scalarNs / vectorNs);
+    }
+
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_trace_wide_struct.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'bench: 1024 bits: scalar')
+
+test.passes()
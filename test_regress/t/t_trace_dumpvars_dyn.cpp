@@ -43,7 +43,8 @@ int main(int argc, char** argv) {
     || defined(T_TRACE_DUMPVARS_DYN_SAIF_0)
     tfp->dumpvars(0, "");
 #elif defined(T_TRACE_DUMPVARS_DYN_VCD_1) || defined(T_TRACE_DUMPVARS_DYN_FST_1) \
-    || defined(T_TRACE_DUMPVARS_DYN_SAIF_1)
+    || defined(T_TRACE_DUMPVARS_DYN_SAIF_1) || defined(T_TRACE_DUMPVARS_DYN_VCD_GROUPS) \
+    || defined(T_TRACE_DUMPVARS_DYN_FST_GROUPS)
     tfp->dumpvars(99, "t");  // This should not match "top."
     tfp->dumpvars(1, "top.t.cyc");  // A signal
     tfp->dumpvars(1, "top.t.sub1a");  // Scope
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.pli_filename = "t/t_trace_dumpvars_dyn.cpp"
+test.top_filename = "t/t_trace_dumpvars_dyn.v"
+test.golden_filename = "t/t_trace_dumpvars_dyn_vcd_1.out"
+
+test.compile(make_main=False,
+             verilator_flags2=[
+                 "--trace-vcd --trace-scope-groups --exe", test.pli_filename, "-CFLAGS -DVL_DEBUG"
+             ])
+
+test.execute()
+
+test.vcd_identical(test.trace_filename, test.golden_filename)
+
+# Each scope has its own sub functions, skipped when not enabled
+test.file_grep(test.obj_dir + "/V" + test.name + "__Trace__0.cpp", r'bufp->anyEnabled\(')
+
+test.passes()
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-fst --trace-threads 2 --exe", test.pli_filename])
+
+test.execute()
+
+vcd_filename = test.obj_dir + "/simx-fst2vcd.vcd"
+test.fst2vcd(test.obj_dir + "/simx.fst", vcd_filename)
+
+# Every dump is written, none dropped waiting for the single buffer
+test.file_grep(vcd_filename, r'^#1$')
+test.file_grep(vcd_filename, r'^#50$')
+test.file_grep(vcd_filename, r'^#99$')
+
+test.passes()
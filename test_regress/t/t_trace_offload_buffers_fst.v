@@ -0,0 +1,20 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [95:0] wide = '0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      wide <= {wide[94:0], wide[95] ^ cyc[0]};
+   end
+endmodule
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+log = test.run_log_filename
+test.file_grep(log, r'Trace profile: \d+ dumps')
+test.file_grep(log, r'change dump +[\d.]+ +[\d.]+%')
+test.file_grep(log, r'change dump +fidx \d+')
+# The scope changing every cycle ranks first
+test.file_grep(log, r'Scope .*\n +top\.t\.fast +\d+')
+test.file_grep(log, r'top\.t\.slow +\d+')
+
+test.passes()
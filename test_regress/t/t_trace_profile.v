@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   // Changes every cycle, so should rank above 'slow'
+   sub fast(.clk, .inc(1'b1));
+   sub slow(.clk, .inc(cyc[3:0] == 0));
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub (input clk, input inc);
+   logic [31:0] count = 0;
+   always @(posedge clk) if (inc) count <= count + 32'h01010101;
+endmodule
@@ -0,0 +1,57 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Throughput benchmark of SAIF toggle accumulation, for wide signals where
+// many, or only a few, bits change each cycle.
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_saif_c.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+unsigned long long main_time = 0;
+double sc_time_stamp() { return (double)main_time; }
+
+int main(int argc, char** argv) {
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+
+    std::unique_ptr<VM_PREFIX> top{new VM_PREFIX{"top"}};
+    std::unique_ptr<VerilatedSaifC> tfp{new VerilatedSaifC};
+    top->trace(tfp.get(), 99);
+    tfp->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx.saif");
+
+    const int cycles = 20000;
+    top->clk = 0;
+    top->eval();
+    tfp->dump(main_time);
+    const auto start = std::chrono::steady_clock::now();
+    for (int cyc = 0; cyc < cycles; ++cyc) {
+        for (const int clk : {1, 0}) {
+            main_time += 5;
+            top->clk = clk;
+            top->eval();
+            tfp->dump(main_time);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    tfp->close();
+
+    // 2 x 4096 + 32 traced bits, plus 32 for 'cyc'
+    const double bits = 2.0 * cycles * (2 * 4096 + 32 + 32);
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    printf("bench: SAIF %d cycles: %.1f ms, %.2f Gbit/s\n", cycles, ns / 1e6, bits / ns);
+
+    top->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--trace-saif --exe", test.pli_filename])
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'bench: SAIF \d+ cycles')
+test.file_grep(test.trace_filename, r'\(sparse\\\[4095\\\] \(T0 \d+\) \(T1 \d+\)')
+
+test.passes()
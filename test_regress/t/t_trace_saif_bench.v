@@ -0,0 +1,27 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   // About half the bits toggle every cycle
+   reg [4095:0] dense = {128{32'h9e3779b9}};
+   // One bit toggles every cycle
+   reg [4095:0] sparse = '0;
+   reg [31:0]   narrow = '0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      dense <= {dense[4094:0], dense[4095] ^ dense[4093]};
+      sparse[cyc[11:0]] <= ~sparse[cyc[11:0]];
+      narrow <= narrow + 32'd1;
+   end
+endmodule
@@ -0,0 +1,58 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+
+#if defined(T_TRACE_SLICE_FST)
+#include <verilated_fst_c.h>
+#define TRACE_CLASS VerilatedFstC
+#define TRACE_NAME "/simslice.fst"
+#else
+#include <verilated_vcd_c.h>
+#define TRACE_CLASS VerilatedVcdC
+#define TRACE_NAME "/simslice.vcd"
+#endif
+
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+unsigned long long main_time = 0;
+double sc_time_stamp() { return (double)main_time; }
+
+int main(int argc, char** argv) {
+    Verilated::debug(0);
+    Verilated::traceEverOn(true);
+    Verilated::commandArgs(argc, argv);
+
+    std::unique_ptr<VM_PREFIX> top{new VM_PREFIX{"top"}};
+
+    std::unique_ptr<TRACE_CLASS> tfp{new TRACE_CLASS};
+    top->trace(tfp.get(), 99);
+
+    tfp->sliceTime(100);
+#if defined(T_TRACE_SLICE_GZIP)
+    tfp->sliceCommand("gzip -f", 2);
+#endif
+    tfp->open(VL_STRINGIFY(TEST_OBJ_DIR) TRACE_NAME);
+
+    top->clk = 0;
+
+    while (main_time < 190) {  // Creates 2 files
+        top->clk = !top->clk;
+        top->eval();
+        tfp->dump((unsigned int)(main_time));
+        ++main_time;
+    }
+    tfp->close();
+    top->final();
+    tfp.reset();
+    top.reset();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t_trace_cat.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+# Each slice is a complete VCD, the same as reopening the file at that time
+test.vcd_identical(test.obj_dir + "/simslice.vcd", "t/t_trace_cat_reopen__0000.out")
+test.vcd_identical(test.obj_dir + "/simslice_slice0001.vcd", "t/t_trace_cat_reopen__0100.out")
+
+test.passes()
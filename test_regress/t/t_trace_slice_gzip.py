@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t_trace_cat.v"
+test.pli_filename = "t/t_trace_slice.cpp"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+for (part, golden) in (("", "__0000"), ("_slice0001", "__0100")):
+    filename = test.obj_dir + "/simslice" + part + ".vcd"
+    test.run(cmd=["gunzip", "-f", filename + ".gz"])
+    test.vcd_identical(filename, "t/t_trace_cat_reopen" + golden + ".out")
+
+test.passes()
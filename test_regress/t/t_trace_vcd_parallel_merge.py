@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=['--cc --trace-vcd'], threads=4)
+
+test.execute()
+
+# Each 'gen[g].w' is 128 copies of 'cyc ^ g', so check every dumped value is
+# intact and all signals changed together, i.e.: the buffers were merged in order
+codes = {}
+scopes = []
+steps = [{}]
+with open(test.trace_filename, 'r', encoding="utf8") as fh:
+    for line in fh:
+        m = re.match(r'^\s*\$scope module (\S+) \$end', line)
+        if m:
+            scopes.append(m.group(1))
+            continue
+        if re.match(r'^\s*\$upscope', line):
+            scopes.pop()
+            continue
+        m = re.match(r'^\s*\$var \S+ 4096 (\S+) w ', line)
+        if m:
+            codes[m.group(1)] = int(re.search(r'(\d+)', scopes[-1]).group(1))
+            continue
+        if line.startswith('#'):
+            steps.append({})
+            continue
+        m = re.match(r'^b([01]+) (\S+)$', line)
+        if m and m.group(2) in codes:
+            value = int(m.group(1), 2)
+            word = value & 0xffffffff
+            if value != int(('%08x' % word) * 128, 16):
+                test.error("Corrupt value for gen[" + str(codes[m.group(2)]) + "].w")
+            steps[-1][codes[m.group(2)]] = word
+
+if len(codes) != 64:
+    test.error("Expected 64 traced signals, found " + str(len(codes)))
+
+steps = [values for values in steps if values and any(values.values())]
+if len(steps) < 40:
+    test.error("Expected at least 40 time steps with changes, found " + str(len(steps)))
+for values in steps:
+    if sorted(values.keys()) != list(range(64)):
+        test.error("Missing signals in time step: " + str(sorted(values.keys())))
+    if len(set(word ^ g for g, word in values.items())) != 1:
+        test.error("Inconsistent values in time step")
+
+test.passes()
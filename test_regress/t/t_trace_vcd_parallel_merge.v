@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   // Enough wide signals changing every cycle for the per-timestep output to
+   // be merged from the parallel trace buffers by multiple threads
+   for (genvar g = 0; g < 64; ++g) begin : gen
+      logic [4095:0] w;
+      always @(posedge clk) w <= {128{cyc ^ g}};
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 40) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
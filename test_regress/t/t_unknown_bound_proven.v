@@ -0,0 +1,47 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [31:0] idx = 32'h1234_5678;
+
+   reg [7:0] mem[12];
+   reg [99:0] vec;
+
+   // Indices that are in range by construction need no bound check
+   wire [7:0] masked = mem[idx[31:0] & 32'h7];
+   wire [7:0] modded = mem[idx % 12];
+   wire [7:0] shifted = mem[idx[3:0] >> 1];
+   wire [7:0] chosen = mem[idx[0] ? 4'd3 : 4'd11];
+   wire vbit = vec[idx[5:0]];
+   // Index that may exceed the array, so still checked
+   wire [7:0] unknown = mem[idx[3:0]];
+
+   initial begin
+      for (int i = 0; i < 12; ++i) mem[i] = 8'(i * 3);
+      vec = {4'h5, {12{8'ha5}}};
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      idx <= idx * 32'd1103515245 + 32'd12345;
+      if (masked !== mem[idx & 7]) $stop;
+      if (modded !== 8'((idx % 12) * 3)) $stop;
+      if (shifted !== 8'((idx[3:0] >> 1) * 3)) $stop;
+      if (chosen !== (idx[0] ? 8'd9 : 8'd33)) $stop;
+      if (vbit !== vec[idx[5:0]]) $stop;
+      if (idx[3:0] < 12 && unknown !== 8'(idx[3:0] * 3)) $stop;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_unopt_combo.v"
+
+test.compile(verilator_flags2=["-Wno-UNOPTFLAT --unoptflat-min-cost --stats"])
+
+if test.vlt_all:
+    test.file_grep(test.stats, r'Scheduling, UNOPTFLAT cut cost\s+[1-9]')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/);
+
+   int arr[8] = '{1, 2, 5, 10, 17, 26, 37, 50};
+   int sum;
+   int acc;
+
+   initial begin
+      // Cheap, and constant indexes fold, so fully unrolled
+      sum = 0;
+      for (int i = 0; i < 8; ++i) sum += arr[i];
+      // Too costly to fully unroll, so partially unrolled
+      acc = 1;
+      for (int k = 0; k < 64; ++k) acc = acc * 3 + k;
+      if (sum !== 148) $stop;
+      if (acc !== 32'h97de6c21) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
@@ -0,0 +1,120 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "Vt_vpi_bulk.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+static const PLI_INT32 s_formats[] = {vpiIntVal, vpiVectorVal, vpiVectorVal, vpiRealVal};
+
+static int check(VM_PREFIX* topp) {
+    const char* const inNames[] = {"t.i8", "t.i41", "t.i100", "t.ir"};
+    const char* const outNames[] = {"t.o8", "t.o41", "t.o100", "t.orl"};
+    vpiHandle inps[4];
+    vpiHandle outps[4];
+    for (int i = 0; i < 4; ++i) {
+        inps[i] = vpi_handle_by_name(const_cast<PLI_BYTE8*>(inNames[i]), nullptr);
+        CHECK_RESULT_NZ(inps[i]);
+        outps[i] = vpi_handle_by_name(const_cast<PLI_BYTE8*>(outNames[i]), nullptr);
+        CHECK_RESULT_NZ(outps[i]);
+    }
+    VerilatedVpiBulk* const putp = VerilatedVpi::bulkCreate(inps, s_formats, 4);
+    CHECK_RESULT_NZ(putp);
+    VerilatedVpiBulk* const getp = VerilatedVpi::bulkCreate(outps, s_formats, 4);
+    CHECK_RESULT_NZ(getp);
+
+    // Int, 2 + 4 vecvals, then a double aligned to 8
+    CHECK_RESULT(VerilatedVpi::bulkSize(putp), 64);
+    CHECK_RESULT(VerilatedVpi::bulkOffset(putp, 1), 4);
+    CHECK_RESULT(VerilatedVpi::bulkOffset(putp, 2), 20);
+    CHECK_RESULT(VerilatedVpi::bulkOffset(putp, 3), 56);
+
+    alignas(8) uint8_t buf[64] = {};
+    const PLI_INT32 i8 = 0x5a;
+    std::memcpy(buf, &i8, sizeof(i8));
+    s_vpi_vecval* const v41p = reinterpret_cast<s_vpi_vecval*>(buf + 4);
+    v41p[0].aval = 0x3456789a;
+    v41p[1].aval = 0x12;
+    s_vpi_vecval* const v100p = reinterpret_cast<s_vpi_vecval*>(buf + 20);
+    v100p[0].aval = 0xdeadbeef;
+    v100p[1].aval = 0x01234567;
+    v100p[2].aval = 0x89abcdef;
+    v100p[3].aval = 0x5;
+    const double ir = 1.25;
+    std::memcpy(buf + 56, &ir, sizeof(ir));
+    VerilatedVpi::bulkPut(putp, buf);
+    CHECK_RESULT(VerilatedVpi::evalNeeded(), true);
+
+    topp->clk = 1;
+    topp->eval();
+
+    std::memset(buf, 0xff, sizeof(buf));
+    VerilatedVpi::bulkGet(getp, buf);
+    PLI_INT32 o8;
+    std::memcpy(&o8, buf, sizeof(o8));
+    CHECK_RESULT_HEX(o8, 0x5b);
+    CHECK_RESULT_HEX(v41p[0].aval, 0x3456789b);
+    CHECK_RESULT_HEX(v41p[1].aval, 0x12);
+    CHECK_RESULT_HEX(v41p[1].bval, 0);
+    CHECK_RESULT_HEX(v100p[0].aval, 0x21524110);
+    CHECK_RESULT_HEX(v100p[1].aval, static_cast<PLI_INT32>(0xfedcba98));
+    CHECK_RESULT_HEX(v100p[2].aval, 0x76543210);
+    CHECK_RESULT_HEX(v100p[3].aval, 0xa);
+    double orl;
+    std::memcpy(&orl, buf + 56, sizeof(orl));
+    CHECK_RESULT(orl, 2.5);
+
+    // Outputs are read-only
+    VerilatedVpi::bulkPut(getp, buf);
+    CHECK_RESULT_NZ(vpi_chk_error(nullptr));
+
+    // Real format of an integer variable
+    const PLI_INT32 badFormats[] = {vpiRealVal};
+    CHECK_RESULT_Z(VerilatedVpi::bulkCreate(inps, badFormats, 1));
+    CHECK_RESULT_NZ(vpi_chk_error(nullptr));
+
+    VerilatedVpi::bulkDestroy(putp);
+    VerilatedVpi::bulkDestroy(getp);
+    for (int i = 0; i < 4; ++i) {
+        vpi_release_handle(inps[i]);
+        vpi_release_handle(outps[i]);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    // We're going to be checking for these errors so don't crash out
+    contextp->fatalOnVpiError(0);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+    topp->clk = 0;
+    topp->eval();
+
+    if (const int line = check(topp.get())) {
+        printf("%%Error: check failed at line %d\n", line);
+        return 1;
+    }
+
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,32 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   logic [7:0] i8 /*verilator public_flat_rw*/;
+   logic [40:0] i41 /*verilator public_flat_rw*/;
+   logic [99:0] i100 /*verilator public_flat_rw*/;
+   real ir /*verilator public_flat_rw*/;
+
+   logic [7:0] o8 /*verilator public_flat_rd*/;
+   logic [40:0] o41 /*verilator public_flat_rd*/;
+   logic [99:0] o100 /*verilator public_flat_rd*/;
+   real orl /*verilator public_flat_rd*/;
+
+   always @(posedge clk) begin
+      o8 <= i8 + 8'd1;
+      o41 <= i41 + 41'd1;
+      o100 <= ~i100;
+      orl <= ir * 2.0;
+   end
+
+endmodule
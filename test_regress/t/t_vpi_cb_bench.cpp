@@ -0,0 +1,100 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Throughput benchmark of VPI timed callbacks, as used for clocking and
+// timers by cocotb and similar testbenches.
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static const int CHAINS = 64;  // Number of independent, self-rescheduling timers
+static const uint64_t SIM_TIME = 20000;
+static uint64_t s_fired[CHAINS];
+
+static PLI_INT32 never_cb(p_cb_data) {
+    TEST_CHECK_EQ(0, 1);  // A removed callback was called
+    return 0;
+}
+
+static uint32_t chainDelay(int chain) { return 1 + (chain % 5); }
+
+static void registerAfter(int chain, uint32_t delay, PLI_INT32 (*cb_rtn)(p_cb_data)) {
+    s_vpi_time t;
+    t.type = vpiSimTime;
+    t.high = 0;
+    t.low = delay;
+    s_cb_data cb_data;
+    memset(&cb_data, 0, sizeof(cb_data));
+    cb_data.reason = cbAfterDelay;
+    cb_data.time = &t;
+    cb_data.cb_rtn = cb_rtn;
+    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(static_cast<intptr_t>(chain));
+    const vpiHandle cbh = vpi_register_cb(&cb_data);
+    TEST_CHECK_NZ(cbh);
+    if (cb_rtn == never_cb) {
+        vpi_remove_cb(cbh);  // Also frees the handle
+    } else {
+        vpi_release_handle(cbh);
+    }
+}
+
+static PLI_INT32 chain_cb(p_cb_data cb_data) {
+    const int chain = static_cast<int>(reinterpret_cast<intptr_t>(cb_data->user_data));
+    ++s_fired[chain];
+    registerAfter(chain, chainDelay(chain), chain_cb);
+    // A timer that is canceled before expiring, as when a trigger races a timeout
+    registerAfter(chain, chainDelay(chain) + 3, never_cb);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+
+    topp->eval();
+    for (int chain = 0; chain < CHAINS; ++chain) registerAfter(chain, chainDelay(chain), chain_cb);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (contextp->time() < SIM_TIME) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+        VerilatedVpi::callTimedCbs();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    uint64_t total = 0;
+    for (int chain = 0; chain < CHAINS; ++chain) {
+        TEST_CHECK_EQ(s_fired[chain], SIM_TIME / chainDelay(chain));
+        total += s_fired[chain];
+    }
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    printf("bench: %" PRIu64 " timed callbacks, %.1f ns/callback\n", total,
+           ns / static_cast<double>(total));
+
+    topp->final();
+    if (!errors) printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
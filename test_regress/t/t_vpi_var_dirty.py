@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_vpi_var.v"
+test.pli_filename = "t/t_vpi_var.cpp"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             make_pli=True,
+             sim_time=2100,
+             v_flags2=["+define+USE_VPI_NOT_DPI"],
+             verilator_flags2=[
+                 "-Wno-SYMRSVDWORD --exe --vpi --vpi-dirty --no-l2name --stats",
+                 test.pli_filename
+             ])
+
+test.file_grep(test.stats, r'VPI, dirty flag writes\s+[1-9]')
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "__Syms.cpp", r'\.varDirty\(__Vfinal, ')
+
+test.execute(use_libvpi=True, all_run_flags=['+PLUS +INT=1234 +STRSTR'])
+
+test.passes()
@@ -0,0 +1,310 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Microbenchmark of the wide logic, reduction and arithmetic functions in
+// verilated_funcs.h, comparing them with the plain scalar loops, and for
+// 65-128 bits the native 128-bit arithmetic with the 32-bit word algorithms.
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+double sc_time_stamp() { return 0; }
+
+//======================================================================
+// The implementations prior to vectorization
+
+static VL_ATTR_NOINLINE void andScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = lwp[i] & rwp[i];
+}
+static VL_ATTR_NOINLINE void orScalar(int words, EData* owp, const EData* lwp,
+                                      const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = lwp[i] | rwp[i];
+}
+static VL_ATTR_NOINLINE void xorScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = lwp[i] ^ rwp[i];
+}
+static VL_ATTR_NOINLINE void notScalar(int words, EData* owp, const EData* lwp, const EData*) {
+    for (int i = 0; i < words; ++i) owp[i] = ~lwp[i];
+}
+static VL_ATTR_NOINLINE void addScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    QData carry = 0;
+    for (int i = 0; i < words; ++i) {
+        carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
+        owp[i] = (carry & 0xffffffffULL);
+        carry = (carry >> 32ULL) & 0xffffffffULL;
+    }
+}
+static VL_ATTR_NOINLINE void subScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    QData carry = 0;
+    for (int i = 0; i < words; ++i) {
+        carry = (carry + static_cast<QData>(lwp[i])
+                 + static_cast<QData>(static_cast<IData>(~rwp[i])));
+        if (i == 0) ++carry;
+        owp[i] = (carry & 0xffffffffULL);
+        carry = (carry >> 32ULL) & 0xffffffffULL;
+    }
+}
+static VL_ATTR_NOINLINE void mulScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    for (int i = 0; i < words; ++i) owp[i] = 0;
+    for (int lword = 0; lword < words; ++lword) {
+        for (int rword = 0; rword < words; ++rword) {
+            QData mul = static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[rword]);
+            for (int qword = lword + rword; qword < words; ++qword) {
+                mul += static_cast<QData>(owp[qword]);
+                owp[qword] = (mul & 0xffffffffULL);
+                mul = (mul >> 32ULL) & 0xffffffffULL;
+            }
+        }
+    }
+}
+static VL_ATTR_NOINLINE void divScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    _vl_moddiv_w(words * VL_EDATASIZE, owp, lwp, rwp, false);
+}
+static VL_ATTR_NOINLINE void modScalar(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    _vl_moddiv_w(words * VL_EDATASIZE, owp, lwp, rwp, true);
+}
+static VL_ATTR_NOINLINE IData eqScalar(int words, const EData* lwp, const EData* rwp) {
+    EData nequal = 0;
+    for (int i = 0; i < words; ++i) nequal |= (lwp[i] ^ rwp[i]);
+    return (nequal == 0);
+}
+static VL_ATTR_NOINLINE IData changeXorScalar(int words, const EData* lwp, const EData* rwp) {
+    IData od = 0;
+    for (int i = 0; i < words; ++i) od |= (lwp[i] ^ rwp[i]);
+    return od;
+}
+static VL_ATTR_NOINLINE IData redOrScalar(int words, const EData* lwp, const EData*) {
+    EData equal = 0;
+    for (int i = 0; i < words; ++i) equal |= lwp[i];
+    return (equal != 0);
+}
+static VL_ATTR_NOINLINE IData countOnesScalar(int words, const EData* lwp, const EData*) {
+    EData r = 0;
+    for (int i = 0; i < words; ++i) r += VL_COUNTONES_E(lwp[i]);
+    return r;
+}
+
+//======================================================================
+// The library functions, kept out of line so both sides are timed alike
+
+static VL_ATTR_NOINLINE void andVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_AND_W(words, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void orVector(int words, EData* owp, const EData* lwp,
+                                      const EData* rwp) {
+    VL_OR_W(words, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void xorVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_XOR_W(words, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void notVector(int words, EData* owp, const EData* lwp, const EData*) {
+    VL_NOT_W(words, owp, lwp);
+}
+static VL_ATTR_NOINLINE void addVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_ADD_W(words, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void subVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_SUB_W(words, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void mulVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_MUL_W(words, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void divVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_DIV_WWW(words * VL_EDATASIZE, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE void modVector(int words, EData* owp, const EData* lwp,
+                                       const EData* rwp) {
+    VL_MODDIV_WWW(words * VL_EDATASIZE, owp, lwp, rwp);
+}
+static VL_ATTR_NOINLINE IData eqVector(int words, const EData* lwp, const EData* rwp) {
+    return VL_EQ_W(words, lwp, rwp);
+}
+static VL_ATTR_NOINLINE IData changeXorVector(int words, const EData* lwp, const EData* rwp) {
+    return VL_CHANGEXOR_W(words, lwp, rwp);
+}
+static VL_ATTR_NOINLINE IData redOrVector(int words, const EData* lwp, const EData*) {
+    return VL_REDOR_W(words, lwp);
+}
+static VL_ATTR_NOINLINE IData countOnesVector(int words, const EData* lwp, const EData*) {
+    return VL_COUNTONES_W(words, lwp);
+}
+
+//======================================================================
+
+using BinaryFunc = void (*)(int, EData*, const EData*, const EData*);
+using ReduceFunc = IData (*)(int, const EData*, const EData*);
+
+static uint32_t s_seed = 0x12345678;
+static EData randWord() {
+    // Mix of random, all-zero and all-one words, to exercise the carry chains
+    s_seed = s_seed * 1664525U + 1013904223U;
+    const uint32_t kind = s_seed >> 29;
+    s_seed = s_seed * 1664525U + 1013904223U;
+    return kind == 0 ? 0 : kind == 1 ? 0xffffffffU : s_seed;
+}
+
+static void checkBinary(const char* name, BinaryFunc scalar, BinaryFunc vector, int bits,
+                        bool inPlace) {
+    const int words = VL_WORDS_I(bits);
+    std::vector<EData> lhs(words + 8);
+    std::vector<EData> rhs(words + 8);
+    std::vector<EData> expect(words + 8);
+    std::vector<EData> got(words + 8);
+    for (int offset = 0; offset < 8; ++offset) {
+        for (int trial = 0; trial < 50; ++trial) {
+            for (int i = 0; i < words + 8; ++i) lhs[i] = randWord();
+            for (int i = 0; i < words + 8; ++i) rhs[i] = randWord();
+            // Inputs are clean, and divisors are sometimes only a word or two
+            lhs[offset + words - 1] &= VL_MASK_E(bits);
+            rhs[offset + words - 1] &= VL_MASK_E(bits);
+            if (trial % 5 == 0) {
+                for (int i = 1 + trial % 2; i < words; ++i) rhs[offset + i] = 0;
+            }
+            scalar(words, expect.data() + offset, lhs.data() + offset, rhs.data() + offset);
+            vector(words, got.data() + offset, lhs.data() + offset, rhs.data() + offset);
+            for (int i = 0; i < words; ++i) {
+                if (expect[offset + i] != got[offset + i]) {
+                    printf("%%Error: %s %d words: word %d got %08x exp %08x\n", name, words, i,
+                           got[offset + i], expect[offset + i]);
+                    exit(1);
+                }
+            }
+            if (!inPlace) continue;
+            // In place, as used for assignments like 'a = a + b'
+            scalar(words, expect.data() + offset, lhs.data() + offset, rhs.data() + offset);
+            vector(words, lhs.data() + offset, lhs.data() + offset, rhs.data() + offset);
+            for (int i = 0; i < words; ++i) {
+                if (expect[offset + i] != lhs[offset + i]) {
+                    printf("%%Error: %s %d words in place: word %d mismatch\n", name, words, i);
+                    exit(1);
+                }
+            }
+        }
+    }
+}
+
+static void checkReduce(const char* name, ReduceFunc scalar, ReduceFunc vector, int words) {
+    std::vector<EData> lhs(words + 8);
+    std::vector<EData> rhs(words + 8);
+    for (int offset = 0; offset < 8; ++offset) {
+        for (int i = 0; i < words + 8; ++i) lhs[i] = rhs[i] = 0;
+        for (int i = -1; i < words; ++i) {
+            // Equal and zero values, then a single bit differing in each word
+            if (i >= 0) {
+                std::fill(lhs.begin(), lhs.end(), 0);
+                std::fill(rhs.begin(), rhs.end(), 0);
+                lhs[offset + i] = 1U << (i % 32);
+            }
+            const IData exp = scalar(words, lhs.data() + offset, rhs.data() + offset);
+            const IData got = vector(words, lhs.data() + offset, rhs.data() + offset);
+            if (exp != got) {
+                printf("%%Error: %s %d words: bit in word %d got %x exp %x\n", name, words, i,
+                       got, exp);
+                exit(1);
+            }
+        }
+        for (int trial = 0; trial < 50; ++trial) {
+            for (int i = 0; i < words + 8; ++i) lhs[i] = randWord();
+            for (int i = 0; i < words + 8; ++i) rhs[i] = (trial & 1) ? lhs[i] : randWord();
+            const IData exp = scalar(words, lhs.data() + offset, rhs.data() + offset);
+            const IData got = vector(words, lhs.data() + offset, rhs.data() + offset);
+            if (exp != got) {
+                printf("%%Error: %s %d words: random got %x exp %x\n", name, words, got, exp);
+                exit(1);
+            }
+        }
+    }
+}
+
+template <typename T_Func>
+static double timeNs(T_Func func, int words, int reps) {
+    constexpr int nValues = 256;
+    std::vector<EData> lhs(nValues * words);
+    std::vector<EData> rhs(nValues * words);
+    std::vector<EData> out(words);
+    for (size_t i = 0; i < lhs.size(); ++i) lhs[i] = rhs[i] = i * 2654435761U;
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < reps; ++rep) {
+        for (int v = 0; v < nValues; ++v) {
+            func(words, out.data(), lhs.data() + v * words, rhs.data() + v * words);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (static_cast<double>(reps) * nValues);
+}
+
+static void benchBinary(const char* name, BinaryFunc scalar, BinaryFunc vector, int bits,
+                        bool inPlace = true) {
+    const int words = VL_WORDS_I(bits);
+    checkBinary(name, scalar, vector, bits, inPlace);
+    const double scalarNs = timeNs(scalar, words, 200);
+    const double vectorNs = timeNs(vector, words, 200);
+    printf("bench: %4d bits: %-9s scalar %7.2f ns, vector %7.2f ns, speedup %.2fx\n", bits, name,
+           scalarNs, vectorNs, scalarNs / vectorNs);
+}
+
+static void benchReduce(const char* name, ReduceFunc scalar, ReduceFunc vector, int bits) {
+    const int words = VL_WORDS_I(bits);
+    checkReduce(name, scalar, vector, words);
+    IData sink = 0;
+    const auto wrapScalar
+        = [&](int w, EData*, const EData* l, const EData* r) { sink += scalar(w, l, r); };
+    const auto wrapVector
+        = [&](int w, EData*, const EData* l, const EData* r) { sink += vector(w, l, r); };
+    const double scalarNs = timeNs(wrapScalar, words, 200);
+    const double vectorNs = timeNs(wrapVector, words, 200);
+    printf("bench: %4d bits: %-9s scalar %7.2f ns, vector %7.2f ns, speedup %.2fx%s\n", bits,
+           name, scalarNs, vectorNs, scalarNs / vectorNs, sink == 1 ? " " : "");
+}
+
+int main(int argc, char** argv) {
+    Verilated::commandArgs(argc, argv);
+
+    // Odd widths check the scalar tails after the vector loops
+    for (const int bits : {65, 96, 100, 128}) {
+        benchBinary("add", addScalar, addVector, bits);
+        benchBinary("sub", subScalar, subVector, bits);
+        // Multiply and divide never write over their inputs
+        benchBinary("mul", mulScalar, mulVector, bits, false);
+        benchBinary("div", divScalar, divVector, bits, false);
+        benchBinary("mod", modScalar, modVector, bits, false);
+    }
+    for (const int bits : {64, 96, 160, 256, 288, 512, 1000, 1024, 2048}) {
+        benchBinary("and", andScalar, andVector, bits);
+        benchBinary("or", orScalar, orVector, bits);
+        benchBinary("xor", xorScalar, xorVector, bits);
+        benchBinary("not", notScalar, notVector, bits);
+        benchBinary("add", addScalar, addVector, bits);
+        benchBinary("sub", subScalar, subVector, bits);
+        benchReduce("eq", eqScalar, eqVector, bits);
+        benchReduce("changexor", changeXorScalar, changeXorVector, bits);
+        benchReduce("redor", redOrScalar, redOrVector, bits);
+        benchReduce("countones", countOnesScalar, countOnesVector, bits);
+    }
+
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -32,6 +32,7 @@ VerilatedMutex outputMutex;
 #elif defined(T_WRAPPER_CONTEXT_SEQ)
 VerilatedMutex sequentialMutex;
 #elif defined(T_WRAPPER_CONTEXT_FST)
+#elif defined(T_WRAPPER_CONTEXT_SHARED)
 #else
 #error "Unexpected test name"
 #endif
@@ -94,8 +95,16 @@ int main(int argc, char** argv) {
     std::unique_ptr<VerilatedContext> context1p{new VerilatedContext};
 
     // configuration
+#ifdef T_WRAPPER_CONTEXT_SHARED
+    // Both contexts run their models on the same process-wide thread pool
+    context0p->threads(2);
+    context1p->threads(2);
+    context0p->threadsShared(true);
+    context1p->threadsShared(true);
+#else
     context0p->threads(1);
     context1p->threads(1);
+#endif
     context0p->fatalOnError(false);
     context1p->fatalOnError(false);
     context0p->traceEverOn(true);
@@ -0,0 +1,54 @@
+//
+// DESCRIPTION: Verilator: Verilog Test module for VerilatedContext::forkSnapshot
+//
+// This file ONLY is placed into the Public Domain, for any use,
+// without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+
+#include <sys/wait.h>
+
+#include VM_PREFIX_INCLUDE
+
+double sc_time_stamp() { return 0; }
+
+void single_cycle(VM_PREFIX* topp) {
+    topp->clock = 1;
+    topp->eval();
+
+    topp->clock = 0;
+    topp->eval();
+}
+
+int main(int argc, char** argv) {
+    // Unlike t_wrapper_clone, stdout stays buffered, as forkSnapshot flushes it
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    topp->reset = 1;
+    topp->is_parent = 0;
+    for (int i = 0; i < 5; i++) single_cycle(topp.get());
+
+    topp->reset = 0;
+    while (!contextp->gotFinish()) {
+        single_cycle(topp.get());
+
+        if (topp->do_clone) {
+            const int pid = contextp->forkSnapshot();
+            if (pid < 0) {
+                printf("fork failed\n");
+            } else if (pid == 0) {
+                printf("child: here we go\n");
+            } else {
+                while (wait(nullptr) > 0)
+                    ;
+                printf("parent: here we go\n");
+                topp->is_parent = 1;
+            }
+        }
+    }
+
+    topp->final();
+    return 0;
+}
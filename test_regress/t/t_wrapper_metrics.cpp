@@ -0,0 +1,75 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module for VerilatedContext::metrics
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vcd_c.h>
+
+#include VM_PREFIX_INCLUDE
+
+#include <cstdio>
+#include <string>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static int s_callbacks = 0;
+
+static void metricsCb(VerilatedContext*, void* userp) {
+    TEST_CHECK_EQ(userp, static_cast<void*>(&s_callbacks));
+    ++s_callbacks;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    contextp->traceEverOn(true);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    VerilatedVcdC tfp;
+    topp->trace(&tfp, 99);
+    tfp.open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx.vcd");
+
+    // Evals before enabling are counted, but not timed
+    topp->clk = 0;
+    topp->eval();
+    TEST_CHECK_EQ(contextp->metrics().m_evals, 1ULL);
+    TEST_CHECK_EQ(contextp->metrics().m_evalNsP50, 0.0);
+
+    contextp->metricsEnable(true);
+    contextp->metricsCallback(metricsCb, &s_callbacks, 0.0);
+    uint64_t evals = 1;
+    while (!contextp->gotFinish()) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+        tfp.dump(contextp->time());
+        ++evals;
+    }
+    tfp.close();
+
+    const VerilatedMetrics metrics = contextp->metrics();
+    TEST_CHECK_EQ(metrics.m_evals, evals);
+    TEST_CHECK_EQ(static_cast<uint64_t>(s_callbacks), evals - 1);
+    TEST_CHECK_EQ(metrics.m_simTime, contextp->time());
+    TEST_CHECK_NZ(metrics.m_evalNsP50 > 0);
+    TEST_CHECK_NZ(metrics.m_evalNsP50 <= metrics.m_evalNsP90);
+    TEST_CHECK_NZ(metrics.m_evalNsP90 <= metrics.m_evalNsP99);
+    TEST_CHECK_NZ(metrics.m_traceBytes > 0);
+    TEST_CHECK_NZ(metrics.m_memBytes > 0);
+
+    const std::string text = contextp->metricsPrometheus();
+    TEST_CHECK_NZ(text.find("# TYPE verilator_evals_total counter\n") != std::string::npos);
+    TEST_CHECK_NZ(text.find("\nverilator_evals_total " + std::to_string(evals) + "\n")
+                  != std::string::npos);
+    TEST_CHECK_NZ(text.find("verilator_eval_latency_ns{quantile=\"0.99\"} ") != std::string::npos);
+
+    topp->final();
+    if (!errors) printf("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}